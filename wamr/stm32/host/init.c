@@ -0,0 +1,115 @@
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "init.h"
+
+/*
+ * The harness as a native process, for smoke tests and comparing the
+ * runtimes without the board. Time is CLOCK_MONOTONIC in nanoseconds and
+ * the trace goes to the file descriptor in TRACE_FD, framed like ITM
+ * stimulus port 0 packets so that the runner's SWO reader parses it.
+ */
+uintptr_t *host_stack_top;
+uintptr_t *host_stack_bottom;
+
+static int trace_fd = -1;
+
+int init(void)
+{
+	pthread_attr_t attr;
+	void *stack;
+	size_t size;
+
+	pthread_getattr_np(pthread_self(), &attr);
+	pthread_attr_getstack(&attr, &stack, &size);
+	pthread_attr_destroy(&attr);
+	host_stack_bottom = stack;
+	host_stack_top = (uintptr_t *)((char *)stack + size);
+
+	const char *fd = getenv("TRACE_FD");
+	if (fd != NULL)
+	{
+		trace_fd = atoi(fd);
+	}
+	/* the runner and the shell read line by line */
+	setvbuf(stdout, NULL, _IOLBF, 0);
+	return 0;
+}
+
+void trace_buffer(const uint8_t *buffer, size_t len)
+{
+	uint8_t packets[5 * 64];
+	size_t n = 0;
+
+	if (trace_fd < 0)
+	{
+		return;
+	}
+	while (len > 0)
+	{
+		size_t word = len >= 4 ? 4 : 1;
+		packets[n++] = word == 4 ? 0x03 : 0x01;
+		for (size_t i = 0; i < word; i++)
+		{
+			packets[n++] = *buffer++;
+		}
+		len -= word;
+		if (n > sizeof(packets) - 5 || len == 0)
+		{
+			if (write(trace_fd, packets, n) != (ssize_t)n)
+			{
+				perror("trace");
+				trace_fd = -1;
+				return;
+			}
+			n = 0;
+		}
+	}
+}
+
+/* trace_buffer() writes right away */
+void trace_drain(void)
+{
+}
+
+void trace_flush(void)
+{
+}
+
+uint64_t cycle_counter_read(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+uint32_t cycle_counter_hz(void)
+{
+	return 1000000000;
+}
+
+/* no DWT on the host */
+void pc_sampling_start(void)
+{
+}
+
+void pc_sampling_stop(void)
+{
+}
+
+void dwt_events_start(void)
+{
+}
+
+void dwt_events_stop(void)
+{
+}
+
+void dwt_events_mark(uint8_t tag)
+{
+	(void)tag;
+}
@@ -3,6 +3,7 @@
 #include <ctype.h>
 #include <sys/time.h>
 #include <sys/times.h>
+#include <time.h>
 
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
@@ -14,6 +15,8 @@
 #include <libopencm3/stm32/pwr.h>
 #include <libopencm3/cm3/itm.h>
 #include <libopencm3/cm3/systick.h>
+#include <libopencm3/cm3/dwt.h>
+#include <libopencm3/cm3/cortex.h>
 #include "init.h"
 
 /*
@@ -74,9 +77,14 @@ static void clock_setup(void)
 	/* Enable clocks for USART2. */
 	rcc_periph_clock_enable(RCC_USART2);
 
-	systick_set_reload(UINT32_MAX);
-	// systick_set_frequency(1000, 80000000);
-	systick_set_frequency(1000, 80000000);
+	/*
+	 * Time is kept by the DWT cycle counter. SysTick only has to fire
+	 * often enough to catch every CYCCNT wrap (~53s at 80MHz), so use
+	 * the longest reload to keep it out of the measured code.
+	 */
+	dwt_enable_cycle_counter();
+	systick_set_clocksource(STK_CSR_CLKSOURCE_AHB);
+	systick_set_reload(STK_RVR_RELOAD);
 
 	systick_interrupt_enable();
 	systick_counter_enable();
@@ -106,7 +114,7 @@ static void usart_setup(void)
 	usart_set_baudrate(USART2, 115200);
 	usart_set_databits(USART2, 8);
 	usart_set_stopbits(USART2, USART_STOPBITS_1);
-	usart_set_mode(USART2, USART_MODE_TX);
+	usart_set_mode(USART2, USART_MODE_TX_RX);
 	usart_set_parity(USART2, USART_PARITY_NONE);
 	usart_set_flow_control(USART2, USART_FLOWCONTROL_NONE);
 
@@ -116,28 +124,160 @@ static void usart_setup(void)
 
 static void gpio_setup(void)
 {
-	/* Setup GPIO pins for USART2 transmit. */
-	gpio_mode_setup(GPIOA, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO1 | GPIO2);
+	/* Setup GPIO pins for USART2 transmit and receive (PA3 for the shell). */
+	gpio_mode_setup(GPIOA, GPIO_MODE_AF, GPIO_PUPD_PULLUP, GPIO1 | GPIO2 | GPIO3);
 
-	/* Setup USART2 TX pin as alternate function. */
-	gpio_set_af(GPIOA, GPIO_AF7, GPIO1 | GPIO2);
+	/* Setup USART2 TX and RX pins as alternate function. */
+	gpio_set_af(GPIOA, GPIO_AF7, GPIO1 | GPIO2 | GPIO3);
 }
 
-static void trace_send_blocking(const uint8_t c)
+/*
+ * trace_buffer() only copies into this ring. It is pushed to the ITM as
+ * 32 bit words whenever the stimulus FIFO has room, so that tracing does
+ * not stall the traced code on the SWO baud rate.
+ */
+#ifdef HEAP_TRACE
+#define TRACE_RING_SIZE 4096
+#else
+#define TRACE_RING_SIZE 64
+#endif
+static uint8_t trace_ring[TRACE_RING_SIZE];
+static uint32_t trace_head;
+static uint32_t trace_tail;
+
+static bool trace_push(bool wait)
 {
+	uint32_t used = trace_head - trace_tail;
+	if (used == 0)
+	{
+		return false;
+	}
+	if (used >= 4)
+	{
+		if (!(ITM_STIM32(0) & ITM_STIM_FIFOREADY))
+		{
+			if (!wait)
+			{
+				return false;
+			}
+			while (!(ITM_STIM32(0) & ITM_STIM_FIFOREADY))
+				;
+		}
+		uint32_t word = 0;
+		for (int i = 0; i < 4; i++)
+		{
+			word |= (uint32_t)trace_ring[(trace_tail + i) % TRACE_RING_SIZE] << (8 * i);
+		}
+		ITM_STIM32(0) = word;
+		trace_tail += 4;
+		return true;
+	}
+	/* less than a word left, only sent when flushing */
+	if (!wait)
+	{
+		return false;
+	}
 	while (!(ITM_STIM8(0) & ITM_STIM_FIFOREADY))
 		;
+	ITM_STIM8(0) = trace_ring[trace_tail % TRACE_RING_SIZE];
+	trace_tail++;
+	return true;
+}
 
-	ITM_STIM8(0) = c;
+void trace_drain(void)
+{
+	while (trace_push(false))
+		;
 }
 
+void trace_flush(void)
+{
+	while (trace_push(true))
+		;
+}
 
 void trace_buffer(const uint8_t *buffer, size_t len)
 {
-	for (const uint8_t *c = buffer; (c - buffer) < len; c++)
+	for (size_t i = 0; i < len; i++)
 	{
-		trace_send_blocking(*c);
+		if (trace_head - trace_tail == TRACE_RING_SIZE)
+		{
+			trace_push(true);
+		}
+		trace_ring[trace_head % TRACE_RING_SIZE] = buffer[i];
+		trace_head++;
 	}
+	trace_drain();
+}
+
+/*
+ * DWT PC sampling, every (PC_SAMPLE_PRESET + 1) * 1024 cycles. The samples
+ * go out as hardware source packets next to the stimulus port data, the
+ * TPIU itself is set up by openocd.
+ */
+#ifndef PC_SAMPLE_PRESET
+#define PC_SAMPLE_PRESET 15
+#endif
+
+void pc_sampling_start(void)
+{
+	ITM_LAR = 0xC5ACCE55;
+	ITM_TCR |= ITM_TCR_DWTENA;
+	DWT_CTRL = (DWT_CTRL & ~DWT_CTRL_POSTPRESET) | DWT_CTRL_CYCTAP |
+			   (PC_SAMPLE_PRESET << DWT_CTRL_POSTPRESET_SHIFT);
+	DWT_CTRL |= DWT_CTRL_PCSAMPLENA;
+}
+
+void pc_sampling_stop(void)
+{
+	DWT_CTRL &= ~DWT_CTRL_PCSAMPLENA;
+}
+
+#define DWT_MARK_PORT 1
+/*
+ * Only the counters of this pass, each enabled 8 bit counter sends a wrap
+ * packet every 256 events and CPI and LSU alone can overflow the ITM.
+ */
+#ifndef DWT_EVENT_MASK
+#define DWT_EVENT_MASK 0x1f
+#endif
+#define DWT_EVENTS_ENABLE ((DWT_EVENT_MASK & 0x01 ? DWT_CTRL_CPIEVTENA : 0) |   \
+						   (DWT_EVENT_MASK & 0x02 ? DWT_CTRL_EXCEVTENA : 0) |   \
+						   (DWT_EVENT_MASK & 0x04 ? DWT_CTRL_SLEEPEVTENA : 0) | \
+						   (DWT_EVENT_MASK & 0x08 ? DWT_CTRL_LSUEVTENA : 0) |   \
+						   (DWT_EVENT_MASK & 0x10 ? DWT_CTRL_FOLDEVTENA : 0))
+
+void dwt_events_start(void)
+{
+	ITM_LAR = 0xC5ACCE55;
+	/* openocd only turns on port 0 */
+	ITM_TER[0] |= 1 << DWT_MARK_PORT;
+	ITM_TCR |= ITM_TCR_DWTENA;
+	DWT_CPICNT = 0;
+	DWT_EXCCNT = 0;
+	DWT_SLEEPCNT = 0;
+	DWT_LSUCNT = 0;
+	DWT_FOLDCNT = 0;
+	DWT_CTRL |= DWT_EVENTS_ENABLE;
+}
+
+void dwt_events_stop(void)
+{
+	DWT_CTRL &= ~DWT_EVENTS_ENABLE;
+}
+
+void dwt_events_mark(uint8_t tag)
+{
+	/* wait first, so that the counts are sent right after reading them */
+	while (!(ITM_STIM32(DWT_MARK_PORT) & ITM_STIM_FIFOREADY))
+		;
+	uint32_t counts = (DWT_CPICNT & 0xff) | (DWT_EXCCNT & 0xff) << 8 |
+					  (DWT_SLEEPCNT & 0xff) << 16 | (DWT_LSUCNT & 0xff) << 24;
+	uint16_t fold = DWT_FOLDCNT & 0xff;
+	ITM_STIM32(DWT_MARK_PORT) = counts;
+	while (!(ITM_STIM16(DWT_MARK_PORT) & ITM_STIM_FIFOREADY))
+		;
+	ITM_STIM16(DWT_MARK_PORT) = fold | tag << 8;
 }
 
 int init(void)
@@ -286,16 +426,40 @@ int _read(int fd, char *ptr, int len)
 	return my_len; /* return the length we got */
 }
 
-uint32_t ms_since_boot = 0;
+static uint32_t cycles_last;
+static uint32_t cycles_wraps;
+
+/*
+ * Extend the 32 bit CYCCNT to 64 bits. Must be called at least once per
+ * wrap, which the SysTick handler guarantees.
+ */
+uint64_t cycle_counter_read(void)
+{
+	bool masked = cm_mask_interrupts(true);
+	uint32_t now = dwt_read_cycle_counter();
+	if (now < cycles_last)
+	{
+		cycles_wraps++;
+	}
+	cycles_last = now;
+	uint64_t result = ((uint64_t)cycles_wraps << 32) | now;
+	cm_mask_interrupts(masked);
+	return result;
+}
+
+uint32_t cycle_counter_hz(void)
+{
+	return rcc_ahb_frequency;
+}
 
 void sys_tick_handler(void)
 {
-	ms_since_boot++;
+	cycle_counter_read();
 }
 
 int _times(struct tms *buf)
 {
-	buf->tms_utime = (ms_since_boot) / (1000 / CLOCKS_PER_SEC);
+	buf->tms_utime = cycle_counter_read() / (cycle_counter_hz() / CLOCKS_PER_SEC);
 	buf->tms_cutime = 0;
 	buf->tms_stime = 0;
 	buf->tms_cstime = 0;
@@ -0,0 +1,437 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <sys/time.h>
+#include <sys/times.h>
+#include <time.h>
+
+#include <libopencm3/cm3/common.h>
+#include <libopencm3/cm3/scb.h>
+#include <libopencm3/cm3/systick.h>
+#include <libopencm3/cm3/cortex.h>
+#include "init.h"
+
+/*
+ * Board support for QEMU's mps2-an386 (Cortex-M4). stdio goes to the
+ * CMSDK UART0, the trace to UART1 framed like ITM stimulus port 0
+ * packets, so that the runner reads both like on the STM32. Returning
+ * from main ends QEMU over semihosting.
+ */
+int _write(int fd, char *ptr, int len);
+int _read(int fd, char *ptr, int len);
+int _times(struct tms *buf);
+void get_buffered_line(void);
+
+#define BUFLEN 127
+
+static uint16_t start_ndx;
+static uint16_t end_ndx;
+static char buf[BUFLEN + 1];
+#define buf_len ((end_ndx - start_ndx) % BUFLEN)
+static inline int inc_ndx(int n)
+{
+	return ((n + 1) % BUFLEN);
+}
+static inline int dec_ndx(int n) { return (((n + BUFLEN) - 1) % BUFLEN); }
+
+#define MPS2_SYSCLK 25000000
+
+/* CMSDK APB UART */
+#define UART0 0x40004000
+#define UART1 0x40005000
+#define UART_DATA(uart) MMIO32((uart) + 0x00)
+#define UART_STATE(uart) MMIO32((uart) + 0x04)
+#define UART_CTRL(uart) MMIO32((uart) + 0x08)
+#define UART_BAUDDIV(uart) MMIO32((uart) + 0x10)
+#define UART_STATE_TXFULL (1 << 0)
+#define UART_STATE_RXFULL (1 << 1)
+#define UART_CTRL_TXEN (1 << 0)
+#define UART_CTRL_RXEN (1 << 1)
+
+#define TRACE_UART UART1
+
+#define SYS_EXIT 0x18
+#define ADP_STOPPED_APPLICATION_EXIT 0x20026
+#define ADP_STOPPED_RUN_TIME_ERROR 0x20023
+
+static void semihosting_exit(int status)
+{
+	register uint32_t r0 __asm__("r0") = SYS_EXIT;
+	register uint32_t r1 __asm__("r1") = status == 0 ? ADP_STOPPED_APPLICATION_EXIT : ADP_STOPPED_RUN_TIME_ERROR;
+	__asm__ volatile("bkpt 0xab" : "+r"(r0) : "r"(r1) : "memory");
+	/* without -semihosting the bkpt stops here */
+	while (1)
+	{
+	}
+}
+
+static void uart_send_blocking(uint32_t uart, uint8_t c)
+{
+	while (UART_STATE(uart) & UART_STATE_TXFULL)
+		;
+	UART_DATA(uart) = c;
+}
+
+static uint8_t uart_recv_blocking(uint32_t uart)
+{
+	while (!(UART_STATE(uart) & UART_STATE_RXFULL))
+		;
+	return UART_DATA(uart);
+}
+
+static void clock_setup(void)
+{
+	/*
+	 * QEMU has no DWT cycle counter, time is kept by SysTick on the
+	 * core clock instead. It advances with QEMU's virtual clock, so the
+	 * runner passes -icount to make it count instructions.
+	 */
+	STK_RVR = STK_RVR_RELOAD;
+	STK_CVR = 0;
+	STK_CSR = STK_CSR_CLKSOURCE_AHB | STK_CSR_TICKINT | STK_CSR_ENABLE;
+}
+
+static void usart_setup(void)
+{
+	UART_BAUDDIV(UART0) = MPS2_SYSCLK / 115200;
+	UART_CTRL(UART0) = UART_CTRL_TXEN | UART_CTRL_RXEN;
+	UART_BAUDDIV(TRACE_UART) = MPS2_SYSCLK / 115200;
+	UART_CTRL(TRACE_UART) = UART_CTRL_TXEN;
+}
+
+/*
+ * Same ring as on the STM32, drained into the trace UART. Words go out as
+ * 0x03 + 4 bytes and single bytes as 0x01 + 1 byte, the stimulus port 0
+ * packets the runner's SWO reader expects.
+ */
+#ifdef HEAP_TRACE
+#define TRACE_RING_SIZE 4096
+#else
+#define TRACE_RING_SIZE 64
+#endif
+static uint8_t trace_ring[TRACE_RING_SIZE];
+static uint32_t trace_head;
+static uint32_t trace_tail;
+
+static bool trace_push(bool wait)
+{
+	uint32_t used = trace_head - trace_tail;
+	if (used == 0)
+	{
+		return false;
+	}
+	/* less than a word left is only sent when flushing */
+	if (used < 4 && !wait)
+	{
+		return false;
+	}
+	if (!wait && (UART_STATE(TRACE_UART) & UART_STATE_TXFULL))
+	{
+		return false;
+	}
+	uint32_t n = used >= 4 ? 4 : 1;
+	uart_send_blocking(TRACE_UART, n == 4 ? 0x03 : 0x01);
+	for (uint32_t i = 0; i < n; i++)
+	{
+		uart_send_blocking(TRACE_UART, trace_ring[(trace_tail + i) % TRACE_RING_SIZE]);
+	}
+	trace_tail += n;
+	return true;
+}
+
+void trace_drain(void)
+{
+	while (trace_push(false))
+		;
+}
+
+void trace_flush(void)
+{
+	while (trace_push(true))
+		;
+}
+
+void trace_buffer(const uint8_t *buffer, size_t len)
+{
+	for (size_t i = 0; i < len; i++)
+	{
+		if (trace_head - trace_tail == TRACE_RING_SIZE)
+		{
+			trace_push(true);
+		}
+		trace_ring[trace_head % TRACE_RING_SIZE] = buffer[i];
+		trace_head++;
+	}
+	trace_drain();
+}
+
+/*
+ * QEMU models neither the DWT nor the ITM, PC sampling and the event
+ * counters are not available on this board. The marks are stores to
+ * qemu_marks[tag] instead, which the insn-count.c plugin turns into
+ * instruction and memory access counts.
+ */
+volatile uint8_t qemu_marks[4];
+
+void pc_sampling_start(void)
+{
+}
+
+void pc_sampling_stop(void)
+{
+}
+
+void dwt_events_start(void)
+{
+}
+
+void dwt_events_stop(void)
+{
+}
+
+void dwt_events_mark(uint8_t tag)
+{
+	qemu_marks[tag % sizeof(qemu_marks)] = tag;
+}
+
+int init(void)
+{
+	clock_setup();
+	usart_setup();
+
+	return 0;
+}
+
+/* back up the cursor one space */
+static inline void back_up(void)
+{
+	end_ndx = dec_ndx(end_ndx);
+	uart_send_blocking(UART0, '\010');
+	uart_send_blocking(UART0, ' ');
+	uart_send_blocking(UART0, '\010');
+}
+
+/*
+ * A buffered line editing function.
+ */
+void get_buffered_line(void)
+{
+	char c;
+
+	if (start_ndx != end_ndx)
+	{
+		return;
+	}
+	while (1)
+	{
+		c = uart_recv_blocking(UART0);
+		if (c == '\r' || c == '\n')
+		{
+			buf[end_ndx] = '\n';
+			end_ndx = inc_ndx(end_ndx);
+			buf[end_ndx] = '\0';
+			uart_send_blocking(UART0, '\r');
+			uart_send_blocking(UART0, '\n');
+			return;
+		}
+		/* ^H or DEL erase a character */
+		if ((c == '\010') || (c == '\177'))
+		{
+			if (buf_len == 0)
+			{
+				uart_send_blocking(UART0, '\a');
+			}
+			else
+			{
+				back_up();
+			}
+			/* ^W erases a word */
+		}
+		else if (c == 0x17)
+		{
+			while ((buf_len > 0) &&
+				   (!(isspace((int)buf[end_ndx]))))
+			{
+				back_up();
+			}
+			/* ^U erases the line */
+		}
+		else if (c == 0x15)
+		{
+			while (buf_len > 0)
+			{
+				back_up();
+			}
+			/* Non-editing character so insert it */
+		}
+		else
+		{
+			if (buf_len == (BUFLEN - 1))
+			{
+				uart_send_blocking(UART0, '\a');
+			}
+			else
+			{
+				buf[end_ndx] = c;
+				end_ndx = inc_ndx(end_ndx);
+				uart_send_blocking(UART0, c);
+			}
+		}
+	}
+}
+
+/*
+ * Called by libc stdio fwrite functions
+ */
+int _write(int fd, char *ptr, int len)
+{
+	int i = 0;
+
+	if (fd > 2)
+	{
+		return -1;
+	}
+	while (*ptr && (i < len))
+	{
+		uart_send_blocking(UART0, *ptr);
+		if (*ptr == '\n')
+		{
+			uart_send_blocking(UART0, '\r');
+		}
+		i++;
+		ptr++;
+	}
+	return i;
+}
+
+/*
+ * Called by the libc stdio fread fucntions
+ *
+ * Implements a buffered read with line editing.
+ */
+int _read(int fd, char *ptr, int len)
+{
+	int my_len;
+
+	if (fd > 2)
+	{
+		return -1;
+	}
+
+	get_buffered_line();
+	my_len = 0;
+	while ((buf_len > 0) && (len > 0))
+	{
+		*ptr++ = buf[start_ndx];
+		start_ndx = inc_ndx(start_ndx);
+		my_len++;
+		len--;
+	}
+	return my_len; /* return the length we got */
+}
+
+static uint32_t systick_wraps;
+
+/*
+ * SysTick counts down from its 24 bit reload, every wrap is counted by
+ * the handler. A wrap that is still pending is counted here.
+ */
+uint64_t cycle_counter_read(void)
+{
+	bool masked = cm_mask_interrupts(true);
+	uint64_t wraps = systick_wraps;
+	uint32_t now = STK_CVR;
+	if (SCB_ICSR & SCB_ICSR_PENDSTSET)
+	{
+		wraps++;
+		now = STK_CVR;
+	}
+	uint64_t result = wraps * (STK_RVR_RELOAD + 1) + (STK_RVR_RELOAD - now);
+	cm_mask_interrupts(masked);
+	return result;
+}
+
+uint32_t cycle_counter_hz(void)
+{
+	return MPS2_SYSCLK;
+}
+
+void sys_tick_handler(void)
+{
+	systick_wraps++;
+}
+
+int _times(struct tms *buf)
+{
+	buf->tms_utime = cycle_counter_read() / (cycle_counter_hz() / CLOCKS_PER_SEC);
+	buf->tms_cutime = 0;
+	buf->tms_stime = 0;
+	buf->tms_cstime = 0;
+	return 0;
+}
+
+typedef void (*funcp_t)(void);
+extern funcp_t __preinit_array_start, __preinit_array_end;
+extern funcp_t __init_array_start, __init_array_end;
+extern funcp_t __fini_array_start, __fini_array_end;
+void _fini(void)
+{
+	printf("_fini\n");
+	for (funcp_t *fp = &__fini_array_start; fp < &__fini_array_end; fp++)
+	{
+		(*fp)();
+	}
+	semihosting_exit(0);
+}
+
+/*
+ * Startup, libopencm3 has no vector table for this board.
+ */
+extern unsigned _data_loadaddr, _data, _edata, _ebss, _stack;
+int main(void);
+void reset_handler(void);
+
+static void fault_handler(void)
+{
+	semihosting_exit(1);
+}
+
+void reset_handler(void)
+{
+	volatile unsigned *src, *dest;
+
+	for (src = &_data_loadaddr, dest = &_data; dest < &_edata; src++, dest++)
+	{
+		*dest = *src;
+	}
+	while (dest < &_ebss)
+	{
+		*dest++ = 0;
+	}
+	/* the harness is built with -mfloat-abi=hard */
+	SCB_CPACR |= SCB_CPACR_FULL * (SCB_CPACR_CP10 | SCB_CPACR_CP11);
+	for (funcp_t *fp = &__preinit_array_start; fp < &__preinit_array_end; fp++)
+	{
+		(*fp)();
+	}
+	for (funcp_t *fp = &__init_array_start; fp < &__init_array_end; fp++)
+	{
+		(*fp)();
+	}
+	semihosting_exit(main());
+}
+
+__attribute__((section(".vectors"), used))
+const funcp_t vector_table[16] = {
+	(funcp_t)&_stack,
+	reset_handler,
+	fault_handler, /* NMI */
+	fault_handler, /* HardFault */
+	fault_handler, /* MemManage */
+	fault_handler, /* BusFault */
+	fault_handler, /* UsageFault */
+	[11] = fault_handler, /* SVCall */
+	[12] = fault_handler, /* DebugMonitor */
+	[14] = fault_handler, /* PendSV */
+	[15] = sys_tick_handler,
+};
@@ -1,8 +1,10 @@
 #include "benchmarks.h"
 #include "benchmarks-defs.h"
+#include "init.h"
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <wasm_export.h>
 #include <wasm_c_api.h>
@@ -17,8 +19,18 @@ typedef int (*module_hook)(wasm_module_inst_t *module, wasm_val_t *args);
 #define _TEST_result expander(BENCHMARK, _test)
 
 uint32_t register_wasi();
-int run_bench(uint8_t *mod, size_t mod_size, wasm_val_t *args, size_t args_len,
-              wasm_val_t *results, size_t results_len, module_hook hook, uint32_t heap_size)
+#ifdef WAMR_POOL
+/* the pool region of device.ld */
+extern uint8_t __wamr_pool_start[], __wamr_pool_end[];
+#endif
+static void print_delay(const char *label, uint64_t cycles)
+{
+    printf("%s runtime delay: %lums\n", label,
+           (unsigned long)(cycles * 1000 / cycle_counter_hz()));
+    printf("%s runtime cycles: %llu\n", label, (unsigned long long)cycles);
+}
+static int run_module(uint8_t *mod, size_t mod_size, wasm_val_t *args, size_t args_len,
+                      wasm_val_t *results, size_t results_len, module_hook hook, uint32_t heap_size)
 {
     char error_buf[128];
     wasm_module_t module;
@@ -29,33 +41,61 @@ int run_bench(uint8_t *mod, size_t mod_size, wasm_val_t *args, size_t args_len,
 
     /* initialize the wasm runtime by default configurations */
     RuntimeInitArgs runtime_args = {
+#ifdef WAMR_POOL
+        .mem_alloc_type = Alloc_With_Pool,
+        .mem_alloc_option.pool.heap_buf = __wamr_pool_start,
+        .mem_alloc_option.pool.heap_size = __wamr_pool_end - __wamr_pool_start,
+#else
         .mem_alloc_type = Alloc_With_System_Allocator,
+#endif
         .running_mode = Mode_Interp,
     };
-    clock_t start = clock();
+    uint64_t start = measure_now();
     __sync_synchronize();
+    measure_begin();
     wasm_runtime_full_init(&runtime_args);
+    measure_phase("init");
 
     if (!register_wasi())
     {
         printf("Error registering native functions.\n");
         return 1;
     }
+    measure_phase("register");
     /* parse the WASM file from buffer and create a WASM module */
+#ifdef ROM_MODULE
+    /* a freeable binary is never written to, what the module keeps is cloned */
+    LoadArgs load_args = {.name = "", .wasm_binary_freeable = true};
+    module = wasm_runtime_load_ex(mod, mod_size, &load_args, error_buf, sizeof(error_buf));
+#else
     module = wasm_runtime_load(mod, mod_size, error_buf, sizeof(error_buf));
+#endif
+    if (!module)
+    {
+        printf("error loading wasm module!\n%s\n", error_buf);
+        return 1;
+    }
+    measure_phase("load");
 
     /* create an instance of the WASM module (WASM linear memory is ready) */
     module_inst = wasm_runtime_instantiate(module, stack_size, heap_size,
                                            error_buf, sizeof(error_buf));
+    if (!module_inst)
+    {
+        printf("error instantiating wasm module!\n%s\n", error_buf);
+        return 1;
+    }
 
     if (hook && hook(&module_inst, args))
     {
         printf("error running module hook!\n");
         return 1;
     }
+    measure_phase("instantiate");
 
     // func = wasm_runtime_lookup_function(module_inst, "_initialize");
     exec_env = wasm_runtime_create_exec_env(module_inst, stack_size);
+    measure_phase("exec_env");
     // if (func && !wasm_runtime_call_wasm_a(exec_env, func, 0, NULL, 0, NULL))
     // {
         // printf("error initializing wasm module!\n%s\n", wasm_runtime_get_exception(module_inst));
@@ -68,32 +108,122 @@ int run_bench(uint8_t *mod, size_t mod_size, wasm_val_t *args, size_t args_len,
         return 1;
     }
     __sync_synchronize();
-    clock_t end = clock();
-    printf("First runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
-#ifndef HEAP_TRACE
-    start = clock();
-    __sync_synchronize();
-    if (!wasm_runtime_call_wasm_a(exec_env, func, results_len, results, args_len, args))
+    uint64_t end = measure_now();
+    measure_phase("call");
+    uint64_t first = end - start;
+    uint64_t second = 0;
+    for (uint32_t i = 0; i < bench_warmup + bench_iterations; i++)
     {
-        printf("error executing wasm function!\n%s\n", wasm_runtime_get_exception(module_inst));
-        return 1;
+        start = measure_now();
+        __sync_synchronize();
+        if (!wasm_runtime_call_wasm_a(exec_env, func, results_len, results, args_len, args))
+        {
+            printf("error executing wasm function!\n%s\n", wasm_runtime_get_exception(module_inst));
+            return 1;
+        }
+        __sync_synchronize();
+        end = measure_now();
+        if (i == bench_warmup)
+            second = end - start;
+        measure_sample(end - start);
     }
-    __sync_synchronize();
-    end = clock();
-    printf("Second runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
+    measure_phase("run");
+#ifdef PERF_PROFILING
+    wasm_runtime_dump_perf_profiling(module_inst);
+    measure_phase("perf_dump");
 #endif
     wasm_runtime_destroy_exec_env(exec_env);
     wasm_runtime_deinstantiate(module_inst);
     wasm_runtime_unload(module);
     wasm_runtime_destroy();
+    measure_phase("teardown");
+    print_delay("First", first);
+    print_delay("Second", second);
     return 0;
 }
-#ifdef EMBENCH
+/*
+ * The modules are const and stay in flash. Loading rewrites the bytecode
+ * in place, so the runtime gets a copy on the heap, except in ROM_MODULE
+ * builds where the loader only reads the module.
+ */
+int run_bench(const uint8_t *mod, size_t mod_size, wasm_val_t *args, size_t args_len,
+              wasm_val_t *results, size_t results_len, module_hook hook, uint32_t heap_size)
+{
+#ifdef ROM_MODULE
+    return run_module((uint8_t *)mod, mod_size, args, args_len, results, results_len, hook, heap_size);
+#else
+    uint8_t *copy = malloc(mod_size);
+    if (!copy)
+    {
+        printf("no memory for a copy of the module\n");
+        return 1;
+    }
+    memcpy(copy, mod, mod_size);
+    int err = run_module(copy, mod_size, args, args_len, results, results_len, hook, heap_size);
+    free(copy);
+    return err;
+#endif
+}
+#ifdef BENCH_SHELL
+static int knucleotide_hook(wasm_module_inst_t *instance, wasm_val_t *args);
+static int rc_hook(wasm_module_inst_t *instance, wasm_val_t *args);
+
+static bench_result run_entry(const bench_run *run)
+{
+    const bench_entry *entry = run->entry;
+    const module_hook hooks[] = {
+        [BENCH_HOOK_NONE] = NULL,
+        [BENCH_HOOK_KNUCLEOTIDE] = knucleotide_hook,
+        [BENCH_HOOK_REVERSE_COMPLEMENT] = rc_hook,
+    };
+    wasm_val_t results[1];
+    wasm_val_t funargs[BENCH_MAX_ARGS];
+    for (size_t i = 0; i < run->args_len; i++)
+    {
+        funargs[i].kind = WASM_I32;
+        funargs[i].of.i32 = run->args[i];
+    }
+    int err = run_bench(entry->module, entry->size, funargs, run->args_len, results, 1,
+                        hooks[entry->hook], run->heap_size);
+    if (!err)
+    {
+        printf("Result: name=%s value=%ld\n", entry->name, (long)results[0].of.i32);
+    }
+    return err;
+}
+#elif defined(MODULE_SLOT)
+module_slot bench_slot;
+
+static bench_result run_slot(bench_args args)
+{
+    if (bench_slot.magic != MODULE_SLOT_MAGIC || bench_slot.size > sizeof bench_slot.module ||
+        bench_slot.args_len > MODULE_SLOT_VALUES || bench_slot.results_len > MODULE_SLOT_VALUES)
+    {
+        printf("no module in the slot\n");
+        return 1;
+    }
+    wasm_val_t funargs[MODULE_SLOT_VALUES];
+    wasm_val_t results[MODULE_SLOT_VALUES];
+    for (size_t i = 0; i < bench_slot.args_len; i++)
+    {
+        funargs[i].kind = WASM_I32;
+        funargs[i].of.i32 = bench_slot.args[i];
+    }
+    /* the slot is in RAM already */
+    int err = run_module(bench_slot.module, bench_slot.size, funargs, bench_slot.args_len,
+                         results, bench_slot.results_len, NULL, bench_slot.heap_size);
+    for (size_t i = 0; !err && i < bench_slot.results_len; i++)
+    {
+        printf("slot result: %ld\n", (long)results[i].of.i32);
+    }
+    return err;
+}
+#elif defined(EMBENCH)
 #define FUN_NAME_GEN(b) run_##b
 #define FUN_NAME expander(BENCHMARK, FUN_NAME_GEN)
 __attribute__((weak)) bench_result FUN_NAME(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     int err = run_bench(BENCH, SIZE, NULL, 0, results, 1, NULL, 1 << 13);
@@ -109,7 +239,7 @@ __attribute__((weak)) bench_result FUN_NAME(bench_args args)
 #else
 static bench_result run_fannkuch_redux(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -124,7 +254,7 @@ static bench_result run_fannkuch_redux(bench_args args)
 }
 static bench_result run_coremark(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     int err = run_bench(BENCH, SIZE, NULL, 0, results, 1, NULL, 1 << 13);
@@ -138,7 +268,7 @@ static bench_result run_coremark_standalone(bench_args args) __attribute__((alia
 static bench_result run_coremark_semihosted(bench_args args) __attribute__((alias("run_coremark")));
 static bench_result run_binary_trees(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -153,7 +283,7 @@ static bench_result run_binary_trees(bench_args args)
 }
 static bench_result run_dhrystone_semihosted(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -169,7 +299,7 @@ static bench_result run_dhrystone_semihosted(bench_args args)
 static bench_result run_dhrystone_standalone(bench_args args) __attribute__((alias("run_dhrystone_semihosted")));
 static bench_result run_nbody(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -184,7 +314,7 @@ static bench_result run_nbody(bench_args args)
 }
 static bench_result run_spectral_norm(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -200,7 +330,7 @@ static bench_result run_spectral_norm(bench_args args)
 
 static bench_result run_fasta(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -213,7 +343,8 @@ static bench_result run_fasta(bench_args args)
     }
     return err;
 }
-#if _TEST_result == _TEST_knucleotide || _TEST_result == _TEST_reverse_complement
+#endif // embench
+#if defined(BENCH_SHELL) || _TEST_result == _TEST_knucleotide || _TEST_result == _TEST_reverse_complement
 static const char input[] = ">ONE Homo sapiens alu\n"
                             "GGCCGGGCGCGGTGGCTCACGCCTGTAATCCCAGCACTTTGGGAGGCCGAGGCGGGCGGA\n"
                             "TCACCTGAGGTCAGGAGTTCGAGACCAGCCTGGCCAACATGGTGAAACCCCGTCTCTACT\n"
@@ -386,7 +517,7 @@ static const char input[] = ">ONE Homo sapiens alu\n"
                             "ccaacattacccggtatgacaaaatgacgccacgtgtcgaataatggtctgaccaatgta\n"
                             "ggaagtgaaaagataaatat";
 #endif
-#if _TEST_result == _TEST_knucleotide
+#if defined(BENCH_SHELL) || _TEST_result == _TEST_knucleotide
 static int knucleotide_hook(wasm_module_inst_t *instance, wasm_val_t *args)
 {
     uint32_t buff = wasm_runtime_module_dup_data(*instance, input, sizeof input);
@@ -398,9 +529,11 @@ static int knucleotide_hook(wasm_module_inst_t *instance, wasm_val_t *args)
     args[1].of.i32 = sizeof input;
     return 0;
 }
+#endif
+#if _TEST_result == _TEST_knucleotide
 static bench_result run_knucleotide(bench_args args)
 {
-    uint8_t *BENCH = knucleotide;
+    const uint8_t *BENCH = knucleotide;
     const size_t SIZE = sizeof knucleotide;
     wasm_val_t results[1];
     wasm_val_t funargs[2];
@@ -415,7 +548,7 @@ static bench_result run_knucleotide(bench_args args)
     return err;
 }
 #endif
-#if _TEST_result == _TEST_reverse_complement
+#if defined(BENCH_SHELL) || _TEST_result == _TEST_reverse_complement
 static int rc_hook(wasm_module_inst_t *instance, wasm_val_t *args)
 {
     uint32_t buff = wasm_runtime_module_dup_data(*instance, input, sizeof input);
@@ -426,9 +559,11 @@ static int rc_hook(wasm_module_inst_t *instance, wasm_val_t *args)
     args[0].of.i32 = buff;
     return 0;
 }
+#endif
+#if _TEST_result == _TEST_reverse_complement
 static bench_result run_reverse_complement(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     wasm_val_t results[1];
     wasm_val_t funargs[1];
@@ -442,13 +577,16 @@ static bench_result run_reverse_complement(bench_args args)
     return err;
 }
 #endif
-#endif // embench
 bench_result run_active_bench(bench_args args)
 {
+#ifdef BENCH_SHELL
+    return run_entry(args);
+#else
 #define FUN(B) (run_##B(args))
     bench_result res = expander(BENCHMARK, FUN);
 #undef FUN
     return res;
+#endif
 }
 
 #undef expander
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include <stdio.h>
 #include <math.h>
 #include <time.h>
+#include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <wasm_export.h>
 #include <wasm_c_api.h>
@@ -267,25 +269,69 @@ uint32_t register_wasi()
 										 native_symbols,
 										 n_native_symbols);
 }
+#ifdef HOST
+/* no linker symbols on the host, init() looks up the process stack */
+extern uintptr_t *host_stack_top;
+extern uintptr_t *host_stack_bottom;
+#define STACK_TOP host_stack_top
+#define STACK_BOTTOM host_stack_bottom
+#define READ_SP(sp) ((sp) = __builtin_frame_address(0))
+#else
 extern uintptr_t _stack;
 extern uintptr_t __bss_end__;
+#define STACK_TOP (&_stack)
+#define STACK_BOTTOM (&__bss_end__ + 1)
+#define READ_SP(sp) asm volatile("mov %0, sp" \
+								 : "=r"(sp))
+#endif
+/*
+ * The stack is painted once at boot, at most STACK_PAINT_BYTES deep. Phase
+ * boundaries then only repaint what was dirtied, from just below the current
+ * stack pointer down to the deepest word written so far.
+ */
+#ifndef STACK_PAINT_BYTES
+#define STACK_PAINT_BYTES 0x10000
+#endif
+#define STACK_MARKER 0xDEADBEEF
+static uintptr_t *stack_floor;
+static uintptr_t *stack_low;
+/* nothing below it was written since it was painted */
+static uintptr_t *stack_dirty;
+static size_t stack_max = 0;
+
+static void paint_stack(uintptr_t *low)
+{
+	uintptr_t *sp;
+	READ_SP(sp);
+	/*
+	 * right below this frame, a gap would stay unpainted and count
+	 * towards every later phase. 16 words clear the host's red zone.
+	 */
+	for (uintptr_t *ptr = sp - 16; ptr >= low; ptr--)
+	{
+		*ptr = STACK_MARKER;
+	}
+}
 static void mark_stack()
 {
 	uintptr_t *sp;
-	asm volatile("mov %0, sp"
-				 : "=r"(sp));
-	for (uintptr_t *ptr = sp - 0x100; ptr > &__bss_end__; ptr--)
+	READ_SP(sp);
+	stack_floor = STACK_BOTTOM;
+	if (sp - stack_floor > STACK_PAINT_BYTES / sizeof(uintptr_t))
 	{
-		*ptr = 0xDEADBEEF;
+		stack_floor = sp - STACK_PAINT_BYTES / sizeof(uintptr_t);
 	}
+	paint_stack(stack_floor);
+	stack_dirty = sp;
 }
-static size_t count_stack()
+/* lowest word written at or below from since it was last painted */
+static uintptr_t *stack_scan(uintptr_t *from)
 {
-	size_t result = 0;
 	int consec_markers = 0;
-	for (uintptr_t *ptr = &_stack - 1; ptr > &__bss_end__ && consec_markers < 8; ptr--)
+	uintptr_t *ptr = from;
+	for (; ptr >= stack_floor && consec_markers < 8; ptr--)
 	{
-		if (*ptr == 0xDEADBEEF)
+		if (*ptr == STACK_MARKER)
 		{
 			consec_markers += 1;
 		}
@@ -293,24 +339,598 @@ static size_t count_stack()
 		{
 			consec_markers = 0;
 		}
-		result += sizeof(uintptr_t);
 	}
-	return result - 8 * sizeof(uintptr_t);
+	if (consec_markers < 8)
+	{
+		printf("warning: stack deeper than painted, raise STACK_PAINT_BYTES\n");
+	}
+	return ptr + 1 + consec_markers;
+}
+static uintptr_t *stack_low_water()
+{
+	return stack_scan(STACK_TOP - 1);
+}
+/* stack used since the last repaint, stack_low is where it was dirtied to */
+static size_t stack_phase()
+{
+	stack_low = stack_low_water();
+	size_t result = (STACK_TOP - stack_low) * sizeof(uintptr_t);
+	if (result > stack_max)
+	{
+		stack_max = result;
+	}
+	return result;
+}
+/*
+ * Repaints what the phase and the bookkeeping after stack_phase() dirtied,
+ * down to the deepest word written so far. A frame can leave more than 8
+ * markers unwritten, the low-water scans stop there and what is left below
+ * would be counted as soon as a later phase reaches it.
+ */
+static void repaint_stack()
+{
+	uintptr_t *below = stack_scan(stack_dirty);
+	if (stack_low < stack_dirty)
+	{
+		stack_dirty = stack_low;
+	}
+	if (below < stack_dirty)
+	{
+		stack_dirty = below;
+	}
+	paint_stack(stack_dirty);
+}
+static size_t count_stack()
+{
+	size_t result = (STACK_TOP - stack_low_water()) * sizeof(uintptr_t);
+	return result > stack_max ? result : stack_max;
 }
 
-int post_main()
+#if defined(HEAP_TRACE) || defined(HEAP_STATS)
+enum AllocType
 {
-	for (volatile uint8_t i = 1; i; i++)
-		;
-	trace_buffer("trace ready!\n", 13);
-	int err = run_active_bench(NULL);
+	Malloc,
+	Realloc,
+	Free,
+	Phase
+};
+#endif
+
+#ifdef HEAP_STATS
+/*
+ * Heap accounting inside the firmware, so that heap numbers do not need a
+ * separate HEAP_TRACE build. Sizes are kept in an open addressing table
+ * keyed by pointer. Allocations that do not fit into it are only counted
+ * as untracked and left out of live/peak.
+ */
+#ifndef HEAP_STATS_SLOTS
+#define HEAP_STATS_SLOTS 2048
+#endif
+/* power of two size classes from 16 bytes to 64KiB, then everything bigger */
+#define HEAP_CLASSES 14
+
+typedef struct heap_slot
+{
+	uintptr_t ptr;
+	size_t size;
+} heap_slot;
+static heap_slot heap_slots[HEAP_STATS_SLOTS];
+static size_t heap_used;
+static size_t heap_live;
+static size_t heap_peak;
+static size_t heap_phase_peak;
+static uint32_t heap_allocs;
+static uint32_t heap_frees;
+static uint32_t heap_untracked;
+static uint32_t heap_classes[HEAP_CLASSES];
+static uint64_t heap_overhead;
+static uint32_t heap_read_cost;
+
+static size_t heap_home(uintptr_t ptr)
+{
+	return ((ptr >> 3) * 2654435761u) % HEAP_STATS_SLOTS;
+}
+
+static size_t heap_next(size_t i)
+{
+	return (i + 1) % HEAP_STATS_SLOTS;
+}
+
+static bool heap_insert(uintptr_t ptr, size_t size)
+{
+	/* keep one slot free so that every probe ends */
+	if (heap_used == HEAP_STATS_SLOTS - 1)
+	{
+		return false;
+	}
+	size_t i = heap_home(ptr);
+	while (heap_slots[i].ptr != 0)
+	{
+		i = heap_next(i);
+	}
+	heap_slots[i].ptr = ptr;
+	heap_slots[i].size = size;
+	heap_used++;
+	return true;
+}
+
+static bool heap_remove(uintptr_t ptr, size_t *size)
+{
+	size_t i = heap_home(ptr);
+	while (heap_slots[i].ptr != ptr)
+	{
+		if (heap_slots[i].ptr == 0)
+		{
+			return false;
+		}
+		i = heap_next(i);
+	}
+	*size = heap_slots[i].size;
+	/* backward shift deletion, moves entries whose home is not in (hole, j] */
+	size_t hole = i;
+	for (size_t j = heap_next(i); heap_slots[j].ptr != 0; j = heap_next(j))
+	{
+		size_t home = heap_home(heap_slots[j].ptr);
+		bool stays = hole < j ? (home > hole && home <= j) : (home > hole || home <= j);
+		if (!stays)
+		{
+			heap_slots[hole] = heap_slots[j];
+			hole = j;
+		}
+	}
+	heap_slots[hole].ptr = 0;
+	heap_used--;
+	return true;
+}
+
+static void heap_account(enum AllocType tag, size_t size, void *old, void *new)
+{
+	uint64_t start = cycle_counter_read();
+	size_t old_size;
+	/* a failed realloc leaves the old block alone */
+	if (tag == Realloc && new == NULL)
+	{
+		return;
+	}
+	if (tag != Malloc && old != NULL)
+	{
+		if (heap_remove((uintptr_t)old, &old_size))
+		{
+			heap_live -= old_size;
+		}
+		if (tag == Free)
+		{
+			heap_frees++;
+		}
+	}
+	if (tag != Free && new != NULL)
+	{
+		heap_allocs++;
+		size_t class = size <= 16 ? 0 : 32 - __builtin_clz(size - 1) - 4;
+		heap_classes[class < HEAP_CLASSES ? class : HEAP_CLASSES - 1]++;
+		if (heap_insert((uintptr_t) new, size))
+		{
+			heap_live += size;
+		}
+		else
+		{
+			heap_untracked++;
+		}
+	}
+	if (heap_live > heap_peak)
+	{
+		heap_peak = heap_live;
+	}
+	if (heap_live > heap_phase_peak)
+	{
+		heap_phase_peak = heap_live;
+	}
+	/* the counter read that ends the interval is not in it */
+	heap_overhead += cycle_counter_read() - start + heap_read_cost;
+}
+
+static void heap_report(void)
+{
+	printf("Heap stats: peak=%lu live=%lu allocs=%lu frees=%lu untracked=%lu overhead=%llu\n",
+		   (unsigned long)heap_peak, (unsigned long)heap_live,
+		   (unsigned long)heap_allocs, (unsigned long)heap_frees,
+		   (unsigned long)heap_untracked, (unsigned long long)heap_overhead);
+	printf("Heap classes:");
+	for (int i = 0; i < HEAP_CLASSES - 1; i++)
+	{
+		printf(" %u=%lu", 16u << i, (unsigned long)heap_classes[i]);
+	}
+	printf(" big=%lu\n", (unsigned long)heap_classes[HEAP_CLASSES - 1]);
+}
+#endif
+
+#define MAX_PHASES 16
+typedef struct phase_record
+{
+	const char *name;
+	uint64_t cycles;
+	size_t stack;
+#ifdef HEAP_STATS
+	size_t heap_peak;
+	size_t heap_live;
+#endif
+#ifdef WAMR_POOL
+	/* -1 once the runtime and its pool are gone */
+	long pool_used;
+	long pool_highest;
+	long pool_free;
+#endif
+} phase_record;
+static phase_record phases[MAX_PHASES];
+static size_t phase_count = 0;
+static uint64_t phase_start = 0;
+/* cycles spent in measure_begin() and measure_phase(), never reset */
+static uint64_t measure_overhead = 0;
+static uint64_t samples[BENCH_MAX_SAMPLES];
+static size_t sample_count = 0;
+static size_t sample_calls = 0;
+uint32_t bench_warmup = BENCH_WARMUP;
+uint32_t bench_iterations = BENCH_ITERATIONS;
+#ifdef DWT_EVENTS
+/* tags of the DWT counter marks, RESUME starts counting after bookkeeping */
+#define DWT_MARK_RESUME 0
+#define DWT_MARK_PHASE 1
+#define DWT_MARK_WARMUP 2
+#define DWT_MARK_RUN 3
+#endif
+#ifdef HEAP_TRACE
+static void trace_phase(const char *name);
+#endif
+
+uint64_t measure_now(void)
+{
+#ifdef HEAP_STATS
+	return cycle_counter_read() - heap_overhead - measure_overhead;
+#else
+	return cycle_counter_read() - measure_overhead;
+#endif
+}
+
+void measure_begin(void)
+{
+	uint64_t now = measure_now();
+	phase_count = 0;
+	sample_count = 0;
+	sample_calls = 0;
+#ifdef HEAP_TRACE
+	/* closes whatever was allocated before the benchmark started */
+	trace_phase("startup");
+#endif
+#ifdef HEAP_STATS
+	uint64_t calibrate = cycle_counter_read();
+	heap_read_cost = cycle_counter_read() - calibrate;
+	heap_phase_peak = heap_live;
+#endif
+	/* what ran before the benchmark only counts towards the total */
+	stack_phase();
+	repaint_stack();
+#ifdef DWT_EVENTS
+	dwt_events_mark(DWT_MARK_RESUME);
+#endif
+	measure_overhead += measure_now() - now;
+	phase_start = now;
+}
+
+void measure_phase(const char *name)
+{
+	uint64_t now = measure_now();
+#ifdef DWT_EVENTS
+	dwt_events_mark(DWT_MARK_PHASE);
+#endif
+	size_t stack = stack_phase();
+	if (phase_count < MAX_PHASES)
+	{
+		phases[phase_count].name = name;
+		phases[phase_count].cycles = now - phase_start;
+		phases[phase_count].stack = stack;
+#ifdef HEAP_STATS
+		phases[phase_count].heap_peak = heap_phase_peak;
+		phases[phase_count].heap_live = heap_live;
+#endif
+#ifdef WAMR_POOL
+		mem_alloc_info_t info;
+		bool pool = wasm_runtime_get_mem_alloc_info(&info);
+		phases[phase_count].pool_used = pool ? (long)(info.total_size - info.total_free_size) : -1;
+		phases[phase_count].pool_highest = pool ? (long)info.highmark_size : -1;
+		phases[phase_count].pool_free = pool ? (long)info.total_free_size : -1;
+#endif
+		phase_count++;
+	}
+#ifdef HEAP_STATS
+	heap_phase_peak = heap_live;
+#endif
+#ifdef HEAP_TRACE
+	trace_phase(name);
+#endif
+	/* phase boundaries are a good time to get trace data out */
+	trace_drain();
+	/* last, so that the bookkeeping is not in the next phase's depth */
+	repaint_stack();
+	/*
+	 * bookkeeping above is not charged to the next phase, nor to the
+	 * First delay, which is then the sum of the phases up to the call
+	 */
+#ifdef DWT_EVENTS
+	dwt_events_mark(DWT_MARK_RESUME);
+#endif
+	measure_overhead += measure_now() - now;
+	phase_start = now;
+}
+
+void measure_sample(uint64_t cycles)
+{
+	bool warmup = sample_calls++ < bench_warmup;
+#ifdef DWT_EVENTS
+	dwt_events_mark(warmup ? DWT_MARK_WARMUP : DWT_MARK_RUN);
+#endif
+	if (!warmup && sample_count < BENCH_MAX_SAMPLES)
+	{
+		samples[sample_count++] = cycles;
+	}
+#ifdef DWT_EVENTS
+	dwt_events_mark(DWT_MARK_RESUME);
+#endif
+}
+
+static void report_samples(void)
+{
+	size_t n = sample_count;
+	if (n == 0)
+	{
+		return;
+	}
+	/* insertion sort, there are only a handful of samples */
+	for (size_t i = 1; i < n; i++)
+	{
+		uint64_t v = samples[i];
+		size_t j = i;
+		for (; j > 0 && samples[j - 1] > v; j--)
+		{
+			samples[j] = samples[j - 1];
+		}
+		samples[j] = v;
+	}
+	uint64_t median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+	double mean = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		mean += samples[i];
+	}
+	mean /= n;
+	double var = 0;
+	for (size_t i = 0; i < n; i++)
+	{
+		var += (samples[i] - mean) * (samples[i] - mean);
+	}
+	var = n > 1 ? var / (n - 1) : 0;
+	printf("Run stats: n=%u warmup=%u min=%llu median=%llu max=%llu mean=%llu stddev=%llu\n",
+		   (unsigned)n, (unsigned)bench_warmup,
+		   (unsigned long long)samples[0], (unsigned long long)median,
+		   (unsigned long long)samples[n - 1], (unsigned long long)(mean + 0.5),
+		   (unsigned long long)(sqrt(var) + 0.5));
+}
+
+void measure_report(void)
+{
+	for (size_t i = 0; i < phase_count; i++)
+	{
+		printf("Phase %s: cycles=%llu stack=%lu", phases[i].name,
+			   (unsigned long long)phases[i].cycles, (unsigned long)phases[i].stack);
+#ifdef HEAP_STATS
+		printf(" heap_peak=%lu heap_live=%lu",
+			   (unsigned long)phases[i].heap_peak, (unsigned long)phases[i].heap_live);
+#endif
+#ifdef WAMR_POOL
+		printf(" pool_used=%ld pool_highest=%ld pool_free=%ld",
+			   phases[i].pool_used, phases[i].pool_highest, phases[i].pool_free);
+#endif
+		printf("\n");
+	}
+	report_samples();
+#ifdef HEAP_STATS
+	heap_report();
+#endif
+}
+
+/* one measured run, from starting the profilers to the report */
+static bench_result run_measured(bench_args args)
+{
+#ifdef PC_SAMPLING
+	pc_sampling_start();
+#endif
+#ifdef DWT_EVENTS
+	dwt_events_start();
+#endif
+	bench_result err = run_active_bench(args);
+#ifdef PC_SAMPLING
+	pc_sampling_stop();
+#endif
+#ifdef DWT_EVENTS
+	dwt_events_stop();
+#endif
+	measure_report();
 	if (!err)
 	{
 		size_t stack_usage = count_stack();
 		printf("Max stack use: %d\n", stack_usage);
 	}
+	return err;
+}
+
+#ifdef BENCH_SHELL
+/*
+ * Command shell on the UART, lines come from get_buffered_line():
+ *   list
+ *   run <name> [arg...] [iters=<n>] [warmup=<n>] [heap=<bytes>]
+ * Arguments given on the command line replace the ones from the manifest.
+ * A run prints its usual output between a "Run:" and a "Done:" line.
+ */
+#define SHELL_SEPARATORS " \t\r\n"
+
+static void shell_list(void)
+{
+	for (uint32_t i = 0; i < bench_table_len; i++)
+	{
+		const bench_entry *entry = &bench_table[i];
+		printf("Bench: name=%s size=%lu heap=%lu args=%lu hook=%d\n", entry->name,
+			   (unsigned long)entry->size, (unsigned long)entry->heap_size,
+			   (unsigned long)entry->args_len, (int)entry->hook);
+	}
+}
+
+static const bench_entry *shell_find(const char *name)
+{
+	for (uint32_t i = 0; i < bench_table_len; i++)
+	{
+		if (strcmp(bench_table[i].name, name) == 0)
+		{
+			return &bench_table[i];
+		}
+	}
+	return NULL;
+}
+
+static bool shell_number(const char *text, long *number)
+{
+	char *end;
+	*number = strtol(text, &end, 0);
+	return end != text && *end == '\0';
+}
+
+static void shell_run(const char *name)
+{
+	const bench_entry *entry = shell_find(name);
+	if (!entry)
+	{
+		printf("Error: no benchmark %s, see list\n", name);
+		return;
+	}
+	bench_run run = {.entry = entry, .heap_size = entry->heap_size, .args_len = entry->args_len};
+	memcpy(run.args, entry->args, sizeof run.args);
+	long warmup = BENCH_WARMUP;
+	long iterations = BENCH_ITERATIONS;
+	uint32_t given = 0;
+	char *token;
+	while ((token = strtok(NULL, SHELL_SEPARATORS)))
+	{
+		long number;
+		char *value = strchr(token, '=');
+		if (value)
+		{
+			*value++ = '\0';
+		}
+		if (!shell_number(value ? value : token, &number))
+		{
+			printf("Error: %s is not a number\n", value ? value : token);
+			return;
+		}
+		if (!value && given < BENCH_MAX_ARGS)
+		{
+			run.args[given++] = number;
+		}
+		else if (!value)
+		{
+			printf("Error: at most %d arguments\n", BENCH_MAX_ARGS);
+			return;
+		}
+		else if (strcmp(token, "iters") == 0)
+		{
+			iterations = number;
+		}
+		else if (strcmp(token, "warmup") == 0)
+		{
+			warmup = number;
+		}
+		else if (strcmp(token, "heap") == 0)
+		{
+			run.heap_size = number;
+		}
+		else
+		{
+			printf("Error: unknown option %s\n", token);
+			return;
+		}
+	}
+	if (iterations < 1 || iterations > BENCH_MAX_SAMPLES || warmup < 0)
+	{
+		printf("Error: iters must be 1 to %d and warmup not negative\n", BENCH_MAX_SAMPLES);
+		return;
+	}
+	if (given)
+	{
+		run.args_len = given;
+	}
+	bench_iterations = iterations;
+	bench_warmup = warmup;
+	printf("Run: name=%s iters=%lu warmup=%lu heap=%lu args=", entry->name,
+		   (unsigned long)bench_iterations, (unsigned long)bench_warmup, (unsigned long)run.heap_size);
+	for (uint32_t i = 0; i < run.args_len; i++)
+	{
+		printf(i ? ",%ld" : "%ld", (long)run.args[i]);
+	}
+	printf("\n");
+	/* the stack high water mark is per run */
+	stack_max = 0;
+	bench_result err = run_measured(&run);
+	printf("Done: name=%s err=%d\n", entry->name, err != 0);
+	trace_flush();
+}
+
+static void __attribute__((noreturn)) bench_shell(void)
+{
+	char line[128];
+	printf("Shell: %lu benchmarks, commands list and run <name> [arg...] [iters=<n>] [warmup=<n>] [heap=<bytes>]\n",
+		   (unsigned long)bench_table_len);
+	while (1)
+	{
+		printf("> ");
+		fflush(stdout);
+		if (!fgets(line, sizeof line, stdin))
+		{
+			clearerr(stdin);
+			continue;
+		}
+		char *command = strtok(line, SHELL_SEPARATORS);
+		char *name;
+		if (!command)
+		{
+			continue;
+		}
+		if (strcmp(command, "list") == 0)
+		{
+			shell_list();
+		}
+		else if (strcmp(command, "run") == 0 && (name = strtok(NULL, SHELL_SEPARATORS)))
+		{
+			shell_run(name);
+		}
+		else
+		{
+			printf("Error: %s is not list or run <name>\n", command);
+		}
+	}
+}
+#endif
+
+int post_main()
+{
+	for (volatile uint8_t i = 1; i; i++)
+		;
+	trace_buffer("trace ready!\n", 13);
+	/* the host only starts collecting once it has seen the whole marker */
+	trace_flush();
+#ifdef BENCH_SHELL
+	bench_shell();
+#endif
+	int err = run_measured(NULL);
 	printf("END OF TEST\n");
 	trace_buffer("TRACE_DONE\n", 11);
+	trace_flush();
 	return err;
 }
 
@@ -322,48 +942,87 @@ int main()
 }
 
 #ifdef HEAP_TRACE
-enum __attribute__((__packed__)) AllocType
+/*
+ * Heap trace records are variable length: a varint of (size << 2 | tag),
+ * a varint of the cycles since the previous record and then the pointers
+ * as zigzag varint deltas to the previously traced pointer. A realloc
+ * sends old relative to the previous pointer and new relative to old, a
+ * free only old. Phase markers (tag 3) carry the length of the phase name
+ * instead of a size and the name instead of pointers; they end the phase.
+ */
+static uintptr_t trace_prev;
+static uint64_t trace_last_cycles;
+
+static uint8_t *put_varint(uint8_t *out, uint64_t value)
 {
-	Malloc,
-	Realloc,
-	Free
-};
-typedef struct __attribute__((__packed__)) TraceData
+	while (value >= 0x80)
+	{
+		*out++ = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+	*out++ = value;
+	return out;
+}
+
+static uint8_t *put_delta(uint8_t *out, uintptr_t from, uintptr_t to)
+{
+	int32_t delta = (int32_t)(to - from);
+	return put_varint(out, ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31));
+}
+
+static uint8_t *put_header(uint8_t *out, enum AllocType tag, size_t size)
+{
+	uint64_t now = cycle_counter_read();
+	out = put_varint(out, (uint32_t)size << 2 | tag);
+	out = put_varint(out, now - trace_last_cycles);
+	trace_last_cycles = now;
+	return out;
+}
+
+static void trace_alloc(enum AllocType tag, size_t size, void *old, void *new)
 {
-	enum AllocType tag;
-	union
+	/* 5 bytes per 32 bit varint and 10 for the timestamp at most */
+	uint8_t record[25];
+	uint8_t *end = put_header(record, tag, size);
+	if (tag != Malloc)
 	{
-		struct
-		{
-			uintptr_t old;
-			uintptr_t new;
-			size_t size;
-		} realloc;
-		struct
-		{
-			uintptr_t new;
-			size_t size;
-		} malloc;
-		struct
-		{
-			uintptr_t old;
-		} free;
+		end = put_delta(end, trace_prev, (uintptr_t)old);
+		trace_prev = (uintptr_t)old;
+	}
+	if (tag != Free)
+	{
+		end = put_delta(end, trace_prev, (uintptr_t)new);
+		trace_prev = (uintptr_t)new;
+	}
+	trace_buffer(record, end - record);
+}
+
+static void trace_phase(const char *name)
+{
+	uint8_t record[15];
+	size_t len = strlen(name);
+	uint8_t *end = put_header(record, Phase, len);
+	trace_buffer(record, end - record);
+	trace_buffer((const uint8_t *)name, len);
+}
+#endif
 
-	} as;
-} TraceData;
+#if defined(HEAP_TRACE) || defined(HEAP_STATS)
+static void heap_event(enum AllocType tag, size_t size, void *old, void *new)
+{
+#ifdef HEAP_TRACE
+	trace_alloc(tag, size, old, new);
+#endif
+#ifdef HEAP_STATS
+	heap_account(tag, size, old, new);
+#endif
+}
 
 void *__real_malloc(size_t);
 void *__wrap_malloc(size_t __size)
 {
 	void *ptr = __real_malloc(__size);
-	TraceData trace = {
-		.tag = Malloc,
-		.as = {
-			.malloc = {
-				.new = ptr,
-				.size = __size,
-			}}};
-	trace_buffer((uint8_t *)&trace, sizeof(trace));
+	heap_event(Malloc, __size, NULL, ptr);
 	return ptr;
 }
 
@@ -371,28 +1030,14 @@ void *__real_realloc(void *, size_t);
 void *__wrap_realloc(void *ptr, size_t n)
 {
 	void *ptr_new = __real_realloc(ptr, n);
-	TraceData trace = {
-		.tag = Realloc,
-		.as = {
-			.realloc = {
-				.new = ptr_new,
-				.old = ptr,
-				.size = n,
-			}}};
-	trace_buffer((uint8_t *)&trace, sizeof(trace));
+	heap_event(Realloc, n, ptr, ptr_new);
 	return ptr_new;
 }
 
 void __real_free(void *);
 void __wrap_free(void *ptr)
 {
-	TraceData trace = {
-		.tag = Free,
-		.as = {
-			.free = {
-				.old = ptr,
-			}}};
-	trace_buffer((uint8_t *)&trace, sizeof(trace));
+	heap_event(Free, 0, ptr, NULL);
 	return __real_free(ptr);
 }
 
@@ -1,4 +1,5 @@
 #include "platform_api_vmcore.h"
+#include "init.h"
 #include <stdio.h>
 #include <stdarg.h>
 /****************************************************
@@ -98,12 +99,12 @@ int os_vprintf(const char *format, va_list ap)
 }
 
 /**
- * Get microseconds after boot.
+ * Get microseconds after boot, from the DWT cycle counter.
  */
 uint64
 os_time_get_boot_microsecond(void)
 {
-    return 0;
+    return cycle_counter_read() / (cycle_counter_hz() / 1000000);
 }
 
 /**
@@ -194,7 +195,16 @@ int os_cond_destroy(korp_cond *cond)
 
 uint64 os_time_get_boot_us(void)
 {
-    return 0;
+    return os_time_get_boot_microsecond();
+}
+
+/**
+ * There is only one thread, so its CPU time is the time since boot.
+ * Used by the perf profiler.
+ */
+uint64 os_time_thread_cputime_us(void)
+{
+    return os_time_get_boot_microsecond();
 }
 
 unsigned os_getpagesize()
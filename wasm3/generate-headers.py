@@ -1,41 +1,185 @@
 PATH = __file__
 from pathlib import Path
+import json
+import os
+import shutil
+import subprocess
 import sys
 SOURCE_DIR = sys.argv[1]
 OUT_DIR = sys.argv[2]
-AOT_FLAG = len(sys.argv) >= 4 and sys.argv[3] == 'aot'
+# aot takes .aot files as they are, xip compiles the .wasm files with wamrc
+MODE = sys.argv[3] if len(sys.argv) >= 4 else None
+AOT_FLAG = MODE in ('aot', 'xip')
+WAMRC = os.environ.get("WAMRC", "wamrc")
+# no text relocations, so the image runs from flash as it is
+WAMRC_XIP_FLAGS = ["--target=thumbv7em", "--target-abi=gnueabihf", "--cpu=cortex-m4", "--xip"]
+# arguments, heap size and input hook per benchmark, for the shell's table
+MANIFEST = Path(PATH).parent / "manifest.json"
+# next to benchmarks.S, the assembler finds them through -Wa,-I
+MODULE_DIR = "modules"
 
 def main():
     p = Path(SOURCE_DIR)
-    if AOT_FLAG:
-        benchmarks = list(p.glob("**/*.aot"))
+    if MODE == 'aot':
+        benchmarks = sorted(p.glob("**/*.aot"))
     else:
-        benchmarks = list(p.glob("**/*.wasm"))
-    defs = []
-    for path in benchmarks:
+        benchmarks = sorted(p.glob("**/*.wasm"))
+    manifest = json.loads(MANIFEST.read_text()) if MANIFEST.exists() else {}
+    modules = Path(OUT_DIR) / MODULE_DIR
+    if modules.exists():
+        shutil.rmtree(modules)
+    modules.mkdir(parents=True)
+    decls = []
+    blobs = []
+    names = []
+    params = {}
+    for i, path in enumerate(benchmarks, 1):
         name = path.stem.replace("-", "_")
-        with open(path, mode='rb') as file:
-            content = file.read()
-            defs.append(generate_array(name, content))
-    content = "\n".join(defs)
+        names.append(name)
+        module = f"{MODULE_DIR}/{name}{'.aot' if AOT_FLAG else path.suffix}"
+        if MODE == 'xip':
+            subprocess.run([WAMRC, *WAMRC_XIP_FLAGS, "-o", str(Path(OUT_DIR) / module), str(path)], check=True)
+        else:
+            shutil.copyfile(path, Path(OUT_DIR) / module)
+        decls.append(generate_decl(name, (Path(OUT_DIR) / module).stat().st_size))
+        params[name] = run_params((Path(OUT_DIR) / module).read_bytes())
+        blobs.append(generate_blob(name, module, i))
+    decls.append(generate_table(names, manifest, params))
+    content = "\n".join(decls)
     header = f"""#ifndef H_BENCHMARKS
 #define H_BENCHMARKS
 #include <stdint.h>
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored \"-Wunused-variable\"
 
+/* generated by generate-headers.py, the modules are in benchmarks.S */
 {content}
-
-#pragma GCC diagnostic pop
 #endif
-    """
+"""
     with open(Path(OUT_DIR) / "./benchmarks.h", mode='w') as output:
         output.write(header)
+    content = "\n".join(blobs)
+    assembly = f"""/*
+ * Generated by generate-headers.py. The modules stay in flash as they are,
+ * only the one selected with -DBENCHMARK goes into the image, or all of
+ * them for the shell.
+ */
+#define expander(B, m) m(B)
+#define _bench_id(b) BENCH_ID_##b
+#define BENCH_ID expander(BENCHMARK, _bench_id)
+
+{content}
+#ifdef HOST
+	.section .note.GNU-stack,"",%progbits
+#endif
+"""
+    with open(Path(OUT_DIR) / "./benchmarks.S", mode='w') as output:
+        output.write(assembly)
+
+def run_params(module):
+    """Parameter count of the module's _run export, None for AOT images or without one."""
+    if module[:4] != b"\0asm":
+        return None
+    pos = 8
+    def leb():
+        nonlocal pos
+        value = shift = 0
+        while True:
+            byte = module[pos]
+            pos += 1
+            value |= (byte & 0x7f) << shift
+            shift += 7
+            if byte < 0x80:
+                return value
+    def name():
+        nonlocal pos
+        n = leb()
+        pos += n
+        return module[pos - n:pos]
+    def limits():
+        flags = leb()
+        leb()
+        if flags & 1:
+            leb()
+    types, funcs = [], []
+    while pos < len(module):
+        section = module[pos]
+        pos += 1
+        size = leb()
+        end = pos + size
+        if section == 1:
+            for _ in range(leb()):
+                pos += 1
+                params = leb()
+                pos += params
+                results = leb()
+                pos += results
+                types.append(params)
+        elif section == 2:
+            for _ in range(leb()):
+                name()
+                name()
+                kind = module[pos]
+                pos += 1
+                if kind == 0:
+                    funcs.append(types[leb()])
+                elif kind == 1:
+                    pos += 1
+                    limits()
+                elif kind == 2:
+                    limits()
+                elif kind == 3:
+                    pos += 2
+                else:
+                    pos += 1
+                    leb()
+        elif section == 3:
+            funcs += [types[leb()] for _ in range(leb())]
+        elif section == 7:
+            for _ in range(leb()):
+                export, kind, index = name(), module[pos], None
+                pos += 1
+                index = leb()
+                if export == b"_run" and kind == 0:
+                    return funcs[index]
+            return None
+        pos = end
+    return None
 
-def generate_array(name, content):
-    content = " ,".join([f'0x{byte:x}'  for byte in content])
-    content = f'static uint8_t {name}[] __attribute__((aligned (4))) = {{{content}}};\n'
-    return content
+def generate_decl(name, size):
+    return f'extern const uint8_t {name}[{size}] __attribute__((aligned (4)));'
+
+def generate_blob(name, module, i):
+    return f"""#define BENCH_ID_{name} {i}
+#if defined(BENCH_SHELL) || BENCH_ID == BENCH_ID_{name}
+	.section .rodata.{name},"a"
+	.balign 4
+	.global {name}
+	.type {name}, %object
+{name}:
+	.incbin "{module}"
+	.size {name}, . - {name}
+#endif
+"""
+
+def generate_table(names, manifest, params):
+    entries = []
+    for name in names:
+        entry = manifest.get(name, {})
+        # manifest entries of another suite with the same name
+        if params[name] is not None and params[name] != len(entry.get("args", [])):
+            sys.exit(f"{name}: _run takes {params[name]} arguments, manifest.json gives {entry.get('args', [])}")
+        args = ", ".join(str(arg) for arg in entry.get("args", []))
+        hook = entry.get("hook", "none").upper()
+        entries.append(f'    {{"{name}", {name}, sizeof {name}, {entry.get("heap", 1 << 13)}, '
+                       f'{len(entry.get("args", []))}, {{{args}}}, BENCH_HOOK_{hook}}},')
+    entries = "\n".join(entries)
+    return f"""#ifdef BENCH_SHELL
+#include "benchmarks-defs.h"
+const bench_entry bench_table[] = {{
+{entries}
+}};
+const uint32_t bench_table_len = sizeof bench_table / sizeof bench_table[0];
+#endif
+"""
 
 if __name__ == "__main__":
-    main()
\ No newline at end of file
+    main()
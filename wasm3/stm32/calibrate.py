@@ -0,0 +1,157 @@
+"""
+Predicts board cycles from the deterministic QEMU counts.
+
+fit joins result CSVs of the board, farm.py merges too, with the
+instruction counts of a QEMU run (QEMU=... INSN_COUNT=1 run-benches.py)
+of the same benchmarks and configuration, and fits
+
+    cycles = a * insns + b * loads + c * stores
+
+by least squares on the relative error. Every phase with a cycle count on
+the board is one point. Older CSVs without phases still give the first
+timed run and the First delay, which spans everything up to and
+including the first call and is matched with the sum of those QEMU
+windows. The delays stand in if there are no cycles.
+
+predict applies such a model to a QEMU run, and with --baseline fails when
+a prediction grew by more than --tolerance, so a CI without boards catches
+performance regressions.
+"""
+from pathlib import Path
+import argparse
+import json
+import sys
+
+# Phases reported by run_bench, as in run-benches.py.
+PHASES = ["env", "runtime", "parse", "load", "link", "init", "call", "run", "teardown"]
+# The board's First delay covers these windows.
+FIRST_WINDOWS = PHASES[:PHASES.index("run")]
+# The start of CSV_COLUMNS in run-benches.py, older CSVs end after heap.
+BOARD_COLUMNS = ["text", "data", "delay1", "delay2", "stack", "heap", "cycles1", "cycles2"]
+BOARD_COLUMNS += [f"{phase}_cycles" for phase in PHASES]
+# insn-count.c counters, in the order of the _insns.csv window files
+COUNTERS = ["insns", "loads", "stores"]
+# the L4 runs at 80MHz
+BOARD_HZ = 80_000_000
+
+def read_board(paths, hz):
+    """{benchmark: {window: cycles}} from the board CSVs, later files win."""
+    board = {}
+    for path in paths:
+        for line in Path(path).read_text().splitlines():
+            name, *fields = line.split(",")
+            # farm.py merges have the target name as second column
+            if fields and not fields[0].lstrip("-").isdigit():
+                fields = fields[1:]
+            row = {column: int(value) for column, value in zip(BOARD_COLUMNS, fields)}
+            cycles = {phase: row[f"{phase}_cycles"] for phase in PHASES if row.get(f"{phase}_cycles", -1) > 0}
+            # the First delay only where the phases are missing, the second run is the first timed run
+            for window, delay, count in [("first", "delay1", "cycles1"), ("run0", "delay2", "cycles2")]:
+                if window in cycles or (window == "first" and cycles):
+                    continue
+                if row.get(count, -1) > 0:
+                    cycles[window] = row[count]
+                elif row.get(delay, -1) > 0:
+                    cycles[window] = row[delay] * hz // 1000
+            board[name] = cycles
+    return board
+
+def read_qemu(path):
+    """{benchmark: {window: counts}} from the window files next to a QEMU run's main CSV."""
+    path = Path(path)
+    qemu = {}
+    for line in path.read_text().splitlines():
+        name = line.split(",", 1)[0]
+        windows = path.with_name(f"{path.stem}__{name}_insns.csv")
+        if not windows.exists():
+            continue
+        qemu[name] = {}
+        for window in windows.read_text().splitlines():
+            window, *counts = window.split(",")
+            qemu[name][window] = [int(count) for count in counts]
+        if all(window in qemu[name] for window in FIRST_WINDOWS):
+            qemu[name]["first"] = [sum(counts) for counts in zip(*(qemu[name][window] for window in FIRST_WINDOWS))]
+    return qemu
+
+def solve(a, b):
+    """x with a x = b, Gaussian elimination with partial pivoting."""
+    n = len(b)
+    m = [row[:] + [value] for row, value in zip(a, b)]
+    for i in range(n):
+        pivot = max(range(i, n), key=lambda r: abs(m[r][i]))
+        m[i], m[pivot] = m[pivot], m[i]
+        if m[i][i] == 0:
+            raise ValueError("counters are linearly dependent, use more benchmarks")
+        for r in range(n):
+            if r != i:
+                f = m[r][i] / m[i][i]
+                m[r] = [x - f * y for x, y in zip(m[r], m[i])]
+    return [m[i][n] / m[i][i] for i in range(n)]
+
+def predict_cycles(model, counts):
+    return sum(model["coefficients"][counter] * count for counter, count in zip(COUNTERS, counts))
+
+def fit(args):
+    board = read_board(args.board, args.hz)
+    qemu = read_qemu(args.qemu)
+    points = [(name, window, counts, board[name][window]) for name in sorted(qemu) if name in board
+              for window, counts in qemu[name].items() if window in board[name]]
+    if len(points) < len(COUNTERS):
+        raise ValueError(f"only {len(points)} points, the board and QEMU runs share too few benchmarks")
+    # relative error, so that long phases do not drown the short ones
+    rows = [[count / cycles for count in counts] for name, window, counts, cycles in points]
+    ata = [[sum(row[i] * row[j] for row in rows) for j in range(len(COUNTERS))] for i in range(len(COUNTERS))]
+    atb = [sum(row[i] for row in rows) for i in range(len(COUNTERS))]
+    model = {"coefficients": dict(zip(COUNTERS, solve(ata, atb))), "points": len(points)}
+    errors = []
+    for name, window, counts, cycles in points:
+        predicted = predict_cycles(model, counts)
+        errors.append(abs(predicted - cycles) / cycles)
+        print(f"{name:24s} {window:12s} {cycles:12d} {predicted:14.0f} {100 * (predicted - cycles) / cycles:+7.2f}%")
+    model["mean_error"] = sum(errors) / len(errors)
+    model["max_error"] = max(errors)
+    print(f"cycles = " + " + ".join(f"{value:.4f} * {counter}" for counter, value in model["coefficients"].items()))
+    print(f"{len(points)} points, mean error {100 * model['mean_error']:.2f}%, max {100 * model['max_error']:.2f}%")
+    Path(args.model).write_text(json.dumps(model, indent=2) + "\n")
+
+def predict(args):
+    model = json.loads(Path(args.model).read_text())
+    qemu = read_qemu(args.qemu)
+    predictions = {(name, window): predict_cycles(model, counts) for name in sorted(qemu) for window, counts in qemu[name].items()}
+    lines = [f"{name},{window},{cycles:.0f}" for (name, window), cycles in predictions.items()]
+    if args.output:
+        Path(args.output).write_text("\n".join(lines) + "\n")
+    else:
+        print("\n".join(lines))
+    if args.baseline is None:
+        return 0
+    regressions = 0
+    for line in Path(args.baseline).read_text().splitlines():
+        name, window, cycles = line.split(",")
+        now = predictions.get((name, window))
+        if now is not None and now > int(cycles) * (1 + args.tolerance):
+            print(f"REGRESSION {name} {window}: {cycles} -> {now:.0f} cycles", file=sys.stderr)
+            regressions += 1
+    return 1 if regressions else 0
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Fit and apply a model from QEMU instruction counts to board cycles",
+    )
+    commands = parser.add_subparsers(dest="command", required=True)
+    fit_parser = commands.add_parser("fit", help="Fit a model to board results")
+    fit_parser.add_argument("model", help="JSON file to write the model to")
+    fit_parser.add_argument("qemu", help="Main CSV of a QEMU run with INSN_COUNT=1")
+    fit_parser.add_argument("board", nargs="+", help="Result CSVs of the board, e.g. results/*.csv of one configuration")
+    fit_parser.add_argument("--hz", type=int, default=BOARD_HZ, help="Board clock, turns delays of older CSVs into cycles")
+    predict_parser = commands.add_parser("predict", help="Predict board cycles of a QEMU run")
+    predict_parser.add_argument("model", help="JSON file written by fit")
+    predict_parser.add_argument("qemu", help="Main CSV of a QEMU run with INSN_COUNT=1")
+    predict_parser.add_argument("--output", default=None, help="CSV to write the predictions to instead of printing them")
+    predict_parser.add_argument("--baseline", default=None, help="Predictions of an earlier run to compare against")
+    predict_parser.add_argument("--tolerance", type=float, default=0.02, help="Allowed growth over the baseline")
+    args = parser.parse_args()
+    if args.command == "fit":
+        fit(args)
+    else:
+        sys.exit(predict(args))
@@ -1,10 +1,115 @@
 #ifndef BENCHMARKS_DEFS_H
 #define BENCHMARKS_DEFS_H
 
+#include <stdint.h>
+
 typedef int bench_result;
 typedef void *bench_args;
 typedef bench_result (*benchmark_runner)(bench_args);
 
 bench_result run_active_bench(bench_args);
 
+/*
+ * Module slot (MODULE_SLOT=<bytes> builds). Instead of a module compiled
+ * into the image, the runner writes the module and how to call it here
+ * over GDB while the target waits in post_main, so one image serves every
+ * benchmark. Arguments and results are i32, configure with -DBENCHMARK=slot.
+ */
+#ifdef MODULE_SLOT
+#define MODULE_SLOT_MAGIC 0x746f6c73
+#define MODULE_SLOT_VALUES 4
+typedef struct module_slot
+{
+    uint32_t magic;
+    uint32_t size;
+    uint32_t heap_size;
+    uint32_t args_len;
+    int32_t args[MODULE_SLOT_VALUES];
+    uint32_t results_len;
+    uint8_t module[MODULE_SLOT] __attribute__((aligned(4)));
+} module_slot;
+extern module_slot bench_slot;
+#endif
+
+/*
+ * Untimed warmup runs and timed runs of _run after the first (cold) call.
+ * Set with -DWARMUP=<n> and -DITERATIONS=<n> when configuring.
+ */
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP 0
+#endif
+#ifndef BENCH_ITERATIONS
+#define BENCH_ITERATIONS 1
+#endif
+
+/*
+ * Counts the runs actually use. They start out as the build time values,
+ * only the shell changes them per run. At most BENCH_MAX_SAMPLES timed runs
+ * are kept for the stats.
+ */
+extern uint32_t bench_warmup;
+extern uint32_t bench_iterations;
+#ifdef BENCH_SHELL
+#define BENCH_MAX_SAMPLES (BENCH_ITERATIONS > 64 ? BENCH_ITERATIONS : 64)
+#else
+#define BENCH_MAX_SAMPLES BENCH_ITERATIONS
+#endif
+
+/*
+ * Benchmark table (BENCH_SHELL builds). generate-headers.py puts every
+ * module into bench_table together with its arguments, heap size and input
+ * hook from manifest.json. The image then waits for commands on the UART,
+ * bench_shell() in main.c reads them and passes a bench_run to
+ * run_active_bench().
+ */
+#ifdef BENCH_SHELL
+#define BENCH_MAX_ARGS 4
+typedef enum bench_hook
+{
+    BENCH_HOOK_NONE,
+    BENCH_HOOK_KNUCLEOTIDE,
+    BENCH_HOOK_REVERSE_COMPLEMENT,
+} bench_hook;
+typedef struct bench_entry
+{
+    const char *name;
+    const uint8_t *module;
+    uint32_t size;
+    uint32_t heap_size;
+    uint32_t args_len;
+    int32_t args[BENCH_MAX_ARGS];
+    bench_hook hook;
+} bench_entry;
+typedef struct bench_run
+{
+    const bench_entry *entry;
+    uint32_t heap_size;
+    uint32_t args_len;
+    int32_t args[BENCH_MAX_ARGS];
+} bench_run;
+extern const bench_entry bench_table[];
+extern const uint32_t bench_table_len;
+#endif
+
+/*
+ * Phase timing. measure_now() is the cycle counter minus the time spent
+ * in HEAP_STATS accounting and should be used for all timing.
+ * measure_begin() starts the first phase, measure_phase() closes the phase
+ * that ran since the previous call and measure_sample() records the
+ * duration of one warm run (the first bench_warmup do not count).
+ * measure_report() prints everything, runs only as min/median/max/stddev,
+ * once nothing is being timed anymore.
+ */
+uint64_t measure_now(void);
+void measure_begin(void);
+void measure_phase(const char *name);
+void measure_sample(uint64_t cycles);
+void measure_report(void);
+
+/*
+ * Execution counts of the wasm3 operations (OP_PROFILE builds), sent over
+ * the trace stream.
+ */
+void op_profile_dump(void);
+
 #endif
\ No newline at end of file
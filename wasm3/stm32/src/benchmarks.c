@@ -1,5 +1,6 @@
 #include "benchmarks.h"
 #include "benchmarks-defs.h"
+#include "init.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -45,33 +46,44 @@ static m3ApiRawFunction(get_milsecs_wrapper)
         uint32_t result = (uint64_t)(clock() * 1000) / (CLOCKS_PER_SEC);
     m3ApiReturn(result);
 }
-int32_t run_bench(uint8_t *mod, size_t mod_size, void *args[], size_t args_len,
+static void print_delay(const char *label, uint64_t cycles)
+{
+    printf("%s runtime delay: %lums\n", label,
+           (unsigned long)(cycles * 1000 / cycle_counter_hz()));
+    printf("%s runtime cycles: %llu\n", label, (unsigned long long)cycles);
+}
+int32_t run_bench(const uint8_t *mod, size_t mod_size, void *args[], size_t args_len,
                   void *results[], size_t results_len, module_hook hook)
 {
     M3Result result = m3Err_none;
 
-    uint8_t *wasm = mod;
+    const uint8_t *wasm = mod;
     uint32_t fsize = mod_size;
 
-    clock_t start = clock();
-    __sync_synchronize();
     printf("Loading WebAssembly...\n");
+    uint64_t start = measure_now();
+    __sync_synchronize();
+    measure_begin();
     IM3Environment env = m3_NewEnvironment();
     if (!env)
         FATAL("m3_NewEnvironment failed");
+    measure_phase("env");
 
     IM3Runtime runtime = m3_NewRuntime(env, 1 << 13, NULL);
     if (!runtime)
         FATAL("m3_NewRuntime failed");
+    measure_phase("runtime");
 
     IM3Module module;
     result = m3_ParseModule(env, &module, wasm, fsize);
     if (result)
         FATAL("m3_ParseModule: %s", result);
+    measure_phase("parse");
 
     result = m3_LoadModule(runtime, module);
     if (result)
         FATAL("m3_LoadModule: %s", result);
+    measure_phase("load");
     result = m3_LinkWASI(module);
     if (result)
     {
@@ -85,10 +97,12 @@ int32_t run_bench(uint8_t *mod, size_t mod_size, void *args[], size_t args_len,
     {
         FATAL("hook error");
     }
+    measure_phase("link");
     IM3Function f;
     result = m3_FindFunction(&f, runtime, "_initialize");
     if (result || m3_CallV(f))
         FATAL("_initialize: %s", result);
+    measure_phase("init");
 
     result = m3_FindFunction(&f, runtime, "_run");
 
@@ -102,33 +116,90 @@ int32_t run_bench(uint8_t *mod, size_t mod_size, void *args[], size_t args_len,
         FATAL("m3_GetResults: %s", result);
 
     __sync_synchronize();
-    clock_t end = clock();
-    printf("First runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
-#ifndef HEAP_TRACE
-    start = clock();
-    __sync_synchronize();
-    if (m3_Call(f, args_len, args))
+    uint64_t end = measure_now();
+    measure_phase("call");
+    uint64_t first = end - start;
+    uint64_t second = 0;
+    for (uint32_t i = 0; i < bench_warmup + bench_iterations; i++)
     {
-        FATAL("_start second run: %s", result);
-    }
+        start = measure_now();
+        __sync_synchronize();
+        if (m3_Call(f, args_len, args))
+        {
+            FATAL("_start second run: %s", result);
+        }
 
-    result = m3_GetResults(f, results_len, results);
-    if (result)
-        FATAL("m3_GetResults: %s", result);
-    __sync_synchronize();
-    end = clock();
-    printf("Second runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
-#endif
+        result = m3_GetResults(f, results_len, results);
+        if (result)
+            FATAL("m3_GetResults: %s", result);
+        __sync_synchronize();
+        end = measure_now();
+        if (i == bench_warmup)
+            second = end - start;
+        measure_sample(end - start);
+    }
+    measure_phase("run");
     m3_FreeRuntime(runtime);
     m3_FreeEnvironment(env);
+    measure_phase("teardown");
+#ifdef OP_PROFILE
+    op_profile_dump();
+#endif
+    print_delay("First", first);
+    print_delay("Second", second);
     return 0;
 }
-#ifdef EMBENCH
+#ifdef BENCH_SHELL
+static bench_result run_entry(const bench_run *run)
+{
+    const bench_entry *entry = run->entry;
+    if (entry->hook != BENCH_HOOK_NONE)
+        FATAL("%s needs an input hook, which this harness does not have", entry->name);
+    int32_t result;
+    void *results[1] = {&result};
+    int32_t values[BENCH_MAX_ARGS];
+    void *arguments[BENCH_MAX_ARGS];
+    for (size_t i = 0; i < run->args_len; i++)
+    {
+        values[i] = run->args[i];
+        arguments[i] = &values[i];
+    }
+    int err = run_bench(entry->module, entry->size, arguments, run->args_len, results, 1, NULL);
+    if (!err)
+    {
+        printf("Result: name=%s value=%ld\n", entry->name, (long)result);
+    }
+    return err;
+}
+#elif defined(MODULE_SLOT)
+module_slot bench_slot;
+
+static bench_result run_slot(bench_args args)
+{
+    if (bench_slot.magic != MODULE_SLOT_MAGIC || bench_slot.size > sizeof bench_slot.module ||
+        bench_slot.args_len > MODULE_SLOT_VALUES || bench_slot.results_len > MODULE_SLOT_VALUES)
+        FATAL("no module in the slot");
+    int32_t values[MODULE_SLOT_VALUES];
+    void *arguments[MODULE_SLOT_VALUES];
+    void *results[MODULE_SLOT_VALUES];
+    for (size_t i = 0; i < bench_slot.args_len; i++)
+        arguments[i] = &bench_slot.args[i];
+    for (size_t i = 0; i < bench_slot.results_len; i++)
+        results[i] = &values[i];
+    int err = run_bench(bench_slot.module, bench_slot.size, arguments, bench_slot.args_len,
+                        results, bench_slot.results_len, NULL);
+    for (size_t i = 0; !err && i < bench_slot.results_len; i++)
+    {
+        printf("slot result: %ld\n", (long)values[i]);
+    }
+    return err;
+}
+#elif defined(EMBENCH)
 #define FUN_NAME_GEN(b) run_##b
 #define FUN_NAME expander(BENCHMARK, FUN_NAME_GEN)
 __attribute__((weak)) bench_result FUN_NAME(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -145,7 +216,7 @@ __attribute__((weak)) bench_result FUN_NAME(bench_args args)
 #else
 static bench_result run_coremark(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -158,7 +229,7 @@ static bench_result run_coremark(bench_args args)
 }
 static bench_result run_dhrystone_standalone(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -173,7 +244,7 @@ static bench_result run_dhrystone_standalone(bench_args args)
 }
 static bench_result run_fannkuch_redux(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -188,7 +259,7 @@ static bench_result run_fannkuch_redux(bench_args args)
 }
 static bench_result run_binary_trees(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -203,7 +274,7 @@ static bench_result run_binary_trees(bench_args args)
 }
 static bench_result run_nbody(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -218,7 +289,7 @@ static bench_result run_nbody(bench_args args)
 }
 static bench_result run_spectral_norm(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -234,7 +305,7 @@ static bench_result run_spectral_norm(bench_args args)
 
 static bench_result run_fasta(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -450,7 +521,7 @@ static int knucleotide_hook(IM3Runtime runtime, void *args[])
 }
 static bench_result run_knucleotide(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -494,7 +565,7 @@ static int rc_hook(IM3Runtime runtime, void *args[])
 }
 static bench_result run_reverse_complement(bench_args args)
 {
-    uint8_t *BENCH = BENCHMARK;
+    const uint8_t *BENCH = BENCHMARK;
     const size_t SIZE = sizeof BENCHMARK;
     int32_t result;
     void *results[1] = {&result};
@@ -511,10 +582,14 @@ static bench_result run_reverse_complement(bench_args args)
 #endif // EMBENCH
 bench_result run_active_bench(bench_args args)
 {
+#ifdef BENCH_SHELL
+    return run_entry(args);
+#else
 #define FUN(B) (run_##B(args))
     bench_result res = expander(BENCHMARK, FUN);
 #undef FUN
     return res;
+#endif
 }
 
 #undef expander
\ No newline at end of file
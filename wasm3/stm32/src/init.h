@@ -4,6 +4,35 @@
 #include <stdint.h>
 int init(void);
 
+/*
+ * SWO trace output. trace_buffer() queues into a RAM ring and sends only
+ * what the ITM takes without waiting, trace_drain() sends more of it the
+ * same way and trace_flush() blocks until everything is out.
+ */
 void trace_buffer(const uint8_t *buffer, size_t len);
+void trace_drain(void);
+void trace_flush(void);
+
+/*
+ * Free running core cycle counter (DWT CYCCNT), extended to 64 bits.
+ */
+uint64_t cycle_counter_read(void);
+uint32_t cycle_counter_hz(void);
+
+/*
+ * Periodic DWT PC sampling over SWO.
+ */
+void pc_sampling_start(void);
+void pc_sampling_stop(void);
+
+/*
+ * DWT event counters (CPI, EXC, SLEEP, LSU, FOLD). They are only 8 bits
+ * wide, every wrap goes out as an event counter packet and
+ * dwt_events_mark() sends the current counts with a tag on stimulus port
+ * 1, so the host can put the full counts together.
+ */
+void dwt_events_start(void);
+void dwt_events_stop(void);
+void dwt_events_mark(uint8_t tag);
 
 #endif
\ No newline at end of file
@@ -7,6 +7,7 @@ use ::core::alloc::GlobalAlloc;
 use ::core::ffi;
 use ::core::panic::PanicInfo;
 use ::core::ptr::null;
+use alloc::boxed::Box;
 use alloc::ffi::CString;
 use alloc::string::ToString;
 use spin::mutex::Mutex;
@@ -50,48 +51,92 @@ fn panic(_info: &PanicInfo) -> ! {
     loop {}
 }
 
+type HostState = u32;
+
+/// One benchmark run, driven step by step from C so that every phase
+/// can be timed on its own.
+pub struct Bench {
+    store: Store<HostState>,
+    linker: Linker<HostState>,
+    module: Option<Module>,
+    instance: Option<Instance>,
+}
+
+fn to_c_error(step: impl FnOnce() -> Result<(), Error>) -> *const ffi::c_char {
+    match step() {
+        Ok(()) => null(),
+        Err(e) => CString::new(e.to_string()).unwrap().into_raw(),
+    }
+}
+
 #[no_mangle]
-pub extern "C" fn wasm_interp(
+pub extern "C" fn wasmi_bench_new() -> *mut Bench {
+    // First step is to create the Wasm execution engine with some config.
+    // In this example we are using the default configuration.
+    let engine = Engine::default();
+    // All Wasm objects operate within the context of a `Store`.
+    // Each `Store` has a type parameter to store host-specific data,
+    // which in this case we are using `42` for.
+    let store = Store::new(&engine, 42);
+    // In order to create Wasm module instances and link their imports
+    // and exports we require a `Linker`.
+    let linker = <Linker<HostState>>::new(&engine);
+    Box::into_raw(Box::new(Bench {
+        store,
+        linker,
+        module: None,
+        instance: None,
+    }))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn wasmi_bench_parse(
+    bench: *mut Bench,
     input: *const ffi::c_uchar,
     len: ffi::c_size_t,
 ) -> *const ffi::c_char {
-    // First step is to create the Wasm execution engine with some config.
-    // In this example we are using the default configuration.
-    let result: Result<i32, wasmi::Error> = (|| {
-        let engine = Engine::default();
-        // Wasmi does not yet support parsing `.wat` so we have to convert
-        // out `.wat` into `.wasm` before we compile and validate it.
-        let module;
-        unsafe {
-            module = Module::new(&engine, ::core::slice::from_raw_parts(input, len))?;
-        }
-
-        // All Wasm objects operate within the context of a `Store`.
-        // Each `Store` has a type parameter to store host-specific data,
-        // which in this case we are using `42` for.
-        type HostState = u32;
-        let mut store = Store::new(&engine, 42);
-
-        // In order to create Wasm module instances and link their imports
-        // and exports we require a `Linker`.
-        let linker = <Linker<HostState>>::new(&engine);
-        // Instantiation of a Wasm module requires defining its imports and then
-        // afterwards we can fetch exports by name, as well as asserting the
-        // type signature of the function with `get_typed_func`.
-        //
-        // Also before using an instance created this way we need to start it.
-        let instance = linker.instantiate(&mut store, &module)?.start(&mut store)?;
-        let hello = instance.get_typed_func::<(), i32>(&store, "_run")?;
-
-        // And finally we can call the wasm!
-        hello.call(&mut store, ())
-    })();
-    if result.is_ok() {
-        null()
-    } else {
-        result
-            .map_err(|e| CString::new(e.to_string()).unwrap().into_raw())
-            .map(|_| null::<ffi::c_char>())
-            .unwrap_err()
-    }
+    let bench = &mut *bench;
+    to_c_error(|| {
+        let wasm = ::core::slice::from_raw_parts(input, len);
+        bench.module = Some(Module::new(bench.store.engine(), wasm)?);
+        Ok(())
+    })
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn wasmi_bench_instantiate(bench: *mut Bench) -> *const ffi::c_char {
+    let bench = &mut *bench;
+    to_c_error(|| {
+        let module = bench
+            .module
+            .as_ref()
+            .ok_or_else(|| Error::new("module not parsed"))?;
+        // Instantiation of a Wasm module requires defining its imports and
+        // then afterwards we can fetch exports by name. Before using an
+        // instance created this way we need to start it.
+        let instance = bench
+            .linker
+            .instantiate(&mut bench.store, module)?
+            .start(&mut bench.store)?;
+        bench.instance = Some(instance);
+        Ok(())
+    })
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn wasmi_bench_call(bench: *mut Bench, result: *mut i32) -> *const ffi::c_char {
+    let bench = &mut *bench;
+    to_c_error(|| {
+        let instance = bench
+            .instance
+            .ok_or_else(|| Error::new("module not instantiated"))?;
+        let run = instance.get_typed_func::<(), i32>(&bench.store, "_run")?;
+        *result = run.call(&mut bench.store, ())?;
+        Ok(())
+    })
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn wasmi_bench_free(bench: *mut Bench) {
+    drop(Box::from_raw(bench));
 }
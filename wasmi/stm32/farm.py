@@ -0,0 +1,102 @@
+"""
+Runs run-benches.py on several boards at once and merges the results.
+
+The targets file is a JSON list with one object per board:
+
+    [{"name": "l4-a", "board": "l4", "serial": "/dev/ttyACM0", "gdb": ":3333", "swo": "localhost:2332"},
+     {"name": "l4-b", "board": "l4", "serial": "/dev/ttyACM1", "gdb": ":3334", "swo": "localhost:2333"}]
+
+board is the directory the worker runs in. serial takes pyserial URLs, so
+with board "mps2" and --qemu qemu-system-arm every target is a QEMU the
+runner starts on "serial": "socket://localhost:4000" and its own gdb and
+swo ports. The benchmarks are dealt round robin
+to the targets of one board type, every worker writes into
+<results>/<date>/<name> and all main CSVs are merged into
+<results>/<date>__<configuration>.csv with the target as second column.
+Options the farm does not know are passed on to run-benches.py.
+"""
+from pathlib import Path
+from datetime import datetime
+import argparse
+import json
+import subprocess
+import sys
+
+RUN_BENCHES = Path(__file__).parent / "run-benches.py"
+
+def shard(benches, targets):
+    return {target["name"]: benches[i::len(targets)] for i, target in enumerate(targets)}
+
+def worker_command(target, benches, sources, results, config, date, passthrough):
+    """Command line and environment of the run-benches.py for one target."""
+    command = [sys.executable, str(RUN_BENCHES.resolve()), sources, str(results), config,
+               "--serial", target["serial"], "--gdb-remote", target.get("gdb", ":3333"),
+               "--swo", target.get("swo", "localhost:2332"), "--target", target["name"],
+               "--date", date.isoformat()] + passthrough + ["--benches"] + benches
+    return command, None
+
+def merge(outdir, names, results, date):
+    merged = {}
+    for name in names:
+        for path in sorted((outdir / name).glob("*.csv")):
+            # the per benchmark files have a second __ in their name
+            if path.stem.count("__") != 1:
+                continue
+            extension = path.stem.split("__", 1)[1]
+            for line in path.read_text().splitlines():
+                bench, _, rest = line.partition(",")
+                merged.setdefault(extension, []).append(f"{bench},{name},{rest}")
+    for extension, lines in merged.items():
+        path = Path(results) / f"{date.strftime('%m-%d_%H-%M-%S')}__{extension}.csv"
+        path.write_text("\n".join(lines) + "\n")
+        print(f"merged {len(lines)} rows into {path}")
+
+def main(args, passthrough):
+    targets = json.loads(Path(args.targets).read_text())
+    boards = {target["board"] for target in targets}
+    if args.board != "any":
+        if args.board is None and len(boards) > 1:
+            raise ValueError(f"targets have boards {', '.join(sorted(boards))}, pick one with --board or allow all with --board any")
+        targets = [target for target in targets if args.board is None or target["board"] == args.board]
+    if not targets:
+        raise ValueError(f"no target with board {args.board}")
+    known = sorted(p.stem for p in Path(args.sources).glob("**/*.wasm"))
+    # before any worker starts, where the error would end up in its log
+    names = {stem.replace("-", "_") for stem in known}
+    unknown = [name for name in args.benches if name.replace("-", "_") not in names]
+    if unknown:
+        raise ValueError(f"unknown benchmarks {' '.join(unknown)}, {args.sources} has {' '.join(known)}")
+    benches = args.benches or known
+    shards = shard(benches, targets)
+    date = datetime.now()
+    outdir = Path(args.results).resolve() / date.strftime('%m-%d_%H-%M-%S')
+    sources = str(Path(args.sources).resolve())
+    workers = []
+    for target in targets:
+        if not shards[target["name"]]:
+            continue
+        results = outdir / target["name"]
+        results.mkdir(parents=True)
+        print(f"{target['name']}: {' '.join(shards[target['name']])}")
+        log = open(results / "run.log", mode='w')
+        command, env = worker_command(target, shards[target["name"]], sources, results, args.config, date, passthrough)
+        workers.append((target["name"], log, subprocess.Popen(command, cwd=Path(__file__).parent / target["board"], env=env,
+                                                              stdout=log, stderr=subprocess.STDOUT)))
+    for name, log, worker in workers:
+        if worker.wait() != 0:
+            print(f"WARNING: {name} failed, see {log.name}")
+        log.close()
+    merge(outdir, [name for name, _, _ in workers], args.results, date)
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Run the benchmarks on several boards in parallel",
+    )
+    parser.add_argument("targets", help="JSON file with the boards to use")
+    parser.add_argument("sources", help="Directory with wasm benchmark sources")
+    parser.add_argument("results", help="Directory to save benchmark results")
+    parser.add_argument("config")
+    parser.add_argument("--board", default=None, help="Only use targets of this board type, any mixes them")
+    parser.add_argument("--benches", default=[], type=str, nargs="*", help="List of benchmark names to run. Defaults to all.")
+    args, passthrough = parser.parse_known_args()
+    main(args, passthrough)
@@ -0,0 +1,176 @@
+/*
+ * QEMU TCG plugin counting executed instructions, loads and stores of the
+ * image. Unlike QEMU's clock these counts are deterministic.
+ *
+ * Arguments:
+ *   marks=<addr>  address of qemu_marks in the image. A store to
+ *                 qemu_marks[tag] records the counts so far with the tag,
+ *                 init.c does that in dwt_events_mark().
+ *   out=<path>    where the counts go when QEMU exits
+ *   tbs=on        also count instructions per translation block, the
+ *                 runner adds them up per function
+ *
+ * Output, one record per line:
+ *   mark,<tag>,<insns>,<loads>,<stores>
+ *   total,<insns>,<loads>,<stores>
+ *   tb,<pc>,<insns>
+ *
+ * Instructions are counted when a block starts, so a mark also counts the
+ * rest of its block, a few instructions at most.
+ *
+ * Built by run-benches.py against the qemu-plugin.h of the QEMU in use.
+ */
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <glib.h>
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define MARK_TAGS 4
+
+typedef struct
+{
+	uint64_t pc;
+	uint64_t insns;
+} tb_count;
+
+/* one per translation, the same pc can be translated again */
+typedef struct
+{
+	tb_count *count;
+	uint64_t n;
+} tb_exec;
+
+typedef struct
+{
+	unsigned tag;
+	uint64_t insns;
+	uint64_t loads;
+	uint64_t stores;
+} mark;
+
+static uint64_t marks_addr;
+static const char *out_path = "insn-count.csv";
+static bool count_tbs;
+
+/* mps2-an386 has one vCPU, so plain counters do */
+static uint64_t insns;
+static uint64_t loads;
+static uint64_t stores;
+static GArray *marks;
+static GHashTable *tbs;
+
+static void vcpu_tb_exec(unsigned int vcpu_index, void *udata)
+{
+	tb_exec *exec = udata;
+	insns += exec->n;
+	if (exec->count != NULL)
+	{
+		exec->count->insns += exec->n;
+	}
+}
+
+static void vcpu_mem(unsigned int vcpu_index, qemu_plugin_meminfo_t info,
+					 uint64_t vaddr, void *udata)
+{
+	if (!qemu_plugin_mem_is_store(info))
+	{
+		loads++;
+		return;
+	}
+	stores++;
+	if (marks_addr != 0 && vaddr >= marks_addr && vaddr < marks_addr + MARK_TAGS)
+	{
+		mark m = {vaddr - marks_addr, insns, loads, stores};
+		g_array_append_val(marks, m);
+	}
+}
+
+static void vcpu_tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb)
+{
+	size_t n = qemu_plugin_tb_n_insns(tb);
+	tb_exec *exec = g_new0(tb_exec, 1);
+	exec->n = n;
+	if (count_tbs)
+	{
+		uint64_t pc = qemu_plugin_tb_vaddr(tb);
+		exec->count = g_hash_table_lookup(tbs, GUINT_TO_POINTER(pc));
+		if (exec->count == NULL)
+		{
+			exec->count = g_new0(tb_count, 1);
+			exec->count->pc = pc;
+			g_hash_table_insert(tbs, GUINT_TO_POINTER(pc), exec->count);
+		}
+	}
+	qemu_plugin_register_vcpu_tb_exec_cb(tb, vcpu_tb_exec, QEMU_PLUGIN_CB_NO_REGS, exec);
+	for (size_t i = 0; i < n; i++)
+	{
+		struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+		qemu_plugin_register_vcpu_mem_cb(insn, vcpu_mem, QEMU_PLUGIN_CB_NO_REGS,
+										 QEMU_PLUGIN_MEM_RW, NULL);
+	}
+}
+
+static void write_tb(gpointer key, gpointer value, gpointer udata)
+{
+	tb_count *count = value;
+	if (count->insns != 0)
+	{
+		fprintf(udata, "tb,0x%" PRIx64 ",%" PRIu64 "\n", count->pc, count->insns);
+	}
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *udata)
+{
+	FILE *out = fopen(out_path, "w");
+	if (out == NULL)
+	{
+		perror(out_path);
+		return;
+	}
+	for (guint i = 0; i < marks->len; i++)
+	{
+		mark *m = &g_array_index(marks, mark, i);
+		fprintf(out, "mark,%u,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n", m->tag, m->insns, m->loads, m->stores);
+	}
+	fprintf(out, "total,%" PRIu64 ",%" PRIu64 ",%" PRIu64 "\n", insns, loads, stores);
+	if (count_tbs)
+	{
+		g_hash_table_foreach(tbs, write_tb, out);
+	}
+	fclose(out);
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+										   int argc, char **argv)
+{
+	for (int i = 0; i < argc; i++)
+	{
+		if (strncmp(argv[i], "marks=", 6) == 0)
+		{
+			marks_addr = strtoull(argv[i] + 6, NULL, 0);
+		}
+		else if (strncmp(argv[i], "out=", 4) == 0)
+		{
+			out_path = argv[i] + 4;
+		}
+		else if (strcmp(argv[i], "tbs=on") == 0)
+		{
+			count_tbs = true;
+		}
+		else
+		{
+			fprintf(stderr, "insn-count: unknown argument %s\n", argv[i]);
+			return -1;
+		}
+	}
+	marks = g_array_new(FALSE, FALSE, sizeof(mark));
+	tbs = g_hash_table_new(NULL, NULL);
+	qemu_plugin_register_vcpu_tb_trans_cb(id, vcpu_tb_trans);
+	qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+	return 0;
+}
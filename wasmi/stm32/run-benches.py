@@ -7,7 +7,7 @@ from datetime import datetime
 import traceback
 import re
 import io
-from shutil import rmtree
+from shutil import rmtree, which
 import time
 import socket
 import os
@@ -15,14 +15,77 @@ from pygdbmi.gdbcontroller import GdbController
 from pprint import pprint
 from multiprocessing import Pool
 import argparse
+import bisect
+from collections import Counter
+import hashlib
+import json
+import struct
+import tempfile
+from functools import cache
 
 VERBOSE = os.environ.get('VERBOSE')
+# Functions and source lines shown in the PC sampling profile.
+PROFILE_TOP = 25
+# Column order of the result CSVs (after the benchmark name, no header row).
+CSV_COLUMNS = ["text", "data", "delay1", "delay2", "stack", "heap", "cycles1", "cycles2"]
+# Phases reported by run_bench, in the order they run.
+PHASES = ["engine", "parse", "instantiate", "call", "run", "teardown"]
+CSV_COLUMNS += [f"{phase}_cycles" for phase in PHASES]
+CSV_COLUMNS += [f"{phase}_stack" for phase in PHASES]
+# Summary of the timed warm runs, as computed on the device.
+RUN_STATS = ["n", "min", "median", "max", "mean", "stddev"]
+CSV_COLUMNS += [f"run_{stat}" for stat in RUN_STATS]
+# Heap peak during and live bytes at the end of every phase, from the heap trace.
+HEAP_PHASES = ["startup"] + PHASES
+CSV_COLUMNS += [f"{phase}_heap_{kind}" for phase in HEAP_PHASES for kind in ["peak", "live"]]
+# Totals and size class histogram from on-device heap accounting (HEAP_STATS builds).
+HEAP_STATS_FIELDS = ["allocs", "frees", "untracked", "overhead"]
+HEAP_CLASSES = [str(16 << i) for i in range(13)] + ["big"]
+CSV_COLUMNS += [f"heap_{field}" for field in HEAP_STATS_FIELDS]
+CSV_COLUMNS += [f"heap_class_{size}" for size in HEAP_CLASSES]
+# DWT event counters per phase (DWT_EVENTS builds), in the order of the
+# bits in the event counter packet, and the number of lost SWO packets.
+DWT_COUNTERS = ["cpi", "exc", "sleep", "lsu", "fold"]
+CSV_COLUMNS += [f"{phase}_{counter}" for phase in PHASES for counter in DWT_COUNTERS]
+CSV_COLUMNS += ["dwt_lost"]
+# Instruction and memory access counts per phase and in total from the
+# insn-count.c QEMU plugin, the marks are the DWT_EVENTS ones.
+INSN_COUNTERS = ["insns", "loads", "stores"]
+CSV_COLUMNS += [f"{phase}_{counter}" for phase in PHASES for counter in INSN_COUNTERS]
+CSV_COLUMNS += [f"total_{counter}" for counter in INSN_COUNTERS]
+PLUGIN_SOURCE = Path(__file__).parent / "mps2/insn-count.c"
+DWT_MARK_RESUME = 0
+DWT_MARK_PHASE = 1
+DWT_MARK_WARMUP = 2
+DWT_MARK_RUN = 3
+# Build trees are kept per configuration, so the runtime is only compiled
+# once and every benchmark just rebuilds benchmarks.c and relinks.
+# The wasmi library itself is cached by cargo in ../target.
+BUILD_CACHE = Path("./build-cache")
+# the image in use, ./build-<target> when several boards share a directory
+BUILD = Path("./build")
+# struct module_slot in benchmarks-defs.h
+MODULE_SLOT_MAGIC = 0x746f6c73
+MODULE_SLOT_HEADER = "<4I4iI"
+# arguments, heap size and input hook per benchmark, as for generate-headers.py
+MANIFEST_PATH = Path(__file__).parent / "../manifest.json"
+MANIFEST = json.loads(MANIFEST_PATH.read_text()) if MANIFEST_PATH.exists() else {}
+# need input from the host, which the module slot has no room for
+SLOT_UNSUPPORTED = {name for name, entry in MANIFEST.items() if "hook" in entry}
+# QEMU's Cortex-M4 board, images built in stm32/mps2 run there
+QEMU_MACHINE = "mps2-an386"
+RUNTIME_SOURCES = []
 date = None
 glob = {}
 
 class SWOReader(io.RawIOBase):
     def __init__(self, wrapped):
         self.wrapped = wrapped
+        self.pc_samples = []
+        self.event_wraps = [0] * len(DWT_COUNTERS)
+        self.marks = []
+        self.counts = None
+        self.lost = 0
 
     @staticmethod
     def buffered(wrapped):
@@ -31,26 +94,80 @@ class SWOReader(io.RawIOBase):
     def readable(self):
         return True
     
-    def readinto(self, b):
-        data = b''
-        while len(data) < 1:
-            data = self.wrapped.recv(1, socket.MSG_WAITALL)
-        expected = int(data[0])
-        if expected > 3 or expected & 0x3 == 0:
-            print("WARNING: trying to fix corrupted packet")
-            b[0] = expected
-            return 1
-        expected = [0, 1, 2, 4][expected]
+    def read_exactly(self, n):
         data = bytearray()
-        while len(data) < expected:
-            data += bytearray(self.wrapped.recv(expected - len(data), socket.MSG_WAITALL))
-        b[0:len(data)] = data
-        assert(len(data) == expected)
-        return expected
+        while len(data) < n:
+            chunk = self.wrapped.recv(n - len(data), socket.MSG_WAITALL)
+            if not chunk:
+                # QEMU or a host process exited
+                raise EOFError("trace stream closed")
+            data += chunk
+        return data
+
+    def readinto(self, b):
+        while True:
+            header = self.read_exactly(1)[0]
+            if header == 0x70:
+                # the ITM dropped packets
+                self.lost += 1
+                continue
+            if header & 0x4 and header & 0x3:
+                # hardware source packet, discriminator 2 is a DWT PC sample
+                payload = self.read_exactly([0, 1, 2, 4][header & 0x3])
+                if header >> 3 == 2:
+                    # a one byte sample means the core was sleeping
+                    self.pc_samples.append(int.from_bytes(payload, "little") if len(payload) == 4 else None)
+                elif header >> 3 == 0:
+                    # discriminator 0 tells which 8 bit event counters wrapped
+                    for i in range(len(DWT_COUNTERS)):
+                        if payload[0] >> i & 1:
+                            self.event_wraps[i] += 1
+                continue
+            if header >> 3 == 1 and header & 0x3:
+                # stimulus port 1 has the DWT counter marks, one word and one halfword
+                payload = int.from_bytes(self.read_exactly([0, 1, 2, 4][header & 0x3]), "little")
+                if header & 0x3 == 3:
+                    self.counts = [(payload >> (8 * i) & 0xff) + 256 * wraps for i, wraps in enumerate(self.event_wraps[:4])]
+                elif self.counts is not None:
+                    self.counts.append((payload & 0xff) + 256 * self.event_wraps[4])
+                    self.marks.append((payload >> 8, self.counts, self.lost))
+                    self.counts = None
+                continue
+            if header > 3 or header & 0x3 == 0:
+                print("WARNING: trying to fix corrupted packet")
+                b[0] = header
+                return 1
+            data = self.read_exactly([0, 1, 2, 4][header])
+            b[0:len(data)] = data
+            return len(data)
 
     def write(self, b):
         raise io.UnsupportedOperation()
 
+class HostConsole:
+    """What get_measurements uses of a serial port, on the stdout of a host process."""
+    def __init__(self, sock):
+        self.sock = sock
+        self.sock.settimeout(120)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.sock.close()
+
+    def read_until(self, expected):
+        data = bytearray()
+        while expected not in data:
+            try:
+                chunk = self.sock.recv(4096)
+            except socket.timeout:
+                break
+            if not chunk:
+                break
+            data += chunk
+        return bytes(data)
+
 
 def main(benchpath, outpath, benches, configuration, outname, aot_flag, semihosted_flag):
     coremark_flag = "coremark" in configuration
@@ -59,118 +176,239 @@ def main(benchpath, outpath, benches, configuration, outname, aot_flag, semihost
     configuration += "-semihosted" if semihosted_flag else "-standalone"
     p = Path(benchpath)
     benches = [p.stem.replace("-", "_") for p in list(p.glob("**/*.wasm"))] if not benches else [b.replace("-", "_") for b in benches]
-    sizes = {}
-    measurements = {}
-    for name in benches:
-        (delay1, delay2, stack, heap) = (-1, -1, -1, -1)
-        text, data = (-1, -1)
-        for trace_flag in [True, False]:
+    modules = {path.stem.replace("-", "_"): path for path in p.glob("**/*.wasm")}
+    if glob["module_slot"]:
+        benches = [name for name in benches if name not in SLOT_UNSUPPORTED]
+    rows = {name: dict.fromkeys(CSV_COLUMNS, -1) for name in benches}
+    # heap accounting on the device makes the separate trace build unnecessary
+    jobs = [(name, trace_flag) for name in benches for trace_flag in ([False] if glob["heap_stats"] or glob["profile"] or glob["dwt_events"] else [True, False])]
+    # the next images are built while the current one runs, each build slot
+    # has its own trees and one more slot holds the image on the board
+    # hash the runtime sources once, before the builders fork
+    runtime_digest()
+    with Pool(processes=glob["build_jobs"]) as builders:
+        builds = {}
+        def submit(job):
+            if job < len(jobs):
+                name, trace_flag = jobs[job]
+                builds[job] = builders.apply_async(build_bin, (name, trace_flag, aot_flag, embench_flag, job % (glob["build_jobs"] + 1)))
+        for job in range(glob["build_jobs"]):
+            submit(job)
+        for job, (name, trace_flag) in enumerate(jobs):
+            row = rows[name]
+            submit(job + glob["build_jobs"])
             print("start")
-            clear_build_dir()
             try:
                 gdbc = None
-                print(f"building {name}.bin")
-                build_bin(name, trace_flag, aot_flag, embench_flag)
-                text, data = get_size()
-                print(f"{name}.bin size: text = {text}, data = {data}")
+                qemu = None
+                host = None
+                use_build_dir(builds.pop(job).get())
+                row["text"], row["data"] = get_size()
+                print(f"{name}.bin size: text = {row['text']}, data = {row['data']}")
+                if glob["qemu"]:
+                    # before the pool, its workers read the new trace socket
+                    qemu = start_qemu()
+                elif glob["host"]:
+                    host = start_host()
                 with Pool(processes=3) as pl:
                     print(f"flashing {name}")
-                    measure2 = pl.map_async(get_heap, [None])
+                    if stream is not None:
+                        measure2 = pl.map_async(get_pc_samples if glob["profile"] else get_dwt_events if glob["dwt_events"] else get_heap, [None])
                     measure1 = pl.map_async(get_measurements, [coremark_flag])
-                    gdbc = flash_bin(name)
-                    time.sleep(1)
+                    # a host process runs right away, its output waits in the socket
+                    if not glob["host"]:
+                        gdbc = flash_bin(name, slot_image(name, modules[name].read_bytes()) if glob["module_slot"] else None)
+                        time.sleep(1)
                     print("getting measurements")
-                    start_bin(gdbc)
+                    if gdbc is not None:
+                        start_bin(gdbc)
                     if trace_flag:
-                        heap = measure2.get()[0]
-                        print(f"got heap: {heap}")
+                        heap, series = measure2.get()[0]
+                        row.update(heap)
+                        write_heap_series(f"{outpath}", name, series, configuration + f"_{outname}")
+                        print(f"got heap: {row['heap']}")
                         measure1.wait()
                     else:
-                        delay1, delay2, stack = measure1.get()[0]
+                        row.update(measure1.get()[0])
+                        if glob["profile"]:
+                            print_profile(name, measure2.get()[0], f"{outpath}", configuration + f"_{outname}")
+                        elif glob["dwt_events"]:
+                            windows, row["dwt_lost"] = measure2.get()[0]
+                            row.update({f"{window}_{counter}": count for window, counts in windows if window in PHASES
+                                        for counter, count in zip(DWT_COUNTERS, counts)})
+                            write_windows(f"{outpath}", name, windows, configuration + f"_{outname}", "dwt")
+                if glob["insn_count"] and not trace_flag:
+                    # the plugin writes the counts when QEMU exits
+                    stop_qemu(qemu)
+                    qemu = None
+                    windows, total, tbs = read_insn_counts()
+                    row.update({f"{window}_{counter}": count for window, counts in windows if window in PHASES
+                                for counter, count in zip(INSN_COUNTERS, counts)})
+                    row.update({f"total_{counter}": count for counter, count in zip(INSN_COUNTERS, total)})
+                    write_windows(f"{outpath}", name, windows, configuration + f"_{outname}", "insns")
+                    if glob["insn_functions"]:
+                        print_insn_functions(name, tbs, f"{outpath}", configuration + f"_{outname}")
             except ValueError as err:
                 print(f"Unexpected {err=}, {type(err)=}")
                 traceback.print_exc()
                 continue
             finally:
-                gdbc.exit()
-                time.sleep(3)
-        if delay1 > -1:
-            measurements[name] = (delay1, delay2, stack, heap)
-            sizes[name] = (text, data)
-    write_csv(f"{outpath}", sizes, measurements, configuration + f"_{outname}")
-
-def write_csv(path, sizes, measurements, extension):
+                if gdbc is not None:
+                    gdbc.exit()
+                if qemu is not None:
+                    stop_qemu(qemu)
+                elif host is not None:
+                    stop_host(host)
+                else:
+                    time.sleep(3)
+    measurements = {name: row for name, row in rows.items() if row["delay1"] > -1}
+    write_csv(f"{outpath}", measurements, configuration + f"_{outname}")
+
+def write_csv(path, measurements, extension):
     with open(f"{path}/{date}__{extension}.csv", mode='w') as f:
-        for name in sizes:
-            size = sizes[name]
-            measurement = measurements[name]
-            f.write(f"{name},{size[0]},{size[1]},{measurement[0]},{measurement[1]},{measurement[2]},{measurement[3]}\n")
+        for name, row in measurements.items():
+            f.write(",".join([name] + [str(row[column]) for column in CSV_COLUMNS]) + "\n")
+
+def write_heap_series(path, name, series, extension):
+    # One line per heap event: cycles since boot, live bytes, phase it happened in.
+    with open(f"{path}/{date}__{extension}__{name}_heap.csv", mode='w') as f:
+        for cycles, live, phase in series:
+            f.write(f"{cycles},{live},{phase}\n")
 
-def clear_build_dir():
-    for path in Path("./build").glob("*"):
+def clear_build_dir(build):
+    build.mkdir(parents=True, exist_ok=True)
+    for path in build.glob("*"):
         print(path)
         if path.is_file():
             path.unlink()
         elif path.is_dir():
             rmtree(path)
 
-def build_bin(name, trace_heap, aot_flag, embench_flag):
-    args = ["cmake", "..", f"-DBENCHMARK={name}", "-DCMAKE_BUILD_TYPE=Release"]
+@cache
+def runtime_digest():
+    """Hash of all runtime sources, so that changing them never reuses a build tree."""
+    digest = hashlib.sha256()
+    for root in RUNTIME_SOURCES:
+        for path in sorted(root.rglob("*")):
+            if path.is_file():
+                digest.update(str(path).encode() + b"\0")
+                digest.update(path.read_bytes())
+    return digest.hexdigest()
+
+def build_dir(args, slot):
+    """The build tree of one build slot for these cmake arguments."""
+    # build slots are per target, their images are on different boards
+    slot = f"{glob['target']}-{slot}" if glob["target"] else slot
+    if glob["no_build_cache"]:
+        target = BUILD_CACHE / f"scratch-{slot}"
+        clear_build_dir(target)
+        return target
+    options = [arg for arg in args[2:] if not arg.startswith("-DBENCHMARK=")]
+    key = hashlib.sha256("\0".join(options + [runtime_digest()]).encode()).hexdigest()[:16]
+    target = BUILD_CACHE / f"{key}-{slot}"
+    target.mkdir(parents=True, exist_ok=True)
+    return target
+
+def use_build_dir(target):
+    """Point BUILD, where flashing and symbolizing look, at target."""
+    if BUILD.is_symlink():
+        BUILD.unlink()
+    elif BUILD.exists():
+        rmtree(BUILD)
+    BUILD.symlink_to(target.resolve(), target_is_directory=True)
+
+def build_bin(name, trace_heap, aot_flag, embench_flag, slot):
+    print(f"building {name}.bin")
+    args = ["cmake", str(Path(".").resolve()), f"-DBENCHMARK={'slot' if glob['module_slot'] else name}", "-DCMAKE_BUILD_TYPE=Release"]
     if trace_heap:
         args.append("-DHEAP_TRACE=1")
+    if glob["module_slot"]:
+        args.append(f"-DMODULE_SLOT={glob['module_slot']}")
     if aot_flag:
         args.append("-DAOT=1")
     if embench_flag:
         args.append("-DEMBENCH=1")
-    with subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, cwd="./build") as p:
+    if glob["profile"]:
+        args.append("-DPC_SAMPLING=1")
+    if glob["dwt_events"]:
+        args.append(f"-DDWT_EVENTS={','.join(glob['dwt_events'])}")
+    elif glob["insn_count"]:
+        args.append("-DDWT_EVENTS=1")
+    if glob["heap_stats"] and not trace_heap:
+        args.append("-DHEAP_STATS=1")
+    if glob["iterations"]:
+        args.append(f"-DITERATIONS={glob['iterations']}")
+    if glob["warmup"]:
+        args.append(f"-DWARMUP={glob['warmup']}")
+    target = build_dir(args, slot)
+    with subprocess.Popen(args, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, cwd=target) as p:
         ret = p.wait()
         if ret != 0:
             raise Exception("Unsuccessful cmake")
-    with subprocess.Popen(["make"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, cwd="./build") as p:
+    with subprocess.Popen(["make"], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL, cwd=target) as p:
         ret = p.wait()
         if ret != 0:
             raise Exception("Unsuccessful make")
+    return target
 
 def get_size():
-    with subprocess.Popen(["size", "wasmi"], cwd="./build", stdout=subprocess.PIPE, text=True) as p:
+    with subprocess.Popen(["size", "wasmi"], cwd=BUILD, stdout=subprocess.PIPE, text=True) as p:
         out, err = p.communicate()
         match = re.search(r"^\s*(?P<text>\d+)\s*(?P<data>\d+)\s*(?P<bss>\d+)\s*(?P<dec>\d+)", out, re.MULTILINE)
         text = int(match.group('text'))
         data = int(match.group('data')) + int(match.group('bss'))
         return text, data
 
-class M3Realloc(Structure):
-    _pack_ = 1
-    _fields_ = [
-        ("old", c_uint32),
-        ("new", c_uint32),
-        ("size", c_uint32)
-    ]
-class M3Malloc(Structure):
-    _pack_ = 1
-    _fields_ = [
-        ("new", c_uint32),
-        ("size", c_uint32)
-    ]
-class M3Free(Structure):
-    _pack_ = 1
-    _fields_ = [
-        ("old", c_uint32)
-    ]
-class M3HeapTraceUnion(Union):
-    _pack_ = 1
-    _fields_ = [
-        ("realloc", M3Realloc),
-        ("malloc", M3Malloc),
-        ("free", M3Free)
-    ]
-
-class M3HeapTrace(Structure):
-    _pack_ = 1
-    _fields_ = [
-        ("tag", c_int8),
-        ("_as", M3HeapTraceUnion)
-    ]
+HEAP_MALLOC, HEAP_REALLOC, HEAP_FREE, HEAP_PHASE = 0, 1, 2, 3
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7f) << shift
+        shift += 7
+        if byte < 0x80:
+            return value, pos
+
+def read_delta(data, pos, base):
+    value, pos = read_varint(data, pos)
+    delta = (value >> 1) ^ -(value & 1)
+    return (base + delta) & 0xffffffff, pos
+
+def decode_heap_trace(data):
+    """Yield (cycles, tag, size, old, new) for every record of the delta encoded heap trace.
+
+    Phase markers have the phase name as new and its length as size.
+    """
+    pos = 0
+    prev = 0
+    cycles = 0
+    while pos < len(data):
+        try:
+            head, pos = read_varint(data, pos)
+            tag, size = head & 0x3, head >> 2
+            delta, pos = read_varint(data, pos)
+            cycles += delta
+            old = new = 0
+            if tag == HEAP_PHASE:
+                if pos + size > len(data):
+                    raise IndexError()
+                new = data[pos:pos + size].decode()
+                pos += size
+                yield cycles, tag, size, old, new
+                continue
+            if tag != HEAP_MALLOC:
+                old, pos = read_delta(data, pos, prev)
+                prev = old
+            if tag != HEAP_FREE:
+                new, pos = read_delta(data, pos, prev)
+                prev = new
+        except IndexError:
+            print("WARNING: truncated heap trace")
+            return
+        yield cycles, tag, size, old, new
 
 def get_heap(unused):
     total = bytearray()
@@ -188,28 +426,31 @@ def get_heap(unused):
     # if VERBOSE != None:
     #     print(str(total))
     data = re.match(rb".*trace ready!\n(?P<data>.*?)TRACE_DONE\n", total, re.DOTALL).group('data')
-    packets = [
-        M3HeapTrace.from_buffer_copy(data, i)
-        for i in range(0, len(data), sizeof(M3HeapTrace))]
     memmap = {}
     peak = 0
     total = 0
-    for v in packets:
-        if v.tag == 0:
-            # malloc
-            ptr = v._as.malloc.new
-            if ptr == 0:
+    result = {}
+    phase_peak = 0
+    phase_points = []
+    series = []
+    for cycles, tag, size, old, new in decode_heap_trace(data):
+        if tag == HEAP_PHASE:
+            # markers end a phase, so the name is only known now
+            if new in HEAP_PHASES:
+                result[f"{new}_heap_peak"] = phase_peak
+                result[f"{new}_heap_live"] = total
+            for point in phase_points:
+                point[2] = new
+            phase_peak = total
+            phase_points = []
+            continue
+        if tag == HEAP_MALLOC:
+            if new == 0:
                 continue
-            size = v._as.malloc.size
-            assert(memmap.get(ptr, None) == None)
-            memmap[ptr] = size
-            # print("malloc: ", size)
+            assert(memmap.get(new, None) == None)
+            memmap[new] = size
             total += size
-        elif v.tag == 1:
-            # realloc
-            new = v._as.realloc.new
-            size = v._as.realloc.size
-            old = v._as.realloc.old
+        elif tag == HEAP_REALLOC:
             if new == 0:
                 continue
             if old != 0:
@@ -218,11 +459,8 @@ def get_heap(unused):
             else:
                 old_size = 0
             memmap[new] = size
-            # print("realloc: ", size)
             total += size - old_size
-        elif v.tag == 2:
-            # free
-            old = v._as.free.old
+        elif tag == HEAP_FREE:
             if old == 0:
                 continue
             if old not in memmap:
@@ -234,42 +472,456 @@ def get_heap(unused):
         else:
             raise ValueError("unknown type")
         peak = max(peak, total)
-    return peak
+        phase_peak = max(phase_peak, total)
+        point = [cycles, total, "end"]
+        series.append(point)
+        phase_points.append(point)
+    result["heap"] = peak
+    return result, series
+
+def get_pc_samples(unused):
+    while True:
+        next_line = stream.readline()
+        if re.fullmatch(rb".*trace ready!\n$", next_line, re.DOTALL) != None:
+            break
+    stream.raw.pc_samples = []
+    while True:
+        next_line = stream.readline()
+        if re.fullmatch(rb".*TRACE_DONE\n$", next_line, re.DOTALL) != None:
+            break
+    return stream.raw.pc_samples
+
+def get_dwt_events(unused):
+    """(window, counts) for every phase and warm run, and the number of lost SWO packets."""
+    while True:
+        next_line = stream.readline()
+        if re.fullmatch(rb".*trace ready!\n$", next_line, re.DOTALL) != None:
+            break
+    stream.raw.marks = []
+    stream.raw.lost = 0
+    while True:
+        next_line = stream.readline()
+        if re.fullmatch(rb".*TRACE_DONE\n$", next_line, re.DOTALL) != None:
+            break
+    marks = []
+    last = None
+    for tag, counts, lost in stream.raw.marks:
+        if last is not None:
+            # a wrap packet can trail the mark, the low 8 bits are always right
+            counts = [count + 256 if count < prev else count for count, prev in zip(counts, last)]
+        last = counts
+        marks.append((tag, counts))
+    lost = [lost for tag, counts, lost in stream.raw.marks] + [stream.raw.lost]
+    if stream.raw.lost:
+        print(f"WARNING: {stream.raw.lost} SWO overflows, the DWT counts of the windows they hit are -1")
+    enabled = [counter in glob["dwt_events"] for counter in DWT_COUNTERS]
+    return mark_windows(marks, lost, enabled), stream.raw.lost
+
+def dwt_counter_set(value):
+    """The counters of a --dwt-events pass, e.g. cpi,exc, 1 or true for all of them."""
+    if value in {"1", "true", "True"}:
+        return list(DWT_COUNTERS)
+    if value in {"0", "false", "False"}:
+        return []
+    counters = value.split(",")
+    unknown = [counter for counter in counters if counter not in DWT_COUNTERS]
+    if unknown:
+        raise ValueError(f"unknown DWT counters {','.join(unknown)}, pick from {','.join(DWT_COUNTERS)}")
+    return counters
+
+def mark_windows(marks, lost=None, enabled=None):
+    """
+    (window, counts) for every phase and warm run from the (tag, counts)
+    marks. lost is the running count of ITM overflows at every mark and at
+    the end, a window with an overflow before the next mark may be missing
+    counter wraps. Those windows get -1 for the counters that were enabled,
+    counters that were not enabled are always -1.
+    """
+    def counted(counts, dropped):
+        return [-1 if (enabled is not None and not on) or dropped else count
+                for count, on in zip(counts, enabled or [True] * len(counts))]
+    windows = []
+    phases = iter(PHASES)
+    runs = Counter()
+    start = None
+    phase = None
+    phase_lost = False
+    for i, (tag, counts) in enumerate(marks):
+        if tag == DWT_MARK_RESUME:
+            start = counts
+            start_lost = lost[i] if lost else 0
+            continue
+        if start is None:
+            continue
+        # the measurement bookkeeping until the next resume is left out
+        window = [count - begin for count, begin in zip(counts, start)]
+        phase = [total + count for total, count in zip(phase or [0] * len(window), window)]
+        # an overflow packet can follow the mark it was before
+        window_lost = lost is not None and lost[i + 1] != start_lost
+        phase_lost = phase_lost or window_lost
+        start = None
+        if tag == DWT_MARK_PHASE:
+            windows.append((next(phases, "unknown"), counted(phase, phase_lost)))
+            phase = None
+            phase_lost = False
+        else:
+            kind = "warmup" if tag == DWT_MARK_WARMUP else "run"
+            windows.append((f"{kind}{runs[kind]}", counted(window, window_lost)))
+            runs[kind] += 1
+    return windows
+
+def write_windows(path, name, windows, extension, kind):
+    # One line per phase and warm run: name, then the counters.
+    with open(f"{path}/{date}__{extension}__{name}_{kind}.csv", mode='w') as f:
+        for window, counts in windows:
+            f.write(",".join([window] + [str(count) for count in counts]) + "\n")
+
+def get_symbols():
+    """Sorted (start, end, name) of all functions in the firmware ELF."""
+    with subprocess.Popen(["nm", "-S", "-n", "-C", "--defined-only", "wasmi"], cwd=BUILD, stdout=subprocess.PIPE, text=True) as p:
+        out, err = p.communicate()
+    symbols = []
+    for line in out.splitlines():
+        fields = line.split(maxsplit=3)
+        if len(fields) == 4 and fields[2] in "tTwW":
+            # drop the thumb bit
+            start = int(fields[0], 16) & ~1
+            symbols.append((start, start + int(fields[1], 16), fields[3]))
+    return symbols
+
+def get_source_lines(pcs):
+    with subprocess.Popen(["addr2line", "-e", "wasmi"] + [hex(pc) for pc in pcs], cwd=BUILD, stdout=subprocess.PIPE, text=True) as p:
+        out, err = p.communicate()
+    return dict(zip(pcs, out.splitlines()))
+
+def print_profile(name, samples, path, extension):
+    symbols = get_symbols()
+    starts = [start for start, end, function in symbols]
+    def symbolize(pc):
+        if pc is None:
+            return "<sleep>"
+        i = bisect.bisect_right(starts, pc) - 1
+        if i < 0 or pc >= symbols[i][1]:
+            return f"0x{pc:08x}"
+        return symbols[i][2]
+    pcs = Counter(samples)
+    functions = Counter()
+    for pc, count in pcs.items():
+        functions[symbolize(pc)] += count
+    total = max(len(samples), 1)
+    print(f"{name}: {len(samples)} PC samples")
+    for function, count in functions.most_common(PROFILE_TOP):
+        print(f"{100 * count / total:6.2f}% {count:8d}  {function}")
+    hot = [pc for pc, count in pcs.most_common(PROFILE_TOP) if pc is not None]
+    lines = get_source_lines(hot)
+    print("hot spots:")
+    for pc in hot:
+        print(f"{100 * pcs[pc] / total:6.2f}% 0x{pc:08x}  {symbolize(pc)}  {lines.get(pc, '?')}")
+    with open(f"{path}/{date}__{extension}__{name}_profile.csv", mode='w') as f:
+        for function, count in functions.most_common():
+            f.write(f"{function},{count}\n")
 
 def get_measurements(coremark_flag):
-    with serial.Serial("/dev/ttyACM0", 115200, serial.EIGHTBITS, serial.PARITY_NONE, serial.STOPBITS_ONE, timeout=120) as ser:
+    with (HostConsole(console) if glob["host"] else
+          serial.serial_for_url(glob["serial"], 115200, serial.EIGHTBITS, serial.PARITY_NONE, serial.STOPBITS_ONE, timeout=120)) as ser:
         y = bytearray()
         y.extend(ser.read_until(b'END OF TEST'))
         s = str(y, 'utf-8')
         if VERBOSE is not None:
             print(s)
-        first = re.search(r"First runtime delay: (\d+)ms", s)
-        second = re.search(r"Second runtime delay: (\d+)ms", s)
-        delay1 = int(first.group(1))
-        if second is not None:
-            delay2 = int(second.group(1))
-        else:
-            delay2 = -1
+        result = {}
+        result["delay1"], result["cycles1"] = get_delay(s, "First")
+        result["delay2"], result["cycles2"] = get_delay(s, "Second")
+        if result["delay1"] == -1:
+            raise ValueError("no runtime delay reported")
+        for phase, values in get_phases(s).items():
+            if phase in PHASES:
+                result[f"{phase}_cycles"] = values.get("cycles", -1)
+                result[f"{phase}_stack"] = values.get("stack", -1)
+            if phase in HEAP_PHASES and "heap_peak" in values:
+                result[f"{phase}_heap_peak"] = values["heap_peak"]
+                result[f"{phase}_heap_live"] = values["heap_live"]
+        stats = get_fields(s, "Run stats")
+        if stats is not None:
+            for stat in RUN_STATS:
+                result[f"run_{stat}"] = stats.get(stat, -1)
+        stats = get_fields(s, "Heap stats")
+        if stats is not None:
+            result["heap"] = stats["peak"]
+            for field in HEAP_STATS_FIELDS:
+                result[f"heap_{field}"] = stats.get(field, -1)
+        classes = get_fields(s, "Heap classes")
+        if classes is not None:
+            for size in HEAP_CLASSES:
+                result[f"heap_class_{size}"] = classes.get(size, -1)
         match = re.search(r"Max stack use: (\d+)", s)
-        stack = int(match.group(1))
+        result["stack"] = int(match.group(1))
         if coremark_flag:
             match = re.search(r"CoreMark 1.0 : (\d+\.\d?)", s)
             score = float(match.group(1))
             print(f"Coremark score: {score}")
-        return delay1, delay2, stack
+        return result
+
+def get_fields(s, label):
+    match = re.search(rf"{label}: (.*)", s)
+    if match is None:
+        return None
+    return {key: int(value) for key, value in re.findall(r"(\w+)=(-?\d+)", match.group(1))}
+
+def get_phases(s):
+    phases = {}
+    for name, fields in re.findall(r"Phase (\w+): (.*)", s):
+        phases[name] = {key: int(value) for key, value in re.findall(r"(\w+)=(-?\d+)", fields)}
+    return phases
 
-def flash_bin(name):
+def get_delay(s, label):
+    delay = re.search(rf"{label} runtime delay: (\d+)ms", s)
+    cycles = re.search(rf"{label} runtime cycles: (\d+)", s)
+    return (int(delay.group(1)) if delay is not None else -1,
+            int(cycles.group(1)) if cycles is not None else -1)
+
+flashed_image = None
+
+def flash_bin(name, slot=None):
+    global flashed_image
     gdbc = GdbController(command=[glob["gdb"], "--interpreter=mi3"],
         time_to_check_for_additional_output_sec=3)
-    gdbc.write('-target-select extended-remote :3333')
-    gdbc.write('-file-exec-and-symbols ./build/wasmi')
-    gdbc.write('-target-download', 30)
-    gdbc.write('-interpreter-exec console \"monitor reset halt\"', 30)
+    gdbc.write(f'-target-select extended-remote {glob["gdb_remote"]}')
+    gdbc.write(f'-file-exec-and-symbols {BUILD / "wasmi"}')
+    # QEMU loaded the image itself and waits at the reset vector
+    if not glob["qemu"]:
+        # the image is often the same as last time, e.g. with a module slot
+        image = hashlib.sha256((BUILD / "wasmi").read_bytes()).digest()
+        if image != flashed_image:
+            gdbc.write('-target-download', 30)
+            flashed_image = image
+        gdbc.write('-interpreter-exec console \"monitor reset halt\"', 30)
     gdbc.write('-break-delete', 30)
     gdbc.write('-break-insert post_main', 30)
-    gdbc.write('-exec-continue')
+    responses = gdbc.write('-exec-continue')
+    if slot is not None:
+        load_slot(gdbc, responses, slot)
     return gdbc
 
+def connect(host, port, timeout=10):
+    """Connect to a socket that a QEMU just started might not listen on yet."""
+    deadline = time.time() + timeout
+    while True:
+        try:
+            return socket.create_connection((host, int(port)))
+        except ConnectionRefusedError:
+            if time.time() > deadline:
+                raise
+            time.sleep(0.1)
+
+def start_qemu():
+    """Boot the image in QEMU, halted until GDB continues it, with the serial port, trace and GDB where a board has them."""
+    global stream
+    serial_host, serial_port = glob["serial"].removeprefix("socket://").rsplit(":", 1)
+    swo_host, swo_port = glob["swo"].rsplit(":", 1)
+    command = [glob["qemu"], "-M", QEMU_MACHINE, "-display", "none", "-monitor", "none",
+               "-semihosting-config", "enable=on,target=native",
+               # deterministic virtual time, SysTick counts instructions
+               "-icount", "shift=0",
+               "-serial", f"tcp:{serial_host}:{serial_port},server=on,wait=off",
+               "-serial", f"tcp:{swo_host}:{swo_port},server=on,wait=off",
+               "-gdb", f"tcp:{glob['gdb_remote']}", "-S", "-kernel", str(BUILD / "wasmi")]
+    if glob["insn_count"]:
+        counts = BUILD / "insn-count.csv"
+        counts.unlink(missing_ok=True)
+        plugin = f"{glob['plugin']},marks={symbol_address('qemu_marks')},out={counts.resolve()}"
+        command += ["-plugin", plugin + (",tbs=on" if glob["insn_functions"] else "")]
+    qemu = subprocess.Popen(command)
+    connect(serial_host, serial_port).close()
+    if glob["trace"]:
+        stream = SWOReader.buffered(connect(swo_host, swo_port))
+    return qemu
+
+def build_plugin():
+    """Compile insn-count.c against the qemu-plugin.h installed with the QEMU in use."""
+    include = Path(which(glob["qemu"]) or glob["qemu"]).resolve().parent.parent / "include"
+    # workers of the farm share the cache
+    plugin = BUILD_CACHE / (f"insn-count-{glob['target']}.so" if glob["target"] else "insn-count.so")
+    BUILD_CACHE.mkdir(parents=True, exist_ok=True)
+    glib = subprocess.run(["pkg-config", "--cflags", "glib-2.0"], stdout=subprocess.PIPE, text=True, check=True).stdout.split()
+    subprocess.run([os.environ.get("CC", "cc"), "-shared", "-fPIC", "-O2", *glib, f"-I{include}",
+                    str(PLUGIN_SOURCE), "-o", str(plugin)], check=True)
+    return plugin.resolve()
+
+def symbol_address(symbol):
+    with subprocess.Popen(["nm", "wasmi"], cwd=BUILD, stdout=subprocess.PIPE, text=True) as p:
+        out, err = p.communicate()
+    for line in out.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[2] == symbol:
+            return int(fields[0], 16)
+    raise ValueError(f"no {symbol} in the image, is it built for mps2?")
+
+def read_insn_counts():
+    """Windows as for the DWT counters, the totals and the instructions per translation block."""
+    marks, total, tbs = [], [], {}
+    for line in (BUILD / "insn-count.csv").read_text().splitlines():
+        kind, *fields = line.split(",")
+        if kind == "mark":
+            marks.append((int(fields[0]), [int(field) for field in fields[1:]]))
+        elif kind == "total":
+            total = [int(field) for field in fields]
+        elif kind == "tb":
+            tbs[int(fields[0], 16)] = int(fields[1])
+    return mark_windows(marks), total, tbs
+
+def print_insn_functions(name, tbs, path, extension):
+    symbols = get_symbols()
+    starts = [start for start, end, function in symbols]
+    functions = Counter()
+    for pc, insns in tbs.items():
+        # blocks do not cross function boundaries
+        i = bisect.bisect_right(starts, pc & ~1) - 1
+        functions[symbols[i][2] if i >= 0 and pc < symbols[i][1] else f"0x{pc:08x}"] += insns
+    total = max(sum(functions.values()), 1)
+    print(f"{name}: {total} instructions")
+    for function, count in functions.most_common(PROFILE_TOP):
+        print(f"{100 * count / total:6.2f}% {count:12d}  {function}")
+    with open(f"{path}/{date}__{extension}__{name}_insn_functions.csv", mode='w') as f:
+        for function, count in functions.most_common():
+            f.write(f"{function},{count}\n")
+
+def stop_qemu(qemu):
+    """The image ends QEMU over semihosting when main returns."""
+    try:
+        qemu.wait(timeout=10)
+    except subprocess.TimeoutExpired:
+        print("WARNING: QEMU did not exit, killing it")
+        qemu.kill()
+        qemu.wait()
+    if stream is not None:
+        stream.close()
+
+def start_host():
+    """Run the image built in stm32/host natively, stdout and the trace go to socket pairs that the workers read."""
+    global stream, console
+    console, stdout = socket.socketpair()
+    env = dict(os.environ)
+    fds = [stdout.fileno()]
+    if glob["trace"]:
+        trace, trace_child = socket.socketpair()
+        env["TRACE_FD"] = str(trace_child.fileno())
+        fds.append(trace_child.fileno())
+    host = subprocess.Popen([str(BUILD / "wasmi")], stdout=stdout, stdin=subprocess.DEVNULL, env=env, pass_fds=fds)
+    stdout.close()
+    if glob["trace"]:
+        trace_child.close()
+        stream = SWOReader.buffered(trace)
+    return host
+
+def stop_host(host):
+    try:
+        host.wait(timeout=10)
+    except subprocess.TimeoutExpired:
+        print("WARNING: the host process did not exit, killing it")
+        host.kill()
+        host.wait()
+    console.close()
+    if stream is not None:
+        stream.close()
+
+def run_params(module):
+    """Parameter count of the module's _run export, None for AOT images or without one."""
+    if module[:4] != b"\0asm":
+        return None
+    pos = 8
+    def leb():
+        nonlocal pos
+        value = shift = 0
+        while True:
+            byte = module[pos]
+            pos += 1
+            value |= (byte & 0x7f) << shift
+            shift += 7
+            if byte < 0x80:
+                return value
+    def name():
+        nonlocal pos
+        n = leb()
+        pos += n
+        return module[pos - n:pos]
+    def limits():
+        flags = leb()
+        leb()
+        if flags & 1:
+            leb()
+    types, funcs = [], []
+    while pos < len(module):
+        section = module[pos]
+        pos += 1
+        size = leb()
+        end = pos + size
+        if section == 1:
+            for _ in range(leb()):
+                pos += 1
+                params = leb()
+                pos += params
+                results = leb()
+                pos += results
+                types.append(params)
+        elif section == 2:
+            for _ in range(leb()):
+                name()
+                name()
+                kind = module[pos]
+                pos += 1
+                if kind == 0:
+                    funcs.append(types[leb()])
+                elif kind == 1:
+                    pos += 1
+                    limits()
+                elif kind == 2:
+                    limits()
+                elif kind == 3:
+                    pos += 2
+                else:
+                    pos += 1
+                    leb()
+        elif section == 3:
+            funcs += [types[leb()] for _ in range(leb())]
+        elif section == 7:
+            for _ in range(leb()):
+                export, kind, index = name(), module[pos], None
+                pos += 1
+                index = leb()
+                if export == b"_run" and kind == 0:
+                    return funcs[index]
+            return None
+        pos = end
+    return None
+
+def slot_image(name, module):
+    """The module slot contents for one benchmark, laid out like struct module_slot."""
+    entry = MANIFEST.get(name, {})
+    args, heap_size = entry.get("args", []), entry.get("heap", 1 << 13)
+    params = run_params(module)
+    if params is not None and params != len(args):
+        raise ValueError(f"{name}: _run takes {params} arguments, manifest.json gives {args}")
+    return struct.pack(MODULE_SLOT_HEADER, MODULE_SLOT_MAGIC, len(module), heap_size, len(args),
+                       *(args + [0] * (4 - len(args))), 1) + module
+
+def load_slot(gdbc, responses, image):
+    """Write the module slot once the target waits in post_main."""
+    deadline = time.time() + 30
+    while not any(r["type"] == "notify" and r["message"] == "stopped" for r in responses):
+        if time.time() > deadline:
+            raise ValueError("target did not stop in post_main")
+        responses = gdbc.get_gdb_response(timeout_sec=1, raise_error_on_timeout=False)
+    result = [r for r in gdbc.write('-data-evaluate-expression "sizeof(bench_slot.module)"', 10) if r["type"] == "result"]
+    capacity = int(result[0]["payload"]["value"]) if result and result[0]["message"] == "done" else 0
+    size = len(image) - struct.calcsize(MODULE_SLOT_HEADER)
+    if size > capacity:
+        raise ValueError(f"module of {size} bytes does not fit into the {capacity} byte slot")
+    with tempfile.NamedTemporaryFile(suffix=".bin") as f:
+        f.write(image)
+        f.flush()
+        gdbc.write(f'-interpreter-exec console "restore {f.name} binary &bench_slot"', 60)
+
 def start_bin(gdbc):
     gdbc.write('-break-delete', 10)
     gdbc.write('-exec-continue')
@@ -289,10 +941,67 @@ if __name__ == "__main__":
     parser.add_argument("--date", default=datetime.now(), type=datetime.fromisoformat)
     parser.add_argument("--semihosted", default=False, type=boolean)
     parser.add_argument("--gdb", default="arm-none-eabihf-gdb")
+    parser.add_argument("--iterations", type=int, default=None, help="Timed warm runs per benchmark")
+    parser.add_argument("--warmup", type=int, default=None, help="Untimed runs before the timed ones")
+    parser.add_argument("--heap-stats", default=False, type=boolean, help="Count heap usage on the device instead of tracing it over SWO")
+    parser.add_argument("--profile", default=False, type=boolean, help="Sample the PC over SWO and print a flat profile")
+    parser.add_argument("--dwt-events", default=None, help="Count DWT events per phase and warm run, the counters of one pass such as cpi,exc, or true for cpi,exc,sleep,lsu,fold. Fewer counters send fewer wrap packets over SWO")
+    parser.add_argument("--no-build-cache", default=False, type=boolean, help="Rebuild everything from scratch in ./build for every benchmark")
+    parser.add_argument("--build-jobs", default=2, type=int, help="Images built ahead in parallel while one runs on the board")
+    parser.add_argument("--module-slot", type=int, default=None, help="Flash one image with a module slot of this many bytes and load every benchmark into it over GDB")
+    parser.add_argument("--serial", default=None, help="Serial port of the board, pyserial URLs such as socket://localhost:4000 work too. Defaults to /dev/ttyACM0, or socket://localhost:4000 with --qemu")
+    parser.add_argument("--gdb-remote", default=":3333", help="GDB server of the board")
+    parser.add_argument("--swo", default="localhost:2332", help="SWO trace socket of the board")
+    parser.add_argument("--qemu", default=None, help="Run the images in this qemu-system-arm instead of on a board, from stm32/mps2")
+    parser.add_argument("--host", default=False, type=boolean, help="Run the images natively instead of on a board, from stm32/host. Cycles are nanoseconds then")
+    parser.add_argument("--insn-count", default=False, type=boolean, help="Count instructions, loads and stores per phase with the insn-count.c QEMU plugin, needs --qemu")
+    parser.add_argument("--insn-functions", default=False, type=boolean, help="With --insn-count, also count instructions per function")
+    parser.add_argument("--target", default=None, help="Name of the board when several share this directory, keeps their builds apart")
     parser.add_argument("--benches", default=[], type=str, nargs="*", help="List of benchmark names to run. Defaults to all.")
     args = parser.parse_args()
     date = args.date.strftime('%m-%d_%H-%M-%S')
+    known = {path.stem.replace("-", "_") for path in Path(args.sources).glob("**/*.wasm")}
+    unknown = [name for name in args.benches if name.replace("-", "_") not in known]
+    if unknown:
+        parser.error(f"unknown benchmarks {' '.join(unknown)}, {args.sources} has {' '.join(sorted(known))}")
     glob["gdb"] = args.gdb
-    sock = socket.create_connection(("localhost", 2332))
-    stream = SWOReader.buffered(sock)
+    glob["iterations"] = args.iterations
+    glob["warmup"] = args.warmup
+    glob["heap_stats"] = args.heap_stats
+    glob["profile"] = args.profile
+    try:
+        glob["dwt_events"] = dwt_counter_set(args.dwt_events) if args.dwt_events else []
+    except ValueError as err:
+        parser.error(str(err))
+    args.dwt_events = glob["dwt_events"]
+    glob["no_build_cache"] = args.no_build_cache
+    glob["build_jobs"] = max(args.build_jobs, 1)
+    glob["module_slot"] = args.module_slot
+    if args.qemu and (args.profile or args.dwt_events):
+        parser.error("QEMU has no DWT, --profile and --dwt-events need a board")
+    if args.insn_count and not args.qemu:
+        parser.error("--insn-count needs --qemu")
+    if args.host and (args.qemu or args.profile or args.dwt_events or args.module_slot):
+        parser.error("--host cannot be combined with --qemu, --profile, --dwt-events or --module-slot")
+    glob["qemu"] = args.qemu
+    glob["host"] = args.host
+    glob["insn_count"] = args.insn_count
+    glob["insn_functions"] = args.insn_functions
+    glob["serial"] = args.serial or ("socket://localhost:4000" if args.qemu else "/dev/ttyACM0")
+    if args.qemu and not glob["serial"].startswith("socket://"):
+        parser.error("with --qemu the serial port must be a socket:// URL")
+    glob["swo"] = args.swo
+    glob["gdb_remote"] = args.gdb_remote
+    glob["target"] = args.target
+    glob["plugin"] = build_plugin() if args.insn_count else None
+    if args.target:
+        BUILD = Path(f"./build-{args.target}")
+    stream = None
+    console = None
+    glob["trace"] = not args.heap_stats or args.profile or args.dwt_events
+    # QEMU and host processes open a new trace socket for every image
+    if glob["trace"] and not (args.qemu or args.host):
+        host, port = args.swo.rsplit(":", 1)
+        sock = socket.create_connection((host, int(port)))
+        stream = SWOReader.buffered(sock)
     main(args.sources, args.results, args.benches, args.config, args.outname, args.aot, args.semihosted)
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "benchmarks.h"
 #include "benchmarks-defs.h"
+#include "init.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -12,32 +13,110 @@
 #define _TEST_result expander(BENCHMARK, _test)
 
 
-const char* wasm_interp(const unsigned char *input, size_t len);
+typedef struct wasmi_bench wasmi_bench;
 
-#ifdef EMBENCH
-#define FUN_NAME_GEN(b) run_##b
-#define FUN_NAME expander(BENCHMARK, FUN_NAME_GEN)
-__attribute__((weak)) bench_result FUN_NAME()
+wasmi_bench *wasmi_bench_new(void);
+const char *wasmi_bench_parse(wasmi_bench *bench, const unsigned char *input, size_t len);
+const char *wasmi_bench_instantiate(wasmi_bench *bench);
+const char *wasmi_bench_call(wasmi_bench *bench, int32_t *result);
+void wasmi_bench_free(wasmi_bench *bench);
+
+static void print_delay(const char *label, uint64_t cycles)
+{
+    printf("%s runtime delay: %lums\n", label,
+           (unsigned long)(cycles * 1000 / cycle_counter_hz()));
+    printf("%s runtime cycles: %llu\n", label, (unsigned long long)cycles);
+}
+
+static const char *run_bench(const unsigned char *wasm, size_t size)
 {
-    uint8_t *BENCH = BENCHMARK;
-    const size_t SIZE = sizeof BENCHMARK;
-    clock_t start = clock();
-    const char* err = wasm_interp(BENCH, SIZE);
-    clock_t end = clock();
-    printf("First runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
-    printf("Second runtime delay: %ldms\n", (end - start) * 1000 / (CLOCKS_PER_SEC));
+    const char *err;
+    int32_t result = 0;
+    uint64_t first = 0;
+    uint64_t second = 0;
+
+    uint64_t start = measure_now();
+    measure_begin();
+    wasmi_bench *bench = wasmi_bench_new();
+    measure_phase("engine");
+
+    err = wasmi_bench_parse(bench, wasm, size);
+    measure_phase("parse");
+    if (err)
+        goto out;
+
+    err = wasmi_bench_instantiate(bench);
+    measure_phase("instantiate");
+    if (err)
+        goto out;
+
+    err = wasmi_bench_call(bench, &result);
+    uint64_t end = measure_now();
+    measure_phase("call");
+    if (err)
+        goto out;
+    first = end - start;
+    printf("BENCHMARK result: %ld\n", (long)result);
+
+    for (uint32_t i = 0; i < bench_warmup + bench_iterations; i++)
+    {
+        start = measure_now();
+        err = wasmi_bench_call(bench, &result);
+        end = measure_now();
+        if (err)
+            goto out;
+        if (i == bench_warmup)
+            second = end - start;
+        measure_sample(end - start);
+    }
+    measure_phase("run");
+
+out:
+    wasmi_bench_free(bench);
+    measure_phase("teardown");
     if (!err)
     {
-        printf("BENCHMARK"
-               " result: %ld\n",
-               err);
+        print_delay("First", first);
+        print_delay("Second", second);
     }
     return err;
 }
+
+#ifdef BENCH_SHELL
+static bench_result run_entry(const bench_run *run)
+{
+    /* wasmi_bench_call() takes no arguments and returns one i32 */
+    if (run->args_len != 0 || run->entry->hook != BENCH_HOOK_NONE)
+        return "the benchmark needs arguments or an input hook";
+    return run_bench(run->entry->module, run->entry->size);
+}
+#elif defined(MODULE_SLOT)
+module_slot bench_slot;
+
+static bench_result run_slot()
+{
+    /* wasmi_bench_call() takes no arguments and returns one i32 */
+    if (bench_slot.magic != MODULE_SLOT_MAGIC || bench_slot.size > sizeof bench_slot.module ||
+        bench_slot.args_len != 0 || bench_slot.results_len != 1)
+        return "no module in the slot";
+    return run_bench(bench_slot.module, bench_slot.size);
+}
+#define FUN_NAME run_slot
+#elif defined(EMBENCH)
+#define FUN_NAME_GEN(b) run_##b
+#define FUN_NAME expander(BENCHMARK, FUN_NAME_GEN)
+__attribute__((weak)) bench_result FUN_NAME()
+{
+    return run_bench(BENCHMARK, sizeof BENCHMARK);
+}
 #endif
 
-const char* run_active_bench(void*) {
+const char* run_active_bench(void* args) {
+#ifdef BENCH_SHELL
+    return run_entry(args);
+#else
     return FUN_NAME();
+#endif
 }
 #undef FUN_NAME
 #undef expander
\ No newline at end of file
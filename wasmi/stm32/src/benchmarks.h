@@ -1,48 +1,51 @@
 #ifndef H_BENCHMARKS
 #define H_BENCHMARKS
 #include <stdint.h>
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-variable"
-
-static uint8_t aha_mont64[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x16 ,0x4 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x5 ,0x7f ,0x7e ,0x7e ,0x7e ,0x7e ,0x0 ,0x3 ,0xc ,0xb ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x1 ,0x0 ,0x2 ,0x0 ,0x0 ,0x3 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xa0 ,0x85 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x99 ,0x8 ,0xb ,0x7f ,0x0 ,0x41 ,0xa0 ,0x85 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x7 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xce ,0xc ,0xb ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x91 ,0xa ,0x6 ,0x2 ,0x7f ,0x2 ,0x7e ,0x1 ,0x7f ,0x4 ,0x7e ,0x1 ,0x7f ,0x7 ,0x7e ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0x1 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x90 ,0x1 ,0x6a ,0x42 ,0xef ,0xff ,0x8d ,0xb9 ,0x98 ,0xe4 ,0xcd ,0xa4 ,0x5 ,0x42 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x1b ,0x22 ,0x4 ,0x42 ,0x0 ,0x42 ,0xf3 ,0x8a ,0xcc ,0xc9 ,0xfb ,0xbd ,0xdb ,0xb9 ,0x14 ,0x42 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x1b ,0x22 ,0x5 ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x42 ,0xe1 ,0x8e ,0xdc ,0xb6 ,0x8c ,0xdb ,0xed ,0x8b ,0x5 ,0x42 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x88 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x1b ,0x21 ,0x7 ,0x42 ,0x9f ,0xf1 ,0xa3 ,0xc9 ,0xf3 ,0xa4 ,0x92 ,0xf4 ,0x7a ,0x42 ,0x0 ,0x20 ,0x6 ,0x1b ,0x21 ,0x8 ,0x20 ,0x2 ,0x41 ,0x90 ,0x1 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x21 ,0x9 ,0x20 ,0x2 ,0x29 ,0x3 ,0x90 ,0x1 ,0x21 ,0xa ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0xb ,0x3 ,0x40 ,0x42 ,0xc0 ,0x0 ,0x21 ,0xc ,0x20 ,0x9 ,0x21 ,0xd ,0x20 ,0xa ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xd ,0x42 ,0x1 ,0x86 ,0x20 ,0xe ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0xf ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xf ,0x20 ,0xd ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xd ,0x20 ,0xe ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xe ,0x20 ,0xc ,0x42 ,0x7f ,0x7c ,0x22 ,0xc ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x1 ,0x6a ,0x20 ,0xd ,0x42 ,0x0 ,0x20 ,0xd ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x21 ,0xd ,0x42 ,0xc0 ,0x0 ,0x21 ,0xc ,0x20 ,0x2 ,0x29 ,0x3 ,0x80 ,0x1 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xd ,0x42 ,0x1 ,0x86 ,0x20 ,0xe ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0xf ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xf ,0x20 ,0xd ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xd ,0x20 ,0xe ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xe ,0x20 ,0xc ,0x42 ,0x7f ,0x7c ,0x22 ,0xc ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0xf0 ,0x0 ,0x6a ,0x20 ,0xd ,0x42 ,0x0 ,0x20 ,0xd ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0xf0 ,0x0 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x21 ,0xc ,0x42 ,0xc0 ,0x0 ,0x21 ,0xe ,0x20 ,0x2 ,0x29 ,0x3 ,0x70 ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0xc ,0x42 ,0x1 ,0x86 ,0x20 ,0xd ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0xf ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xf ,0x20 ,0xc ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xc ,0x20 ,0xd ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xd ,0x20 ,0xe ,0x42 ,0x7f ,0x7c ,0x22 ,0xe ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x42 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x7f ,0x21 ,0xe ,0x42 ,0x1 ,0x21 ,0xd ,0x42 ,0x0 ,0x21 ,0xf ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0xa7 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x20 ,0xf ,0x42 ,0x1 ,0x88 ,0x21 ,0xf ,0x20 ,0xd ,0x42 ,0x1 ,0x88 ,0x21 ,0xd ,0xc ,0x1 ,0xb ,0x20 ,0xd ,0x20 ,0x8 ,0x85 ,0x42 ,0x1 ,0x88 ,0x20 ,0xd ,0x20 ,0x8 ,0x83 ,0x7c ,0x21 ,0xd ,0x20 ,0xf ,0x42 ,0x1 ,0x88 ,0x42 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x7f ,0x84 ,0x21 ,0xf ,0xb ,0x20 ,0xe ,0x42 ,0x1 ,0x56 ,0x21 ,0x6 ,0x20 ,0xe ,0x42 ,0x1 ,0x88 ,0x21 ,0xe ,0x20 ,0x6 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x20 ,0xd ,0x37 ,0x3 ,0xa8 ,0x1 ,0x20 ,0x2 ,0x20 ,0xf ,0x37 ,0x3 ,0xa0 ,0x1 ,0x20 ,0x2 ,0x29 ,0x3 ,0xa8 ,0x1 ,0x1a ,0x42 ,0x0 ,0x21 ,0xe ,0x42 ,0xc0 ,0x0 ,0x21 ,0xf ,0x20 ,0x2 ,0x29 ,0x3 ,0xa0 ,0x1 ,0x21 ,0x10 ,0x20 ,0x4 ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0xd ,0x42 ,0x1 ,0x86 ,0x20 ,0xe ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0x11 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0x11 ,0x20 ,0xd ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xd ,0x20 ,0xe ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xe ,0x20 ,0xf ,0x42 ,0x7f ,0x7c ,0x22 ,0xf ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x42 ,0x0 ,0x21 ,0xf ,0x42 ,0xc0 ,0x0 ,0x21 ,0x11 ,0x20 ,0x5 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xe ,0x42 ,0x1 ,0x86 ,0x20 ,0xf ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0x12 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0x12 ,0x20 ,0xe ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xe ,0x20 ,0xf ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xf ,0x20 ,0x11 ,0x42 ,0x7f ,0x7c ,0x22 ,0x11 ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0xe0 ,0x0 ,0x6a ,0x20 ,0xe ,0x42 ,0x0 ,0x20 ,0xd ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x20 ,0x2 ,0x29 ,0x3 ,0xa0 ,0x1 ,0x20 ,0x2 ,0x29 ,0x3 ,0x60 ,0x22 ,0xd ,0x7e ,0x42 ,0x0 ,0x20 ,0x8 ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x20 ,0x2 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x20 ,0x2 ,0x41 ,0xe0 ,0x0 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x22 ,0xe ,0x7c ,0x20 ,0xd ,0x42 ,0x7f ,0x85 ,0x20 ,0x2 ,0x29 ,0x3 ,0x50 ,0x54 ,0x22 ,0x6 ,0xad ,0x7c ,0x22 ,0xd ,0x20 ,0x8 ,0x20 ,0x8 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xd ,0x20 ,0xe ,0x51 ,0x1b ,0x42 ,0x0 ,0x20 ,0x6 ,0x1b ,0x20 ,0xd ,0x20 ,0xe ,0x54 ,0x1b ,0x20 ,0xd ,0x20 ,0x8 ,0x5a ,0x1b ,0x7d ,0x22 ,0xd ,0x42 ,0x0 ,0x20 ,0xd ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x30 ,0x6a ,0x20 ,0x2 ,0x29 ,0x3 ,0xa0 ,0x1 ,0x20 ,0x2 ,0x29 ,0x3 ,0x40 ,0x22 ,0xd ,0x7e ,0x42 ,0x0 ,0x20 ,0x8 ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x20 ,0x6a ,0x20 ,0x2 ,0x41 ,0x30 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x20 ,0x2 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x22 ,0xe ,0x7c ,0x20 ,0xd ,0x42 ,0x7f ,0x85 ,0x20 ,0x2 ,0x29 ,0x3 ,0x30 ,0x54 ,0x22 ,0x6 ,0xad ,0x7c ,0x22 ,0xd ,0x20 ,0x8 ,0x20 ,0x8 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xd ,0x20 ,0xe ,0x51 ,0x1b ,0x42 ,0x0 ,0x20 ,0x6 ,0x1b ,0x20 ,0xd ,0x20 ,0xe ,0x54 ,0x1b ,0x20 ,0xd ,0x20 ,0x8 ,0x5a ,0x1b ,0x7d ,0x22 ,0xd ,0x42 ,0x0 ,0x20 ,0xd ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x20 ,0x2 ,0x29 ,0x3 ,0xa0 ,0x1 ,0x20 ,0x2 ,0x29 ,0x3 ,0x20 ,0x22 ,0xd ,0x7e ,0x42 ,0x0 ,0x20 ,0x8 ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x20 ,0x2 ,0x41 ,0x20 ,0x6a ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x22 ,0xe ,0x7c ,0x20 ,0xd ,0x42 ,0x7f ,0x85 ,0x20 ,0x2 ,0x29 ,0x3 ,0x10 ,0x54 ,0x22 ,0x6 ,0xad ,0x7c ,0x22 ,0xd ,0x20 ,0x8 ,0x20 ,0x8 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0xd ,0x20 ,0xe ,0x51 ,0x1b ,0x42 ,0x0 ,0x20 ,0x6 ,0x1b ,0x20 ,0xd ,0x20 ,0xe ,0x54 ,0x1b ,0x20 ,0xd ,0x20 ,0x8 ,0x5a ,0x1b ,0x7d ,0x42 ,0x0 ,0x20 ,0x2 ,0x29 ,0x3 ,0xa8 ,0x1 ,0x42 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x29 ,0x3 ,0x0 ,0x21 ,0xd ,0x42 ,0xc0 ,0x0 ,0x21 ,0xf ,0x20 ,0x2 ,0x29 ,0x3 ,0x0 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xd ,0x42 ,0x1 ,0x86 ,0x20 ,0xe ,0x42 ,0x3f ,0x88 ,0x84 ,0x22 ,0x11 ,0x20 ,0x8 ,0x42 ,0x0 ,0x20 ,0x11 ,0x20 ,0xd ,0x42 ,0x3f ,0x87 ,0x84 ,0x20 ,0x8 ,0x5a ,0x22 ,0x6 ,0x1b ,0x7d ,0x21 ,0xd ,0x20 ,0xe ,0x42 ,0x1 ,0x86 ,0x20 ,0x6 ,0xad ,0x84 ,0x21 ,0xe ,0x20 ,0xf ,0x42 ,0x7f ,0x7c ,0x22 ,0xf ,0x42 ,0x0 ,0x52 ,0xd ,0x0 ,0xb ,0x20 ,0xb ,0x41 ,0x1 ,0x6a ,0x22 ,0xb ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0xd ,0x20 ,0xc ,0x52 ,0x20 ,0x10 ,0x20 ,0x7 ,0x7e ,0x42 ,0x1 ,0x52 ,0x72 ,0x21 ,0x6 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0xb0 ,0x1 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0xb ,0xd ,0x0 ,0x41 ,0xd8 ,0x3 ,0x41 ,0x1 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x23 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x88 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x75 ,0x1 ,0x1 ,0x7e ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x1 ,0x7e ,0x20 ,0x2 ,0x20 ,0x3 ,0x7e ,0x7c ,0x20 ,0x3 ,0x42 ,0x20 ,0x88 ,0x22 ,0x2 ,0x20 ,0x1 ,0x42 ,0x20 ,0x88 ,0x22 ,0x4 ,0x7e ,0x7c ,0x20 ,0x3 ,0x42 ,0xff ,0xff ,0xff ,0xff ,0xf ,0x83 ,0x22 ,0x3 ,0x20 ,0x1 ,0x42 ,0xff ,0xff ,0xff ,0xff ,0xf ,0x83 ,0x22 ,0x1 ,0x7e ,0x22 ,0x5 ,0x42 ,0x20 ,0x88 ,0x20 ,0x3 ,0x20 ,0x4 ,0x7e ,0x7c ,0x22 ,0x3 ,0x42 ,0x20 ,0x88 ,0x7c ,0x20 ,0x3 ,0x42 ,0xff ,0xff ,0xff ,0xff ,0xf ,0x83 ,0x20 ,0x2 ,0x20 ,0x1 ,0x7e ,0x7c ,0x22 ,0x1 ,0x42 ,0x20 ,0x88 ,0x7c ,0x37 ,0x3 ,0x8 ,0x20 ,0x0 ,0x20 ,0x1 ,0x42 ,0x20 ,0x86 ,0x20 ,0x5 ,0x42 ,0xff ,0xff ,0xff ,0xff ,0xf ,0x83 ,0x84 ,0x37 ,0x3 ,0x0 ,0xb};
-
-static uint8_t crc32[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x12 ,0x4 ,0x60 ,0x0 ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x0 ,0x3 ,0xe ,0xd ,0x0 ,0x0 ,0x1 ,0x0 ,0x2 ,0x1 ,0x2 ,0x1 ,0x3 ,0x0 ,0x1 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0x8d ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x88 ,0x10 ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0x8d ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xa ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xf5 ,0x2 ,0xd ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x40 ,0x1 ,0x2 ,0x7f ,0x41 ,0x80 ,0x8 ,0x21 ,0x0 ,0x41 ,0x7f ,0x21 ,0x1 ,0x3 ,0x40 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x73 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x73 ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0x7f ,0x73 ,0xb ,0x2 ,0x0 ,0xb ,0x50 ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x41 ,0xff ,0xff ,0x1 ,0x71 ,0xb ,0xd ,0x0 ,0x41 ,0xaa ,0x1 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x30 ,0x1 ,0x1 ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0xed ,0x9c ,0x99 ,0x8e ,0x4 ,0x6c ,0x41 ,0xb9 ,0xe0 ,0x0 ,0x6a ,0x41 ,0xff ,0xff ,0xff ,0xff ,0x7 ,0x71 ,0x22 ,0x0 ,0x36 ,0x2 ,0x84 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x10 ,0x76 ,0xb ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x84 ,0x90 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xb ,0x88 ,0x8 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x80 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x96 ,0x30 ,0x7 ,0x77 ,0x2c ,0x61 ,0xe ,0xee ,0xba ,0x51 ,0x9 ,0x99 ,0x19 ,0xc4 ,0x6d ,0x7 ,0x8f ,0xf4 ,0x6a ,0x70 ,0x35 ,0xa5 ,0x63 ,0xe9 ,0xa3 ,0x95 ,0x64 ,0x9e ,0x32 ,0x88 ,0xdb ,0xe ,0xa4 ,0xb8 ,0xdc ,0x79 ,0x1e ,0xe9 ,0xd5 ,0xe0 ,0x88 ,0xd9 ,0xd2 ,0x97 ,0x2b ,0x4c ,0xb6 ,0x9 ,0xbd ,0x7c ,0xb1 ,0x7e ,0x7 ,0x2d ,0xb8 ,0xe7 ,0x91 ,0x1d ,0xbf ,0x90 ,0x64 ,0x10 ,0xb7 ,0x1d ,0xf2 ,0x20 ,0xb0 ,0x6a ,0x48 ,0x71 ,0xb9 ,0xf3 ,0xde ,0x41 ,0xbe ,0x84 ,0x7d ,0xd4 ,0xda ,0x1a ,0xeb ,0xe4 ,0xdd ,0x6d ,0x51 ,0xb5 ,0xd4 ,0xf4 ,0xc7 ,0x85 ,0xd3 ,0x83 ,0x56 ,0x98 ,0x6c ,0x13 ,0xc0 ,0xa8 ,0x6b ,0x64 ,0x7a ,0xf9 ,0x62 ,0xfd ,0xec ,0xc9 ,0x65 ,0x8a ,0x4f ,0x5c ,0x1 ,0x14 ,0xd9 ,0x6c ,0x6 ,0x63 ,0x63 ,0x3d ,0xf ,0xfa ,0xf5 ,0xd ,0x8 ,0x8d ,0xc8 ,0x20 ,0x6e ,0x3b ,0x5e ,0x10 ,0x69 ,0x4c ,0xe4 ,0x41 ,0x60 ,0xd5 ,0x72 ,0x71 ,0x67 ,0xa2 ,0xd1 ,0xe4 ,0x3 ,0x3c ,0x47 ,0xd4 ,0x4 ,0x4b ,0xfd ,0x85 ,0xd ,0xd2 ,0x6b ,0xb5 ,0xa ,0xa5 ,0xfa ,0xa8 ,0xb5 ,0x35 ,0x6c ,0x98 ,0xb2 ,0x42 ,0xd6 ,0xc9 ,0xbb ,0xdb ,0x40 ,0xf9 ,0xbc ,0xac ,0xe3 ,0x6c ,0xd8 ,0x32 ,0x75 ,0x5c ,0xdf ,0x45 ,0xcf ,0xd ,0xd6 ,0xdc ,0x59 ,0x3d ,0xd1 ,0xab ,0xac ,0x30 ,0xd9 ,0x26 ,0x3a ,0x0 ,0xde ,0x51 ,0x80 ,0x51 ,0xd7 ,0xc8 ,0x16 ,0x61 ,0xd0 ,0xbf ,0xb5 ,0xf4 ,0xb4 ,0x21 ,0x23 ,0xc4 ,0xb3 ,0x56 ,0x99 ,0x95 ,0xba ,0xcf ,0xf ,0xa5 ,0xbd ,0xb8 ,0x9e ,0xb8 ,0x2 ,0x28 ,0x8 ,0x88 ,0x5 ,0x5f ,0xb2 ,0xd9 ,0xc ,0xc6 ,0x24 ,0xe9 ,0xb ,0xb1 ,0x87 ,0x7c ,0x6f ,0x2f ,0x11 ,0x4c ,0x68 ,0x58 ,0xab ,0x1d ,0x61 ,0xc1 ,0x3d ,0x2d ,0x66 ,0xb6 ,0x90 ,0x41 ,0xdc ,0x76 ,0x6 ,0x71 ,0xdb ,0x1 ,0xbc ,0x20 ,0xd2 ,0x98 ,0x2a ,0x10 ,0xd5 ,0xef ,0x89 ,0x85 ,0xb1 ,0x71 ,0x1f ,0xb5 ,0xb6 ,0x6 ,0xa5 ,0xe4 ,0xbf ,0x9f ,0x33 ,0xd4 ,0xb8 ,0xe8 ,0xa2 ,0xc9 ,0x7 ,0x78 ,0x34 ,0xf9 ,0x0 ,0xf ,0x8e ,0xa8 ,0x9 ,0x96 ,0x18 ,0x98 ,0xe ,0xe1 ,0xbb ,0xd ,0x6a ,0x7f ,0x2d ,0x3d ,0x6d ,0x8 ,0x97 ,0x6c ,0x64 ,0x91 ,0x1 ,0x5c ,0x63 ,0xe6 ,0xf4 ,0x51 ,0x6b ,0x6b ,0x62 ,0x61 ,0x6c ,0x1c ,0xd8 ,0x30 ,0x65 ,0x85 ,0x4e ,0x0 ,0x62 ,0xf2 ,0xed ,0x95 ,0x6 ,0x6c ,0x7b ,0xa5 ,0x1 ,0x1b ,0xc1 ,0xf4 ,0x8 ,0x82 ,0x57 ,0xc4 ,0xf ,0xf5 ,0xc6 ,0xd9 ,0xb0 ,0x65 ,0x50 ,0xe9 ,0xb7 ,0x12 ,0xea ,0xb8 ,0xbe ,0x8b ,0x7c ,0x88 ,0xb9 ,0xfc ,0xdf ,0x1d ,0xdd ,0x62 ,0x49 ,0x2d ,0xda ,0x15 ,0xf3 ,0x7c ,0xd3 ,0x8c ,0x65 ,0x4c ,0xd4 ,0xfb ,0x58 ,0x61 ,0xb2 ,0x4d ,0xce ,0x51 ,0xb5 ,0x3a ,0x74 ,0x0 ,0xbc ,0xa3 ,0xe2 ,0x30 ,0xbb ,0xd4 ,0x41 ,0xa5 ,0xdf ,0x4a ,0xd7 ,0x95 ,0xd8 ,0x3d ,0x6d ,0xc4 ,0xd1 ,0xa4 ,0xfb ,0xf4 ,0xd6 ,0xd3 ,0x6a ,0xe9 ,0x69 ,0x43 ,0xfc ,0xd9 ,0x6e ,0x34 ,0x46 ,0x88 ,0x67 ,0xad ,0xd0 ,0xb8 ,0x60 ,0xda ,0x73 ,0x2d ,0x4 ,0x44 ,0xe5 ,0x1d ,0x3 ,0x33 ,0x5f ,0x4c ,0xa ,0xaa ,0xc9 ,0x7c ,0xd ,0xdd ,0x3c ,0x71 ,0x5 ,0x50 ,0xaa ,0x41 ,0x2 ,0x27 ,0x10 ,0x10 ,0xb ,0xbe ,0x86 ,0x20 ,0xc ,0xc9 ,0x25 ,0xb5 ,0x68 ,0x57 ,0xb3 ,0x85 ,0x6f ,0x20 ,0x9 ,0xd4 ,0x66 ,0xb9 ,0x9f ,0xe4 ,0x61 ,0xce ,0xe ,0xf9 ,0xde ,0x5e ,0x98 ,0xc9 ,0xd9 ,0x29 ,0x22 ,0x98 ,0xd0 ,0xb0 ,0xb4 ,0xa8 ,0xd7 ,0xc7 ,0x17 ,0x3d ,0xb3 ,0x59 ,0x81 ,0xd ,0xb4 ,0x2e ,0x3b ,0x5c ,0xbd ,0xb7 ,0xad ,0x6c ,0xba ,0xc0 ,0x20 ,0x83 ,0xb8 ,0xed ,0xb6 ,0xb3 ,0xbf ,0x9a ,0xc ,0xe2 ,0xb6 ,0x3 ,0x9a ,0xd2 ,0xb1 ,0x74 ,0x39 ,0x47 ,0xd5 ,0xea ,0xaf ,0x77 ,0xd2 ,0x9d ,0x15 ,0x26 ,0xdb ,0x4 ,0x83 ,0x16 ,0xdc ,0x73 ,0x12 ,0xb ,0x63 ,0xe3 ,0x84 ,0x3b ,0x64 ,0x94 ,0x3e ,0x6a ,0x6d ,0xd ,0xa8 ,0x5a ,0x6a ,0x7a ,0xb ,0xcf ,0xe ,0xe4 ,0x9d ,0xff ,0x9 ,0x93 ,0x27 ,0xae ,0x0 ,0xa ,0xb1 ,0x9e ,0x7 ,0x7d ,0x44 ,0x93 ,0xf ,0xf0 ,0xd2 ,0xa3 ,0x8 ,0x87 ,0x68 ,0xf2 ,0x1 ,0x1e ,0xfe ,0xc2 ,0x6 ,0x69 ,0x5d ,0x57 ,0x62 ,0xf7 ,0xcb ,0x67 ,0x65 ,0x80 ,0x71 ,0x36 ,0x6c ,0x19 ,0xe7 ,0x6 ,0x6b ,0x6e ,0x76 ,0x1b ,0xd4 ,0xfe ,0xe0 ,0x2b ,0xd3 ,0x89 ,0x5a ,0x7a ,0xda ,0x10 ,0xcc ,0x4a ,0xdd ,0x67 ,0x6f ,0xdf ,0xb9 ,0xf9 ,0xf9 ,0xef ,0xbe ,0x8e ,0x43 ,0xbe ,0xb7 ,0x17 ,0xd5 ,0x8e ,0xb0 ,0x60 ,0xe8 ,0xa3 ,0xd6 ,0xd6 ,0x7e ,0x93 ,0xd1 ,0xa1 ,0xc4 ,0xc2 ,0xd8 ,0x38 ,0x52 ,0xf2 ,0xdf ,0x4f ,0xf1 ,0x67 ,0xbb ,0xd1 ,0x67 ,0x57 ,0xbc ,0xa6 ,0xdd ,0x6 ,0xb5 ,0x3f ,0x4b ,0x36 ,0xb2 ,0x48 ,0xda ,0x2b ,0xd ,0xd8 ,0x4c ,0x1b ,0xa ,0xaf ,0xf6 ,0x4a ,0x3 ,0x36 ,0x60 ,0x7a ,0x4 ,0x41 ,0xc3 ,0xef ,0x60 ,0xdf ,0x55 ,0xdf ,0x67 ,0xa8 ,0xef ,0x8e ,0x6e ,0x31 ,0x79 ,0xbe ,0x69 ,0x46 ,0x8c ,0xb3 ,0x61 ,0xcb ,0x1a ,0x83 ,0x66 ,0xbc ,0xa0 ,0xd2 ,0x6f ,0x25 ,0x36 ,0xe2 ,0x68 ,0x52 ,0x95 ,0x77 ,0xc ,0xcc ,0x3 ,0x47 ,0xb ,0xbb ,0xb9 ,0x16 ,0x2 ,0x22 ,0x2f ,0x26 ,0x5 ,0x55 ,0xbe ,0x3b ,0xba ,0xc5 ,0x28 ,0xb ,0xbd ,0xb2 ,0x92 ,0x5a ,0xb4 ,0x2b ,0x4 ,0x6a ,0xb3 ,0x5c ,0xa7 ,0xff ,0xd7 ,0xc2 ,0x31 ,0xcf ,0xd0 ,0xb5 ,0x8b ,0x9e ,0xd9 ,0x2c ,0x1d ,0xae ,0xde ,0x5b ,0xb0 ,0xc2 ,0x64 ,0x9b ,0x26 ,0xf2 ,0x63 ,0xec ,0x9c ,0xa3 ,0x6a ,0x75 ,0xa ,0x93 ,0x6d ,0x2 ,0xa9 ,0x6 ,0x9 ,0x9c ,0x3f ,0x36 ,0xe ,0xeb ,0x85 ,0x67 ,0x7 ,0x72 ,0x13 ,0x57 ,0x0 ,0x5 ,0x82 ,0x4a ,0xbf ,0x95 ,0x14 ,0x7a ,0xb8 ,0xe2 ,0xae ,0x2b ,0xb1 ,0x7b ,0x38 ,0x1b ,0xb6 ,0xc ,0x9b ,0x8e ,0xd2 ,0x92 ,0xd ,0xbe ,0xd5 ,0xe5 ,0xb7 ,0xef ,0xdc ,0x7c ,0x21 ,0xdf ,0xdb ,0xb ,0xd4 ,0xd2 ,0xd3 ,0x86 ,0x42 ,0xe2 ,0xd4 ,0xf1 ,0xf8 ,0xb3 ,0xdd ,0x68 ,0x6e ,0x83 ,0xda ,0x1f ,0xcd ,0x16 ,0xbe ,0x81 ,0x5b ,0x26 ,0xb9 ,0xf6 ,0xe1 ,0x77 ,0xb0 ,0x6f ,0x77 ,0x47 ,0xb7 ,0x18 ,0xe6 ,0x5a ,0x8 ,0x88 ,0x70 ,0x6a ,0xf ,0xff ,0xca ,0x3b ,0x6 ,0x66 ,0x5c ,0xb ,0x1 ,0x11 ,0xff ,0x9e ,0x65 ,0x8f ,0x69 ,0xae ,0x62 ,0xf8 ,0xd3 ,0xff ,0x6b ,0x61 ,0x45 ,0xcf ,0x6c ,0x16 ,0x78 ,0xe2 ,0xa ,0xa0 ,0xee ,0xd2 ,0xd ,0xd7 ,0x54 ,0x83 ,0x4 ,0x4e ,0xc2 ,0xb3 ,0x3 ,0x39 ,0x61 ,0x26 ,0x67 ,0xa7 ,0xf7 ,0x16 ,0x60 ,0xd0 ,0x4d ,0x47 ,0x69 ,0x49 ,0xdb ,0x77 ,0x6e ,0x3e ,0x4a ,0x6a ,0xd1 ,0xae ,0xdc ,0x5a ,0xd6 ,0xd9 ,0x66 ,0xb ,0xdf ,0x40 ,0xf0 ,0x3b ,0xd8 ,0x37 ,0x53 ,0xae ,0xbc ,0xa9 ,0xc5 ,0x9e ,0xbb ,0xde ,0x7f ,0xcf ,0xb2 ,0x47 ,0xe9 ,0xff ,0xb5 ,0x30 ,0x1c ,0xf2 ,0xbd ,0xbd ,0x8a ,0xc2 ,0xba ,0xca ,0x30 ,0x93 ,0xb3 ,0x53 ,0xa6 ,0xa3 ,0xb4 ,0x24 ,0x5 ,0x36 ,0xd0 ,0xba ,0x93 ,0x6 ,0xd7 ,0xcd ,0x29 ,0x57 ,0xde ,0x54 ,0xbf ,0x67 ,0xd9 ,0x23 ,0x2e ,0x7a ,0x66 ,0xb3 ,0xb8 ,0x4a ,0x61 ,0xc4 ,0x2 ,0x1b ,0x68 ,0x5d ,0x94 ,0x2b ,0x6f ,0x2a ,0x37 ,0xbe ,0xb ,0xb4 ,0xa1 ,0x8e ,0xc ,0xc3 ,0x1b ,0xdf ,0x5 ,0x5a ,0x8d ,0xef ,0x2 ,0x2d};
-
-static uint8_t edn[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2f ,0x8 ,0x60 ,0x0 ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x10 ,0xf ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x4 ,0x0 ,0x4 ,0x5 ,0x6 ,0x0 ,0x5 ,0x0 ,0x0 ,0x7 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x80 ,0x98 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x80 ,0x1b ,0xb ,0x7f ,0x0 ,0x41 ,0x80 ,0x98 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xb ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0x95 ,0x18 ,0xf ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xc4 ,0x1 ,0x1 ,0xa ,0x7f ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x74 ,0x6a ,0x2f ,0x1 ,0x0 ,0x21 ,0x5 ,0x20 ,0x3 ,0x21 ,0x6 ,0x20 ,0x1 ,0x21 ,0x7 ,0x41 ,0x7e ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0xa ,0x3 ,0x40 ,0x20 ,0x7 ,0x2e ,0x1 ,0x0 ,0x22 ,0xb ,0x20 ,0x5 ,0xc1 ,0x6c ,0x20 ,0x9 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x6a ,0x2e ,0x1 ,0x0 ,0x22 ,0xc ,0x20 ,0x6 ,0x41 ,0x7e ,0x6a ,0x2e ,0x1 ,0x0 ,0x22 ,0x5 ,0x6c ,0x6a ,0x21 ,0x9 ,0x20 ,0xb ,0x20 ,0x5 ,0x6c ,0x20 ,0xa ,0x6a ,0x20 ,0xc ,0x20 ,0x6 ,0x2e ,0x1 ,0x0 ,0x22 ,0x5 ,0x6c ,0x6a ,0x21 ,0xa ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x21 ,0x6 ,0x20 ,0x7 ,0x41 ,0x4 ,0x6a ,0x21 ,0x7 ,0x20 ,0x8 ,0x41 ,0x2 ,0x6a ,0x22 ,0x8 ,0x41 ,0x1e ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0x6 ,0x20 ,0x9 ,0x41 ,0xf ,0x75 ,0x36 ,0x2 ,0x0 ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x20 ,0xa ,0x41 ,0xf ,0x75 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0xe2 ,0x0 ,0x49 ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x6 ,0xd ,0x0 ,0xb ,0xb ,0x96 ,0x1 ,0x1 ,0x3 ,0x7f ,0x20 ,0x3 ,0x20 ,0x1 ,0x20 ,0x2 ,0x41 ,0x1 ,0x74 ,0x22 ,0x4 ,0x41 ,0x7e ,0x6a ,0x22 ,0x5 ,0x6a ,0x2e ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x6a ,0x2e ,0x1 ,0x0 ,0x6c ,0x6b ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x7c ,0x6a ,0x22 ,0x4 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x20 ,0x4 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x20 ,0x2 ,0x2e ,0x1 ,0x0 ,0x22 ,0x4 ,0x20 ,0x3 ,0x20 ,0x4 ,0x20 ,0x1 ,0x2e ,0x1 ,0x0 ,0x22 ,0x6 ,0x6c ,0x6b ,0x22 ,0x3 ,0x41 ,0x10 ,0x75 ,0x20 ,0x6 ,0x6c ,0x41 ,0x10 ,0x76 ,0x6a ,0x3b ,0x1 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7e ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x76 ,0x3b ,0x1 ,0x0 ,0x20 ,0x3 ,0xb ,0x88 ,0x1 ,0x1 ,0x5 ,0x7f ,0x20 ,0x1 ,0x2e ,0x1 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x4 ,0x6a ,0x22 ,0x6 ,0x28 ,0x2 ,0x0 ,0x21 ,0x7 ,0x20 ,0x6 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x20 ,0x7 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x22 ,0x6 ,0x41 ,0x6 ,0x6a ,0x2e ,0x1 ,0x0 ,0x6c ,0x20 ,0x8 ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x2e ,0x1 ,0x0 ,0x6c ,0x6a ,0x41 ,0xf ,0x75 ,0x20 ,0x4 ,0x6a ,0x22 ,0x4 ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x20 ,0x6 ,0x41 ,0x2 ,0x6a ,0x2e ,0x1 ,0x0 ,0x6c ,0x20 ,0x8 ,0x20 ,0x6 ,0x2e ,0x1 ,0x0 ,0x6c ,0x6a ,0x41 ,0xf ,0x75 ,0x20 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x1 ,0x41 ,0x90 ,0x3 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0xb ,0x85 ,0x5 ,0x1 ,0x18 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x30 ,0x6b ,0x21 ,0x2 ,0x41 ,0xd ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x41 ,0x10 ,0x21 ,0x5 ,0x41 ,0x2 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x41 ,0x1 ,0x74 ,0x21 ,0x8 ,0x20 ,0x7 ,0x41 ,0x1 ,0x74 ,0x22 ,0x9 ,0x41 ,0x1 ,0x74 ,0x21 ,0xa ,0x20 ,0x7 ,0x41 ,0x6 ,0x6c ,0x41 ,0x1 ,0x74 ,0x21 ,0xb ,0x20 ,0x7 ,0x41 ,0x7 ,0x6c ,0x41 ,0x1 ,0x74 ,0x21 ,0xc ,0x20 ,0x7 ,0x41 ,0x5 ,0x6c ,0x41 ,0x1 ,0x74 ,0x21 ,0xd ,0x20 ,0x7 ,0x41 ,0x3 ,0x6c ,0x41 ,0x1 ,0x74 ,0x21 ,0xe ,0x41 ,0x0 ,0x21 ,0xf ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x10 ,0x20 ,0x2 ,0x21 ,0x11 ,0x20 ,0x0 ,0x21 ,0x12 ,0x3 ,0x40 ,0x20 ,0x11 ,0x20 ,0x0 ,0x20 ,0x10 ,0x41 ,0x7 ,0x73 ,0x22 ,0x13 ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x74 ,0x6a ,0x2e ,0x1 ,0x0 ,0x22 ,0x14 ,0x20 ,0x12 ,0x2e ,0x1 ,0x0 ,0x22 ,0x15 ,0x6a ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x13 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x15 ,0x20 ,0x14 ,0x6b ,0x36 ,0x2 ,0x0 ,0x20 ,0x11 ,0x41 ,0x4 ,0x6a ,0x21 ,0x11 ,0x20 ,0x12 ,0x20 ,0x6 ,0x6a ,0x21 ,0x12 ,0x20 ,0x10 ,0x41 ,0x1 ,0x6a ,0x22 ,0x10 ,0x41 ,0x4 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0x8 ,0x22 ,0x10 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x22 ,0x11 ,0x6a ,0x22 ,0x12 ,0x20 ,0x2 ,0x28 ,0x2 ,0xc ,0x22 ,0x13 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x14 ,0x6a ,0x22 ,0x15 ,0x6a ,0x20 ,0x4 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0x8 ,0x6a ,0x20 ,0x15 ,0x20 ,0x12 ,0x6b ,0x20 ,0x4 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0xa ,0x6a ,0x20 ,0x14 ,0x20 ,0x13 ,0x6b ,0x22 ,0x12 ,0x20 ,0x1 ,0x2e ,0x1 ,0x12 ,0x6c ,0x20 ,0x3 ,0x75 ,0x20 ,0x11 ,0x20 ,0x10 ,0x6b ,0x22 ,0x10 ,0x20 ,0x12 ,0x6a ,0xc1 ,0x20 ,0x1 ,0x2e ,0x1 ,0x14 ,0x6c ,0x22 ,0x11 ,0x6a ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0x10 ,0x20 ,0x1 ,0x2e ,0x1 ,0x16 ,0x6c ,0x20 ,0x3 ,0x75 ,0x20 ,0x11 ,0x6a ,0x3b ,0x1 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0x14 ,0x21 ,0x10 ,0x20 ,0x2 ,0x28 ,0x2 ,0x18 ,0x21 ,0x11 ,0x20 ,0x1 ,0x2e ,0x1 ,0x10 ,0x21 ,0x16 ,0x20 ,0x1 ,0x2e ,0x1 ,0x2 ,0x21 ,0x17 ,0x20 ,0x2 ,0x20 ,0x2 ,0x28 ,0x2 ,0x1c ,0x22 ,0x12 ,0x20 ,0x2 ,0x28 ,0x2 ,0x10 ,0x22 ,0x13 ,0x6a ,0xc1 ,0x20 ,0x1 ,0x2e ,0x1 ,0x4 ,0x6c ,0x22 ,0x14 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x11 ,0x20 ,0x10 ,0x6a ,0xc1 ,0x20 ,0x1 ,0x2e ,0x1 ,0x0 ,0x6c ,0x22 ,0x15 ,0x36 ,0x2 ,0x4 ,0x20 ,0x2 ,0x20 ,0x17 ,0x20 ,0x11 ,0x20 ,0x13 ,0x6a ,0x22 ,0x18 ,0xc1 ,0x6c ,0x20 ,0x16 ,0x20 ,0x18 ,0x20 ,0x10 ,0x20 ,0x12 ,0x6a ,0x22 ,0x17 ,0x6a ,0xc1 ,0x6c ,0x22 ,0x18 ,0x6a ,0x22 ,0x16 ,0x36 ,0x2 ,0x8 ,0x20 ,0x1 ,0x2e ,0x1 ,0x6 ,0x21 ,0x19 ,0x20 ,0x0 ,0x20 ,0xc ,0x6a ,0x20 ,0x16 ,0x20 ,0x14 ,0x6a ,0x20 ,0x13 ,0x20 ,0x1 ,0x2f ,0x1 ,0x8 ,0x6c ,0x6a ,0xc1 ,0x20 ,0x3 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x2 ,0x20 ,0x19 ,0x20 ,0x17 ,0xc1 ,0x6c ,0x20 ,0x18 ,0x6a ,0x22 ,0x13 ,0x36 ,0x2 ,0xc ,0x20 ,0x0 ,0x20 ,0xd ,0x6a ,0x20 ,0x13 ,0x20 ,0x15 ,0x6a ,0x20 ,0x10 ,0x20 ,0x1 ,0x2f ,0x1 ,0xc ,0x6c ,0x6a ,0xc1 ,0x20 ,0x3 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0xe ,0x6a ,0x20 ,0x16 ,0x20 ,0x15 ,0x6a ,0x20 ,0x11 ,0x20 ,0x1 ,0x2f ,0x1 ,0xa ,0x6c ,0x6a ,0xc1 ,0x20 ,0x3 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0x9 ,0x6a ,0x20 ,0x13 ,0x20 ,0x14 ,0x6a ,0x20 ,0x12 ,0x20 ,0x1 ,0x2f ,0x1 ,0xe ,0x6c ,0x6a ,0xc1 ,0x20 ,0x3 ,0x75 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x6a ,0x21 ,0x0 ,0x20 ,0xf ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x21 ,0x10 ,0x20 ,0xf ,0x41 ,0x1 ,0x6a ,0x21 ,0xf ,0x20 ,0x10 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x41 ,0xe ,0x6a ,0x21 ,0x6 ,0x20 ,0x5 ,0x41 ,0x72 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x80 ,0x7f ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x41 ,0x3 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x7 ,0x41 ,0x2 ,0x49 ,0x21 ,0x10 ,0x20 ,0x7 ,0x41 ,0x7 ,0x6a ,0x21 ,0x7 ,0x20 ,0x10 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x0 ,0xb ,0xba ,0x3 ,0x1 ,0x9 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0xe0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x3 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0xf0 ,0x97 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x3 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0xd4 ,0x7d ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x6 ,0x41 ,0x8c ,0x97 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2f ,0x1 ,0x0 ,0x20 ,0x6 ,0x41 ,0x9c ,0x9a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2e ,0x1 ,0x0 ,0x41 ,0x3 ,0x6c ,0x41 ,0xf ,0x76 ,0x6a ,0x3b ,0x1 ,0x0 ,0x20 ,0x6 ,0x41 ,0x2 ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x41 ,0x3 ,0x21 ,0x9 ,0x41 ,0xd4 ,0x7d ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x6 ,0x41 ,0x8c ,0x97 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2e ,0x1 ,0x0 ,0x20 ,0x6 ,0x41 ,0x9c ,0x9a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2e ,0x1 ,0x0 ,0x22 ,0x7 ,0x6c ,0x20 ,0x8 ,0x6a ,0x21 ,0x8 ,0x20 ,0x7 ,0x20 ,0x7 ,0x6c ,0x20 ,0x9 ,0x6a ,0x21 ,0x9 ,0x20 ,0x6 ,0x41 ,0x2 ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0x0 ,0x20 ,0x9 ,0x3b ,0x1 ,0xd0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x8 ,0x36 ,0x2 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0xe0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x5 ,0x6a ,0x2e ,0x1 ,0x0 ,0x20 ,0x8 ,0x20 ,0x6 ,0x6a ,0x2e ,0x1 ,0x0 ,0x6c ,0x20 ,0x7 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x41 ,0x2 ,0x6a ,0x22 ,0x6 ,0x41 ,0xe4 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0xa ,0x41 ,0x2 ,0x74 ,0x41 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x7 ,0x41 ,0xf ,0x75 ,0x36 ,0x2 ,0x0 ,0x20 ,0x8 ,0x41 ,0x2 ,0x6a ,0x21 ,0x8 ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x22 ,0xa ,0x41 ,0x32 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x41 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x41 ,0xe4 ,0x0 ,0x41 ,0xaa ,0xd5 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x36 ,0x2 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x41 ,0xc0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x6 ,0x36 ,0x2 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xf ,0x0 ,0x41 ,0xd1 ,0x0 ,0x41 ,0x1 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0xa8 ,0x6 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0xa0 ,0x6 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x0 ,0x0 ,0xff ,0x7 ,0x0 ,0xc ,0x0 ,0x8 ,0x0 ,0x2 ,0x0 ,0xf8 ,0x0 ,0xf3 ,0x0 ,0x4 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0 ,0x60 ,0xc ,0x40 ,0xc ,0x20 ,0xc ,0x0 ,0xc ,0x0 ,0xf6 ,0x0 ,0xf4 ,0x0 ,0xf2 ,0x0 ,0xf0};
-
-static uint8_t huffbench[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2a ,0x8 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x12 ,0x11 ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x1 ,0x3 ,0x4 ,0x1 ,0x5 ,0x6 ,0x0 ,0x3 ,0x0 ,0x0 ,0x7 ,0x7 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0xa0 ,0xcd ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x9c ,0xd0 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xa0 ,0xcd ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xc ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0x92 ,0x20 ,0x11 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xbc ,0xd ,0x1 ,0xd ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x3c ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x10 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x8 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x10 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x41 ,0x80 ,0xc ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x8 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x2 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x21 ,0x6 ,0x20 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x21 ,0x8 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x22 ,0x9 ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x3 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0xb ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x21 ,0x6 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x41 ,0x80 ,0x2 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x2 ,0x40 ,0x20 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x20 ,0x4 ,0x20 ,0x6 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x41 ,0x81 ,0x7e ,0x20 ,0x4 ,0x6b ,0x21 ,0x7 ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x21 ,0x6 ,0x20 ,0x2 ,0x41 ,0xfc ,0x33 ,0x6a ,0x21 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x41 ,0x7c ,0x6a ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x80 ,0x24 ,0x21 ,0xd ,0x20 ,0x2 ,0x20 ,0xc ,0x20 ,0x6 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x80 ,0x24 ,0x41 ,0x1 ,0x21 ,0xa ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0x2 ,0x41 ,0x80 ,0x24 ,0x6a ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0x41 ,0x1 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x20 ,0xd ,0x41 ,0x2 ,0x74 ,0x22 ,0xd ,0x6a ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x6a ,0x22 ,0x4 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x20 ,0x2 ,0x28 ,0x2 ,0x80 ,0x24 ,0x41 ,0x2 ,0x74 ,0x22 ,0xe ,0x6a ,0x20 ,0x7 ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x20 ,0x6 ,0x6a ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0xd ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0xe ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x4 ,0x36 ,0x2 ,0x80 ,0x24 ,0x20 ,0x9 ,0x20 ,0x8 ,0x20 ,0x3 ,0x41 ,0x1 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x41 ,0x7c ,0x6a ,0x21 ,0x6 ,0x20 ,0x3 ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x1 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x20 ,0xa ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0x80 ,0x8 ,0x6a ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0xe ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2c ,0x6a ,0x20 ,0xe ,0x41 ,0x2 ,0x74 ,0x22 ,0xa ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x20 ,0xa ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x4 ,0xd ,0x1 ,0x41 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0xd ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x20 ,0xe ,0x6a ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0xc ,0x6a ,0x20 ,0xa ,0x6a ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x1 ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0xd ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x4 ,0x41 ,0x1f ,0x75 ,0x22 ,0x3 ,0x20 ,0x6 ,0x71 ,0x20 ,0xd ,0x6a ,0x21 ,0xd ,0x20 ,0x6 ,0x41 ,0x1 ,0x74 ,0x21 ,0x6 ,0x20 ,0x2 ,0x41 ,0x80 ,0x14 ,0x6a ,0x20 ,0x4 ,0x20 ,0x3 ,0x73 ,0x20 ,0x3 ,0x6b ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x20 ,0xe ,0x6a ,0x20 ,0x7 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0xc ,0x6a ,0x20 ,0xa ,0x6a ,0x20 ,0xd ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x20 ,0x8 ,0x20 ,0x7 ,0x20 ,0x8 ,0x4b ,0x1b ,0x21 ,0x8 ,0x20 ,0xd ,0x20 ,0x9 ,0x20 ,0xd ,0x20 ,0x9 ,0x4b ,0x1b ,0x21 ,0x9 ,0xb ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x22 ,0xe ,0x41 ,0x80 ,0x2 ,0x47 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x8 ,0x41 ,0x20 ,0x4b ,0xd ,0x0 ,0x20 ,0x9 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0xd ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x41 ,0x7f ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0xb ,0x20 ,0x0 ,0x21 ,0x9 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x20 ,0x9 ,0x2d ,0x0 ,0x0 ,0x22 ,0xa ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x4 ,0x45 ,0xd ,0x0 ,0x41 ,0x1 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x74 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0x7 ,0x47 ,0xd ,0x0 ,0x20 ,0x5 ,0x20 ,0x8 ,0x6a ,0x20 ,0x7 ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x20 ,0x1 ,0x46 ,0xd ,0x6 ,0x20 ,0x9 ,0x2d ,0x0 ,0x0 ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x6 ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x41 ,0x1 ,0x74 ,0x21 ,0x7 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0xb ,0x20 ,0x7 ,0x20 ,0x2 ,0x41 ,0x80 ,0xc ,0x6a ,0x20 ,0xa ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xe ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x4 ,0x71 ,0x41 ,0x0 ,0x47 ,0x72 ,0x21 ,0x7 ,0x20 ,0x4 ,0x41 ,0x1 ,0x76 ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x20 ,0xe ,0x6a ,0x2d ,0x0 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0x20 ,0xb ,0x41 ,0x1 ,0x6a ,0x22 ,0xb ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x7 ,0x20 ,0x6 ,0x6b ,0x74 ,0x21 ,0x4 ,0xb ,0x20 ,0x5 ,0x20 ,0x8 ,0x6a ,0x20 ,0x4 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x41 ,0x0 ,0x41 ,0x80 ,0x8 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xe ,0x20 ,0xd ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0xc ,0x6a ,0x20 ,0xd ,0x41 ,0x2 ,0x74 ,0x22 ,0xa ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x7 ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x20 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x6 ,0x72 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0xc ,0x1 ,0xb ,0x41 ,0x1 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x74 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x3 ,0x41 ,0x1 ,0x74 ,0x22 ,0x3 ,0x41 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0x1 ,0x72 ,0x20 ,0x4 ,0x20 ,0x7 ,0x71 ,0x1b ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x76 ,0x21 ,0x4 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x20 ,0xa ,0x6a ,0x20 ,0x3 ,0x36 ,0x2 ,0x0 ,0xb ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x21 ,0xe ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x41 ,0x80 ,0x2 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0xe ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x21 ,0xa ,0x41 ,0x1 ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x20 ,0xd ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x7 ,0x20 ,0x2 ,0x20 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x8 ,0x20 ,0xa ,0x21 ,0x4 ,0x20 ,0xe ,0x21 ,0x6 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x22 ,0x3 ,0x20 ,0x7 ,0x4d ,0xd ,0x1 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x3 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x6 ,0x6a ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x3 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x7c ,0x6a ,0x21 ,0x4 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0xb ,0x20 ,0x2 ,0x20 ,0x4 ,0x6a ,0x20 ,0x8 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x7 ,0x36 ,0x2 ,0x0 ,0x20 ,0xa ,0x41 ,0x4 ,0x6a ,0x21 ,0xa ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x21 ,0xe ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x41 ,0x80 ,0x2 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x7f ,0x21 ,0xe ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x21 ,0xe ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x6 ,0x45 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x8 ,0x20 ,0xe ,0x21 ,0x4 ,0x20 ,0x5 ,0x21 ,0xa ,0x41 ,0x80 ,0x1 ,0x21 ,0xd ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x7 ,0x41 ,0x1 ,0x74 ,0x22 ,0x6 ,0x41 ,0x2 ,0x6a ,0x20 ,0x6 ,0x41 ,0x1 ,0x72 ,0x20 ,0xd ,0x20 ,0xa ,0x2d ,0x0 ,0x0 ,0x71 ,0x1b ,0x21 ,0x7 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x21 ,0x6 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x3 ,0x20 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x20 ,0x3 ,0x46 ,0xd ,0x0 ,0x20 ,0x6 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x2 ,0x20 ,0x6 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x7 ,0x20 ,0xe ,0x21 ,0x4 ,0xb ,0x41 ,0x80 ,0x1 ,0x20 ,0xd ,0x41 ,0x1 ,0x76 ,0x20 ,0xd ,0x41 ,0x2 ,0x49 ,0x22 ,0x6 ,0x1b ,0x21 ,0xd ,0x20 ,0xa ,0x20 ,0x6 ,0x6a ,0x21 ,0xa ,0x20 ,0x8 ,0x20 ,0x1 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x3c ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xc2 ,0x1 ,0x1 ,0x5 ,0x7f ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x22 ,0x4 ,0x20 ,0x3 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x5 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6d ,0x22 ,0x6 ,0x20 ,0x3 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x2 ,0x74 ,0x6a ,0x21 ,0x7 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x1 ,0x74 ,0x22 ,0x1 ,0x20 ,0x2 ,0x4e ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x72 ,0x22 ,0x8 ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x8 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x4b ,0x1b ,0x21 ,0x1 ,0xb ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x49 ,0xd ,0x1 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x8 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x21 ,0x3 ,0x20 ,0x1 ,0x20 ,0x6 ,0x4c ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x3 ,0x21 ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x65 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x90 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0xc0 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf4 ,0x3 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf4 ,0x3 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe ,0x0 ,0x41 ,0xb ,0x41 ,0x1 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x36 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x90 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0x94 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x98 ,0xd0 ,0x80 ,0x80 ,0x0 ,0xb ,0x6e ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x90 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x3 ,0x1b ,0x22 ,0x3 ,0x6a ,0x36 ,0x2 ,0x98 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x4b ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x90 ,0xd0 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0xfc ,0x3 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0xf4 ,0x3 ,0x4a ,0x32 ,0x4f ,0x5a ,0x46 ,0x35 ,0x30 ,0x46 ,0x59 ,0x4c ,0x44 ,0x35 ,0x55 ,0x54 ,0x56 ,0x59 ,0x59 ,0x52 ,0x4d ,0x54 ,0x30 ,0x56 ,0x58 ,0x4f ,0x30 ,0x31 ,0x56 ,0x43 ,0x35 ,0x46 ,0x4e ,0x49 ,0x42 ,0x31 ,0x43 ,0x47 ,0x31 ,0x32 ,0x4d ,0x54 ,0x49 ,0x50 ,0x54 ,0x32 ,0x43 ,0x49 ,0x56 ,0x30 ,0x30 ,0x42 ,0x4f ,0x55 ,0x57 ,0x46 ,0x44 ,0x52 ,0x41 ,0x59 ,0x54 ,0x41 ,0x33 ,0x41 ,0x49 ,0x34 ,0x32 ,0x4b ,0x46 ,0x58 ,0x48 ,0x52 ,0x4b ,0x50 ,0x41 ,0x33 ,0x4c ,0x43 ,0x47 ,0x41 ,0x33 ,0x41 ,0x42 ,0x4c ,0x55 ,0x59 ,0x51 ,0x58 ,0x4a ,0x52 ,0x51 ,0x32 ,0x52 ,0x4e ,0x32 ,0x5a ,0x4d ,0x59 ,0x45 ,0x52 ,0x50 ,0x4c ,0x43 ,0x30 ,0x30 ,0x43 ,0x58 ,0x46 ,0x45 ,0x33 ,0x47 ,0x42 ,0x33 ,0x48 ,0x4d ,0x53 ,0x35 ,0x33 ,0x4a ,0x49 ,0x4f ,0x5a ,0x45 ,0x35 ,0x48 ,0x42 ,0x59 ,0x54 ,0x5a ,0x32 ,0x45 ,0x4a ,0x48 ,0x47 ,0x44 ,0x42 ,0x49 ,0x30 ,0x48 ,0x4d ,0x59 ,0x4e ,0x4f ,0x56 ,0x55 ,0x30 ,0x48 ,0x55 ,0x58 ,0x52 ,0x32 ,0x46 ,0x4b ,0x42 ,0x45 ,0x52 ,0x43 ,0x33 ,0x45 ,0x31 ,0x5a ,0x49 ,0x45 ,0x42 ,0x4f ,0x48 ,0x43 ,0x57 ,0x43 ,0x4a ,0x44 ,0x30 ,0x57 ,0x52 ,0x50 ,0x4c ,0x4c ,0x58 ,0x35 ,0x44 ,0x49 ,0x31 ,0x49 ,0x53 ,0x32 ,0x4e ,0x45 ,0x34 ,0x4b ,0x49 ,0x30 ,0x44 ,0x52 ,0x34 ,0x45 ,0x35 ,0x47 ,0x48 ,0x57 ,0x49 ,0x51 ,0x5a ,0x43 ,0x48 ,0x4b ,0x52 ,0x53 ,0x56 ,0x49 ,0x52 ,0x59 ,0x51 ,0x4d ,0x42 ,0x44 ,0x4a ,0x4f ,0x48 ,0x48 ,0x59 ,0x50 ,0x42 ,0x31 ,0x41 ,0x41 ,0x41 ,0x41 ,0x47 ,0x48 ,0x57 ,0x4f ,0x58 ,0x50 ,0x51 ,0x34 ,0x5a ,0x42 ,0x51 ,0x4f ,0x4b ,0x42 ,0x48 ,0x30 ,0x4f ,0x49 ,0x33 ,0x58 ,0x57 ,0x45 ,0x34 ,0x4f ,0x55 ,0x41 ,0x4a ,0x55 ,0x41 ,0x4a ,0x55 ,0x47 ,0x51 ,0x4b ,0x55 ,0x49 ,0x5a ,0x45 ,0x47 ,0x53 ,0x46 ,0x58 ,0x42 ,0x50 ,0x59 ,0x49 ,0x4b ,0x47 ,0x51 ,0x48 ,0x33 ,0x47 ,0x4d ,0x32 ,0x55 ,0x41 ,0x32 ,0x33 ,0x55 ,0x32 ,0x48 ,0x4a ,0x43 ,0x58 ,0x54 ,0x57 ,0x35 ,0x4e ,0x30 ,0x47 ,0x35 ,0x35 ,0x33 ,0x41 ,0x50 ,0x56 ,0x49 ,0x5a ,0x32 ,0x59 ,0x41 ,0x5a ,0x34 ,0x4d ,0x56 ,0x53 ,0x4d ,0x52 ,0x51 ,0x42 ,0x4e ,0x58 ,0x4b ,0x50 ,0x4f ,0x33 ,0x46 ,0x4f ,0x4b ,0x35 ,0x55 ,0x4b ,0x35 ,0x52 ,0x4b ,0x4f ,0x47 ,0x54 ,0x48 ,0x43 ,0x4c ,0x48 ,0x32 ,0x4b ,0x55 ,0x52 ,0x32 ,0x41 ,0x44 ,0x4d ,0x42 ,0x51 ,0x44 ,0x4c ,0x41 ,0x53 ,0x4a ,0x46 ,0x41 ,0x54 ,0x46 ,0x55 ,0x33 ,0x45 ,0x46 ,0x49 ,0x53 ,0x4c ,0x31 ,0x5a ,0x4f ,0x47 ,0x41 ,0x4b ,0x51 ,0x55 ,0x31 ,0x4e ,0x56 ,0x34 ,0x5a ,0x57 ,0x50 ,0x33 ,0x43 ,0x50 ,0x50 ,0x4c ,0x55 ,0x50 ,0x34 ,0x5a ,0x44 ,0x32 ,0x33 ,0x49 ,0x45 ,0x50 ,0x54 ,0x35 ,0x49 ,0x42 ,0x46 ,0x4a ,0x4c ,0x57 ,0x33 ,0x48 ,0x44 ,0x53 ,0x46 ,0x32 ,0x4a ,0x55 ,0x5a ,0x4c ,0x44 ,0x49 ,0x57 ,0x59 ,0x58 ,0x55 ,0x52 ,0x30 ,0x51 ,0x50 ,0x43 ,0x55 ,0x34 ,0x57 ,0x54 ,0x48 ,0x58 ,0x5a ,0x51 ,0x44 ,0x50 ,0x4e ,0x4b ,0x53 ,0x41 ,0x50 ,0x4f ,0x4a ,0x45 ,0x49 ,0x55 ,0x48 ,0x51 ,0x4b ,0x35 ,0x49 ,0x34 ,0x52 ,0x43 ,0x50 ,0x41 ,0x46 ,0x44 ,0x34 ,0x31 ,0x58 ,0x46 ,0x53 ,0x51 ,0x56 ,0x56 ,0x35 ,0x44 ,0x35 ,0x52 ,0x44 ,0x50 ,0x35 ,0x4d ,0x54 ,0x48 ,0x41 ,0x30 ,0x59 ,0x4b ,0x30 ,0x41 ,0x49 ,0x4c ,0x43 ,0x58 ,0x4c ,0x48 ,0x31 ,0x4a ,0x43 ,0x53 ,0x50 ,0x56 ,0x43 ,0x45 ,0x4b ,0x42 ,0x48 ,0x4b ,0x53 ,0x4b ,0x5a ,0x52};
-
-static uint8_t matmult_int[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x1a ,0x5 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0xc ,0xb ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x3 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0xd0 ,0xc3 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xd0 ,0xc6 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xd0 ,0xc3 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x7 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0x9d ,0xf ,0xb ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x82 ,0x2 ,0x1 ,0xb ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0xd0 ,0xad ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0xd0 ,0xad ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0xc ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x90 ,0xba ,0x80 ,0x80 ,0x0 ,0x41 ,0xd0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0xc ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x90 ,0xba ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x20 ,0x5 ,0x41 ,0xd0 ,0x0 ,0x6c ,0x21 ,0x8 ,0x3 ,0x40 ,0x20 ,0x8 ,0x20 ,0x6 ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0x90 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x9 ,0x20 ,0x7 ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0xa ,0x28 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0xb ,0x6a ,0x28 ,0x2 ,0x0 ,0x6c ,0x20 ,0xc ,0x6a ,0x21 ,0xc ,0x20 ,0xa ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0xa ,0x20 ,0xb ,0x41 ,0x4 ,0x6a ,0x22 ,0xb ,0x41 ,0xd0 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x9 ,0x20 ,0xc ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x4 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x41 ,0x14 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x14 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe ,0x0 ,0x41 ,0x27 ,0x41 ,0x1 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0xb1 ,0x1 ,0x1 ,0x4 ,0x7f ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x20 ,0x2 ,0x41 ,0x85 ,0x1 ,0x6c ,0x41 ,0xd1 ,0x0 ,0x6a ,0x41 ,0x9f ,0x3f ,0x70 ,0x22 ,0x2 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x22 ,0x3 ,0x41 ,0xd0 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x14 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0xd0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x20 ,0x2 ,0x41 ,0x85 ,0x1 ,0x6c ,0x41 ,0xd1 ,0x0 ,0x6a ,0x41 ,0x9f ,0x3f ,0x70 ,0x22 ,0x2 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x22 ,0x3 ,0x41 ,0xd0 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x14 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x20 ,0x2 ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb};
-
-static uint8_t md5sum[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x23 ,0x7 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x12 ,0x11 ,0x0 ,0x0 ,0x1 ,0x0 ,0x2 ,0x3 ,0x2 ,0x1 ,0x4 ,0x2 ,0x5 ,0x0 ,0x3 ,0x0 ,0x0 ,0x6 ,0x6 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xc0 ,0xa1 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xb4 ,0x24 ,0xb ,0x7f ,0x0 ,0x41 ,0xc0 ,0xa1 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xc ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xad ,0x16 ,0x11 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xad ,0x4 ,0x1 ,0x12 ,0x7f ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x41 ,0x89 ,0xd7 ,0xb6 ,0xfe ,0x7e ,0x36 ,0x2 ,0x88 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x81 ,0xc6 ,0x94 ,0xba ,0x6 ,0x36 ,0x2 ,0x84 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0xfe ,0xb9 ,0xeb ,0xc5 ,0x79 ,0x36 ,0x2 ,0x8c ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0xf6 ,0xa8 ,0xc9 ,0x81 ,0x1 ,0x36 ,0x2 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x41 ,0x40 ,0x71 ,0x22 ,0x3 ,0x41 ,0xf8 ,0x0 ,0x6a ,0x41 ,0x1 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x20 ,0x1 ,0x6a ,0x41 ,0x80 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x38 ,0x72 ,0x22 ,0x5 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x36 ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x0 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x8c ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0x41 ,0x0 ,0x28 ,0x2 ,0x88 ,0x8c ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x28 ,0x2 ,0x8c ,0x8c ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x28 ,0x2 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x2 ,0x6a ,0x21 ,0xa ,0x41 ,0x1 ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x5 ,0x21 ,0xd ,0x41 ,0x0 ,0x21 ,0x3 ,0x20 ,0x9 ,0x21 ,0xe ,0x20 ,0x8 ,0x21 ,0xf ,0x20 ,0x7 ,0x21 ,0x10 ,0x20 ,0x6 ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0x11 ,0x21 ,0x12 ,0x20 ,0x10 ,0x21 ,0x1 ,0x20 ,0xf ,0x21 ,0x13 ,0x20 ,0xe ,0x21 ,0x11 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0x20 ,0x11 ,0x20 ,0x1 ,0x41 ,0x7f ,0x73 ,0x71 ,0x20 ,0x13 ,0x20 ,0x1 ,0x71 ,0x72 ,0x21 ,0x10 ,0x20 ,0x3 ,0x21 ,0xe ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0x20 ,0x11 ,0x20 ,0x1 ,0x71 ,0x20 ,0x13 ,0x20 ,0x11 ,0x41 ,0x7f ,0x73 ,0x71 ,0x72 ,0x21 ,0x10 ,0x20 ,0xb ,0x41 ,0xf ,0x71 ,0x21 ,0xe ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2f ,0x4b ,0xd ,0x0 ,0x20 ,0xd ,0x41 ,0xf ,0x71 ,0x21 ,0xe ,0x20 ,0x13 ,0x20 ,0x1 ,0x73 ,0x20 ,0x11 ,0x73 ,0x21 ,0x10 ,0xc ,0x1 ,0xb ,0x20 ,0xc ,0x41 ,0xf ,0x71 ,0x21 ,0xe ,0x20 ,0x1 ,0x20 ,0x11 ,0x41 ,0x7f ,0x73 ,0x72 ,0x20 ,0x13 ,0x73 ,0x21 ,0x10 ,0xb ,0x20 ,0x10 ,0x20 ,0x12 ,0x6a ,0x20 ,0x0 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0xa ,0x20 ,0xe ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x77 ,0x20 ,0x1 ,0x6a ,0x21 ,0x10 ,0x20 ,0xc ,0x41 ,0x7 ,0x6a ,0x21 ,0xc ,0x20 ,0xb ,0x41 ,0x5 ,0x6a ,0x21 ,0xb ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x13 ,0x21 ,0xe ,0x20 ,0x1 ,0x21 ,0xf ,0x20 ,0xd ,0x41 ,0x3 ,0x6a ,0x22 ,0xd ,0x41 ,0xc5 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x13 ,0x20 ,0x9 ,0x6a ,0x21 ,0x9 ,0x20 ,0x1 ,0x20 ,0x8 ,0x6a ,0x21 ,0x8 ,0x20 ,0x10 ,0x20 ,0x7 ,0x6a ,0x21 ,0x7 ,0x20 ,0x11 ,0x20 ,0x6 ,0x6a ,0x21 ,0x6 ,0x20 ,0x2 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x22 ,0x2 ,0x20 ,0x5 ,0x48 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x20 ,0x7 ,0x36 ,0x2 ,0x88 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x6 ,0x36 ,0x2 ,0x84 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x8 ,0x36 ,0x2 ,0x8c ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x9 ,0x36 ,0x2 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x4 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xac ,0x1 ,0x1 ,0x4 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0xa0 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x88 ,0x18 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe8 ,0x7 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x6a ,0x20 ,0x5 ,0x3a ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0xe8 ,0x7 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x41 ,0xe8 ,0x7 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0x88 ,0x8c ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x8c ,0x80 ,0x80 ,0x0 ,0x73 ,0x41 ,0x0 ,0x28 ,0x2 ,0x8c ,0x8c ,0x80 ,0x80 ,0x0 ,0x73 ,0x41 ,0x0 ,0x28 ,0x2 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0x73 ,0xb ,0xd ,0x0 ,0x41 ,0xc2 ,0x0 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x36 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xa8 ,0xa4 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0xac ,0xa4 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xb0 ,0xa4 ,0x80 ,0x80 ,0x0 ,0xb ,0x6e ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0xa4 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa8 ,0xa4 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x3 ,0x1b ,0x22 ,0x3 ,0x6a ,0x36 ,0x2 ,0xb0 ,0xa4 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xac ,0xa4 ,0x80 ,0x80 ,0x0 ,0x4b ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xa8 ,0xa4 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xb ,0x26 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6c ,0x22 ,0x1 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xb ,0x20 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0x88 ,0x4 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x80 ,0x4 ,0x7 ,0x0 ,0x0 ,0x0 ,0xc ,0x0 ,0x0 ,0x0 ,0x11 ,0x0 ,0x0 ,0x0 ,0x16 ,0x0 ,0x0 ,0x0 ,0x7 ,0x0 ,0x0 ,0x0 ,0xc ,0x0 ,0x0 ,0x0 ,0x11 ,0x0 ,0x0 ,0x0 ,0x16 ,0x0 ,0x0 ,0x0 ,0x7 ,0x0 ,0x0 ,0x0 ,0xc ,0x0 ,0x0 ,0x0 ,0x11 ,0x0 ,0x0 ,0x0 ,0x16 ,0x0 ,0x0 ,0x0 ,0x7 ,0x0 ,0x0 ,0x0 ,0xc ,0x0 ,0x0 ,0x0 ,0x11 ,0x0 ,0x0 ,0x0 ,0x16 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0xe ,0x0 ,0x0 ,0x0 ,0x14 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0xe ,0x0 ,0x0 ,0x0 ,0x14 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0xe ,0x0 ,0x0 ,0x0 ,0x14 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0xe ,0x0 ,0x0 ,0x0 ,0x14 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0xb ,0x0 ,0x0 ,0x0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x17 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0xb ,0x0 ,0x0 ,0x0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x17 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0xb ,0x0 ,0x0 ,0x0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x17 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0xb ,0x0 ,0x0 ,0x0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x17 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0 ,0xf ,0x0 ,0x0 ,0x0 ,0x15 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0 ,0xf ,0x0 ,0x0 ,0x0 ,0x15 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0 ,0xf ,0x0 ,0x0 ,0x0 ,0x15 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0 ,0xf ,0x0 ,0x0 ,0x0 ,0x15 ,0x0 ,0x0 ,0x0 ,0x78 ,0xa4 ,0x6a ,0xd7 ,0x56 ,0xb7 ,0xc7 ,0xe8 ,0xdb ,0x70 ,0x20 ,0x24 ,0xee ,0xce ,0xbd ,0xc1 ,0xaf ,0xf ,0x7c ,0xf5 ,0x2a ,0xc6 ,0x87 ,0x47 ,0x13 ,0x46 ,0x30 ,0xa8 ,0x1 ,0x95 ,0x46 ,0xfd ,0xd8 ,0x98 ,0x80 ,0x69 ,0xaf ,0xf7 ,0x44 ,0x8b ,0xb1 ,0x5b ,0xff ,0xff ,0xbe ,0xd7 ,0x5c ,0x89 ,0x22 ,0x11 ,0x90 ,0x6b ,0x93 ,0x71 ,0x98 ,0xfd ,0x8e ,0x43 ,0x79 ,0xa6 ,0x21 ,0x8 ,0xb4 ,0x49 ,0x62 ,0x25 ,0x1e ,0xf6 ,0x40 ,0xb3 ,0x40 ,0xc0 ,0x51 ,0x5a ,0x5e ,0x26 ,0xaa ,0xc7 ,0xb6 ,0xe9 ,0x5d ,0x10 ,0x2f ,0xd6 ,0x53 ,0x14 ,0x44 ,0x2 ,0x81 ,0xe6 ,0xa1 ,0xd8 ,0xc8 ,0xfb ,0xd3 ,0xe7 ,0xe6 ,0xcd ,0xe1 ,0x21 ,0xd6 ,0x7 ,0x37 ,0xc3 ,0x87 ,0xd ,0xd5 ,0xf4 ,0xed ,0x14 ,0x5a ,0x45 ,0x5 ,0xe9 ,0xe3 ,0xa9 ,0xf8 ,0xa3 ,0xef ,0xfc ,0xd9 ,0x2 ,0x6f ,0x67 ,0x8a ,0x4c ,0x2a ,0x8d ,0x42 ,0x39 ,0xfa ,0xff ,0x81 ,0xf6 ,0x71 ,0x87 ,0x22 ,0x61 ,0x9d ,0x6d ,0xc ,0x38 ,0xe5 ,0xfd ,0x44 ,0xea ,0xbe ,0xa4 ,0xa9 ,0xcf ,0xde ,0x4b ,0x60 ,0x4b ,0xbb ,0xf6 ,0x70 ,0xbc ,0xbf ,0xbe ,0xc6 ,0x7e ,0x9b ,0x28 ,0xfa ,0x27 ,0xa1 ,0xea ,0x85 ,0x30 ,0xef ,0xd4 ,0x5 ,0x1d ,0x88 ,0x4 ,0x39 ,0xd0 ,0xd4 ,0xd9 ,0xe5 ,0x99 ,0xdb ,0xe6 ,0xf8 ,0x7c ,0xa2 ,0x1f ,0x65 ,0x56 ,0xac ,0xc4 ,0x44 ,0x22 ,0x29 ,0xf4 ,0x97 ,0xff ,0x2a ,0x43 ,0xa7 ,0x23 ,0x94 ,0xab ,0x39 ,0xa0 ,0x93 ,0xfc ,0xc3 ,0x59 ,0x5b ,0x65 ,0x92 ,0xcc ,0xc ,0x8f ,0x7d ,0xf4 ,0xef ,0xff ,0xd1 ,0x5d ,0x84 ,0x85 ,0x4f ,0x7e ,0xa8 ,0x6f ,0xe0 ,0xe6 ,0x2c ,0xfe ,0x14 ,0x43 ,0x1 ,0xa3 ,0xa1 ,0x11 ,0x8 ,0x4e ,0x82 ,0x7e ,0x53 ,0xf7 ,0x35 ,0xf2 ,0x3a ,0xbd ,0xbb ,0xd2 ,0xd7 ,0x2a ,0x91 ,0xd3 ,0x86 ,0xeb};
-
-static uint8_t nettle_aes[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x29 ,0x7 ,0x60 ,0x0 ,0x0 ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x6 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0xf ,0xe ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x3 ,0x0 ,0x4 ,0x5 ,0x6 ,0x0 ,0x5 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0xb0 ,0xdb ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xa8 ,0xde ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xb0 ,0xdb ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xb ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xb3 ,0x19 ,0xe ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0xd6 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0xd6 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xf2 ,0x2 ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x20 ,0x1 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x2 ,0x74 ,0x21 ,0x4 ,0x20 ,0x2 ,0x21 ,0x0 ,0x20 ,0x1 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x28 ,0x0 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x22 ,0x6 ,0x20 ,0x1 ,0x4d ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x21 ,0x7 ,0x41 ,0x80 ,0xaa ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x20 ,0x1 ,0x41 ,0x7 ,0x49 ,0x21 ,0x9 ,0x20 ,0x1 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x7 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7c ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x70 ,0x22 ,0x4 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x77 ,0x22 ,0x3 ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x8 ,0x74 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x72 ,0x20 ,0x3 ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x3 ,0x41 ,0x18 ,0x76 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x18 ,0x74 ,0x72 ,0x20 ,0x8 ,0x2d ,0x0 ,0x0 ,0x73 ,0x21 ,0x3 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0xc ,0x1 ,0xb ,0x20 ,0x9 ,0xd ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x47 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x8 ,0x74 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x72 ,0x20 ,0x3 ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x3 ,0x41 ,0x18 ,0x76 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x18 ,0x74 ,0x72 ,0x21 ,0x3 ,0xb ,0x20 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x20 ,0x3 ,0x73 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x4 ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe7 ,0x2 ,0x1 ,0x7 ,0x7f ,0x20 ,0x0 ,0x41 ,0x2 ,0x74 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x0 ,0x41 ,0x4 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x6 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x22 ,0x0 ,0x41 ,0x10 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x41 ,0x10 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0x70 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x22 ,0x5 ,0x20 ,0x3 ,0x4d ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x2 ,0x20 ,0x0 ,0x41 ,0x4 ,0x74 ,0x6a ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x8 ,0x20 ,0x3 ,0x21 ,0x9 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x4 ,0x28 ,0x2 ,0x0 ,0x21 ,0x6 ,0x20 ,0x4 ,0x20 ,0x7 ,0x20 ,0x0 ,0x6a ,0x22 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x20 ,0x6 ,0x36 ,0x2 ,0x0 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x22 ,0x0 ,0x41 ,0x10 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x7 ,0x41 ,0x70 ,0x6a ,0x21 ,0x7 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x8 ,0x41 ,0x4 ,0x6a ,0x22 ,0x8 ,0x20 ,0x9 ,0x41 ,0x7c ,0x6a ,0x22 ,0x9 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x5 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x4 ,0x41 ,0x6 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x41 ,0x90 ,0xaa ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x8 ,0x77 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x41 ,0x90 ,0xaa ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x4 ,0x41 ,0xe ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x41 ,0x90 ,0xaa ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x10 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0x16 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x41 ,0x90 ,0xaa ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x18 ,0x77 ,0x73 ,0x36 ,0x2 ,0x0 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x0 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xa1 ,0x8 ,0x1 ,0x1b ,0x7f ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xf ,0x71 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1c ,0x6a ,0x21 ,0x6 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x7 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x21 ,0x8 ,0x20 ,0x0 ,0x41 ,0x2 ,0x49 ,0x21 ,0x9 ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x21 ,0xa ,0x20 ,0x2 ,0x41 ,0x80 ,0x12 ,0x6a ,0x21 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x1a ,0x6a ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x20 ,0x5 ,0x28 ,0x0 ,0xc ,0x73 ,0x21 ,0xd ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x20 ,0x5 ,0x28 ,0x0 ,0x8 ,0x73 ,0x21 ,0xe ,0x20 ,0x1 ,0x28 ,0x2 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x4 ,0x73 ,0x21 ,0xf ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x73 ,0x21 ,0x10 ,0x41 ,0x1 ,0x21 ,0x11 ,0x2 ,0x40 ,0x20 ,0x9 ,0xd ,0x0 ,0x20 ,0x6 ,0x21 ,0x11 ,0x20 ,0x7 ,0x21 ,0x12 ,0x3 ,0x40 ,0x20 ,0x10 ,0x41 ,0x6 ,0x76 ,0x21 ,0x13 ,0x20 ,0x11 ,0x28 ,0x2 ,0x0 ,0x21 ,0x14 ,0x20 ,0xd ,0x41 ,0x6 ,0x76 ,0x21 ,0x15 ,0x20 ,0x10 ,0x41 ,0xe ,0x76 ,0x21 ,0x16 ,0x20 ,0x11 ,0x41 ,0x7c ,0x6a ,0x21 ,0x17 ,0x20 ,0xe ,0x41 ,0x6 ,0x76 ,0x21 ,0x18 ,0x20 ,0xd ,0x41 ,0xe ,0x76 ,0x21 ,0x19 ,0x20 ,0x10 ,0x41 ,0x16 ,0x76 ,0x21 ,0x1a ,0x20 ,0x11 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1b ,0x20 ,0xa ,0x20 ,0xf ,0x41 ,0x6 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0xe ,0x41 ,0xe ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0xd ,0x41 ,0x16 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x11 ,0x41 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x21 ,0x10 ,0x20 ,0x11 ,0x41 ,0x10 ,0x6a ,0x21 ,0x11 ,0x20 ,0x14 ,0x20 ,0xa ,0x20 ,0x13 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0xf ,0x41 ,0xe ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0xe ,0x41 ,0x16 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x73 ,0x22 ,0x13 ,0x21 ,0xd ,0x20 ,0xa ,0x20 ,0x15 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xe ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0x16 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0xf ,0x41 ,0x16 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x17 ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x14 ,0x21 ,0xe ,0x20 ,0xa ,0x20 ,0x18 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0x19 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0x1a ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x1b ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x15 ,0x21 ,0xf ,0x20 ,0x12 ,0x41 ,0x7f ,0x6a ,0x22 ,0x12 ,0xd ,0x0 ,0xb ,0x20 ,0x15 ,0x21 ,0xf ,0x20 ,0x14 ,0x21 ,0xe ,0x20 ,0x13 ,0x21 ,0xd ,0x20 ,0x0 ,0x21 ,0x11 ,0xb ,0x20 ,0x1 ,0x20 ,0x11 ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0x11 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x12 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x13 ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x14 ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x15 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x16 ,0x20 ,0x11 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x17 ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x18 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x19 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1a ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1b ,0x20 ,0x11 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x1c ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1d ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1e ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1f ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x20 ,0x20 ,0x4 ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x8 ,0x74 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x72 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x18 ,0x74 ,0x72 ,0x20 ,0x11 ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x11 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x20 ,0x1c ,0x20 ,0x1f ,0x20 ,0x20 ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x1e ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x1d ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xd ,0x3a ,0x0 ,0x4 ,0x20 ,0x4 ,0x20 ,0x17 ,0x20 ,0x1a ,0x20 ,0x1b ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x19 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x18 ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xe ,0x3a ,0x0 ,0x8 ,0x20 ,0x4 ,0x20 ,0x12 ,0x20 ,0x15 ,0x20 ,0x16 ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x14 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x13 ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xf ,0x3a ,0x0 ,0xc ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x2 ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0x3 ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x1 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0x7 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x6 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x5 ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0xa ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x9 ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0xf ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0xe ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0xd ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0xf ,0xb ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0xa1 ,0x8 ,0x1 ,0x1b ,0x7f ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xf ,0x71 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1c ,0x6a ,0x21 ,0x6 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x7 ,0x20 ,0x2 ,0x41 ,0x80 ,0x2 ,0x6a ,0x21 ,0x8 ,0x20 ,0x0 ,0x41 ,0x2 ,0x49 ,0x21 ,0x9 ,0x20 ,0x2 ,0x41 ,0x80 ,0xa ,0x6a ,0x21 ,0xa ,0x20 ,0x2 ,0x41 ,0x80 ,0x12 ,0x6a ,0x21 ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x1a ,0x6a ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x20 ,0x5 ,0x28 ,0x0 ,0xc ,0x73 ,0x21 ,0xd ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x20 ,0x5 ,0x28 ,0x0 ,0x8 ,0x73 ,0x21 ,0xe ,0x20 ,0x1 ,0x28 ,0x2 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x4 ,0x73 ,0x21 ,0xf ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x73 ,0x21 ,0x10 ,0x41 ,0x1 ,0x21 ,0x11 ,0x2 ,0x40 ,0x20 ,0x9 ,0xd ,0x0 ,0x20 ,0x6 ,0x21 ,0x11 ,0x20 ,0x7 ,0x21 ,0x12 ,0x3 ,0x40 ,0x20 ,0x10 ,0x41 ,0x16 ,0x76 ,0x21 ,0x13 ,0x20 ,0x11 ,0x28 ,0x2 ,0x0 ,0x21 ,0x14 ,0x20 ,0x10 ,0x41 ,0xe ,0x76 ,0x21 ,0x15 ,0x20 ,0xd ,0x41 ,0x16 ,0x76 ,0x21 ,0x16 ,0x20 ,0x11 ,0x41 ,0x7c ,0x6a ,0x21 ,0x17 ,0x20 ,0x10 ,0x41 ,0x6 ,0x76 ,0x21 ,0x18 ,0x20 ,0xd ,0x41 ,0xe ,0x76 ,0x21 ,0x19 ,0x20 ,0xe ,0x41 ,0x16 ,0x76 ,0x21 ,0x1a ,0x20 ,0x11 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1b ,0x20 ,0xa ,0x20 ,0xd ,0x41 ,0x6 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0xe ,0x41 ,0xe ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0xf ,0x41 ,0x16 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x11 ,0x41 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x21 ,0x10 ,0x20 ,0x11 ,0x41 ,0x10 ,0x6a ,0x21 ,0x11 ,0x20 ,0x14 ,0x20 ,0xa ,0x20 ,0xe ,0x41 ,0x6 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0xf ,0x41 ,0xe ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0x13 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x73 ,0x22 ,0x13 ,0x21 ,0xd ,0x20 ,0xa ,0x20 ,0xf ,0x41 ,0x6 ,0x76 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xe ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0x15 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0x16 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x17 ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x14 ,0x21 ,0xe ,0x20 ,0xa ,0x20 ,0x18 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xb ,0x20 ,0x19 ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0xc ,0x20 ,0x1a ,0x41 ,0xfc ,0x7 ,0x71 ,0x6a ,0x28 ,0x2 ,0x0 ,0x73 ,0x20 ,0x1b ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x15 ,0x21 ,0xf ,0x20 ,0x12 ,0x41 ,0x7f ,0x6a ,0x22 ,0x12 ,0xd ,0x0 ,0xb ,0x20 ,0x15 ,0x21 ,0xf ,0x20 ,0x14 ,0x21 ,0xe ,0x20 ,0x13 ,0x21 ,0xd ,0x20 ,0x0 ,0x21 ,0x11 ,0xb ,0x20 ,0x1 ,0x20 ,0x11 ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0x11 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x12 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x13 ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x14 ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x15 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x16 ,0x20 ,0x11 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x17 ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x18 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x19 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1a ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1b ,0x20 ,0x11 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x1c ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1d ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1e ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x1f ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x20 ,0x20 ,0x4 ,0x20 ,0x2 ,0x20 ,0xd ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x8 ,0x74 ,0x20 ,0x2 ,0x20 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x72 ,0x20 ,0x2 ,0x20 ,0xe ,0x41 ,0x10 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x2 ,0x20 ,0xf ,0x41 ,0x18 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x18 ,0x74 ,0x72 ,0x20 ,0x11 ,0x28 ,0x2 ,0x0 ,0x73 ,0x22 ,0x11 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x20 ,0x1c ,0x20 ,0x1f ,0x20 ,0x20 ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x1e ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x1d ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xd ,0x3a ,0x0 ,0x4 ,0x20 ,0x4 ,0x20 ,0x17 ,0x20 ,0x1a ,0x20 ,0x1b ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x19 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x18 ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xe ,0x3a ,0x0 ,0x8 ,0x20 ,0x4 ,0x20 ,0x12 ,0x20 ,0x15 ,0x20 ,0x16 ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x14 ,0x41 ,0x10 ,0x74 ,0x72 ,0x20 ,0x13 ,0x41 ,0x18 ,0x74 ,0x72 ,0x73 ,0x22 ,0xf ,0x3a ,0x0 ,0xc ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x2 ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0x3 ,0x20 ,0x4 ,0x20 ,0x11 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x1 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0x7 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x6 ,0x20 ,0x4 ,0x20 ,0xd ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x5 ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0xa ,0x20 ,0x4 ,0x20 ,0xe ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x9 ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0xf ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0xe ,0x20 ,0x4 ,0x20 ,0xf ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0xd ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0xf ,0xb ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x2 ,0x0 ,0xb ,0xe8 ,0x1 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x41 ,0xe ,0x36 ,0x2 ,0xc0 ,0xda ,0x80 ,0x80 ,0x0 ,0x41 ,0xe ,0x41 ,0x8 ,0x41 ,0xc4 ,0xda ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0xda ,0x80 ,0x80 ,0x0 ,0x41 ,0xc4 ,0xda ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x2 ,0x41 ,0xc0 ,0xd6 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0xe ,0x36 ,0x2 ,0xb4 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0xe ,0x41 ,0x8 ,0x41 ,0xb8 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0xb8 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0xb8 ,0xdc ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0xb8 ,0xdc ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0xb2 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x2 ,0x41 ,0xc0 ,0xd8 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0xd6 ,0x80 ,0x80 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xf ,0x0 ,0x41 ,0xcc ,0x0 ,0x41 ,0x1 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xb ,0xc0 ,0x4e ,0x2 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x90 ,0x4c ,0x63 ,0x7c ,0x77 ,0x7b ,0xf2 ,0x6b ,0x6f ,0xc5 ,0x30 ,0x1 ,0x67 ,0x2b ,0xfe ,0xd7 ,0xab ,0x76 ,0xca ,0x82 ,0xc9 ,0x7d ,0xfa ,0x59 ,0x47 ,0xf0 ,0xad ,0xd4 ,0xa2 ,0xaf ,0x9c ,0xa4 ,0x72 ,0xc0 ,0xb7 ,0xfd ,0x93 ,0x26 ,0x36 ,0x3f ,0xf7 ,0xcc ,0x34 ,0xa5 ,0xe5 ,0xf1 ,0x71 ,0xd8 ,0x31 ,0x15 ,0x4 ,0xc7 ,0x23 ,0xc3 ,0x18 ,0x96 ,0x5 ,0x9a ,0x7 ,0x12 ,0x80 ,0xe2 ,0xeb ,0x27 ,0xb2 ,0x75 ,0x9 ,0x83 ,0x2c ,0x1a ,0x1b ,0x6e ,0x5a ,0xa0 ,0x52 ,0x3b ,0xd6 ,0xb3 ,0x29 ,0xe3 ,0x2f ,0x84 ,0x53 ,0xd1 ,0x0 ,0xed ,0x20 ,0xfc ,0xb1 ,0x5b ,0x6a ,0xcb ,0xbe ,0x39 ,0x4a ,0x4c ,0x58 ,0xcf ,0xd0 ,0xef ,0xaa ,0xfb ,0x43 ,0x4d ,0x33 ,0x85 ,0x45 ,0xf9 ,0x2 ,0x7f ,0x50 ,0x3c ,0x9f ,0xa8 ,0x51 ,0xa3 ,0x40 ,0x8f ,0x92 ,0x9d ,0x38 ,0xf5 ,0xbc ,0xb6 ,0xda ,0x21 ,0x10 ,0xff ,0xf3 ,0xd2 ,0xcd ,0xc ,0x13 ,0xec ,0x5f ,0x97 ,0x44 ,0x17 ,0xc4 ,0xa7 ,0x7e ,0x3d ,0x64 ,0x5d ,0x19 ,0x73 ,0x60 ,0x81 ,0x4f ,0xdc ,0x22 ,0x2a ,0x90 ,0x88 ,0x46 ,0xee ,0xb8 ,0x14 ,0xde ,0x5e ,0xb ,0xdb ,0xe0 ,0x32 ,0x3a ,0xa ,0x49 ,0x6 ,0x24 ,0x5c ,0xc2 ,0xd3 ,0xac ,0x62 ,0x91 ,0x95 ,0xe4 ,0x79 ,0xe7 ,0xc8 ,0x37 ,0x6d ,0x8d ,0xd5 ,0x4e ,0xa9 ,0x6c ,0x56 ,0xf4 ,0xea ,0x65 ,0x7a ,0xae ,0x8 ,0xba ,0x78 ,0x25 ,0x2e ,0x1c ,0xa6 ,0xb4 ,0xc6 ,0xe8 ,0xdd ,0x74 ,0x1f ,0x4b ,0xbd ,0x8b ,0x8a ,0x70 ,0x3e ,0xb5 ,0x66 ,0x48 ,0x3 ,0xf6 ,0xe ,0x61 ,0x35 ,0x57 ,0xb9 ,0x86 ,0xc1 ,0x1d ,0x9e ,0xe1 ,0xf8 ,0x98 ,0x11 ,0x69 ,0xd9 ,0x8e ,0x94 ,0x9b ,0x1e ,0x87 ,0xe9 ,0xce ,0x55 ,0x28 ,0xdf ,0x8c ,0xa1 ,0x89 ,0xd ,0xbf ,0xe6 ,0x42 ,0x68 ,0x41 ,0x99 ,0x2d ,0xf ,0xb0 ,0x54 ,0xbb ,0x16 ,0xc6 ,0x63 ,0x63 ,0xa5 ,0xf8 ,0x7c ,0x7c ,0x84 ,0xee ,0x77 ,0x77 ,0x99 ,0xf6 ,0x7b ,0x7b ,0x8d ,0xff ,0xf2 ,0xf2 ,0xd ,0xd6 ,0x6b ,0x6b ,0xbd ,0xde ,0x6f ,0x6f ,0xb1 ,0x91 ,0xc5 ,0xc5 ,0x54 ,0x60 ,0x30 ,0x30 ,0x50 ,0x2 ,0x1 ,0x1 ,0x3 ,0xce ,0x67 ,0x67 ,0xa9 ,0x56 ,0x2b ,0x2b ,0x7d ,0xe7 ,0xfe ,0xfe ,0x19 ,0xb5 ,0xd7 ,0xd7 ,0x62 ,0x4d ,0xab ,0xab ,0xe6 ,0xec ,0x76 ,0x76 ,0x9a ,0x8f ,0xca ,0xca ,0x45 ,0x1f ,0x82 ,0x82 ,0x9d ,0x89 ,0xc9 ,0xc9 ,0x40 ,0xfa ,0x7d ,0x7d ,0x87 ,0xef ,0xfa ,0xfa ,0x15 ,0xb2 ,0x59 ,0x59 ,0xeb ,0x8e ,0x47 ,0x47 ,0xc9 ,0xfb ,0xf0 ,0xf0 ,0xb ,0x41 ,0xad ,0xad ,0xec ,0xb3 ,0xd4 ,0xd4 ,0x67 ,0x5f ,0xa2 ,0xa2 ,0xfd ,0x45 ,0xaf ,0xaf ,0xea ,0x23 ,0x9c ,0x9c ,0xbf ,0x53 ,0xa4 ,0xa4 ,0xf7 ,0xe4 ,0x72 ,0x72 ,0x96 ,0x9b ,0xc0 ,0xc0 ,0x5b ,0x75 ,0xb7 ,0xb7 ,0xc2 ,0xe1 ,0xfd ,0xfd ,0x1c ,0x3d ,0x93 ,0x93 ,0xae ,0x4c ,0x26 ,0x26 ,0x6a ,0x6c ,0x36 ,0x36 ,0x5a ,0x7e ,0x3f ,0x3f ,0x41 ,0xf5 ,0xf7 ,0xf7 ,0x2 ,0x83 ,0xcc ,0xcc ,0x4f ,0x68 ,0x34 ,0x34 ,0x5c ,0x51 ,0xa5 ,0xa5 ,0xf4 ,0xd1 ,0xe5 ,0xe5 ,0x34 ,0xf9 ,0xf1 ,0xf1 ,0x8 ,0xe2 ,0x71 ,0x71 ,0x93 ,0xab ,0xd8 ,0xd8 ,0x73 ,0x62 ,0x31 ,0x31 ,0x53 ,0x2a ,0x15 ,0x15 ,0x3f ,0x8 ,0x4 ,0x4 ,0xc ,0x95 ,0xc7 ,0xc7 ,0x52 ,0x46 ,0x23 ,0x23 ,0x65 ,0x9d ,0xc3 ,0xc3 ,0x5e ,0x30 ,0x18 ,0x18 ,0x28 ,0x37 ,0x96 ,0x96 ,0xa1 ,0xa ,0x5 ,0x5 ,0xf ,0x2f ,0x9a ,0x9a ,0xb5 ,0xe ,0x7 ,0x7 ,0x9 ,0x24 ,0x12 ,0x12 ,0x36 ,0x1b ,0x80 ,0x80 ,0x9b ,0xdf ,0xe2 ,0xe2 ,0x3d ,0xcd ,0xeb ,0xeb ,0x26 ,0x4e ,0x27 ,0x27 ,0x69 ,0x7f ,0xb2 ,0xb2 ,0xcd ,0xea ,0x75 ,0x75 ,0x9f ,0x12 ,0x9 ,0x9 ,0x1b ,0x1d ,0x83 ,0x83 ,0x9e ,0x58 ,0x2c ,0x2c ,0x74 ,0x34 ,0x1a ,0x1a ,0x2e ,0x36 ,0x1b ,0x1b ,0x2d ,0xdc ,0x6e ,0x6e ,0xb2 ,0xb4 ,0x5a ,0x5a ,0xee ,0x5b ,0xa0 ,0xa0 ,0xfb ,0xa4 ,0x52 ,0x52 ,0xf6 ,0x76 ,0x3b ,0x3b ,0x4d ,0xb7 ,0xd6 ,0xd6 ,0x61 ,0x7d ,0xb3 ,0xb3 ,0xce ,0x52 ,0x29 ,0x29 ,0x7b ,0xdd ,0xe3 ,0xe3 ,0x3e ,0x5e ,0x2f ,0x2f ,0x71 ,0x13 ,0x84 ,0x84 ,0x97 ,0xa6 ,0x53 ,0x53 ,0xf5 ,0xb9 ,0xd1 ,0xd1 ,0x68 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc1 ,0xed ,0xed ,0x2c ,0x40 ,0x20 ,0x20 ,0x60 ,0xe3 ,0xfc ,0xfc ,0x1f ,0x79 ,0xb1 ,0xb1 ,0xc8 ,0xb6 ,0x5b ,0x5b ,0xed ,0xd4 ,0x6a ,0x6a ,0xbe ,0x8d ,0xcb ,0xcb ,0x46 ,0x67 ,0xbe ,0xbe ,0xd9 ,0x72 ,0x39 ,0x39 ,0x4b ,0x94 ,0x4a ,0x4a ,0xde ,0x98 ,0x4c ,0x4c ,0xd4 ,0xb0 ,0x58 ,0x58 ,0xe8 ,0x85 ,0xcf ,0xcf ,0x4a ,0xbb ,0xd0 ,0xd0 ,0x6b ,0xc5 ,0xef ,0xef ,0x2a ,0x4f ,0xaa ,0xaa ,0xe5 ,0xed ,0xfb ,0xfb ,0x16 ,0x86 ,0x43 ,0x43 ,0xc5 ,0x9a ,0x4d ,0x4d ,0xd7 ,0x66 ,0x33 ,0x33 ,0x55 ,0x11 ,0x85 ,0x85 ,0x94 ,0x8a ,0x45 ,0x45 ,0xcf ,0xe9 ,0xf9 ,0xf9 ,0x10 ,0x4 ,0x2 ,0x2 ,0x6 ,0xfe ,0x7f ,0x7f ,0x81 ,0xa0 ,0x50 ,0x50 ,0xf0 ,0x78 ,0x3c ,0x3c ,0x44 ,0x25 ,0x9f ,0x9f ,0xba ,0x4b ,0xa8 ,0xa8 ,0xe3 ,0xa2 ,0x51 ,0x51 ,0xf3 ,0x5d ,0xa3 ,0xa3 ,0xfe ,0x80 ,0x40 ,0x40 ,0xc0 ,0x5 ,0x8f ,0x8f ,0x8a ,0x3f ,0x92 ,0x92 ,0xad ,0x21 ,0x9d ,0x9d ,0xbc ,0x70 ,0x38 ,0x38 ,0x48 ,0xf1 ,0xf5 ,0xf5 ,0x4 ,0x63 ,0xbc ,0xbc ,0xdf ,0x77 ,0xb6 ,0xb6 ,0xc1 ,0xaf ,0xda ,0xda ,0x75 ,0x42 ,0x21 ,0x21 ,0x63 ,0x20 ,0x10 ,0x10 ,0x30 ,0xe5 ,0xff ,0xff ,0x1a ,0xfd ,0xf3 ,0xf3 ,0xe ,0xbf ,0xd2 ,0xd2 ,0x6d ,0x81 ,0xcd ,0xcd ,0x4c ,0x18 ,0xc ,0xc ,0x14 ,0x26 ,0x13 ,0x13 ,0x35 ,0xc3 ,0xec ,0xec ,0x2f ,0xbe ,0x5f ,0x5f ,0xe1 ,0x35 ,0x97 ,0x97 ,0xa2 ,0x88 ,0x44 ,0x44 ,0xcc ,0x2e ,0x17 ,0x17 ,0x39 ,0x93 ,0xc4 ,0xc4 ,0x57 ,0x55 ,0xa7 ,0xa7 ,0xf2 ,0xfc ,0x7e ,0x7e ,0x82 ,0x7a ,0x3d ,0x3d ,0x47 ,0xc8 ,0x64 ,0x64 ,0xac ,0xba ,0x5d ,0x5d ,0xe7 ,0x32 ,0x19 ,0x19 ,0x2b ,0xe6 ,0x73 ,0x73 ,0x95 ,0xc0 ,0x60 ,0x60 ,0xa0 ,0x19 ,0x81 ,0x81 ,0x98 ,0x9e ,0x4f ,0x4f ,0xd1 ,0xa3 ,0xdc ,0xdc ,0x7f ,0x44 ,0x22 ,0x22 ,0x66 ,0x54 ,0x2a ,0x2a ,0x7e ,0x3b ,0x90 ,0x90 ,0xab ,0xb ,0x88 ,0x88 ,0x83 ,0x8c ,0x46 ,0x46 ,0xca ,0xc7 ,0xee ,0xee ,0x29 ,0x6b ,0xb8 ,0xb8 ,0xd3 ,0x28 ,0x14 ,0x14 ,0x3c ,0xa7 ,0xde ,0xde ,0x79 ,0xbc ,0x5e ,0x5e ,0xe2 ,0x16 ,0xb ,0xb ,0x1d ,0xad ,0xdb ,0xdb ,0x76 ,0xdb ,0xe0 ,0xe0 ,0x3b ,0x64 ,0x32 ,0x32 ,0x56 ,0x74 ,0x3a ,0x3a ,0x4e ,0x14 ,0xa ,0xa ,0x1e ,0x92 ,0x49 ,0x49 ,0xdb ,0xc ,0x6 ,0x6 ,0xa ,0x48 ,0x24 ,0x24 ,0x6c ,0xb8 ,0x5c ,0x5c ,0xe4 ,0x9f ,0xc2 ,0xc2 ,0x5d ,0xbd ,0xd3 ,0xd3 ,0x6e ,0x43 ,0xac ,0xac ,0xef ,0xc4 ,0x62 ,0x62 ,0xa6 ,0x39 ,0x91 ,0x91 ,0xa8 ,0x31 ,0x95 ,0x95 ,0xa4 ,0xd3 ,0xe4 ,0xe4 ,0x37 ,0xf2 ,0x79 ,0x79 ,0x8b ,0xd5 ,0xe7 ,0xe7 ,0x32 ,0x8b ,0xc8 ,0xc8 ,0x43 ,0x6e ,0x37 ,0x37 ,0x59 ,0xda ,0x6d ,0x6d ,0xb7 ,0x1 ,0x8d ,0x8d ,0x8c ,0xb1 ,0xd5 ,0xd5 ,0x64 ,0x9c ,0x4e ,0x4e ,0xd2 ,0x49 ,0xa9 ,0xa9 ,0xe0 ,0xd8 ,0x6c ,0x6c ,0xb4 ,0xac ,0x56 ,0x56 ,0xfa ,0xf3 ,0xf4 ,0xf4 ,0x7 ,0xcf ,0xea ,0xea ,0x25 ,0xca ,0x65 ,0x65 ,0xaf ,0xf4 ,0x7a ,0x7a ,0x8e ,0x47 ,0xae ,0xae ,0xe9 ,0x10 ,0x8 ,0x8 ,0x18 ,0x6f ,0xba ,0xba ,0xd5 ,0xf0 ,0x78 ,0x78 ,0x88 ,0x4a ,0x25 ,0x25 ,0x6f ,0x5c ,0x2e ,0x2e ,0x72 ,0x38 ,0x1c ,0x1c ,0x24 ,0x57 ,0xa6 ,0xa6 ,0xf1 ,0x73 ,0xb4 ,0xb4 ,0xc7 ,0x97 ,0xc6 ,0xc6 ,0x51 ,0xcb ,0xe8 ,0xe8 ,0x23 ,0xa1 ,0xdd ,0xdd ,0x7c ,0xe8 ,0x74 ,0x74 ,0x9c ,0x3e ,0x1f ,0x1f ,0x21 ,0x96 ,0x4b ,0x4b ,0xdd ,0x61 ,0xbd ,0xbd ,0xdc ,0xd ,0x8b ,0x8b ,0x86 ,0xf ,0x8a ,0x8a ,0x85 ,0xe0 ,0x70 ,0x70 ,0x90 ,0x7c ,0x3e ,0x3e ,0x42 ,0x71 ,0xb5 ,0xb5 ,0xc4 ,0xcc ,0x66 ,0x66 ,0xaa ,0x90 ,0x48 ,0x48 ,0xd8 ,0x6 ,0x3 ,0x3 ,0x5 ,0xf7 ,0xf6 ,0xf6 ,0x1 ,0x1c ,0xe ,0xe ,0x12 ,0xc2 ,0x61 ,0x61 ,0xa3 ,0x6a ,0x35 ,0x35 ,0x5f ,0xae ,0x57 ,0x57 ,0xf9 ,0x69 ,0xb9 ,0xb9 ,0xd0 ,0x17 ,0x86 ,0x86 ,0x91 ,0x99 ,0xc1 ,0xc1 ,0x58 ,0x3a ,0x1d ,0x1d ,0x27 ,0x27 ,0x9e ,0x9e ,0xb9 ,0xd9 ,0xe1 ,0xe1 ,0x38 ,0xeb ,0xf8 ,0xf8 ,0x13 ,0x2b ,0x98 ,0x98 ,0xb3 ,0x22 ,0x11 ,0x11 ,0x33 ,0xd2 ,0x69 ,0x69 ,0xbb ,0xa9 ,0xd9 ,0xd9 ,0x70 ,0x7 ,0x8e ,0x8e ,0x89 ,0x33 ,0x94 ,0x94 ,0xa7 ,0x2d ,0x9b ,0x9b ,0xb6 ,0x3c ,0x1e ,0x1e ,0x22 ,0x15 ,0x87 ,0x87 ,0x92 ,0xc9 ,0xe9 ,0xe9 ,0x20 ,0x87 ,0xce ,0xce ,0x49 ,0xaa ,0x55 ,0x55 ,0xff ,0x50 ,0x28 ,0x28 ,0x78 ,0xa5 ,0xdf ,0xdf ,0x7a ,0x3 ,0x8c ,0x8c ,0x8f ,0x59 ,0xa1 ,0xa1 ,0xf8 ,0x9 ,0x89 ,0x89 ,0x80 ,0x1a ,0xd ,0xd ,0x17 ,0x65 ,0xbf ,0xbf ,0xda ,0xd7 ,0xe6 ,0xe6 ,0x31 ,0x84 ,0x42 ,0x42 ,0xc6 ,0xd0 ,0x68 ,0x68 ,0xb8 ,0x82 ,0x41 ,0x41 ,0xc3 ,0x29 ,0x99 ,0x99 ,0xb0 ,0x5a ,0x2d ,0x2d ,0x77 ,0x1e ,0xf ,0xf ,0x11 ,0x7b ,0xb0 ,0xb0 ,0xcb ,0xa8 ,0x54 ,0x54 ,0xfc ,0x6d ,0xbb ,0xbb ,0xd6 ,0x2c ,0x16 ,0x16 ,0x3a ,0xa5 ,0xc6 ,0x63 ,0x63 ,0x84 ,0xf8 ,0x7c ,0x7c ,0x99 ,0xee ,0x77 ,0x77 ,0x8d ,0xf6 ,0x7b ,0x7b ,0xd ,0xff ,0xf2 ,0xf2 ,0xbd ,0xd6 ,0x6b ,0x6b ,0xb1 ,0xde ,0x6f ,0x6f ,0x54 ,0x91 ,0xc5 ,0xc5 ,0x50 ,0x60 ,0x30 ,0x30 ,0x3 ,0x2 ,0x1 ,0x1 ,0xa9 ,0xce ,0x67 ,0x67 ,0x7d ,0x56 ,0x2b ,0x2b ,0x19 ,0xe7 ,0xfe ,0xfe ,0x62 ,0xb5 ,0xd7 ,0xd7 ,0xe6 ,0x4d ,0xab ,0xab ,0x9a ,0xec ,0x76 ,0x76 ,0x45 ,0x8f ,0xca ,0xca ,0x9d ,0x1f ,0x82 ,0x82 ,0x40 ,0x89 ,0xc9 ,0xc9 ,0x87 ,0xfa ,0x7d ,0x7d ,0x15 ,0xef ,0xfa ,0xfa ,0xeb ,0xb2 ,0x59 ,0x59 ,0xc9 ,0x8e ,0x47 ,0x47 ,0xb ,0xfb ,0xf0 ,0xf0 ,0xec ,0x41 ,0xad ,0xad ,0x67 ,0xb3 ,0xd4 ,0xd4 ,0xfd ,0x5f ,0xa2 ,0xa2 ,0xea ,0x45 ,0xaf ,0xaf ,0xbf ,0x23 ,0x9c ,0x9c ,0xf7 ,0x53 ,0xa4 ,0xa4 ,0x96 ,0xe4 ,0x72 ,0x72 ,0x5b ,0x9b ,0xc0 ,0xc0 ,0xc2 ,0x75 ,0xb7 ,0xb7 ,0x1c ,0xe1 ,0xfd ,0xfd ,0xae ,0x3d ,0x93 ,0x93 ,0x6a ,0x4c ,0x26 ,0x26 ,0x5a ,0x6c ,0x36 ,0x36 ,0x41 ,0x7e ,0x3f ,0x3f ,0x2 ,0xf5 ,0xf7 ,0xf7 ,0x4f ,0x83 ,0xcc ,0xcc ,0x5c ,0x68 ,0x34 ,0x34 ,0xf4 ,0x51 ,0xa5 ,0xa5 ,0x34 ,0xd1 ,0xe5 ,0xe5 ,0x8 ,0xf9 ,0xf1 ,0xf1 ,0x93 ,0xe2 ,0x71 ,0x71 ,0x73 ,0xab ,0xd8 ,0xd8 ,0x53 ,0x62 ,0x31 ,0x31 ,0x3f ,0x2a ,0x15 ,0x15 ,0xc ,0x8 ,0x4 ,0x4 ,0x52 ,0x95 ,0xc7 ,0xc7 ,0x65 ,0x46 ,0x23 ,0x23 ,0x5e ,0x9d ,0xc3 ,0xc3 ,0x28 ,0x30 ,0x18 ,0x18 ,0xa1 ,0x37 ,0x96 ,0x96 ,0xf ,0xa ,0x5 ,0x5 ,0xb5 ,0x2f ,0x9a ,0x9a ,0x9 ,0xe ,0x7 ,0x7 ,0x36 ,0x24 ,0x12 ,0x12 ,0x9b ,0x1b ,0x80 ,0x80 ,0x3d ,0xdf ,0xe2 ,0xe2 ,0x26 ,0xcd ,0xeb ,0xeb ,0x69 ,0x4e ,0x27 ,0x27 ,0xcd ,0x7f ,0xb2 ,0xb2 ,0x9f ,0xea ,0x75 ,0x75 ,0x1b ,0x12 ,0x9 ,0x9 ,0x9e ,0x1d ,0x83 ,0x83 ,0x74 ,0x58 ,0x2c ,0x2c ,0x2e ,0x34 ,0x1a ,0x1a ,0x2d ,0x36 ,0x1b ,0x1b ,0xb2 ,0xdc ,0x6e ,0x6e ,0xee ,0xb4 ,0x5a ,0x5a ,0xfb ,0x5b ,0xa0 ,0xa0 ,0xf6 ,0xa4 ,0x52 ,0x52 ,0x4d ,0x76 ,0x3b ,0x3b ,0x61 ,0xb7 ,0xd6 ,0xd6 ,0xce ,0x7d ,0xb3 ,0xb3 ,0x7b ,0x52 ,0x29 ,0x29 ,0x3e ,0xdd ,0xe3 ,0xe3 ,0x71 ,0x5e ,0x2f ,0x2f ,0x97 ,0x13 ,0x84 ,0x84 ,0xf5 ,0xa6 ,0x53 ,0x53 ,0x68 ,0xb9 ,0xd1 ,0xd1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2c ,0xc1 ,0xed ,0xed ,0x60 ,0x40 ,0x20 ,0x20 ,0x1f ,0xe3 ,0xfc ,0xfc ,0xc8 ,0x79 ,0xb1 ,0xb1 ,0xed ,0xb6 ,0x5b ,0x5b ,0xbe ,0xd4 ,0x6a ,0x6a ,0x46 ,0x8d ,0xcb ,0xcb ,0xd9 ,0x67 ,0xbe ,0xbe ,0x4b ,0x72 ,0x39 ,0x39 ,0xde ,0x94 ,0x4a ,0x4a ,0xd4 ,0x98 ,0x4c ,0x4c ,0xe8 ,0xb0 ,0x58 ,0x58 ,0x4a ,0x85 ,0xcf ,0xcf ,0x6b ,0xbb ,0xd0 ,0xd0 ,0x2a ,0xc5 ,0xef ,0xef ,0xe5 ,0x4f ,0xaa ,0xaa ,0x16 ,0xed ,0xfb ,0xfb ,0xc5 ,0x86 ,0x43 ,0x43 ,0xd7 ,0x9a ,0x4d ,0x4d ,0x55 ,0x66 ,0x33 ,0x33 ,0x94 ,0x11 ,0x85 ,0x85 ,0xcf ,0x8a ,0x45 ,0x45 ,0x10 ,0xe9 ,0xf9 ,0xf9 ,0x6 ,0x4 ,0x2 ,0x2 ,0x81 ,0xfe ,0x7f ,0x7f ,0xf0 ,0xa0 ,0x50 ,0x50 ,0x44 ,0x78 ,0x3c ,0x3c ,0xba ,0x25 ,0x9f ,0x9f ,0xe3 ,0x4b ,0xa8 ,0xa8 ,0xf3 ,0xa2 ,0x51 ,0x51 ,0xfe ,0x5d ,0xa3 ,0xa3 ,0xc0 ,0x80 ,0x40 ,0x40 ,0x8a ,0x5 ,0x8f ,0x8f ,0xad ,0x3f ,0x92 ,0x92 ,0xbc ,0x21 ,0x9d ,0x9d ,0x48 ,0x70 ,0x38 ,0x38 ,0x4 ,0xf1 ,0xf5 ,0xf5 ,0xdf ,0x63 ,0xbc ,0xbc ,0xc1 ,0x77 ,0xb6 ,0xb6 ,0x75 ,0xaf ,0xda ,0xda ,0x63 ,0x42 ,0x21 ,0x21 ,0x30 ,0x20 ,0x10 ,0x10 ,0x1a ,0xe5 ,0xff ,0xff ,0xe ,0xfd ,0xf3 ,0xf3 ,0x6d ,0xbf ,0xd2 ,0xd2 ,0x4c ,0x81 ,0xcd ,0xcd ,0x14 ,0x18 ,0xc ,0xc ,0x35 ,0x26 ,0x13 ,0x13 ,0x2f ,0xc3 ,0xec ,0xec ,0xe1 ,0xbe ,0x5f ,0x5f ,0xa2 ,0x35 ,0x97 ,0x97 ,0xcc ,0x88 ,0x44 ,0x44 ,0x39 ,0x2e ,0x17 ,0x17 ,0x57 ,0x93 ,0xc4 ,0xc4 ,0xf2 ,0x55 ,0xa7 ,0xa7 ,0x82 ,0xfc ,0x7e ,0x7e ,0x47 ,0x7a ,0x3d ,0x3d ,0xac ,0xc8 ,0x64 ,0x64 ,0xe7 ,0xba ,0x5d ,0x5d ,0x2b ,0x32 ,0x19 ,0x19 ,0x95 ,0xe6 ,0x73 ,0x73 ,0xa0 ,0xc0 ,0x60 ,0x60 ,0x98 ,0x19 ,0x81 ,0x81 ,0xd1 ,0x9e ,0x4f ,0x4f ,0x7f ,0xa3 ,0xdc ,0xdc ,0x66 ,0x44 ,0x22 ,0x22 ,0x7e ,0x54 ,0x2a ,0x2a ,0xab ,0x3b ,0x90 ,0x90 ,0x83 ,0xb ,0x88 ,0x88 ,0xca ,0x8c ,0x46 ,0x46 ,0x29 ,0xc7 ,0xee ,0xee ,0xd3 ,0x6b ,0xb8 ,0xb8 ,0x3c ,0x28 ,0x14 ,0x14 ,0x79 ,0xa7 ,0xde ,0xde ,0xe2 ,0xbc ,0x5e ,0x5e ,0x1d ,0x16 ,0xb ,0xb ,0x76 ,0xad ,0xdb ,0xdb ,0x3b ,0xdb ,0xe0 ,0xe0 ,0x56 ,0x64 ,0x32 ,0x32 ,0x4e ,0x74 ,0x3a ,0x3a ,0x1e ,0x14 ,0xa ,0xa ,0xdb ,0x92 ,0x49 ,0x49 ,0xa ,0xc ,0x6 ,0x6 ,0x6c ,0x48 ,0x24 ,0x24 ,0xe4 ,0xb8 ,0x5c ,0x5c ,0x5d ,0x9f ,0xc2 ,0xc2 ,0x6e ,0xbd ,0xd3 ,0xd3 ,0xef ,0x43 ,0xac ,0xac ,0xa6 ,0xc4 ,0x62 ,0x62 ,0xa8 ,0x39 ,0x91 ,0x91 ,0xa4 ,0x31 ,0x95 ,0x95 ,0x37 ,0xd3 ,0xe4 ,0xe4 ,0x8b ,0xf2 ,0x79 ,0x79 ,0x32 ,0xd5 ,0xe7 ,0xe7 ,0x43 ,0x8b ,0xc8 ,0xc8 ,0x59 ,0x6e ,0x37 ,0x37 ,0xb7 ,0xda ,0x6d ,0x6d ,0x8c ,0x1 ,0x8d ,0x8d ,0x64 ,0xb1 ,0xd5 ,0xd5 ,0xd2 ,0x9c ,0x4e ,0x4e ,0xe0 ,0x49 ,0xa9 ,0xa9 ,0xb4 ,0xd8 ,0x6c ,0x6c ,0xfa ,0xac ,0x56 ,0x56 ,0x7 ,0xf3 ,0xf4 ,0xf4 ,0x25 ,0xcf ,0xea ,0xea ,0xaf ,0xca ,0x65 ,0x65 ,0x8e ,0xf4 ,0x7a ,0x7a ,0xe9 ,0x47 ,0xae ,0xae ,0x18 ,0x10 ,0x8 ,0x8 ,0xd5 ,0x6f ,0xba ,0xba ,0x88 ,0xf0 ,0x78 ,0x78 ,0x6f ,0x4a ,0x25 ,0x25 ,0x72 ,0x5c ,0x2e ,0x2e ,0x24 ,0x38 ,0x1c ,0x1c ,0xf1 ,0x57 ,0xa6 ,0xa6 ,0xc7 ,0x73 ,0xb4 ,0xb4 ,0x51 ,0x97 ,0xc6 ,0xc6 ,0x23 ,0xcb ,0xe8 ,0xe8 ,0x7c ,0xa1 ,0xdd ,0xdd ,0x9c ,0xe8 ,0x74 ,0x74 ,0x21 ,0x3e ,0x1f ,0x1f ,0xdd ,0x96 ,0x4b ,0x4b ,0xdc ,0x61 ,0xbd ,0xbd ,0x86 ,0xd ,0x8b ,0x8b ,0x85 ,0xf ,0x8a ,0x8a ,0x90 ,0xe0 ,0x70 ,0x70 ,0x42 ,0x7c ,0x3e ,0x3e ,0xc4 ,0x71 ,0xb5 ,0xb5 ,0xaa ,0xcc ,0x66 ,0x66 ,0xd8 ,0x90 ,0x48 ,0x48 ,0x5 ,0x6 ,0x3 ,0x3 ,0x1 ,0xf7 ,0xf6 ,0xf6 ,0x12 ,0x1c ,0xe ,0xe ,0xa3 ,0xc2 ,0x61 ,0x61 ,0x5f ,0x6a ,0x35 ,0x35 ,0xf9 ,0xae ,0x57 ,0x57 ,0xd0 ,0x69 ,0xb9 ,0xb9 ,0x91 ,0x17 ,0x86 ,0x86 ,0x58 ,0x99 ,0xc1 ,0xc1 ,0x27 ,0x3a ,0x1d ,0x1d ,0xb9 ,0x27 ,0x9e ,0x9e ,0x38 ,0xd9 ,0xe1 ,0xe1 ,0x13 ,0xeb ,0xf8 ,0xf8 ,0xb3 ,0x2b ,0x98 ,0x98 ,0x33 ,0x22 ,0x11 ,0x11 ,0xbb ,0xd2 ,0x69 ,0x69 ,0x70 ,0xa9 ,0xd9 ,0xd9 ,0x89 ,0x7 ,0x8e ,0x8e ,0xa7 ,0x33 ,0x94 ,0x94 ,0xb6 ,0x2d ,0x9b ,0x9b ,0x22 ,0x3c ,0x1e ,0x1e ,0x92 ,0x15 ,0x87 ,0x87 ,0x20 ,0xc9 ,0xe9 ,0xe9 ,0x49 ,0x87 ,0xce ,0xce ,0xff ,0xaa ,0x55 ,0x55 ,0x78 ,0x50 ,0x28 ,0x28 ,0x7a ,0xa5 ,0xdf ,0xdf ,0x8f ,0x3 ,0x8c ,0x8c ,0xf8 ,0x59 ,0xa1 ,0xa1 ,0x80 ,0x9 ,0x89 ,0x89 ,0x17 ,0x1a ,0xd ,0xd ,0xda ,0x65 ,0xbf ,0xbf ,0x31 ,0xd7 ,0xe6 ,0xe6 ,0xc6 ,0x84 ,0x42 ,0x42 ,0xb8 ,0xd0 ,0x68 ,0x68 ,0xc3 ,0x82 ,0x41 ,0x41 ,0xb0 ,0x29 ,0x99 ,0x99 ,0x77 ,0x5a ,0x2d ,0x2d ,0x11 ,0x1e ,0xf ,0xf ,0xcb ,0x7b ,0xb0 ,0xb0 ,0xfc ,0xa8 ,0x54 ,0x54 ,0xd6 ,0x6d ,0xbb ,0xbb ,0x3a ,0x2c ,0x16 ,0x16 ,0x63 ,0xa5 ,0xc6 ,0x63 ,0x7c ,0x84 ,0xf8 ,0x7c ,0x77 ,0x99 ,0xee ,0x77 ,0x7b ,0x8d ,0xf6 ,0x7b ,0xf2 ,0xd ,0xff ,0xf2 ,0x6b ,0xbd ,0xd6 ,0x6b ,0x6f ,0xb1 ,0xde ,0x6f ,0xc5 ,0x54 ,0x91 ,0xc5 ,0x30 ,0x50 ,0x60 ,0x30 ,0x1 ,0x3 ,0x2 ,0x1 ,0x67 ,0xa9 ,0xce ,0x67 ,0x2b ,0x7d ,0x56 ,0x2b ,0xfe ,0x19 ,0xe7 ,0xfe ,0xd7 ,0x62 ,0xb5 ,0xd7 ,0xab ,0xe6 ,0x4d ,0xab ,0x76 ,0x9a ,0xec ,0x76 ,0xca ,0x45 ,0x8f ,0xca ,0x82 ,0x9d ,0x1f ,0x82 ,0xc9 ,0x40 ,0x89 ,0xc9 ,0x7d ,0x87 ,0xfa ,0x7d ,0xfa ,0x15 ,0xef ,0xfa ,0x59 ,0xeb ,0xb2 ,0x59 ,0x47 ,0xc9 ,0x8e ,0x47 ,0xf0 ,0xb ,0xfb ,0xf0 ,0xad ,0xec ,0x41 ,0xad ,0xd4 ,0x67 ,0xb3 ,0xd4 ,0xa2 ,0xfd ,0x5f ,0xa2 ,0xaf ,0xea ,0x45 ,0xaf ,0x9c ,0xbf ,0x23 ,0x9c ,0xa4 ,0xf7 ,0x53 ,0xa4 ,0x72 ,0x96 ,0xe4 ,0x72 ,0xc0 ,0x5b ,0x9b ,0xc0 ,0xb7 ,0xc2 ,0x75 ,0xb7 ,0xfd ,0x1c ,0xe1 ,0xfd ,0x93 ,0xae ,0x3d ,0x93 ,0x26 ,0x6a ,0x4c ,0x26 ,0x36 ,0x5a ,0x6c ,0x36 ,0x3f ,0x41 ,0x7e ,0x3f ,0xf7 ,0x2 ,0xf5 ,0xf7 ,0xcc ,0x4f ,0x83 ,0xcc ,0x34 ,0x5c ,0x68 ,0x34 ,0xa5 ,0xf4 ,0x51 ,0xa5 ,0xe5 ,0x34 ,0xd1 ,0xe5 ,0xf1 ,0x8 ,0xf9 ,0xf1 ,0x71 ,0x93 ,0xe2 ,0x71 ,0xd8 ,0x73 ,0xab ,0xd8 ,0x31 ,0x53 ,0x62 ,0x31 ,0x15 ,0x3f ,0x2a ,0x15 ,0x4 ,0xc ,0x8 ,0x4 ,0xc7 ,0x52 ,0x95 ,0xc7 ,0x23 ,0x65 ,0x46 ,0x23 ,0xc3 ,0x5e ,0x9d ,0xc3 ,0x18 ,0x28 ,0x30 ,0x18 ,0x96 ,0xa1 ,0x37 ,0x96 ,0x5 ,0xf ,0xa ,0x5 ,0x9a ,0xb5 ,0x2f ,0x9a ,0x7 ,0x9 ,0xe ,0x7 ,0x12 ,0x36 ,0x24 ,0x12 ,0x80 ,0x9b ,0x1b ,0x80 ,0xe2 ,0x3d ,0xdf ,0xe2 ,0xeb ,0x26 ,0xcd ,0xeb ,0x27 ,0x69 ,0x4e ,0x27 ,0xb2 ,0xcd ,0x7f ,0xb2 ,0x75 ,0x9f ,0xea ,0x75 ,0x9 ,0x1b ,0x12 ,0x9 ,0x83 ,0x9e ,0x1d ,0x83 ,0x2c ,0x74 ,0x58 ,0x2c ,0x1a ,0x2e ,0x34 ,0x1a ,0x1b ,0x2d ,0x36 ,0x1b ,0x6e ,0xb2 ,0xdc ,0x6e ,0x5a ,0xee ,0xb4 ,0x5a ,0xa0 ,0xfb ,0x5b ,0xa0 ,0x52 ,0xf6 ,0xa4 ,0x52 ,0x3b ,0x4d ,0x76 ,0x3b ,0xd6 ,0x61 ,0xb7 ,0xd6 ,0xb3 ,0xce ,0x7d ,0xb3 ,0x29 ,0x7b ,0x52 ,0x29 ,0xe3 ,0x3e ,0xdd ,0xe3 ,0x2f ,0x71 ,0x5e ,0x2f ,0x84 ,0x97 ,0x13 ,0x84 ,0x53 ,0xf5 ,0xa6 ,0x53 ,0xd1 ,0x68 ,0xb9 ,0xd1 ,0x0 ,0x0 ,0x0 ,0x0 ,0xed ,0x2c ,0xc1 ,0xed ,0x20 ,0x60 ,0x40 ,0x20 ,0xfc ,0x1f ,0xe3 ,0xfc ,0xb1 ,0xc8 ,0x79 ,0xb1 ,0x5b ,0xed ,0xb6 ,0x5b ,0x6a ,0xbe ,0xd4 ,0x6a ,0xcb ,0x46 ,0x8d ,0xcb ,0xbe ,0xd9 ,0x67 ,0xbe ,0x39 ,0x4b ,0x72 ,0x39 ,0x4a ,0xde ,0x94 ,0x4a ,0x4c ,0xd4 ,0x98 ,0x4c ,0x58 ,0xe8 ,0xb0 ,0x58 ,0xcf ,0x4a ,0x85 ,0xcf ,0xd0 ,0x6b ,0xbb ,0xd0 ,0xef ,0x2a ,0xc5 ,0xef ,0xaa ,0xe5 ,0x4f ,0xaa ,0xfb ,0x16 ,0xed ,0xfb ,0x43 ,0xc5 ,0x86 ,0x43 ,0x4d ,0xd7 ,0x9a ,0x4d ,0x33 ,0x55 ,0x66 ,0x33 ,0x85 ,0x94 ,0x11 ,0x85 ,0x45 ,0xcf ,0x8a ,0x45 ,0xf9 ,0x10 ,0xe9 ,0xf9 ,0x2 ,0x6 ,0x4 ,0x2 ,0x7f ,0x81 ,0xfe ,0x7f ,0x50 ,0xf0 ,0xa0 ,0x50 ,0x3c ,0x44 ,0x78 ,0x3c ,0x9f ,0xba ,0x25 ,0x9f ,0xa8 ,0xe3 ,0x4b ,0xa8 ,0x51 ,0xf3 ,0xa2 ,0x51 ,0xa3 ,0xfe ,0x5d ,0xa3 ,0x40 ,0xc0 ,0x80 ,0x40 ,0x8f ,0x8a ,0x5 ,0x8f ,0x92 ,0xad ,0x3f ,0x92 ,0x9d ,0xbc ,0x21 ,0x9d ,0x38 ,0x48 ,0x70 ,0x38 ,0xf5 ,0x4 ,0xf1 ,0xf5 ,0xbc ,0xdf ,0x63 ,0xbc ,0xb6 ,0xc1 ,0x77 ,0xb6 ,0xda ,0x75 ,0xaf ,0xda ,0x21 ,0x63 ,0x42 ,0x21 ,0x10 ,0x30 ,0x20 ,0x10 ,0xff ,0x1a ,0xe5 ,0xff ,0xf3 ,0xe ,0xfd ,0xf3 ,0xd2 ,0x6d ,0xbf ,0xd2 ,0xcd ,0x4c ,0x81 ,0xcd ,0xc ,0x14 ,0x18 ,0xc ,0x13 ,0x35 ,0x26 ,0x13 ,0xec ,0x2f ,0xc3 ,0xec ,0x5f ,0xe1 ,0xbe ,0x5f ,0x97 ,0xa2 ,0x35 ,0x97 ,0x44 ,0xcc ,0x88 ,0x44 ,0x17 ,0x39 ,0x2e ,0x17 ,0xc4 ,0x57 ,0x93 ,0xc4 ,0xa7 ,0xf2 ,0x55 ,0xa7 ,0x7e ,0x82 ,0xfc ,0x7e ,0x3d ,0x47 ,0x7a ,0x3d ,0x64 ,0xac ,0xc8 ,0x64 ,0x5d ,0xe7 ,0xba ,0x5d ,0x19 ,0x2b ,0x32 ,0x19 ,0x73 ,0x95 ,0xe6 ,0x73 ,0x60 ,0xa0 ,0xc0 ,0x60 ,0x81 ,0x98 ,0x19 ,0x81 ,0x4f ,0xd1 ,0x9e ,0x4f ,0xdc ,0x7f ,0xa3 ,0xdc ,0x22 ,0x66 ,0x44 ,0x22 ,0x2a ,0x7e ,0x54 ,0x2a ,0x90 ,0xab ,0x3b ,0x90 ,0x88 ,0x83 ,0xb ,0x88 ,0x46 ,0xca ,0x8c ,0x46 ,0xee ,0x29 ,0xc7 ,0xee ,0xb8 ,0xd3 ,0x6b ,0xb8 ,0x14 ,0x3c ,0x28 ,0x14 ,0xde ,0x79 ,0xa7 ,0xde ,0x5e ,0xe2 ,0xbc ,0x5e ,0xb ,0x1d ,0x16 ,0xb ,0xdb ,0x76 ,0xad ,0xdb ,0xe0 ,0x3b ,0xdb ,0xe0 ,0x32 ,0x56 ,0x64 ,0x32 ,0x3a ,0x4e ,0x74 ,0x3a ,0xa ,0x1e ,0x14 ,0xa ,0x49 ,0xdb ,0x92 ,0x49 ,0x6 ,0xa ,0xc ,0x6 ,0x24 ,0x6c ,0x48 ,0x24 ,0x5c ,0xe4 ,0xb8 ,0x5c ,0xc2 ,0x5d ,0x9f ,0xc2 ,0xd3 ,0x6e ,0xbd ,0xd3 ,0xac ,0xef ,0x43 ,0xac ,0x62 ,0xa6 ,0xc4 ,0x62 ,0x91 ,0xa8 ,0x39 ,0x91 ,0x95 ,0xa4 ,0x31 ,0x95 ,0xe4 ,0x37 ,0xd3 ,0xe4 ,0x79 ,0x8b ,0xf2 ,0x79 ,0xe7 ,0x32 ,0xd5 ,0xe7 ,0xc8 ,0x43 ,0x8b ,0xc8 ,0x37 ,0x59 ,0x6e ,0x37 ,0x6d ,0xb7 ,0xda ,0x6d ,0x8d ,0x8c ,0x1 ,0x8d ,0xd5 ,0x64 ,0xb1 ,0xd5 ,0x4e ,0xd2 ,0x9c ,0x4e ,0xa9 ,0xe0 ,0x49 ,0xa9 ,0x6c ,0xb4 ,0xd8 ,0x6c ,0x56 ,0xfa ,0xac ,0x56 ,0xf4 ,0x7 ,0xf3 ,0xf4 ,0xea ,0x25 ,0xcf ,0xea ,0x65 ,0xaf ,0xca ,0x65 ,0x7a ,0x8e ,0xf4 ,0x7a ,0xae ,0xe9 ,0x47 ,0xae ,0x8 ,0x18 ,0x10 ,0x8 ,0xba ,0xd5 ,0x6f ,0xba ,0x78 ,0x88 ,0xf0 ,0x78 ,0x25 ,0x6f ,0x4a ,0x25 ,0x2e ,0x72 ,0x5c ,0x2e ,0x1c ,0x24 ,0x38 ,0x1c ,0xa6 ,0xf1 ,0x57 ,0xa6 ,0xb4 ,0xc7 ,0x73 ,0xb4 ,0xc6 ,0x51 ,0x97 ,0xc6 ,0xe8 ,0x23 ,0xcb ,0xe8 ,0xdd ,0x7c ,0xa1 ,0xdd ,0x74 ,0x9c ,0xe8 ,0x74 ,0x1f ,0x21 ,0x3e ,0x1f ,0x4b ,0xdd ,0x96 ,0x4b ,0xbd ,0xdc ,0x61 ,0xbd ,0x8b ,0x86 ,0xd ,0x8b ,0x8a ,0x85 ,0xf ,0x8a ,0x70 ,0x90 ,0xe0 ,0x70 ,0x3e ,0x42 ,0x7c ,0x3e ,0xb5 ,0xc4 ,0x71 ,0xb5 ,0x66 ,0xaa ,0xcc ,0x66 ,0x48 ,0xd8 ,0x90 ,0x48 ,0x3 ,0x5 ,0x6 ,0x3 ,0xf6 ,0x1 ,0xf7 ,0xf6 ,0xe ,0x12 ,0x1c ,0xe ,0x61 ,0xa3 ,0xc2 ,0x61 ,0x35 ,0x5f ,0x6a ,0x35 ,0x57 ,0xf9 ,0xae ,0x57 ,0xb9 ,0xd0 ,0x69 ,0xb9 ,0x86 ,0x91 ,0x17 ,0x86 ,0xc1 ,0x58 ,0x99 ,0xc1 ,0x1d ,0x27 ,0x3a ,0x1d ,0x9e ,0xb9 ,0x27 ,0x9e ,0xe1 ,0x38 ,0xd9 ,0xe1 ,0xf8 ,0x13 ,0xeb ,0xf8 ,0x98 ,0xb3 ,0x2b ,0x98 ,0x11 ,0x33 ,0x22 ,0x11 ,0x69 ,0xbb ,0xd2 ,0x69 ,0xd9 ,0x70 ,0xa9 ,0xd9 ,0x8e ,0x89 ,0x7 ,0x8e ,0x94 ,0xa7 ,0x33 ,0x94 ,0x9b ,0xb6 ,0x2d ,0x9b ,0x1e ,0x22 ,0x3c ,0x1e ,0x87 ,0x92 ,0x15 ,0x87 ,0xe9 ,0x20 ,0xc9 ,0xe9 ,0xce ,0x49 ,0x87 ,0xce ,0x55 ,0xff ,0xaa ,0x55 ,0x28 ,0x78 ,0x50 ,0x28 ,0xdf ,0x7a ,0xa5 ,0xdf ,0x8c ,0x8f ,0x3 ,0x8c ,0xa1 ,0xf8 ,0x59 ,0xa1 ,0x89 ,0x80 ,0x9 ,0x89 ,0xd ,0x17 ,0x1a ,0xd ,0xbf ,0xda ,0x65 ,0xbf ,0xe6 ,0x31 ,0xd7 ,0xe6 ,0x42 ,0xc6 ,0x84 ,0x42 ,0x68 ,0xb8 ,0xd0 ,0x68 ,0x41 ,0xc3 ,0x82 ,0x41 ,0x99 ,0xb0 ,0x29 ,0x99 ,0x2d ,0x77 ,0x5a ,0x2d ,0xf ,0x11 ,0x1e ,0xf ,0xb0 ,0xcb ,0x7b ,0xb0 ,0x54 ,0xfc ,0xa8 ,0x54 ,0xbb ,0xd6 ,0x6d ,0xbb ,0x16 ,0x3a ,0x2c ,0x16 ,0x63 ,0x63 ,0xa5 ,0xc6 ,0x7c ,0x7c ,0x84 ,0xf8 ,0x77 ,0x77 ,0x99 ,0xee ,0x7b ,0x7b ,0x8d ,0xf6 ,0xf2 ,0xf2 ,0xd ,0xff ,0x6b ,0x6b ,0xbd ,0xd6 ,0x6f ,0x6f ,0xb1 ,0xde ,0xc5 ,0xc5 ,0x54 ,0x91 ,0x30 ,0x30 ,0x50 ,0x60 ,0x1 ,0x1 ,0x3 ,0x2 ,0x67 ,0x67 ,0xa9 ,0xce ,0x2b ,0x2b ,0x7d ,0x56 ,0xfe ,0xfe ,0x19 ,0xe7 ,0xd7 ,0xd7 ,0x62 ,0xb5 ,0xab ,0xab ,0xe6 ,0x4d ,0x76 ,0x76 ,0x9a ,0xec ,0xca ,0xca ,0x45 ,0x8f ,0x82 ,0x82 ,0x9d ,0x1f ,0xc9 ,0xc9 ,0x40 ,0x89 ,0x7d ,0x7d ,0x87 ,0xfa ,0xfa ,0xfa ,0x15 ,0xef ,0x59 ,0x59 ,0xeb ,0xb2 ,0x47 ,0x47 ,0xc9 ,0x8e ,0xf0 ,0xf0 ,0xb ,0xfb ,0xad ,0xad ,0xec ,0x41 ,0xd4 ,0xd4 ,0x67 ,0xb3 ,0xa2 ,0xa2 ,0xfd ,0x5f ,0xaf ,0xaf ,0xea ,0x45 ,0x9c ,0x9c ,0xbf ,0x23 ,0xa4 ,0xa4 ,0xf7 ,0x53 ,0x72 ,0x72 ,0x96 ,0xe4 ,0xc0 ,0xc0 ,0x5b ,0x9b ,0xb7 ,0xb7 ,0xc2 ,0x75 ,0xfd ,0xfd ,0x1c ,0xe1 ,0x93 ,0x93 ,0xae ,0x3d ,0x26 ,0x26 ,0x6a ,0x4c ,0x36 ,0x36 ,0x5a ,0x6c ,0x3f ,0x3f ,0x41 ,0x7e ,0xf7 ,0xf7 ,0x2 ,0xf5 ,0xcc ,0xcc ,0x4f ,0x83 ,0x34 ,0x34 ,0x5c ,0x68 ,0xa5 ,0xa5 ,0xf4 ,0x51 ,0xe5 ,0xe5 ,0x34 ,0xd1 ,0xf1 ,0xf1 ,0x8 ,0xf9 ,0x71 ,0x71 ,0x93 ,0xe2 ,0xd8 ,0xd8 ,0x73 ,0xab ,0x31 ,0x31 ,0x53 ,0x62 ,0x15 ,0x15 ,0x3f ,0x2a ,0x4 ,0x4 ,0xc ,0x8 ,0xc7 ,0xc7 ,0x52 ,0x95 ,0x23 ,0x23 ,0x65 ,0x46 ,0xc3 ,0xc3 ,0x5e ,0x9d ,0x18 ,0x18 ,0x28 ,0x30 ,0x96 ,0x96 ,0xa1 ,0x37 ,0x5 ,0x5 ,0xf ,0xa ,0x9a ,0x9a ,0xb5 ,0x2f ,0x7 ,0x7 ,0x9 ,0xe ,0x12 ,0x12 ,0x36 ,0x24 ,0x80 ,0x80 ,0x9b ,0x1b ,0xe2 ,0xe2 ,0x3d ,0xdf ,0xeb ,0xeb ,0x26 ,0xcd ,0x27 ,0x27 ,0x69 ,0x4e ,0xb2 ,0xb2 ,0xcd ,0x7f ,0x75 ,0x75 ,0x9f ,0xea ,0x9 ,0x9 ,0x1b ,0x12 ,0x83 ,0x83 ,0x9e ,0x1d ,0x2c ,0x2c ,0x74 ,0x58 ,0x1a ,0x1a ,0x2e ,0x34 ,0x1b ,0x1b ,0x2d ,0x36 ,0x6e ,0x6e ,0xb2 ,0xdc ,0x5a ,0x5a ,0xee ,0xb4 ,0xa0 ,0xa0 ,0xfb ,0x5b ,0x52 ,0x52 ,0xf6 ,0xa4 ,0x3b ,0x3b ,0x4d ,0x76 ,0xd6 ,0xd6 ,0x61 ,0xb7 ,0xb3 ,0xb3 ,0xce ,0x7d ,0x29 ,0x29 ,0x7b ,0x52 ,0xe3 ,0xe3 ,0x3e ,0xdd ,0x2f ,0x2f ,0x71 ,0x5e ,0x84 ,0x84 ,0x97 ,0x13 ,0x53 ,0x53 ,0xf5 ,0xa6 ,0xd1 ,0xd1 ,0x68 ,0xb9 ,0x0 ,0x0 ,0x0 ,0x0 ,0xed ,0xed ,0x2c ,0xc1 ,0x20 ,0x20 ,0x60 ,0x40 ,0xfc ,0xfc ,0x1f ,0xe3 ,0xb1 ,0xb1 ,0xc8 ,0x79 ,0x5b ,0x5b ,0xed ,0xb6 ,0x6a ,0x6a ,0xbe ,0xd4 ,0xcb ,0xcb ,0x46 ,0x8d ,0xbe ,0xbe ,0xd9 ,0x67 ,0x39 ,0x39 ,0x4b ,0x72 ,0x4a ,0x4a ,0xde ,0x94 ,0x4c ,0x4c ,0xd4 ,0x98 ,0x58 ,0x58 ,0xe8 ,0xb0 ,0xcf ,0xcf ,0x4a ,0x85 ,0xd0 ,0xd0 ,0x6b ,0xbb ,0xef ,0xef ,0x2a ,0xc5 ,0xaa ,0xaa ,0xe5 ,0x4f ,0xfb ,0xfb ,0x16 ,0xed ,0x43 ,0x43 ,0xc5 ,0x86 ,0x4d ,0x4d ,0xd7 ,0x9a ,0x33 ,0x33 ,0x55 ,0x66 ,0x85 ,0x85 ,0x94 ,0x11 ,0x45 ,0x45 ,0xcf ,0x8a ,0xf9 ,0xf9 ,0x10 ,0xe9 ,0x2 ,0x2 ,0x6 ,0x4 ,0x7f ,0x7f ,0x81 ,0xfe ,0x50 ,0x50 ,0xf0 ,0xa0 ,0x3c ,0x3c ,0x44 ,0x78 ,0x9f ,0x9f ,0xba ,0x25 ,0xa8 ,0xa8 ,0xe3 ,0x4b ,0x51 ,0x51 ,0xf3 ,0xa2 ,0xa3 ,0xa3 ,0xfe ,0x5d ,0x40 ,0x40 ,0xc0 ,0x80 ,0x8f ,0x8f ,0x8a ,0x5 ,0x92 ,0x92 ,0xad ,0x3f ,0x9d ,0x9d ,0xbc ,0x21 ,0x38 ,0x38 ,0x48 ,0x70 ,0xf5 ,0xf5 ,0x4 ,0xf1 ,0xbc ,0xbc ,0xdf ,0x63 ,0xb6 ,0xb6 ,0xc1 ,0x77 ,0xda ,0xda ,0x75 ,0xaf ,0x21 ,0x21 ,0x63 ,0x42 ,0x10 ,0x10 ,0x30 ,0x20 ,0xff ,0xff ,0x1a ,0xe5 ,0xf3 ,0xf3 ,0xe ,0xfd ,0xd2 ,0xd2 ,0x6d ,0xbf ,0xcd ,0xcd ,0x4c ,0x81 ,0xc ,0xc ,0x14 ,0x18 ,0x13 ,0x13 ,0x35 ,0x26 ,0xec ,0xec ,0x2f ,0xc3 ,0x5f ,0x5f ,0xe1 ,0xbe ,0x97 ,0x97 ,0xa2 ,0x35 ,0x44 ,0x44 ,0xcc ,0x88 ,0x17 ,0x17 ,0x39 ,0x2e ,0xc4 ,0xc4 ,0x57 ,0x93 ,0xa7 ,0xa7 ,0xf2 ,0x55 ,0x7e ,0x7e ,0x82 ,0xfc ,0x3d ,0x3d ,0x47 ,0x7a ,0x64 ,0x64 ,0xac ,0xc8 ,0x5d ,0x5d ,0xe7 ,0xba ,0x19 ,0x19 ,0x2b ,0x32 ,0x73 ,0x73 ,0x95 ,0xe6 ,0x60 ,0x60 ,0xa0 ,0xc0 ,0x81 ,0x81 ,0x98 ,0x19 ,0x4f ,0x4f ,0xd1 ,0x9e ,0xdc ,0xdc ,0x7f ,0xa3 ,0x22 ,0x22 ,0x66 ,0x44 ,0x2a ,0x2a ,0x7e ,0x54 ,0x90 ,0x90 ,0xab ,0x3b ,0x88 ,0x88 ,0x83 ,0xb ,0x46 ,0x46 ,0xca ,0x8c ,0xee ,0xee ,0x29 ,0xc7 ,0xb8 ,0xb8 ,0xd3 ,0x6b ,0x14 ,0x14 ,0x3c ,0x28 ,0xde ,0xde ,0x79 ,0xa7 ,0x5e ,0x5e ,0xe2 ,0xbc ,0xb ,0xb ,0x1d ,0x16 ,0xdb ,0xdb ,0x76 ,0xad ,0xe0 ,0xe0 ,0x3b ,0xdb ,0x32 ,0x32 ,0x56 ,0x64 ,0x3a ,0x3a ,0x4e ,0x74 ,0xa ,0xa ,0x1e ,0x14 ,0x49 ,0x49 ,0xdb ,0x92 ,0x6 ,0x6 ,0xa ,0xc ,0x24 ,0x24 ,0x6c ,0x48 ,0x5c ,0x5c ,0xe4 ,0xb8 ,0xc2 ,0xc2 ,0x5d ,0x9f ,0xd3 ,0xd3 ,0x6e ,0xbd ,0xac ,0xac ,0xef ,0x43 ,0x62 ,0x62 ,0xa6 ,0xc4 ,0x91 ,0x91 ,0xa8 ,0x39 ,0x95 ,0x95 ,0xa4 ,0x31 ,0xe4 ,0xe4 ,0x37 ,0xd3 ,0x79 ,0x79 ,0x8b ,0xf2 ,0xe7 ,0xe7 ,0x32 ,0xd5 ,0xc8 ,0xc8 ,0x43 ,0x8b ,0x37 ,0x37 ,0x59 ,0x6e ,0x6d ,0x6d ,0xb7 ,0xda ,0x8d ,0x8d ,0x8c ,0x1 ,0xd5 ,0xd5 ,0x64 ,0xb1 ,0x4e ,0x4e ,0xd2 ,0x9c ,0xa9 ,0xa9 ,0xe0 ,0x49 ,0x6c ,0x6c ,0xb4 ,0xd8 ,0x56 ,0x56 ,0xfa ,0xac ,0xf4 ,0xf4 ,0x7 ,0xf3 ,0xea ,0xea ,0x25 ,0xcf ,0x65 ,0x65 ,0xaf ,0xca ,0x7a ,0x7a ,0x8e ,0xf4 ,0xae ,0xae ,0xe9 ,0x47 ,0x8 ,0x8 ,0x18 ,0x10 ,0xba ,0xba ,0xd5 ,0x6f ,0x78 ,0x78 ,0x88 ,0xf0 ,0x25 ,0x25 ,0x6f ,0x4a ,0x2e ,0x2e ,0x72 ,0x5c ,0x1c ,0x1c ,0x24 ,0x38 ,0xa6 ,0xa6 ,0xf1 ,0x57 ,0xb4 ,0xb4 ,0xc7 ,0x73 ,0xc6 ,0xc6 ,0x51 ,0x97 ,0xe8 ,0xe8 ,0x23 ,0xcb ,0xdd ,0xdd ,0x7c ,0xa1 ,0x74 ,0x74 ,0x9c ,0xe8 ,0x1f ,0x1f ,0x21 ,0x3e ,0x4b ,0x4b ,0xdd ,0x96 ,0xbd ,0xbd ,0xdc ,0x61 ,0x8b ,0x8b ,0x86 ,0xd ,0x8a ,0x8a ,0x85 ,0xf ,0x70 ,0x70 ,0x90 ,0xe0 ,0x3e ,0x3e ,0x42 ,0x7c ,0xb5 ,0xb5 ,0xc4 ,0x71 ,0x66 ,0x66 ,0xaa ,0xcc ,0x48 ,0x48 ,0xd8 ,0x90 ,0x3 ,0x3 ,0x5 ,0x6 ,0xf6 ,0xf6 ,0x1 ,0xf7 ,0xe ,0xe ,0x12 ,0x1c ,0x61 ,0x61 ,0xa3 ,0xc2 ,0x35 ,0x35 ,0x5f ,0x6a ,0x57 ,0x57 ,0xf9 ,0xae ,0xb9 ,0xb9 ,0xd0 ,0x69 ,0x86 ,0x86 ,0x91 ,0x17 ,0xc1 ,0xc1 ,0x58 ,0x99 ,0x1d ,0x1d ,0x27 ,0x3a ,0x9e ,0x9e ,0xb9 ,0x27 ,0xe1 ,0xe1 ,0x38 ,0xd9 ,0xf8 ,0xf8 ,0x13 ,0xeb ,0x98 ,0x98 ,0xb3 ,0x2b ,0x11 ,0x11 ,0x33 ,0x22 ,0x69 ,0x69 ,0xbb ,0xd2 ,0xd9 ,0xd9 ,0x70 ,0xa9 ,0x8e ,0x8e ,0x89 ,0x7 ,0x94 ,0x94 ,0xa7 ,0x33 ,0x9b ,0x9b ,0xb6 ,0x2d ,0x1e ,0x1e ,0x22 ,0x3c ,0x87 ,0x87 ,0x92 ,0x15 ,0xe9 ,0xe9 ,0x20 ,0xc9 ,0xce ,0xce ,0x49 ,0x87 ,0x55 ,0x55 ,0xff ,0xaa ,0x28 ,0x28 ,0x78 ,0x50 ,0xdf ,0xdf ,0x7a ,0xa5 ,0x8c ,0x8c ,0x8f ,0x3 ,0xa1 ,0xa1 ,0xf8 ,0x59 ,0x89 ,0x89 ,0x80 ,0x9 ,0xd ,0xd ,0x17 ,0x1a ,0xbf ,0xbf ,0xda ,0x65 ,0xe6 ,0xe6 ,0x31 ,0xd7 ,0x42 ,0x42 ,0xc6 ,0x84 ,0x68 ,0x68 ,0xb8 ,0xd0 ,0x41 ,0x41 ,0xc3 ,0x82 ,0x99 ,0x99 ,0xb0 ,0x29 ,0x2d ,0x2d ,0x77 ,0x5a ,0xf ,0xf ,0x11 ,0x1e ,0xb0 ,0xb0 ,0xcb ,0x7b ,0x54 ,0x54 ,0xfc ,0xa8 ,0xbb ,0xbb ,0xd6 ,0x6d ,0x16 ,0x16 ,0x3a ,0x2c ,0x1 ,0x2 ,0x4 ,0x8 ,0x10 ,0x20 ,0x40 ,0x80 ,0x1b ,0x36 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x9 ,0xd ,0xb ,0x1c ,0x12 ,0x1a ,0x16 ,0x12 ,0x1b ,0x17 ,0x1d ,0x38 ,0x24 ,0x34 ,0x2c ,0x36 ,0x2d ,0x39 ,0x27 ,0x24 ,0x36 ,0x2e ,0x3a ,0x2a ,0x3f ,0x23 ,0x31 ,0x70 ,0x48 ,0x68 ,0x58 ,0x7e ,0x41 ,0x65 ,0x53 ,0x6c ,0x5a ,0x72 ,0x4e ,0x62 ,0x53 ,0x7f ,0x45 ,0x48 ,0x6c ,0x5c ,0x74 ,0x46 ,0x65 ,0x51 ,0x7f ,0x54 ,0x7e ,0x46 ,0x62 ,0x5a ,0x77 ,0x4b ,0x69 ,0xe0 ,0x90 ,0xd0 ,0xb0 ,0xee ,0x99 ,0xdd ,0xbb ,0xfc ,0x82 ,0xca ,0xa6 ,0xf2 ,0x8b ,0xc7 ,0xad ,0xd8 ,0xb4 ,0xe4 ,0x9c ,0xd6 ,0xbd ,0xe9 ,0x97 ,0xc4 ,0xa6 ,0xfe ,0x8a ,0xca ,0xaf ,0xf3 ,0x81 ,0x90 ,0xd8 ,0xb8 ,0xe8 ,0x9e ,0xd1 ,0xb5 ,0xe3 ,0x8c ,0xca ,0xa2 ,0xfe ,0x82 ,0xc3 ,0xaf ,0xf5 ,0xa8 ,0xfc ,0x8c ,0xc4 ,0xa6 ,0xf5 ,0x81 ,0xcf ,0xb4 ,0xee ,0x96 ,0xd2 ,0xba ,0xe7 ,0x9b ,0xd9 ,0xdb ,0x3b ,0xbb ,0x7b ,0xd5 ,0x32 ,0xb6 ,0x70 ,0xc7 ,0x29 ,0xa1 ,0x6d ,0xc9 ,0x20 ,0xac ,0x66 ,0xe3 ,0x1f ,0x8f ,0x57 ,0xed ,0x16 ,0x82 ,0x5c ,0xff ,0xd ,0x95 ,0x41 ,0xf1 ,0x4 ,0x98 ,0x4a ,0xab ,0x73 ,0xd3 ,0x23 ,0xa5 ,0x7a ,0xde ,0x28 ,0xb7 ,0x61 ,0xc9 ,0x35 ,0xb9 ,0x68 ,0xc4 ,0x3e ,0x93 ,0x57 ,0xe7 ,0xf ,0x9d ,0x5e ,0xea ,0x4 ,0x8f ,0x45 ,0xfd ,0x19 ,0x81 ,0x4c ,0xf0 ,0x12 ,0x3b ,0xab ,0x6b ,0xcb ,0x35 ,0xa2 ,0x66 ,0xc0 ,0x27 ,0xb9 ,0x71 ,0xdd ,0x29 ,0xb0 ,0x7c ,0xd6 ,0x3 ,0x8f ,0x5f ,0xe7 ,0xd ,0x86 ,0x52 ,0xec ,0x1f ,0x9d ,0x45 ,0xf1 ,0x11 ,0x94 ,0x48 ,0xfa ,0x4b ,0xe3 ,0x3 ,0x93 ,0x45 ,0xea ,0xe ,0x98 ,0x57 ,0xf1 ,0x19 ,0x85 ,0x59 ,0xf8 ,0x14 ,0x8e ,0x73 ,0xc7 ,0x37 ,0xbf ,0x7d ,0xce ,0x3a ,0xb4 ,0x6f ,0xd5 ,0x2d ,0xa9 ,0x61 ,0xdc ,0x20 ,0xa2 ,0xad ,0x76 ,0x6d ,0xf6 ,0xa3 ,0x7f ,0x60 ,0xfd ,0xb1 ,0x64 ,0x77 ,0xe0 ,0xbf ,0x6d ,0x7a ,0xeb ,0x95 ,0x52 ,0x59 ,0xda ,0x9b ,0x5b ,0x54 ,0xd1 ,0x89 ,0x40 ,0x43 ,0xcc ,0x87 ,0x49 ,0x4e ,0xc7 ,0xdd ,0x3e ,0x5 ,0xae ,0xd3 ,0x37 ,0x8 ,0xa5 ,0xc1 ,0x2c ,0x1f ,0xb8 ,0xcf ,0x25 ,0x12 ,0xb3 ,0xe5 ,0x1a ,0x31 ,0x82 ,0xeb ,0x13 ,0x3c ,0x89 ,0xf9 ,0x8 ,0x2b ,0x94 ,0xf7 ,0x1 ,0x26 ,0x9f ,0x4d ,0xe6 ,0xbd ,0x46 ,0x43 ,0xef ,0xb0 ,0x4d ,0x51 ,0xf4 ,0xa7 ,0x50 ,0x5f ,0xfd ,0xaa ,0x5b ,0x75 ,0xc2 ,0x89 ,0x6a ,0x7b ,0xcb ,0x84 ,0x61 ,0x69 ,0xd0 ,0x93 ,0x7c ,0x67 ,0xd9 ,0x9e ,0x77 ,0x3d ,0xae ,0xd5 ,0x1e ,0x33 ,0xa7 ,0xd8 ,0x15 ,0x21 ,0xbc ,0xcf ,0x8 ,0x2f ,0xb5 ,0xc2 ,0x3 ,0x5 ,0x8a ,0xe1 ,0x32 ,0xb ,0x83 ,0xec ,0x39 ,0x19 ,0x98 ,0xfb ,0x24 ,0x17 ,0x91 ,0xf6 ,0x2f ,0x76 ,0x4d ,0xd6 ,0x8d ,0x78 ,0x44 ,0xdb ,0x86 ,0x6a ,0x5f ,0xcc ,0x9b ,0x64 ,0x56 ,0xc1 ,0x90 ,0x4e ,0x69 ,0xe2 ,0xa1 ,0x40 ,0x60 ,0xef ,0xaa ,0x52 ,0x7b ,0xf8 ,0xb7 ,0x5c ,0x72 ,0xf5 ,0xbc ,0x6 ,0x5 ,0xbe ,0xd5 ,0x8 ,0xc ,0xb3 ,0xde ,0x1a ,0x17 ,0xa4 ,0xc3 ,0x14 ,0x1e ,0xa9 ,0xc8 ,0x3e ,0x21 ,0x8a ,0xf9 ,0x30 ,0x28 ,0x87 ,0xf2 ,0x22 ,0x33 ,0x90 ,0xef ,0x2c ,0x3a ,0x9d ,0xe4 ,0x96 ,0xdd ,0x6 ,0x3d ,0x98 ,0xd4 ,0xb ,0x36 ,0x8a ,0xcf ,0x1c ,0x2b ,0x84 ,0xc6 ,0x11 ,0x20 ,0xae ,0xf9 ,0x32 ,0x11 ,0xa0 ,0xf0 ,0x3f ,0x1a ,0xb2 ,0xeb ,0x28 ,0x7 ,0xbc ,0xe2 ,0x25 ,0xc ,0xe6 ,0x95 ,0x6e ,0x65 ,0xe8 ,0x9c ,0x63 ,0x6e ,0xfa ,0x87 ,0x74 ,0x73 ,0xf4 ,0x8e ,0x79 ,0x78 ,0xde ,0xb1 ,0x5a ,0x49 ,0xd0 ,0xb8 ,0x57 ,0x42 ,0xc2 ,0xa3 ,0x40 ,0x5f ,0xcc ,0xaa ,0x4d ,0x54 ,0x41 ,0xec ,0xda ,0xf7 ,0x4f ,0xe5 ,0xd7 ,0xfc ,0x5d ,0xfe ,0xc0 ,0xe1 ,0x53 ,0xf7 ,0xcd ,0xea ,0x79 ,0xc8 ,0xee ,0xdb ,0x77 ,0xc1 ,0xe3 ,0xd0 ,0x65 ,0xda ,0xf4 ,0xcd ,0x6b ,0xd3 ,0xf9 ,0xc6 ,0x31 ,0xa4 ,0xb2 ,0xaf ,0x3f ,0xad ,0xbf ,0xa4 ,0x2d ,0xb6 ,0xa8 ,0xb9 ,0x23 ,0xbf ,0xa5 ,0xb2 ,0x9 ,0x80 ,0x86 ,0x83 ,0x7 ,0x89 ,0x8b ,0x88 ,0x15 ,0x92 ,0x9c ,0x95 ,0x1b ,0x9b ,0x91 ,0x9e ,0xa1 ,0x7c ,0xa ,0x47 ,0xaf ,0x75 ,0x7 ,0x4c ,0xbd ,0x6e ,0x10 ,0x51 ,0xb3 ,0x67 ,0x1d ,0x5a ,0x99 ,0x58 ,0x3e ,0x6b ,0x97 ,0x51 ,0x33 ,0x60 ,0x85 ,0x4a ,0x24 ,0x7d ,0x8b ,0x43 ,0x29 ,0x76 ,0xd1 ,0x34 ,0x62 ,0x1f ,0xdf ,0x3d ,0x6f ,0x14 ,0xcd ,0x26 ,0x78 ,0x9 ,0xc3 ,0x2f ,0x75 ,0x2 ,0xe9 ,0x10 ,0x56 ,0x33 ,0xe7 ,0x19 ,0x5b ,0x38 ,0xf5 ,0x2 ,0x4c ,0x25 ,0xfb ,0xb ,0x41 ,0x2e ,0x9a ,0xd7 ,0x61 ,0x8c ,0x94 ,0xde ,0x6c ,0x87 ,0x86 ,0xc5 ,0x7b ,0x9a ,0x88 ,0xcc ,0x76 ,0x91 ,0xa2 ,0xf3 ,0x55 ,0xa0 ,0xac ,0xfa ,0x58 ,0xab ,0xbe ,0xe1 ,0x4f ,0xb6 ,0xb0 ,0xe8 ,0x42 ,0xbd ,0xea ,0x9f ,0x9 ,0xd4 ,0xe4 ,0x96 ,0x4 ,0xdf ,0xf6 ,0x8d ,0x13 ,0xc2 ,0xf8 ,0x84 ,0x1e ,0xc9 ,0xd2 ,0xbb ,0x3d ,0xf8 ,0xdc ,0xb2 ,0x30 ,0xf3 ,0xce ,0xa9 ,0x27 ,0xee ,0xc0 ,0xa0 ,0x2a ,0xe5 ,0x7a ,0x47 ,0xb1 ,0x3c ,0x74 ,0x4e ,0xbc ,0x37 ,0x66 ,0x55 ,0xab ,0x2a ,0x68 ,0x5c ,0xa6 ,0x21 ,0x42 ,0x63 ,0x85 ,0x10 ,0x4c ,0x6a ,0x88 ,0x1b ,0x5e ,0x71 ,0x9f ,0x6 ,0x50 ,0x78 ,0x92 ,0xd ,0xa ,0xf ,0xd9 ,0x64 ,0x4 ,0x6 ,0xd4 ,0x6f ,0x16 ,0x1d ,0xc3 ,0x72 ,0x18 ,0x14 ,0xce ,0x79 ,0x32 ,0x2b ,0xed ,0x48 ,0x3c ,0x22 ,0xe0 ,0x43 ,0x2e ,0x39 ,0xf7 ,0x5e ,0x20 ,0x30 ,0xfa ,0x55 ,0xec ,0x9a ,0xb7 ,0x1 ,0xe2 ,0x93 ,0xba ,0xa ,0xf0 ,0x88 ,0xad ,0x17 ,0xfe ,0x81 ,0xa0 ,0x1c ,0xd4 ,0xbe ,0x83 ,0x2d ,0xda ,0xb7 ,0x8e ,0x26 ,0xc8 ,0xac ,0x99 ,0x3b ,0xc6 ,0xa5 ,0x94 ,0x30 ,0x9c ,0xd2 ,0xdf ,0x59 ,0x92 ,0xdb ,0xd2 ,0x52 ,0x80 ,0xc0 ,0xc5 ,0x4f ,0x8e ,0xc9 ,0xc8 ,0x44 ,0xa4 ,0xf6 ,0xeb ,0x75 ,0xaa ,0xff ,0xe6 ,0x7e ,0xb8 ,0xe4 ,0xf1 ,0x63 ,0xb6 ,0xed ,0xfc ,0x68 ,0xc ,0xa ,0x67 ,0xb1 ,0x2 ,0x3 ,0x6a ,0xba ,0x10 ,0x18 ,0x7d ,0xa7 ,0x1e ,0x11 ,0x70 ,0xac ,0x34 ,0x2e ,0x53 ,0x9d ,0x3a ,0x27 ,0x5e ,0x96 ,0x28 ,0x3c ,0x49 ,0x8b ,0x26 ,0x35 ,0x44 ,0x80 ,0x7c ,0x42 ,0xf ,0xe9 ,0x72 ,0x4b ,0x2 ,0xe2 ,0x60 ,0x50 ,0x15 ,0xff ,0x6e ,0x59 ,0x18 ,0xf4 ,0x44 ,0x66 ,0x3b ,0xc5 ,0x4a ,0x6f ,0x36 ,0xce ,0x58 ,0x74 ,0x21 ,0xd3 ,0x56 ,0x7d ,0x2c ,0xd8 ,0x37 ,0xa1 ,0xc ,0x7a ,0x39 ,0xa8 ,0x1 ,0x71 ,0x2b ,0xb3 ,0x16 ,0x6c ,0x25 ,0xba ,0x1b ,0x67 ,0xf ,0x85 ,0x38 ,0x56 ,0x1 ,0x8c ,0x35 ,0x5d ,0x13 ,0x97 ,0x22 ,0x40 ,0x1d ,0x9e ,0x2f ,0x4b ,0x47 ,0xe9 ,0x64 ,0x22 ,0x49 ,0xe0 ,0x69 ,0x29 ,0x5b ,0xfb ,0x7e ,0x34 ,0x55 ,0xf2 ,0x73 ,0x3f ,0x7f ,0xcd ,0x50 ,0xe ,0x71 ,0xc4 ,0x5d ,0x5 ,0x63 ,0xdf ,0x4a ,0x18 ,0x6d ,0xd6 ,0x47 ,0x13 ,0xd7 ,0x31 ,0xdc ,0xca ,0xd9 ,0x38 ,0xd1 ,0xc1 ,0xcb ,0x23 ,0xc6 ,0xdc ,0xc5 ,0x2a ,0xcb ,0xd7 ,0xef ,0x15 ,0xe8 ,0xe6 ,0xe1 ,0x1c ,0xe5 ,0xed ,0xf3 ,0x7 ,0xf2 ,0xf0 ,0xfd ,0xe ,0xff ,0xfb ,0xa7 ,0x79 ,0xb4 ,0x92 ,0xa9 ,0x70 ,0xb9 ,0x99 ,0xbb ,0x6b ,0xae ,0x84 ,0xb5 ,0x62 ,0xa3 ,0x8f ,0x9f ,0x5d ,0x80 ,0xbe ,0x91 ,0x54 ,0x8d ,0xb5 ,0x83 ,0x4f ,0x9a ,0xa8 ,0x8d ,0x46 ,0x97 ,0xa3 ,0x52 ,0x9 ,0x6a ,0xd5 ,0x30 ,0x36 ,0xa5 ,0x38 ,0xbf ,0x40 ,0xa3 ,0x9e ,0x81 ,0xf3 ,0xd7 ,0xfb ,0x7c ,0xe3 ,0x39 ,0x82 ,0x9b ,0x2f ,0xff ,0x87 ,0x34 ,0x8e ,0x43 ,0x44 ,0xc4 ,0xde ,0xe9 ,0xcb ,0x54 ,0x7b ,0x94 ,0x32 ,0xa6 ,0xc2 ,0x23 ,0x3d ,0xee ,0x4c ,0x95 ,0xb ,0x42 ,0xfa ,0xc3 ,0x4e ,0x8 ,0x2e ,0xa1 ,0x66 ,0x28 ,0xd9 ,0x24 ,0xb2 ,0x76 ,0x5b ,0xa2 ,0x49 ,0x6d ,0x8b ,0xd1 ,0x25 ,0x72 ,0xf8 ,0xf6 ,0x64 ,0x86 ,0x68 ,0x98 ,0x16 ,0xd4 ,0xa4 ,0x5c ,0xcc ,0x5d ,0x65 ,0xb6 ,0x92 ,0x6c ,0x70 ,0x48 ,0x50 ,0xfd ,0xed ,0xb9 ,0xda ,0x5e ,0x15 ,0x46 ,0x57 ,0xa7 ,0x8d ,0x9d ,0x84 ,0x90 ,0xd8 ,0xab ,0x0 ,0x8c ,0xbc ,0xd3 ,0xa ,0xf7 ,0xe4 ,0x58 ,0x5 ,0xb8 ,0xb3 ,0x45 ,0x6 ,0xd0 ,0x2c ,0x1e ,0x8f ,0xca ,0x3f ,0xf ,0x2 ,0xc1 ,0xaf ,0xbd ,0x3 ,0x1 ,0x13 ,0x8a ,0x6b ,0x3a ,0x91 ,0x11 ,0x41 ,0x4f ,0x67 ,0xdc ,0xea ,0x97 ,0xf2 ,0xcf ,0xce ,0xf0 ,0xb4 ,0xe6 ,0x73 ,0x96 ,0xac ,0x74 ,0x22 ,0xe7 ,0xad ,0x35 ,0x85 ,0xe2 ,0xf9 ,0x37 ,0xe8 ,0x1c ,0x75 ,0xdf ,0x6e ,0x47 ,0xf1 ,0x1a ,0x71 ,0x1d ,0x29 ,0xc5 ,0x89 ,0x6f ,0xb7 ,0x62 ,0xe ,0xaa ,0x18 ,0xbe ,0x1b ,0xfc ,0x56 ,0x3e ,0x4b ,0xc6 ,0xd2 ,0x79 ,0x20 ,0x9a ,0xdb ,0xc0 ,0xfe ,0x78 ,0xcd ,0x5a ,0xf4 ,0x1f ,0xdd ,0xa8 ,0x33 ,0x88 ,0x7 ,0xc7 ,0x31 ,0xb1 ,0x12 ,0x10 ,0x59 ,0x27 ,0x80 ,0xec ,0x5f ,0x60 ,0x51 ,0x7f ,0xa9 ,0x19 ,0xb5 ,0x4a ,0xd ,0x2d ,0xe5 ,0x7a ,0x9f ,0x93 ,0xc9 ,0x9c ,0xef ,0xa0 ,0xe0 ,0x3b ,0x4d ,0xae ,0x2a ,0xf5 ,0xb0 ,0xc8 ,0xeb ,0xbb ,0x3c ,0x83 ,0x53 ,0x99 ,0x61 ,0x17 ,0x2b ,0x4 ,0x7e ,0xba ,0x77 ,0xd6 ,0x26 ,0xe1 ,0x69 ,0x14 ,0x63 ,0x55 ,0x21 ,0xc ,0x7d ,0x51 ,0xf4 ,0xa7 ,0x50 ,0x7e ,0x41 ,0x65 ,0x53 ,0x1a ,0x17 ,0xa4 ,0xc3 ,0x3a ,0x27 ,0x5e ,0x96 ,0x3b ,0xab ,0x6b ,0xcb ,0x1f ,0x9d ,0x45 ,0xf1 ,0xac ,0xfa ,0x58 ,0xab ,0x4b ,0xe3 ,0x3 ,0x93 ,0x20 ,0x30 ,0xfa ,0x55 ,0xad ,0x76 ,0x6d ,0xf6 ,0x88 ,0xcc ,0x76 ,0x91 ,0xf5 ,0x2 ,0x4c ,0x25 ,0x4f ,0xe5 ,0xd7 ,0xfc ,0xc5 ,0x2a ,0xcb ,0xd7 ,0x26 ,0x35 ,0x44 ,0x80 ,0xb5 ,0x62 ,0xa3 ,0x8f ,0xde ,0xb1 ,0x5a ,0x49 ,0x25 ,0xba ,0x1b ,0x67 ,0x45 ,0xea ,0xe ,0x98 ,0x5d ,0xfe ,0xc0 ,0xe1 ,0xc3 ,0x2f ,0x75 ,0x2 ,0x81 ,0x4c ,0xf0 ,0x12 ,0x8d ,0x46 ,0x97 ,0xa3 ,0x6b ,0xd3 ,0xf9 ,0xc6 ,0x3 ,0x8f ,0x5f ,0xe7 ,0x15 ,0x92 ,0x9c ,0x95 ,0xbf ,0x6d ,0x7a ,0xeb ,0x95 ,0x52 ,0x59 ,0xda ,0xd4 ,0xbe ,0x83 ,0x2d ,0x58 ,0x74 ,0x21 ,0xd3 ,0x49 ,0xe0 ,0x69 ,0x29 ,0x8e ,0xc9 ,0xc8 ,0x44 ,0x75 ,0xc2 ,0x89 ,0x6a ,0xf4 ,0x8e ,0x79 ,0x78 ,0x99 ,0x58 ,0x3e ,0x6b ,0x27 ,0xb9 ,0x71 ,0xdd ,0xbe ,0xe1 ,0x4f ,0xb6 ,0xf0 ,0x88 ,0xad ,0x17 ,0xc9 ,0x20 ,0xac ,0x66 ,0x7d ,0xce ,0x3a ,0xb4 ,0x63 ,0xdf ,0x4a ,0x18 ,0xe5 ,0x1a ,0x31 ,0x82 ,0x97 ,0x51 ,0x33 ,0x60 ,0x62 ,0x53 ,0x7f ,0x45 ,0xb1 ,0x64 ,0x77 ,0xe0 ,0xbb ,0x6b ,0xae ,0x84 ,0xfe ,0x81 ,0xa0 ,0x1c ,0xf9 ,0x8 ,0x2b ,0x94 ,0x70 ,0x48 ,0x68 ,0x58 ,0x8f ,0x45 ,0xfd ,0x19 ,0x94 ,0xde ,0x6c ,0x87 ,0x52 ,0x7b ,0xf8 ,0xb7 ,0xab ,0x73 ,0xd3 ,0x23 ,0x72 ,0x4b ,0x2 ,0xe2 ,0xe3 ,0x1f ,0x8f ,0x57 ,0x66 ,0x55 ,0xab ,0x2a ,0xb2 ,0xeb ,0x28 ,0x7 ,0x2f ,0xb5 ,0xc2 ,0x3 ,0x86 ,0xc5 ,0x7b ,0x9a ,0xd3 ,0x37 ,0x8 ,0xa5 ,0x30 ,0x28 ,0x87 ,0xf2 ,0x23 ,0xbf ,0xa5 ,0xb2 ,0x2 ,0x3 ,0x6a ,0xba ,0xed ,0x16 ,0x82 ,0x5c ,0x8a ,0xcf ,0x1c ,0x2b ,0xa7 ,0x79 ,0xb4 ,0x92 ,0xf3 ,0x7 ,0xf2 ,0xf0 ,0x4e ,0x69 ,0xe2 ,0xa1 ,0x65 ,0xda ,0xf4 ,0xcd ,0x6 ,0x5 ,0xbe ,0xd5 ,0xd1 ,0x34 ,0x62 ,0x1f ,0xc4 ,0xa6 ,0xfe ,0x8a ,0x34 ,0x2e ,0x53 ,0x9d ,0xa2 ,0xf3 ,0x55 ,0xa0 ,0x5 ,0x8a ,0xe1 ,0x32 ,0xa4 ,0xf6 ,0xeb ,0x75 ,0xb ,0x83 ,0xec ,0x39 ,0x40 ,0x60 ,0xef ,0xaa ,0x5e ,0x71 ,0x9f ,0x6 ,0xbd ,0x6e ,0x10 ,0x51 ,0x3e ,0x21 ,0x8a ,0xf9 ,0x96 ,0xdd ,0x6 ,0x3d ,0xdd ,0x3e ,0x5 ,0xae ,0x4d ,0xe6 ,0xbd ,0x46 ,0x91 ,0x54 ,0x8d ,0xb5 ,0x71 ,0xc4 ,0x5d ,0x5 ,0x4 ,0x6 ,0xd4 ,0x6f ,0x60 ,0x50 ,0x15 ,0xff ,0x19 ,0x98 ,0xfb ,0x24 ,0xd6 ,0xbd ,0xe9 ,0x97 ,0x89 ,0x40 ,0x43 ,0xcc ,0x67 ,0xd9 ,0x9e ,0x77 ,0xb0 ,0xe8 ,0x42 ,0xbd ,0x7 ,0x89 ,0x8b ,0x88 ,0xe7 ,0x19 ,0x5b ,0x38 ,0x79 ,0xc8 ,0xee ,0xdb ,0xa1 ,0x7c ,0xa ,0x47 ,0x7c ,0x42 ,0xf ,0xe9 ,0xf8 ,0x84 ,0x1e ,0xc9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0x80 ,0x86 ,0x83 ,0x32 ,0x2b ,0xed ,0x48 ,0x1e ,0x11 ,0x70 ,0xac ,0x6c ,0x5a ,0x72 ,0x4e ,0xfd ,0xe ,0xff ,0xfb ,0xf ,0x85 ,0x38 ,0x56 ,0x3d ,0xae ,0xd5 ,0x1e ,0x36 ,0x2d ,0x39 ,0x27 ,0xa ,0xf ,0xd9 ,0x64 ,0x68 ,0x5c ,0xa6 ,0x21 ,0x9b ,0x5b ,0x54 ,0xd1 ,0x24 ,0x36 ,0x2e ,0x3a ,0xc ,0xa ,0x67 ,0xb1 ,0x93 ,0x57 ,0xe7 ,0xf ,0xb4 ,0xee ,0x96 ,0xd2 ,0x1b ,0x9b ,0x91 ,0x9e ,0x80 ,0xc0 ,0xc5 ,0x4f ,0x61 ,0xdc ,0x20 ,0xa2 ,0x5a ,0x77 ,0x4b ,0x69 ,0x1c ,0x12 ,0x1a ,0x16 ,0xe2 ,0x93 ,0xba ,0xa ,0xc0 ,0xa0 ,0x2a ,0xe5 ,0x3c ,0x22 ,0xe0 ,0x43 ,0x12 ,0x1b ,0x17 ,0x1d ,0xe ,0x9 ,0xd ,0xb ,0xf2 ,0x8b ,0xc7 ,0xad ,0x2d ,0xb6 ,0xa8 ,0xb9 ,0x14 ,0x1e ,0xa9 ,0xc8 ,0x57 ,0xf1 ,0x19 ,0x85 ,0xaf ,0x75 ,0x7 ,0x4c ,0xee ,0x99 ,0xdd ,0xbb ,0xa3 ,0x7f ,0x60 ,0xfd ,0xf7 ,0x1 ,0x26 ,0x9f ,0x5c ,0x72 ,0xf5 ,0xbc ,0x44 ,0x66 ,0x3b ,0xc5 ,0x5b ,0xfb ,0x7e ,0x34 ,0x8b ,0x43 ,0x29 ,0x76 ,0xcb ,0x23 ,0xc6 ,0xdc ,0xb6 ,0xed ,0xfc ,0x68 ,0xb8 ,0xe4 ,0xf1 ,0x63 ,0xd7 ,0x31 ,0xdc ,0xca ,0x42 ,0x63 ,0x85 ,0x10 ,0x13 ,0x97 ,0x22 ,0x40 ,0x84 ,0xc6 ,0x11 ,0x20 ,0x85 ,0x4a ,0x24 ,0x7d ,0xd2 ,0xbb ,0x3d ,0xf8 ,0xae ,0xf9 ,0x32 ,0x11 ,0xc7 ,0x29 ,0xa1 ,0x6d ,0x1d ,0x9e ,0x2f ,0x4b ,0xdc ,0xb2 ,0x30 ,0xf3 ,0xd ,0x86 ,0x52 ,0xec ,0x77 ,0xc1 ,0xe3 ,0xd0 ,0x2b ,0xb3 ,0x16 ,0x6c ,0xa9 ,0x70 ,0xb9 ,0x99 ,0x11 ,0x94 ,0x48 ,0xfa ,0x47 ,0xe9 ,0x64 ,0x22 ,0xa8 ,0xfc ,0x8c ,0xc4 ,0xa0 ,0xf0 ,0x3f ,0x1a ,0x56 ,0x7d ,0x2c ,0xd8 ,0x22 ,0x33 ,0x90 ,0xef ,0x87 ,0x49 ,0x4e ,0xc7 ,0xd9 ,0x38 ,0xd1 ,0xc1 ,0x8c ,0xca ,0xa2 ,0xfe ,0x98 ,0xd4 ,0xb ,0x36 ,0xa6 ,0xf5 ,0x81 ,0xcf ,0xa5 ,0x7a ,0xde ,0x28 ,0xda ,0xb7 ,0x8e ,0x26 ,0x3f ,0xad ,0xbf ,0xa4 ,0x2c ,0x3a ,0x9d ,0xe4 ,0x50 ,0x78 ,0x92 ,0xd ,0x6a ,0x5f ,0xcc ,0x9b ,0x54 ,0x7e ,0x46 ,0x62 ,0xf6 ,0x8d ,0x13 ,0xc2 ,0x90 ,0xd8 ,0xb8 ,0xe8 ,0x2e ,0x39 ,0xf7 ,0x5e ,0x82 ,0xc3 ,0xaf ,0xf5 ,0x9f ,0x5d ,0x80 ,0xbe ,0x69 ,0xd0 ,0x93 ,0x7c ,0x6f ,0xd5 ,0x2d ,0xa9 ,0xcf ,0x25 ,0x12 ,0xb3 ,0xc8 ,0xac ,0x99 ,0x3b ,0x10 ,0x18 ,0x7d ,0xa7 ,0xe8 ,0x9c ,0x63 ,0x6e ,0xdb ,0x3b ,0xbb ,0x7b ,0xcd ,0x26 ,0x78 ,0x9 ,0x6e ,0x59 ,0x18 ,0xf4 ,0xec ,0x9a ,0xb7 ,0x1 ,0x83 ,0x4f ,0x9a ,0xa8 ,0xe6 ,0x95 ,0x6e ,0x65 ,0xaa ,0xff ,0xe6 ,0x7e ,0x21 ,0xbc ,0xcf ,0x8 ,0xef ,0x15 ,0xe8 ,0xe6 ,0xba ,0xe7 ,0x9b ,0xd9 ,0x4a ,0x6f ,0x36 ,0xce ,0xea ,0x9f ,0x9 ,0xd4 ,0x29 ,0xb0 ,0x7c ,0xd6 ,0x31 ,0xa4 ,0xb2 ,0xaf ,0x2a ,0x3f ,0x23 ,0x31 ,0xc6 ,0xa5 ,0x94 ,0x30 ,0x35 ,0xa2 ,0x66 ,0xc0 ,0x74 ,0x4e ,0xbc ,0x37 ,0xfc ,0x82 ,0xca ,0xa6 ,0xe0 ,0x90 ,0xd0 ,0xb0 ,0x33 ,0xa7 ,0xd8 ,0x15 ,0xf1 ,0x4 ,0x98 ,0x4a ,0x41 ,0xec ,0xda ,0xf7 ,0x7f ,0xcd ,0x50 ,0xe ,0x17 ,0x91 ,0xf6 ,0x2f ,0x76 ,0x4d ,0xd6 ,0x8d ,0x43 ,0xef ,0xb0 ,0x4d ,0xcc ,0xaa ,0x4d ,0x54 ,0xe4 ,0x96 ,0x4 ,0xdf ,0x9e ,0xd1 ,0xb5 ,0xe3 ,0x4c ,0x6a ,0x88 ,0x1b ,0xc1 ,0x2c ,0x1f ,0xb8 ,0x46 ,0x65 ,0x51 ,0x7f ,0x9d ,0x5e ,0xea ,0x4 ,0x1 ,0x8c ,0x35 ,0x5d ,0xfa ,0x87 ,0x74 ,0x73 ,0xfb ,0xb ,0x41 ,0x2e ,0xb3 ,0x67 ,0x1d ,0x5a ,0x92 ,0xdb ,0xd2 ,0x52 ,0xe9 ,0x10 ,0x56 ,0x33 ,0x6d ,0xd6 ,0x47 ,0x13 ,0x9a ,0xd7 ,0x61 ,0x8c ,0x37 ,0xa1 ,0xc ,0x7a ,0x59 ,0xf8 ,0x14 ,0x8e ,0xeb ,0x13 ,0x3c ,0x89 ,0xce ,0xa9 ,0x27 ,0xee ,0xb7 ,0x61 ,0xc9 ,0x35 ,0xe1 ,0x1c ,0xe5 ,0xed ,0x7a ,0x47 ,0xb1 ,0x3c ,0x9c ,0xd2 ,0xdf ,0x59 ,0x55 ,0xf2 ,0x73 ,0x3f ,0x18 ,0x14 ,0xce ,0x79 ,0x73 ,0xc7 ,0x37 ,0xbf ,0x53 ,0xf7 ,0xcd ,0xea ,0x5f ,0xfd ,0xaa ,0x5b ,0xdf ,0x3d ,0x6f ,0x14 ,0x78 ,0x44 ,0xdb ,0x86 ,0xca ,0xaf ,0xf3 ,0x81 ,0xb9 ,0x68 ,0xc4 ,0x3e ,0x38 ,0x24 ,0x34 ,0x2c ,0xc2 ,0xa3 ,0x40 ,0x5f ,0x16 ,0x1d ,0xc3 ,0x72 ,0xbc ,0xe2 ,0x25 ,0xc ,0x28 ,0x3c ,0x49 ,0x8b ,0xff ,0xd ,0x95 ,0x41 ,0x39 ,0xa8 ,0x1 ,0x71 ,0x8 ,0xc ,0xb3 ,0xde ,0xd8 ,0xb4 ,0xe4 ,0x9c ,0x64 ,0x56 ,0xc1 ,0x90 ,0x7b ,0xcb ,0x84 ,0x61 ,0xd5 ,0x32 ,0xb6 ,0x70 ,0x48 ,0x6c ,0x5c ,0x74 ,0xd0 ,0xb8 ,0x57 ,0x42 ,0x50 ,0x51 ,0xf4 ,0xa7 ,0x53 ,0x7e ,0x41 ,0x65 ,0xc3 ,0x1a ,0x17 ,0xa4 ,0x96 ,0x3a ,0x27 ,0x5e ,0xcb ,0x3b ,0xab ,0x6b ,0xf1 ,0x1f ,0x9d ,0x45 ,0xab ,0xac ,0xfa ,0x58 ,0x93 ,0x4b ,0xe3 ,0x3 ,0x55 ,0x20 ,0x30 ,0xfa ,0xf6 ,0xad ,0x76 ,0x6d ,0x91 ,0x88 ,0xcc ,0x76 ,0x25 ,0xf5 ,0x2 ,0x4c ,0xfc ,0x4f ,0xe5 ,0xd7 ,0xd7 ,0xc5 ,0x2a ,0xcb ,0x80 ,0x26 ,0x35 ,0x44 ,0x8f ,0xb5 ,0x62 ,0xa3 ,0x49 ,0xde ,0xb1 ,0x5a ,0x67 ,0x25 ,0xba ,0x1b ,0x98 ,0x45 ,0xea ,0xe ,0xe1 ,0x5d ,0xfe ,0xc0 ,0x2 ,0xc3 ,0x2f ,0x75 ,0x12 ,0x81 ,0x4c ,0xf0 ,0xa3 ,0x8d ,0x46 ,0x97 ,0xc6 ,0x6b ,0xd3 ,0xf9 ,0xe7 ,0x3 ,0x8f ,0x5f ,0x95 ,0x15 ,0x92 ,0x9c ,0xeb ,0xbf ,0x6d ,0x7a ,0xda ,0x95 ,0x52 ,0x59 ,0x2d ,0xd4 ,0xbe ,0x83 ,0xd3 ,0x58 ,0x74 ,0x21 ,0x29 ,0x49 ,0xe0 ,0x69 ,0x44 ,0x8e ,0xc9 ,0xc8 ,0x6a ,0x75 ,0xc2 ,0x89 ,0x78 ,0xf4 ,0x8e ,0x79 ,0x6b ,0x99 ,0x58 ,0x3e ,0xdd ,0x27 ,0xb9 ,0x71 ,0xb6 ,0xbe ,0xe1 ,0x4f ,0x17 ,0xf0 ,0x88 ,0xad ,0x66 ,0xc9 ,0x20 ,0xac ,0xb4 ,0x7d ,0xce ,0x3a ,0x18 ,0x63 ,0xdf ,0x4a ,0x82 ,0xe5 ,0x1a ,0x31 ,0x60 ,0x97 ,0x51 ,0x33 ,0x45 ,0x62 ,0x53 ,0x7f ,0xe0 ,0xb1 ,0x64 ,0x77 ,0x84 ,0xbb ,0x6b ,0xae ,0x1c ,0xfe ,0x81 ,0xa0 ,0x94 ,0xf9 ,0x8 ,0x2b ,0x58 ,0x70 ,0x48 ,0x68 ,0x19 ,0x8f ,0x45 ,0xfd ,0x87 ,0x94 ,0xde ,0x6c ,0xb7 ,0x52 ,0x7b ,0xf8 ,0x23 ,0xab ,0x73 ,0xd3 ,0xe2 ,0x72 ,0x4b ,0x2 ,0x57 ,0xe3 ,0x1f ,0x8f ,0x2a ,0x66 ,0x55 ,0xab ,0x7 ,0xb2 ,0xeb ,0x28 ,0x3 ,0x2f ,0xb5 ,0xc2 ,0x9a ,0x86 ,0xc5 ,0x7b ,0xa5 ,0xd3 ,0x37 ,0x8 ,0xf2 ,0x30 ,0x28 ,0x87 ,0xb2 ,0x23 ,0xbf ,0xa5 ,0xba ,0x2 ,0x3 ,0x6a ,0x5c ,0xed ,0x16 ,0x82 ,0x2b ,0x8a ,0xcf ,0x1c ,0x92 ,0xa7 ,0x79 ,0xb4 ,0xf0 ,0xf3 ,0x7 ,0xf2 ,0xa1 ,0x4e ,0x69 ,0xe2 ,0xcd ,0x65 ,0xda ,0xf4 ,0xd5 ,0x6 ,0x5 ,0xbe ,0x1f ,0xd1 ,0x34 ,0x62 ,0x8a ,0xc4 ,0xa6 ,0xfe ,0x9d ,0x34 ,0x2e ,0x53 ,0xa0 ,0xa2 ,0xf3 ,0x55 ,0x32 ,0x5 ,0x8a ,0xe1 ,0x75 ,0xa4 ,0xf6 ,0xeb ,0x39 ,0xb ,0x83 ,0xec ,0xaa ,0x40 ,0x60 ,0xef ,0x6 ,0x5e ,0x71 ,0x9f ,0x51 ,0xbd ,0x6e ,0x10 ,0xf9 ,0x3e ,0x21 ,0x8a ,0x3d ,0x96 ,0xdd ,0x6 ,0xae ,0xdd ,0x3e ,0x5 ,0x46 ,0x4d ,0xe6 ,0xbd ,0xb5 ,0x91 ,0x54 ,0x8d ,0x5 ,0x71 ,0xc4 ,0x5d ,0x6f ,0x4 ,0x6 ,0xd4 ,0xff ,0x60 ,0x50 ,0x15 ,0x24 ,0x19 ,0x98 ,0xfb ,0x97 ,0xd6 ,0xbd ,0xe9 ,0xcc ,0x89 ,0x40 ,0x43 ,0x77 ,0x67 ,0xd9 ,0x9e ,0xbd ,0xb0 ,0xe8 ,0x42 ,0x88 ,0x7 ,0x89 ,0x8b ,0x38 ,0xe7 ,0x19 ,0x5b ,0xdb ,0x79 ,0xc8 ,0xee ,0x47 ,0xa1 ,0x7c ,0xa ,0xe9 ,0x7c ,0x42 ,0xf ,0xc9 ,0xf8 ,0x84 ,0x1e ,0x0 ,0x0 ,0x0 ,0x0 ,0x83 ,0x9 ,0x80 ,0x86 ,0x48 ,0x32 ,0x2b ,0xed ,0xac ,0x1e ,0x11 ,0x70 ,0x4e ,0x6c ,0x5a ,0x72 ,0xfb ,0xfd ,0xe ,0xff ,0x56 ,0xf ,0x85 ,0x38 ,0x1e ,0x3d ,0xae ,0xd5 ,0x27 ,0x36 ,0x2d ,0x39 ,0x64 ,0xa ,0xf ,0xd9 ,0x21 ,0x68 ,0x5c ,0xa6 ,0xd1 ,0x9b ,0x5b ,0x54 ,0x3a ,0x24 ,0x36 ,0x2e ,0xb1 ,0xc ,0xa ,0x67 ,0xf ,0x93 ,0x57 ,0xe7 ,0xd2 ,0xb4 ,0xee ,0x96 ,0x9e ,0x1b ,0x9b ,0x91 ,0x4f ,0x80 ,0xc0 ,0xc5 ,0xa2 ,0x61 ,0xdc ,0x20 ,0x69 ,0x5a ,0x77 ,0x4b ,0x16 ,0x1c ,0x12 ,0x1a ,0xa ,0xe2 ,0x93 ,0xba ,0xe5 ,0xc0 ,0xa0 ,0x2a ,0x43 ,0x3c ,0x22 ,0xe0 ,0x1d ,0x12 ,0x1b ,0x17 ,0xb ,0xe ,0x9 ,0xd ,0xad ,0xf2 ,0x8b ,0xc7 ,0xb9 ,0x2d ,0xb6 ,0xa8 ,0xc8 ,0x14 ,0x1e ,0xa9 ,0x85 ,0x57 ,0xf1 ,0x19 ,0x4c ,0xaf ,0x75 ,0x7 ,0xbb ,0xee ,0x99 ,0xdd ,0xfd ,0xa3 ,0x7f ,0x60 ,0x9f ,0xf7 ,0x1 ,0x26 ,0xbc ,0x5c ,0x72 ,0xf5 ,0xc5 ,0x44 ,0x66 ,0x3b ,0x34 ,0x5b ,0xfb ,0x7e ,0x76 ,0x8b ,0x43 ,0x29 ,0xdc ,0xcb ,0x23 ,0xc6 ,0x68 ,0xb6 ,0xed ,0xfc ,0x63 ,0xb8 ,0xe4 ,0xf1 ,0xca ,0xd7 ,0x31 ,0xdc ,0x10 ,0x42 ,0x63 ,0x85 ,0x40 ,0x13 ,0x97 ,0x22 ,0x20 ,0x84 ,0xc6 ,0x11 ,0x7d ,0x85 ,0x4a ,0x24 ,0xf8 ,0xd2 ,0xbb ,0x3d ,0x11 ,0xae ,0xf9 ,0x32 ,0x6d ,0xc7 ,0x29 ,0xa1 ,0x4b ,0x1d ,0x9e ,0x2f ,0xf3 ,0xdc ,0xb2 ,0x30 ,0xec ,0xd ,0x86 ,0x52 ,0xd0 ,0x77 ,0xc1 ,0xe3 ,0x6c ,0x2b ,0xb3 ,0x16 ,0x99 ,0xa9 ,0x70 ,0xb9 ,0xfa ,0x11 ,0x94 ,0x48 ,0x22 ,0x47 ,0xe9 ,0x64 ,0xc4 ,0xa8 ,0xfc ,0x8c ,0x1a ,0xa0 ,0xf0 ,0x3f ,0xd8 ,0x56 ,0x7d ,0x2c ,0xef ,0x22 ,0x33 ,0x90 ,0xc7 ,0x87 ,0x49 ,0x4e ,0xc1 ,0xd9 ,0x38 ,0xd1 ,0xfe ,0x8c ,0xca ,0xa2 ,0x36 ,0x98 ,0xd4 ,0xb ,0xcf ,0xa6 ,0xf5 ,0x81 ,0x28 ,0xa5 ,0x7a ,0xde ,0x26 ,0xda ,0xb7 ,0x8e ,0xa4 ,0x3f ,0xad ,0xbf ,0xe4 ,0x2c ,0x3a ,0x9d ,0xd ,0x50 ,0x78 ,0x92 ,0x9b ,0x6a ,0x5f ,0xcc ,0x62 ,0x54 ,0x7e ,0x46 ,0xc2 ,0xf6 ,0x8d ,0x13 ,0xe8 ,0x90 ,0xd8 ,0xb8 ,0x5e ,0x2e ,0x39 ,0xf7 ,0xf5 ,0x82 ,0xc3 ,0xaf ,0xbe ,0x9f ,0x5d ,0x80 ,0x7c ,0x69 ,0xd0 ,0x93 ,0xa9 ,0x6f ,0xd5 ,0x2d ,0xb3 ,0xcf ,0x25 ,0x12 ,0x3b ,0xc8 ,0xac ,0x99 ,0xa7 ,0x10 ,0x18 ,0x7d ,0x6e ,0xe8 ,0x9c ,0x63 ,0x7b ,0xdb ,0x3b ,0xbb ,0x9 ,0xcd ,0x26 ,0x78 ,0xf4 ,0x6e ,0x59 ,0x18 ,0x1 ,0xec ,0x9a ,0xb7 ,0xa8 ,0x83 ,0x4f ,0x9a ,0x65 ,0xe6 ,0x95 ,0x6e ,0x7e ,0xaa ,0xff ,0xe6 ,0x8 ,0x21 ,0xbc ,0xcf ,0xe6 ,0xef ,0x15 ,0xe8 ,0xd9 ,0xba ,0xe7 ,0x9b ,0xce ,0x4a ,0x6f ,0x36 ,0xd4 ,0xea ,0x9f ,0x9 ,0xd6 ,0x29 ,0xb0 ,0x7c ,0xaf ,0x31 ,0xa4 ,0xb2 ,0x31 ,0x2a ,0x3f ,0x23 ,0x30 ,0xc6 ,0xa5 ,0x94 ,0xc0 ,0x35 ,0xa2 ,0x66 ,0x37 ,0x74 ,0x4e ,0xbc ,0xa6 ,0xfc ,0x82 ,0xca ,0xb0 ,0xe0 ,0x90 ,0xd0 ,0x15 ,0x33 ,0xa7 ,0xd8 ,0x4a ,0xf1 ,0x4 ,0x98 ,0xf7 ,0x41 ,0xec ,0xda ,0xe ,0x7f ,0xcd ,0x50 ,0x2f ,0x17 ,0x91 ,0xf6 ,0x8d ,0x76 ,0x4d ,0xd6 ,0x4d ,0x43 ,0xef ,0xb0 ,0x54 ,0xcc ,0xaa ,0x4d ,0xdf ,0xe4 ,0x96 ,0x4 ,0xe3 ,0x9e ,0xd1 ,0xb5 ,0x1b ,0x4c ,0x6a ,0x88 ,0xb8 ,0xc1 ,0x2c ,0x1f ,0x7f ,0x46 ,0x65 ,0x51 ,0x4 ,0x9d ,0x5e ,0xea ,0x5d ,0x1 ,0x8c ,0x35 ,0x73 ,0xfa ,0x87 ,0x74 ,0x2e ,0xfb ,0xb ,0x41 ,0x5a ,0xb3 ,0x67 ,0x1d ,0x52 ,0x92 ,0xdb ,0xd2 ,0x33 ,0xe9 ,0x10 ,0x56 ,0x13 ,0x6d ,0xd6 ,0x47 ,0x8c ,0x9a ,0xd7 ,0x61 ,0x7a ,0x37 ,0xa1 ,0xc ,0x8e ,0x59 ,0xf8 ,0x14 ,0x89 ,0xeb ,0x13 ,0x3c ,0xee ,0xce ,0xa9 ,0x27 ,0x35 ,0xb7 ,0x61 ,0xc9 ,0xed ,0xe1 ,0x1c ,0xe5 ,0x3c ,0x7a ,0x47 ,0xb1 ,0x59 ,0x9c ,0xd2 ,0xdf ,0x3f ,0x55 ,0xf2 ,0x73 ,0x79 ,0x18 ,0x14 ,0xce ,0xbf ,0x73 ,0xc7 ,0x37 ,0xea ,0x53 ,0xf7 ,0xcd ,0x5b ,0x5f ,0xfd ,0xaa ,0x14 ,0xdf ,0x3d ,0x6f ,0x86 ,0x78 ,0x44 ,0xdb ,0x81 ,0xca ,0xaf ,0xf3 ,0x3e ,0xb9 ,0x68 ,0xc4 ,0x2c ,0x38 ,0x24 ,0x34 ,0x5f ,0xc2 ,0xa3 ,0x40 ,0x72 ,0x16 ,0x1d ,0xc3 ,0xc ,0xbc ,0xe2 ,0x25 ,0x8b ,0x28 ,0x3c ,0x49 ,0x41 ,0xff ,0xd ,0x95 ,0x71 ,0x39 ,0xa8 ,0x1 ,0xde ,0x8 ,0xc ,0xb3 ,0x9c ,0xd8 ,0xb4 ,0xe4 ,0x90 ,0x64 ,0x56 ,0xc1 ,0x61 ,0x7b ,0xcb ,0x84 ,0x70 ,0xd5 ,0x32 ,0xb6 ,0x74 ,0x48 ,0x6c ,0x5c ,0x42 ,0xd0 ,0xb8 ,0x57 ,0xa7 ,0x50 ,0x51 ,0xf4 ,0x65 ,0x53 ,0x7e ,0x41 ,0xa4 ,0xc3 ,0x1a ,0x17 ,0x5e ,0x96 ,0x3a ,0x27 ,0x6b ,0xcb ,0x3b ,0xab ,0x45 ,0xf1 ,0x1f ,0x9d ,0x58 ,0xab ,0xac ,0xfa ,0x3 ,0x93 ,0x4b ,0xe3 ,0xfa ,0x55 ,0x20 ,0x30 ,0x6d ,0xf6 ,0xad ,0x76 ,0x76 ,0x91 ,0x88 ,0xcc ,0x4c ,0x25 ,0xf5 ,0x2 ,0xd7 ,0xfc ,0x4f ,0xe5 ,0xcb ,0xd7 ,0xc5 ,0x2a ,0x44 ,0x80 ,0x26 ,0x35 ,0xa3 ,0x8f ,0xb5 ,0x62 ,0x5a ,0x49 ,0xde ,0xb1 ,0x1b ,0x67 ,0x25 ,0xba ,0xe ,0x98 ,0x45 ,0xea ,0xc0 ,0xe1 ,0x5d ,0xfe ,0x75 ,0x2 ,0xc3 ,0x2f ,0xf0 ,0x12 ,0x81 ,0x4c ,0x97 ,0xa3 ,0x8d ,0x46 ,0xf9 ,0xc6 ,0x6b ,0xd3 ,0x5f ,0xe7 ,0x3 ,0x8f ,0x9c ,0x95 ,0x15 ,0x92 ,0x7a ,0xeb ,0xbf ,0x6d ,0x59 ,0xda ,0x95 ,0x52 ,0x83 ,0x2d ,0xd4 ,0xbe ,0x21 ,0xd3 ,0x58 ,0x74 ,0x69 ,0x29 ,0x49 ,0xe0 ,0xc8 ,0x44 ,0x8e ,0xc9 ,0x89 ,0x6a ,0x75 ,0xc2 ,0x79 ,0x78 ,0xf4 ,0x8e ,0x3e ,0x6b ,0x99 ,0x58 ,0x71 ,0xdd ,0x27 ,0xb9 ,0x4f ,0xb6 ,0xbe ,0xe1 ,0xad ,0x17 ,0xf0 ,0x88 ,0xac ,0x66 ,0xc9 ,0x20 ,0x3a ,0xb4 ,0x7d ,0xce ,0x4a ,0x18 ,0x63 ,0xdf ,0x31 ,0x82 ,0xe5 ,0x1a ,0x33 ,0x60 ,0x97 ,0x51 ,0x7f ,0x45 ,0x62 ,0x53 ,0x77 ,0xe0 ,0xb1 ,0x64 ,0xae ,0x84 ,0xbb ,0x6b ,0xa0 ,0x1c ,0xfe ,0x81 ,0x2b ,0x94 ,0xf9 ,0x8 ,0x68 ,0x58 ,0x70 ,0x48 ,0xfd ,0x19 ,0x8f ,0x45 ,0x6c ,0x87 ,0x94 ,0xde ,0xf8 ,0xb7 ,0x52 ,0x7b ,0xd3 ,0x23 ,0xab ,0x73 ,0x2 ,0xe2 ,0x72 ,0x4b ,0x8f ,0x57 ,0xe3 ,0x1f ,0xab ,0x2a ,0x66 ,0x55 ,0x28 ,0x7 ,0xb2 ,0xeb ,0xc2 ,0x3 ,0x2f ,0xb5 ,0x7b ,0x9a ,0x86 ,0xc5 ,0x8 ,0xa5 ,0xd3 ,0x37 ,0x87 ,0xf2 ,0x30 ,0x28 ,0xa5 ,0xb2 ,0x23 ,0xbf ,0x6a ,0xba ,0x2 ,0x3 ,0x82 ,0x5c ,0xed ,0x16 ,0x1c ,0x2b ,0x8a ,0xcf ,0xb4 ,0x92 ,0xa7 ,0x79 ,0xf2 ,0xf0 ,0xf3 ,0x7 ,0xe2 ,0xa1 ,0x4e ,0x69 ,0xf4 ,0xcd ,0x65 ,0xda ,0xbe ,0xd5 ,0x6 ,0x5 ,0x62 ,0x1f ,0xd1 ,0x34 ,0xfe ,0x8a ,0xc4 ,0xa6 ,0x53 ,0x9d ,0x34 ,0x2e ,0x55 ,0xa0 ,0xa2 ,0xf3 ,0xe1 ,0x32 ,0x5 ,0x8a ,0xeb ,0x75 ,0xa4 ,0xf6 ,0xec ,0x39 ,0xb ,0x83 ,0xef ,0xaa ,0x40 ,0x60 ,0x9f ,0x6 ,0x5e ,0x71 ,0x10 ,0x51 ,0xbd ,0x6e ,0x8a ,0xf9 ,0x3e ,0x21 ,0x6 ,0x3d ,0x96 ,0xdd ,0x5 ,0xae ,0xdd ,0x3e ,0xbd ,0x46 ,0x4d ,0xe6 ,0x8d ,0xb5 ,0x91 ,0x54 ,0x5d ,0x5 ,0x71 ,0xc4 ,0xd4 ,0x6f ,0x4 ,0x6 ,0x15 ,0xff ,0x60 ,0x50 ,0xfb ,0x24 ,0x19 ,0x98 ,0xe9 ,0x97 ,0xd6 ,0xbd ,0x43 ,0xcc ,0x89 ,0x40 ,0x9e ,0x77 ,0x67 ,0xd9 ,0x42 ,0xbd ,0xb0 ,0xe8 ,0x8b ,0x88 ,0x7 ,0x89 ,0x5b ,0x38 ,0xe7 ,0x19 ,0xee ,0xdb ,0x79 ,0xc8 ,0xa ,0x47 ,0xa1 ,0x7c ,0xf ,0xe9 ,0x7c ,0x42 ,0x1e ,0xc9 ,0xf8 ,0x84 ,0x0 ,0x0 ,0x0 ,0x0 ,0x86 ,0x83 ,0x9 ,0x80 ,0xed ,0x48 ,0x32 ,0x2b ,0x70 ,0xac ,0x1e ,0x11 ,0x72 ,0x4e ,0x6c ,0x5a ,0xff ,0xfb ,0xfd ,0xe ,0x38 ,0x56 ,0xf ,0x85 ,0xd5 ,0x1e ,0x3d ,0xae ,0x39 ,0x27 ,0x36 ,0x2d ,0xd9 ,0x64 ,0xa ,0xf ,0xa6 ,0x21 ,0x68 ,0x5c ,0x54 ,0xd1 ,0x9b ,0x5b ,0x2e ,0x3a ,0x24 ,0x36 ,0x67 ,0xb1 ,0xc ,0xa ,0xe7 ,0xf ,0x93 ,0x57 ,0x96 ,0xd2 ,0xb4 ,0xee ,0x91 ,0x9e ,0x1b ,0x9b ,0xc5 ,0x4f ,0x80 ,0xc0 ,0x20 ,0xa2 ,0x61 ,0xdc ,0x4b ,0x69 ,0x5a ,0x77 ,0x1a ,0x16 ,0x1c ,0x12 ,0xba ,0xa ,0xe2 ,0x93 ,0x2a ,0xe5 ,0xc0 ,0xa0 ,0xe0 ,0x43 ,0x3c ,0x22 ,0x17 ,0x1d ,0x12 ,0x1b ,0xd ,0xb ,0xe ,0x9 ,0xc7 ,0xad ,0xf2 ,0x8b ,0xa8 ,0xb9 ,0x2d ,0xb6 ,0xa9 ,0xc8 ,0x14 ,0x1e ,0x19 ,0x85 ,0x57 ,0xf1 ,0x7 ,0x4c ,0xaf ,0x75 ,0xdd ,0xbb ,0xee ,0x99 ,0x60 ,0xfd ,0xa3 ,0x7f ,0x26 ,0x9f ,0xf7 ,0x1 ,0xf5 ,0xbc ,0x5c ,0x72 ,0x3b ,0xc5 ,0x44 ,0x66 ,0x7e ,0x34 ,0x5b ,0xfb ,0x29 ,0x76 ,0x8b ,0x43 ,0xc6 ,0xdc ,0xcb ,0x23 ,0xfc ,0x68 ,0xb6 ,0xed ,0xf1 ,0x63 ,0xb8 ,0xe4 ,0xdc ,0xca ,0xd7 ,0x31 ,0x85 ,0x10 ,0x42 ,0x63 ,0x22 ,0x40 ,0x13 ,0x97 ,0x11 ,0x20 ,0x84 ,0xc6 ,0x24 ,0x7d ,0x85 ,0x4a ,0x3d ,0xf8 ,0xd2 ,0xbb ,0x32 ,0x11 ,0xae ,0xf9 ,0xa1 ,0x6d ,0xc7 ,0x29 ,0x2f ,0x4b ,0x1d ,0x9e ,0x30 ,0xf3 ,0xdc ,0xb2 ,0x52 ,0xec ,0xd ,0x86 ,0xe3 ,0xd0 ,0x77 ,0xc1 ,0x16 ,0x6c ,0x2b ,0xb3 ,0xb9 ,0x99 ,0xa9 ,0x70 ,0x48 ,0xfa ,0x11 ,0x94 ,0x64 ,0x22 ,0x47 ,0xe9 ,0x8c ,0xc4 ,0xa8 ,0xfc ,0x3f ,0x1a ,0xa0 ,0xf0 ,0x2c ,0xd8 ,0x56 ,0x7d ,0x90 ,0xef ,0x22 ,0x33 ,0x4e ,0xc7 ,0x87 ,0x49 ,0xd1 ,0xc1 ,0xd9 ,0x38 ,0xa2 ,0xfe ,0x8c ,0xca ,0xb ,0x36 ,0x98 ,0xd4 ,0x81 ,0xcf ,0xa6 ,0xf5 ,0xde ,0x28 ,0xa5 ,0x7a ,0x8e ,0x26 ,0xda ,0xb7 ,0xbf ,0xa4 ,0x3f ,0xad ,0x9d ,0xe4 ,0x2c ,0x3a ,0x92 ,0xd ,0x50 ,0x78 ,0xcc ,0x9b ,0x6a ,0x5f ,0x46 ,0x62 ,0x54 ,0x7e ,0x13 ,0xc2 ,0xf6 ,0x8d ,0xb8 ,0xe8 ,0x90 ,0xd8 ,0xf7 ,0x5e ,0x2e ,0x39 ,0xaf ,0xf5 ,0x82 ,0xc3 ,0x80 ,0xbe ,0x9f ,0x5d ,0x93 ,0x7c ,0x69 ,0xd0 ,0x2d ,0xa9 ,0x6f ,0xd5 ,0x12 ,0xb3 ,0xcf ,0x25 ,0x99 ,0x3b ,0xc8 ,0xac ,0x7d ,0xa7 ,0x10 ,0x18 ,0x63 ,0x6e ,0xe8 ,0x9c ,0xbb ,0x7b ,0xdb ,0x3b ,0x78 ,0x9 ,0xcd ,0x26 ,0x18 ,0xf4 ,0x6e ,0x59 ,0xb7 ,0x1 ,0xec ,0x9a ,0x9a ,0xa8 ,0x83 ,0x4f ,0x6e ,0x65 ,0xe6 ,0x95 ,0xe6 ,0x7e ,0xaa ,0xff ,0xcf ,0x8 ,0x21 ,0xbc ,0xe8 ,0xe6 ,0xef ,0x15 ,0x9b ,0xd9 ,0xba ,0xe7 ,0x36 ,0xce ,0x4a ,0x6f ,0x9 ,0xd4 ,0xea ,0x9f ,0x7c ,0xd6 ,0x29 ,0xb0 ,0xb2 ,0xaf ,0x31 ,0xa4 ,0x23 ,0x31 ,0x2a ,0x3f ,0x94 ,0x30 ,0xc6 ,0xa5 ,0x66 ,0xc0 ,0x35 ,0xa2 ,0xbc ,0x37 ,0x74 ,0x4e ,0xca ,0xa6 ,0xfc ,0x82 ,0xd0 ,0xb0 ,0xe0 ,0x90 ,0xd8 ,0x15 ,0x33 ,0xa7 ,0x98 ,0x4a ,0xf1 ,0x4 ,0xda ,0xf7 ,0x41 ,0xec ,0x50 ,0xe ,0x7f ,0xcd ,0xf6 ,0x2f ,0x17 ,0x91 ,0xd6 ,0x8d ,0x76 ,0x4d ,0xb0 ,0x4d ,0x43 ,0xef ,0x4d ,0x54 ,0xcc ,0xaa ,0x4 ,0xdf ,0xe4 ,0x96 ,0xb5 ,0xe3 ,0x9e ,0xd1 ,0x88 ,0x1b ,0x4c ,0x6a ,0x1f ,0xb8 ,0xc1 ,0x2c ,0x51 ,0x7f ,0x46 ,0x65 ,0xea ,0x4 ,0x9d ,0x5e ,0x35 ,0x5d ,0x1 ,0x8c ,0x74 ,0x73 ,0xfa ,0x87 ,0x41 ,0x2e ,0xfb ,0xb ,0x1d ,0x5a ,0xb3 ,0x67 ,0xd2 ,0x52 ,0x92 ,0xdb ,0x56 ,0x33 ,0xe9 ,0x10 ,0x47 ,0x13 ,0x6d ,0xd6 ,0x61 ,0x8c ,0x9a ,0xd7 ,0xc ,0x7a ,0x37 ,0xa1 ,0x14 ,0x8e ,0x59 ,0xf8 ,0x3c ,0x89 ,0xeb ,0x13 ,0x27 ,0xee ,0xce ,0xa9 ,0xc9 ,0x35 ,0xb7 ,0x61 ,0xe5 ,0xed ,0xe1 ,0x1c ,0xb1 ,0x3c ,0x7a ,0x47 ,0xdf ,0x59 ,0x9c ,0xd2 ,0x73 ,0x3f ,0x55 ,0xf2 ,0xce ,0x79 ,0x18 ,0x14 ,0x37 ,0xbf ,0x73 ,0xc7 ,0xcd ,0xea ,0x53 ,0xf7 ,0xaa ,0x5b ,0x5f ,0xfd ,0x6f ,0x14 ,0xdf ,0x3d ,0xdb ,0x86 ,0x78 ,0x44 ,0xf3 ,0x81 ,0xca ,0xaf ,0xc4 ,0x3e ,0xb9 ,0x68 ,0x34 ,0x2c ,0x38 ,0x24 ,0x40 ,0x5f ,0xc2 ,0xa3 ,0xc3 ,0x72 ,0x16 ,0x1d ,0x25 ,0xc ,0xbc ,0xe2 ,0x49 ,0x8b ,0x28 ,0x3c ,0x95 ,0x41 ,0xff ,0xd ,0x1 ,0x71 ,0x39 ,0xa8 ,0xb3 ,0xde ,0x8 ,0xc ,0xe4 ,0x9c ,0xd8 ,0xb4 ,0xc1 ,0x90 ,0x64 ,0x56 ,0x84 ,0x61 ,0x7b ,0xcb ,0xb6 ,0x70 ,0xd5 ,0x32 ,0x5c ,0x74 ,0x48 ,0x6c ,0x57 ,0x42 ,0xd0 ,0xb8 ,0xf4 ,0xa7 ,0x50 ,0x51 ,0x41 ,0x65 ,0x53 ,0x7e ,0x17 ,0xa4 ,0xc3 ,0x1a ,0x27 ,0x5e ,0x96 ,0x3a ,0xab ,0x6b ,0xcb ,0x3b ,0x9d ,0x45 ,0xf1 ,0x1f ,0xfa ,0x58 ,0xab ,0xac ,0xe3 ,0x3 ,0x93 ,0x4b ,0x30 ,0xfa ,0x55 ,0x20 ,0x76 ,0x6d ,0xf6 ,0xad ,0xcc ,0x76 ,0x91 ,0x88 ,0x2 ,0x4c ,0x25 ,0xf5 ,0xe5 ,0xd7 ,0xfc ,0x4f ,0x2a ,0xcb ,0xd7 ,0xc5 ,0x35 ,0x44 ,0x80 ,0x26 ,0x62 ,0xa3 ,0x8f ,0xb5 ,0xb1 ,0x5a ,0x49 ,0xde ,0xba ,0x1b ,0x67 ,0x25 ,0xea ,0xe ,0x98 ,0x45 ,0xfe ,0xc0 ,0xe1 ,0x5d ,0x2f ,0x75 ,0x2 ,0xc3 ,0x4c ,0xf0 ,0x12 ,0x81 ,0x46 ,0x97 ,0xa3 ,0x8d ,0xd3 ,0xf9 ,0xc6 ,0x6b ,0x8f ,0x5f ,0xe7 ,0x3 ,0x92 ,0x9c ,0x95 ,0x15 ,0x6d ,0x7a ,0xeb ,0xbf ,0x52 ,0x59 ,0xda ,0x95 ,0xbe ,0x83 ,0x2d ,0xd4 ,0x74 ,0x21 ,0xd3 ,0x58 ,0xe0 ,0x69 ,0x29 ,0x49 ,0xc9 ,0xc8 ,0x44 ,0x8e ,0xc2 ,0x89 ,0x6a ,0x75 ,0x8e ,0x79 ,0x78 ,0xf4 ,0x58 ,0x3e ,0x6b ,0x99 ,0xb9 ,0x71 ,0xdd ,0x27 ,0xe1 ,0x4f ,0xb6 ,0xbe ,0x88 ,0xad ,0x17 ,0xf0 ,0x20 ,0xac ,0x66 ,0xc9 ,0xce ,0x3a ,0xb4 ,0x7d ,0xdf ,0x4a ,0x18 ,0x63 ,0x1a ,0x31 ,0x82 ,0xe5 ,0x51 ,0x33 ,0x60 ,0x97 ,0x53 ,0x7f ,0x45 ,0x62 ,0x64 ,0x77 ,0xe0 ,0xb1 ,0x6b ,0xae ,0x84 ,0xbb ,0x81 ,0xa0 ,0x1c ,0xfe ,0x8 ,0x2b ,0x94 ,0xf9 ,0x48 ,0x68 ,0x58 ,0x70 ,0x45 ,0xfd ,0x19 ,0x8f ,0xde ,0x6c ,0x87 ,0x94 ,0x7b ,0xf8 ,0xb7 ,0x52 ,0x73 ,0xd3 ,0x23 ,0xab ,0x4b ,0x2 ,0xe2 ,0x72 ,0x1f ,0x8f ,0x57 ,0xe3 ,0x55 ,0xab ,0x2a ,0x66 ,0xeb ,0x28 ,0x7 ,0xb2 ,0xb5 ,0xc2 ,0x3 ,0x2f ,0xc5 ,0x7b ,0x9a ,0x86 ,0x37 ,0x8 ,0xa5 ,0xd3 ,0x28 ,0x87 ,0xf2 ,0x30 ,0xbf ,0xa5 ,0xb2 ,0x23 ,0x3 ,0x6a ,0xba ,0x2 ,0x16 ,0x82 ,0x5c ,0xed ,0xcf ,0x1c ,0x2b ,0x8a ,0x79 ,0xb4 ,0x92 ,0xa7 ,0x7 ,0xf2 ,0xf0 ,0xf3 ,0x69 ,0xe2 ,0xa1 ,0x4e ,0xda ,0xf4 ,0xcd ,0x65 ,0x5 ,0xbe ,0xd5 ,0x6 ,0x34 ,0x62 ,0x1f ,0xd1 ,0xa6 ,0xfe ,0x8a ,0xc4 ,0x2e ,0x53 ,0x9d ,0x34 ,0xf3 ,0x55 ,0xa0 ,0xa2 ,0x8a ,0xe1 ,0x32 ,0x5 ,0xf6 ,0xeb ,0x75 ,0xa4 ,0x83 ,0xec ,0x39 ,0xb ,0x60 ,0xef ,0xaa ,0x40 ,0x71 ,0x9f ,0x6 ,0x5e ,0x6e ,0x10 ,0x51 ,0xbd ,0x21 ,0x8a ,0xf9 ,0x3e ,0xdd ,0x6 ,0x3d ,0x96 ,0x3e ,0x5 ,0xae ,0xdd ,0xe6 ,0xbd ,0x46 ,0x4d ,0x54 ,0x8d ,0xb5 ,0x91 ,0xc4 ,0x5d ,0x5 ,0x71 ,0x6 ,0xd4 ,0x6f ,0x4 ,0x50 ,0x15 ,0xff ,0x60 ,0x98 ,0xfb ,0x24 ,0x19 ,0xbd ,0xe9 ,0x97 ,0xd6 ,0x40 ,0x43 ,0xcc ,0x89 ,0xd9 ,0x9e ,0x77 ,0x67 ,0xe8 ,0x42 ,0xbd ,0xb0 ,0x89 ,0x8b ,0x88 ,0x7 ,0x19 ,0x5b ,0x38 ,0xe7 ,0xc8 ,0xee ,0xdb ,0x79 ,0x7c ,0xa ,0x47 ,0xa1 ,0x42 ,0xf ,0xe9 ,0x7c ,0x84 ,0x1e ,0xc9 ,0xf8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x80 ,0x86 ,0x83 ,0x9 ,0x2b ,0xed ,0x48 ,0x32 ,0x11 ,0x70 ,0xac ,0x1e ,0x5a ,0x72 ,0x4e ,0x6c ,0xe ,0xff ,0xfb ,0xfd ,0x85 ,0x38 ,0x56 ,0xf ,0xae ,0xd5 ,0x1e ,0x3d ,0x2d ,0x39 ,0x27 ,0x36 ,0xf ,0xd9 ,0x64 ,0xa ,0x5c ,0xa6 ,0x21 ,0x68 ,0x5b ,0x54 ,0xd1 ,0x9b ,0x36 ,0x2e ,0x3a ,0x24 ,0xa ,0x67 ,0xb1 ,0xc ,0x57 ,0xe7 ,0xf ,0x93 ,0xee ,0x96 ,0xd2 ,0xb4 ,0x9b ,0x91 ,0x9e ,0x1b ,0xc0 ,0xc5 ,0x4f ,0x80 ,0xdc ,0x20 ,0xa2 ,0x61 ,0x77 ,0x4b ,0x69 ,0x5a ,0x12 ,0x1a ,0x16 ,0x1c ,0x93 ,0xba ,0xa ,0xe2 ,0xa0 ,0x2a ,0xe5 ,0xc0 ,0x22 ,0xe0 ,0x43 ,0x3c ,0x1b ,0x17 ,0x1d ,0x12 ,0x9 ,0xd ,0xb ,0xe ,0x8b ,0xc7 ,0xad ,0xf2 ,0xb6 ,0xa8 ,0xb9 ,0x2d ,0x1e ,0xa9 ,0xc8 ,0x14 ,0xf1 ,0x19 ,0x85 ,0x57 ,0x75 ,0x7 ,0x4c ,0xaf ,0x99 ,0xdd ,0xbb ,0xee ,0x7f ,0x60 ,0xfd ,0xa3 ,0x1 ,0x26 ,0x9f ,0xf7 ,0x72 ,0xf5 ,0xbc ,0x5c ,0x66 ,0x3b ,0xc5 ,0x44 ,0xfb ,0x7e ,0x34 ,0x5b ,0x43 ,0x29 ,0x76 ,0x8b ,0x23 ,0xc6 ,0xdc ,0xcb ,0xed ,0xfc ,0x68 ,0xb6 ,0xe4 ,0xf1 ,0x63 ,0xb8 ,0x31 ,0xdc ,0xca ,0xd7 ,0x63 ,0x85 ,0x10 ,0x42 ,0x97 ,0x22 ,0x40 ,0x13 ,0xc6 ,0x11 ,0x20 ,0x84 ,0x4a ,0x24 ,0x7d ,0x85 ,0xbb ,0x3d ,0xf8 ,0xd2 ,0xf9 ,0x32 ,0x11 ,0xae ,0x29 ,0xa1 ,0x6d ,0xc7 ,0x9e ,0x2f ,0x4b ,0x1d ,0xb2 ,0x30 ,0xf3 ,0xdc ,0x86 ,0x52 ,0xec ,0xd ,0xc1 ,0xe3 ,0xd0 ,0x77 ,0xb3 ,0x16 ,0x6c ,0x2b ,0x70 ,0xb9 ,0x99 ,0xa9 ,0x94 ,0x48 ,0xfa ,0x11 ,0xe9 ,0x64 ,0x22 ,0x47 ,0xfc ,0x8c ,0xc4 ,0xa8 ,0xf0 ,0x3f ,0x1a ,0xa0 ,0x7d ,0x2c ,0xd8 ,0x56 ,0x33 ,0x90 ,0xef ,0x22 ,0x49 ,0x4e ,0xc7 ,0x87 ,0x38 ,0xd1 ,0xc1 ,0xd9 ,0xca ,0xa2 ,0xfe ,0x8c ,0xd4 ,0xb ,0x36 ,0x98 ,0xf5 ,0x81 ,0xcf ,0xa6 ,0x7a ,0xde ,0x28 ,0xa5 ,0xb7 ,0x8e ,0x26 ,0xda ,0xad ,0xbf ,0xa4 ,0x3f ,0x3a ,0x9d ,0xe4 ,0x2c ,0x78 ,0x92 ,0xd ,0x50 ,0x5f ,0xcc ,0x9b ,0x6a ,0x7e ,0x46 ,0x62 ,0x54 ,0x8d ,0x13 ,0xc2 ,0xf6 ,0xd8 ,0xb8 ,0xe8 ,0x90 ,0x39 ,0xf7 ,0x5e ,0x2e ,0xc3 ,0xaf ,0xf5 ,0x82 ,0x5d ,0x80 ,0xbe ,0x9f ,0xd0 ,0x93 ,0x7c ,0x69 ,0xd5 ,0x2d ,0xa9 ,0x6f ,0x25 ,0x12 ,0xb3 ,0xcf ,0xac ,0x99 ,0x3b ,0xc8 ,0x18 ,0x7d ,0xa7 ,0x10 ,0x9c ,0x63 ,0x6e ,0xe8 ,0x3b ,0xbb ,0x7b ,0xdb ,0x26 ,0x78 ,0x9 ,0xcd ,0x59 ,0x18 ,0xf4 ,0x6e ,0x9a ,0xb7 ,0x1 ,0xec ,0x4f ,0x9a ,0xa8 ,0x83 ,0x95 ,0x6e ,0x65 ,0xe6 ,0xff ,0xe6 ,0x7e ,0xaa ,0xbc ,0xcf ,0x8 ,0x21 ,0x15 ,0xe8 ,0xe6 ,0xef ,0xe7 ,0x9b ,0xd9 ,0xba ,0x6f ,0x36 ,0xce ,0x4a ,0x9f ,0x9 ,0xd4 ,0xea ,0xb0 ,0x7c ,0xd6 ,0x29 ,0xa4 ,0xb2 ,0xaf ,0x31 ,0x3f ,0x23 ,0x31 ,0x2a ,0xa5 ,0x94 ,0x30 ,0xc6 ,0xa2 ,0x66 ,0xc0 ,0x35 ,0x4e ,0xbc ,0x37 ,0x74 ,0x82 ,0xca ,0xa6 ,0xfc ,0x90 ,0xd0 ,0xb0 ,0xe0 ,0xa7 ,0xd8 ,0x15 ,0x33 ,0x4 ,0x98 ,0x4a ,0xf1 ,0xec ,0xda ,0xf7 ,0x41 ,0xcd ,0x50 ,0xe ,0x7f ,0x91 ,0xf6 ,0x2f ,0x17 ,0x4d ,0xd6 ,0x8d ,0x76 ,0xef ,0xb0 ,0x4d ,0x43 ,0xaa ,0x4d ,0x54 ,0xcc ,0x96 ,0x4 ,0xdf ,0xe4 ,0xd1 ,0xb5 ,0xe3 ,0x9e ,0x6a ,0x88 ,0x1b ,0x4c ,0x2c ,0x1f ,0xb8 ,0xc1 ,0x65 ,0x51 ,0x7f ,0x46 ,0x5e ,0xea ,0x4 ,0x9d ,0x8c ,0x35 ,0x5d ,0x1 ,0x87 ,0x74 ,0x73 ,0xfa ,0xb ,0x41 ,0x2e ,0xfb ,0x67 ,0x1d ,0x5a ,0xb3 ,0xdb ,0xd2 ,0x52 ,0x92 ,0x10 ,0x56 ,0x33 ,0xe9 ,0xd6 ,0x47 ,0x13 ,0x6d ,0xd7 ,0x61 ,0x8c ,0x9a ,0xa1 ,0xc ,0x7a ,0x37 ,0xf8 ,0x14 ,0x8e ,0x59 ,0x13 ,0x3c ,0x89 ,0xeb ,0xa9 ,0x27 ,0xee ,0xce ,0x61 ,0xc9 ,0x35 ,0xb7 ,0x1c ,0xe5 ,0xed ,0xe1 ,0x47 ,0xb1 ,0x3c ,0x7a ,0xd2 ,0xdf ,0x59 ,0x9c ,0xf2 ,0x73 ,0x3f ,0x55 ,0x14 ,0xce ,0x79 ,0x18 ,0xc7 ,0x37 ,0xbf ,0x73 ,0xf7 ,0xcd ,0xea ,0x53 ,0xfd ,0xaa ,0x5b ,0x5f ,0x3d ,0x6f ,0x14 ,0xdf ,0x44 ,0xdb ,0x86 ,0x78 ,0xaf ,0xf3 ,0x81 ,0xca ,0x68 ,0xc4 ,0x3e ,0xb9 ,0x24 ,0x34 ,0x2c ,0x38 ,0xa3 ,0x40 ,0x5f ,0xc2 ,0x1d ,0xc3 ,0x72 ,0x16 ,0xe2 ,0x25 ,0xc ,0xbc ,0x3c ,0x49 ,0x8b ,0x28 ,0xd ,0x95 ,0x41 ,0xff ,0xa8 ,0x1 ,0x71 ,0x39 ,0xc ,0xb3 ,0xde ,0x8 ,0xb4 ,0xe4 ,0x9c ,0xd8 ,0x56 ,0xc1 ,0x90 ,0x64 ,0xcb ,0x84 ,0x61 ,0x7b ,0x32 ,0xb6 ,0x70 ,0xd5 ,0x6c ,0x5c ,0x74 ,0x48 ,0xb8 ,0x57 ,0x42 ,0xd0 ,0x0 ,0x41 ,0x90 ,0xd4 ,0x0 ,0xb ,0xa0 ,0x2 ,0xc9 ,0x95 ,0x55 ,0x31 ,0xa6 ,0x50 ,0xd1 ,0x54 ,0x7b ,0xd8 ,0xc5 ,0xaa ,0xa4 ,0xa4 ,0xbd ,0xac ,0x5c ,0xea ,0x12 ,0xc7 ,0xf8 ,0x83 ,0xd6 ,0xb8 ,0x5d ,0xd6 ,0xcf ,0x2d ,0x60 ,0xc8 ,0xa5 ,0xf0 ,0xd7 ,0x7f ,0xb3 ,0x8c ,0x22 ,0x25 ,0xc4 ,0x6f ,0xb9 ,0xd5 ,0xc9 ,0x18 ,0xc0 ,0x92 ,0xd0 ,0x8 ,0x85 ,0x2a ,0xf3 ,0x68 ,0xbd ,0x84 ,0xaf ,0xf2 ,0xc ,0x8b ,0xf5 ,0x1e ,0x51 ,0x70 ,0x46 ,0x70 ,0x9e ,0x8b ,0xde ,0xe1 ,0x86 ,0xa1 ,0xf8 ,0xcd ,0x71 ,0x2 ,0x9f ,0xa1 ,0x7b ,0x44 ,0xb0 ,0x82 ,0x40 ,0x7f ,0xce ,0xb4 ,0xbe ,0x5d ,0xbc ,0x8e ,0x19 ,0x43 ,0xb ,0x3a ,0x46 ,0x69 ,0xa0 ,0xcc ,0xed ,0x4f ,0x61 ,0xaf ,0xa6 ,0xa9 ,0x5b ,0x47 ,0x69 ,0x51 ,0xd5 ,0x0 ,0x77 ,0x7e ,0xde ,0x2e ,0x7e ,0xa6 ,0x3c ,0xe0 ,0x33 ,0xdf ,0xed ,0x40 ,0x3f ,0x1a ,0xc7 ,0xe0 ,0xc7 ,0x46 ,0xe3 ,0x3b ,0x90 ,0x4e ,0x64 ,0x55 ,0x2e ,0x8d ,0x36 ,0x3b ,0x92 ,0x9b ,0x87 ,0x6f ,0xae ,0x94 ,0x3d ,0xa ,0xc8 ,0xa2 ,0x4e ,0x7f ,0x5a ,0x83 ,0xec ,0x18 ,0xfd ,0x82 ,0x54 ,0xc8 ,0xd8 ,0xed ,0x1e ,0x52 ,0x7d ,0xca ,0xcf ,0x4b ,0xba ,0x31 ,0x68 ,0xb9 ,0x78 ,0xa3 ,0xca ,0x4e ,0x72 ,0x86 ,0xb2 ,0x33 ,0x79 ,0xcb ,0xcd ,0xa6 ,0x43 ,0xa3 ,0x9c ,0xfa ,0xee ,0x2a ,0xae ,0x3b ,0x72 ,0xc6 ,0x46 ,0x32 ,0xa5 ,0x99 ,0x45 ,0x92 ,0x46 ,0x79 ,0xdc ,0xe3 ,0x3e ,0xa9 ,0x8a ,0x11 ,0x37 ,0x49 ,0x85 ,0xe4 ,0x58 ,0x1a ,0x1f ,0x6e ,0xd7 ,0xaa ,0xe6 ,0xa ,0xc4 ,0x27 ,0xfd ,0x46 ,0x5c ,0x6c ,0xb0 ,0x28 ,0x2e ,0x6b ,0x84 ,0x35 ,0x90 ,0x1a ,0x6d ,0x38 ,0xf2 ,0x69 ,0x4a ,0xbc ,0x96 ,0xec ,0xd7 ,0x56 ,0x65 ,0x27 ,0xee ,0xa6 ,0xb0 ,0x5f ,0x9c ,0x70 ,0x71 ,0xa5 ,0x2b ,0xec ,0x93 ,0x67 ,0x16 ,0xc1 ,0xc4 ,0xb3 ,0x43 ,0x70 ,0xb5 ,0x6d ,0xad ,0x95 ,0x41 ,0xf0 ,0x2 ,0xfc ,0x8d ,0x58 ,0x8e ,0xa1 ,0x46 ,0x32 ,0x34 ,0x68 ,0x11 ,0x8c ,0xb3 ,0x3a ,0xdb ,0x54 ,0xbe ,0x3a ,0xb3 ,0x38 ,0x2e ,0x7c};
-
-static uint8_t nettle_sha256[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x20 ,0x6 ,0x60 ,0x0 ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x11 ,0x10 ,0x0 ,0x0 ,0x1 ,0x1 ,0x1 ,0x1 ,0x0 ,0x2 ,0x3 ,0x4 ,0x0 ,0x3 ,0x0 ,0x0 ,0x5 ,0x5 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0x88 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0xb ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0x88 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xb ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xd2 ,0x2f ,0x10 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe0 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe0 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xb2 ,0x1 ,0x1 ,0x3 ,0x7f ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x2 ,0x76 ,0x22 ,0x4 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x5 ,0x2d ,0x0 ,0x3 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x5 ,0x2f ,0x1 ,0x2 ,0x3a ,0x0 ,0x1 ,0x20 ,0x1 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x2 ,0x20 ,0x1 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x3a ,0x0 ,0x3 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x5 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x2 ,0x1 ,0x0 ,0x2 ,0xb ,0x20 ,0x1 ,0x20 ,0x5 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x2 ,0xb ,0x20 ,0x1 ,0x20 ,0x5 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x1 ,0xb ,0x20 ,0x1 ,0x20 ,0x5 ,0x41 ,0x18 ,0x76 ,0x3a ,0x0 ,0x0 ,0xb ,0xb ,0xca ,0x18 ,0x1 ,0x22 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x6b ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x6a ,0x20 ,0x1 ,0x20 ,0x4 ,0x6a ,0x28 ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0x18 ,0x74 ,0x20 ,0x5 ,0x41 ,0x80 ,0xfe ,0x3 ,0x71 ,0x41 ,0x8 ,0x74 ,0x72 ,0x20 ,0x5 ,0x41 ,0x8 ,0x76 ,0x41 ,0x80 ,0xfe ,0x3 ,0x71 ,0x20 ,0x5 ,0x41 ,0x18 ,0x76 ,0x72 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x22 ,0x4 ,0x41 ,0xc0 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x7 ,0x20 ,0x0 ,0x28 ,0x2 ,0x1c ,0x22 ,0x8 ,0x21 ,0x9 ,0x20 ,0x0 ,0x28 ,0x2 ,0x18 ,0x22 ,0xa ,0x21 ,0xb ,0x20 ,0x0 ,0x28 ,0x2 ,0x14 ,0x22 ,0xc ,0x21 ,0xd ,0x20 ,0x0 ,0x28 ,0x2 ,0x10 ,0x22 ,0xe ,0x21 ,0x5 ,0x20 ,0x0 ,0x28 ,0x2 ,0xc ,0x22 ,0xf ,0x21 ,0x1 ,0x20 ,0x0 ,0x28 ,0x2 ,0x8 ,0x22 ,0x10 ,0x21 ,0x11 ,0x20 ,0x0 ,0x28 ,0x2 ,0x4 ,0x22 ,0x12 ,0x21 ,0x13 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x14 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x11 ,0x20 ,0x13 ,0x20 ,0x4 ,0x73 ,0x71 ,0x20 ,0x13 ,0x20 ,0x4 ,0x71 ,0x73 ,0x20 ,0x4 ,0x41 ,0x1e ,0x77 ,0x20 ,0x4 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0xa ,0x77 ,0x73 ,0x6a ,0x20 ,0x9 ,0x20 ,0x5 ,0x41 ,0x1a ,0x77 ,0x20 ,0x5 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x5 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x20 ,0xb ,0x20 ,0xd ,0x73 ,0x20 ,0x5 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0x2 ,0x20 ,0x6 ,0x6a ,0x22 ,0x15 ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x3 ,0x20 ,0x6 ,0x6a ,0x22 ,0x16 ,0x28 ,0x2 ,0x0 ,0x6a ,0x22 ,0x9 ,0x6a ,0x22 ,0x17 ,0x41 ,0x1e ,0x77 ,0x20 ,0x17 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x17 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x17 ,0x20 ,0x4 ,0x73 ,0x20 ,0x13 ,0x71 ,0x20 ,0x17 ,0x20 ,0x4 ,0x71 ,0x73 ,0x6a ,0x20 ,0x15 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0x16 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x20 ,0x1 ,0x6a ,0x22 ,0x1 ,0x20 ,0xd ,0x20 ,0x5 ,0x73 ,0x71 ,0x20 ,0xd ,0x73 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1a ,0x77 ,0x20 ,0x1 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x1 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x9 ,0x6a ,0x22 ,0xb ,0x41 ,0x1e ,0x77 ,0x20 ,0xb ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0xb ,0x20 ,0x17 ,0x73 ,0x20 ,0x4 ,0x71 ,0x20 ,0xb ,0x20 ,0x17 ,0x71 ,0x73 ,0x6a ,0x20 ,0x15 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xd ,0x6a ,0x20 ,0x16 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x20 ,0x11 ,0x6a ,0x22 ,0x11 ,0x20 ,0x1 ,0x20 ,0x5 ,0x73 ,0x71 ,0x20 ,0x5 ,0x73 ,0x6a ,0x20 ,0x11 ,0x41 ,0x1a ,0x77 ,0x20 ,0x11 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x11 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x9 ,0x6a ,0x22 ,0xd ,0x41 ,0x1e ,0x77 ,0x20 ,0xd ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0xd ,0x20 ,0xb ,0x73 ,0x20 ,0x17 ,0x71 ,0x20 ,0xd ,0x20 ,0xb ,0x71 ,0x73 ,0x6a ,0x20 ,0x15 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x5 ,0x6a ,0x20 ,0x16 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x20 ,0x13 ,0x6a ,0x22 ,0x13 ,0x20 ,0x11 ,0x20 ,0x1 ,0x73 ,0x71 ,0x20 ,0x1 ,0x73 ,0x6a ,0x20 ,0x13 ,0x41 ,0x1a ,0x77 ,0x20 ,0x13 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x13 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x9 ,0x6a ,0x22 ,0x5 ,0x41 ,0x1e ,0x77 ,0x20 ,0x5 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x5 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x5 ,0x20 ,0xd ,0x73 ,0x20 ,0xb ,0x71 ,0x20 ,0x5 ,0x20 ,0xd ,0x71 ,0x73 ,0x6a ,0x20 ,0x15 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x1 ,0x6a ,0x20 ,0x16 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x20 ,0x4 ,0x6a ,0x22 ,0x4 ,0x20 ,0x13 ,0x20 ,0x11 ,0x73 ,0x71 ,0x20 ,0x11 ,0x73 ,0x6a ,0x20 ,0x4 ,0x41 ,0x1a ,0x77 ,0x20 ,0x4 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x9 ,0x6a ,0x22 ,0x1 ,0x41 ,0x1e ,0x77 ,0x20 ,0x1 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x1 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x1 ,0x20 ,0x5 ,0x73 ,0x20 ,0xd ,0x71 ,0x20 ,0x1 ,0x20 ,0x5 ,0x71 ,0x73 ,0x6a ,0x20 ,0x16 ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x15 ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x11 ,0x6a ,0x20 ,0x9 ,0x20 ,0x17 ,0x6a ,0x22 ,0x9 ,0x20 ,0x4 ,0x20 ,0x13 ,0x73 ,0x71 ,0x20 ,0x13 ,0x73 ,0x6a ,0x20 ,0x9 ,0x41 ,0x1a ,0x77 ,0x20 ,0x9 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x9 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x17 ,0x6a ,0x22 ,0x11 ,0x41 ,0x1e ,0x77 ,0x20 ,0x11 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x11 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x11 ,0x20 ,0x1 ,0x73 ,0x20 ,0x5 ,0x71 ,0x20 ,0x11 ,0x20 ,0x1 ,0x71 ,0x73 ,0x6a ,0x20 ,0x16 ,0x41 ,0x18 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x15 ,0x41 ,0x18 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x13 ,0x6a ,0x20 ,0x17 ,0x20 ,0xb ,0x6a ,0x22 ,0xb ,0x20 ,0x9 ,0x20 ,0x4 ,0x73 ,0x71 ,0x20 ,0x4 ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x17 ,0x6a ,0x22 ,0x13 ,0x41 ,0x1e ,0x77 ,0x20 ,0x13 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x13 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x13 ,0x20 ,0x11 ,0x73 ,0x20 ,0x1 ,0x71 ,0x20 ,0x13 ,0x20 ,0x11 ,0x71 ,0x73 ,0x6a ,0x20 ,0x16 ,0x41 ,0x1c ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x15 ,0x41 ,0x1c ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x4 ,0x6a ,0x20 ,0x17 ,0x20 ,0xd ,0x6a ,0x22 ,0xd ,0x20 ,0xb ,0x20 ,0x9 ,0x73 ,0x71 ,0x20 ,0x9 ,0x73 ,0x6a ,0x20 ,0xd ,0x41 ,0x1a ,0x77 ,0x20 ,0xd ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x17 ,0x6a ,0x21 ,0x4 ,0x20 ,0x17 ,0x20 ,0x5 ,0x6a ,0x21 ,0x5 ,0x20 ,0x6 ,0x41 ,0x20 ,0x6a ,0x21 ,0x6 ,0x20 ,0x7 ,0x41 ,0x1 ,0x71 ,0x21 ,0x17 ,0x41 ,0x0 ,0x21 ,0x7 ,0x20 ,0x17 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x21 ,0x17 ,0x41 ,0x0 ,0x21 ,0x18 ,0x20 ,0x3 ,0x28 ,0x2 ,0x20 ,0x21 ,0x15 ,0x20 ,0x3 ,0x28 ,0x2 ,0x1c ,0x21 ,0x16 ,0x20 ,0x3 ,0x28 ,0x2 ,0x18 ,0x21 ,0x6 ,0x20 ,0x3 ,0x28 ,0x2 ,0x14 ,0x21 ,0x7 ,0x20 ,0x3 ,0x28 ,0x2 ,0x34 ,0x21 ,0x2 ,0x20 ,0x3 ,0x28 ,0x2 ,0x10 ,0x21 ,0x19 ,0x20 ,0x3 ,0x28 ,0x2 ,0x30 ,0x21 ,0x1a ,0x20 ,0x3 ,0x28 ,0x2 ,0xc ,0x21 ,0x1b ,0x20 ,0x3 ,0x28 ,0x2 ,0x2c ,0x21 ,0x1c ,0x20 ,0x3 ,0x28 ,0x2 ,0x8 ,0x21 ,0x1d ,0x20 ,0x3 ,0x28 ,0x2 ,0x28 ,0x21 ,0x1e ,0x20 ,0x3 ,0x28 ,0x2 ,0x3c ,0x21 ,0x1f ,0x20 ,0x3 ,0x28 ,0x2 ,0x4 ,0x21 ,0x20 ,0x20 ,0x3 ,0x28 ,0x2 ,0x24 ,0x21 ,0x21 ,0x20 ,0x3 ,0x28 ,0x2 ,0x38 ,0x21 ,0x22 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x11 ,0x20 ,0x13 ,0x20 ,0x4 ,0x73 ,0x71 ,0x20 ,0x13 ,0x20 ,0x4 ,0x71 ,0x73 ,0x20 ,0x4 ,0x41 ,0x1e ,0x77 ,0x20 ,0x4 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0xa ,0x77 ,0x73 ,0x6a ,0x20 ,0x9 ,0x20 ,0x5 ,0x41 ,0x1a ,0x77 ,0x20 ,0x5 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x5 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x20 ,0xb ,0x20 ,0xd ,0x73 ,0x20 ,0x5 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0x17 ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x22 ,0x41 ,0xf ,0x77 ,0x20 ,0x22 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x22 ,0x41 ,0xa ,0x76 ,0x73 ,0x20 ,0x21 ,0x6a ,0x20 ,0x3 ,0x6a ,0x20 ,0x20 ,0x41 ,0x19 ,0x77 ,0x20 ,0x20 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x20 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x9 ,0x41 ,0x1e ,0x77 ,0x20 ,0x9 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x9 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x9 ,0x20 ,0x4 ,0x73 ,0x20 ,0x13 ,0x71 ,0x20 ,0x9 ,0x20 ,0x4 ,0x71 ,0x73 ,0x6a ,0x20 ,0x17 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0x23 ,0x20 ,0x1 ,0x6a ,0x22 ,0xb ,0x20 ,0xd ,0x20 ,0x5 ,0x73 ,0x71 ,0x20 ,0xd ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x20 ,0x1e ,0x20 ,0x20 ,0x6a ,0x20 ,0x1f ,0x41 ,0xf ,0x77 ,0x20 ,0x1f ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1f ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x1d ,0x41 ,0x19 ,0x77 ,0x20 ,0x1d ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1d ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x20 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x1 ,0x41 ,0x1e ,0x77 ,0x20 ,0x1 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x1 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x1 ,0x20 ,0x9 ,0x73 ,0x20 ,0x4 ,0x71 ,0x20 ,0x1 ,0x20 ,0x9 ,0x71 ,0x73 ,0x6a ,0x20 ,0x17 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xd ,0x6a ,0x20 ,0x3 ,0x41 ,0xf ,0x77 ,0x20 ,0x3 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x3 ,0x41 ,0xa ,0x76 ,0x73 ,0x20 ,0x1d ,0x6a ,0x20 ,0x1c ,0x6a ,0x20 ,0x1b ,0x41 ,0x19 ,0x77 ,0x20 ,0x1b ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1b ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x1d ,0x6a ,0x20 ,0x23 ,0x20 ,0x11 ,0x6a ,0x22 ,0xd ,0x20 ,0xb ,0x20 ,0x5 ,0x73 ,0x71 ,0x20 ,0x5 ,0x73 ,0x6a ,0x20 ,0xd ,0x41 ,0x1a ,0x77 ,0x20 ,0xd ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x11 ,0x41 ,0x1e ,0x77 ,0x20 ,0x11 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x11 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x11 ,0x20 ,0x1 ,0x73 ,0x20 ,0x9 ,0x71 ,0x20 ,0x11 ,0x20 ,0x1 ,0x71 ,0x73 ,0x6a ,0x20 ,0x17 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x5 ,0x6a ,0x20 ,0x1a ,0x20 ,0x1b ,0x6a ,0x20 ,0x20 ,0x41 ,0xf ,0x77 ,0x20 ,0x20 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x20 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x19 ,0x41 ,0x19 ,0x77 ,0x20 ,0x19 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x19 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x1b ,0x6a ,0x20 ,0x23 ,0x20 ,0x13 ,0x6a ,0x22 ,0x23 ,0x20 ,0xd ,0x20 ,0xb ,0x73 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0x23 ,0x41 ,0x1a ,0x77 ,0x20 ,0x23 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x23 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x13 ,0x6a ,0x22 ,0x5 ,0x41 ,0x1e ,0x77 ,0x20 ,0x5 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x5 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x5 ,0x20 ,0x11 ,0x73 ,0x20 ,0x1 ,0x71 ,0x20 ,0x5 ,0x20 ,0x11 ,0x71 ,0x73 ,0x6a ,0x20 ,0x17 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0x2 ,0x20 ,0x19 ,0x6a ,0x20 ,0x1d ,0x41 ,0xf ,0x77 ,0x20 ,0x1d ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1d ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x7 ,0x41 ,0x19 ,0x77 ,0x20 ,0x7 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x7 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x19 ,0x6a ,0x20 ,0x13 ,0x20 ,0x4 ,0x6a ,0x22 ,0xb ,0x20 ,0x23 ,0x20 ,0xd ,0x73 ,0x71 ,0x20 ,0xd ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x13 ,0x6a ,0x22 ,0x4 ,0x41 ,0x1e ,0x77 ,0x20 ,0x4 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x4 ,0x20 ,0x5 ,0x73 ,0x20 ,0x11 ,0x71 ,0x20 ,0x4 ,0x20 ,0x5 ,0x71 ,0x73 ,0x6a ,0x20 ,0x17 ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0xd ,0x6a ,0x20 ,0x7 ,0x20 ,0x22 ,0x6a ,0x20 ,0x1b ,0x41 ,0xf ,0x77 ,0x20 ,0x1b ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1b ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x6 ,0x41 ,0x19 ,0x77 ,0x20 ,0x6 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x6 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x7 ,0x6a ,0x20 ,0x13 ,0x20 ,0x9 ,0x6a ,0x22 ,0x9 ,0x20 ,0xb ,0x20 ,0x23 ,0x73 ,0x71 ,0x20 ,0x23 ,0x73 ,0x6a ,0x20 ,0x9 ,0x41 ,0x1a ,0x77 ,0x20 ,0x9 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x9 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0xd ,0x6a ,0x22 ,0x13 ,0x41 ,0x1e ,0x77 ,0x20 ,0x13 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x13 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x13 ,0x20 ,0x4 ,0x73 ,0x20 ,0x5 ,0x71 ,0x20 ,0x13 ,0x20 ,0x4 ,0x71 ,0x73 ,0x6a ,0x20 ,0x23 ,0x20 ,0x17 ,0x41 ,0x18 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x6 ,0x20 ,0x1f ,0x6a ,0x20 ,0x19 ,0x41 ,0xf ,0x77 ,0x20 ,0x19 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x19 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x16 ,0x41 ,0x19 ,0x77 ,0x20 ,0x16 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x16 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x6 ,0x6a ,0x20 ,0xd ,0x20 ,0x1 ,0x6a ,0x22 ,0xd ,0x20 ,0x9 ,0x20 ,0xb ,0x73 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0xd ,0x41 ,0x1a ,0x77 ,0x20 ,0xd ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x1 ,0x41 ,0x1e ,0x77 ,0x20 ,0x1 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x1 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x1 ,0x20 ,0x13 ,0x73 ,0x20 ,0x4 ,0x71 ,0x20 ,0x1 ,0x20 ,0x13 ,0x71 ,0x73 ,0x6a ,0x20 ,0x16 ,0x20 ,0x3 ,0x6a ,0x20 ,0x7 ,0x41 ,0xf ,0x77 ,0x20 ,0x7 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x7 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x20 ,0x15 ,0x41 ,0x19 ,0x77 ,0x20 ,0x15 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x15 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x22 ,0x16 ,0x20 ,0x17 ,0x41 ,0x1c ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0xb ,0x6a ,0x20 ,0x23 ,0x20 ,0x11 ,0x6a ,0x22 ,0xb ,0x20 ,0xd ,0x20 ,0x9 ,0x73 ,0x71 ,0x20 ,0x9 ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x11 ,0x41 ,0x1e ,0x77 ,0x20 ,0x11 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x11 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x11 ,0x20 ,0x1 ,0x73 ,0x20 ,0x13 ,0x71 ,0x20 ,0x11 ,0x20 ,0x1 ,0x71 ,0x73 ,0x6a ,0x20 ,0x20 ,0x20 ,0x21 ,0x41 ,0x19 ,0x77 ,0x20 ,0x21 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x21 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x20 ,0x15 ,0x6a ,0x20 ,0x6 ,0x41 ,0xf ,0x77 ,0x20 ,0x6 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x6 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x15 ,0x20 ,0x17 ,0x41 ,0x20 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x6a ,0x20 ,0x23 ,0x20 ,0x5 ,0x6a ,0x22 ,0x9 ,0x20 ,0xb ,0x20 ,0xd ,0x73 ,0x71 ,0x20 ,0xd ,0x73 ,0x6a ,0x20 ,0x9 ,0x41 ,0x1a ,0x77 ,0x20 ,0x9 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x9 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x23 ,0x6a ,0x22 ,0x5 ,0x41 ,0x1e ,0x77 ,0x20 ,0x5 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x5 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x5 ,0x20 ,0x11 ,0x73 ,0x20 ,0x1 ,0x71 ,0x20 ,0x5 ,0x20 ,0x11 ,0x71 ,0x73 ,0x6a ,0x20 ,0x1e ,0x41 ,0x19 ,0x77 ,0x20 ,0x1e ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1e ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x21 ,0x6a ,0x20 ,0x1d ,0x6a ,0x20 ,0x16 ,0x41 ,0xf ,0x77 ,0x20 ,0x16 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x16 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x21 ,0x20 ,0x17 ,0x41 ,0x24 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0xd ,0x6a ,0x20 ,0x23 ,0x20 ,0x4 ,0x6a ,0x22 ,0x24 ,0x20 ,0x9 ,0x20 ,0xb ,0x73 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0x24 ,0x41 ,0x1a ,0x77 ,0x20 ,0x24 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x24 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0xd ,0x6a ,0x22 ,0x4 ,0x41 ,0x1e ,0x77 ,0x20 ,0x4 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x4 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x4 ,0x20 ,0x5 ,0x73 ,0x20 ,0x11 ,0x71 ,0x20 ,0x4 ,0x20 ,0x5 ,0x71 ,0x73 ,0x6a ,0x20 ,0x1c ,0x41 ,0x19 ,0x77 ,0x20 ,0x1c ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1c ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x1e ,0x6a ,0x20 ,0x1b ,0x6a ,0x20 ,0x15 ,0x41 ,0xf ,0x77 ,0x20 ,0x15 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x15 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x1e ,0x20 ,0x17 ,0x41 ,0x28 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0xb ,0x6a ,0x20 ,0xd ,0x20 ,0x13 ,0x6a ,0x22 ,0x13 ,0x20 ,0x24 ,0x20 ,0x9 ,0x73 ,0x71 ,0x20 ,0x9 ,0x73 ,0x6a ,0x20 ,0x13 ,0x41 ,0x1a ,0x77 ,0x20 ,0x13 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x13 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0xb ,0x6a ,0x22 ,0xd ,0x41 ,0x1e ,0x77 ,0x20 ,0xd ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0xd ,0x20 ,0x4 ,0x73 ,0x20 ,0x5 ,0x71 ,0x20 ,0xd ,0x20 ,0x4 ,0x71 ,0x73 ,0x6a ,0x20 ,0x1a ,0x41 ,0x19 ,0x77 ,0x20 ,0x1a ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1a ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x1c ,0x6a ,0x20 ,0x19 ,0x6a ,0x20 ,0x21 ,0x41 ,0xf ,0x77 ,0x20 ,0x21 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x21 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x1c ,0x20 ,0x17 ,0x41 ,0x2c ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x6a ,0x20 ,0xb ,0x20 ,0x1 ,0x6a ,0x22 ,0xb ,0x20 ,0x13 ,0x20 ,0x24 ,0x73 ,0x71 ,0x20 ,0x24 ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x1 ,0x6a ,0x22 ,0x23 ,0x41 ,0x1e ,0x77 ,0x20 ,0x23 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x23 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x23 ,0x20 ,0xd ,0x73 ,0x20 ,0x4 ,0x71 ,0x20 ,0x23 ,0x20 ,0xd ,0x71 ,0x73 ,0x6a ,0x20 ,0x2 ,0x41 ,0x19 ,0x77 ,0x20 ,0x2 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x2 ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x1a ,0x6a ,0x20 ,0x7 ,0x6a ,0x20 ,0x1e ,0x41 ,0xf ,0x77 ,0x20 ,0x1e ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1e ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x1a ,0x20 ,0x17 ,0x41 ,0x30 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x24 ,0x6a ,0x20 ,0x1 ,0x20 ,0x11 ,0x6a ,0x22 ,0x24 ,0x20 ,0xb ,0x20 ,0x13 ,0x73 ,0x71 ,0x20 ,0x13 ,0x73 ,0x6a ,0x20 ,0x24 ,0x41 ,0x1a ,0x77 ,0x20 ,0x24 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x24 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x11 ,0x6a ,0x22 ,0x1 ,0x41 ,0x1e ,0x77 ,0x20 ,0x1 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x1 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x1 ,0x20 ,0x23 ,0x73 ,0x20 ,0xd ,0x71 ,0x20 ,0x1 ,0x20 ,0x23 ,0x71 ,0x73 ,0x6a ,0x20 ,0x2 ,0x20 ,0x22 ,0x41 ,0x19 ,0x77 ,0x20 ,0x22 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x22 ,0x41 ,0x3 ,0x76 ,0x73 ,0x6a ,0x20 ,0x6 ,0x6a ,0x20 ,0x1c ,0x41 ,0xf ,0x77 ,0x20 ,0x1c ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1c ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x2 ,0x20 ,0x17 ,0x41 ,0x34 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x13 ,0x6a ,0x20 ,0x11 ,0x20 ,0x5 ,0x6a ,0x22 ,0x9 ,0x20 ,0x24 ,0x20 ,0xb ,0x73 ,0x71 ,0x20 ,0xb ,0x73 ,0x6a ,0x20 ,0x9 ,0x41 ,0x1a ,0x77 ,0x20 ,0x9 ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0x9 ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x5 ,0x6a ,0x22 ,0x11 ,0x41 ,0x1e ,0x77 ,0x20 ,0x11 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x11 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x11 ,0x20 ,0x1 ,0x73 ,0x20 ,0x23 ,0x71 ,0x20 ,0x11 ,0x20 ,0x1 ,0x71 ,0x73 ,0x6a ,0x20 ,0x1f ,0x41 ,0x19 ,0x77 ,0x20 ,0x1f ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x1f ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x22 ,0x6a ,0x20 ,0x16 ,0x6a ,0x20 ,0x1a ,0x41 ,0xf ,0x77 ,0x20 ,0x1a ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x1a ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x22 ,0x20 ,0x17 ,0x41 ,0x38 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0xb ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x22 ,0xb ,0x20 ,0x9 ,0x20 ,0x24 ,0x73 ,0x71 ,0x20 ,0x24 ,0x73 ,0x6a ,0x20 ,0xb ,0x41 ,0x1a ,0x77 ,0x20 ,0xb ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xb ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x4 ,0x6a ,0x22 ,0x13 ,0x41 ,0x1e ,0x77 ,0x20 ,0x13 ,0x41 ,0x13 ,0x77 ,0x73 ,0x20 ,0x13 ,0x41 ,0xa ,0x77 ,0x73 ,0x20 ,0x13 ,0x20 ,0x11 ,0x73 ,0x20 ,0x1 ,0x71 ,0x20 ,0x13 ,0x20 ,0x11 ,0x71 ,0x73 ,0x6a ,0x20 ,0x3 ,0x41 ,0x19 ,0x77 ,0x20 ,0x3 ,0x41 ,0xe ,0x77 ,0x73 ,0x20 ,0x3 ,0x41 ,0x3 ,0x76 ,0x73 ,0x20 ,0x1f ,0x6a ,0x20 ,0x15 ,0x6a ,0x20 ,0x2 ,0x41 ,0xf ,0x77 ,0x20 ,0x2 ,0x41 ,0xd ,0x77 ,0x73 ,0x20 ,0x2 ,0x41 ,0xa ,0x76 ,0x73 ,0x6a ,0x22 ,0x1f ,0x20 ,0x17 ,0x41 ,0x3c ,0x6a ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x24 ,0x6a ,0x20 ,0x4 ,0x20 ,0xd ,0x6a ,0x22 ,0xd ,0x20 ,0xb ,0x20 ,0x9 ,0x73 ,0x71 ,0x20 ,0x9 ,0x73 ,0x6a ,0x20 ,0xd ,0x41 ,0x1a ,0x77 ,0x20 ,0xd ,0x41 ,0x15 ,0x77 ,0x73 ,0x20 ,0xd ,0x41 ,0x7 ,0x77 ,0x73 ,0x6a ,0x22 ,0x5 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x23 ,0x6a ,0x21 ,0x5 ,0x20 ,0x17 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x21 ,0x17 ,0x20 ,0x18 ,0x41 ,0x10 ,0x6a ,0x22 ,0x18 ,0x41 ,0x30 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x20 ,0x9 ,0x20 ,0x8 ,0x6a ,0x36 ,0x2 ,0x1c ,0x20 ,0x0 ,0x20 ,0xb ,0x20 ,0xa ,0x6a ,0x36 ,0x2 ,0x18 ,0x20 ,0x0 ,0x20 ,0xd ,0x20 ,0xc ,0x6a ,0x36 ,0x2 ,0x14 ,0x20 ,0x0 ,0x20 ,0x5 ,0x20 ,0xe ,0x6a ,0x36 ,0x2 ,0x10 ,0x20 ,0x0 ,0x20 ,0x1 ,0x20 ,0xf ,0x6a ,0x36 ,0x2 ,0xc ,0x20 ,0x0 ,0x20 ,0x11 ,0x20 ,0x10 ,0x6a ,0x36 ,0x2 ,0x8 ,0x20 ,0x0 ,0x20 ,0x13 ,0x20 ,0x12 ,0x6a ,0x36 ,0x2 ,0x4 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x14 ,0x6a ,0x36 ,0x2 ,0x0 ,0xb ,0xd7 ,0x1 ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x2 ,0x68 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x28 ,0x6a ,0x22 ,0x4 ,0x20 ,0x3 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x20 ,0x3 ,0x6b ,0x22 ,0x3 ,0x49 ,0xd ,0x1 ,0x20 ,0x5 ,0x20 ,0x2 ,0x20 ,0x3 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x29 ,0x3 ,0x20 ,0x42 ,0x1 ,0x7c ,0x37 ,0x3 ,0x20 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6b ,0x21 ,0x1 ,0x20 ,0x2 ,0x20 ,0x3 ,0x6a ,0x21 ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x29 ,0x3 ,0x20 ,0x42 ,0x1 ,0x7c ,0x37 ,0x3 ,0x20 ,0x20 ,0x2 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x40 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x28 ,0x6a ,0x20 ,0x2 ,0x20 ,0x1 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x20 ,0x2 ,0x20 ,0x1 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0x28 ,0x2 ,0x68 ,0x20 ,0x1 ,0x6a ,0x21 ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x68 ,0xb ,0xf7 ,0x2 ,0x2 ,0x4 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x21 ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x2 ,0x68 ,0x22 ,0x3 ,0x41 ,0xc0 ,0x0 ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x28 ,0x6a ,0x22 ,0x4 ,0x20 ,0x3 ,0x6a ,0x41 ,0x80 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x38 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x5 ,0x20 ,0x6 ,0x41 ,0x0 ,0x20 ,0x3 ,0x41 ,0x3f ,0x73 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x6a ,0x41 ,0x0 ,0x41 ,0x38 ,0x20 ,0x5 ,0x6b ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0x41 ,0xe7 ,0x0 ,0x6a ,0x20 ,0x0 ,0x28 ,0x2 ,0x68 ,0x41 ,0x3 ,0x74 ,0x22 ,0x3 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe3 ,0x0 ,0x6a ,0x20 ,0x0 ,0x29 ,0x3 ,0x20 ,0x22 ,0x7 ,0x42 ,0x17 ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe2 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x1f ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe1 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x27 ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe0 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x2f ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe6 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x9 ,0x86 ,0x20 ,0x3 ,0xad ,0x84 ,0x22 ,0x7 ,0x42 ,0x8 ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe5 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x10 ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe4 ,0x0 ,0x6a ,0x20 ,0x7 ,0x42 ,0x18 ,0x88 ,0x3c ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x20 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x68 ,0x20 ,0x0 ,0x42 ,0x0 ,0x37 ,0x3 ,0x20 ,0x20 ,0x0 ,0x41 ,0x18 ,0x6a ,0x41 ,0x0 ,0x29 ,0x3 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x0 ,0x41 ,0x10 ,0x6a ,0x41 ,0x0 ,0x29 ,0x3 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x0 ,0x41 ,0x8 ,0x6a ,0x41 ,0x0 ,0x29 ,0x3 ,0x88 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x29 ,0x3 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xfc ,0x1 ,0x1 ,0x6 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x0 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x18 ,0x6a ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x7 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x42 ,0x0 ,0x37 ,0x3 ,0x88 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x42 ,0x0 ,0x37 ,0x3 ,0x80 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x42 ,0x0 ,0x37 ,0x3 ,0xf8 ,0x8a ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x42 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x8a ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x0 ,0x29 ,0x3 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x4 ,0x41 ,0x0 ,0x29 ,0x3 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x5 ,0x41 ,0x0 ,0x29 ,0x3 ,0x88 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x2 ,0x41 ,0x0 ,0x29 ,0x3 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0x68 ,0x20 ,0x2 ,0x42 ,0x0 ,0x37 ,0x3 ,0x20 ,0x20 ,0x2 ,0x41 ,0x38 ,0x41 ,0xa0 ,0x8a ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x20 ,0x41 ,0xf0 ,0x8a ,0x80 ,0x80 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0x41 ,0x7f ,0x6a ,0x22 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0xf0 ,0x0 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xf ,0x0 ,0x41 ,0xb2 ,0x4 ,0x41 ,0x1 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0xe6 ,0x2 ,0x2 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0xa0 ,0x2 ,0x67 ,0xe6 ,0x9 ,0x6a ,0x85 ,0xae ,0x67 ,0xbb ,0x72 ,0xf3 ,0x6e ,0x3c ,0x3a ,0xf5 ,0x4f ,0xa5 ,0x7f ,0x52 ,0xe ,0x51 ,0x8c ,0x68 ,0x5 ,0x9b ,0xab ,0xd9 ,0x83 ,0x1f ,0x19 ,0xcd ,0xe0 ,0x5b ,0x98 ,0x2f ,0x8a ,0x42 ,0x91 ,0x44 ,0x37 ,0x71 ,0xcf ,0xfb ,0xc0 ,0xb5 ,0xa5 ,0xdb ,0xb5 ,0xe9 ,0x5b ,0xc2 ,0x56 ,0x39 ,0xf1 ,0x11 ,0xf1 ,0x59 ,0xa4 ,0x82 ,0x3f ,0x92 ,0xd5 ,0x5e ,0x1c ,0xab ,0x98 ,0xaa ,0x7 ,0xd8 ,0x1 ,0x5b ,0x83 ,0x12 ,0xbe ,0x85 ,0x31 ,0x24 ,0xc3 ,0x7d ,0xc ,0x55 ,0x74 ,0x5d ,0xbe ,0x72 ,0xfe ,0xb1 ,0xde ,0x80 ,0xa7 ,0x6 ,0xdc ,0x9b ,0x74 ,0xf1 ,0x9b ,0xc1 ,0xc1 ,0x69 ,0x9b ,0xe4 ,0x86 ,0x47 ,0xbe ,0xef ,0xc6 ,0x9d ,0xc1 ,0xf ,0xcc ,0xa1 ,0xc ,0x24 ,0x6f ,0x2c ,0xe9 ,0x2d ,0xaa ,0x84 ,0x74 ,0x4a ,0xdc ,0xa9 ,0xb0 ,0x5c ,0xda ,0x88 ,0xf9 ,0x76 ,0x52 ,0x51 ,0x3e ,0x98 ,0x6d ,0xc6 ,0x31 ,0xa8 ,0xc8 ,0x27 ,0x3 ,0xb0 ,0xc7 ,0x7f ,0x59 ,0xbf ,0xf3 ,0xb ,0xe0 ,0xc6 ,0x47 ,0x91 ,0xa7 ,0xd5 ,0x51 ,0x63 ,0xca ,0x6 ,0x67 ,0x29 ,0x29 ,0x14 ,0x85 ,0xa ,0xb7 ,0x27 ,0x38 ,0x21 ,0x1b ,0x2e ,0xfc ,0x6d ,0x2c ,0x4d ,0x13 ,0xd ,0x38 ,0x53 ,0x54 ,0x73 ,0xa ,0x65 ,0xbb ,0xa ,0x6a ,0x76 ,0x2e ,0xc9 ,0xc2 ,0x81 ,0x85 ,0x2c ,0x72 ,0x92 ,0xa1 ,0xe8 ,0xbf ,0xa2 ,0x4b ,0x66 ,0x1a ,0xa8 ,0x70 ,0x8b ,0x4b ,0xc2 ,0xa3 ,0x51 ,0x6c ,0xc7 ,0x19 ,0xe8 ,0x92 ,0xd1 ,0x24 ,0x6 ,0x99 ,0xd6 ,0x85 ,0x35 ,0xe ,0xf4 ,0x70 ,0xa0 ,0x6a ,0x10 ,0x16 ,0xc1 ,0xa4 ,0x19 ,0x8 ,0x6c ,0x37 ,0x1e ,0x4c ,0x77 ,0x48 ,0x27 ,0xb5 ,0xbc ,0xb0 ,0x34 ,0xb3 ,0xc ,0x1c ,0x39 ,0x4a ,0xaa ,0xd8 ,0x4e ,0x4f ,0xca ,0x9c ,0x5b ,0xf3 ,0x6f ,0x2e ,0x68 ,0xee ,0x82 ,0x8f ,0x74 ,0x6f ,0x63 ,0xa5 ,0x78 ,0x14 ,0x78 ,0xc8 ,0x84 ,0x8 ,0x2 ,0xc7 ,0x8c ,0xfa ,0xff ,0xbe ,0x90 ,0xeb ,0x6c ,0x50 ,0xa4 ,0xf7 ,0xa3 ,0xf9 ,0xbe ,0xf2 ,0x78 ,0x71 ,0xc6 ,0x0 ,0x41 ,0xa0 ,0xa ,0xb ,0x38 ,0x61 ,0x62 ,0x63 ,0x64 ,0x62 ,0x63 ,0x64 ,0x65 ,0x63 ,0x64 ,0x65 ,0x66 ,0x64 ,0x65 ,0x66 ,0x67 ,0x65 ,0x66 ,0x67 ,0x68 ,0x66 ,0x67 ,0x68 ,0x69 ,0x67 ,0x68 ,0x69 ,0x6a ,0x68 ,0x69 ,0x6a ,0x6b ,0x69 ,0x6a ,0x6b ,0x6c ,0x6a ,0x6b ,0x6c ,0x6d ,0x6b ,0x6c ,0x6d ,0x6e ,0x6c ,0x6d ,0x6e ,0x6f ,0x6d ,0x6e ,0x6f ,0x70 ,0x6e ,0x6f ,0x70 ,0x71};
-
-static uint8_t nsichneu[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x13 ,0x4 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0xb ,0xa ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xf0 ,0x85 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xe8 ,0x8 ,0xb ,0x7f ,0x0 ,0x41 ,0xf0 ,0x85 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x7 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xd5 ,0xe0 ,0x1 ,0xa ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xac ,0xdf ,0x1 ,0x1 ,0x4 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x41 ,0x3 ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x5 ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x98 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7d ,0x6a ,0x36 ,0x2 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x5 ,0x6b ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7c ,0x6a ,0x36 ,0x2 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x6a ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x6a ,0x36 ,0x2 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xf ,0x0 ,0x41 ,0xd0 ,0x9 ,0x41 ,0x1 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xb ,0xf ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x8 ,0x3 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0};
-
-static uint8_t picojpeg[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x27 ,0x7 ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x1e ,0x1d ,0x1 ,0x1 ,0x2 ,0x2 ,0x3 ,0x3 ,0x3 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x0 ,0x5 ,0x1 ,0x2 ,0x5 ,0x0 ,0x1 ,0x4 ,0x2 ,0x3 ,0x1 ,0x2 ,0x1 ,0x1 ,0x6 ,0x6 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x2 ,0x2 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xd0 ,0x9e ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xc4 ,0x21 ,0xb ,0x7f ,0x0 ,0x41 ,0xd0 ,0x9e ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x18 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0x9 ,0x7 ,0x1 ,0x0 ,0x41 ,0x1 ,0xb ,0x1 ,0x12 ,0xa ,0x8a ,0x72 ,0x1d ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xc4 ,0x2e ,0x1 ,0x1a ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2f ,0x1 ,0xa6 ,0x8e ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x1 ,0xf ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2f ,0x1 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2f ,0x1 ,0xd6 ,0x94 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x80 ,0xc ,0x21 ,0x0 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x2 ,0x40 ,0x3 ,0x40 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x45 ,0xd ,0x6 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x1d ,0x21 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0xf0 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0xd0 ,0x1 ,0x6a ,0x20 ,0x1 ,0x47 ,0xd ,0x5 ,0x41 ,0x0 ,0x41 ,0x8 ,0x3a ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0x3b ,0x1 ,0xd6 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x41 ,0x7 ,0x71 ,0x3b ,0x1 ,0xf0 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xb4 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x1 ,0xb0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0x8 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x8 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x2f ,0x1 ,0xd6 ,0x94 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x3b ,0x1 ,0xd6 ,0x94 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0xf0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x0 ,0x41 ,0xe2 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x1b ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x41 ,0xf0 ,0x96 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0x97 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe5 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x1b ,0x41 ,0x90 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x1b ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0xf ,0x71 ,0x22 ,0x5 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xb0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2f ,0x1 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x3b ,0x1 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x2f ,0x1 ,0x0 ,0x20 ,0x1 ,0x6c ,0x3b ,0x1 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x9a ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x9c ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xc0 ,0x99 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x0 ,0x1b ,0x21 ,0x2 ,0x41 ,0xc4 ,0x99 ,0x80 ,0x80 ,0x0 ,0x41 ,0x94 ,0x9a ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x1b ,0x21 ,0x5 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0x1 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0xf ,0x71 ,0x22 ,0x6 ,0x45 ,0xd ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x1 ,0x21 ,0x0 ,0xc ,0x2 ,0xb ,0x20 ,0x0 ,0x41 ,0x4 ,0x76 ,0x20 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3f ,0x4d ,0xd ,0x1 ,0xc ,0x9 ,0xb ,0x20 ,0x0 ,0x41 ,0xf0 ,0x1 ,0x47 ,0xd ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x30 ,0x4b ,0xd ,0x8 ,0x20 ,0x1 ,0x41 ,0xf ,0x6a ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3f ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x2e ,0x1 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x0 ,0xc1 ,0x41 ,0xf ,0x75 ,0x41 ,0x7f ,0x73 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0xe ,0x5 ,0x0 ,0x1 ,0x3 ,0x2 ,0x4 ,0x0 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0xc ,0xb ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x3 ,0x5 ,0x0 ,0x1 ,0xc ,0xb ,0x41 ,0x0 ,0x41 ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6b ,0x22 ,0x1 ,0x41 ,0x53 ,0x4a ,0x1b ,0x20 ,0x1 ,0x41 ,0x2c ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0xc ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6b ,0x22 ,0x1 ,0x41 ,0xa4 ,0x7f ,0x4a ,0x1b ,0x20 ,0x1 ,0x41 ,0xdb ,0x0 ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0xc ,0xa ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x4 ,0x4 ,0x6 ,0x0 ,0x1 ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0xc ,0xa ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8f ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8f ,0x80 ,0x80 ,0x0 ,0xc ,0x9 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x4 ,0x3 ,0x4 ,0x0 ,0x1 ,0xa ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x93 ,0x80 ,0x80 ,0x0 ,0xc ,0x9 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6b ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x0 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x8f ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x8f ,0x80 ,0x80 ,0x0 ,0xc ,0x8 ,0xb ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x6 ,0x0 ,0x1 ,0x2 ,0x3 ,0x4 ,0x5 ,0x7 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x8f ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x93 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x8f ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x90 ,0x94 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x92 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x1 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x94 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x91 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x92 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x92 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x20 ,0x1 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x8f ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x8f ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd0 ,0x8f ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0xd0 ,0x8f ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x90 ,0x90 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x1 ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0xf ,0x71 ,0x22 ,0x6 ,0x45 ,0xd ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x4 ,0x76 ,0x22 ,0x1 ,0x20 ,0x0 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3f ,0x4b ,0xd ,0xa ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x74 ,0x6a ,0x2f ,0x1 ,0x0 ,0x20 ,0x7 ,0x20 ,0x6 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x6c ,0x3b ,0x1 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x41 ,0xf0 ,0x1 ,0x47 ,0xd ,0x2 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0x30 ,0x4b ,0xd ,0x8 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x0 ,0x41 ,0x10 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xc1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xc0 ,0x0 ,0x49 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xc0 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x22 ,0x8 ,0x2f ,0x1 ,0x0 ,0x22 ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x9 ,0x2f ,0x1 ,0x0 ,0x22 ,0x5 ,0x72 ,0x20 ,0x0 ,0x41 ,0x6 ,0x6a ,0x22 ,0xa ,0x2f ,0x1 ,0x0 ,0x22 ,0x6 ,0x72 ,0x20 ,0x0 ,0x41 ,0x8 ,0x6a ,0x22 ,0xb ,0x2f ,0x1 ,0x0 ,0x22 ,0x7 ,0x72 ,0x20 ,0x0 ,0x41 ,0xa ,0x6a ,0x22 ,0xc ,0x2f ,0x1 ,0x0 ,0x22 ,0x4 ,0x72 ,0x20 ,0x0 ,0x41 ,0xc ,0x6a ,0x22 ,0xd ,0x2f ,0x1 ,0x0 ,0x22 ,0xe ,0x72 ,0x20 ,0x0 ,0x41 ,0xe ,0x6a ,0x22 ,0xf ,0x2f ,0x1 ,0x0 ,0x22 ,0x10 ,0x72 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x0 ,0x2f ,0x1 ,0x0 ,0x22 ,0x1 ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x6 ,0x20 ,0x1 ,0x21 ,0x7 ,0x20 ,0x1 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0xe ,0x20 ,0x1 ,0x21 ,0x11 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x0 ,0x2f ,0x1 ,0x0 ,0x22 ,0x12 ,0x20 ,0x7 ,0x6a ,0x22 ,0x13 ,0x20 ,0xe ,0x20 ,0x1 ,0x6a ,0x22 ,0x14 ,0x6a ,0x22 ,0x11 ,0x20 ,0x10 ,0x20 ,0x5 ,0x6a ,0x22 ,0x15 ,0x20 ,0x4 ,0x20 ,0x6 ,0x6a ,0x22 ,0x16 ,0x6a ,0x22 ,0x17 ,0x6a ,0x3b ,0x1 ,0x0 ,0x20 ,0x11 ,0x20 ,0x17 ,0x6b ,0x21 ,0x11 ,0x20 ,0x12 ,0x20 ,0x7 ,0x6b ,0x22 ,0x7 ,0x20 ,0x1 ,0x20 ,0xe ,0x6b ,0xc1 ,0x41 ,0xea ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x14 ,0x6b ,0x22 ,0x12 ,0x6a ,0x22 ,0x1 ,0x20 ,0x5 ,0x20 ,0x10 ,0x6b ,0x22 ,0x5 ,0xc1 ,0x41 ,0x95 ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x17 ,0x20 ,0x4 ,0x20 ,0x6 ,0x6b ,0x22 ,0x10 ,0x20 ,0x5 ,0x6b ,0xc1 ,0x41 ,0xc4 ,0x1 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x22 ,0x18 ,0x6a ,0x6b ,0x22 ,0x5 ,0x6b ,0x21 ,0xe ,0x20 ,0x1 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x20 ,0x7 ,0x20 ,0x12 ,0x6b ,0x22 ,0x7 ,0x20 ,0x15 ,0x20 ,0x16 ,0x6b ,0xc1 ,0x41 ,0xea ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x5 ,0x6b ,0x22 ,0x6 ,0x6b ,0x21 ,0x4 ,0x20 ,0x7 ,0x20 ,0x6 ,0x6a ,0x21 ,0x5 ,0x20 ,0x13 ,0x20 ,0x14 ,0x6b ,0x22 ,0x14 ,0x20 ,0x6 ,0x20 ,0x18 ,0x20 ,0x10 ,0xc1 ,0x41 ,0x9d ,0x5 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x6b ,0x6a ,0x22 ,0x6 ,0x6a ,0x21 ,0x7 ,0x20 ,0x14 ,0x20 ,0x6 ,0x6b ,0x21 ,0x6 ,0xb ,0x20 ,0xf ,0x20 ,0x11 ,0x3b ,0x1 ,0x0 ,0x20 ,0xd ,0x20 ,0xe ,0x3b ,0x1 ,0x0 ,0x20 ,0xc ,0x20 ,0x4 ,0x3b ,0x1 ,0x0 ,0x20 ,0xb ,0x20 ,0x7 ,0x3b ,0x1 ,0x0 ,0x20 ,0xa ,0x20 ,0x6 ,0x3b ,0x1 ,0x0 ,0x20 ,0x8 ,0x20 ,0x5 ,0x3b ,0x1 ,0x0 ,0x20 ,0x9 ,0x20 ,0x1 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x41 ,0x10 ,0x6a ,0x21 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x20 ,0x6a ,0x22 ,0x8 ,0x2f ,0x1 ,0x0 ,0x22 ,0x1 ,0x20 ,0x0 ,0x41 ,0x10 ,0x6a ,0x22 ,0x9 ,0x2f ,0x1 ,0x0 ,0x22 ,0x5 ,0x72 ,0x20 ,0x0 ,0x41 ,0x30 ,0x6a ,0x22 ,0xa ,0x2f ,0x1 ,0x0 ,0x22 ,0x6 ,0x72 ,0x20 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x22 ,0xb ,0x2f ,0x1 ,0x0 ,0x22 ,0x7 ,0x72 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x22 ,0xc ,0x2f ,0x1 ,0x0 ,0x22 ,0x4 ,0x72 ,0x20 ,0x0 ,0x41 ,0xe0 ,0x0 ,0x6a ,0x22 ,0xd ,0x2f ,0x1 ,0x0 ,0x22 ,0xe ,0x72 ,0x20 ,0x0 ,0x41 ,0xf0 ,0x0 ,0x6a ,0x22 ,0xf ,0x2f ,0x1 ,0x0 ,0x22 ,0x10 ,0x72 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x8 ,0x20 ,0x0 ,0x2e ,0x1 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x3b ,0x1 ,0x0 ,0x20 ,0x9 ,0x20 ,0x1 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3b ,0x1 ,0x0 ,0x20 ,0x1 ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x6 ,0x20 ,0x1 ,0x21 ,0x7 ,0x20 ,0x1 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x10 ,0x20 ,0x5 ,0x6a ,0x22 ,0x17 ,0x20 ,0x4 ,0x20 ,0x6 ,0x6a ,0x22 ,0x12 ,0x6a ,0x22 ,0x13 ,0xc1 ,0x22 ,0x15 ,0x20 ,0x0 ,0x2f ,0x1 ,0x0 ,0x22 ,0x16 ,0x20 ,0x7 ,0x6a ,0x22 ,0x18 ,0x20 ,0xe ,0x20 ,0x1 ,0x6a ,0x22 ,0x11 ,0x6a ,0xc1 ,0x22 ,0x19 ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x14 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x14 ,0x20 ,0x14 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x3b ,0x1 ,0x0 ,0x20 ,0x9 ,0x20 ,0x5 ,0x20 ,0x10 ,0x6b ,0x22 ,0x5 ,0xc1 ,0x41 ,0x95 ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x13 ,0x20 ,0x4 ,0x20 ,0x6 ,0x6b ,0x22 ,0x10 ,0x20 ,0x5 ,0x6b ,0xc1 ,0x41 ,0xc4 ,0x1 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x22 ,0x5 ,0x6a ,0x6b ,0x22 ,0x6 ,0xc1 ,0x22 ,0x14 ,0x20 ,0x16 ,0x20 ,0x7 ,0x6b ,0x22 ,0x7 ,0x20 ,0x1 ,0x20 ,0xe ,0x6b ,0xc1 ,0x41 ,0xea ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x11 ,0x6b ,0x22 ,0x4 ,0x6a ,0xc1 ,0x22 ,0xe ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x3b ,0x1 ,0x0 ,0x20 ,0x8 ,0x20 ,0x17 ,0x20 ,0x12 ,0x6b ,0xc1 ,0x41 ,0xea ,0x2 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x20 ,0x6 ,0x6b ,0x22 ,0x9 ,0xc1 ,0x22 ,0x6 ,0x20 ,0x7 ,0x20 ,0x4 ,0x6b ,0xc1 ,0x22 ,0x17 ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x3b ,0x1 ,0x0 ,0x20 ,0x19 ,0x20 ,0x15 ,0x6b ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x4 ,0x20 ,0xe ,0x20 ,0x14 ,0x6b ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x7 ,0x20 ,0x17 ,0x20 ,0x6 ,0x6b ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x6 ,0x20 ,0x5 ,0x20 ,0x10 ,0xc1 ,0x41 ,0x9d ,0x5 ,0x6c ,0x41 ,0x80 ,0x1 ,0x6a ,0x41 ,0x8 ,0x76 ,0x6b ,0x20 ,0x9 ,0x6a ,0xc1 ,0x22 ,0xe ,0x20 ,0x18 ,0x20 ,0x11 ,0x6b ,0xc1 ,0x22 ,0x10 ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x10 ,0x20 ,0xe ,0x6b ,0x41 ,0xc0 ,0x0 ,0x6a ,0x41 ,0x7 ,0x76 ,0x41 ,0x80 ,0x1 ,0x6a ,0x22 ,0x1 ,0xc1 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0xb ,0x20 ,0xf ,0x20 ,0x4 ,0x3b ,0x1 ,0x0 ,0x20 ,0xd ,0x20 ,0x7 ,0x3b ,0x1 ,0x0 ,0x20 ,0xc ,0x20 ,0x6 ,0x3b ,0x1 ,0x0 ,0x20 ,0xb ,0x20 ,0x5 ,0x3b ,0x1 ,0x0 ,0x20 ,0xa ,0x20 ,0x1 ,0x3b ,0x1 ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0xe ,0x5 ,0x0 ,0x1 ,0x3 ,0x2 ,0x4 ,0x0 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x6 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6b ,0x41 ,0x2c ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x5 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7f ,0x41 ,0x0 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6b ,0x22 ,0x6 ,0x41 ,0xa4 ,0x7f ,0x4a ,0x1b ,0x20 ,0x6 ,0x41 ,0xdb ,0x0 ,0x6a ,0x22 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x6 ,0x20 ,0x2 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x20 ,0x2 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x4 ,0x0 ,0x1 ,0x2 ,0x3 ,0x6 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x80 ,0x1 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x41 ,0x80 ,0x1 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x41 ,0x80 ,0x1 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x4 ,0x0 ,0x1 ,0x2 ,0x3 ,0x5 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x41 ,0xc0 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x41 ,0xc0 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xe ,0x6 ,0x0 ,0x1 ,0x2 ,0x3 ,0x4 ,0x5 ,0x6 ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0x80 ,0x1 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0xc0 ,0x0 ,0x21 ,0x5 ,0x41 ,0xc0 ,0x1 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x41 ,0xc0 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x41 ,0x80 ,0x1 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x24 ,0x41 ,0xc0 ,0x1 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x41 ,0xc0 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x41 ,0x80 ,0x1 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x24 ,0x41 ,0xc0 ,0x1 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0xa6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0x3b ,0x1 ,0xa6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0xf ,0xb ,0x41 ,0x1c ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x1d ,0x21 ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x20 ,0x0 ,0x20 ,0x1 ,0x1b ,0xb ,0xd4 ,0x1 ,0x1 ,0x1 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x4 ,0x3a ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x41 ,0x84 ,0x9f ,0x80 ,0x80 ,0x0 ,0x41 ,0xfc ,0x1 ,0x41 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xac ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf4 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x3a ,0x0 ,0xf4 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x59 ,0x41 ,0x7f ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x46 ,0x1b ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x3a ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x80 ,0x9f ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xb ,0xff ,0x1 ,0x1 ,0x5 ,0x7f ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x9 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x4 ,0x20 ,0x0 ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x74 ,0x3b ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x72 ,0x41 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x6b ,0x74 ,0x22 ,0x4 ,0x41 ,0x8 ,0x76 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x3 ,0x41 ,0x80 ,0xfe ,0x3 ,0x71 ,0x72 ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x78 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x4 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x21 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x4f ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x20 ,0x2 ,0x74 ,0x3b ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x72 ,0x20 ,0x6 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x6b ,0x74 ,0x21 ,0x1 ,0x20 ,0x2 ,0x20 ,0x5 ,0x6b ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x6 ,0x74 ,0x21 ,0x1 ,0x20 ,0x2 ,0x20 ,0x5 ,0x6b ,0x21 ,0x2 ,0xb ,0x41 ,0x0 ,0x20 ,0x2 ,0x3a ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3b ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x20 ,0x0 ,0x6b ,0x76 ,0xb ,0x96 ,0x1 ,0x1 ,0x4 ,0x7f ,0x41 ,0x0 ,0x21 ,0x2 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x4 ,0x41 ,0x1 ,0x74 ,0x6a ,0x41 ,0x20 ,0x6a ,0x2f ,0x1 ,0x0 ,0x22 ,0x5 ,0x4b ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0xff ,0xff ,0x3 ,0x47 ,0xd ,0x2 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x74 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x72 ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x10 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x3 ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x4 ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x6a ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x74 ,0x6a ,0x2d ,0x0 ,0x0 ,0x6b ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x3 ,0xb ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xb ,0x5d ,0x1 ,0x1 ,0x7f ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x2 ,0x41 ,0xe ,0x4b ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x74 ,0x41 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2f ,0x1 ,0x0 ,0x20 ,0x0 ,0x4d ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0xe ,0x4b ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x74 ,0x41 ,0x9e ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2f ,0x1 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x2 ,0x20 ,0x0 ,0x6a ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0xc1 ,0xb ,0xa8 ,0x2 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x7 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x22 ,0x5 ,0x20 ,0x7 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xa9 ,0x2 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x7 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x5 ,0x20 ,0x7 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xa1 ,0x2 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x7 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x7 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x8 ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xa2 ,0x2 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x6 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x7 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x7 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x8 ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x4 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xbb ,0x3 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x0 ,0x22 ,0x6 ,0x41 ,0xd8 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0x54 ,0x6a ,0x22 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x9 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xc6 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0x9d ,0x7e ,0x6a ,0x22 ,0x0 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x21 ,0x3 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xbc ,0x3 ,0x1 ,0x6 ,0x7f ,0x20 ,0x1 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x74 ,0x41 ,0xc0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x0 ,0x22 ,0x6 ,0x41 ,0xb7 ,0x1 ,0x6c ,0x41 ,0x8 ,0x76 ,0x41 ,0xa5 ,0x7f ,0x6a ,0x22 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x7 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x7 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x6b ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xe7 ,0x0 ,0x6c ,0x41 ,0x8 ,0x76 ,0x6a ,0x41 ,0xcd ,0x7e ,0x6a ,0x22 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x6 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x6 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x9 ,0x6a ,0x22 ,0x6 ,0x20 ,0x0 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0xf ,0x76 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x4b ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x21 ,0x3 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xa6 ,0x12 ,0x1 ,0x5 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x4 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2c ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x20 ,0x2 ,0x36 ,0x2 ,0xac ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0xa8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x3 ,0x3a ,0x0 ,0xb0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x8 ,0x3a ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xb2 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xb4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xb6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x84 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x85 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x86 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xf4 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xd8 ,0x1 ,0x46 ,0xd ,0x1 ,0xb ,0x41 ,0xff ,0x1f ,0x21 ,0x1 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x2 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x13 ,0x21 ,0x2 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xa8 ,0x7e ,0x6a ,0xe ,0x2 ,0x2 ,0x4 ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xb ,0x41 ,0x13 ,0x21 ,0x2 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0xfe ,0x3 ,0x49 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x41 ,0xe ,0x6a ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0xd ,0x0 ,0x41 ,0x25 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x2d ,0x0 ,0xe ,0x22 ,0x0 ,0x41 ,0xc0 ,0x7e ,0x6a ,0xe ,0x3 ,0x0 ,0x2 ,0x5 ,0x1 ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x7 ,0x21 ,0x2 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x8 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x3b ,0x1 ,0xb4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x8 ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x7e ,0x6a ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0x80 ,0x80 ,0x3 ,0x49 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x3b ,0x1 ,0xb2 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x9 ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x7e ,0x6a ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0x80 ,0x80 ,0x3 ,0x49 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x3a ,0x0 ,0xb6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0xa ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x3 ,0x41 ,0x3 ,0x4b ,0xd ,0x4 ,0x41 ,0xb ,0x21 ,0x2 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0x3 ,0x6c ,0x41 ,0x8 ,0x6a ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x2 ,0x41 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0x87 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x8a ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x8d ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe2 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0xfe ,0x1 ,0x71 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x4f ,0xd ,0x4 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x24 ,0x21 ,0x2 ,0xc ,0x4 ,0xb ,0x20 ,0x0 ,0x41 ,0xc9 ,0x1 ,0x46 ,0xd ,0x2 ,0xb ,0x41 ,0x14 ,0x21 ,0x2 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x2 ,0x41 ,0x1a ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x6 ,0x1 ,0x6 ,0xb ,0x41 ,0x1b ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8a ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8d ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x5 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7 ,0x21 ,0x0 ,0x41 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x1b ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8b ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8e ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8c ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8f ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8d ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8a ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x41 ,0x1 ,0x47 ,0x22 ,0x1 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x3 ,0x21 ,0x2 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x36 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0xde ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x80 ,0x2 ,0x3b ,0x1 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7 ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x47 ,0xd ,0x0 ,0x41 ,0x4 ,0x21 ,0x2 ,0x41 ,0x0 ,0x41 ,0x4 ,0x3a ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x21 ,0x6 ,0x41 ,0x0 ,0x41 ,0x3 ,0x36 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x80 ,0x80 ,0x84 ,0x10 ,0x36 ,0x2 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7 ,0x21 ,0x7 ,0x41 ,0xf ,0x21 ,0x0 ,0x41 ,0x10 ,0x21 ,0x3 ,0x41 ,0x8 ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x47 ,0x22 ,0x1 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x4 ,0x21 ,0x6 ,0x41 ,0x0 ,0x41 ,0x4 ,0x3a ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x36 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x80 ,0x80 ,0x84 ,0x10 ,0x36 ,0x2 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf ,0x21 ,0x7 ,0x41 ,0x7 ,0x21 ,0x0 ,0x41 ,0x3 ,0x21 ,0x2 ,0x41 ,0x8 ,0x21 ,0x3 ,0x41 ,0x10 ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x1 ,0xd ,0x4 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2 ,0x47 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x6 ,0x3a ,0x0 ,0xd8 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x21 ,0x2 ,0x41 ,0x0 ,0x41 ,0x4 ,0x36 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x81 ,0x4 ,0x3b ,0x1 ,0xe0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xdc ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf ,0x21 ,0x0 ,0x41 ,0x10 ,0x21 ,0x1 ,0x41 ,0x10 ,0x21 ,0x3 ,0x41 ,0x4 ,0x21 ,0x6 ,0x41 ,0xf ,0x21 ,0x7 ,0xc ,0x1 ,0xb ,0x41 ,0x8 ,0x21 ,0x1 ,0x41 ,0x8 ,0x21 ,0x3 ,0x41 ,0x3 ,0x21 ,0x6 ,0x41 ,0x7 ,0x21 ,0x7 ,0xb ,0x41 ,0x0 ,0x20 ,0x3 ,0x3a ,0x0 ,0xc1 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xc0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x7 ,0x41 ,0x0 ,0x2f ,0x1 ,0xb2 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x6 ,0x76 ,0x22 ,0x1 ,0x3b ,0x1 ,0xbc ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2f ,0x1 ,0xb4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x76 ,0x22 ,0x0 ,0x3b ,0x1 ,0xbe ,0x8e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6c ,0x3b ,0x1 ,0xa6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0xd ,0x0 ,0x41 ,0x12 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x2d ,0x0 ,0xf ,0x41 ,0xa7 ,0x7e ,0x6a ,0xe ,0x2 ,0x1 ,0x0 ,0x2 ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x3a ,0x0 ,0x84 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x3 ,0x41 ,0x1 ,0x74 ,0x20 ,0x0 ,0x41 ,0x7a ,0x6a ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x47 ,0xd ,0x1 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x41 ,0x7d ,0x49 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x7d ,0x6a ,0x21 ,0x6 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0xf ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x45 ,0xd ,0x3 ,0x20 ,0x6 ,0x41 ,0x7e ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x0 ,0x41 ,0x87 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x1 ,0x20 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x47 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x20 ,0x7 ,0x41 ,0x90 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xc0 ,0x99 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x8 ,0x41 ,0xf ,0x71 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xe5 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x8 ,0x41 ,0xf0 ,0x1 ,0x71 ,0x41 ,0x4 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x41 ,0x0 ,0x2d ,0x0 ,0x84 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd1 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x4 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd2 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x4 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd3 ,0x94 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0x7d ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x84 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x85 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x41 ,0x18 ,0x21 ,0x2 ,0x20 ,0x1 ,0x20 ,0x0 ,0x41 ,0x90 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x3 ,0x41 ,0xe5 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x76 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x3 ,0x20 ,0x1 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x99 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x2 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x3 ,0x20 ,0x6 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x86 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x3 ,0x40 ,0x41 ,0x2 ,0x41 ,0x1 ,0x20 ,0x0 ,0x41 ,0x90 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0xe2 ,0x94 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x1b ,0x20 ,0x2 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x6 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x46 ,0xd ,0x2 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x17 ,0x21 ,0x2 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xb4 ,0x98 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x1 ,0xb0 ,0x98 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2f ,0x1 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3b ,0x1 ,0xd6 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0xf0 ,0x9e ,0x80 ,0x80 ,0x0 ,0xb ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x4 ,0x41 ,0x0 ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2f ,0x1 ,0xb2 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0xd0 ,0x92 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x28 ,0x20 ,0x5 ,0x41 ,0xd0 ,0x90 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x24 ,0x20 ,0x5 ,0x41 ,0xd0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x20 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2f ,0x1 ,0xb4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x4 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb6 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x8 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2f ,0x1 ,0xbc ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x20 ,0x5 ,0x41 ,0x0 ,0x2f ,0x1 ,0xbe ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x10 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xc0 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x18 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xc1 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x1c ,0x20 ,0x5 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb8 ,0x8e ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x14 ,0xc ,0x4 ,0xb ,0x41 ,0x12 ,0x21 ,0x2 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x20 ,0x2 ,0x20 ,0x0 ,0x1b ,0x21 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x11 ,0x21 ,0x2 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x8e ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x20 ,0x2 ,0x20 ,0x0 ,0x1b ,0x21 ,0x0 ,0xb ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0xb ,0xe4 ,0x7 ,0x1 ,0xd ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x1 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3 ,0x7f ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x3 ,0x41 ,0xc0 ,0x7e ,0x6a ,0xe ,0x40 ,0x2 ,0x2 ,0x2 ,0x2 ,0x3 ,0x2 ,0x2 ,0x2 ,0x4 ,0x2 ,0x2 ,0x2 ,0x5 ,0x2 ,0x2 ,0x2 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x4 ,0x2 ,0x2 ,0x2 ,0x9 ,0x7 ,0x8 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x7 ,0x0 ,0x1 ,0xb ,0xb ,0x20 ,0x3 ,0xe ,0x2 ,0x8 ,0x2 ,0x5 ,0xb ,0x20 ,0x0 ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0xc ,0x3 ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x6 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x41 ,0xe ,0x71 ,0xd ,0x7 ,0x20 ,0x3 ,0x41 ,0xf0 ,0x1 ,0x71 ,0x41 ,0x10 ,0x4b ,0xd ,0x7 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x85 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x20 ,0x3 ,0x41 ,0x3 ,0x76 ,0x41 ,0x2 ,0x71 ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x72 ,0x22 ,0x5 ,0x74 ,0x72 ,0x3a ,0x0 ,0x85 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x2 ,0x74 ,0x22 ,0x3 ,0x41 ,0xcc ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x6 ,0x20 ,0x3 ,0x41 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x2 ,0x6a ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x8 ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x3 ,0x6a ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0x10 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x22 ,0x8 ,0x41 ,0xc ,0x41 ,0xff ,0x1 ,0x20 ,0x5 ,0x41 ,0x2 ,0x49 ,0x1b ,0x4b ,0xd ,0x7 ,0x2 ,0x40 ,0x20 ,0x8 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x20 ,0x3 ,0x41 ,0x11 ,0x6a ,0x22 ,0x9 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x49 ,0xd ,0x7 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x6 ,0xd ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x6 ,0x6a ,0x22 ,0xd ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x20 ,0x3 ,0x21 ,0xb ,0x20 ,0xa ,0x21 ,0xc ,0x20 ,0x6 ,0x20 ,0xa ,0x6a ,0x21 ,0xa ,0x20 ,0xd ,0x21 ,0x3 ,0xb ,0x20 ,0x7 ,0x20 ,0x8 ,0x6a ,0x22 ,0x6 ,0x20 ,0xb ,0x3b ,0x1 ,0x0 ,0x20 ,0x6 ,0x41 ,0x20 ,0x6a ,0x20 ,0x5 ,0x3b ,0x1 ,0x0 ,0x20 ,0x7 ,0x20 ,0x2 ,0x6a ,0x41 ,0xc0 ,0x0 ,0x6a ,0x20 ,0xc ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x41 ,0x2 ,0x6a ,0x21 ,0x8 ,0x20 ,0x3 ,0x41 ,0x1 ,0x74 ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0x10 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x9 ,0x6b ,0x22 ,0x4 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x45 ,0xd ,0x7 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x12 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x11 ,0x21 ,0x2 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0xf ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x2 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x47 ,0xd ,0x1 ,0x41 ,0x0 ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x3b ,0x1 ,0xd4 ,0x94 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x10 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x5 ,0x3 ,0x7f ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x41 ,0xf ,0x71 ,0x22 ,0x2 ,0x41 ,0x1 ,0x4b ,0xd ,0x1 ,0x41 ,0x0 ,0x21 ,0x3 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x86 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x41 ,0x1 ,0x20 ,0x2 ,0x1b ,0x72 ,0x3a ,0x0 ,0x86 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x1b ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x8 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x10 ,0x49 ,0x22 ,0x7 ,0xd ,0x0 ,0x41 ,0x8 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x8 ,0x41 ,0x8 ,0x74 ,0x6a ,0x21 ,0x8 ,0xb ,0x20 ,0x2 ,0x20 ,0x3 ,0x6a ,0x20 ,0x8 ,0x3b ,0x1 ,0x0 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x80 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x40 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x2 ,0x2e ,0x1 ,0x0 ,0x6c ,0x41 ,0x4 ,0x6a ,0x41 ,0x3 ,0x76 ,0x3b ,0x1 ,0x0 ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0x41 ,0xc1 ,0x0 ,0x41 ,0x81 ,0x1 ,0x20 ,0x7 ,0x1b ,0x22 ,0x2 ,0x20 ,0x5 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x4b ,0xd ,0x1 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6b ,0x22 ,0x5 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0xc ,0x0 ,0xb ,0xb ,0xb ,0xa6 ,0x1 ,0x1 ,0x3 ,0x7f ,0x41 ,0x0 ,0x2d ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x9f ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x8 ,0x3a ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x3a ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x9f ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x2 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x41 ,0x8 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x8 ,0x41 ,0x1 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xb ,0x6d ,0x1 ,0x3 ,0x7f ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0xd ,0x0 ,0x41 ,0x1 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2f ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x72 ,0x21 ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x74 ,0x3b ,0x1 ,0x82 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x3a ,0x0 ,0xf2 ,0x9e ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x80 ,0x80 ,0x2 ,0x71 ,0x41 ,0xf ,0x76 ,0xb ,0x7f ,0x1 ,0x3 ,0x7f ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x47 ,0xd ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x6a ,0x3a ,0x0 ,0xf3 ,0x9e ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0x7e ,0x6a ,0x22 ,0x3 ,0x3a ,0x0 ,0x80 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x9f ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x9f ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0xff ,0x1 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x1 ,0xb ,0x4f ,0x1 ,0x1 ,0x7f ,0x20 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0xe0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0xba ,0x4 ,0x20 ,0x4 ,0x6b ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x4 ,0x20 ,0x1 ,0x49 ,0x1b ,0x22 ,0x1 ,0x10 ,0x9b ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x2 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0x94 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x6a ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x94 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x98 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x3 ,0x40 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe ,0x0 ,0x41 ,0x5 ,0x41 ,0x1 ,0x10 ,0x94 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x97 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x99 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x95 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x9a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0xa2 ,0x6 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x9a ,0x6 ,0x80 ,0xb2 ,0xb2 ,0xa7 ,0xf6 ,0xa7 ,0x97 ,0xe8 ,0xe8 ,0x97 ,0x80 ,0xd1 ,0xdb ,0xd1 ,0x80 ,0x65 ,0xb2 ,0xc5 ,0xc5 ,0xb2 ,0x65 ,0x45 ,0x8b ,0xa7 ,0xb1 ,0xa7 ,0x8b ,0x45 ,0x23 ,0x60 ,0x83 ,0x97 ,0x97 ,0x83 ,0x60 ,0x23 ,0x31 ,0x5b ,0x76 ,0x80 ,0x76 ,0x5b ,0x31 ,0x2e ,0x51 ,0x65 ,0x65 ,0x51 ,0x2e ,0x2a ,0x45 ,0x4f ,0x45 ,0x2a ,0x23 ,0x36 ,0x36 ,0x23 ,0x1c ,0x25 ,0x1c ,0x13 ,0x13 ,0xa ,0x0 ,0x1 ,0x8 ,0x10 ,0x9 ,0x2 ,0x3 ,0xa ,0x11 ,0x18 ,0x20 ,0x19 ,0x12 ,0xb ,0x4 ,0x5 ,0xc ,0x13 ,0x1a ,0x21 ,0x28 ,0x30 ,0x29 ,0x22 ,0x1b ,0x14 ,0xd ,0x6 ,0x7 ,0xe ,0x15 ,0x1c ,0x23 ,0x2a ,0x31 ,0x38 ,0x39 ,0x32 ,0x2b ,0x24 ,0x1d ,0x16 ,0xf ,0x17 ,0x1e ,0x25 ,0x2c ,0x33 ,0x3a ,0x3b ,0x34 ,0x2d ,0x26 ,0x1f ,0x27 ,0x2e ,0x35 ,0x3c ,0x3d ,0x36 ,0x2f ,0x37 ,0x3e ,0x3f ,0x1 ,0x0 ,0x2 ,0x0 ,0x4 ,0x0 ,0x8 ,0x0 ,0x10 ,0x0 ,0x20 ,0x0 ,0x40 ,0x0 ,0x80 ,0x0 ,0x0 ,0x1 ,0x0 ,0x2 ,0x0 ,0x4 ,0x0 ,0x8 ,0x0 ,0x10 ,0x0 ,0x20 ,0x0 ,0x40 ,0xff ,0xff ,0xfd ,0xff ,0xf9 ,0xff ,0xf1 ,0xff ,0xe1 ,0xff ,0xc1 ,0xff ,0x81 ,0xff ,0x1 ,0xff ,0x1 ,0xfe ,0x1 ,0xfc ,0x1 ,0xf8 ,0x1 ,0xf0 ,0x1 ,0xe0 ,0x1 ,0xc0 ,0x1 ,0x80 ,0xc0 ,0xb ,0x0 ,0x0 ,0x70 ,0xb ,0x0 ,0x0 ,0x14 ,0xd ,0x0 ,0x0 ,0xc4 ,0xc ,0x0 ,0x0 ,0x20 ,0xc ,0x0 ,0x0 ,0x10 ,0xc ,0x0 ,0x0 ,0x70 ,0xe ,0x0 ,0x0 ,0x70 ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xff ,0xd8 ,0xff ,0xe0 ,0x0 ,0x10 ,0x4a ,0x46 ,0x49 ,0x46 ,0x0 ,0x1 ,0x1 ,0x1 ,0x0 ,0x48 ,0x0 ,0x48 ,0x0 ,0x0 ,0xff ,0xdb ,0x0 ,0x43 ,0x0 ,0x50 ,0x37 ,0x3c ,0x46 ,0x3c ,0x32 ,0x50 ,0x46 ,0x41 ,0x46 ,0x5a ,0x55 ,0x50 ,0x5f ,0x78 ,0xc8 ,0x82 ,0x78 ,0x6e ,0x6e ,0x78 ,0xf5 ,0xaf ,0xb9 ,0x91 ,0xc8 ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xdb ,0x0 ,0x43 ,0x1 ,0x55 ,0x5a ,0x5a ,0x78 ,0x69 ,0x78 ,0xeb ,0x82 ,0x82 ,0xeb ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xff ,0xc0 ,0x0 ,0x11 ,0x8 ,0x0 ,0x40 ,0x0 ,0x33 ,0x3 ,0x1 ,0x11 ,0x0 ,0x2 ,0x11 ,0x1 ,0x3 ,0x11 ,0x1 ,0xff ,0xc4 ,0x0 ,0x18 ,0x0 ,0x0 ,0x3 ,0x1 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x0 ,0x4 ,0xff ,0xc4 ,0x0 ,0x26 ,0x10 ,0x0 ,0x2 ,0x2 ,0x1 ,0x3 ,0x3 ,0x4 ,0x3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x11 ,0x3 ,0x12 ,0x21 ,0x31 ,0x41 ,0x61 ,0x71 ,0x4 ,0x22 ,0x53 ,0x91 ,0x13 ,0x23 ,0x51 ,0x62 ,0xff ,0xc4 ,0x0 ,0x15 ,0x1 ,0x1 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xff ,0xc4 ,0x0 ,0x14 ,0x11 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xff ,0xda ,0x0 ,0xc ,0x3 ,0x1 ,0x0 ,0x2 ,0x11 ,0x3 ,0x11 ,0x0 ,0x3f ,0x0 ,0xc7 ,0x88 ,0xb ,0x28 ,0x4d ,0x66 ,0xe1 ,0x2 ,0xcf ,0x58 ,0x5 ,0x45 ,0x88 ,0x0 ,0xa9 ,0x10 ,0x34 ,0xe ,0xaf ,0x6f ,0x68 ,0x54 ,0x33 ,0x64 ,0x3 ,0x61 ,0x2 ,0x6a ,0x49 ,0xdb ,0x49 ,0x84 ,0x59 ,0x50 ,0x91 ,0x50 ,0xa0 ,0x3d ,0xa4 ,0x80 ,0x7c ,0x88 ,0x18 ,0xd5 ,0x48 ,0x5 ,0x9 ,0x43 ,0xeb ,0xff ,0x0 ,0x2b ,0xf5 ,0x2 ,0x78 ,0xd4 ,0x1c ,0xac ,0x48 ,0x10 ,0x8e ,0xb5 ,0x55 ,0xa8 ,0xc ,0xa5 ,0x2f ,0xdb ,0x52 ,0x2a ,0x19 ,0x53 ,0xf6 ,0x82 ,0x4 ,0xa1 ,0xe ,0x45 ,0xf8 ,0x84 ,0xd ,0xad ,0x7e ,0x21 ,0x20 ,0xd0 ,0x30 ,0x4 ,0x93 ,0x5c ,0x99 ,0x43 ,0xe2 ,0xc6 ,0x57 ,0x20 ,0xd4 ,0xd7 ,0x7d ,0x20 ,0x3a ,0xe1 ,0x40 ,0xf6 ,0x49 ,0xf1 ,0x20 ,0xa3 ,0x8b ,0x17 ,0xc5 ,0x9 ,0x47 ,0x26 ,0x35 ,0x5 ,0xb5 ,0x1e ,0x20 ,0x75 ,0x2 ,0x95 ,0xc0 ,0xfa ,0x81 ,0xcf ,0x52 ,0xc ,0x6c ,0xd ,0xa0 ,0x25 ,0xbd ,0xdd ,0xd1 ,0xf3 ,0x2a ,0x28 ,0x43 ,0xb0 ,0x4 ,0xe ,0x3a ,0xdc ,0x29 ,0xb2 ,0x13 ,0xf8 ,0x6a ,0x11 ,0x25 ,0x53 ,0x22 ,0xa9 ,0x7d ,0xe0 ,0x2e ,0xa8 ,0x6 ,0xc1 ,0xda ,0xa0 ,0x29 ,0x21 ,0x4d ,0x30 ,0x35 ,0x2a ,0x28 ,0xb9 ,0x17 ,0x85 ,0x6 ,0x15 ,0x50 ,0x97 ,0x8c ,0xd8 ,0xef ,0x20 ,0xe5 ,0x1 ,0xf9 ,0xd3 ,0x52 ,0xa1 ,0xb5 ,0xe ,0xb0 ,0x14 ,0x90 ,0x39 ,0x32 ,0x28 ,0xe2 ,0x60 ,0xd9 ,0x17 ,0xcc ,0xa2 ,0xd9 ,0xb1 ,0x2 ,0x35 ,0x58 ,0x1e ,0x60 ,0xc ,0x58 ,0x95 ,0x6 ,0xa6 ,0x20 ,0xf8 ,0x90 ,0x3b ,0x67 ,0x41 ,0xb0 ,0xb3 ,0x2 ,0x4f ,0x9c ,0x55 ,0x40 ,0x8e ,0xb5 ,0xfe ,0x9 ,0x51 ,0x12 ,0xd7 ,0x1 ,0xfd ,0x3b ,0x11 ,0x99 ,0x7b ,0x98 ,0x55 ,0x7d ,0x4b ,0xbb ,0x64 ,0x0 ,0xec ,0xbd ,0x4 ,0x5 ,0x45 ,0x62 ,0x36 ,0xb2 ,0x3b ,0x42 ,0x1b ,0x2a ,0x1c ,0x40 ,0x74 ,0xb8 ,0x11 ,0x6 ,0x0 ,0xb8 ,0x1f ,0xff ,0xd9};
-
-static uint8_t qrduino[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2b ,0x8 ,0x60 ,0x0 ,0x0 ,0x60 ,0x5 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x1d ,0x1c ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x0 ,0x4 ,0x0 ,0x5 ,0x5 ,0x0 ,0x4 ,0x6 ,0x0 ,0x5 ,0x4 ,0x3 ,0x5 ,0x2 ,0x0 ,0x6 ,0x0 ,0x0 ,0x7 ,0x7 ,0x7 ,0x3 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0xd1 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x8c ,0xd4 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0xd1 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x15 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0x9e ,0x73 ,0x1c ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xd0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xa3 ,0x1d ,0x1 ,0x13 ,0x7f ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x10 ,0x9b ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x22 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x9 ,0x4b ,0x1b ,0x20 ,0x1 ,0x20 ,0x2 ,0x49 ,0x1b ,0x22 ,0x5 ,0x6a ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0xa ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0x7d ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x4 ,0x74 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x41 ,0x7d ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x4 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0x41 ,0x2 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x2 ,0x20 ,0x5 ,0x41 ,0x4 ,0x74 ,0x72 ,0x3a ,0x0 ,0x2 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x76 ,0x3a ,0x0 ,0x1 ,0x41 ,0xc ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x22 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x4 ,0x74 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x4 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x4 ,0x21 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x1 ,0x20 ,0x5 ,0x41 ,0x4 ,0x74 ,0x72 ,0x3a ,0x0 ,0x1 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x20 ,0x0 ,0x76 ,0x41 ,0xc0 ,0x0 ,0x72 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa ,0x49 ,0x6b ,0x41 ,0x3 ,0x6a ,0x22 ,0x0 ,0x20 ,0x3 ,0x4f ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0xec ,0x1 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x1 ,0x6a ,0x41 ,0x11 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x0 ,0x20 ,0x3 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x8 ,0x41 ,0x1 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x6 ,0x45 ,0xd ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0x1 ,0x21 ,0xb ,0x3 ,0x40 ,0x20 ,0x9 ,0x20 ,0xa ,0x6a ,0x41 ,0x1 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0xa ,0x45 ,0xd ,0x0 ,0x20 ,0xa ,0x21 ,0x2 ,0x20 ,0xa ,0x21 ,0x4 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x8 ,0x20 ,0x2 ,0x6a ,0x22 ,0x5 ,0x2d ,0x0 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0xc ,0x2 ,0x40 ,0x20 ,0xa ,0x20 ,0x0 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x46 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0xc ,0x73 ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x0 ,0xb ,0x20 ,0x5 ,0x20 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x2 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0xa ,0x20 ,0xb ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x46 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x8 ,0x20 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0xb ,0x3a ,0x0 ,0x0 ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x22 ,0xa ,0x20 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x7 ,0x20 ,0x3 ,0x6a ,0x21 ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0x1 ,0x20 ,0x1 ,0x41 ,0x1 ,0x4b ,0x1b ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x8 ,0x20 ,0x8 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x7 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x7 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x6a ,0x21 ,0x7 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x8 ,0x3 ,0x40 ,0x20 ,0x7 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x6a ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x20 ,0x7 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6a ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x21 ,0x0 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x20 ,0x2 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x20 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x21 ,0x1 ,0x20 ,0x5 ,0x21 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0x8 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x20 ,0x2 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x20 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x21 ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x6b ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x6a ,0x20 ,0x2 ,0x6a ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x6a ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6a ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x8 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x20 ,0x8 ,0x6c ,0x20 ,0x3 ,0x6a ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x9 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x6c ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x46 ,0xd ,0x0 ,0x20 ,0x9 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x4 ,0x41 ,0x1 ,0x21 ,0xa ,0x20 ,0x9 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0xd ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x7 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0xb ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0xb ,0xc0 ,0x41 ,0x7f ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x6c ,0x6a ,0x22 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0xb ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x9 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0xc ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0xa ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x41 ,0x1 ,0x21 ,0xa ,0x20 ,0x1 ,0x21 ,0x2 ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x6 ,0x46 ,0x22 ,0x1 ,0x1b ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0x9 ,0x41 ,0x0 ,0x20 ,0x1 ,0x1b ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0xa ,0x20 ,0x1 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x41 ,0x78 ,0x6a ,0x20 ,0x5 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x6 ,0x46 ,0x22 ,0x2 ,0x1b ,0x21 ,0x5 ,0x41 ,0x5 ,0x20 ,0x1 ,0x20 ,0x2 ,0x1b ,0x21 ,0x2 ,0x41 ,0x1 ,0x21 ,0xa ,0xb ,0x20 ,0x0 ,0x45 ,0x21 ,0x4 ,0x20 ,0xc ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x20 ,0x0 ,0x20 ,0x1 ,0x4b ,0x1b ,0x22 ,0x8 ,0x41 ,0x1 ,0x6a ,0x20 ,0x8 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x0 ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x1 ,0x49 ,0x1b ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0xb ,0x20 ,0xb ,0x41 ,0x1 ,0x74 ,0x21 ,0xb ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x0 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x6c ,0x20 ,0x0 ,0x6a ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x9 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0xb0 ,0xea ,0x1 ,0x21 ,0xe ,0x41 ,0x0 ,0x21 ,0xf ,0x41 ,0x0 ,0x21 ,0x10 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x11 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x12 ,0x41 ,0x2 ,0x49 ,0xd ,0x0 ,0x20 ,0x12 ,0x41 ,0x7f ,0x6a ,0x22 ,0x9 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0xd ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0xb ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x9 ,0xd ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0xc ,0x1 ,0xb ,0x20 ,0x6 ,0x20 ,0xd ,0x6c ,0x21 ,0x2 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0xd ,0x6c ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x1 ,0x20 ,0x0 ,0x22 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x74 ,0x22 ,0xc ,0x20 ,0x5 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xa ,0x20 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0x21 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x1 ,0x20 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x74 ,0x22 ,0x8 ,0x20 ,0x5 ,0x20 ,0x1 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x1 ,0x20 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x45 ,0xd ,0x2 ,0x20 ,0x8 ,0x20 ,0x1 ,0x20 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0x45 ,0xd ,0x2 ,0x20 ,0xc ,0x20 ,0xa ,0x20 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0xd ,0x1 ,0x20 ,0x8 ,0x20 ,0x1 ,0x20 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0xd ,0x1 ,0x20 ,0xc ,0x20 ,0xa ,0x20 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x71 ,0xd ,0x1 ,0xb ,0x20 ,0xb ,0x41 ,0x3 ,0x6a ,0x21 ,0xb ,0xb ,0x20 ,0x3 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x20 ,0x9 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x12 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x8 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0xc ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0x22 ,0x1 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x41 ,0x1 ,0x3a ,0x0 ,0x0 ,0xb ,0x41 ,0x1 ,0x41 ,0x7f ,0x20 ,0x1 ,0x1b ,0x20 ,0x5 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x2 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0xb ,0x6a ,0x21 ,0xb ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x22 ,0xc ,0x20 ,0x1 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x5 ,0x41 ,0x1f ,0x75 ,0x22 ,0x0 ,0x73 ,0x20 ,0x0 ,0x6b ,0x41 ,0xa ,0x6c ,0x22 ,0x0 ,0x20 ,0x1 ,0x20 ,0x1 ,0x6c ,0x22 ,0x2 ,0x4d ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0xa ,0x3 ,0x40 ,0x20 ,0xa ,0x41 ,0xa ,0x6a ,0x21 ,0xa ,0x20 ,0x0 ,0x20 ,0x2 ,0x6b ,0x22 ,0x0 ,0x20 ,0x2 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xa ,0x20 ,0xb ,0x6a ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x4 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0xa ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x21 ,0x8 ,0x20 ,0xa ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xc ,0x6a ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x8 ,0x76 ,0x41 ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x47 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x6a ,0x41 ,0x1 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x5 ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x6a ,0x21 ,0x3 ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x22 ,0xa ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x2 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xf ,0x20 ,0x10 ,0x20 ,0x3 ,0x20 ,0xe ,0x49 ,0x22 ,0x0 ,0x1b ,0x22 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x7 ,0x46 ,0xd ,0x1 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x6c ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x3 ,0x20 ,0xe ,0x20 ,0x0 ,0x1b ,0x21 ,0xe ,0x20 ,0xf ,0x41 ,0x1 ,0x6a ,0x21 ,0xf ,0x20 ,0x11 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0xb ,0x41 ,0x8 ,0x21 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x10 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x20 ,0xf ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x0 ,0x20 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xec ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x74 ,0x20 ,0x0 ,0x6a ,0x41 ,0x2 ,0x74 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x0 ,0x41 ,0x7f ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x75 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x4 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0x5 ,0x4b ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x72 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x2 ,0x20 ,0x0 ,0x41 ,0x1 ,0x76 ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0x41 ,0x8 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x79 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x41 ,0x1 ,0x41 ,0x80 ,0x1 ,0x41 ,0x6 ,0x20 ,0x1 ,0x41 ,0x7 ,0x6a ,0x6b ,0x41 ,0xff ,0x1 ,0x71 ,0x76 ,0x20 ,0x1 ,0x41 ,0x79 ,0x46 ,0x1b ,0x72 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x76 ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0xd ,0x0 ,0xb ,0xb ,0xbb ,0x2 ,0x1 ,0xb ,0x7f ,0x41 ,0x0 ,0x21 ,0x5 ,0x20 ,0x2 ,0x41 ,0x0 ,0x20 ,0x3 ,0x10 ,0x9a ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x8 ,0x20 ,0x6 ,0x6a ,0x21 ,0x9 ,0x20 ,0x3 ,0x41 ,0x2 ,0x49 ,0x21 ,0xa ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x6a ,0x2d ,0x0 ,0x0 ,0x73 ,0x22 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0xb ,0x2 ,0x40 ,0x20 ,0xa ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0xc ,0x6a ,0x22 ,0xd ,0x2d ,0x0 ,0x0 ,0x21 ,0xe ,0x2 ,0x40 ,0x20 ,0x4 ,0x20 ,0x3 ,0x20 ,0xc ,0x6b ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0xb ,0x6a ,0x22 ,0x2 ,0x41 ,0xff ,0x1 ,0x49 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xf ,0x3 ,0x40 ,0x20 ,0xf ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0xf ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x46 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xd ,0x41 ,0x7f ,0x6a ,0x20 ,0x2 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0xe ,0x73 ,0x3a ,0x0 ,0x0 ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x22 ,0xc ,0x20 ,0x3 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0xb ,0x6a ,0x22 ,0x2 ,0x41 ,0xff ,0x1 ,0x49 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xf ,0x3 ,0x40 ,0x20 ,0xf ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0xf ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x46 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x6 ,0x20 ,0x7 ,0x20 ,0x8 ,0x10 ,0x99 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x9 ,0x20 ,0x2 ,0x3a ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe8 ,0x11 ,0x1 ,0x8 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0xe ,0x8 ,0x4 ,0x5 ,0x6 ,0x7 ,0x3 ,0x2 ,0x1 ,0x0 ,0x8 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x7 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x3 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x21 ,0x4 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x20 ,0x1 ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x20 ,0x0 ,0x6a ,0x41 ,0x0 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x20 ,0x5 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0x71 ,0x73 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x8 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x6 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x71 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x0 ,0x20 ,0x1 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x20 ,0x0 ,0x71 ,0x41 ,0x0 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x20 ,0x5 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0x71 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x7 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x5 ,0x41 ,0x0 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x8 ,0x41 ,0x1 ,0x71 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x0 ,0x20 ,0x1 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x20 ,0x0 ,0x71 ,0x41 ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x47 ,0x41 ,0x0 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x0 ,0x47 ,0x71 ,0x6b ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x45 ,0xd ,0x4 ,0x41 ,0x0 ,0x21 ,0x8 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x8 ,0x41 ,0x1 ,0x76 ,0x41 ,0x1 ,0x71 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x22 ,0x6 ,0x1b ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x2 ,0x20 ,0x8 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x3 ,0x20 ,0x2 ,0x20 ,0x3 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x2 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x3 ,0x49 ,0x1b ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0xb ,0x41 ,0x1 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x20 ,0x6 ,0x1b ,0x21 ,0x1 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x5 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x45 ,0xd ,0x3 ,0x41 ,0x0 ,0x21 ,0x6 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x20 ,0x0 ,0x6a ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x1 ,0x20 ,0x5 ,0x4b ,0x1b ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x3 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x1 ,0x20 ,0x5 ,0x20 ,0x1 ,0x20 ,0x5 ,0x49 ,0x1b ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x6 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x45 ,0xd ,0x2 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x6 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x71 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x1 ,0x20 ,0x5 ,0x4b ,0x1b ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x3 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x1 ,0x20 ,0x5 ,0x20 ,0x1 ,0x20 ,0x5 ,0x49 ,0x1b ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x1 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x45 ,0xd ,0x1 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x4b ,0x1b ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x3 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x1 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x21 ,0x7 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x20 ,0x5 ,0x21 ,0x2 ,0x20 ,0x7 ,0x21 ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x3 ,0x46 ,0x1b ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x4b ,0x1b ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x3 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x41 ,0xf8 ,0x1 ,0x71 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x1 ,0x41 ,0x7 ,0x71 ,0x76 ,0x73 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0x88 ,0x2 ,0x1 ,0x8 ,0x7f ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x41 ,0x1 ,0x20 ,0x1 ,0x41 ,0x1 ,0x4b ,0x1b ,0x21 ,0x2 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0x7e ,0x6a ,0x41 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x4b ,0x1b ,0x20 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x5 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x6 ,0x41 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7e ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x7 ,0x20 ,0x3 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x47 ,0xd ,0x0 ,0x20 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x8 ,0x47 ,0xd ,0x0 ,0x20 ,0x7 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x47 ,0xd ,0x0 ,0x20 ,0x8 ,0x41 ,0x3 ,0x6c ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x47 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x7d ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x1 ,0x20 ,0x0 ,0x4b ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x3 ,0x6c ,0x20 ,0x8 ,0x41 ,0xc ,0x6c ,0x22 ,0x5 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x3 ,0x6c ,0x20 ,0x5 ,0x49 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x41 ,0x28 ,0x6a ,0x21 ,0x4 ,0xb ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x1 ,0x20 ,0x6 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0xb ,0x96 ,0x18 ,0x1 ,0xf ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x41 ,0x1 ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x0 ,0x6c ,0x41 ,0x1 ,0x76 ,0x41 ,0x7 ,0x6a ,0x41 ,0x3 ,0x76 ,0x41 ,0x1 ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x6a ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x1 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x79 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x2 ,0x41 ,0x2 ,0x46 ,0x1b ,0x22 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x4 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x46 ,0x1b ,0x22 ,0x6 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x7 ,0x41 ,0x3 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x7 ,0x41 ,0x6 ,0x6a ,0x21 ,0x8 ,0x20 ,0x4 ,0x41 ,0x3 ,0x76 ,0x21 ,0x9 ,0x41 ,0x80 ,0x1 ,0x20 ,0x3 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0xa ,0x20 ,0x4 ,0x41 ,0x6 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x76 ,0x21 ,0xb ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x20 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x9 ,0x6a ,0x20 ,0x7 ,0x20 ,0x0 ,0x6a ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xe ,0x20 ,0xe ,0x2d ,0x0 ,0x0 ,0x20 ,0xa ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0xd ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x20 ,0xc ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x1 ,0x21 ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x5 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xd ,0x20 ,0x3 ,0x41 ,0x5 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xe ,0x20 ,0x6 ,0x41 ,0x5 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x8 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0xa ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x9 ,0x20 ,0x5 ,0x20 ,0x9 ,0x20 ,0x5 ,0x4b ,0x1b ,0x22 ,0xb ,0x41 ,0x1 ,0x6a ,0x20 ,0xb ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x9 ,0x20 ,0x5 ,0x20 ,0x9 ,0x20 ,0x5 ,0x49 ,0x1b ,0x6a ,0x22 ,0x9 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xb ,0x20 ,0xb ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x9 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xd ,0x20 ,0x0 ,0x20 ,0x6 ,0x6a ,0x22 ,0xb ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x9 ,0x20 ,0xd ,0x20 ,0x9 ,0x4b ,0x1b ,0x22 ,0xc ,0x41 ,0x1 ,0x6a ,0x20 ,0xc ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0xd ,0x20 ,0x9 ,0x20 ,0xd ,0x20 ,0x9 ,0x49 ,0x1b ,0x6a ,0x22 ,0x9 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xc ,0x20 ,0xc ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x9 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xe ,0x20 ,0xb ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x9 ,0x20 ,0xe ,0x20 ,0x9 ,0x4b ,0x1b ,0x22 ,0xb ,0x41 ,0x1 ,0x6a ,0x20 ,0xb ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0xe ,0x20 ,0x9 ,0x20 ,0xe ,0x20 ,0x9 ,0x49 ,0x1b ,0x6a ,0x22 ,0x9 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xb ,0x20 ,0xb ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x9 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x9 ,0x20 ,0x8 ,0x20 ,0x9 ,0x20 ,0x8 ,0x4b ,0x1b ,0x22 ,0xa ,0x41 ,0x1 ,0x6a ,0x20 ,0xa ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x9 ,0x20 ,0x8 ,0x20 ,0x9 ,0x20 ,0x8 ,0x49 ,0x1b ,0x6a ,0x22 ,0x9 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xa ,0x20 ,0xa ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x9 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x9 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x9 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0xb ,0x20 ,0x7 ,0x41 ,0x4 ,0x6a ,0x21 ,0x8 ,0x20 ,0x7 ,0x41 ,0x2 ,0x6a ,0x21 ,0x9 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x76 ,0x21 ,0xa ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x21 ,0xb ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0xc ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0x3 ,0x41 ,0x7e ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x20 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x4 ,0x6a ,0x22 ,0xd ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x9 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xe ,0x20 ,0xe ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0xd ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xb ,0x6a ,0x20 ,0x7 ,0x20 ,0x0 ,0x6a ,0x22 ,0xd ,0x41 ,0x5 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xe ,0x20 ,0xe ,0x2d ,0x0 ,0x0 ,0x20 ,0x3 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xa ,0x6a ,0x20 ,0xd ,0x41 ,0x4 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x20 ,0xc ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0x8 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x2 ,0x49 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x41 ,0x2 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x79 ,0x6a ,0x21 ,0x9 ,0x20 ,0x5 ,0x41 ,0x80 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0x9 ,0x6a ,0x21 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7d ,0x6a ,0x21 ,0x8 ,0x3 ,0x40 ,0x20 ,0x9 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xe ,0x2 ,0x40 ,0x20 ,0x8 ,0x20 ,0x0 ,0x41 ,0x79 ,0x6a ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x4f ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0xd ,0x20 ,0xe ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x5 ,0x49 ,0xd ,0x1 ,0x20 ,0x8 ,0x20 ,0x0 ,0x20 ,0x5 ,0x6b ,0x22 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x7 ,0x20 ,0xe ,0x4f ,0xd ,0x0 ,0x41 ,0x6 ,0x20 ,0x9 ,0x20 ,0x5 ,0x6b ,0x22 ,0x9 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x6 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x78 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1c ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x78 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x4b ,0x1b ,0x22 ,0xe ,0x41 ,0x1 ,0x6a ,0x20 ,0xe ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x79 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7 ,0x4b ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x20 ,0xd ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x41 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x7 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1c ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x78 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7 ,0x4b ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x20 ,0xd ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x41 ,0x7 ,0x20 ,0x5 ,0x41 ,0x7 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x78 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x4b ,0x1b ,0x22 ,0xe ,0x41 ,0x1 ,0x6a ,0x20 ,0xe ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x8 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x24 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x2d ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x78 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x8 ,0x20 ,0x5 ,0x41 ,0x8 ,0x4b ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x20 ,0xd ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x41 ,0x8 ,0x20 ,0x5 ,0x41 ,0x8 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x24 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x8 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x79 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x41 ,0x8 ,0x20 ,0x0 ,0x41 ,0x8 ,0x4b ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x20 ,0xd ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x0 ,0x41 ,0x8 ,0x20 ,0x0 ,0x41 ,0x8 ,0x49 ,0x1b ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0xe ,0x21 ,0xd ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe ,0x46 ,0xd ,0x0 ,0x41 ,0x8 ,0x21 ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x78 ,0x6a ,0x22 ,0x5 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x6 ,0x20 ,0x5 ,0x41 ,0x6 ,0x4b ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x6a ,0x20 ,0xd ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x41 ,0x6 ,0x20 ,0x5 ,0x41 ,0x6 ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x22 ,0xe ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x22 ,0xd ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xe ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x6 ,0x6c ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x6 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x21 ,0x5 ,0x41 ,0x2 ,0x21 ,0xd ,0xb ,0x20 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x20 ,0xd ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x79 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x0 ,0x20 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0xd ,0x41 ,0x72 ,0x6a ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x7 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x41 ,0x94 ,0x92 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x4 ,0x41 ,0x11 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0xc ,0x3 ,0x40 ,0x41 ,0x80 ,0x1 ,0x41 ,0x5 ,0x20 ,0xc ,0x6b ,0x22 ,0x9 ,0x76 ,0x21 ,0xb ,0x41 ,0x77 ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0xd ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x20 ,0x8 ,0x20 ,0x0 ,0x6a ,0x22 ,0x5 ,0x41 ,0x7d ,0x6a ,0x76 ,0x20 ,0x4 ,0x20 ,0x5 ,0x41 ,0x9 ,0x6a ,0x22 ,0x5 ,0x76 ,0x20 ,0x5 ,0x41 ,0xb ,0x4b ,0x1b ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x20 ,0xb ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0xe ,0x41 ,0x3 ,0x75 ,0x6a ,0x20 ,0x9 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x9 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xd ,0x6b ,0x41 ,0x77 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xe ,0x20 ,0x5 ,0x20 ,0xe ,0x4b ,0x1b ,0x22 ,0xa ,0x41 ,0x1 ,0x6a ,0x20 ,0xa ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0xe ,0x20 ,0x5 ,0x20 ,0xe ,0x49 ,0x1b ,0x6a ,0x22 ,0xe ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xa ,0x20 ,0xa ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0xe ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xd ,0x6b ,0x41 ,0x77 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xe ,0x20 ,0x5 ,0x20 ,0xe ,0x20 ,0x5 ,0x4b ,0x1b ,0x22 ,0xa ,0x41 ,0x1 ,0x6a ,0x20 ,0xa ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0xe ,0x20 ,0x5 ,0x20 ,0xe ,0x20 ,0x5 ,0x49 ,0x1b ,0x6a ,0x22 ,0xe ,0x41 ,0x3 ,0x76 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x5 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0xe ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x0 ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x41 ,0x3 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x8 ,0x41 ,0x7d ,0x6a ,0x21 ,0x8 ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x22 ,0xc ,0x41 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0xd ,0xb ,0x2 ,0x40 ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0xd ,0x41 ,0x1 ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0xe ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x20 ,0xe ,0x20 ,0x5 ,0x41 ,0xff ,0x1 ,0x71 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x73 ,0x41 ,0x7 ,0x71 ,0x76 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x5 ,0x20 ,0xe ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x4b ,0x1b ,0x22 ,0x8 ,0x41 ,0x1 ,0x6a ,0x20 ,0x8 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x5 ,0x20 ,0xd ,0x20 ,0x5 ,0x20 ,0xd ,0x49 ,0x1b ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0xd ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x21 ,0xd ,0xb ,0x20 ,0x9 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x22 ,0xe ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xc0 ,0x5 ,0x1 ,0xa ,0x7f ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x76 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x6c ,0x6a ,0x22 ,0x2 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x0 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x7e ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x76 ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x7e ,0x6a ,0x22 ,0x6 ,0x41 ,0x3 ,0x75 ,0x21 ,0x7 ,0x41 ,0x80 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0x8 ,0x41 ,0x80 ,0x1 ,0x20 ,0x6 ,0x41 ,0x7 ,0x71 ,0x76 ,0x21 ,0x9 ,0x41 ,0x7c ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x6 ,0x41 ,0x2 ,0x6a ,0x22 ,0xa ,0x41 ,0x3 ,0x75 ,0x6a ,0x20 ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xb ,0x20 ,0xb ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0xa ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0x6a ,0x20 ,0x1 ,0x20 ,0x2 ,0x6a ,0x22 ,0xa ,0x41 ,0x3 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xb ,0x20 ,0xb ,0x2d ,0x0 ,0x0 ,0x20 ,0x9 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x6a ,0x20 ,0xa ,0x41 ,0x2 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xa ,0x20 ,0xa ,0x2d ,0x0 ,0x0 ,0x20 ,0x8 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x6a ,0x22 ,0x6 ,0x41 ,0x3 ,0x75 ,0x6a ,0x20 ,0x3 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x22 ,0xa ,0x20 ,0xa ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x6 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x6 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xa ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x3 ,0x41 ,0x1 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0x20 ,0x2 ,0x20 ,0x1 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x4 ,0x20 ,0x6 ,0x20 ,0x4 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x6 ,0x20 ,0x4 ,0x20 ,0x6 ,0x20 ,0x4 ,0x49 ,0x1b ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x4 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0xa ,0x20 ,0x1 ,0x20 ,0x2 ,0x6b ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x4 ,0x20 ,0xa ,0x20 ,0x4 ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0xa ,0x20 ,0x4 ,0x20 ,0xa ,0x20 ,0x4 ,0x49 ,0x1b ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x4 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6b ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x4 ,0x20 ,0xb ,0x20 ,0x4 ,0x20 ,0xb ,0x4b ,0x1b ,0x22 ,0x7 ,0x41 ,0x1 ,0x6a ,0x20 ,0x7 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x4 ,0x20 ,0xb ,0x20 ,0x4 ,0x20 ,0xb ,0x49 ,0x1b ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x7 ,0x20 ,0x7 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x4 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x20 ,0x0 ,0x6a ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x2 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x3 ,0x4b ,0x1b ,0x22 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x4 ,0x6c ,0x41 ,0x1 ,0x76 ,0x20 ,0x2 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x3 ,0x49 ,0x1b ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x76 ,0x6a ,0x22 ,0x4 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7 ,0x71 ,0x76 ,0x72 ,0x3a ,0x0 ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x71 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x5 ,0x41 ,0x1 ,0x21 ,0x2 ,0x20 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x2f ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xa2 ,0x2 ,0x1 ,0x3 ,0x7f ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xe4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x41 ,0x11 ,0x6a ,0x22 ,0x2 ,0x3a ,0x0 ,0xd5 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0xfd ,0x1 ,0x71 ,0x22 ,0x2 ,0x41 ,0x7 ,0x6a ,0x41 ,0x3 ,0x76 ,0x22 ,0x3 ,0x3a ,0x0 ,0xd4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x6c ,0x22 ,0x2 ,0x41 ,0x80 ,0x6 ,0x20 ,0x2 ,0x41 ,0x80 ,0x6 ,0x4b ,0x1b ,0x22 ,0x2 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xec ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x3 ,0x36 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0x4 ,0x74 ,0x20 ,0x0 ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0x1 ,0x41 ,0xec ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x4 ,0x3a ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xed ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xee ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x3 ,0x3a ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x41 ,0xef ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x1 ,0x3a ,0x0 ,0xf0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x20 ,0x3 ,0x20 ,0x0 ,0x6a ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x20 ,0x0 ,0x20 ,0x4 ,0x6a ,0x6c ,0x6a ,0x22 ,0x1 ,0x20 ,0x2 ,0x20 ,0x1 ,0x4b ,0x1b ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x20 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x0 ,0x2d ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x6c ,0x6a ,0x41 ,0x7d ,0x6a ,0xb ,0x93 ,0x1 ,0x1 ,0x6 ,0x7f ,0x20 ,0x0 ,0x41 ,0x2 ,0x74 ,0x41 ,0xfc ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x2 ,0x41 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x4 ,0x20 ,0x4 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x22 ,0x5 ,0x6a ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x6 ,0x6c ,0x6a ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x4b ,0xd ,0x1 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x41 ,0x28 ,0x21 ,0x7 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x41 ,0x28 ,0x47 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x3 ,0x21 ,0x7 ,0xb ,0x41 ,0x0 ,0x20 ,0x4 ,0x3a ,0x0 ,0xee ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x5 ,0x3a ,0x0 ,0xed ,0x93 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x6 ,0x3a ,0x0 ,0xef ,0x93 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0x7 ,0x41 ,0xff ,0x1 ,0x71 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xa3 ,0x1 ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x80 ,0x94 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0xc0 ,0x0 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x41 ,0x16 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x93 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x41 ,0x0 ,0x29 ,0x0 ,0xb8 ,0x93 ,0x80 ,0x80 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xe ,0x6a ,0x41 ,0x0 ,0x29 ,0x0 ,0xc6 ,0x93 ,0x80 ,0x80 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x41 ,0x0 ,0x29 ,0x0 ,0xc0 ,0x93 ,0x80 ,0x80 ,0x0 ,0x37 ,0x0 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe ,0x0 ,0x41 ,0x5 ,0x41 ,0x1 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x94 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x97 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x36 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x80 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0x84 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x88 ,0xd4 ,0x80 ,0x80 ,0x0 ,0xb ,0x6e ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x88 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x3 ,0x1b ,0x22 ,0x3 ,0x6a ,0x36 ,0x2 ,0x88 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x4b ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x80 ,0xd4 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xb ,0x26 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6c ,0x22 ,0x1 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x10 ,0x9a ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xb ,0x20 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x9e ,0xa ,0x1 ,0x4 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x74 ,0x6b ,0x4b ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x73 ,0x41 ,0x3 ,0x71 ,0x21 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x4f ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x21 ,0x3 ,0xc ,0x3 ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x21 ,0x3 ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x22 ,0x2 ,0x6a ,0x20 ,0x1 ,0x20 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x22 ,0x6 ,0x41 ,0x2 ,0x76 ,0x41 ,0x1 ,0x6a ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x20 ,0x4 ,0x20 ,0x2 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x41 ,0xc ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x70 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x70 ,0x6a ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x45 ,0xd ,0x2 ,0x20 ,0x2 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x6 ,0x20 ,0x2 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x3 ,0x6a ,0x20 ,0x5 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x4 ,0x49 ,0xd ,0x2 ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x5 ,0x20 ,0x3 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x6a ,0x20 ,0x4 ,0x20 ,0x3 ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x20 ,0x5 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x7c ,0x6a ,0x22 ,0x4 ,0x41 ,0x2 ,0x76 ,0x41 ,0x1 ,0x6a ,0x41 ,0x7 ,0x71 ,0x22 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x20 ,0x2 ,0x41 ,0x2 ,0x74 ,0x6b ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1c ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1c ,0x6a ,0x20 ,0x1 ,0x41 ,0x1c ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x20 ,0x6a ,0x21 ,0x3 ,0x20 ,0x5 ,0x41 ,0x60 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x20 ,0x5 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x41 ,0x78 ,0x71 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x5 ,0x6a ,0x20 ,0x1 ,0x41 ,0x5 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x6 ,0x6a ,0x20 ,0x1 ,0x41 ,0x6 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7 ,0x6a ,0x20 ,0x1 ,0x41 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x22 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xcc ,0x1 ,0x1 ,0x3 ,0x7f ,0x20 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x6b ,0xf ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0xd ,0x1 ,0xb ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7b ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x4 ,0x6a ,0x22 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x3 ,0x41 ,0x7f ,0x73 ,0x20 ,0x3 ,0x41 ,0xff ,0xfd ,0xfb ,0x77 ,0x6a ,0x71 ,0x41 ,0x80 ,0x81 ,0x82 ,0x84 ,0x78 ,0x71 ,0x45 ,0xd ,0x0 ,0xb ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6b ,0xb ,0xb ,0xd6 ,0xb ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0xce ,0xb ,0x1 ,0x2 ,0x4 ,0x8 ,0x10 ,0x20 ,0x40 ,0x80 ,0x1d ,0x3a ,0x74 ,0xe8 ,0xcd ,0x87 ,0x13 ,0x26 ,0x4c ,0x98 ,0x2d ,0x5a ,0xb4 ,0x75 ,0xea ,0xc9 ,0x8f ,0x3 ,0x6 ,0xc ,0x18 ,0x30 ,0x60 ,0xc0 ,0x9d ,0x27 ,0x4e ,0x9c ,0x25 ,0x4a ,0x94 ,0x35 ,0x6a ,0xd4 ,0xb5 ,0x77 ,0xee ,0xc1 ,0x9f ,0x23 ,0x46 ,0x8c ,0x5 ,0xa ,0x14 ,0x28 ,0x50 ,0xa0 ,0x5d ,0xba ,0x69 ,0xd2 ,0xb9 ,0x6f ,0xde ,0xa1 ,0x5f ,0xbe ,0x61 ,0xc2 ,0x99 ,0x2f ,0x5e ,0xbc ,0x65 ,0xca ,0x89 ,0xf ,0x1e ,0x3c ,0x78 ,0xf0 ,0xfd ,0xe7 ,0xd3 ,0xbb ,0x6b ,0xd6 ,0xb1 ,0x7f ,0xfe ,0xe1 ,0xdf ,0xa3 ,0x5b ,0xb6 ,0x71 ,0xe2 ,0xd9 ,0xaf ,0x43 ,0x86 ,0x11 ,0x22 ,0x44 ,0x88 ,0xd ,0x1a ,0x34 ,0x68 ,0xd0 ,0xbd ,0x67 ,0xce ,0x81 ,0x1f ,0x3e ,0x7c ,0xf8 ,0xed ,0xc7 ,0x93 ,0x3b ,0x76 ,0xec ,0xc5 ,0x97 ,0x33 ,0x66 ,0xcc ,0x85 ,0x17 ,0x2e ,0x5c ,0xb8 ,0x6d ,0xda ,0xa9 ,0x4f ,0x9e ,0x21 ,0x42 ,0x84 ,0x15 ,0x2a ,0x54 ,0xa8 ,0x4d ,0x9a ,0x29 ,0x52 ,0xa4 ,0x55 ,0xaa ,0x49 ,0x92 ,0x39 ,0x72 ,0xe4 ,0xd5 ,0xb7 ,0x73 ,0xe6 ,0xd1 ,0xbf ,0x63 ,0xc6 ,0x91 ,0x3f ,0x7e ,0xfc ,0xe5 ,0xd7 ,0xb3 ,0x7b ,0xf6 ,0xf1 ,0xff ,0xe3 ,0xdb ,0xab ,0x4b ,0x96 ,0x31 ,0x62 ,0xc4 ,0x95 ,0x37 ,0x6e ,0xdc ,0xa5 ,0x57 ,0xae ,0x41 ,0x82 ,0x19 ,0x32 ,0x64 ,0xc8 ,0x8d ,0x7 ,0xe ,0x1c ,0x38 ,0x70 ,0xe0 ,0xdd ,0xa7 ,0x53 ,0xa6 ,0x51 ,0xa2 ,0x59 ,0xb2 ,0x79 ,0xf2 ,0xf9 ,0xef ,0xc3 ,0x9b ,0x2b ,0x56 ,0xac ,0x45 ,0x8a ,0x9 ,0x12 ,0x24 ,0x48 ,0x90 ,0x3d ,0x7a ,0xf4 ,0xf5 ,0xf7 ,0xf3 ,0xfb ,0xeb ,0xcb ,0x8b ,0xb ,0x16 ,0x2c ,0x58 ,0xb0 ,0x7d ,0xfa ,0xe9 ,0xcf ,0x83 ,0x1b ,0x36 ,0x6c ,0xd8 ,0xad ,0x47 ,0x8e ,0x0 ,0xff ,0x0 ,0x1 ,0x19 ,0x2 ,0x32 ,0x1a ,0xc6 ,0x3 ,0xdf ,0x33 ,0xee ,0x1b ,0x68 ,0xc7 ,0x4b ,0x4 ,0x64 ,0xe0 ,0xe ,0x34 ,0x8d ,0xef ,0x81 ,0x1c ,0xc1 ,0x69 ,0xf8 ,0xc8 ,0x8 ,0x4c ,0x71 ,0x5 ,0x8a ,0x65 ,0x2f ,0xe1 ,0x24 ,0xf ,0x21 ,0x35 ,0x93 ,0x8e ,0xda ,0xf0 ,0x12 ,0x82 ,0x45 ,0x1d ,0xb5 ,0xc2 ,0x7d ,0x6a ,0x27 ,0xf9 ,0xb9 ,0xc9 ,0x9a ,0x9 ,0x78 ,0x4d ,0xe4 ,0x72 ,0xa6 ,0x6 ,0xbf ,0x8b ,0x62 ,0x66 ,0xdd ,0x30 ,0xfd ,0xe2 ,0x98 ,0x25 ,0xb3 ,0x10 ,0x91 ,0x22 ,0x88 ,0x36 ,0xd0 ,0x94 ,0xce ,0x8f ,0x96 ,0xdb ,0xbd ,0xf1 ,0xd2 ,0x13 ,0x5c ,0x83 ,0x38 ,0x46 ,0x40 ,0x1e ,0x42 ,0xb6 ,0xa3 ,0xc3 ,0x48 ,0x7e ,0x6e ,0x6b ,0x3a ,0x28 ,0x54 ,0xfa ,0x85 ,0xba ,0x3d ,0xca ,0x5e ,0x9b ,0x9f ,0xa ,0x15 ,0x79 ,0x2b ,0x4e ,0xd4 ,0xe5 ,0xac ,0x73 ,0xf3 ,0xa7 ,0x57 ,0x7 ,0x70 ,0xc0 ,0xf7 ,0x8c ,0x80 ,0x63 ,0xd ,0x67 ,0x4a ,0xde ,0xed ,0x31 ,0xc5 ,0xfe ,0x18 ,0xe3 ,0xa5 ,0x99 ,0x77 ,0x26 ,0xb8 ,0xb4 ,0x7c ,0x11 ,0x44 ,0x92 ,0xd9 ,0x23 ,0x20 ,0x89 ,0x2e ,0x37 ,0x3f ,0xd1 ,0x5b ,0x95 ,0xbc ,0xcf ,0xcd ,0x90 ,0x87 ,0x97 ,0xb2 ,0xdc ,0xfc ,0xbe ,0x61 ,0xf2 ,0x56 ,0xd3 ,0xab ,0x14 ,0x2a ,0x5d ,0x9e ,0x84 ,0x3c ,0x39 ,0x53 ,0x47 ,0x6d ,0x41 ,0xa2 ,0x1f ,0x2d ,0x43 ,0xd8 ,0xb7 ,0x7b ,0xa4 ,0x76 ,0xc4 ,0x17 ,0x49 ,0xec ,0x7f ,0xc ,0x6f ,0xf6 ,0x6c ,0xa1 ,0x3b ,0x52 ,0x29 ,0x9d ,0x55 ,0xaa ,0xfb ,0x60 ,0x86 ,0xb1 ,0xbb ,0xcc ,0x3e ,0x5a ,0xcb ,0x59 ,0x5f ,0xb0 ,0x9c ,0xa9 ,0xa0 ,0x51 ,0xb ,0xf5 ,0x16 ,0xeb ,0x7a ,0x75 ,0x2c ,0xd7 ,0x4f ,0xae ,0xd5 ,0xe9 ,0xe6 ,0xe7 ,0xad ,0xe8 ,0x74 ,0xd6 ,0xf4 ,0xea ,0xa8 ,0x50 ,0x58 ,0xaf ,0xc4 ,0x77 ,0x0 ,0x0 ,0xf3 ,0x72 ,0x0 ,0x0 ,0xaa ,0x7d ,0x0 ,0x0 ,0x9d ,0x78 ,0x0 ,0x0 ,0x2f ,0x66 ,0x0 ,0x0 ,0x18 ,0x63 ,0x0 ,0x0 ,0x41 ,0x6c ,0x0 ,0x0 ,0x76 ,0x69 ,0x0 ,0x0 ,0x12 ,0x54 ,0x0 ,0x0 ,0x25 ,0x51 ,0x0 ,0x0 ,0x7c ,0x5e ,0x0 ,0x0 ,0x4b ,0x5b ,0x0 ,0x0 ,0xf9 ,0x45 ,0x0 ,0x0 ,0xce ,0x40 ,0x0 ,0x0 ,0x97 ,0x4f ,0x0 ,0x0 ,0xa0 ,0x4a ,0x0 ,0x0 ,0x5f ,0x35 ,0x0 ,0x0 ,0x68 ,0x30 ,0x0 ,0x0 ,0x31 ,0x3f ,0x0 ,0x0 ,0x6 ,0x3a ,0x0 ,0x0 ,0xb4 ,0x24 ,0x0 ,0x0 ,0x83 ,0x21 ,0x0 ,0x0 ,0xda ,0x2e ,0x0 ,0x0 ,0xed ,0x2b ,0x0 ,0x0 ,0x89 ,0x16 ,0x0 ,0x0 ,0xbe ,0x13 ,0x0 ,0x0 ,0xe7 ,0x1c ,0x0 ,0x0 ,0xd0 ,0x19 ,0x0 ,0x0 ,0x62 ,0x7 ,0x0 ,0x0 ,0x55 ,0x2 ,0x0 ,0x0 ,0xc ,0xd ,0x0 ,0x0 ,0x3b ,0x8 ,0x0 ,0x0 ,0x1 ,0x0 ,0x13 ,0x7 ,0x1 ,0x0 ,0x10 ,0xa ,0x1 ,0x0 ,0xd ,0xd ,0x1 ,0x0 ,0x9 ,0x11 ,0x1 ,0x0 ,0x22 ,0xa ,0x1 ,0x0 ,0x1c ,0x10 ,0x1 ,0x0 ,0x16 ,0x16 ,0x1 ,0x0 ,0x10 ,0x1c ,0x1 ,0x0 ,0x37 ,0xf ,0x1 ,0x0 ,0x2c ,0x1a ,0x2 ,0x0 ,0x11 ,0x12 ,0x2 ,0x0 ,0xd ,0x16 ,0x1 ,0x0 ,0x50 ,0x14 ,0x2 ,0x0 ,0x20 ,0x12 ,0x2 ,0x0 ,0x18 ,0x1a ,0x4 ,0x0 ,0x9 ,0x10 ,0x1 ,0x0 ,0x6c ,0x1a ,0x2 ,0x0 ,0x2b ,0x18 ,0x2 ,0x2 ,0xf ,0x12 ,0x2 ,0x2 ,0xb ,0x16 ,0x2 ,0x0 ,0x44 ,0x12 ,0x4 ,0x0 ,0x1b ,0x10 ,0x4 ,0x0 ,0x13 ,0x18 ,0x4 ,0x0 ,0xf ,0x1c ,0x2 ,0x0 ,0x4e ,0x14 ,0x4 ,0x0 ,0x1f ,0x12 ,0x2 ,0x4 ,0xe ,0x12 ,0x4 ,0x1 ,0xd ,0x1a ,0x2 ,0x0 ,0x61 ,0x18 ,0x2 ,0x2 ,0x26 ,0x16 ,0x4 ,0x2 ,0x12 ,0x16 ,0x4 ,0x2 ,0xe ,0x1a ,0x2 ,0x0 ,0x74 ,0x1e ,0x3 ,0x2 ,0x24 ,0x16 ,0x4 ,0x4 ,0x10 ,0x14 ,0x4 ,0x4 ,0xc ,0x18 ,0x2 ,0x2 ,0x44 ,0x12 ,0x4 ,0x1 ,0x2b ,0x1a ,0x6 ,0x2 ,0x13 ,0x18 ,0x6 ,0x2 ,0xf ,0x1c ,0x4 ,0x0 ,0x51 ,0x14 ,0x1 ,0x4 ,0x32 ,0x1e ,0x4 ,0x4 ,0x16 ,0x1c ,0x3 ,0x8 ,0xc ,0x18 ,0x2 ,0x2 ,0x5c ,0x18 ,0x6 ,0x2 ,0x24 ,0x16 ,0x4 ,0x6 ,0x14 ,0x1a ,0x7 ,0x4 ,0xe ,0x1c ,0x4 ,0x0 ,0x6b ,0x1a ,0x8 ,0x1 ,0x25 ,0x16 ,0x8 ,0x4 ,0x14 ,0x18 ,0xc ,0x4 ,0xb ,0x16 ,0x3 ,0x1 ,0x73 ,0x1e ,0x4 ,0x5 ,0x28 ,0x18 ,0xb ,0x5 ,0x10 ,0x14 ,0xb ,0x5 ,0xc ,0x18 ,0x5 ,0x1 ,0x57 ,0x16 ,0x5 ,0x5 ,0x29 ,0x18 ,0x5 ,0x7 ,0x18 ,0x1e ,0xb ,0x7 ,0xc ,0x18 ,0x5 ,0x1 ,0x62 ,0x18 ,0x7 ,0x3 ,0x2d ,0x1c ,0xf ,0x2 ,0x13 ,0x18 ,0x3 ,0xd ,0xf ,0x1e ,0x1 ,0x5 ,0x6b ,0x1c ,0xa ,0x1 ,0x2e ,0x1c ,0x1 ,0xf ,0x16 ,0x1c ,0x2 ,0x11 ,0xe ,0x1c ,0x5 ,0x1 ,0x78 ,0x1e ,0x9 ,0x4 ,0x2b ,0x1a ,0x11 ,0x1 ,0x16 ,0x1c ,0x2 ,0x13 ,0xe ,0x1c ,0x3 ,0x4 ,0x71 ,0x1c ,0x3 ,0xb ,0x2c ,0x1a ,0x11 ,0x4 ,0x15 ,0x1a ,0x9 ,0x10 ,0xd ,0x1a ,0x3 ,0x5 ,0x6b ,0x1c ,0x3 ,0xd ,0x29 ,0x1a ,0xf ,0x5 ,0x18 ,0x1e ,0xf ,0xa ,0xf ,0x1c ,0x4 ,0x4 ,0x74 ,0x1c ,0x11 ,0x0 ,0x2a ,0x1a ,0x11 ,0x6 ,0x16 ,0x1c ,0x13 ,0x6 ,0x10 ,0x1e ,0x2 ,0x7 ,0x6f ,0x1c ,0x11 ,0x0 ,0x2e ,0x1c ,0x7 ,0x10 ,0x18 ,0x1e ,0x22 ,0x0 ,0xd ,0x18 ,0x4 ,0x5 ,0x79 ,0x1e ,0x4 ,0xe ,0x2f ,0x1c ,0xb ,0xe ,0x18 ,0x1e ,0x10 ,0xe ,0xf ,0x1e ,0x6 ,0x4 ,0x75 ,0x1e ,0x6 ,0xe ,0x2d ,0x1c ,0xb ,0x10 ,0x18 ,0x1e ,0x1e ,0x2 ,0x10 ,0x1e ,0x8 ,0x4 ,0x6a ,0x1a ,0x8 ,0xd ,0x2f ,0x1c ,0x7 ,0x16 ,0x18 ,0x1e ,0x16 ,0xd ,0xf ,0x1e ,0xa ,0x2 ,0x72 ,0x1c ,0x13 ,0x4 ,0x2e ,0x1c ,0x1c ,0x6 ,0x16 ,0x1c ,0x21 ,0x4 ,0x10 ,0x1e ,0x8 ,0x4 ,0x7a ,0x1e ,0x16 ,0x3 ,0x2d ,0x1c ,0x8 ,0x1a ,0x17 ,0x1e ,0xc ,0x1c ,0xf ,0x1e ,0x3 ,0xa ,0x75 ,0x1e ,0x3 ,0x17 ,0x2d ,0x1c ,0x4 ,0x1f ,0x18 ,0x1e ,0xb ,0x1f ,0xf ,0x1e ,0x7 ,0x7 ,0x74 ,0x1e ,0x15 ,0x7 ,0x2d ,0x1c ,0x1 ,0x25 ,0x17 ,0x1e ,0x13 ,0x1a ,0xf ,0x1e ,0x5 ,0xa ,0x73 ,0x1e ,0x13 ,0xa ,0x2f ,0x1c ,0xf ,0x19 ,0x18 ,0x1e ,0x17 ,0x19 ,0xf ,0x1e ,0xd ,0x3 ,0x73 ,0x1e ,0x2 ,0x1d ,0x2e ,0x1c ,0x2a ,0x1 ,0x18 ,0x1e ,0x17 ,0x1c ,0xf ,0x1e ,0x11 ,0x0 ,0x73 ,0x1e ,0xa ,0x17 ,0x2e ,0x1c ,0xa ,0x23 ,0x18 ,0x1e ,0x13 ,0x23 ,0xf ,0x1e ,0x11 ,0x1 ,0x73 ,0x1e ,0xe ,0x15 ,0x2e ,0x1c ,0x1d ,0x13 ,0x18 ,0x1e ,0xb ,0x2e ,0xf ,0x1e ,0xd ,0x6 ,0x73 ,0x1e ,0xe ,0x17 ,0x2e ,0x1c ,0x2c ,0x7 ,0x18 ,0x1e ,0x3b ,0x1 ,0x10 ,0x1e ,0xc ,0x7 ,0x79 ,0x1e ,0xc ,0x1a ,0x2f ,0x1c ,0x27 ,0xe ,0x18 ,0x1e ,0x16 ,0x29 ,0xf ,0x1e ,0x6 ,0xe ,0x79 ,0x1e ,0x6 ,0x22 ,0x2f ,0x1c ,0x2e ,0xa ,0x18 ,0x1e ,0x2 ,0x40 ,0xf ,0x1e ,0x11 ,0x4 ,0x7a ,0x1e ,0x1d ,0xe ,0x2e ,0x1c ,0x31 ,0xa ,0x18 ,0x1e ,0x18 ,0x2e ,0xf ,0x1e ,0x4 ,0x12 ,0x7a ,0x1e ,0xd ,0x20 ,0x2e ,0x1c ,0x30 ,0xe ,0x18 ,0x1e ,0x2a ,0x20 ,0xf ,0x1e ,0x14 ,0x4 ,0x75 ,0x1e ,0x28 ,0x7 ,0x2f ,0x1c ,0x2b ,0x16 ,0x18 ,0x1e ,0xa ,0x43 ,0xf ,0x1e ,0x13 ,0x6 ,0x76 ,0x1e ,0x12 ,0x1f ,0x2f ,0x1c ,0x22 ,0x22 ,0x18 ,0x1e ,0x14 ,0x3d ,0xf ,0x1e ,0x0 ,0xb ,0xf ,0x13 ,0x17 ,0x1b ,0x1f ,0x10 ,0x12 ,0x14 ,0x16 ,0x18 ,0x1a ,0x1c ,0x14 ,0x16 ,0x18 ,0x18 ,0x1a ,0x1c ,0x1c ,0x16 ,0x18 ,0x18 ,0x1a ,0x1a ,0x1c ,0x1c ,0x18 ,0x18 ,0x1a ,0x1a ,0x1a ,0x1c ,0x1c ,0x18 ,0x1a ,0x1a ,0x1a ,0x1c ,0x1c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x94 ,0xc ,0x0 ,0x0 ,0xbc ,0x5 ,0x0 ,0x0 ,0x99 ,0xa ,0x0 ,0x0 ,0xd3 ,0x4 ,0x0 ,0x0 ,0xf6 ,0xb ,0x0 ,0x0 ,0x62 ,0x7 ,0x0 ,0x0 ,0x47 ,0x8 ,0x0 ,0x0 ,0xd ,0x6 ,0x0 ,0x0 ,0x28 ,0x9 ,0x0 ,0x0 ,0x78 ,0xb ,0x0 ,0x0 ,0x5d ,0x4 ,0x0 ,0x0 ,0x17 ,0xa ,0x0 ,0x0 ,0x32 ,0x5 ,0x0 ,0x0 ,0xa6 ,0x9 ,0x0 ,0x0 ,0x83 ,0x6 ,0x0 ,0x0 ,0xc9 ,0x8 ,0x0 ,0x0 ,0xec ,0x7 ,0x0 ,0x0 ,0xc4 ,0xe ,0x0 ,0x0 ,0xe1 ,0x1 ,0x0 ,0x0 ,0xab ,0xf ,0x0 ,0x0 ,0x8e ,0x0 ,0x0 ,0x0 ,0x1a ,0xc ,0x0 ,0x0 ,0x3f ,0x3 ,0x0 ,0x0 ,0x75 ,0xd ,0x0 ,0x0 ,0x50 ,0x2 ,0x0 ,0x0 ,0xd5 ,0x9 ,0x0 ,0x0 ,0xf0 ,0x6 ,0x0 ,0x0 ,0xba ,0x8 ,0x0 ,0x0 ,0x9f ,0x7 ,0x0 ,0x0 ,0xb ,0xb ,0x0 ,0x0 ,0x2e ,0x4 ,0x0 ,0x0 ,0x64 ,0xa ,0x0 ,0x0 ,0x41 ,0x5 ,0x0 ,0x0 ,0x69 ,0xc ,0x0 ,0x0 ,0x68 ,0x74 ,0x74 ,0x70 ,0x3a ,0x2f ,0x2f ,0x77 ,0x77 ,0x77 ,0x2e ,0x6d ,0x61 ,0x67 ,0x65 ,0x65 ,0x63 ,0x2e ,0x63 ,0x6f ,0x6d ,0x0};
-
-static uint8_t sglib_combined[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2b ,0x8 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x0 ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x16 ,0x15 ,0x1 ,0x1 ,0x2 ,0x3 ,0x4 ,0x3 ,0x5 ,0x2 ,0x0 ,0x1 ,0x0 ,0x6 ,0x0 ,0x5 ,0x3 ,0x1 ,0x6 ,0x1 ,0x1 ,0x7 ,0x7 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0xcc ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x8c ,0xcf ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0xcc ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x10 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xc3 ,0x2e ,0x15 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xee ,0x3 ,0x1 ,0x9 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x2 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x22 ,0x3 ,0x28 ,0x2 ,0x8 ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0x20 ,0x1 ,0x41 ,0x0 ,0x36 ,0x2 ,0xc ,0x41 ,0x1 ,0x21 ,0x4 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0xc ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x2 ,0x48 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x7 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x3 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0xd ,0x0 ,0x41 ,0x2 ,0x21 ,0x8 ,0x20 ,0x2 ,0x21 ,0x9 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x9 ,0x28 ,0x2 ,0x4 ,0x21 ,0x9 ,0x20 ,0x8 ,0x20 ,0x4 ,0x4e ,0xd ,0x1 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0x9 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x9 ,0x45 ,0xd ,0x0 ,0x20 ,0x9 ,0x28 ,0x2 ,0x4 ,0x21 ,0x8 ,0x20 ,0x9 ,0x41 ,0x0 ,0x36 ,0x2 ,0x4 ,0x20 ,0x6 ,0xd ,0x2 ,0x20 ,0x8 ,0x45 ,0xd ,0x2 ,0x41 ,0x2 ,0x21 ,0x3 ,0x20 ,0x8 ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x9 ,0x28 ,0x2 ,0x4 ,0x21 ,0x9 ,0x20 ,0x3 ,0x20 ,0x4 ,0x4e ,0xd ,0x4 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x9 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x20 ,0x5 ,0x20 ,0x2 ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x4 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x22 ,0x9 ,0x45 ,0xd ,0x5 ,0x41 ,0x0 ,0x21 ,0x8 ,0x20 ,0x9 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x2 ,0x22 ,0x2 ,0x20 ,0x8 ,0x36 ,0x2 ,0x8 ,0x20 ,0x2 ,0x21 ,0x8 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x22 ,0x2 ,0xd ,0x0 ,0xc ,0x8 ,0xb ,0xb ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x21 ,0x8 ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0x4 ,0xb ,0x20 ,0x8 ,0x21 ,0x9 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x9 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0xc ,0x1 ,0xb ,0x20 ,0x9 ,0x28 ,0x2 ,0x4 ,0x21 ,0x3 ,0x20 ,0x9 ,0x41 ,0x0 ,0x36 ,0x2 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x8 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x20 ,0x8 ,0x28 ,0x2 ,0x0 ,0x4e ,0xd ,0x0 ,0x20 ,0x5 ,0x20 ,0x2 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x20 ,0x8 ,0x36 ,0x2 ,0x0 ,0x20 ,0x8 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x8 ,0x28 ,0x2 ,0x4 ,0x21 ,0x8 ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x8 ,0xd ,0x1 ,0xb ,0xb ,0x20 ,0x2 ,0x20 ,0x8 ,0x20 ,0x2 ,0x1b ,0x21 ,0x2 ,0xb ,0x20 ,0x5 ,0x20 ,0x2 ,0x36 ,0x2 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x22 ,0x8 ,0x28 ,0x2 ,0x4 ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0x20 ,0x8 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x41 ,0x0 ,0x21 ,0x7 ,0x20 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x0 ,0x36 ,0x2 ,0xc ,0x20 ,0x4 ,0x41 ,0x1 ,0x74 ,0x21 ,0x4 ,0x20 ,0x3 ,0xd ,0x1 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0x9 ,0xb ,0x20 ,0x0 ,0x20 ,0x9 ,0x36 ,0x2 ,0x0 ,0xb ,0xb ,0x85 ,0x1 ,0x1 ,0x3 ,0x7f ,0x20 ,0x0 ,0x28 ,0x2 ,0x4 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x2 ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x2 ,0x8 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0xc ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x2 ,0x20 ,0x3 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0xc ,0x4 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x4 ,0x22 ,0x1 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x1 ,0x28 ,0x2 ,0x4 ,0x36 ,0x2 ,0x4 ,0x20 ,0x1 ,0x21 ,0x2 ,0xb ,0x20 ,0x2 ,0xb ,0x51 ,0x0 ,0x20 ,0x0 ,0x20 ,0x3 ,0x36 ,0x2 ,0x1c ,0x20 ,0x0 ,0x20 ,0x2 ,0x36 ,0x2 ,0x18 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x10 ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x14 ,0x20 ,0x0 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x36 ,0x2 ,0x8 ,0x20 ,0x0 ,0x20 ,0x3 ,0x36 ,0x2 ,0xc ,0x2 ,0x40 ,0x20 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0xd ,0x0 ,0x20 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0xb ,0x20 ,0x3 ,0xb ,0x64 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x14 ,0x22 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x36 ,0x2 ,0x14 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x12 ,0x4c ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x20 ,0x0 ,0x28 ,0x2 ,0x10 ,0x20 ,0x2 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x20 ,0x0 ,0x20 ,0x0 ,0x29 ,0x2 ,0x18 ,0x37 ,0x2 ,0x8 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x4 ,0x20 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0xb ,0x8e ,0x5 ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x2 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0xf ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x22 ,0x3 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x4 ,0x48 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x1 ,0x4d ,0xd ,0x1 ,0x20 ,0x3 ,0x20 ,0x4 ,0x47 ,0xd ,0x1 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x2d ,0x0 ,0x4 ,0xd ,0x1 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x2 ,0x28 ,0x2 ,0x8 ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0xc ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x46 ,0xd ,0x1 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x22 ,0x0 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x3 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0xf ,0xb ,0x20 ,0x1 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x1 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x36 ,0x2 ,0x8 ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0x20 ,0x1 ,0x20 ,0x2 ,0x36 ,0x2 ,0xc ,0x20 ,0x1 ,0x20 ,0x3 ,0x36 ,0x2 ,0x8 ,0x20 ,0x1 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0xf ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x22 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x1 ,0x20 ,0x3 ,0x28 ,0x2 ,0x8 ,0x21 ,0x4 ,0x20 ,0x2 ,0x20 ,0x3 ,0x28 ,0x2 ,0xc ,0x36 ,0x2 ,0x8 ,0x20 ,0x1 ,0x20 ,0x4 ,0x36 ,0x2 ,0xc ,0x20 ,0x3 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x1 ,0x36 ,0x2 ,0x8 ,0x20 ,0x3 ,0x20 ,0x2 ,0x36 ,0x2 ,0xc ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0x20 ,0x0 ,0x20 ,0x3 ,0x36 ,0x2 ,0x0 ,0xf ,0xb ,0x20 ,0x2 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x2d ,0x0 ,0x4 ,0xd ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x22 ,0x2 ,0x28 ,0x2 ,0xc ,0x21 ,0x1 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x8 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x46 ,0xd ,0x1 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x22 ,0x0 ,0x45 ,0xd ,0x2 ,0x20 ,0x0 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x2 ,0xb ,0x20 ,0x1 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x3 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0xf ,0xb ,0x20 ,0x1 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x36 ,0x2 ,0xc ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0x20 ,0x1 ,0x20 ,0x2 ,0x36 ,0x2 ,0x8 ,0x20 ,0x1 ,0x20 ,0x3 ,0x36 ,0x2 ,0xc ,0x20 ,0x1 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0xf ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x8 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x2d ,0x0 ,0x4 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x3 ,0x28 ,0x2 ,0xc ,0x21 ,0x4 ,0x20 ,0x2 ,0x20 ,0x3 ,0x28 ,0x2 ,0x8 ,0x36 ,0x2 ,0xc ,0x20 ,0x1 ,0x20 ,0x4 ,0x36 ,0x2 ,0x8 ,0x20 ,0x3 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x1 ,0x36 ,0x2 ,0xc ,0x20 ,0x3 ,0x20 ,0x2 ,0x36 ,0x2 ,0x8 ,0x20 ,0x2 ,0x41 ,0x1 ,0x3a ,0x0 ,0x4 ,0x20 ,0x0 ,0x20 ,0x3 ,0x36 ,0x2 ,0x0 ,0xb ,0xb ,0xb2 ,0x3 ,0x1 ,0x7 ,0x7f ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2e ,0x1 ,0x84 ,0x5 ,0x22 ,0x1 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0xd ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x8c ,0x5 ,0x21 ,0x2 ,0x20 ,0x0 ,0x28 ,0x2 ,0x88 ,0x5 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x22 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x6a ,0x41 ,0x4 ,0x6a ,0x22 ,0x6 ,0x2c ,0x0 ,0x0 ,0x22 ,0x7 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x22 ,0x1 ,0x3b ,0x1 ,0x84 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0x84 ,0x1 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0xc ,0x41 ,0x8 ,0x20 ,0x7 ,0x1b ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x22 ,0x5 ,0x41 ,0x7f ,0x4a ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x4 ,0x20 ,0x1 ,0x41 ,0xc ,0x6a ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x45 ,0xd ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x22 ,0x7 ,0x4e ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x20 ,0x7 ,0x46 ,0xd ,0x2 ,0x20 ,0x1 ,0x41 ,0xc ,0x6a ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x0 ,0x20 ,0x4 ,0x6a ,0x41 ,0x4 ,0x6a ,0x41 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0x84 ,0x1 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x2f ,0x1 ,0x84 ,0x5 ,0x41 ,0x1 ,0x6a ,0x3b ,0x1 ,0x84 ,0x5 ,0xb ,0x20 ,0x6 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x2f ,0x1 ,0x84 ,0x5 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xc1 ,0x41 ,0x1 ,0x48 ,0xd ,0x1 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2f ,0x1 ,0x86 ,0x5 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x6a ,0x41 ,0x4 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x47 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0x84 ,0x1 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0xb ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0x5b ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0x42 ,0x0 ,0x37 ,0x2 ,0x88 ,0x5 ,0x20 ,0x0 ,0x41 ,0x1 ,0x3b ,0x1 ,0x86 ,0x5 ,0x2 ,0x40 ,0x20 ,0x1 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x3b ,0x1 ,0x84 ,0x5 ,0x41 ,0x0 ,0xf ,0xb ,0x20 ,0x0 ,0x20 ,0x1 ,0x36 ,0x2 ,0x84 ,0x1 ,0x20 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0x20 ,0x0 ,0x41 ,0x1 ,0x3b ,0x1 ,0x84 ,0x5 ,0x20 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xce ,0xe ,0x1 ,0x10 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xe0 ,0x8 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0xf0 ,0xcb ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x3 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0xe4 ,0x0 ,0x36 ,0x2 ,0xa0 ,0x5 ,0x41 ,0x1 ,0x21 ,0x6 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x6 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0x41 ,0x2 ,0x74 ,0x22 ,0x7 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x20 ,0x2 ,0x20 ,0x7 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x9 ,0x6b ,0x22 ,0x7 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x8 ,0x41 ,0x7f ,0x6a ,0x22 ,0xa ,0x4e ,0xd ,0x0 ,0x20 ,0x9 ,0x41 ,0x2 ,0x74 ,0x20 ,0x5 ,0x6a ,0x21 ,0xb ,0x3 ,0x40 ,0x20 ,0x7 ,0x20 ,0xa ,0x20 ,0x7 ,0x20 ,0xa ,0x4a ,0x1b ,0x21 ,0xc ,0x20 ,0x7 ,0x41 ,0x7f ,0x6a ,0x21 ,0xd ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x20 ,0x5 ,0x6a ,0x21 ,0x7 ,0x20 ,0xb ,0x28 ,0x2 ,0x0 ,0x21 ,0xe ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x22 ,0xf ,0x20 ,0xe ,0x4c ,0xd ,0x0 ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0x10 ,0x20 ,0xa ,0x4a ,0xd ,0x2 ,0x20 ,0xa ,0x41 ,0x2 ,0x74 ,0x20 ,0x5 ,0x6a ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0xc ,0x28 ,0x2 ,0x0 ,0x22 ,0x11 ,0x20 ,0xe ,0x48 ,0xd ,0x5 ,0x20 ,0xc ,0x41 ,0x7c ,0x6a ,0x21 ,0xc ,0x20 ,0x10 ,0x20 ,0xa ,0x48 ,0x21 ,0x11 ,0x20 ,0xa ,0x41 ,0x7f ,0x6a ,0x21 ,0xa ,0x20 ,0x11 ,0xd ,0x0 ,0xb ,0x20 ,0xd ,0x21 ,0x7 ,0xc ,0x3 ,0xb ,0x20 ,0x7 ,0x41 ,0x4 ,0x6a ,0x21 ,0x7 ,0x20 ,0xc ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xa ,0x21 ,0x7 ,0xb ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x20 ,0x5 ,0x6a ,0x22 ,0xd ,0x28 ,0x2 ,0x0 ,0x21 ,0xa ,0x20 ,0xd ,0x20 ,0xe ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x20 ,0xa ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x21 ,0xa ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x10 ,0x20 ,0xa ,0x48 ,0xd ,0x0 ,0x20 ,0x10 ,0x21 ,0x7 ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x20 ,0x11 ,0x36 ,0x2 ,0x0 ,0x20 ,0xc ,0x20 ,0xf ,0x36 ,0x2 ,0x0 ,0x20 ,0xd ,0x41 ,0x2 ,0x6a ,0x21 ,0x7 ,0x2 ,0x40 ,0x20 ,0xd ,0x41 ,0x3 ,0x6a ,0x20 ,0xa ,0x4e ,0xd ,0x0 ,0x20 ,0xa ,0x41 ,0x7f ,0x6a ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x20 ,0x10 ,0x20 ,0x7 ,0x20 ,0xa ,0x48 ,0x1b ,0x21 ,0x7 ,0xb ,0x20 ,0x7 ,0x20 ,0xa ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x20 ,0x9 ,0x6b ,0x22 ,0xd ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x8 ,0x20 ,0xa ,0x6b ,0x22 ,0xe ,0x41 ,0x2 ,0x48 ,0xd ,0x1 ,0x2 ,0x40 ,0x20 ,0xd ,0x20 ,0xe ,0x41 ,0x7f ,0x6a ,0x4f ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x6 ,0x41 ,0x2 ,0x74 ,0x22 ,0xd ,0x6a ,0x20 ,0x8 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0xd ,0x6a ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x6 ,0x41 ,0x2 ,0x74 ,0x22 ,0xd ,0x6a ,0x20 ,0x7 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0xd ,0x6a ,0x20 ,0x9 ,0x36 ,0x2 ,0x0 ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0xc ,0x2 ,0xb ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x21 ,0x8 ,0xb ,0x20 ,0x8 ,0x20 ,0x9 ,0x6b ,0x22 ,0x7 ,0x41 ,0x2 ,0x4a ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x7 ,0x41 ,0x2 ,0x47 ,0xd ,0x0 ,0x20 ,0x9 ,0x41 ,0x2 ,0x74 ,0x20 ,0x5 ,0x6a ,0x22 ,0x7 ,0x28 ,0x2 ,0x0 ,0x22 ,0xd ,0x20 ,0x8 ,0x41 ,0x2 ,0x74 ,0x41 ,0xec ,0xcb ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0xa ,0x28 ,0x2 ,0x0 ,0x22 ,0xe ,0x4c ,0xd ,0x0 ,0x20 ,0x7 ,0x20 ,0xe ,0x36 ,0x2 ,0x0 ,0x20 ,0xa ,0x20 ,0xd ,0x36 ,0x2 ,0x0 ,0xb ,0x20 ,0x6 ,0x41 ,0x0 ,0x4a ,0xd ,0x0 ,0xb ,0x41 ,0xf0 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0xc0 ,0x0 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x94 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0xf0 ,0x7c ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0xd ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0xa ,0x41 ,0xc ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x7 ,0x20 ,0xa ,0x36 ,0x2 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x8b ,0x80 ,0x80 ,0x0 ,0x22 ,0xa ,0xd ,0x0 ,0x20 ,0x7 ,0x41 ,0x0 ,0x36 ,0x2 ,0x8 ,0x41 ,0x0 ,0x20 ,0x7 ,0x36 ,0x2 ,0x94 ,0x8b ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0x7 ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x20 ,0xa ,0x28 ,0x2 ,0x8 ,0x36 ,0x2 ,0x8 ,0x20 ,0xa ,0x20 ,0x7 ,0x36 ,0x2 ,0x8 ,0x20 ,0x7 ,0x20 ,0xa ,0x36 ,0x2 ,0x4 ,0x20 ,0x7 ,0x28 ,0x2 ,0x8 ,0x22 ,0xa ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0xa ,0x20 ,0x7 ,0x36 ,0x2 ,0x4 ,0xb ,0x20 ,0xd ,0x41 ,0x4 ,0x6a ,0x22 ,0xd ,0xd ,0x0 ,0xb ,0x41 ,0x94 ,0x8b ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0xdc ,0x8 ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0x94 ,0x8b ,0x80 ,0x80 ,0x0 ,0x22 ,0xd ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0xd ,0x22 ,0x7 ,0x28 ,0x2 ,0x8 ,0x22 ,0xd ,0xd ,0x0 ,0xb ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xdc ,0x8 ,0x20 ,0x7 ,0x28 ,0x2 ,0x4 ,0x22 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0xa0 ,0x8b ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0xd0 ,0x0 ,0x10 ,0x94 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0xc ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xa ,0x41 ,0x2 ,0x74 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0xd ,0x41 ,0x14 ,0x70 ,0x41 ,0x2 ,0x74 ,0x20 ,0xc ,0x6a ,0x22 ,0xe ,0x28 ,0x2 ,0x0 ,0x22 ,0x7 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x20 ,0xd ,0x46 ,0xd ,0x2 ,0x20 ,0x7 ,0x28 ,0x2 ,0x4 ,0x22 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x8 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x7 ,0x20 ,0xe ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x4 ,0x20 ,0x7 ,0x20 ,0xd ,0x36 ,0x2 ,0x0 ,0x20 ,0xe ,0x20 ,0x7 ,0x36 ,0x2 ,0x0 ,0xb ,0x20 ,0xa ,0x41 ,0x1 ,0x6a ,0x22 ,0xa ,0x41 ,0xe4 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0xbc ,0x8 ,0x6a ,0x20 ,0xc ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xdc ,0x8 ,0x20 ,0x2 ,0x41 ,0xbc ,0x8 ,0x6a ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x21 ,0x7 ,0x41 ,0xf0 ,0x7c ,0x21 ,0xd ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0xd ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x41 ,0xe5 ,0x0 ,0x6f ,0x22 ,0x7 ,0x45 ,0xd ,0x1 ,0x20 ,0xd ,0x41 ,0x4 ,0x6a ,0x22 ,0xd ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0xd ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x6a ,0x36 ,0x2 ,0xdc ,0x8 ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x41 ,0xe5 ,0x0 ,0x6f ,0x22 ,0xd ,0x20 ,0x7 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x11 ,0x41 ,0x2 ,0x74 ,0x22 ,0x7 ,0x6a ,0x20 ,0x7 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x2 ,0x40 ,0x20 ,0x11 ,0x45 ,0xd ,0x0 ,0x20 ,0x11 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x1 ,0x76 ,0x22 ,0xd ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0xa ,0x28 ,0x2 ,0x0 ,0x22 ,0xe ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0xc ,0x28 ,0x2 ,0x0 ,0x22 ,0xf ,0x4e ,0xd ,0x1 ,0x20 ,0xa ,0x20 ,0xf ,0x36 ,0x2 ,0x0 ,0x20 ,0xc ,0x20 ,0xe ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x4b ,0x21 ,0xa ,0x20 ,0xd ,0x21 ,0x7 ,0x20 ,0xa ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x11 ,0x41 ,0x1 ,0x6a ,0x22 ,0x11 ,0x41 ,0xe4 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0xe4 ,0x0 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x2 ,0x28 ,0x2 ,0xa0 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x6a ,0x36 ,0x2 ,0xdc ,0x8 ,0x20 ,0x2 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0xe ,0x22 ,0x7 ,0x41 ,0x7f ,0x6a ,0x22 ,0xe ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0xc ,0x36 ,0x2 ,0xa0 ,0x5 ,0x2 ,0x40 ,0x20 ,0x7 ,0x41 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0xd ,0x41 ,0x1 ,0x21 ,0x7 ,0x41 ,0x2 ,0x21 ,0xa ,0x3 ,0x40 ,0x20 ,0x7 ,0x20 ,0xd ,0x20 ,0xc ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x48 ,0x1b ,0x21 ,0x7 ,0x2 ,0x40 ,0x20 ,0xa ,0x20 ,0xe ,0x4e ,0xd ,0x0 ,0x20 ,0xa ,0x20 ,0x7 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0xa ,0x41 ,0x2 ,0x74 ,0x6a ,0x28 ,0x2 ,0x0 ,0x48 ,0x1b ,0x21 ,0x7 ,0xb ,0x20 ,0x7 ,0x20 ,0xd ,0x46 ,0xd ,0x1 ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0xd ,0x41 ,0x2 ,0x74 ,0x6a ,0x20 ,0x2 ,0x41 ,0xa0 ,0x5 ,0x6a ,0x20 ,0x7 ,0x41 ,0x2 ,0x74 ,0x6a ,0x22 ,0xd ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0xd ,0x20 ,0xc ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x1 ,0x74 ,0x22 ,0xf ,0x41 ,0x2 ,0x6a ,0x21 ,0xa ,0x20 ,0x7 ,0x21 ,0xd ,0x20 ,0xf ,0x41 ,0x1 ,0x72 ,0x22 ,0x7 ,0x20 ,0xe ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xe ,0xd ,0x0 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0x9c ,0x5 ,0x41 ,0x0 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0xe ,0x41 ,0x2 ,0x74 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0xd ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xc ,0x45 ,0xd ,0x0 ,0x20 ,0xc ,0x21 ,0x7 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x22 ,0xa ,0x4e ,0xd ,0x0 ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x21 ,0x7 ,0xc ,0x1 ,0xb ,0x20 ,0xd ,0x20 ,0xa ,0x46 ,0xd ,0x3 ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x21 ,0x7 ,0xb ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x22 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x10 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x7 ,0x20 ,0xd ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x42 ,0x0 ,0x37 ,0x2 ,0x8 ,0x20 ,0x2 ,0x41 ,0x9c ,0x5 ,0x6a ,0x20 ,0x7 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0x9c ,0x5 ,0x22 ,0xc ,0x41 ,0x0 ,0x3a ,0x0 ,0x4 ,0xb ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x22 ,0xe ,0x41 ,0xe4 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x20 ,0xc ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x7 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x6a ,0x36 ,0x2 ,0xdc ,0x8 ,0x20 ,0x2 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x47 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0xb ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x28 ,0x2 ,0xdc ,0x8 ,0x21 ,0x7 ,0x20 ,0x2 ,0x41 ,0xe0 ,0x8 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x7 ,0xb ,0xc ,0x0 ,0x41 ,0x1f ,0x41 ,0x1 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x36 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x80 ,0xcf ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0x84 ,0xcf ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x88 ,0xcf ,0x80 ,0x80 ,0x0 ,0xb ,0x6e ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x88 ,0xcf ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0x80 ,0xcf ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x3 ,0x1b ,0x22 ,0x3 ,0x6a ,0x36 ,0x2 ,0x88 ,0xcf ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0x84 ,0xcf ,0x80 ,0x80 ,0x0 ,0x4b ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x80 ,0xcf ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0x98 ,0x3 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x90 ,0x3 ,0xe ,0x0 ,0x0 ,0x0 ,0x42 ,0x0 ,0x0 ,0x0 ,0xc ,0x0 ,0x0 ,0x0 ,0x29 ,0x0 ,0x0 ,0x0 ,0x56 ,0x0 ,0x0 ,0x0 ,0x45 ,0x0 ,0x0 ,0x0 ,0x13 ,0x0 ,0x0 ,0x0 ,0x4d ,0x0 ,0x0 ,0x0 ,0x44 ,0x0 ,0x0 ,0x0 ,0x26 ,0x0 ,0x0 ,0x0 ,0x1a ,0x0 ,0x0 ,0x0 ,0x2a ,0x0 ,0x0 ,0x0 ,0x25 ,0x0 ,0x0 ,0x0 ,0x17 ,0x0 ,0x0 ,0x0 ,0x11 ,0x0 ,0x0 ,0x0 ,0x1d ,0x0 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x0 ,0xd ,0x0 ,0x0 ,0x0 ,0x5a ,0x0 ,0x0 ,0x0 ,0x5c ,0x0 ,0x0 ,0x0 ,0x4c ,0x0 ,0x0 ,0x0 ,0x63 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x0 ,0x39 ,0x0 ,0x0 ,0x0 ,0x53 ,0x0 ,0x0 ,0x0 ,0x28 ,0x0 ,0x0 ,0x0 ,0x2c ,0x0 ,0x0 ,0x0 ,0x4b ,0x0 ,0x0 ,0x0 ,0x21 ,0x0 ,0x0 ,0x0 ,0x18 ,0x0 ,0x0 ,0x0 ,0x1c ,0x0 ,0x0 ,0x0 ,0x50 ,0x0 ,0x0 ,0x0 ,0x12 ,0x0 ,0x0 ,0x0 ,0x4e ,0x0 ,0x0 ,0x0 ,0x20 ,0x0 ,0x0 ,0x0 ,0x5d ,0x0 ,0x0 ,0x0 ,0x59 ,0x0 ,0x0 ,0x0 ,0x34 ,0x0 ,0x0 ,0x0 ,0xb ,0x0 ,0x0 ,0x0 ,0x15 ,0x0 ,0x0 ,0x0 ,0x60 ,0x0 ,0x0 ,0x0 ,0x32 ,0x0 ,0x0 ,0x0 ,0xf ,0x0 ,0x0 ,0x0 ,0x30 ,0x0 ,0x0 ,0x0 ,0x3f ,0x0 ,0x0 ,0x0 ,0x57 ,0x0 ,0x0 ,0x0 ,0x14 ,0x0 ,0x0 ,0x0 ,0x8 ,0x0 ,0x0 ,0x0 ,0x55 ,0x0 ,0x0 ,0x0 ,0x2b ,0x0 ,0x0 ,0x0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x5e ,0x0 ,0x0 ,0x0 ,0x58 ,0x0 ,0x0 ,0x0 ,0x35 ,0x0 ,0x0 ,0x0 ,0x54 ,0x0 ,0x0 ,0x0 ,0x4a ,0x0 ,0x0 ,0x0 ,0x5b ,0x0 ,0x0 ,0x0 ,0x43 ,0x0 ,0x0 ,0x0 ,0x24 ,0x0 ,0x0 ,0x0 ,0x5f ,0x0 ,0x0 ,0x0 ,0x3d ,0x0 ,0x0 ,0x0 ,0x40 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x1e ,0x0 ,0x0 ,0x0 ,0x52 ,0x0 ,0x0 ,0x0 ,0x48 ,0x0 ,0x0 ,0x0 ,0x2e ,0x0 ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0x7 ,0x0 ,0x0 ,0x0 ,0x3 ,0x0 ,0x0 ,0x0 ,0x27 ,0x0 ,0x0 ,0x0 ,0x1f ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0x49 ,0x0 ,0x0 ,0x0 ,0x46 ,0x0 ,0x0 ,0x0 ,0x3c ,0x0 ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x0 ,0x51 ,0x0 ,0x0 ,0x0 ,0x38 ,0x0 ,0x0 ,0x0 ,0x33 ,0x0 ,0x0 ,0x0 ,0x2d ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0x31 ,0x0 ,0x0 ,0x0 ,0x1b ,0x0 ,0x0 ,0x0 ,0x2f ,0x0 ,0x0 ,0x0 ,0x22 ,0x0 ,0x0 ,0x0 ,0x23 ,0x0 ,0x0 ,0x0 ,0x3e ,0x0 ,0x0 ,0x0 ,0x61 ,0x0 ,0x0 ,0x0 ,0x2 ,0x0 ,0x0 ,0x0 ,0x4f ,0x0 ,0x0 ,0x0 ,0x62 ,0x0 ,0x0 ,0x0 ,0x19 ,0x0 ,0x0 ,0x0 ,0x16 ,0x0 ,0x0 ,0x0 ,0x41 ,0x0 ,0x0 ,0x0 ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0};
-
-static uint8_t slre[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x35 ,0x8 ,0x60 ,0x0 ,0x0 ,0x60 ,0x5 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x6 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x3 ,0x14 ,0x13 ,0x0 ,0x0 ,0x1 ,0x2 ,0x3 ,0x0 ,0x2 ,0x4 ,0x5 ,0x6 ,0x2 ,0x0 ,0x4 ,0x0 ,0x0 ,0x7 ,0x7 ,0x6 ,0x7 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0x86 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x84 ,0x9 ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0x86 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xc ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xfa ,0x20 ,0x13 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xc8 ,0x8 ,0x2 ,0xc ,0x7f ,0x1 ,0x7e ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x13 ,0x6b ,0x22 ,0x5 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x6 ,0x20 ,0x5 ,0x41 ,0x0 ,0x36 ,0x2 ,0xfc ,0x12 ,0x20 ,0x5 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf0 ,0x12 ,0x20 ,0x5 ,0x20 ,0x4 ,0x36 ,0x2 ,0xf8 ,0x12 ,0x20 ,0x5 ,0x20 ,0x3 ,0x36 ,0x2 ,0xf4 ,0x12 ,0x2 ,0x40 ,0x20 ,0x0 ,0x28 ,0x0 ,0x0 ,0x41 ,0xa8 ,0xfe ,0xa4 ,0xcb ,0x2 ,0x47 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x1 ,0x36 ,0x2 ,0xfc ,0x12 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x20 ,0x5 ,0x41 ,0x1 ,0x36 ,0x2 ,0xcc ,0xc ,0x20 ,0x5 ,0x20 ,0x7 ,0x36 ,0x2 ,0x10 ,0x20 ,0x5 ,0x20 ,0x0 ,0x36 ,0x2 ,0xc ,0x41 ,0x1 ,0x21 ,0x8 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x7 ,0x41 ,0x7d ,0x6a ,0x21 ,0x9 ,0x20 ,0x7 ,0x41 ,0x7f ,0x6a ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x8 ,0x41 ,0x1 ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0xd ,0x20 ,0x7 ,0x20 ,0x3 ,0x6b ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0xe ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0x2d ,0x0 ,0x0 ,0x22 ,0xf ,0x41 ,0x58 ,0x6a ,0xe ,0x2 ,0x1 ,0x4 ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0xf ,0x41 ,0xdc ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0xf ,0x41 ,0xfc ,0x0 ,0x47 ,0xd ,0x5 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0xe3 ,0x0 ,0x4c ,0xd ,0x0 ,0x41 ,0x78 ,0x21 ,0xf ,0xc ,0xa ,0xb ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0xb ,0x41 ,0xc8 ,0xc ,0x6a ,0x20 ,0xd ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x41 ,0xc4 ,0xc ,0x6a ,0x20 ,0x8 ,0x41 ,0x7f ,0x6a ,0x22 ,0xd ,0x20 ,0xc ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0xd ,0x41 ,0x4 ,0x74 ,0x6a ,0x28 ,0x2 ,0x4 ,0x41 ,0x7f ,0x46 ,0x1b ,0x36 ,0x2 ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0xc ,0x2 ,0xb ,0x41 ,0x7a ,0x21 ,0xf ,0x20 ,0x3 ,0x20 ,0xa ,0x4e ,0xd ,0x8 ,0x2 ,0x40 ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x10 ,0x41 ,0xf8 ,0x0 ,0x47 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x9 ,0x4e ,0xd ,0x9 ,0x20 ,0xd ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x9 ,0x20 ,0xd ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0xd ,0x5 ,0xc ,0x9 ,0xb ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x20 ,0x10 ,0x41 ,0x10 ,0x10 ,0x91 ,0x80 ,0x80 ,0x80 ,0x0 ,0xd ,0x4 ,0xc ,0x8 ,0xb ,0x2 ,0x40 ,0x20 ,0xb ,0x41 ,0xe3 ,0x0 ,0x4c ,0xd ,0x0 ,0x41 ,0x77 ,0x21 ,0xf ,0xc ,0x8 ,0xb ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0xb ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0x8 ,0x41 ,0x7f ,0x36 ,0x2 ,0x4 ,0x20 ,0x8 ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x21 ,0xc ,0x20 ,0x4 ,0x41 ,0x1 ,0x4e ,0xd ,0x1 ,0xb ,0x20 ,0x8 ,0x21 ,0xb ,0xc ,0x2 ,0xb ,0x20 ,0xb ,0x20 ,0x4 ,0x4a ,0x21 ,0xd ,0x20 ,0x8 ,0x21 ,0xb ,0x20 ,0xd ,0x45 ,0xd ,0x1 ,0x41 ,0x79 ,0x21 ,0xf ,0xc ,0x5 ,0xb ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0xb ,0x41 ,0x7f ,0x6a ,0x22 ,0xf ,0x20 ,0xc ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0xf ,0x41 ,0x4 ,0x74 ,0x6a ,0x28 ,0x2 ,0x4 ,0x41 ,0x7f ,0x46 ,0x1b ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0xf ,0x20 ,0xd ,0x20 ,0xf ,0x28 ,0x2 ,0x0 ,0x6b ,0x36 ,0x2 ,0x4 ,0x2 ,0x40 ,0x20 ,0xc ,0x41 ,0x1 ,0x4e ,0xd ,0x0 ,0x41 ,0x7d ,0x21 ,0xf ,0xc ,0x5 ,0xb ,0x20 ,0xc ,0x41 ,0x7f ,0x6a ,0x21 ,0xc ,0x20 ,0x3 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x41 ,0x7f ,0x21 ,0xf ,0x20 ,0xd ,0x41 ,0x7f ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x28 ,0x46 ,0xd ,0x4 ,0xb ,0x20 ,0xe ,0x20 ,0x3 ,0x6a ,0x22 ,0x3 ,0x20 ,0x7 ,0x48 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x20 ,0x6 ,0x36 ,0x2 ,0xf0 ,0x12 ,0x20 ,0x5 ,0x20 ,0x8 ,0x36 ,0x2 ,0xcc ,0xc ,0x41 ,0x7d ,0x21 ,0xf ,0x20 ,0xc ,0xd ,0x2 ,0x2 ,0x40 ,0x20 ,0x6 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0xd8 ,0xc ,0x6a ,0x21 ,0xe ,0x41 ,0x0 ,0x21 ,0xc ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0xc ,0x22 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0xc ,0x20 ,0x6 ,0x4e ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0x3 ,0x41 ,0x3 ,0x74 ,0x6a ,0x41 ,0xc4 ,0xc ,0x6a ,0x21 ,0xd ,0x20 ,0xe ,0x21 ,0x3 ,0x20 ,0xc ,0x21 ,0x7 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0x28 ,0x2 ,0x0 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x4c ,0xd ,0x0 ,0x20 ,0xd ,0x29 ,0x2 ,0x0 ,0x21 ,0x11 ,0x20 ,0xd ,0x20 ,0x3 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x11 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0xf0 ,0x12 ,0x21 ,0x6 ,0xb ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x6 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xe ,0x41 ,0x8 ,0x6a ,0x21 ,0xe ,0x20 ,0xc ,0x20 ,0x6 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x8 ,0x41 ,0x1 ,0x48 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x6 ,0x6b ,0x21 ,0xf ,0x20 ,0x5 ,0x41 ,0xd0 ,0xc ,0x6a ,0x21 ,0x0 ,0x41 ,0x0 ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0x3 ,0x20 ,0xb ,0x36 ,0x2 ,0x8 ,0x20 ,0x3 ,0x41 ,0x0 ,0x36 ,0x2 ,0xc ,0x2 ,0x40 ,0x20 ,0xb ,0x20 ,0x6 ,0x4e ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x21 ,0xc ,0x20 ,0xf ,0x20 ,0xb ,0x6a ,0x21 ,0xe ,0x20 ,0x0 ,0x20 ,0xb ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0xd ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x20 ,0x7 ,0x47 ,0xd ,0x1 ,0x20 ,0xc ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0xe ,0x20 ,0xd ,0x6a ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x21 ,0xb ,0xc ,0x1 ,0xb ,0x20 ,0xb ,0x20 ,0xd ,0x6a ,0x21 ,0xb ,0xb ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x8 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x0 ,0x4e ,0xd ,0x0 ,0x41 ,0x7f ,0x21 ,0xf ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x28 ,0x2 ,0xc ,0x2d ,0x0 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0xde ,0x0 ,0x46 ,0x21 ,0xc ,0x20 ,0x2 ,0x21 ,0xd ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x20 ,0xd ,0x20 ,0x5 ,0x41 ,0xc ,0x6a ,0x41 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0xf ,0x41 ,0x0 ,0x48 ,0xd ,0x0 ,0x20 ,0xf ,0x20 ,0x3 ,0x6a ,0x21 ,0xf ,0xc ,0x2 ,0xb ,0x20 ,0xc ,0xd ,0x1 ,0x20 ,0xd ,0x41 ,0x7f ,0x6a ,0x21 ,0xd ,0x20 ,0x3 ,0x20 ,0x2 ,0x48 ,0x21 ,0x7 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x7 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x41 ,0x80 ,0x13 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0xf ,0xb ,0x9b ,0x1 ,0x1 ,0x4 ,0x7f ,0x41 ,0x1 ,0x21 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x41 ,0xa5 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x41 ,0x1 ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x20 ,0x2 ,0x6a ,0x22 ,0x5 ,0x2d ,0x0 ,0x0 ,0x41 ,0xa4 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x3 ,0x1 ,0xb ,0x41 ,0x4 ,0x41 ,0x2 ,0x20 ,0x5 ,0x2d ,0x0 ,0x1 ,0x41 ,0xf8 ,0x0 ,0x46 ,0x1b ,0x21 ,0x0 ,0xb ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x2 ,0x20 ,0x3 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x41 ,0x0 ,0x20 ,0x2 ,0x20 ,0x1 ,0x48 ,0x1b ,0xf ,0xb ,0x41 ,0x4 ,0x41 ,0x2 ,0x20 ,0x0 ,0x2d ,0x0 ,0x1 ,0x41 ,0xf8 ,0x0 ,0x46 ,0x1b ,0x21 ,0x2 ,0xb ,0x20 ,0x2 ,0xb ,0xd6 ,0x1 ,0x1 ,0x7 ,0x7f ,0x20 ,0x2 ,0x20 ,0x3 ,0x41 ,0x4 ,0x74 ,0x6a ,0x22 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x21 ,0x7 ,0x41 ,0x0 ,0x21 ,0x8 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x8 ,0xd ,0x0 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x21 ,0x9 ,0xc ,0x1 ,0xb ,0x20 ,0x8 ,0x20 ,0x6 ,0x28 ,0x2 ,0x0 ,0x6a ,0x41 ,0x3 ,0x74 ,0x20 ,0x2 ,0x6a ,0x41 ,0xc0 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x9 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x22 ,0xa ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x8 ,0x20 ,0xa ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x6a ,0x20 ,0x9 ,0x6b ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x20 ,0x8 ,0x20 ,0x6 ,0x28 ,0x2 ,0x0 ,0x6a ,0x41 ,0x3 ,0x74 ,0x6a ,0x41 ,0xc8 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x9 ,0x6b ,0x21 ,0xa ,0xb ,0x2 ,0x40 ,0x20 ,0x9 ,0x20 ,0xa ,0x20 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x20 ,0x3 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0xa ,0x41 ,0x0 ,0x4a ,0xd ,0x0 ,0x20 ,0x8 ,0x20 ,0x7 ,0x28 ,0x2 ,0x0 ,0x48 ,0x21 ,0x9 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0x9 ,0xd ,0x1 ,0xb ,0xb ,0x20 ,0xa ,0xb ,0x2 ,0x0 ,0xb ,0xb0 ,0x1 ,0x1 ,0x5 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x20 ,0x2 ,0x41 ,0x0 ,0x36 ,0x2 ,0xc ,0x41 ,0x70 ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x6 ,0x41 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0x20 ,0x2 ,0x41 ,0x4 ,0x6a ,0x41 ,0x1 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x28 ,0x2 ,0xc ,0x6a ,0x36 ,0x2 ,0xc ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x28 ,0x2 ,0xc ,0x21 ,0x6 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0xb ,0xd ,0x0 ,0x41 ,0xf4 ,0x0 ,0x41 ,0x1 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x84 ,0xb ,0x1 ,0x10 ,0x7f ,0x41 ,0x0 ,0x21 ,0x6 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x0 ,0x48 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x1 ,0x41 ,0x7e ,0x6a ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0xa ,0x6a ,0x22 ,0x6 ,0x2d ,0x0 ,0x0 ,0x22 ,0xc ,0x41 ,0x28 ,0x47 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x74 ,0x20 ,0x4 ,0x6a ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0xd ,0xc ,0x1 ,0xb ,0x20 ,0x6 ,0x20 ,0x1 ,0x20 ,0xa ,0x6b ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0xd ,0x20 ,0xc ,0x41 ,0x56 ,0x6a ,0x22 ,0xe ,0x41 ,0x15 ,0x4b ,0xd ,0x0 ,0x41 ,0x1 ,0x20 ,0xe ,0x74 ,0x41 ,0x83 ,0x80 ,0x80 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x7e ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0xd ,0x41 ,0x1 ,0x4e ,0xd ,0x0 ,0x41 ,0x7b ,0xf ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0xd ,0x20 ,0xa ,0x6a ,0x22 ,0xe ,0x4c ,0xd ,0x0 ,0x20 ,0x6 ,0x20 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x56 ,0x6a ,0x22 ,0xf ,0x41 ,0x15 ,0x4b ,0xd ,0x0 ,0x41 ,0x1 ,0x20 ,0xf ,0x74 ,0x41 ,0x83 ,0x80 ,0x80 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0xe ,0x6a ,0x22 ,0xf ,0x2d ,0x0 ,0x0 ,0x22 ,0xc ,0x41 ,0x3f ,0x46 ,0xd ,0x0 ,0x20 ,0xc ,0x41 ,0x56 ,0x6a ,0x41 ,0x2 ,0x49 ,0xd ,0x1 ,0x20 ,0xb ,0x21 ,0x6 ,0xc ,0x3 ,0xb ,0x20 ,0x6 ,0x20 ,0xd ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x20 ,0x3 ,0x20 ,0xb ,0x6b ,0x20 ,0x4 ,0x20 ,0x5 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x41 ,0x0 ,0x20 ,0x6 ,0x41 ,0x0 ,0x4a ,0x1b ,0x20 ,0xb ,0x6a ,0x21 ,0x6 ,0x20 ,0xd ,0x20 ,0xa ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0xe ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xe ,0x41 ,0x1 ,0x6a ,0x22 ,0x10 ,0x20 ,0x1 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x11 ,0xc ,0x1 ,0xb ,0x20 ,0xe ,0x41 ,0x2 ,0x6a ,0x20 ,0x10 ,0x20 ,0x0 ,0x20 ,0x10 ,0x6a ,0x2d ,0x0 ,0x0 ,0x41 ,0x3f ,0x46 ,0x22 ,0x11 ,0x1b ,0x21 ,0x10 ,0xb ,0x20 ,0x1 ,0x20 ,0x10 ,0x6b ,0x21 ,0x12 ,0x20 ,0x0 ,0x20 ,0x10 ,0x6a ,0x21 ,0x13 ,0x41 ,0x2b ,0x21 ,0x14 ,0x20 ,0xb ,0x21 ,0xa ,0x20 ,0xb ,0x21 ,0x15 ,0x41 ,0x7f ,0x21 ,0x9 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x6 ,0x20 ,0xd ,0x20 ,0x2 ,0x20 ,0xa ,0x6a ,0x20 ,0x3 ,0x20 ,0xa ,0x6b ,0x20 ,0x4 ,0x20 ,0x5 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0xe ,0x41 ,0x7f ,0x4a ,0xd ,0x0 ,0x20 ,0xf ,0x2d ,0x0 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2b ,0x46 ,0xd ,0x8 ,0xb ,0x41 ,0x0 ,0x20 ,0xe ,0x20 ,0xe ,0x41 ,0x1 ,0x48 ,0x22 ,0x0 ,0x1b ,0x20 ,0xa ,0x6a ,0x22 ,0xa ,0x21 ,0xc ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x10 ,0x4c ,0xd ,0x0 ,0x20 ,0x15 ,0x20 ,0x13 ,0x20 ,0x12 ,0x20 ,0x2 ,0x20 ,0xa ,0x6a ,0x20 ,0x3 ,0x20 ,0xa ,0x6b ,0x20 ,0x4 ,0x20 ,0x5 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x9 ,0x20 ,0xa ,0x6a ,0x20 ,0x9 ,0x41 ,0x0 ,0x48 ,0x1b ,0x21 ,0xc ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x20 ,0xc ,0x21 ,0x15 ,0x20 ,0x11 ,0x20 ,0xc ,0x20 ,0xb ,0x4a ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0xb ,0x20 ,0xf ,0x2d ,0x0 ,0x0 ,0x21 ,0x14 ,0x20 ,0xe ,0x41 ,0x7f ,0x4a ,0xd ,0x5 ,0x20 ,0x14 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2a ,0x47 ,0xd ,0x5 ,0x20 ,0x13 ,0x20 ,0x12 ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x20 ,0x3 ,0x20 ,0xb ,0x6b ,0x20 ,0x4 ,0x20 ,0x5 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x9 ,0x20 ,0xb ,0x6a ,0x20 ,0xc ,0x20 ,0x9 ,0x41 ,0x0 ,0x4a ,0x1b ,0x21 ,0x15 ,0x20 ,0xf ,0x2d ,0x0 ,0x0 ,0x21 ,0x14 ,0xc ,0x6 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xc ,0x41 ,0x5c ,0x6a ,0xe ,0x5 ,0x3 ,0x4 ,0x4 ,0x4 ,0x1 ,0x0 ,0xb ,0x2 ,0x40 ,0x20 ,0xc ,0x41 ,0xa5 ,0x7f ,0x6a ,0xe ,0x4 ,0x0 ,0x4 ,0x4 ,0x2 ,0x4 ,0xb ,0x41 ,0x1 ,0x21 ,0xd ,0x2 ,0x40 ,0x20 ,0x8 ,0x20 ,0xa ,0x6b ,0x20 ,0x6 ,0x2d ,0x0 ,0x1 ,0x41 ,0xde ,0x0 ,0x46 ,0x22 ,0x13 ,0x6b ,0x22 ,0x10 ,0x41 ,0x0 ,0x48 ,0xd ,0x0 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x20 ,0x13 ,0x6a ,0x22 ,0x15 ,0x41 ,0x2 ,0x6a ,0x21 ,0x14 ,0x20 ,0x15 ,0x41 ,0x1 ,0x6a ,0x21 ,0x12 ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0x7f ,0x21 ,0xa ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x15 ,0x20 ,0x6 ,0x6a ,0x22 ,0xf ,0x2c ,0x0 ,0x0 ,0x22 ,0xd ,0x41 ,0xdd ,0x0 ,0x46 ,0xd ,0x1 ,0x20 ,0xa ,0x41 ,0x0 ,0x4a ,0xd ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xd ,0x41 ,0x2d ,0x47 ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0xc ,0x20 ,0xf ,0x20 ,0x9 ,0x20 ,0x4 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x12 ,0x20 ,0x6 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x11 ,0x41 ,0x2d ,0x47 ,0xd ,0x0 ,0x20 ,0x14 ,0x20 ,0x6 ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0xa ,0x45 ,0xd ,0x0 ,0x20 ,0xa ,0x41 ,0xdd ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0xa ,0xc0 ,0x21 ,0xf ,0x20 ,0x9 ,0x2c ,0x0 ,0x0 ,0x21 ,0xc ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x28 ,0x2 ,0xf0 ,0x12 ,0x45 ,0xd ,0x0 ,0x20 ,0xc ,0x20 ,0xd ,0x4e ,0x20 ,0xc ,0x20 ,0xf ,0x4c ,0x71 ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0xa ,0x20 ,0xc ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0xc ,0x20 ,0xd ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x48 ,0xd ,0x0 ,0x20 ,0xc ,0x20 ,0xf ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x4c ,0x21 ,0xa ,0xb ,0x20 ,0x6 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0xc ,0x2 ,0xb ,0x41 ,0x1 ,0x21 ,0xc ,0x20 ,0xf ,0x20 ,0x9 ,0x20 ,0x4 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0xa ,0x20 ,0xd ,0x41 ,0xdc ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x4 ,0x41 ,0x2 ,0x20 ,0x11 ,0x41 ,0xf8 ,0x0 ,0x46 ,0x1b ,0x21 ,0xc ,0xb ,0x20 ,0xc ,0x20 ,0x6 ,0x6a ,0x21 ,0x6 ,0xb ,0x20 ,0x6 ,0x20 ,0x10 ,0x4c ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xa ,0x41 ,0x1 ,0x48 ,0x21 ,0xd ,0xb ,0x41 ,0x7f ,0x21 ,0x6 ,0x41 ,0x1 ,0x41 ,0x7f ,0x20 ,0xd ,0x1b ,0x41 ,0x7f ,0x20 ,0x13 ,0x1b ,0x22 ,0xa ,0x20 ,0xa ,0x41 ,0x1 ,0x20 ,0xd ,0x1b ,0x20 ,0x13 ,0x1b ,0x22 ,0xd ,0x41 ,0x1 ,0x48 ,0xd ,0xa ,0x20 ,0xd ,0x20 ,0xb ,0x6a ,0x21 ,0x6 ,0xc ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0xa ,0x20 ,0x4 ,0x28 ,0x2 ,0xc0 ,0xc ,0x48 ,0xd ,0x0 ,0x41 ,0x7c ,0xf ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0xe ,0x6b ,0x22 ,0x15 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0xb ,0x4e ,0xd ,0x1 ,0xc ,0x9 ,0xb ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x20 ,0x3 ,0x20 ,0xb ,0x6b ,0x20 ,0x4 ,0x20 ,0xa ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0xc ,0x1 ,0xb ,0x20 ,0x7 ,0x20 ,0xb ,0x6b ,0x21 ,0xc ,0x20 ,0x6 ,0x20 ,0xd ,0x6a ,0x21 ,0x10 ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x21 ,0xf ,0x20 ,0x9 ,0x20 ,0x3 ,0x6a ,0x22 ,0x9 ,0x21 ,0xd ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0xf ,0x20 ,0xd ,0x20 ,0x4 ,0x20 ,0xa ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x41 ,0x0 ,0x48 ,0xd ,0x0 ,0x20 ,0x10 ,0x20 ,0x15 ,0x20 ,0xf ,0x20 ,0x6 ,0x6a ,0x20 ,0x9 ,0x20 ,0x6 ,0x6b ,0x20 ,0x4 ,0x20 ,0xa ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x4a ,0xd ,0x3 ,0xb ,0x20 ,0xd ,0x41 ,0x7f ,0x6a ,0x21 ,0xd ,0x20 ,0xc ,0x41 ,0x7f ,0x6a ,0x22 ,0xc ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x41 ,0x0 ,0x48 ,0xd ,0xa ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0x28 ,0x2 ,0xe8 ,0x12 ,0x22 ,0xd ,0x45 ,0xd ,0x0 ,0x20 ,0xd ,0x20 ,0x5 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0xd ,0x20 ,0x6 ,0x36 ,0x2 ,0x4 ,0x20 ,0xd ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x36 ,0x2 ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0xb ,0x6a ,0x21 ,0x6 ,0xc ,0x4 ,0xb ,0x41 ,0x0 ,0x21 ,0x6 ,0x20 ,0x5 ,0x21 ,0xa ,0x20 ,0xb ,0xd ,0x4 ,0xc ,0x3 ,0xb ,0x20 ,0x3 ,0x21 ,0x6 ,0x20 ,0x5 ,0x21 ,0xa ,0x20 ,0x3 ,0x20 ,0xb ,0x47 ,0xd ,0x3 ,0xc ,0x2 ,0xb ,0x20 ,0x3 ,0x20 ,0xb ,0x4c ,0xd ,0x2 ,0x20 ,0x6 ,0x20 ,0x2 ,0x20 ,0xb ,0x6a ,0x20 ,0x4 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x6 ,0x41 ,0x1 ,0x48 ,0xd ,0x6 ,0x20 ,0x6 ,0x20 ,0xb ,0x6a ,0x21 ,0x6 ,0xb ,0x20 ,0x5 ,0x21 ,0xa ,0xb ,0x20 ,0xe ,0x20 ,0x1 ,0x4e ,0xd ,0x4 ,0x41 ,0x0 ,0x20 ,0x6 ,0x6b ,0x21 ,0x9 ,0x20 ,0xa ,0x21 ,0x5 ,0x20 ,0xe ,0x21 ,0xa ,0x20 ,0x6 ,0x21 ,0xb ,0x20 ,0x6 ,0x20 ,0x3 ,0x4c ,0xd ,0x1 ,0xc ,0x4 ,0xb ,0xb ,0x41 ,0x7f ,0xf ,0xb ,0x20 ,0xc ,0x21 ,0x15 ,0xb ,0x2 ,0x40 ,0x20 ,0x14 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x2b ,0x47 ,0xd ,0x0 ,0x41 ,0x7f ,0x21 ,0x6 ,0x20 ,0x15 ,0x20 ,0xb ,0x46 ,0xd ,0x1 ,0xb ,0x41 ,0x7f ,0x20 ,0x15 ,0x20 ,0x9 ,0x41 ,0x0 ,0x48 ,0x1b ,0x20 ,0x15 ,0x20 ,0x1 ,0x20 ,0x10 ,0x4a ,0x1b ,0x20 ,0x15 ,0x20 ,0x15 ,0x20 ,0xb ,0x46 ,0x1b ,0xf ,0xb ,0x20 ,0x6 ,0xb ,0xef ,0x2 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x22 ,0x3 ,0x41 ,0xdb ,0x0 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x24 ,0x46 ,0xd ,0x1 ,0x20 ,0x3 ,0x41 ,0x2e ,0x46 ,0xd ,0x3 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xfc ,0x0 ,0x47 ,0xd ,0x0 ,0x41 ,0x7c ,0xf ,0xb ,0x20 ,0x3 ,0x41 ,0xdc ,0x0 ,0x47 ,0xd ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x1 ,0x22 ,0x3 ,0x41 ,0xf2 ,0x0 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xd3 ,0x0 ,0x46 ,0xd ,0x1 ,0x20 ,0x3 ,0x41 ,0xe4 ,0x0 ,0x47 ,0xd ,0x3 ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x41 ,0x50 ,0x6a ,0x41 ,0xa ,0x49 ,0xd ,0x6 ,0xc ,0x7 ,0xb ,0x20 ,0x3 ,0x41 ,0xf3 ,0x0 ,0x46 ,0xd ,0x1 ,0x20 ,0x3 ,0x41 ,0xf8 ,0x0 ,0x47 ,0xd ,0x2 ,0x20 ,0x0 ,0x2d ,0x0 ,0x2 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x0 ,0x2d ,0x0 ,0x3 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x50 ,0x6a ,0x22 ,0x4 ,0x20 ,0x0 ,0x41 ,0xa9 ,0x7f ,0x6a ,0x20 ,0x4 ,0x41 ,0xa ,0x49 ,0x1b ,0x20 ,0x3 ,0x41 ,0x50 ,0x6a ,0x22 ,0x0 ,0x20 ,0x3 ,0x41 ,0xa9 ,0xff ,0xff ,0xff ,0x0 ,0x6a ,0x20 ,0x0 ,0x41 ,0xa ,0x49 ,0x1b ,0x41 ,0x4 ,0x74 ,0x72 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x46 ,0xd ,0x5 ,0xc ,0x6 ,0xb ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x3 ,0x41 ,0x20 ,0x46 ,0xd ,0x5 ,0x20 ,0x3 ,0x41 ,0x72 ,0x6a ,0x41 ,0x7b ,0x49 ,0xd ,0x4 ,0xc ,0x5 ,0xb ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x22 ,0x3 ,0x41 ,0x20 ,0x46 ,0xd ,0x3 ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x72 ,0x6a ,0x41 ,0x7b ,0x4f ,0xd ,0x3 ,0xc ,0x4 ,0xb ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x46 ,0xd ,0x2 ,0xc ,0x3 ,0xb ,0x41 ,0x7f ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x2d ,0x0 ,0xf0 ,0x12 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x3 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x41 ,0x7f ,0x21 ,0x2 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x47 ,0xd ,0x1 ,0xb ,0x41 ,0x1 ,0x21 ,0x2 ,0xb ,0x20 ,0x2 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x17 ,0x0 ,0x20 ,0x0 ,0x41 ,0x50 ,0x6a ,0x41 ,0xa ,0x49 ,0x20 ,0x0 ,0x41 ,0x20 ,0x72 ,0x41 ,0x9f ,0x7f ,0x6a ,0x41 ,0x6 ,0x49 ,0x72 ,0xb ,0x13 ,0x0 ,0x20 ,0x0 ,0x41 ,0x20 ,0x72 ,0x20 ,0x0 ,0x20 ,0x0 ,0x41 ,0xbf ,0x7f ,0x6a ,0x41 ,0x1a ,0x49 ,0x1b ,0xb ,0xf2 ,0x2 ,0x1 ,0x3 ,0x7f ,0x20 ,0x2 ,0x41 ,0x0 ,0x47 ,0x21 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x47 ,0xd ,0x0 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x2 ,0x21 ,0x5 ,0xc ,0x3 ,0xb ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x5 ,0x45 ,0xd ,0x1 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x2 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x5 ,0x45 ,0xd ,0x1 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x2 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x22 ,0x4 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x5 ,0x45 ,0xd ,0x1 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x2 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x22 ,0x5 ,0x41 ,0x0 ,0x47 ,0x21 ,0x3 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x21 ,0x4 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x2 ,0x40 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x46 ,0xd ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x20 ,0x0 ,0x73 ,0x22 ,0x2 ,0x41 ,0x7f ,0x73 ,0x20 ,0x2 ,0x41 ,0xff ,0xfd ,0xfb ,0x77 ,0x6a ,0x71 ,0x41 ,0x80 ,0x81 ,0x82 ,0x84 ,0x78 ,0x71 ,0xd ,0x2 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x7c ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x2d ,0x0 ,0x0 ,0x20 ,0x2 ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0xf ,0xb ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x7f ,0x6a ,0x22 ,0x5 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0xb ,0xcc ,0x1 ,0x1 ,0x3 ,0x7f ,0x20 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x2d ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x0 ,0x6b ,0xf ,0xb ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x71 ,0xd ,0x1 ,0xb ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x41 ,0x7b ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x4 ,0x6a ,0x22 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x3 ,0x41 ,0x7f ,0x73 ,0x20 ,0x3 ,0x41 ,0xff ,0xfd ,0xfb ,0x77 ,0x6a ,0x71 ,0x41 ,0x80 ,0x81 ,0x82 ,0x84 ,0x78 ,0x71 ,0x45 ,0xd ,0x0 ,0xb ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x6b ,0xb ,0xb ,0x81 ,0x1 ,0x2 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x34 ,0x5e ,0x24 ,0x28 ,0x29 ,0x2e ,0x5b ,0x5d ,0x2a ,0x2b ,0x3f ,0x7c ,0x5c ,0x53 ,0x73 ,0x64 ,0x0 ,0x28 ,0x61 ,0x62 ,0x29 ,0x2b ,0x0 ,0x28 ,0x5b ,0x61 ,0x62 ,0x5e ,0x63 ,0x5d ,0x5b ,0x61 ,0x62 ,0x5e ,0x63 ,0x5d ,0x29 ,0x2b ,0x0 ,0x28 ,0x62 ,0x2e ,0x2b ,0x29 ,0x2b ,0x0 ,0x61 ,0x5b ,0x61 ,0x62 ,0x5d ,0x2a ,0x0 ,0x0 ,0x41 ,0xc0 ,0x8 ,0xb ,0x40 ,0x61 ,0x62 ,0x62 ,0x62 ,0x61 ,0x62 ,0x61 ,0x62 ,0x61 ,0x61 ,0x62 ,0x63 ,0x63 ,0x61 ,0x62 ,0x61 ,0x62 ,0x63 ,0x61 ,0x63 ,0x62 ,0x63 ,0x62 ,0x63 ,0x62 ,0x61 ,0x62 ,0x62 ,0x61 ,0x62 ,0x63 ,0x62 ,0x61 ,0x62 ,0x63 ,0x61 ,0x62 ,0x63 ,0x62 ,0x62 ,0x63 ,0x62 ,0x62 ,0x61 ,0x63 ,0x0 ,0x0 ,0x0 ,0x10 ,0x4 ,0x0 ,0x0 ,0x26 ,0x4 ,0x0 ,0x0 ,0x2d ,0x4 ,0x0 ,0x0 ,0x16 ,0x4 ,0x0 ,0x0};
-
-static uint8_t statemate[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x1a ,0x5 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x12 ,0x11 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x3 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x90 ,0x87 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0x81 ,0xa ,0xb ,0x7f ,0x0 ,0x41 ,0x90 ,0x87 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xd ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xeb ,0x3f ,0x11 ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xd2 ,0x2 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x36 ,0x2 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x96 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xdc ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xdc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xe4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xec ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xec ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf4 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xfc ,0x88 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0xb ,0x9d ,0x9 ,0x1 ,0x4 ,0x7f ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9a ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x3 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x72 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x99 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0x9a ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x4 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x72 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9d ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0x9e ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x3 ,0x20 ,0x3 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x3 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x45 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x41 ,0x0 ,0x47 ,0x71 ,0x22 ,0x1 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0xd ,0x0 ,0x20 ,0x3 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x20 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x1 ,0x20 ,0x2 ,0x72 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x1 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0xb ,0xe5 ,0x15 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9d ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9e ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9a ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa3 ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x9b ,0x88 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x3 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3b ,0x47 ,0xd ,0x3 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3b ,0x46 ,0xd ,0x3 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xec ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x3 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x5 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x4 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x3 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3d ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x3c ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xad ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xae ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x47 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0x71 ,0x22 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xdc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x47 ,0x71 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x3 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x95 ,0x3 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x7 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x7 ,0xb ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x5 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x4a ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8f ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa7 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa6 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x7 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xb6 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x7 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x6 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xb6 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa7 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xf0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa7 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa6 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x6 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xb7 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xb7 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa7 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xf4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0xc ,0x6 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x5 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x5 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8f ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x5 ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x4 ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8f ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8f ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x2 ,0x20 ,0x0 ,0x41 ,0x94 ,0x3 ,0x4a ,0xd ,0x2 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x89 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1 ,0x6b ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x72 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x89 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x8a ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x47 ,0xd ,0x3 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x45 ,0xd ,0x3 ,0x41 ,0x0 ,0x28 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x47 ,0xd ,0x3 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x3 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x3 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x1 ,0x48 ,0xd ,0x3 ,0x41 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x36 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x89 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8a ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x95 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x96 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x97 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0xb ,0xd5 ,0x1 ,0x1 ,0x1 ,0x7f ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x91 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x4 ,0x41 ,0x0 ,0x2d ,0x0 ,0xba ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x4 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x5 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x2 ,0x21 ,0x0 ,0xc ,0x3 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xa8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x3 ,0x41 ,0x0 ,0x2d ,0x0 ,0xba ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x3 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x1 ,0x21 ,0x0 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0x91 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0xb ,0x8e ,0x4 ,0x1 ,0x1 ,0x7f ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa3 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa5 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x2 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x41 ,0x1 ,0x48 ,0xd ,0x2 ,0x20 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x2 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x36 ,0x2 ,0xc8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xc4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf8 ,0x88 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xcc ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xcd ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x4 ,0x0 ,0x1 ,0x2 ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7e ,0x6a ,0x4c ,0xd ,0x3 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xc4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb ,0x47 ,0xd ,0x2 ,0x41 ,0x0 ,0x28 ,0x2 ,0xfc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb ,0x46 ,0xd ,0x2 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x2 ,0x36 ,0x2 ,0xc8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0xb ,0xc2 ,0x11 ,0x1 ,0x6 ,0x7f ,0x41 ,0x0 ,0x41 ,0x1 ,0x36 ,0x2 ,0xd0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0xb8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3 ,0x40 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1 ,0x6a ,0x3a ,0x0 ,0xb8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x2 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x90 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x3 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x3 ,0x41 ,0x2 ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xcf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x2 ,0xc ,0x3 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xcf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0x1 ,0x41 ,0x9c ,0x7f ,0x21 ,0x0 ,0xc ,0x2 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x2 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x2 ,0x41 ,0x3 ,0x21 ,0x1 ,0x41 ,0xe4 ,0x0 ,0x21 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0xd ,0x1 ,0x41 ,0x2 ,0x21 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xd0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x90 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9a ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x3 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x9b ,0x88 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x91 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa3 ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9d ,0x88 ,0x80 ,0x80 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x41 ,0x80 ,0x2 ,0x3b ,0x1 ,0x94 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x2 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x89 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x8a ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x96 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x9b ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x1 ,0x3a ,0x0 ,0x9e ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd6 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd7 ,0x89 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xda ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xdb ,0x89 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xd6 ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xdc ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xdd ,0x89 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x2d ,0x0 ,0xdf ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x46 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0xff ,0x1 ,0x71 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xdc ,0x89 ,0x80 ,0x80 ,0x0 ,0xb ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9a ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9d ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa2 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa5 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xa3 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xec ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x89 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xec ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x89 ,0x80 ,0x80 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xec ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x89 ,0x80 ,0x80 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xbc ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x36 ,0x2 ,0xe4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xb9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x1 ,0x3a ,0x0 ,0xe8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xec ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xf0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9b ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x3a ,0x0 ,0xe1 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x94 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x3 ,0x3a ,0x0 ,0xde ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9c ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x3a ,0x0 ,0xe2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x95 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x3a ,0x0 ,0xd9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9f ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xf2 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9a ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9b ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xc0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xf8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x5 ,0x3a ,0x0 ,0x9a ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x3a ,0x0 ,0x9e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x3 ,0x3a ,0x0 ,0x99 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x2 ,0x3a ,0x0 ,0x9d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x9d ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0x9e ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xa1 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xa3 ,0x88 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xa4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xa4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xd0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xf8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xfc ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xba ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0xfc ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xc4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xa8 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xa9 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x97 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xab ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xb4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x98 ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xac ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xb5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xaa ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xcd ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xaf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xcc ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xdc ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xdd ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xd6 ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xd7 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xda ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xdb ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xdf ,0x89 ,0x80 ,0x80 ,0x0 ,0x3a ,0x0 ,0xe0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xfd ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xf3 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xfe ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0xff ,0x89 ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xce ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xcf ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x22 ,0x0 ,0x3a ,0x0 ,0xd4 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x3a ,0x0 ,0xd5 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x2d ,0x0 ,0x96 ,0x89 ,0x80 ,0x80 ,0x0 ,0x45 ,0xd ,0x0 ,0xb ,0xb ,0xa6 ,0x2 ,0x1 ,0x2 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x1 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0xc0 ,0x0 ,0x10 ,0x90 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xd8 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xd4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x84 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x85 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x86 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x87 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x88 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x89 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8a ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8b ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8c ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8d ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8e ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x8f ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x90 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x91 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x92 ,0x89 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x3a ,0x0 ,0x93 ,0x89 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xf ,0x0 ,0x41 ,0x82 ,0x1a ,0x41 ,0x1 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8f ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x8b ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb};
-
-static uint8_t tarfind[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x23 ,0x7 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x10 ,0xf ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x1 ,0x2 ,0x3 ,0x4 ,0x5 ,0x0 ,0x2 ,0x0 ,0x0 ,0x6 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0xc0 ,0xcb ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xb8 ,0xce ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xc0 ,0xcb ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0xb ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xa3 ,0x9 ,0xf ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x8c ,0x3 ,0x1 ,0xd ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0x84 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0xa4 ,0xc6 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x5 ,0x21 ,0x4 ,0x41 ,0xa3 ,0xc6 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x5 ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x41 ,0x0 ,0x21 ,0x8 ,0x20 ,0x5 ,0x20 ,0x7 ,0x41 ,0x81 ,0x2 ,0x6c ,0x6a ,0x41 ,0x0 ,0x41 ,0x81 ,0x2 ,0x10 ,0x8e ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x9 ,0x41 ,0x30 ,0x3a ,0x0 ,0x9c ,0x1 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x8 ,0x6a ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x1a ,0x6f ,0x41 ,0xc1 ,0x0 ,0x6a ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x8 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x9 ,0x41 ,0x30 ,0x3a ,0x0 ,0x7c ,0x20 ,0x6 ,0x41 ,0x81 ,0x2 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x41 ,0x23 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x21 ,0xa ,0x20 ,0x5 ,0x41 ,0x91 ,0x22 ,0x6a ,0x21 ,0xb ,0x41 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0xd ,0x3 ,0x40 ,0x20 ,0xb ,0x20 ,0xc ,0x41 ,0x81 ,0x2 ,0x6c ,0x6a ,0x21 ,0xe ,0x20 ,0xa ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0x7 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0xe ,0x21 ,0x8 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x7 ,0x41 ,0x81 ,0x2 ,0x6c ,0x6a ,0x2d ,0x0 ,0x0 ,0x22 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x9 ,0x21 ,0x6 ,0x20 ,0xe ,0x21 ,0x8 ,0x3 ,0x40 ,0x20 ,0x4 ,0x41 ,0xff ,0x1 ,0x71 ,0x20 ,0x8 ,0x2d ,0x0 ,0x0 ,0x47 ,0xd ,0x2 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x21 ,0x8 ,0x20 ,0x6 ,0x2d ,0x0 ,0x0 ,0x21 ,0x4 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x8 ,0x2d ,0x0 ,0x0 ,0x45 ,0xd ,0x2 ,0xb ,0x20 ,0x9 ,0x41 ,0x81 ,0x2 ,0x6a ,0x21 ,0x9 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x22 ,0x7 ,0x41 ,0x23 ,0x47 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0xd ,0x41 ,0x1 ,0x6a ,0x21 ,0xd ,0xb ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x22 ,0xc ,0x41 ,0x5 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0xd ,0x41 ,0x5 ,0x46 ,0xb ,0xc ,0x0 ,0x41 ,0x2e ,0x41 ,0x1 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x8c ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x30 ,0x1 ,0x1 ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa8 ,0xce ,0x80 ,0x80 ,0x0 ,0x41 ,0xed ,0x9c ,0x99 ,0x8e ,0x4 ,0x6c ,0x41 ,0xb9 ,0xe0 ,0x0 ,0x6a ,0x41 ,0xff ,0xff ,0xff ,0xff ,0x7 ,0x71 ,0x22 ,0x0 ,0x36 ,0x2 ,0xa8 ,0xce ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x10 ,0x76 ,0xb ,0x36 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0xc ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xac ,0xce ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x6a ,0x36 ,0x2 ,0xb0 ,0xce ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xb4 ,0xce ,0x80 ,0x80 ,0x0 ,0xb ,0x6e ,0x1 ,0x3 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0xf ,0xb ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb4 ,0xce ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x6a ,0x41 ,0x4 ,0x41 ,0x0 ,0x28 ,0x2 ,0xac ,0xce ,0x80 ,0x80 ,0x0 ,0x22 ,0x2 ,0x20 ,0x0 ,0x6a ,0x22 ,0x0 ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x3 ,0x1b ,0x22 ,0x3 ,0x6a ,0x36 ,0x2 ,0xb4 ,0xce ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x6a ,0x22 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xb0 ,0xce ,0x80 ,0x80 ,0x0 ,0x4b ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xac ,0xce ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x21 ,0x1 ,0xb ,0x20 ,0x1 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x96 ,0x3 ,0x2 ,0x3 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x7f ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x6b ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x41 ,0xff ,0x1 ,0x71 ,0x41 ,0x81 ,0x82 ,0x84 ,0x8 ,0x6c ,0x22 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2 ,0x20 ,0x4 ,0x6b ,0x41 ,0x7c ,0x71 ,0x22 ,0x4 ,0x6a ,0x22 ,0x2 ,0x41 ,0x7c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x9 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x78 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x74 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x19 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x6c ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x68 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x64 ,0x6a ,0x20 ,0x1 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x41 ,0x18 ,0x72 ,0x22 ,0x5 ,0x6b ,0x22 ,0x2 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x21 ,0x6 ,0x20 ,0x3 ,0x20 ,0x5 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x1 ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x6 ,0x37 ,0x3 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x60 ,0x6a ,0x22 ,0x2 ,0x41 ,0x1f ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb};
-
-static uint8_t ud[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0xe ,0x3 ,0x60 ,0x0 ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x3 ,0xc ,0xb ,0x0 ,0x0 ,0x0 ,0x1 ,0x1 ,0x2 ,0x1 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0x80 ,0x93 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xf4 ,0x15 ,0xb ,0x7f ,0x0 ,0x41 ,0x80 ,0x93 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x8 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xa1 ,0x9 ,0xb ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xd1 ,0x1 ,0x1 ,0x9 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x7 ,0x20 ,0x4 ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x8 ,0x20 ,0x5 ,0x20 ,0x9 ,0x6a ,0x41 ,0x2 ,0x6a ,0x20 ,0x5 ,0x20 ,0x9 ,0x46 ,0x74 ,0x22 ,0xa ,0x36 ,0x2 ,0x0 ,0x20 ,0xa ,0x20 ,0x7 ,0x6a ,0x21 ,0x7 ,0x20 ,0x8 ,0x41 ,0x4 ,0x6a ,0x21 ,0x8 ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x22 ,0x9 ,0x41 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x41 ,0x2 ,0x74 ,0x41 ,0xa0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0x7 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0x4 ,0x20 ,0x6 ,0x21 ,0x5 ,0x20 ,0x6 ,0x41 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x9 ,0x41 ,0x5 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x41 ,0x0 ,0x41 ,0x0 ,0x36 ,0x2 ,0xf0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x41 ,0x0 ,0x28 ,0x2 ,0xf0 ,0x95 ,0x80 ,0x80 ,0x0 ,0xb ,0xa8 ,0x6 ,0x1 ,0x10 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x3 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x41 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x41 ,0xe4 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x5 ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x6 ,0x41 ,0x1 ,0x21 ,0x7 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x0 ,0xc ,0x1 ,0xb ,0x3 ,0x40 ,0x20 ,0x3 ,0x22 ,0x8 ,0x41 ,0xd0 ,0x0 ,0x6c ,0x20 ,0x8 ,0x41 ,0x2 ,0x74 ,0x22 ,0x9 ,0x6a ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0xa ,0x20 ,0x4 ,0x21 ,0xb ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0xc ,0x41 ,0xd0 ,0x0 ,0x6c ,0x20 ,0x9 ,0x6a ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0xd ,0x28 ,0x2 ,0x0 ,0x21 ,0xe ,0x2 ,0x40 ,0x20 ,0x8 ,0x45 ,0xd ,0x0 ,0x20 ,0x6 ,0x21 ,0xf ,0x20 ,0xb ,0x21 ,0x10 ,0x20 ,0x8 ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0xe ,0x20 ,0xf ,0x28 ,0x2 ,0x0 ,0x20 ,0x10 ,0x28 ,0x2 ,0x0 ,0x6c ,0x6b ,0x21 ,0xe ,0x20 ,0xf ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0xf ,0x20 ,0x10 ,0x41 ,0x4 ,0x6a ,0x21 ,0x10 ,0x20 ,0x11 ,0x41 ,0x7f ,0x6a ,0x22 ,0x11 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xd ,0x20 ,0xe ,0x20 ,0xa ,0x28 ,0x2 ,0x0 ,0x6d ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0xb ,0x20 ,0xc ,0x20 ,0x1 ,0x47 ,0x21 ,0xf ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x21 ,0xc ,0x20 ,0xf ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x21 ,0xb ,0x20 ,0x3 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x3 ,0x41 ,0xd0 ,0x0 ,0x6c ,0x20 ,0xc ,0x41 ,0x2 ,0x74 ,0x6a ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0xd ,0x28 ,0x2 ,0x0 ,0x21 ,0xe ,0x20 ,0xb ,0x21 ,0xf ,0x20 ,0x4 ,0x21 ,0x10 ,0x20 ,0x7 ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0xe ,0x20 ,0xf ,0x28 ,0x2 ,0x0 ,0x20 ,0x10 ,0x28 ,0x2 ,0x0 ,0x6c ,0x6b ,0x21 ,0xe ,0x20 ,0xf ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0xf ,0x20 ,0x10 ,0x41 ,0x4 ,0x6a ,0x21 ,0x10 ,0x20 ,0x11 ,0x41 ,0x7f ,0x6a ,0x22 ,0x11 ,0xd ,0x0 ,0xb ,0x20 ,0xd ,0x20 ,0xe ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x41 ,0x4 ,0x6a ,0x21 ,0xb ,0x20 ,0xc ,0x20 ,0x1 ,0x46 ,0x21 ,0xf ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x21 ,0xc ,0x20 ,0xf ,0x45 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x6 ,0x41 ,0x4 ,0x6a ,0x21 ,0x6 ,0x20 ,0x4 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0x4 ,0x20 ,0x7 ,0x41 ,0x1 ,0x6a ,0x21 ,0x7 ,0x20 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x0 ,0x28 ,0x2 ,0xa0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0x0 ,0x41 ,0xb0 ,0x89 ,0x80 ,0x80 ,0x0 ,0x21 ,0xb ,0x41 ,0x1 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0xc ,0x41 ,0x2 ,0x74 ,0x22 ,0xd ,0x41 ,0xa0 ,0x95 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0xe ,0x20 ,0x2 ,0x21 ,0xf ,0x20 ,0xb ,0x21 ,0x10 ,0x20 ,0xc ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0xe ,0x20 ,0xf ,0x28 ,0x2 ,0x0 ,0x20 ,0x10 ,0x28 ,0x2 ,0x0 ,0x6c ,0x6b ,0x21 ,0xe ,0x20 ,0x10 ,0x41 ,0x4 ,0x6a ,0x21 ,0x10 ,0x20 ,0xf ,0x41 ,0x4 ,0x6a ,0x21 ,0xf ,0x20 ,0x11 ,0x41 ,0x7f ,0x6a ,0x22 ,0x11 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x20 ,0xd ,0x6a ,0x20 ,0xe ,0x36 ,0x2 ,0x0 ,0x20 ,0xb ,0x41 ,0xd0 ,0x0 ,0x6a ,0x21 ,0xb ,0x20 ,0xc ,0x20 ,0x1 ,0x47 ,0x21 ,0xf ,0x20 ,0xc ,0x41 ,0x1 ,0x6a ,0x21 ,0xc ,0x20 ,0xf ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x41 ,0x2 ,0x74 ,0x22 ,0xf ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x22 ,0x8 ,0x20 ,0x2 ,0x20 ,0xf ,0x6a ,0x28 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0xd0 ,0x0 ,0x6c ,0x20 ,0xf ,0x6a ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6d ,0x36 ,0x2 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0xd4 ,0x0 ,0x6c ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0x3 ,0x41 ,0x1 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0xc ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0xc ,0x41 ,0x7f ,0x6a ,0x22 ,0xb ,0x41 ,0x2 ,0x74 ,0x22 ,0xd ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0xe ,0x2 ,0x40 ,0x20 ,0xc ,0x20 ,0x1 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0xf ,0x20 ,0x8 ,0x21 ,0x10 ,0x20 ,0x4 ,0x21 ,0x11 ,0x3 ,0x40 ,0x20 ,0xe ,0x20 ,0x10 ,0x28 ,0x2 ,0x0 ,0x20 ,0xf ,0x28 ,0x2 ,0x0 ,0x6c ,0x6b ,0x21 ,0xe ,0x20 ,0xf ,0x41 ,0x4 ,0x6a ,0x21 ,0xf ,0x20 ,0x10 ,0x41 ,0x4 ,0x6a ,0x21 ,0x10 ,0x20 ,0x11 ,0x41 ,0x7f ,0x6a ,0x22 ,0x11 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xd ,0x41 ,0x90 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x20 ,0xe ,0x20 ,0xb ,0x41 ,0xd0 ,0x0 ,0x6c ,0x20 ,0xd ,0x6a ,0x41 ,0xe0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6d ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xac ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x8 ,0x41 ,0x7c ,0x6a ,0x21 ,0x8 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0xc ,0x41 ,0x1 ,0x4a ,0x21 ,0xf ,0x20 ,0xb ,0x21 ,0xc ,0x20 ,0xf ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x90 ,0x3 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0xd ,0x0 ,0x41 ,0xf9 ,0xd ,0x41 ,0x1 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb};
-
-static uint8_t wikisort[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3e ,0xa ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x0 ,0x60 ,0x4 ,0x7f ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x5 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x7 ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x7f ,0x0 ,0x60 ,0x2 ,0x7f ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x3 ,0x7f ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0x1f ,0x1e ,0x1 ,0x1 ,0x0 ,0x2 ,0x2 ,0x3 ,0x4 ,0x5 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x6 ,0x7 ,0x0 ,0x7 ,0x8 ,0x1 ,0x7 ,0x1 ,0x1 ,0x9 ,0x9 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0xb ,0xb ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xd0 ,0x9e ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xc4 ,0x21 ,0xb ,0x7f ,0x0 ,0x41 ,0xd0 ,0x9e ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x19 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0x9 ,0x10 ,0x1 ,0x0 ,0x41 ,0x1 ,0xb ,0xa ,0x2 ,0x9 ,0xa ,0xb ,0xc ,0xd ,0xe ,0xf ,0x10 ,0x11 ,0xa ,0xa1 ,0x50 ,0x1e ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xd ,0x0 ,0x20 ,0x0 ,0x28 ,0x2 ,0x0 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x48 ,0xb ,0xdc ,0x1 ,0x1 ,0x6 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x6b ,0x22 ,0x4 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0x4e ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x20 ,0x5 ,0x6b ,0x41 ,0x2 ,0x6d ,0x20 ,0x5 ,0x6a ,0x22 ,0x8 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x18 ,0x20 ,0x4 ,0x20 ,0x7 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x10 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x3 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x22 ,0x9 ,0x1b ,0x22 ,0x5 ,0x20 ,0x2 ,0x20 ,0x8 ,0x20 ,0x9 ,0x1b ,0x22 ,0x2 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x6 ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x8 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x6 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x4 ,0x20 ,0x3 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x41 ,0x0 ,0x47 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0xb ,0xda ,0x1 ,0x1 ,0x6 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x6b ,0x22 ,0x4 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x6 ,0x4e ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x7 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x18 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x20 ,0x5 ,0x6b ,0x41 ,0x2 ,0x6d ,0x20 ,0x5 ,0x6a ,0x22 ,0x8 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x10 ,0x20 ,0x5 ,0x20 ,0x8 ,0x41 ,0x1 ,0x6a ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x3 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x22 ,0x9 ,0x1b ,0x22 ,0x5 ,0x20 ,0x8 ,0x20 ,0x2 ,0x20 ,0x9 ,0x1b ,0x22 ,0x2 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x6 ,0x47 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x8 ,0x20 ,0x4 ,0x20 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x6 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x4 ,0x20 ,0x3 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x5 ,0xb ,0xed ,0x1 ,0x3 ,0x5 ,0x7f ,0x1 ,0x7e ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x6b ,0x22 ,0x3 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x22 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x1 ,0x28 ,0x2 ,0x4 ,0x22 ,0x6 ,0x4e ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x22 ,0x8 ,0x37 ,0x3 ,0x18 ,0x20 ,0x5 ,0x21 ,0x9 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x4 ,0x4c ,0xd ,0x0 ,0x20 ,0x7 ,0x21 ,0x1 ,0x20 ,0x5 ,0x21 ,0x9 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x18 ,0x37 ,0x3 ,0x10 ,0x20 ,0x3 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x8 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x9 ,0x41 ,0x7f ,0x6a ,0x22 ,0x9 ,0x20 ,0x4 ,0x4a ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x21 ,0x9 ,0xb ,0x20 ,0x3 ,0x29 ,0x3 ,0x18 ,0x21 ,0x8 ,0xb ,0x20 ,0x0 ,0x20 ,0x9 ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x8 ,0x37 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x21 ,0x7 ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x20 ,0x6 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x20 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x9e ,0x4 ,0x2 ,0x4 ,0x7f ,0x1 ,0x7e ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x22 ,0x5 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x6 ,0x46 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x20 ,0x6 ,0x20 ,0x1 ,0x41 ,0x0 ,0x48 ,0x1b ,0x20 ,0x1 ,0x6a ,0x22 ,0x7 ,0x20 ,0x6 ,0x6b ,0x22 ,0x2 ,0x20 ,0x5 ,0x20 ,0x7 ,0x6b ,0x22 ,0x8 ,0x4a ,0xd ,0x0 ,0x20 ,0x2 ,0x20 ,0x4 ,0x4a ,0xd ,0x1 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x1 ,0x20 ,0x2 ,0x41 ,0x3 ,0x74 ,0x22 ,0x2 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x7 ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x8 ,0x41 ,0x3 ,0x74 ,0x22 ,0x6 ,0x10 ,0x9d ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x6 ,0x6a ,0x20 ,0x4 ,0x20 ,0x2 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xf ,0xb ,0x20 ,0x8 ,0x20 ,0x4 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x7 ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x8 ,0x41 ,0x3 ,0x74 ,0x22 ,0x1 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x20 ,0x0 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6b ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x6 ,0x20 ,0x2 ,0x41 ,0x3 ,0x74 ,0x10 ,0x9d ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x6 ,0x20 ,0x4 ,0x20 ,0x1 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xf ,0xb ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x7 ,0x20 ,0x2 ,0x41 ,0x1 ,0x76 ,0x22 ,0x4 ,0x6b ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x0 ,0x6a ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x21 ,0x9 ,0x20 ,0x1 ,0x20 ,0x2 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x9 ,0x37 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0x41 ,0x1 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x20 ,0x6 ,0x6b ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x8 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x3 ,0x74 ,0x20 ,0x8 ,0x41 ,0x1 ,0x76 ,0x22 ,0x4 ,0x41 ,0x3 ,0x74 ,0x22 ,0x1 ,0x6b ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x20 ,0x7 ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0x0 ,0x6a ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x21 ,0x9 ,0x20 ,0x1 ,0x20 ,0x2 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x9 ,0x37 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0x41 ,0x1 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x2 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x3 ,0x74 ,0x20 ,0x3 ,0x41 ,0x1 ,0x76 ,0x22 ,0x4 ,0x41 ,0x3 ,0x74 ,0x22 ,0x1 ,0x6b ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x20 ,0x1 ,0x6a ,0x20 ,0x0 ,0x6a ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x21 ,0x9 ,0x20 ,0x1 ,0x20 ,0x2 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x9 ,0x37 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x78 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0x41 ,0x1 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0xb ,0x8e ,0x5 ,0x2 ,0xb ,0x7f ,0x1 ,0x7e ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x6b ,0x22 ,0x7 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x28 ,0x2 ,0x4 ,0x22 ,0x8 ,0x20 ,0x2 ,0x28 ,0x2 ,0x0 ,0x22 ,0x9 ,0x6b ,0x22 ,0xa ,0x20 ,0x6 ,0x4a ,0xd ,0x0 ,0x20 ,0x5 ,0x20 ,0xa ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0xb ,0x20 ,0x0 ,0x20 ,0x9 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x6 ,0x2 ,0x40 ,0x20 ,0xa ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x3 ,0x28 ,0x2 ,0x4 ,0x22 ,0x2 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x4c ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0xa ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x6 ,0x21 ,0x2 ,0x20 ,0x7 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x18 ,0x20 ,0x7 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x10 ,0x2 ,0x40 ,0x20 ,0x7 ,0x41 ,0x18 ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x20 ,0x4 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x6 ,0x20 ,0x2 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x22 ,0x5 ,0x20 ,0xb ,0x47 ,0xd ,0x1 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x6 ,0x20 ,0xb ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x20 ,0x1 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x6 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x22 ,0x1 ,0x20 ,0xa ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x6 ,0xb ,0x20 ,0x6 ,0x20 ,0x5 ,0x20 ,0xb ,0x20 ,0x5 ,0x6b ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xa ,0x41 ,0x1 ,0x4e ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x6 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x6 ,0x20 ,0x3 ,0x28 ,0x2 ,0x4 ,0x20 ,0x3 ,0x28 ,0x2 ,0x0 ,0x22 ,0x5 ,0x6b ,0x22 ,0xd ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0xc ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0xe ,0x20 ,0x0 ,0x20 ,0x9 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0xf ,0x20 ,0x0 ,0x20 ,0x5 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x10 ,0x41 ,0x0 ,0x21 ,0x11 ,0x41 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0xb ,0x20 ,0xe ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x5 ,0x20 ,0xf ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x2 ,0x20 ,0x10 ,0x20 ,0x11 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x3 ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0xb ,0x21 ,0x1 ,0x20 ,0x7 ,0x20 ,0x3 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x8 ,0x20 ,0x7 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x0 ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x20 ,0x4 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x21 ,0xb ,0x20 ,0x2 ,0x29 ,0x2 ,0x0 ,0x21 ,0x12 ,0x20 ,0xb ,0xd ,0x1 ,0x20 ,0x2 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x20 ,0x12 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0xb ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x20 ,0xa ,0x48 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x20 ,0x2 ,0x20 ,0x3 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x12 ,0x37 ,0x2 ,0x0 ,0x20 ,0x11 ,0x41 ,0x1 ,0x6a ,0x22 ,0x11 ,0x20 ,0xd ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xa ,0x20 ,0x6 ,0x6b ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x6 ,0x41 ,0x3 ,0x74 ,0x20 ,0xc ,0x41 ,0x3 ,0x74 ,0x6a ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x74 ,0x20 ,0x9 ,0x41 ,0x3 ,0x74 ,0x6a ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x20 ,0x9 ,0x6a ,0x20 ,0x8 ,0x6b ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x21 ,0x12 ,0x20 ,0x5 ,0x20 ,0x2 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x2 ,0x20 ,0x12 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x2 ,0x41 ,0x8 ,0x6a ,0x21 ,0x2 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x7 ,0x41 ,0x20 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x97 ,0x28 ,0x8 ,0xc ,0x7f ,0x1 ,0x7c ,0x12 ,0x7f ,0x1 ,0x7e ,0x10 ,0x7f ,0x1 ,0x7e ,0x3 ,0x7f ,0x1 ,0x7e ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0x25 ,0x6b ,0x22 ,0x3 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x20 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x1 ,0x36 ,0x2 ,0xac ,0x5 ,0x20 ,0x3 ,0x41 ,0x0 ,0x36 ,0x2 ,0xa8 ,0x5 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xa8 ,0x5 ,0x37 ,0x3 ,0x8 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x20 ,0x1 ,0x20 ,0x1 ,0x41 ,0x1 ,0x76 ,0x20 ,0x1 ,0x72 ,0x22 ,0x4 ,0x41 ,0x2 ,0x76 ,0x20 ,0x4 ,0x72 ,0x22 ,0x4 ,0x41 ,0x4 ,0x76 ,0x20 ,0x4 ,0x72 ,0x22 ,0x4 ,0x41 ,0x8 ,0x76 ,0x20 ,0x4 ,0x72 ,0x22 ,0x4 ,0x41 ,0x10 ,0x76 ,0x20 ,0x4 ,0x72 ,0x22 ,0x4 ,0x20 ,0x4 ,0x41 ,0x1 ,0x76 ,0x6b ,0x22 ,0x5 ,0x41 ,0x10 ,0x6d ,0x22 ,0x6 ,0x6d ,0x22 ,0x7 ,0x20 ,0x6 ,0x6c ,0x6b ,0x21 ,0x8 ,0x41 ,0x0 ,0x21 ,0x9 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x36 ,0x2 ,0xa0 ,0x5 ,0x20 ,0x3 ,0x20 ,0x4 ,0x20 ,0x7 ,0x6a ,0x20 ,0x9 ,0x20 ,0x8 ,0x6a ,0x22 ,0x9 ,0x20 ,0x6 ,0x4e ,0x22 ,0xa ,0x6a ,0x22 ,0x4 ,0x36 ,0x2 ,0xa4 ,0x5 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xa0 ,0x5 ,0x37 ,0x3 ,0x90 ,0x4 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0x90 ,0x4 ,0x6a ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x9 ,0x20 ,0x6 ,0x41 ,0x0 ,0x20 ,0xa ,0x1b ,0x6b ,0x21 ,0x9 ,0x20 ,0x4 ,0x20 ,0x1 ,0x48 ,0xd ,0x0 ,0xb ,0x20 ,0x5 ,0x41 ,0x11 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x41 ,0x8 ,0x6a ,0x21 ,0xb ,0x20 ,0x0 ,0x41 ,0x70 ,0x6a ,0x21 ,0xc ,0x20 ,0x0 ,0x41 ,0x78 ,0x6a ,0x21 ,0xd ,0x41 ,0x10 ,0x21 ,0xe ,0x3 ,0x40 ,0x20 ,0x3 ,0x42 ,0x0 ,0x37 ,0x3 ,0x98 ,0x5 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x7 ,0xb7 ,0x9f ,0x22 ,0xf ,0x99 ,0x44 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe0 ,0x41 ,0x63 ,0x45 ,0xd ,0x0 ,0x20 ,0xf ,0xaa ,0x21 ,0x10 ,0xc ,0x1 ,0xb ,0x41 ,0x80 ,0x80 ,0x80 ,0x80 ,0x78 ,0x21 ,0x10 ,0xb ,0x20 ,0x7 ,0x41 ,0x7f ,0x6a ,0x21 ,0x11 ,0x20 ,0x7 ,0x41 ,0x1 ,0x74 ,0x22 ,0x12 ,0x41 ,0x7f ,0x6a ,0x21 ,0x13 ,0x20 ,0xc ,0x20 ,0x7 ,0x41 ,0x4 ,0x74 ,0x6a ,0x21 ,0x14 ,0x20 ,0x10 ,0x41 ,0x3 ,0x74 ,0x21 ,0x15 ,0x20 ,0xb ,0x20 ,0x10 ,0x41 ,0x4 ,0x74 ,0x6a ,0x21 ,0x16 ,0x20 ,0x7 ,0x20 ,0x10 ,0x6d ,0x22 ,0x17 ,0x41 ,0x1 ,0x6a ,0x22 ,0x18 ,0x41 ,0x1 ,0x74 ,0x21 ,0x19 ,0x41 ,0x0 ,0x21 ,0x4 ,0x20 ,0x10 ,0x41 ,0x81 ,0x4 ,0x48 ,0x21 ,0x1a ,0x41 ,0x0 ,0x21 ,0x1b ,0x41 ,0x0 ,0x21 ,0x1c ,0x41 ,0x0 ,0x21 ,0x1d ,0x41 ,0x0 ,0x21 ,0x1e ,0x41 ,0x0 ,0x21 ,0x1f ,0x41 ,0x0 ,0x21 ,0x20 ,0x41 ,0x0 ,0x21 ,0x21 ,0x42 ,0x0 ,0x21 ,0x22 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0xd ,0x20 ,0x1b ,0x22 ,0x23 ,0x20 ,0x7 ,0x6a ,0x20 ,0x4 ,0x20 ,0x8 ,0x6a ,0x22 ,0x4 ,0x20 ,0x6 ,0x4e ,0x22 ,0xa ,0x6a ,0x22 ,0x24 ,0x20 ,0x7 ,0x6a ,0x20 ,0x4 ,0x20 ,0x6 ,0x41 ,0x0 ,0x20 ,0xa ,0x1b ,0x6b ,0x20 ,0x8 ,0x6a ,0x22 ,0x25 ,0x20 ,0x6 ,0x4e ,0x22 ,0x26 ,0x6a ,0x22 ,0x1b ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x88 ,0x4 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x23 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x80 ,0x4 ,0x20 ,0x6 ,0x41 ,0x0 ,0x20 ,0x26 ,0x1b ,0x21 ,0x27 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x88 ,0x4 ,0x6a ,0x20 ,0x3 ,0x41 ,0x80 ,0x4 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x1b ,0x36 ,0x2 ,0x94 ,0x5 ,0x20 ,0x3 ,0x20 ,0x23 ,0x36 ,0x2 ,0x90 ,0x5 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0x90 ,0x5 ,0x37 ,0x3 ,0xf8 ,0x3 ,0x20 ,0x0 ,0x20 ,0x24 ,0x20 ,0x23 ,0x6b ,0x20 ,0x3 ,0x41 ,0xf8 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x24 ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x28 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x28 ,0x41 ,0x78 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xe8 ,0x3 ,0x20 ,0x3 ,0x41 ,0xf0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xe8 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x24 ,0x36 ,0x2 ,0xec ,0x4 ,0x20 ,0x3 ,0x20 ,0x23 ,0x36 ,0x2 ,0xe8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x1b ,0x36 ,0x2 ,0xe4 ,0x4 ,0x20 ,0x3 ,0x20 ,0x24 ,0x36 ,0x2 ,0xe0 ,0x4 ,0x2 ,0x40 ,0x20 ,0x24 ,0x20 ,0x23 ,0x6b ,0x22 ,0x28 ,0x41 ,0x80 ,0x4 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x20 ,0x4 ,0x20 ,0x28 ,0x41 ,0x3 ,0x74 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x3 ,0x42 ,0x0 ,0x37 ,0x3 ,0x58 ,0x20 ,0x3 ,0x42 ,0x0 ,0x37 ,0x2 ,0xd8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0xe8 ,0x4 ,0x37 ,0x3 ,0x50 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xe0 ,0x4 ,0x37 ,0x3 ,0x48 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0xd8 ,0x0 ,0x6a ,0x20 ,0x3 ,0x41 ,0xd0 ,0x0 ,0x6a ,0x20 ,0x3 ,0x41 ,0xc8 ,0x0 ,0x6a ,0x20 ,0x2 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1c ,0x20 ,0x1d ,0x4a ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0x29 ,0x2 ,0x40 ,0x20 ,0x23 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2a ,0x20 ,0x24 ,0x4e ,0xd ,0x0 ,0x20 ,0x11 ,0x20 ,0xa ,0x6a ,0x21 ,0x2b ,0x41 ,0x1 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xe0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd8 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xe0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xd8 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xc8 ,0x3 ,0x20 ,0x3 ,0x41 ,0xd0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xc8 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x28 ,0x21 ,0x29 ,0xc ,0x1 ,0xb ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x21 ,0x29 ,0x20 ,0x28 ,0x20 ,0x17 ,0x46 ,0xd ,0x2 ,0xb ,0x20 ,0x2a ,0x41 ,0x1 ,0x6a ,0x21 ,0x2a ,0x20 ,0x2c ,0x21 ,0x4 ,0x20 ,0x29 ,0x21 ,0x28 ,0x20 ,0x2b ,0x41 ,0x7f ,0x6a ,0x22 ,0x2b ,0xd ,0x0 ,0xb ,0x20 ,0x24 ,0x21 ,0x2a ,0xb ,0x20 ,0x17 ,0x41 ,0x80 ,0x4 ,0x48 ,0xd ,0x5 ,0x41 ,0x0 ,0x21 ,0x2b ,0x2 ,0x40 ,0x20 ,0x2a ,0x41 ,0x1 ,0x6a ,0x22 ,0x2d ,0x20 ,0x24 ,0x4e ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x2a ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xc0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xb8 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb8 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xb0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xa8 ,0x3 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xa8 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x28 ,0x21 ,0x2b ,0xc ,0x1 ,0xb ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2b ,0x20 ,0x28 ,0x20 ,0x17 ,0x46 ,0xd ,0x2 ,0xb ,0x20 ,0x2c ,0x21 ,0x4 ,0x20 ,0x2b ,0x21 ,0x28 ,0x20 ,0x2d ,0x41 ,0x1 ,0x6a ,0x22 ,0x2d ,0x20 ,0x24 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x2b ,0x20 ,0x18 ,0x47 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x23 ,0x20 ,0x19 ,0x6a ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x23 ,0x20 ,0x18 ,0x6a ,0x22 ,0x2b ,0xad ,0x84 ,0x37 ,0x3 ,0x88 ,0x5 ,0x20 ,0x2d ,0x20 ,0x19 ,0x6a ,0x21 ,0x2e ,0x20 ,0x23 ,0x21 ,0x2f ,0x20 ,0x1b ,0x21 ,0x30 ,0x20 ,0x1b ,0x21 ,0x31 ,0x20 ,0x2d ,0x21 ,0x9 ,0xc ,0x7 ,0xb ,0x2 ,0x40 ,0x20 ,0x29 ,0x20 ,0x18 ,0x47 ,0xd ,0x0 ,0x41 ,0x1 ,0x21 ,0x2c ,0x20 ,0x1b ,0x41 ,0x7e ,0x6a ,0x22 ,0x9 ,0x20 ,0x24 ,0x48 ,0xd ,0x4 ,0x20 ,0x14 ,0x20 ,0x23 ,0x20 ,0xa ,0x6a ,0x20 ,0x26 ,0x6a ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x1 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xe0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd8 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xe0 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xd8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xc8 ,0x2 ,0x20 ,0x3 ,0x41 ,0xd0 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xc8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x28 ,0x21 ,0x2c ,0xc ,0x1 ,0xb ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2c ,0x20 ,0x28 ,0x20 ,0x17 ,0x46 ,0xd ,0x6 ,0xb ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x21 ,0x4 ,0x20 ,0x9 ,0x20 ,0x24 ,0x4a ,0x21 ,0x29 ,0x20 ,0x2c ,0x21 ,0x28 ,0x20 ,0x9 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2d ,0x21 ,0x9 ,0x20 ,0x29 ,0xd ,0x0 ,0xc ,0x6 ,0xb ,0xb ,0x20 ,0x1b ,0x41 ,0x7e ,0x6a ,0x22 ,0x28 ,0x20 ,0x24 ,0x48 ,0xd ,0x1 ,0x20 ,0x14 ,0x20 ,0x23 ,0x20 ,0xa ,0x6a ,0x20 ,0x26 ,0x6a ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x1 ,0x21 ,0x2c ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xa0 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x22 ,0x2a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x98 ,0x3 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xa0 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0x98 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x2a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x90 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x88 ,0x3 ,0x20 ,0x3 ,0x41 ,0x90 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0x88 ,0x3 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x2c ,0x20 ,0x17 ,0x46 ,0xd ,0x3 ,0x20 ,0x2c ,0x41 ,0x1 ,0x6a ,0x21 ,0x2c ,0xb ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x21 ,0x4 ,0x20 ,0x28 ,0x20 ,0x24 ,0x4a ,0x21 ,0x2a ,0x20 ,0x28 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2b ,0x21 ,0x28 ,0x20 ,0x2a ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x20 ,0x3 ,0x20 ,0x22 ,0x37 ,0x3 ,0x88 ,0x5 ,0x20 ,0x1b ,0x21 ,0x30 ,0x20 ,0x1b ,0x21 ,0x31 ,0x20 ,0x23 ,0x21 ,0x2e ,0x20 ,0x1d ,0x21 ,0x32 ,0xc ,0x6 ,0xb ,0x20 ,0x28 ,0x21 ,0x2b ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2b ,0x20 ,0x24 ,0x4a ,0xd ,0x0 ,0x20 ,0x2b ,0x41 ,0x7f ,0x6a ,0x21 ,0x2c ,0x41 ,0x0 ,0x21 ,0x28 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x2b ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x28 ,0x20 ,0x2b ,0x21 ,0x2a ,0x2 ,0x40 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x80 ,0x3 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf8 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x80 ,0x3 ,0x6a ,0x20 ,0x3 ,0x41 ,0xf8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xe8 ,0x2 ,0x20 ,0x3 ,0x41 ,0xf0 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xe8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x28 ,0x20 ,0x17 ,0x46 ,0xd ,0x2 ,0x20 ,0x4 ,0x21 ,0x28 ,0xb ,0x20 ,0x2c ,0x21 ,0x4 ,0x20 ,0x2a ,0x41 ,0x7f ,0x6a ,0x22 ,0x2a ,0x20 ,0x24 ,0x4a ,0xd ,0x0 ,0xb ,0x20 ,0x2a ,0x41 ,0x7f ,0x6a ,0x21 ,0x2c ,0xc ,0x1 ,0xb ,0x20 ,0x2a ,0x41 ,0x7f ,0x6a ,0x21 ,0x2c ,0x20 ,0x4 ,0x21 ,0x28 ,0xb ,0x20 ,0x3 ,0x20 ,0x2c ,0x36 ,0x2 ,0x88 ,0x5 ,0x20 ,0x3 ,0x20 ,0x28 ,0x20 ,0x2c ,0x6a ,0x36 ,0x2 ,0x8c ,0x5 ,0x20 ,0x2b ,0x21 ,0x2f ,0x20 ,0x28 ,0x20 ,0x18 ,0x47 ,0xd ,0x3 ,0x20 ,0x3 ,0x20 ,0x1b ,0x20 ,0x18 ,0x6b ,0x22 ,0x2f ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x2f ,0x20 ,0x18 ,0x6b ,0xad ,0x84 ,0x37 ,0x3 ,0x88 ,0x5 ,0x20 ,0x2c ,0x20 ,0x19 ,0x6a ,0x21 ,0x31 ,0x20 ,0x1b ,0x21 ,0x2b ,0x20 ,0x2c ,0x21 ,0x30 ,0x20 ,0x23 ,0x21 ,0x9 ,0x20 ,0x23 ,0x21 ,0x2e ,0xc ,0x3 ,0xb ,0x20 ,0x9 ,0x21 ,0x2d ,0xb ,0x20 ,0x2a ,0x20 ,0x18 ,0x6a ,0x21 ,0x2e ,0x20 ,0x3 ,0x20 ,0x2d ,0x36 ,0x2 ,0x88 ,0x5 ,0x20 ,0x3 ,0x20 ,0x2c ,0x20 ,0x2d ,0x6a ,0x36 ,0x2 ,0x8c ,0x5 ,0x2 ,0x40 ,0x20 ,0x2c ,0x20 ,0x18 ,0x46 ,0xd ,0x0 ,0x20 ,0x23 ,0x21 ,0x2b ,0x20 ,0x23 ,0x21 ,0x2f ,0x20 ,0x2a ,0x21 ,0x9 ,0xc ,0x2 ,0xb ,0x20 ,0x23 ,0x20 ,0x18 ,0x6a ,0x21 ,0x2b ,0x20 ,0x3 ,0x20 ,0x1b ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x1b ,0x20 ,0x18 ,0x6b ,0xad ,0x84 ,0x37 ,0x3 ,0x88 ,0x5 ,0x20 ,0x2d ,0x20 ,0x18 ,0x6a ,0x21 ,0x31 ,0x20 ,0x23 ,0x21 ,0x2f ,0x20 ,0x2d ,0x21 ,0x30 ,0x20 ,0x2a ,0x21 ,0x9 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x23 ,0xad ,0x42 ,0x81 ,0x80 ,0x80 ,0x80 ,0x10 ,0x7e ,0x37 ,0x3 ,0x88 ,0x5 ,0x2 ,0x40 ,0x20 ,0x29 ,0x20 ,0x18 ,0x47 ,0xd ,0x0 ,0x20 ,0x23 ,0x20 ,0x18 ,0x6a ,0x21 ,0x2b ,0x20 ,0x2a ,0x20 ,0x18 ,0x6a ,0x21 ,0x2e ,0x20 ,0x23 ,0x21 ,0x2f ,0x20 ,0x1b ,0x21 ,0x30 ,0x20 ,0x1b ,0x21 ,0x31 ,0x20 ,0x2a ,0x21 ,0x9 ,0xc ,0x1 ,0xb ,0x41 ,0x1 ,0x21 ,0x2c ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1b ,0x41 ,0x7e ,0x6a ,0x22 ,0x9 ,0x20 ,0x24 ,0x48 ,0xd ,0x0 ,0x20 ,0x14 ,0x20 ,0x23 ,0x20 ,0xa ,0x6a ,0x20 ,0x26 ,0x6a ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x41 ,0x1 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xc0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xb8 ,0x2 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xb0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xa8 ,0x2 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xa8 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x28 ,0x21 ,0x2c ,0xc ,0x1 ,0xb ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x21 ,0x2c ,0x20 ,0x28 ,0x20 ,0x17 ,0x46 ,0xd ,0x2 ,0xb ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x21 ,0x4 ,0x20 ,0x9 ,0x20 ,0x24 ,0x4a ,0x21 ,0x29 ,0x20 ,0x2c ,0x21 ,0x28 ,0x20 ,0x9 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2d ,0x21 ,0x9 ,0x20 ,0x29 ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x20 ,0x9 ,0x21 ,0x2d ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2c ,0x20 ,0x18 ,0x46 ,0xd ,0x0 ,0x20 ,0x2c ,0x20 ,0x2d ,0x6a ,0x21 ,0x2b ,0x20 ,0x2d ,0x21 ,0x2f ,0xc ,0x1 ,0xb ,0x20 ,0x1b ,0x20 ,0x18 ,0x6b ,0x21 ,0x2f ,0x20 ,0x2d ,0x20 ,0x18 ,0x6a ,0x21 ,0x31 ,0x20 ,0x1b ,0x21 ,0x2b ,0x20 ,0x2d ,0x21 ,0x30 ,0xb ,0x20 ,0x2a ,0x21 ,0x9 ,0x20 ,0x2a ,0x21 ,0x2e ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2b ,0x20 ,0x2f ,0x6b ,0x22 ,0x2d ,0x20 ,0x17 ,0x4a ,0xd ,0x0 ,0x20 ,0x24 ,0x20 ,0x23 ,0x4c ,0xd ,0x4 ,0x20 ,0x1b ,0x20 ,0x24 ,0x4c ,0xd ,0x4 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xe0 ,0x4 ,0x37 ,0x3 ,0xa0 ,0x2 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x23 ,0x20 ,0x3 ,0x41 ,0xa0 ,0x2 ,0x6a ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x4 ,0x36 ,0x2 ,0xd4 ,0x4 ,0x20 ,0x3 ,0x20 ,0x23 ,0x36 ,0x2 ,0xd0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xd0 ,0x4 ,0x37 ,0x3 ,0x98 ,0x2 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x20 ,0x24 ,0x6b ,0x22 ,0xa ,0x6b ,0x20 ,0x3 ,0x41 ,0x98 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x3 ,0x20 ,0x4 ,0x36 ,0x2 ,0xe0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0xe8 ,0x4 ,0x37 ,0x3 ,0x90 ,0x2 ,0x20 ,0x3 ,0x20 ,0x4 ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x0 ,0x20 ,0xa ,0x20 ,0x23 ,0x6a ,0x20 ,0x3 ,0x41 ,0x90 ,0x2 ,0x6a ,0x20 ,0x2 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x22 ,0x23 ,0xad ,0x84 ,0x37 ,0x3 ,0xe8 ,0x4 ,0x20 ,0x4 ,0x20 ,0x23 ,0x4c ,0xd ,0x2 ,0x20 ,0x4 ,0x21 ,0x24 ,0x20 ,0x1b ,0x20 ,0x4 ,0x4a ,0xd ,0x0 ,0xc ,0x2 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x2e ,0x20 ,0x9 ,0x6b ,0x22 ,0x29 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x9 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x28 ,0x41 ,0x0 ,0x21 ,0x4 ,0x20 ,0x9 ,0x21 ,0x2a ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x23 ,0x20 ,0x9 ,0x46 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x28 ,0x41 ,0x78 ,0x6a ,0x22 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x88 ,0x2 ,0x20 ,0x3 ,0x20 ,0x28 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x80 ,0x2 ,0x20 ,0x3 ,0x41 ,0x88 ,0x2 ,0x6a ,0x20 ,0x3 ,0x41 ,0x80 ,0x2 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x28 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf8 ,0x1 ,0x20 ,0x3 ,0x20 ,0x2c ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x1 ,0x20 ,0x3 ,0x41 ,0xf8 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xf0 ,0x1 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x4 ,0x21 ,0x2c ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x2a ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xcc ,0x4 ,0x20 ,0x3 ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xc8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xc8 ,0x4 ,0x37 ,0x3 ,0xe8 ,0x1 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x4 ,0x6b ,0x20 ,0x3 ,0x41 ,0xe8 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x20 ,0x9 ,0x6a ,0x21 ,0x2a ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2c ,0x21 ,0x4 ,0xb ,0x20 ,0x28 ,0x41 ,0x78 ,0x6a ,0x21 ,0x28 ,0x20 ,0x9 ,0x41 ,0x7f ,0x6a ,0x21 ,0x9 ,0x20 ,0x2c ,0x20 ,0x29 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x31 ,0x20 ,0x30 ,0x6b ,0x22 ,0x2c ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x30 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x20 ,0x13 ,0x20 ,0x23 ,0x6a ,0x20 ,0xa ,0x6a ,0x20 ,0x26 ,0x6a ,0x20 ,0x30 ,0x6b ,0x21 ,0xa ,0x41 ,0x0 ,0x21 ,0x4 ,0x20 ,0x30 ,0x21 ,0x28 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xa ,0x45 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xe0 ,0x1 ,0x20 ,0x3 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x22 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd8 ,0x1 ,0x20 ,0x3 ,0x41 ,0xe0 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xd8 ,0x1 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xd0 ,0x1 ,0x20 ,0x3 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xc8 ,0x1 ,0x20 ,0x3 ,0x41 ,0xd0 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xc8 ,0x1 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0xd ,0x0 ,0x20 ,0x4 ,0x21 ,0x26 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x28 ,0x36 ,0x2 ,0xc0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x30 ,0x36 ,0x2 ,0xc4 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xc0 ,0x4 ,0x37 ,0x3 ,0xc0 ,0x1 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x30 ,0x20 ,0x4 ,0x6b ,0x21 ,0x28 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x26 ,0x21 ,0x4 ,0xb ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0xa ,0x41 ,0x7f ,0x6a ,0x21 ,0xa ,0x20 ,0x30 ,0x41 ,0x1 ,0x6a ,0x21 ,0x30 ,0x20 ,0x26 ,0x20 ,0x2c ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x29 ,0x3 ,0x88 ,0x5 ,0x21 ,0x22 ,0x20 ,0x1b ,0x21 ,0x31 ,0x20 ,0x1b ,0x20 ,0x2c ,0x6b ,0x22 ,0x30 ,0x21 ,0x21 ,0x20 ,0x1b ,0x21 ,0x20 ,0x20 ,0x23 ,0x21 ,0x1f ,0x20 ,0x29 ,0x20 ,0x23 ,0x6a ,0x22 ,0x2e ,0x21 ,0x1e ,0x20 ,0x2f ,0x21 ,0x32 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x21 ,0x24 ,0x20 ,0x9 ,0x21 ,0x23 ,0x20 ,0x1d ,0x21 ,0x32 ,0x20 ,0x1c ,0x21 ,0x2b ,0xb ,0x2 ,0x40 ,0x20 ,0x2d ,0x20 ,0x17 ,0x4a ,0xd ,0x0 ,0x20 ,0x23 ,0x21 ,0x9 ,0x20 ,0x32 ,0x21 ,0x1d ,0x20 ,0x2b ,0x21 ,0x1c ,0xc ,0x2 ,0xb ,0x20 ,0x24 ,0x20 ,0x2e ,0x6b ,0x21 ,0x28 ,0x20 ,0x2f ,0x21 ,0x1d ,0x20 ,0x2b ,0x21 ,0x1c ,0xb ,0x2 ,0x40 ,0x20 ,0x28 ,0x20 ,0x10 ,0x6f ,0x22 ,0xa ,0x20 ,0x2e ,0x6a ,0x22 ,0x2d ,0x41 ,0x1 ,0x6a ,0x22 ,0x26 ,0x20 ,0x24 ,0x4e ,0xd ,0x0 ,0x20 ,0xb ,0x20 ,0x2d ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x20 ,0x1d ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x9 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x20 ,0x15 ,0x6a ,0x21 ,0x4 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0x26 ,0x20 ,0x10 ,0x6a ,0x22 ,0x26 ,0x20 ,0x24 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x42 ,0x0 ,0x37 ,0x3 ,0xf8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x2d ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x2e ,0xad ,0x84 ,0x37 ,0x3 ,0x80 ,0x5 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x2d ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x4 ,0x20 ,0x10 ,0x20 ,0x1b ,0x20 ,0x31 ,0x20 ,0x30 ,0x6b ,0x22 ,0x34 ,0x20 ,0x24 ,0x6a ,0x6b ,0x22 ,0x4 ,0x20 ,0x10 ,0x20 ,0x4 ,0x48 ,0x1b ,0x21 ,0x26 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0xa ,0x41 ,0x80 ,0x4 ,0x4a ,0xd ,0x0 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x20 ,0x0 ,0x20 ,0x2e ,0x41 ,0x3 ,0x74 ,0x6a ,0x20 ,0xa ,0x41 ,0x3 ,0x74 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x3 ,0x28 ,0x2 ,0x88 ,0x5 ,0x21 ,0x28 ,0xc ,0x1 ,0xb ,0x20 ,0x0 ,0x20 ,0x2e ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x20 ,0x3 ,0x28 ,0x2 ,0x88 ,0x5 ,0x22 ,0x28 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x4 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x4 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x9 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0xa ,0x41 ,0x7f ,0x6a ,0x22 ,0xa ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x26 ,0x20 ,0x24 ,0x6a ,0x21 ,0xa ,0x20 ,0x0 ,0x20 ,0x28 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x35 ,0x20 ,0x0 ,0x20 ,0x1d ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x36 ,0x41 ,0x0 ,0x21 ,0x9 ,0x20 ,0x3 ,0x29 ,0x3 ,0xf8 ,0x4 ,0x21 ,0x33 ,0x41 ,0x0 ,0x21 ,0x28 ,0x20 ,0x2d ,0x21 ,0x4 ,0x20 ,0x24 ,0x21 ,0x2c ,0x20 ,0x2d ,0x21 ,0x2a ,0x41 ,0x0 ,0x21 ,0x1d ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x24 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x29 ,0x2 ,0x40 ,0x2 ,0x40 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x28 ,0x20 ,0x9 ,0x4c ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0xd ,0x20 ,0x28 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xb8 ,0x1 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0xf0 ,0x4 ,0x37 ,0x3 ,0xb0 ,0x1 ,0x20 ,0x3 ,0x41 ,0xb8 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x1 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0xa ,0x20 ,0x24 ,0x47 ,0xd ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x33 ,0x37 ,0x3 ,0xa0 ,0x1 ,0x20 ,0x3 ,0x20 ,0x33 ,0x37 ,0x3 ,0xf8 ,0x4 ,0x20 ,0x0 ,0x20 ,0x2a ,0x20 ,0x3 ,0x41 ,0xa0 ,0x1 ,0x6a ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x2b ,0x2 ,0x40 ,0x20 ,0x10 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x20 ,0x0 ,0x20 ,0x2a ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x26 ,0x20 ,0x10 ,0x21 ,0x2a ,0x3 ,0x40 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x9 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x26 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0x26 ,0x41 ,0x8 ,0x6a ,0x21 ,0x26 ,0x20 ,0x2a ,0x41 ,0x7f ,0x6a ,0x22 ,0x2a ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x28 ,0x20 ,0x2b ,0x6b ,0x21 ,0x29 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x22 ,0x2f ,0x6a ,0x22 ,0x9 ,0x41 ,0x8 ,0x6a ,0x22 ,0x26 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x26 ,0x20 ,0x36 ,0x20 ,0x1d ,0x41 ,0x3 ,0x74 ,0x6a ,0x22 ,0x28 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x28 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x2b ,0x36 ,0x2 ,0xbc ,0x4 ,0x20 ,0x3 ,0x20 ,0x2d ,0x36 ,0x2 ,0xb8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x88 ,0x5 ,0x37 ,0x3 ,0x98 ,0x1 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x80 ,0x5 ,0x37 ,0x3 ,0x90 ,0x1 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xb8 ,0x4 ,0x37 ,0x3 ,0x88 ,0x1 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0x98 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0x90 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0x88 ,0x1 ,0x6a ,0x20 ,0x2 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1a ,0xd ,0x2 ,0x20 ,0x35 ,0x21 ,0x26 ,0x20 ,0x10 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x9 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x26 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0x26 ,0x41 ,0x8 ,0x6a ,0x21 ,0x26 ,0x20 ,0x28 ,0x41 ,0x7f ,0x6a ,0x22 ,0x28 ,0xd ,0x0 ,0xc ,0x4 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0xa ,0x20 ,0x24 ,0x6b ,0x22 ,0x9 ,0x20 ,0x10 ,0x4e ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0xa ,0x36 ,0x2 ,0xb4 ,0x4 ,0x20 ,0x3 ,0x20 ,0x4 ,0x36 ,0x2 ,0xb0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xb0 ,0x4 ,0x37 ,0x3 ,0xa8 ,0x1 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x9 ,0x6b ,0x20 ,0x3 ,0x41 ,0xa8 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2a ,0x20 ,0x9 ,0x6a ,0x21 ,0x2a ,0x20 ,0x2c ,0x20 ,0x9 ,0x6a ,0x21 ,0x2c ,0x20 ,0x4 ,0x20 ,0x9 ,0x6a ,0x22 ,0x28 ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x4 ,0xad ,0x84 ,0x21 ,0x33 ,0x20 ,0x4 ,0x21 ,0x9 ,0x20 ,0x24 ,0x21 ,0xa ,0x20 ,0x28 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x10 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x20 ,0x29 ,0x21 ,0x26 ,0x20 ,0x10 ,0x21 ,0x28 ,0x3 ,0x40 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x9 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x26 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0x26 ,0x41 ,0x8 ,0x6a ,0x21 ,0x26 ,0x20 ,0x28 ,0x41 ,0x7f ,0x6a ,0x22 ,0x28 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0xa ,0x20 ,0x10 ,0x6a ,0x22 ,0x9 ,0x20 ,0x30 ,0x20 ,0x9 ,0x20 ,0x30 ,0x48 ,0x1b ,0x21 ,0xa ,0x20 ,0x2c ,0x20 ,0x2a ,0x20 ,0x2a ,0x20 ,0x4 ,0x46 ,0x1b ,0x21 ,0x2a ,0x20 ,0x29 ,0x20 ,0x15 ,0x6a ,0x21 ,0x29 ,0x20 ,0x24 ,0x20 ,0x10 ,0x6a ,0x21 ,0x24 ,0x20 ,0x2c ,0x20 ,0x10 ,0x6a ,0x21 ,0x2c ,0x20 ,0x4 ,0x20 ,0x10 ,0x6a ,0x22 ,0x28 ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x4 ,0xad ,0x84 ,0x21 ,0x33 ,0x20 ,0x4 ,0x21 ,0x9 ,0x20 ,0x28 ,0x21 ,0x4 ,0xc ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x20 ,0x9 ,0x20 ,0x15 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xb ,0x20 ,0x4 ,0x20 ,0x10 ,0x6a ,0x21 ,0x28 ,0x2 ,0x40 ,0x20 ,0x29 ,0x41 ,0x1 ,0x48 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x2b ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x9 ,0x20 ,0x0 ,0x20 ,0x28 ,0x20 ,0x29 ,0x6b ,0x41 ,0x3 ,0x74 ,0x6a ,0x21 ,0x26 ,0x20 ,0x29 ,0x21 ,0x2a ,0x3 ,0x40 ,0x20 ,0x9 ,0x29 ,0x2 ,0x0 ,0x21 ,0x33 ,0x20 ,0x9 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x26 ,0x20 ,0x33 ,0x37 ,0x2 ,0x0 ,0x20 ,0x9 ,0x41 ,0x8 ,0x6a ,0x21 ,0x9 ,0x20 ,0x26 ,0x41 ,0x8 ,0x6a ,0x21 ,0x26 ,0x20 ,0x2a ,0x41 ,0x7f ,0x6a ,0x22 ,0x2a ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x20 ,0x28 ,0xad ,0x42 ,0x20 ,0x86 ,0x20 ,0x4 ,0x20 ,0x29 ,0x6b ,0x22 ,0x4 ,0x20 ,0x10 ,0x6a ,0x22 ,0x2d ,0xad ,0x22 ,0x37 ,0x84 ,0x22 ,0x33 ,0x37 ,0x3 ,0xf8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x37 ,0x42 ,0x20 ,0x86 ,0x20 ,0x4 ,0xad ,0x84 ,0x37 ,0x3 ,0x80 ,0x5 ,0x2 ,0x40 ,0x20 ,0x2c ,0x20 ,0x28 ,0x46 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x28 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x20 ,0x10 ,0x6a ,0x22 ,0x9 ,0x20 ,0x2c ,0x4e ,0xd ,0x0 ,0x20 ,0x16 ,0x20 ,0x2f ,0x6a ,0x21 ,0x26 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x26 ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x80 ,0x1 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x78 ,0x20 ,0x9 ,0x20 ,0x4 ,0x20 ,0x3 ,0x41 ,0x80 ,0x1 ,0x6a ,0x20 ,0x3 ,0x41 ,0xf8 ,0x0 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x1b ,0x21 ,0x4 ,0x20 ,0x26 ,0x20 ,0x15 ,0x6a ,0x21 ,0x26 ,0x20 ,0x9 ,0x20 ,0x10 ,0x6a ,0x22 ,0x9 ,0x20 ,0x2c ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1d ,0x41 ,0x1 ,0x6a ,0x21 ,0x1d ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2a ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0xf0 ,0x4 ,0x20 ,0x2d ,0x21 ,0x9 ,0x20 ,0x28 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0xb ,0x20 ,0x3 ,0x20 ,0x2d ,0x36 ,0x2 ,0xa8 ,0x4 ,0x20 ,0x3 ,0x20 ,0x1b ,0x20 ,0x34 ,0x6b ,0x36 ,0x2 ,0xac ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x88 ,0x5 ,0x37 ,0x3 ,0x70 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x80 ,0x5 ,0x37 ,0x3 ,0x68 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xa8 ,0x4 ,0x37 ,0x3 ,0x60 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0xf0 ,0x0 ,0x6a ,0x20 ,0x3 ,0x41 ,0xe8 ,0x0 ,0x6a ,0x20 ,0x3 ,0x41 ,0xe0 ,0x0 ,0x6a ,0x20 ,0x2 ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x23 ,0x21 ,0x9 ,0x20 ,0x32 ,0x21 ,0x1d ,0xb ,0x20 ,0x25 ,0x20 ,0x27 ,0x6b ,0x21 ,0x4 ,0x20 ,0x1b ,0x20 ,0x1 ,0x48 ,0xd ,0x0 ,0xb ,0x20 ,0x3 ,0x20 ,0x22 ,0x37 ,0x3 ,0x98 ,0x5 ,0x2 ,0x40 ,0x20 ,0x1c ,0x20 ,0x1d ,0x4c ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x3 ,0x98 ,0x5 ,0x37 ,0x3 ,0x40 ,0x20 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc0 ,0x0 ,0x6a ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1e ,0x21 ,0xa ,0x20 ,0x1f ,0x21 ,0x4 ,0x2 ,0x40 ,0x20 ,0x1e ,0x20 ,0x1f ,0x4c ,0xd ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1e ,0x20 ,0x21 ,0x46 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x1e ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x38 ,0x20 ,0x3 ,0x20 ,0x0 ,0x20 ,0x4 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x30 ,0x20 ,0x3 ,0x41 ,0x38 ,0x6a ,0x20 ,0x3 ,0x41 ,0x30 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x1e ,0x21 ,0x26 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x4 ,0x36 ,0x2 ,0xa0 ,0x4 ,0x20 ,0x3 ,0x20 ,0x1e ,0x36 ,0x2 ,0xa4 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0xa0 ,0x4 ,0x37 ,0x3 ,0x28 ,0x20 ,0x0 ,0x41 ,0x0 ,0x20 ,0x1e ,0x20 ,0xa ,0x6b ,0x22 ,0xa ,0x6b ,0x20 ,0x3 ,0x41 ,0x28 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x1e ,0x41 ,0x7f ,0x6a ,0x21 ,0x26 ,0x20 ,0x4 ,0x20 ,0xa ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1e ,0x21 ,0xa ,0xb ,0x20 ,0x26 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1e ,0x20 ,0xa ,0x20 ,0x4 ,0x4a ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x21 ,0x21 ,0x4 ,0x20 ,0x20 ,0x20 ,0x21 ,0x4c ,0xd ,0x0 ,0x3 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x21 ,0x20 ,0x1f ,0x46 ,0xd ,0x0 ,0x20 ,0x3 ,0x20 ,0xd ,0x20 ,0x20 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x20 ,0x20 ,0x3 ,0x20 ,0xd ,0x20 ,0x21 ,0x41 ,0x3 ,0x74 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x3 ,0x18 ,0x20 ,0x3 ,0x41 ,0x20 ,0x6a ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x2 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x45 ,0xd ,0x0 ,0x20 ,0x21 ,0x21 ,0xa ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x20 ,0x20 ,0x36 ,0x2 ,0x9c ,0x4 ,0x20 ,0x3 ,0x20 ,0x21 ,0x36 ,0x2 ,0x98 ,0x4 ,0x20 ,0x3 ,0x20 ,0x3 ,0x29 ,0x2 ,0x98 ,0x4 ,0x37 ,0x3 ,0x10 ,0x20 ,0x0 ,0x20 ,0x4 ,0x20 ,0x21 ,0x6b ,0x22 ,0x4 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x3 ,0x41 ,0xb0 ,0x5 ,0x6a ,0x41 ,0x80 ,0x4 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x21 ,0x41 ,0x1 ,0x6a ,0x21 ,0xa ,0x20 ,0x20 ,0x20 ,0x4 ,0x41 ,0x7f ,0x73 ,0x6a ,0x21 ,0x20 ,0x20 ,0x21 ,0x21 ,0x4 ,0xb ,0x20 ,0xa ,0x41 ,0x7f ,0x6a ,0x21 ,0x21 ,0x20 ,0x20 ,0x20 ,0x4 ,0x4a ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x12 ,0x20 ,0x8 ,0x41 ,0x1 ,0x74 ,0x22 ,0x4 ,0x20 ,0x6 ,0x4e ,0x22 ,0xa ,0x72 ,0x21 ,0x7 ,0x20 ,0x4 ,0x20 ,0x6 ,0x41 ,0x0 ,0x20 ,0xa ,0x1b ,0x6b ,0x21 ,0x8 ,0x20 ,0xe ,0x41 ,0x1 ,0x74 ,0x22 ,0xe ,0x20 ,0x5 ,0x48 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0xb0 ,0x25 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x30 ,0x1 ,0x1 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0xa ,0xf ,0xb ,0x41 ,0xb ,0x21 ,0x2 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6d ,0x20 ,0x0 ,0x4a ,0xd ,0x0 ,0x41 ,0xa ,0x41 ,0x9 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x20 ,0x0 ,0x46 ,0x1b ,0x21 ,0x2 ,0xb ,0x20 ,0x2 ,0xb ,0x8 ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x18 ,0x0 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6b ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x99 ,0xb3 ,0xe6 ,0xcc ,0x1 ,0x6c ,0x6a ,0x41 ,0x7e ,0x6a ,0xb ,0x15 ,0x0 ,0x20 ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x99 ,0xb3 ,0xe6 ,0xcc ,0x1 ,0x6c ,0x6a ,0x41 ,0x7e ,0x6a ,0xb ,0x4 ,0x0 ,0x20 ,0x0 ,0xb ,0x7 ,0x0 ,0x20 ,0x1 ,0x20 ,0x0 ,0x6b ,0xb ,0x5 ,0x0 ,0x41 ,0xe8 ,0x7 ,0xb ,0xb ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0x20 ,0x0 ,0xb ,0xf ,0x0 ,0x10 ,0x96 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x4 ,0x6f ,0x41 ,0xe8 ,0x7 ,0x6a ,0xb ,0x2 ,0x0 ,0xb ,0xbf ,0x1 ,0x1 ,0x7 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x45 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x41 ,0x0 ,0x10 ,0x97 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x4 ,0x41 ,0x2 ,0x74 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x6 ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x21 ,0x7 ,0x3 ,0x40 ,0x20 ,0x6 ,0x41 ,0x90 ,0x3 ,0x20 ,0x5 ,0x11 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x21 ,0x8 ,0x20 ,0x7 ,0x41 ,0x4 ,0x6a ,0x20 ,0x6 ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x20 ,0x8 ,0x36 ,0x2 ,0x0 ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x21 ,0x7 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x41 ,0x90 ,0x3 ,0x47 ,0xd ,0x0 ,0xb ,0x41 ,0xc0 ,0x88 ,0x80 ,0x80 ,0x0 ,0x41 ,0x90 ,0x3 ,0x41 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x88 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x41 ,0x9 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x1 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xe ,0x0 ,0x41 ,0x2 ,0x41 ,0x1 ,0x10 ,0x93 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x98 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x92 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x9a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x94 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x9b ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x30 ,0x1 ,0x1 ,0x7f ,0x41 ,0x0 ,0x41 ,0x0 ,0x28 ,0x2 ,0xc0 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x41 ,0xed ,0x9c ,0x99 ,0x8e ,0x4 ,0x6c ,0x41 ,0xb9 ,0xe0 ,0x0 ,0x6a ,0x41 ,0xff ,0xff ,0xff ,0xff ,0x7 ,0x71 ,0x22 ,0x0 ,0x36 ,0x2 ,0xc0 ,0xa1 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x10 ,0x76 ,0xb ,0xd ,0x0 ,0x41 ,0x0 ,0x20 ,0x0 ,0x36 ,0x2 ,0xc0 ,0xa1 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x95 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc2 ,0xa ,0x1 ,0x6 ,0x7f ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x1 ,0x20 ,0x3 ,0x45 ,0xd ,0x1 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x3 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x2 ,0x21 ,0x3 ,0x20 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x4f ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x1 ,0x41 ,0x10 ,0x71 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x1 ,0x3 ,0x40 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x18 ,0x6a ,0x20 ,0x5 ,0x41 ,0x18 ,0x6a ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x20 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x20 ,0x6a ,0x21 ,0x5 ,0x20 ,0x1 ,0x41 ,0x60 ,0x6a ,0x22 ,0x1 ,0x41 ,0xf ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x2 ,0x0 ,0x37 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0xb ,0x2 ,0x40 ,0x20 ,0x1 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x1 ,0x41 ,0x1 ,0x71 ,0xd ,0x1 ,0xc ,0x2 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x20 ,0x49 ,0xd ,0x0 ,0x20 ,0x5 ,0x28 ,0x2 ,0x0 ,0x21 ,0x1 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0xe ,0x3 ,0x0 ,0x1 ,0x2 ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7d ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x3 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x8 ,0x74 ,0x20 ,0x1 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x8 ,0x74 ,0x20 ,0x8 ,0x41 ,0x18 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x10 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x3 ,0x6a ,0x21 ,0x5 ,0xc ,0x2 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3b ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7e ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x10 ,0x74 ,0x20 ,0x1 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x10 ,0x74 ,0x20 ,0x8 ,0x41 ,0x10 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x11 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x1 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x21 ,0x6 ,0x41 ,0x0 ,0x21 ,0x2 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x7 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x20 ,0x7 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x20 ,0x7 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x8 ,0x41 ,0x18 ,0x74 ,0x20 ,0x1 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x4 ,0x41 ,0xc ,0x6a ,0x20 ,0x7 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x22 ,0x1 ,0x41 ,0x18 ,0x74 ,0x20 ,0x8 ,0x41 ,0x8 ,0x76 ,0x72 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x70 ,0x6a ,0x22 ,0x3 ,0x41 ,0x12 ,0x4b ,0xd ,0x0 ,0xb ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x41 ,0x1 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x10 ,0x49 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x20 ,0x5 ,0x41 ,0x1 ,0x6a ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x5 ,0x6a ,0x20 ,0x5 ,0x41 ,0x5 ,0x6a ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xd ,0x6a ,0x20 ,0x5 ,0x41 ,0xd ,0x6a ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0xf ,0x6a ,0x20 ,0x5 ,0x41 ,0xf ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x10 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x10 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x8 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x29 ,0x0 ,0x0 ,0x37 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x8 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x4 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x28 ,0x0 ,0x0 ,0x36 ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x4 ,0x6a ,0x21 ,0x5 ,0xb ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x2 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x4 ,0x20 ,0x5 ,0x2f ,0x0 ,0x0 ,0x3b ,0x0 ,0x0 ,0x20 ,0x4 ,0x41 ,0x2 ,0x6a ,0x21 ,0x4 ,0x20 ,0x5 ,0x41 ,0x2 ,0x6a ,0x21 ,0x5 ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x71 ,0x45 ,0xd ,0x1 ,0xb ,0x20 ,0x4 ,0x20 ,0x5 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x0 ,0xb ,0x9e ,0xa ,0x1 ,0x4 ,0x7f ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x46 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x1 ,0x20 ,0x0 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x6b ,0x41 ,0x0 ,0x20 ,0x2 ,0x41 ,0x1 ,0x74 ,0x6b ,0x4b ,0xd ,0x0 ,0x20 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x10 ,0x9c ,0x80 ,0x80 ,0x80 ,0x0 ,0x1a ,0xc ,0x1 ,0xb ,0x20 ,0x1 ,0x20 ,0x0 ,0x73 ,0x41 ,0x3 ,0x71 ,0x21 ,0x4 ,0x2 ,0x40 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0x20 ,0x1 ,0x4f ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x21 ,0x3 ,0xc ,0x3 ,0xb ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x2 ,0x21 ,0x5 ,0x20 ,0x0 ,0x21 ,0x3 ,0xc ,0x2 ,0xb ,0x20 ,0x2 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x21 ,0x5 ,0x2 ,0x40 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x22 ,0x3 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x21 ,0x1 ,0xc ,0x2 ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x3 ,0x20 ,0x0 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0xc ,0x1 ,0xb ,0x2 ,0x40 ,0x20 ,0x4 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x3 ,0x41 ,0x3 ,0x71 ,0x45 ,0xd ,0x0 ,0x20 ,0x2 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7e ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7d ,0x6a ,0x22 ,0x3 ,0x6a ,0x22 ,0x4 ,0x20 ,0x1 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x2 ,0x40 ,0x20 ,0x4 ,0x41 ,0x3 ,0x71 ,0xd ,0x0 ,0x20 ,0x3 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x20 ,0x3 ,0x45 ,0xd ,0x4 ,0x20 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x22 ,0x2 ,0x6a ,0x20 ,0x1 ,0x20 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x22 ,0x6 ,0x41 ,0x2 ,0x76 ,0x41 ,0x1 ,0x6a ,0x41 ,0x3 ,0x71 ,0x22 ,0x3 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x20 ,0x4 ,0x20 ,0x2 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x7c ,0x6a ,0x21 ,0x2 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x6 ,0x41 ,0xc ,0x49 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x70 ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x70 ,0x6a ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x2 ,0x6a ,0x22 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x5 ,0x20 ,0x2 ,0x6a ,0x22 ,0x4 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x4 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x4 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x20 ,0x4 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x41 ,0x70 ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x45 ,0xd ,0x2 ,0x20 ,0x2 ,0x21 ,0x3 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x3 ,0x71 ,0x22 ,0x4 ,0x45 ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x7f ,0x6a ,0x21 ,0x5 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x21 ,0x6 ,0x20 ,0x2 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x6 ,0x20 ,0x3 ,0x6a ,0x20 ,0x5 ,0x20 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7f ,0x6a ,0x21 ,0x3 ,0x20 ,0x4 ,0x41 ,0x7f ,0x6a ,0x22 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x2 ,0x41 ,0x4 ,0x49 ,0xd ,0x2 ,0x20 ,0x1 ,0x41 ,0x7c ,0x6a ,0x21 ,0x4 ,0x20 ,0x0 ,0x41 ,0x7c ,0x6a ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x5 ,0x20 ,0x3 ,0x6a ,0x22 ,0x1 ,0x41 ,0x3 ,0x6a ,0x20 ,0x4 ,0x20 ,0x3 ,0x6a ,0x22 ,0x2 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x20 ,0x2 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x1 ,0x20 ,0x2 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7c ,0x6a ,0x22 ,0x3 ,0xd ,0x0 ,0xc ,0x3 ,0xb ,0xb ,0x20 ,0x5 ,0x41 ,0x4 ,0x49 ,0xd ,0x0 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x7c ,0x6a ,0x22 ,0x4 ,0x41 ,0x2 ,0x76 ,0x41 ,0x1 ,0x6a ,0x41 ,0x7 ,0x71 ,0x22 ,0x2 ,0x45 ,0xd ,0x0 ,0x20 ,0x5 ,0x20 ,0x2 ,0x41 ,0x2 ,0x74 ,0x6b ,0x21 ,0x5 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x21 ,0x3 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x4 ,0x41 ,0x1c ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0xc ,0x6a ,0x20 ,0x1 ,0x41 ,0xc ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x10 ,0x6a ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x14 ,0x6a ,0x20 ,0x1 ,0x41 ,0x14 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x18 ,0x6a ,0x20 ,0x1 ,0x41 ,0x18 ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1c ,0x6a ,0x20 ,0x1 ,0x41 ,0x1c ,0x6a ,0x28 ,0x2 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x3 ,0x41 ,0x20 ,0x6a ,0x21 ,0x3 ,0x20 ,0x5 ,0x41 ,0x60 ,0x6a ,0x22 ,0x5 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x45 ,0xd ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x5 ,0x41 ,0x7 ,0x71 ,0x22 ,0x2 ,0xd ,0x0 ,0x20 ,0x5 ,0x21 ,0x4 ,0xc ,0x1 ,0xb ,0x20 ,0x5 ,0x41 ,0x78 ,0x71 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x7f ,0x6a ,0x22 ,0x2 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x5 ,0x41 ,0x8 ,0x49 ,0xd ,0x0 ,0x3 ,0x40 ,0x20 ,0x3 ,0x20 ,0x1 ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x1 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x2 ,0x6a ,0x20 ,0x1 ,0x41 ,0x2 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x3 ,0x6a ,0x20 ,0x1 ,0x41 ,0x3 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x4 ,0x6a ,0x20 ,0x1 ,0x41 ,0x4 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x5 ,0x6a ,0x20 ,0x1 ,0x41 ,0x5 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x6 ,0x6a ,0x20 ,0x1 ,0x41 ,0x6 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x7 ,0x6a ,0x20 ,0x1 ,0x41 ,0x7 ,0x6a ,0x2d ,0x0 ,0x0 ,0x3a ,0x0 ,0x0 ,0x20 ,0x3 ,0x41 ,0x8 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x8 ,0x6a ,0x21 ,0x1 ,0x20 ,0x4 ,0x41 ,0x78 ,0x6a ,0x22 ,0x4 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x0 ,0xb ,0xb ,0x2b ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x24 ,0x2 ,0x0 ,0x0 ,0x0 ,0x3 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0x7 ,0x0 ,0x0 ,0x0 ,0x8 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0xa ,0x0 ,0x0 ,0x0};
-
-static uint8_t depthconv[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x12 ,0x4 ,0x60 ,0x0 ,0x0 ,0x60 ,0x1 ,0x7f ,0x0 ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0xc ,0xb ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x2 ,0x3 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1a ,0x4 ,0x7f ,0x1 ,0x41 ,0xb0 ,0x89 ,0x1 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xb0 ,0xc ,0xb ,0x7f ,0x0 ,0x41 ,0xb0 ,0x89 ,0x1 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x8 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0x80 ,0x3 ,0xb ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x1c ,0x0 ,0x2 ,0x40 ,0x20 ,0x0 ,0x45 ,0xd ,0x0 ,0x3 ,0x40 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x0 ,0x41 ,0x7f ,0x6a ,0x22 ,0x0 ,0xd ,0x0 ,0xb ,0xb ,0xb ,0xbd ,0x1 ,0x2 ,0x4 ,0x7f ,0x1 ,0x7e ,0x41 ,0x0 ,0x21 ,0x0 ,0x3 ,0x40 ,0x20 ,0x0 ,0x21 ,0x1 ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x2 ,0x40 ,0x20 ,0x2 ,0x41 ,0x3 ,0x4b ,0xd ,0x0 ,0x20 ,0x1 ,0x41 ,0x80 ,0x8a ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x41 ,0x80 ,0x1 ,0x6a ,0x20 ,0x1 ,0x41 ,0x80 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x2c ,0x0 ,0x0 ,0x6c ,0x20 ,0x3 ,0x6a ,0x21 ,0x3 ,0xb ,0x20 ,0x1 ,0x41 ,0x20 ,0x6a ,0x21 ,0x1 ,0x20 ,0x2 ,0x41 ,0x1 ,0x6a ,0x22 ,0x2 ,0x41 ,0x4 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x0 ,0x41 ,0x90 ,0x8c ,0x80 ,0x80 ,0x0 ,0x6a ,0x42 ,0x1 ,0x41 ,0x1f ,0x20 ,0x0 ,0x41 ,0x2 ,0x74 ,0x22 ,0x1 ,0x41 ,0x80 ,0x89 ,0x80 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x6b ,0xac ,0x22 ,0x4 ,0x42 ,0x7f ,0x7c ,0x86 ,0x20 ,0x1 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x34 ,0x2 ,0x0 ,0x20 ,0x3 ,0xac ,0x7e ,0x7c ,0x20 ,0x4 ,0x87 ,0xa7 ,0x22 ,0x1 ,0x41 ,0x80 ,0x7f ,0x20 ,0x1 ,0x41 ,0x80 ,0x7f ,0x4a ,0x1b ,0x22 ,0x1 ,0x41 ,0xff ,0x0 ,0x20 ,0x1 ,0x41 ,0xff ,0x0 ,0x48 ,0x1b ,0x3a ,0x0 ,0x0 ,0x20 ,0x0 ,0x41 ,0x1 ,0x6a ,0x22 ,0x0 ,0x41 ,0x20 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0xd ,0x0 ,0x41 ,0xe7 ,0xc ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xb ,0x88 ,0x4 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0x80 ,0x4 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xb6 ,0x4a ,0xb7 ,0x44 ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0xf8 ,0xff ,0xff ,0xff ,0x3c ,0x39 ,0x3e ,0x44 ,0x38 ,0x22 ,0x22 ,0x2a ,0x3f ,0x39 ,0x1c ,0x1a ,0x24 ,0x18 ,0x7 ,0x19 ,0x1f ,0x0 ,0x1d ,0x23 ,0x1 ,0xb ,0x1 ,0x1e ,0x1b ,0x12 ,0xc ,0x13 ,0x9 ,0x8 ,0xfe ,0xfd ,0x3b ,0x3d ,0x3c ,0x3f ,0x34 ,0x1e ,0x1e ,0x2c ,0x3f ,0x39 ,0x18 ,0x16 ,0x1d ,0x17 ,0xf7 ,0x1b ,0x23 ,0xc ,0x1c ,0x22 ,0xfe ,0x12 ,0xa ,0x1c ,0x19 ,0x1a ,0x18 ,0xd ,0x6 ,0xf ,0xfc ,0xfb ,0x31 ,0x39 ,0x3d ,0x3b ,0x2a ,0x25 ,0x26 ,0x2d ,0x3e ,0x35 ,0x13 ,0x11 ,0x22 ,0x19 ,0xf7 ,0x20 ,0x27 ,0x8 ,0x1d ,0x23 ,0x0 ,0x19 ,0x11 ,0x1a ,0x18 ,0x1b ,0x18 ,0x8 ,0x9 ,0x17 ,0xf8 ,0xfd ,0x41 ,0x3c ,0x36 ,0x37 ,0x29 ,0x1b ,0x1b ,0x26 ,0x36 ,0x2e ,0x12 ,0x16 ,0x26 ,0x1e ,0x0 ,0x1d ,0x25 ,0xa ,0x1e ,0x23 ,0x4 ,0x24 ,0x1b ,0x21 ,0x1f ,0x16 ,0x11 ,0x9 ,0x13 ,0x23 ,0xfe ,0x1 ,0xcf ,0xc5 ,0x2b ,0xba ,0xe5 ,0x2f ,0x1 ,0x5c ,0xcd ,0x29 ,0x2e ,0xcd ,0xd6 ,0x2c ,0x37 ,0x34 ,0xc5 ,0x3f ,0x44 ,0xc4 ,0xb7 ,0x38 ,0x3c ,0x30 ,0x4c ,0x36 ,0xbf ,0xd2 ,0x3f ,0xa9 ,0x3d ,0x4b ,0x83 ,0xef ,0x9e ,0xee ,0xe3 ,0x3d ,0xe0 ,0x2a ,0xb3 ,0xcf ,0x27 ,0xc9 ,0xf5 ,0x2b ,0xee ,0x47 ,0xfd ,0x7f ,0x27 ,0xba ,0xbd ,0xf0 ,0xc1 ,0x37 ,0xd4 ,0x25 ,0x26 ,0xe0 ,0xe9 ,0x25 ,0x1f ,0x2d ,0x52 ,0x34 ,0xc7 ,0xca ,0x32 ,0xad ,0x3a ,0x3f ,0xa6 ,0xb2 ,0xa0 ,0x6 ,0xf9 ,0x49 ,0xf3 ,0x14 ,0xc9 ,0x3c ,0x3d ,0xd6 ,0xc6 ,0x34 ,0x28 ,0x2b ,0x28 ,0x29 ,0xd6 ,0xcc ,0x28 ,0xce ,0x2a ,0x19 ,0xd5 ,0xe1 ,0x36 ,0xe ,0x3e ,0xbe ,0xd2 ,0xd1 ,0x2e ,0x65 ,0x5e ,0xc2 ,0xc2 ,0xe3 ,0xce ,0x25 ,0x1e ,0x29 ,0xcf ,0xd3 ,0x32 ,0xc9 ,0x2e ,0x26 ,0xf5 ,0xda ,0x2a ,0xd ,0x40 ,0xaa ,0xe0 ,0xbb};
-
-static uint8_t xgboost[] __attribute__((aligned (4))) = {0x0 ,0x61 ,0x73 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x13 ,0x4 ,0x60 ,0x0 ,0x0 ,0x60 ,0x1 ,0x7f ,0x1 ,0x7f ,0x60 ,0x0 ,0x1 ,0x7f ,0x60 ,0x2 ,0x7f ,0x7f ,0x1 ,0x7f ,0x3 ,0xc ,0xb ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x1 ,0x3 ,0x0 ,0x2 ,0x0 ,0x0 ,0x4 ,0x5 ,0x1 ,0x70 ,0x1 ,0x1 ,0x1 ,0x5 ,0x3 ,0x1 ,0x0 ,0x1 ,0x6 ,0x1b ,0x4 ,0x7f ,0x1 ,0x41 ,0xc0 ,0xba ,0x3 ,0xb ,0x7f ,0x0 ,0x41 ,0x0 ,0xb ,0x7f ,0x0 ,0x41 ,0xb4 ,0xbd ,0x2 ,0xb ,0x7f ,0x0 ,0x41 ,0xc0 ,0xba ,0x3 ,0xb ,0x7 ,0x3a ,0x5 ,0x6 ,0x6d ,0x65 ,0x6d ,0x6f ,0x72 ,0x79 ,0x2 ,0x0 ,0xb ,0x5f ,0x69 ,0x6e ,0x69 ,0x74 ,0x69 ,0x61 ,0x6c ,0x69 ,0x7a ,0x65 ,0x0 ,0x1 ,0x4 ,0x5f ,0x72 ,0x75 ,0x6e ,0x0 ,0x8 ,0xa ,0x5f ,0x5f ,0x64 ,0x61 ,0x74 ,0x61 ,0x5f ,0x65 ,0x6e ,0x64 ,0x3 ,0x2 ,0xb ,0x5f ,0x5f ,0x68 ,0x65 ,0x61 ,0x70 ,0x5f ,0x62 ,0x61 ,0x73 ,0x65 ,0x3 ,0x3 ,0xa ,0xb8 ,0x5 ,0xb ,0x2 ,0x0 ,0xb ,0x32 ,0x0 ,0x2 ,0x40 ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0xbd ,0x82 ,0x80 ,0x0 ,0x6a ,0x28 ,0x2 ,0x0 ,0x45 ,0xd ,0x0 ,0x0 ,0x0 ,0xb ,0x23 ,0x81 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0xb0 ,0xbd ,0x82 ,0x80 ,0x0 ,0x6a ,0x41 ,0x1 ,0x36 ,0x2 ,0x0 ,0x10 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0xab ,0x1 ,0x1 ,0x5 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x1 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x2 ,0x40 ,0x2 ,0x40 ,0x20 ,0x0 ,0xd ,0x0 ,0x41 ,0x0 ,0x21 ,0x2 ,0xc ,0x1 ,0xb ,0x41 ,0x0 ,0x21 ,0x2 ,0x41 ,0x0 ,0x21 ,0x3 ,0x3 ,0x40 ,0x20 ,0x1 ,0x41 ,0x0 ,0x36 ,0x2 ,0xc ,0x2 ,0x40 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x41 ,0xff ,0x0 ,0x4b ,0xd ,0x0 ,0x3 ,0x40 ,0x41 ,0xb0 ,0xfc ,0x81 ,0x80 ,0x0 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x41 ,0x6 ,0x74 ,0x6a ,0x10 ,0x85 ,0x80 ,0x80 ,0x80 ,0x0 ,0x21 ,0x4 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x21 ,0x5 ,0x20 ,0x1 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x41 ,0x1 ,0x6a ,0x36 ,0x2 ,0xc ,0x20 ,0x2 ,0x20 ,0x4 ,0x20 ,0x5 ,0x41 ,0xb0 ,0xbc ,0x82 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x46 ,0x6a ,0x21 ,0x2 ,0x20 ,0x1 ,0x28 ,0x2 ,0xc ,0x41 ,0x80 ,0x1 ,0x49 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x3 ,0x41 ,0x1 ,0x6a ,0x22 ,0x3 ,0x20 ,0x0 ,0x47 ,0xd ,0x0 ,0xb ,0xb ,0x20 ,0x1 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0xb ,0xa ,0x0 ,0x41 ,0x1 ,0x10 ,0x82 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xe8 ,0x2 ,0x1 ,0xd ,0x7f ,0x41 ,0x0 ,0x21 ,0x1 ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x20 ,0x6b ,0x22 ,0x2 ,0x41 ,0x10 ,0x6a ,0x41 ,0x0 ,0x36 ,0x2 ,0x0 ,0x20 ,0x2 ,0x42 ,0x0 ,0x37 ,0x3 ,0x8 ,0x20 ,0x2 ,0x42 ,0x0 ,0x37 ,0x3 ,0x0 ,0x41 ,0x28 ,0x21 ,0x3 ,0x41 ,0x0 ,0x21 ,0x4 ,0x41 ,0x0 ,0x21 ,0x5 ,0x41 ,0x0 ,0x21 ,0x6 ,0x3 ,0x40 ,0x20 ,0x2 ,0x20 ,0x6 ,0x41 ,0x1 ,0x74 ,0x6a ,0x22 ,0x7 ,0x2f ,0x1 ,0x0 ,0x21 ,0x8 ,0x20 ,0x1 ,0x21 ,0x9 ,0x3 ,0x40 ,0x20 ,0x4 ,0x41 ,0xe0 ,0xba ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0xa ,0x20 ,0x4 ,0x41 ,0x90 ,0x8b ,0x80 ,0x80 ,0x0 ,0x6a ,0x21 ,0xb ,0x20 ,0x9 ,0x41 ,0x80 ,0x88 ,0x80 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x21 ,0xc ,0x41 ,0x0 ,0x21 ,0xd ,0x3 ,0x40 ,0x41 ,0xb0 ,0xea ,0x80 ,0x80 ,0x0 ,0x41 ,0x80 ,0x9a ,0x81 ,0x80 ,0x0 ,0x20 ,0x0 ,0x20 ,0xb ,0x20 ,0xd ,0x41 ,0xff ,0x1 ,0x71 ,0x22 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x20 ,0xa ,0x20 ,0xd ,0x6a ,0x2d ,0x0 ,0x0 ,0x49 ,0x1b ,0x20 ,0x4 ,0x6a ,0x20 ,0xd ,0x6a ,0x2c ,0x0 ,0x0 ,0x22 ,0xd ,0x41 ,0x7f ,0x4a ,0xd ,0x0 ,0xb ,0x20 ,0x4 ,0x20 ,0xc ,0x6a ,0x21 ,0x4 ,0x20 ,0x8 ,0x20 ,0x5 ,0x20 ,0xd ,0x41 ,0xff ,0x0 ,0x71 ,0x6a ,0x41 ,0xd0 ,0xc9 ,0x81 ,0x80 ,0x0 ,0x6a ,0x2d ,0x0 ,0x0 ,0x6a ,0x21 ,0x8 ,0x20 ,0x5 ,0x20 ,0xc ,0x6a ,0x41 ,0x1 ,0x6a ,0x22 ,0xd ,0x21 ,0x5 ,0x20 ,0x9 ,0x41 ,0x1 ,0x6a ,0x22 ,0x9 ,0x20 ,0x3 ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x7 ,0x20 ,0x8 ,0x3b ,0x1 ,0x0 ,0x20 ,0x3 ,0x41 ,0x28 ,0x6a ,0x21 ,0x3 ,0x20 ,0x1 ,0x41 ,0x28 ,0x6a ,0x21 ,0x1 ,0x20 ,0xd ,0x21 ,0x5 ,0x20 ,0x6 ,0x41 ,0x1 ,0x6a ,0x22 ,0x6 ,0x41 ,0xa ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0x2 ,0x41 ,0x2 ,0x72 ,0x21 ,0xd ,0x41 ,0x0 ,0x21 ,0xa ,0x20 ,0x2 ,0x2f ,0x1 ,0x0 ,0x21 ,0xb ,0x41 ,0x1 ,0x21 ,0x4 ,0x3 ,0x40 ,0x20 ,0xd ,0x2f ,0x1 ,0x0 ,0x22 ,0x0 ,0x20 ,0xb ,0x41 ,0xff ,0xff ,0x3 ,0x71 ,0x22 ,0xb ,0x20 ,0x0 ,0x20 ,0xb ,0x4b ,0x22 ,0x0 ,0x1b ,0x21 ,0xb ,0x20 ,0x4 ,0x20 ,0xa ,0x20 ,0x0 ,0x1b ,0x21 ,0xa ,0x20 ,0xd ,0x41 ,0x2 ,0x6a ,0x21 ,0xd ,0x20 ,0x4 ,0x41 ,0x1 ,0x6a ,0x22 ,0x4 ,0x41 ,0xa ,0x47 ,0xd ,0x0 ,0xb ,0x20 ,0xa ,0x41 ,0xff ,0x1 ,0x71 ,0xb ,0x45 ,0x1 ,0x1 ,0x7f ,0x23 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x10 ,0x6b ,0x22 ,0x2 ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x87 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x84 ,0x80 ,0x80 ,0x80 ,0x0 ,0x10 ,0x89 ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x10 ,0x83 ,0x80 ,0x80 ,0x80 ,0x0 ,0x36 ,0x2 ,0xc ,0x10 ,0x8a ,0x80 ,0x80 ,0x80 ,0x0 ,0x20 ,0x2 ,0x41 ,0x10 ,0x6a ,0x24 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x41 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xc ,0x0 ,0x41 ,0x0 ,0x41 ,0x0 ,0x10 ,0x86 ,0x80 ,0x80 ,0x80 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0x2 ,0x0 ,0xb ,0xb ,0xb9 ,0xb5 ,0x2 ,0x1 ,0x0 ,0x41 ,0x80 ,0x8 ,0xb ,0xb0 ,0xb5 ,0x2 ,0x1f ,0x19 ,0x1c ,0x1e ,0x17 ,0x19 ,0x17 ,0x17 ,0x18 ,0x14 ,0x12 ,0x15 ,0x13 ,0x15 ,0x11 ,0x12 ,0x10 ,0xe ,0xb ,0xe ,0xa ,0x9 ,0xa ,0x8 ,0x8 ,0xa ,0x6 ,0x9 ,0x5 ,0x7 ,0x3 ,0x1 ,0x6 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1a ,0x18 ,0x19 ,0x1a ,0x17 ,0x15 ,0x17 ,0x11 ,0x12 ,0x11 ,0x13 ,0x11 ,0x10 ,0xf ,0xe ,0x11 ,0xf ,0xe ,0xc ,0xc ,0xc ,0xb ,0xd ,0x7 ,0xd ,0xe ,0xb ,0xb ,0x8 ,0x8 ,0x1 ,0x5 ,0x4 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1e ,0x1d ,0x1d ,0x1c ,0x1e ,0x1d ,0x1c ,0x1d ,0x1d ,0x1c ,0x18 ,0x1c ,0x1b ,0x17 ,0x1a ,0x14 ,0x15 ,0x18 ,0x13 ,0x13 ,0x10 ,0x14 ,0xe ,0xe ,0x11 ,0xf ,0x9 ,0x8 ,0xb ,0xd ,0xe ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1f ,0x1f ,0x1f ,0x1f ,0x1e ,0x1e ,0x1f ,0x18 ,0x1f ,0x1b ,0x15 ,0x19 ,0x1a ,0x17 ,0x1a ,0x14 ,0xe ,0x14 ,0x15 ,0x14 ,0xf ,0xc ,0x14 ,0x14 ,0x12 ,0x8 ,0xa ,0x10 ,0x11 ,0xb ,0x9 ,0x6 ,0x7 ,0xc ,0x5 ,0xc ,0x1 ,0x1 ,0x1 ,0x1 ,0x1f ,0x1e ,0x1e ,0x1c ,0x18 ,0x17 ,0x15 ,0x19 ,0x17 ,0x16 ,0x18 ,0x13 ,0x15 ,0x15 ,0x15 ,0x11 ,0xe ,0xe ,0x13 ,0x10 ,0x16 ,0x16 ,0x11 ,0x11 ,0xf ,0xf ,0xd ,0xd ,0xc ,0x9 ,0xb ,0xe ,0xf ,0xa ,0x3 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1f ,0x1f ,0x1e ,0x1d ,0x1c ,0x1f ,0x1b ,0x1b ,0x1c ,0x19 ,0x1c ,0x1a ,0x17 ,0x19 ,0x18 ,0x18 ,0x18 ,0x12 ,0x18 ,0x17 ,0x14 ,0x10 ,0xd ,0x11 ,0x10 ,0xe ,0xa ,0x13 ,0x7 ,0xb ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1d ,0x1c ,0x1b ,0x19 ,0x19 ,0x17 ,0x1a ,0x15 ,0x14 ,0xf ,0x16 ,0x17 ,0x10 ,0x13 ,0xf ,0xe ,0x13 ,0xa ,0xa ,0xf ,0x11 ,0xa ,0x8 ,0xc ,0x9 ,0xd ,0x10 ,0x9 ,0x6 ,0x9 ,0x9 ,0x7 ,0x4 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x18 ,0x14 ,0x16 ,0x19 ,0x18 ,0x1a ,0x13 ,0x10 ,0x12 ,0x17 ,0x13 ,0xf ,0x14 ,0x12 ,0x14 ,0x10 ,0x11 ,0x12 ,0x17 ,0xb ,0xe ,0xf ,0x10 ,0xc ,0xd ,0xf ,0x9 ,0x10 ,0x8 ,0xc ,0x9 ,0xc ,0xc ,0x1 ,0xb ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1d ,0x1c ,0x1b ,0x17 ,0x16 ,0x17 ,0x18 ,0x14 ,0x18 ,0x19 ,0x19 ,0x17 ,0x13 ,0x1a ,0x15 ,0xf ,0x14 ,0xa ,0x14 ,0x15 ,0x11 ,0x12 ,0x10 ,0xb ,0x12 ,0x13 ,0xc ,0xe ,0xa ,0x15 ,0x11 ,0xb ,0x10 ,0x7 ,0xb ,0x6 ,0x3 ,0x9 ,0x1 ,0x1 ,0x1a ,0x18 ,0x17 ,0x11 ,0x11 ,0x10 ,0x11 ,0x19 ,0x14 ,0x10 ,0x19 ,0x15 ,0x8 ,0x17 ,0xe ,0x14 ,0xf ,0xc ,0x9 ,0x6 ,0x13 ,0x11 ,0x14 ,0x11 ,0xb ,0xd ,0x8 ,0x8 ,0x5 ,0xf ,0xb ,0x10 ,0xe ,0xc ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x1 ,0x24 ,0x24 ,0x1e ,0x24 ,0xd ,0xd ,0x14 ,0xd ,0x29 ,0x22 ,0x21 ,0x22 ,0x31 ,0x32 ,0x1c ,0x14 ,0x1c ,0x32 ,0x26 ,0x1a ,0x23 ,0x27 ,0x33 ,0xc ,0x21 ,0x22 ,0x22 ,0x2d ,0x14 ,0x32 ,0x13 ,0x24 ,0x24 ,0x1e ,0xd ,0x32 ,0x22 ,0x14 ,0x24 ,0x29 ,0x1e ,0x2a ,0x1f ,0x1d ,0x32 ,0x1a ,0x2e ,0x16 ,0x32 ,0x26 ,0x1c ,0x27 ,0x30 ,0x15 ,0x22 ,0x1c ,0x24 ,0x24 ,0x1e ,0x32 ,0x14 ,0x22 ,0x32 ,0x24 ,0x1e ,0x1d ,0x2a ,0x32 ,0x1d ,0xa ,0x1c ,0x32 ,0x26 ,0x16 ,0x25 ,0x27 ,0x33 ,0x14 ,0x1f ,0x1b ,0x14 ,0x16 ,0x1e ,0x22 ,0x24 ,0x32 ,0x24 ,0x29 ,0xc ,0x1b ,0x33 ,0x1f ,0x25 ,0x22 ,0x21 ,0x1e ,0x24 ,0x1e ,0x14 ,0x1c ,0x32 ,0x1e ,0x1a ,0x1d ,0x27 ,0x33 ,0x15 ,0x1f ,0x14 ,0x1d ,0x22 ,0x14 ,0x21 ,0x16 ,0x24 ,0x1e ,0x24 ,0x33 ,0x32 ,0x1c ,0x32 ,0x1d ,0x15 ,0x14 ,0x24 ,0x14 ,0x1a ,0x16 ,0x32 ,0x1e ,0x1c ,0x1f ,0x27 ,0x31 ,0x15 ,0x1c ,0x33 ,0x24 ,0x32 ,0x24 ,0x14 ,0x2a ,0x2a ,0x15 ,0x22 ,0x21 ,0x23 ,0xa ,0x1b ,0x1c ,0x32 ,0x22 ,0x26 ,0x21 ,0x27 ,0x33 ,0x14 ,0x1e ,0x1d ,0x16 ,0x22 ,0x1e ,0x24 ,0x32 ,0x24 ,0x33 ,0x1f ,0x1c ,0x22 ,0x21 ,0x24 ,0x36 ,0x14 ,0x16 ,0x32 ,0x1e ,0x1a ,0x1f ,0x24 ,0x2b ,0xc ,0x15 ,0x22 ,0x1c ,0x23 ,0x24 ,0x32 ,0x29 ,0x24 ,0x33 ,0x1a ,0x16 ,0x22 ,0x21 ,0x24 ,0x14 ,0x1c ,0x32 ,0x22 ,0x2b ,0x21 ,0x1f ,0x33 ,0x14 ,0x1e ,0x1d ,0x16 ,0x1e ,0x24 ,0x32 ,0x24 ,0x2a ,0x29 ,0x3b ,0x22 ,0x21 ,0x3b ,0x23 ,0x1b ,0x1c ,0xd ,0x2b ,0x2a ,0x1b ,0x2a ,0x14 ,0x14 ,0x1e ,0x1d ,0x16 ,0x1c ,0x1e ,0x24 ,0x2a ,0x29 ,0x14 ,0x23 ,0x14 ,0x24 ,0x36 ,0x24 ,0x22 ,0x1c ,0x32 ,0x22 ,0x3b ,0x21 ,0x1f ,0x33 ,0x14 ,0x1e ,0x16 ,0x24 ,0x2a ,0x14 ,0x24 ,0x15 ,0x3a ,0x16 ,0x2a ,0x3b ,0x24 ,0x1c ,0x17 ,0x21 ,0xd ,0x1f ,0x1f ,0x22 ,0x25 ,0x24 ,0x1b ,0x1e ,0x23 ,0x2c ,0x22 ,0x23 ,0x15 ,0x25 ,0x21 ,0x22 ,0x23 ,0x1d ,0x2a ,0x3b ,0x1f ,0xd ,0x16 ,0x3 ,0x3b ,0x1e ,0x24 ,0x2a ,0x29 ,0x14 ,0x24 ,0x1d ,0x1c ,0x32 ,0x2b ,0xd ,0x1b ,0x24 ,0x33 ,0x14 ,0x21 ,0x13 ,0x22 ,0x1c ,0x21 ,0x24 ,0x2a ,0x29 ,0x3a ,0x23 ,0x35 ,0x22 ,0x2c ,0x2e ,0x21 ,0x22 ,0x23 ,0x1d ,0x2a ,0x25 ,0x1f ,0xd ,0x13 ,0x3b ,0x2a ,0x35 ,0x24 ,0x2a ,0x29 ,0x23 ,0x3a ,0x15 ,0xa ,0x1a ,0x1c ,0x22 ,0x33 ,0x15 ,0x1f ,0x21 ,0x25 ,0x14 ,0x16 ,0x24 ,0x2a ,0x29 ,0x3a ,0x23 ,0x15 ,0x14 ,0x2a ,0x3b ,0x1c ,0x22 ,0x1e ,0x1f ,0x22 ,0x21 ,0x29 ,0x19 ,0x1d ,0x24 ,0x14 ,0x26 ,0x16 ,0x23 ,0x24 ,0x2a ,0x1c ,0x3b ,0x3d ,0x22 ,0x1e ,0x1d ,0x29 ,0x16 ,0x23 ,0x24 ,0x14 ,0x1c ,0x33 ,0x1f ,0x22 ,0x29 ,0x22 ,0x15 ,0x21 ,0x1e ,0x1d ,0x13 ,0x3 ,0x24 ,0x2a ,0x2a ,0x3e ,0x2 ,0x1c ,0x3c ,0x2d ,0x29 ,0x17 ,0x3b ,0x2a ,0x29 ,0x23 ,0x16 ,0x2b ,0x22 ,0x1e ,0x4 ,0x1f ,0x3a ,0x1c ,0x2 ,0x14 ,0x24 ,0x24 ,0x29 ,0x3e ,0x15 ,0x24 ,0x14 ,0x16 ,0x1c ,0x22 ,0x2d ,0x2a ,0x28 ,0x21 ,0x22 ,0x33 ,0x23 ,0x15 ,0x3d ,0x1f ,0x2a ,0x29 ,0x3e ,0x1a ,0x14 ,0x24 ,0x5 ,0x3c ,0x21 ,0x24 ,0x2a ,0x29 ,0x3e ,0x22 ,0x23 ,0x2b ,0x1b ,0x27 ,0x24 ,0x9 ,0x1c ,0x15 ,0x1b ,0x1f ,0x14 ,0x21 ,0x32 ,0x2d ,0xa ,0x2c ,0x13 ,0x1b ,0x35 ,0x3b ,0x2e ,0x23 ,0x1f ,0x15 ,0x24 ,0x9 ,0x1a ,0x21 ,0x2a ,0x28 ,0x33 ,0x22 ,0x21 ,0x1a ,0x25 ,0x20 ,0x3d ,0x3d ,0x2d ,0x4 ,0x3b ,0x21 ,0x24 ,0x13 ,0xa ,0x24 ,0x1b ,0x25 ,0x2e ,0x2a ,0x3e ,0x30 ,0x0 ,0x1f ,0x15 ,0xe ,0xc ,0x1e ,0x36 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x12 ,0x25 ,0x2c ,0x26 ,0x15 ,0x15 ,0x16 ,0x1c ,0xa ,0x22 ,0x9 ,0x24 ,0x2d ,0x1e ,0x1a ,0xa ,0x1c ,0x15 ,0x13 ,0x13 ,0x32 ,0x14 ,0x25 ,0x31 ,0x22 ,0x2c ,0x1a ,0x1a ,0x25 ,0x16 ,0x1c ,0x14 ,0x25 ,0x1c ,0x34 ,0x2b ,0x15 ,0x1c ,0x2a ,0xa ,0x25 ,0x29 ,0x1b ,0x34 ,0x1c ,0xc ,0x2d ,0x15 ,0x9 ,0x25 ,0x1a ,0x25 ,0x1c ,0x25 ,0x2c ,0x26 ,0x12 ,0x16 ,0x1c ,0x34 ,0xb ,0x22 ,0x14 ,0x1d ,0x25 ,0xa ,0x29 ,0x1b ,0x34 ,0x15 ,0x2b ,0x1c ,0xc ,0x1d ,0x2d ,0x1a ,0x25 ,0x1c ,0x25 ,0x2c ,0x2e ,0x12 ,0x16 ,0x1c ,0x13 ,0xb ,0x2c ,0x2d ,0x2a ,0x25 ,0x36 ,0x12 ,0x16 ,0x15 ,0x2a ,0xb ,0x2c ,0x1c ,0xb ,0x2d ,0x2d ,0x1a ,0x25 ,0x1c ,0x25 ,0x2c ,0x26 ,0x12 ,0x16 ,0x1c ,0x13 ,0xb ,0x14 ,0xd ,0x4 ,0x25 ,0xa ,0x29 ,0x2d ,0x15 ,0x9 ,0x1c ,0xc ,0x25 ,0x1a ,0x1e ,0x1c ,0x1a ,0x2b ,0x14 ,0xd ,0x25 ,0x13 ,0x2d ,0x24 ,0x4 ,0x25 ,0xa ,0x29 ,0x2d ,0x15 ,0xb ,0x2c ,0x1c ,0x24 ,0x12 ,0x1d ,0x34 ,0x1e ,0x11 ,0x22 ,0x1c ,0x15 ,0x2c ,0x25 ,0xe ,0x2d ,0x1e ,0x1c ,0x29 ,0x32 ,0x13 ,0x1d ,0x4 ,0x22 ,0x14 ,0x3a ,0x5 ,0x12 ,0x1e ,0x2c ,0x22 ,0x3b ,0x15 ,0x14 ,0x1c ,0x2d ,0x29 ,0x1d ,0x1c ,0xb ,0xb ,0x39 ,0x32 ,0x22 ,0x12 ,0x1e ,0x15 ,0x34 ,0x5 ,0x2c ,0x2d ,0x22 ,0x25 ,0x2d ,0x17 ,0xa ,0x1c ,0x32 ,0x14 ,0x2c ,0x1c ,0x2b ,0x1a ,0x1e ,0x14 ,0xd ,0x1b ,0x4 ,0x2d ,0x2a ,0x25 ,0x2d ,0xa ,0x13 ,0x15 ,0xe ,0x2c ,0x1c ,0x1c ,0x25 ,0x24 ,0x22 ,0x1c ,0x1e ,0x12 ,0x15 ,0xb ,0x22 ,0x13 ,0xc ,0xd ,0x16 ,0x1c ,0xa ,0x5 ,0xb ,0x17 ,0x14 ,0x25 ,0x24 ,0x1e ,0x19 ,0x1a ,0x1d ,0x22 ,0x9 ,0x2d ,0xb ,0x1c ,0x15 ,0x14 ,0x15 ,0x1c ,0x1c ,0x23 ,0x25 ,0x24 ,0x22 ,0x1e ,0x1a ,0x1c ,0xb ,0x13 ,0x15 ,0x15 ,0xb ,0x6 ,0x14 ,0x15 ,0x1c ,0x23 ,0x25 ,0x1c ,0x22 ,0x34 ,0x14 ,0x15 ,0x12 ,0x13 ,0x3a ,0x16 ,0x1d ,0x31 ,0x5 ,0xc ,0x2e ,0x25 ,0x1c ,0x1c ,0x15 ,0x13 ,0x14 ,0x6 ,0x5 ,0x25 ,0x12 ,0xb ,0x15 ,0x15 ,0x3 ,0x26 ,0x1d ,0x22 ,0x9 ,0x25 ,0x1c ,0x15 ,0x13 ,0x36 ,0xc ,0x1c ,0x1d ,0x3b ,0x12 ,0x16 ,0xb ,0x13 ,0x25 ,0x24 ,0x22 ,0x1c ,0x34 ,0x14 ,0x21 ,0x2b ,0x36 ,0x13 ,0x3a ,0x3b ,0x34 ,0xb ,0x12 ,0x25 ,0x24 ,0x15 ,0xb ,0x14 ,0x23 ,0x12 ,0x2c ,0x1c ,0x1c ,0xd ,0x11 ,0x2b ,0x4 ,0x26 ,0x15 ,0xb ,0x14 ,0x23 ,0x12 ,0x34 ,0x1c ,0xe ,0x13 ,0x25 ,0x2d ,0x25 ,0x2c ,0x14 ,0x3b ,0x13 ,0xb ,0x22 ,0x34 ,0x1b ,0x4 ,0x2 ,0x23 ,0x22 ,0x1c ,0x15 ,0x13 ,0x33 ,0x36 ,0xc ,0x29 ,0x13 ,0x25 ,0x24 ,0xa ,0x26 ,0x36 ,0x1c ,0x15 ,0x13 ,0x25 ,0x12 ,0x23 ,0x1b ,0x5 ,0x1d ,0x22 ,0x1c ,0xb ,0x14 ,0xc ,0x15 ,0x1b ,0x1c ,0x14 ,0x1c ,0x4 ,0x2a ,0x3c ,0x25 ,0x14 ,0x15 ,0x13 ,0x36 ,0x23 ,0x4 ,0x22 ,0x1c ,0x23 ,0x12 ,0x16 ,0x36 ,0x1c ,0x25 ,0x13 ,0x1d ,0x2c ,0x31 ,0x2b ,0x26 ,0x36 ,0x1c ,0x25 ,0x34 ,0x15 ,0x13 ,0x1d ,0x31 ,0x15 ,0x13 ,0x4 ,0x15 ,0x12 ,0x25 ,0x34 ,0x34 ,0x14 ,0x15 ,0x15 ,0x2b ,0x2c ,0x2a ,0x31 ,0x15 ,0x22 ,0x36 ,0x2d ,0x2c ,0x2b ,0x1d ,0x2b ,0x2c ,0x32 ,0x1e ,0x1b ,0x21 ,0x34 ,0x2a ,0x34 ,0x2d ,0x23 ,0x2b ,0x36 ,0x26 ,0x36 ,0x2b ,0x32 ,0x12 ,0x2c ,0x3c ,0x2b ,0x25 ,0x21 ,0x3b ,0x14 ,0x1b ,0xb ,0x15 ,0xb ,0x5 ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x37 ,0x1b ,0x2f ,0x29 ,0x3 ,0x1a ,0x1a ,0x19 ,0x34 ,0x12 ,0x32 ,0xc ,0x19 ,0x4 ,0x2a ,0x29 ,0x1a ,0x19 ,0x2b ,0xb ,0x1c ,0x21 ,0x2c ,0x2c ,0x26 ,0x36 ,0x34 ,0x1a ,0x19 ,0x31 ,0x37 ,0x1b ,0x2f ,0x13 ,0x2a ,0x4 ,0x1a ,0x1e ,0x3c ,0x4 ,0x30 ,0x2f ,0x22 ,0x1a ,0x21 ,0x2a ,0x1a ,0x19 ,0x2b ,0x3a ,0x3d ,0x21 ,0x2c ,0x3c ,0x26 ,0x1d ,0x31 ,0x1e ,0x1f ,0x1a ,0x37 ,0x28 ,0x2f ,0x12 ,0x35 ,0x2b ,0x26 ,0x2c ,0x1f ,0x31 ,0x30 ,0x26 ,0x35 ,0x36 ,0x27 ,0x29 ,0x3 ,0x1b ,0x3c ,0x3a ,0x2 ,0x2b ,0x1b ,0x19 ,0x25 ,0x2c ,0x25 ,0x1c ,0x1a ,0x37 ,0x12 ,0x2f ,0x3c ,0x19 ,0x21 ,0x4 ,0xc ,0x2c ,0x26 ,0x3c ,0x35 ,0x26 ,0x36 ,0x27 ,0x14 ,0x2a ,0x1b ,0x3b ,0x27 ,0x2b ,0x1b ,0x19 ,0x37 ,0x2c ,0x37 ,0x1c ,0x1a ,0x37 ,0x12 ,0x2f ,0x31 ,0x19 ,0x19 ,0x2c ,0x3d ,0x2e ,0x2b ,0x2b ,0x1f ,0x2d ,0x31 ,0x2a ,0x36 ,0x21 ,0x27 ,0x11 ,0x2b ,0x2c ,0x1b ,0x1b ,0x19 ,0x2d ,0x21 ,0x2f ,0x36 ,0x22 ,0x1a ,0x3c ,0x37 ,0x4 ,0x2c ,0x2c ,0x32 ,0x36 ,0x33 ,0x2f ,0x35 ,0xd ,0x1e ,0x37 ,0x36 ,0x27 ,0x1c ,0x4 ,0x29 ,0x3c ,0x19 ,0x2 ,0x2b ,0x32 ,0x1b ,0x25 ,0x2a ,0x1c ,0x23 ,0x1a ,0x3c ,0x4 ,0x2c ,0x37 ,0x22 ,0x36 ,0x33 ,0x2f ,0x16 ,0x31 ,0x12 ,0x26 ,0x2a ,0x36 ,0x21 ,0x1b ,0x19 ,0x1b ,0x33 ,0x3c ,0x1b ,0x19 ,0xb ,0x21 ,0x2f ,0x36 ,0x1d ,0x1a ,0x37 ,0x12 ,0x32 ,0x27 ,0x22 ,0x1b ,0x24 ,0x21 ,0x3d ,0x26 ,0x2d ,0x2d ,0x15 ,0x36 ,0x27 ,0x1b ,0x2e ,0x2a ,0x3c ,0x3a ,0x2 ,0x2b ,0x32 ,0x1b ,0x25 ,0x3c ,0x2d ,0x22 ,0x2a ,0x36 ,0x1b ,0x2f ,0x5 ,0xd ,0xb ,0x3 ,0x3d ,0x2b ,0x2c ,0x1c ,0x1b ,0x35 ,0x3d ,0x1a ,0x12 ,0x22 ,0x2f ,0x2b ,0x13 ,0x2e ,0x1b ,0x19 ,0x3b ,0x21 ,0x2f ,0x13 ,0x1d ,0x3 ,0x3b ,0x1b ,0x32 ,0x37 ,0x1b ,0x3 ,0x3d ,0x2b ,0x32 ,0x2d ,0x1b ,0x15 ,0x3d ,0x3c ,0x13 ,0x19 ,0x23 ,0x2a ,0x2b ,0x27 ,0x36 ,0x27 ,0x1b ,0x1e ,0x26 ,0x39 ,0x2b ,0x3 ,0x3b ,0x1b ,0x33 ,0x1b ,0xb ,0x32 ,0x33 ,0x3c ,0x2f ,0xd ,0x19 ,0x32 ,0x13 ,0x36 ,0x2 ,0x1b ,0xb ,0x26 ,0x2c ,0x2a ,0x19 ,0xc ,0x3c ,0x2a ,0x1b ,0x3c ,0x36 ,0x33 ,0x2c ,0x3 ,0x2f ,0x29 ,0x2c ,0x2b ,0x1c ,0x22 ,0x1a ,0x22 ,0x12 ,0x2f ,0x19 ,0x21 ,0x1b ,0x12 ,0x1b ,0x23 ,0x3a ,0x1c ,0x2f ,0x36 ,0x1d ,0x3 ,0x3b ,0x33 ,0x1b ,0x32 ,0x12 ,0x36 ,0x3d ,0x1b ,0x3c ,0x2c ,0x23 ,0x27 ,0x32 ,0x1a ,0x13 ,0x12 ,0x23 ,0x1c ,0x1a ,0x21 ,0x2b ,0x1c ,0x2a ,0x32 ,0x1a ,0xb ,0x1a ,0x36 ,0x27 ,0x1c ,0x2 ,0x1b ,0x16 ,0x31 ,0x3c ,0x19 ,0x3c ,0x23 ,0x2d ,0x21 ,0x3d ,0x12 ,0x22 ,0x2f ,0x2b ,0x2a ,0x1b ,0x13 ,0x1e ,0x2a ,0x1b ,0x29 ,0x37 ,0x27 ,0x14 ,0x3 ,0x2f ,0x29 ,0x22 ,0x2b ,0x1c ,0x1e ,0x23 ,0x1b ,0x4 ,0x3a ,0x15 ,0x2f ,0x33 ,0x3c ,0x39 ,0x23 ,0x2 ,0x1c ,0x22 ,0x1a ,0x36 ,0x27 ,0x1b ,0x1c ,0x13 ,0x3c ,0xf ,0x33 ,0x26 ,0x2a ,0x2d ,0x1b ,0x2c ,0x2d ,0x19 ,0x12 ,0x22 ,0x2b ,0x2a ,0x3 ,0x2b ,0x30 ,0xd ,0x3 ,0x16 ,0x1c ,0x29 ,0x22 ,0x1a ,0x1c ,0x13 ,0x12 ,0x22 ,0x2b ,0x15 ,0x1a ,0x25 ,0x15 ,0x1c ,0x2b ,0x36 ,0x2f ,0x1b ,0x32 ,0x34 ,0x3d ,0x13 ,0x27 ,0x3c ,0x35 ,0x3a ,0x34 ,0x26 ,0x2c ,0x2d ,0x13 ,0x31 ,0x2c ,0x19 ,0x2d ,0x3c ,0x3d ,0x24 ,0x34 ,0x2a ,0x1b ,0x21 ,0x2f ,0x27 ,0x4 ,0x33 ,0x35 ,0x29 ,0x29 ,0x3d ,0x23 ,0x1a ,0x1b ,0x19 ,0x2f ,0x21 ,0x1c ,0x32 ,0x1a ,0x36 ,0x27 ,0x1c ,0x3e ,0x31 ,0xf ,0x3c ,0x11 ,0x23 ,0x1b ,0x1c ,0x37 ,0x21 ,0x33 ,0x12 ,0x22 ,0x2b ,0x13 ,0x3 ,0x2b ,0x31 ,0xd ,0x22 ,0x16 ,0x35 ,0x1b ,0x2e ,0x25 ,0x2c ,0x13 ,0xb ,0xd ,0x35 ,0x1e ,0x2a ,0x1c ,0x2b ,0xd ,0x29 ,0x3d ,0x35 ,0xd ,0x1b ,0x32 ,0xa ,0x34 ,0x2c ,0x24 ,0x23 ,0x21 ,0x1c ,0x1b ,0x19 ,0x1d ,0x2 ,0x2b ,0x31 ,0x2f ,0x13 ,0x1c ,0x39 ,0x23 ,0x14 ,0x12 ,0x1d ,0x13 ,0xb ,0x26 ,0x1a ,0x1b ,0x19 ,0x22 ,0x3e ,0x29 ,0x21 ,0x3d ,0x27 ,0x2f ,0x12 ,0x22 ,0x13 ,0x1b ,0x13 ,0x2f ,0x3e ,0x1f ,0x32 ,0x16 ,0x33 ,0x2e ,0x36 ,0x3d ,0x1 ,0x26 ,0x35 ,0xc ,0x22 ,0x3d ,0x11 ,0x13 ,0x3c ,0x33 ,0x3d ,0x36 ,0x2d ,0x2d ,0x4 ,0x3e ,0x19 ,0x3 ,0x1c ,0x22 ,0x25 ,0x12 ,0x1a ,0x2a ,0x1c ,0x25 ,0x3c ,0x35 ,0x32 ,0x12 ,0x35 ,0x37 ,0x1a ,0x2b ,0x1c ,0x25 ,0x3a ,0x3c ,0x34 ,0x2 ,0x2b ,0x32 ,0x3b ,0x3d ,0x24 ,0x3d ,0x35 ,0x25 ,0x1c ,0x39 ,0xd ,0x3 ,0x30 ,0x14 ,0x25 ,0x1c ,0x2c ,0x2b ,0x2c ,0x1e ,0x4 ,0x16 ,0x3d ,0x3c ,0x3b ,0x23 ,0x3a ,0xf ,0x34 ,0x29 ,0x39 ,0x32 ,0x2d ,0x23 ,0x3d ,0x36 ,0x3d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2b ,0x1c ,0x1c ,0x1a ,0x8 ,0x3c ,0x30 ,0x2b ,0x2a ,0x2b ,0x23 ,0x25 ,0x31 ,0x33 ,0xa ,0x2a ,0x1c ,0x2 ,0x1a ,0x1a ,0x39 ,0x12 ,0x21 ,0x14 ,0x32 ,0x1a ,0x13 ,0x12 ,0x1a ,0x2e ,0x3b ,0x2b ,0x1c ,0x2b ,0x8 ,0x38 ,0x1b ,0x1a ,0x8 ,0x2d ,0x25 ,0x2b ,0x28 ,0x33 ,0x1a ,0x2b ,0x3 ,0x1c ,0x16 ,0x30 ,0x1a ,0x1a ,0x1b ,0x3a ,0x14 ,0x3a ,0x1a ,0x2a ,0x12 ,0xa ,0x33 ,0x3b ,0xa ,0x30 ,0x2 ,0xb ,0x3 ,0x1a ,0x3b ,0x23 ,0x12 ,0x1c ,0x29 ,0x22 ,0x30 ,0xf ,0x1f ,0x30 ,0x12 ,0x1b ,0x2b ,0x19 ,0x23 ,0x3c ,0x2b ,0x2d ,0x1a ,0x8 ,0x1b ,0x13 ,0x1b ,0x2b ,0x3a ,0x2b ,0x1c ,0x30 ,0xa ,0x2 ,0x12 ,0x1c ,0x3b ,0x2a ,0x25 ,0x28 ,0xa ,0x21 ,0x13 ,0x1a ,0x14 ,0x1c ,0x32 ,0x1a ,0x2a ,0x2 ,0xa ,0x3a ,0x2c ,0x16 ,0x38 ,0x28 ,0x24 ,0x14 ,0x9 ,0x1d ,0x2b ,0x1c ,0x1a ,0x8 ,0x11 ,0x3c ,0x24 ,0x23 ,0x2d ,0x30 ,0x24 ,0x2c ,0x2b ,0x24 ,0x13 ,0x1c ,0x32 ,0x13 ,0x12 ,0x9 ,0xa ,0x3a ,0x1d ,0x16 ,0x38 ,0x28 ,0x24 ,0x14 ,0x9 ,0x3 ,0xa ,0x31 ,0x2b ,0xa ,0x3 ,0x1a ,0x13 ,0x3a ,0x3b ,0x1c ,0x2a ,0x1a ,0x1d ,0x2a ,0x15 ,0x23 ,0x12 ,0x1a ,0x8 ,0x1c ,0x19 ,0x1b ,0x24 ,0x2a ,0x1b ,0x2a ,0x14 ,0x23 ,0x3c ,0x3a ,0x2b ,0x1a ,0x1b ,0x2 ,0x8 ,0x12 ,0x9 ,0x13 ,0x12 ,0xb ,0x2a ,0x15 ,0x25 ,0x32 ,0x36 ,0x2a ,0xa ,0x30 ,0xc ,0x24 ,0x1c ,0x1c ,0x2a ,0x23 ,0x3c ,0x12 ,0x1b ,0x10 ,0x8 ,0x38 ,0x2 ,0x1c ,0x2d ,0x1a ,0x2b ,0x13 ,0x24 ,0x12 ,0x9 ,0x3 ,0x2e ,0x39 ,0x28 ,0x32 ,0x12 ,0x14 ,0x19 ,0x2a ,0x3 ,0x2f ,0x30 ,0x1b ,0x14 ,0x1a ,0x13 ,0xa ,0x31 ,0x2b ,0xa ,0x3 ,0x1a ,0x1a ,0x3 ,0x13 ,0x13 ,0x1a ,0x3 ,0x1b ,0x34 ,0x2a ,0x22 ,0x12 ,0x1a ,0x14 ,0x39 ,0x12 ,0x23 ,0x2a ,0x2c ,0x3c ,0x19 ,0x1b ,0x11 ,0x1b ,0x39 ,0x14 ,0x3a ,0x9 ,0x28 ,0x1a ,0x2 ,0x2b ,0x22 ,0x36 ,0x19 ,0x2c ,0x35 ,0xd ,0x33 ,0x11 ,0x35 ,0x2a ,0x21 ,0x15 ,0x1e ,0x32 ,0x1c ,0x1a ,0x3 ,0x38 ,0x1e ,0x25 ,0x13 ,0x1c ,0x9 ,0x13 ,0x31 ,0x14 ,0x15 ,0xb ,0x14 ,0x12 ,0x19 ,0x35 ,0x12 ,0x39 ,0x11 ,0x22 ,0x1c ,0x28 ,0x2c ,0x19 ,0x24 ,0xa ,0x1a ,0x2b ,0x3a ,0x2e ,0x13 ,0x21 ,0x2a ,0x23 ,0x33 ,0x24 ,0x28 ,0x9 ,0x22 ,0x1c ,0x23 ,0x1b ,0x22 ,0x31 ,0x19 ,0x9 ,0x13 ,0x12 ,0x11 ,0x12 ,0x19 ,0x1a ,0x1b ,0x2c ,0x22 ,0x19 ,0x9 ,0x9 ,0x13 ,0x2 ,0x12 ,0x12 ,0x19 ,0x13 ,0x2b ,0x1c ,0xa ,0x13 ,0x15 ,0x21 ,0x24 ,0x24 ,0x1d ,0x3d ,0x34 ,0x1d ,0x4 ,0x3a ,0x8 ,0x28 ,0x1a ,0x2 ,0x14 ,0x22 ,0x1d ,0x36 ,0x19 ,0x2c ,0x35 ,0x2a ,0x15 ,0x21 ,0xe ,0x22 ,0x32 ,0x23 ,0x34 ,0x13 ,0x38 ,0x14 ,0x1a ,0x2c ,0x1c ,0x39 ,0x32 ,0x4 ,0x14 ,0x12 ,0x13 ,0x1b ,0x12 ,0xc ,0x35 ,0x3b ,0x28 ,0x2c ,0x1d ,0x13 ,0x11 ,0x23 ,0x31 ,0x3 ,0x2b ,0x2a ,0x22 ,0x1b ,0x21 ,0x9 ,0x13 ,0x1b ,0x23 ,0x1c ,0xb ,0x12 ,0x4 ,0x35 ,0x1a ,0x23 ,0x1b ,0x30 ,0x1a ,0x19 ,0x11 ,0x22 ,0x3a ,0x1d ,0x1f ,0x3a ,0x14 ,0x2e ,0x13 ,0x22 ,0x8 ,0x12 ,0x32 ,0x13 ,0x15 ,0xb ,0x2b ,0x33 ,0x21 ,0xa ,0x14 ,0x12 ,0x35 ,0x1b ,0x39 ,0x9 ,0x1b ,0x31 ,0x3 ,0x13 ,0x13 ,0x1b ,0xc ,0x19 ,0x11 ,0x22 ,0x29 ,0x1d ,0x1a ,0x3a ,0x14 ,0x2d ,0x10 ,0x13 ,0x12 ,0x9 ,0x22 ,0x32 ,0x23 ,0x2b ,0x2a ,0x2b ,0x1b ,0x2c ,0x16 ,0x13 ,0x16 ,0x15 ,0xd ,0x22 ,0x30 ,0x35 ,0x14 ,0x15 ,0x2c ,0x1a ,0x2b ,0x15 ,0x1d ,0x13 ,0x17 ,0x5 ,0x3b ,0x39 ,0x1e ,0x1a ,0x29 ,0x19 ,0x23 ,0x1f ,0x9 ,0x13 ,0x14 ,0x2d ,0x1b ,0xb ,0x12 ,0x3a ,0x2e ,0x1a ,0x13 ,0x32 ,0x33 ,0xc ,0x19 ,0x10 ,0x39 ,0x22 ,0x29 ,0x2a ,0x2a ,0x29 ,0x23 ,0x2c ,0x13 ,0x21 ,0x1a ,0x35 ,0x12 ,0x13 ,0x11 ,0xa ,0x30 ,0x4 ,0x1e ,0x23 ,0x1b ,0x13 ,0xb ,0x14 ,0x34 ,0x3c ,0x2a ,0x1b ,0x15 ,0xa ,0x3b ,0x22 ,0x23 ,0x2a ,0x2a ,0x21 ,0x28 ,0x2e ,0x3 ,0x10 ,0x1d ,0x15 ,0x33 ,0x39 ,0x35 ,0x16 ,0x9 ,0x1b ,0x2b ,0x19 ,0x1a ,0x15 ,0x11 ,0x13 ,0x34 ,0x2 ,0x19 ,0x23 ,0x21 ,0x1c ,0x33 ,0x3b ,0x2a ,0x2b ,0x26 ,0x1b ,0x22 ,0x12 ,0x1c ,0x1f ,0x3a ,0x22 ,0x29 ,0x33 ,0x32 ,0x2a ,0x19 ,0x18 ,0xa ,0x12 ,0x3 ,0x1b ,0x4 ,0x16 ,0x23 ,0x22 ,0x1a ,0x2e ,0xc ,0x14 ,0x21 ,0x16 ,0x15 ,0x1e ,0x15 ,0x1b ,0x23 ,0x28 ,0x32 ,0x11 ,0x5 ,0x2c ,0x1a ,0x11 ,0x13 ,0x1b ,0x2 ,0x1d ,0x34 ,0x12 ,0x23 ,0x1b ,0x12 ,0x19 ,0x2 ,0x12 ,0x22 ,0x11 ,0x2c ,0x39 ,0x22 ,0x2b ,0x15 ,0x33 ,0xd ,0x23 ,0x1b ,0x2a ,0x1a ,0x16 ,0x35 ,0x14 ,0x39 ,0x19 ,0x18 ,0x9 ,0x11 ,0x26 ,0x3 ,0x1c ,0xc ,0x22 ,0x33 ,0x31 ,0x3b ,0x1f ,0x30 ,0xf ,0x3a ,0x2c ,0x32 ,0x15 ,0x1a ,0x11 ,0x13 ,0x1b ,0x14 ,0x2 ,0x34 ,0x1b ,0x23 ,0x21 ,0x2 ,0x1b ,0x1c ,0x28 ,0x3b ,0x33 ,0x39 ,0x2 ,0x23 ,0x22 ,0x29 ,0x23 ,0x1d ,0x2a ,0x2a ,0x2a ,0x2b ,0x1a ,0x32 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0x33 ,0xc ,0x32 ,0x35 ,0x29 ,0x22 ,0x14 ,0x14 ,0xb ,0x4 ,0x5 ,0x1a ,0x13 ,0x3d ,0xc ,0x14 ,0xe ,0x1a ,0x4 ,0x32 ,0xd ,0x33 ,0x32 ,0x24 ,0x22 ,0x16 ,0x14 ,0x22 ,0x14 ,0x14 ,0xc ,0x33 ,0x22 ,0x32 ,0xd ,0x22 ,0x35 ,0x32 ,0xd ,0xb ,0x22 ,0xa ,0x12 ,0x13 ,0x32 ,0x21 ,0x14 ,0x3 ,0x25 ,0x22 ,0x3b ,0x33 ,0x22 ,0x24 ,0x22 ,0x13 ,0x32 ,0x22 ,0x1a ,0x14 ,0xc ,0x33 ,0x22 ,0x32 ,0xd ,0x22 ,0x35 ,0x32 ,0xd ,0xb ,0x4 ,0x27 ,0x13 ,0x16 ,0x1a ,0x26 ,0x14 ,0x3 ,0x25 ,0x23 ,0x3b ,0x33 ,0x3b ,0x15 ,0x22 ,0x24 ,0x13 ,0x24 ,0x14 ,0x1d ,0xc ,0x32 ,0x35 ,0x32 ,0x2a ,0xd ,0x22 ,0xe ,0x22 ,0x4 ,0xb ,0xb ,0x22 ,0xd ,0x22 ,0x14 ,0x3 ,0x2 ,0x33 ,0x13 ,0x22 ,0x31 ,0x14 ,0x16 ,0x1a ,0x1a ,0x1c ,0x2e ,0xc ,0x32 ,0x22 ,0x35 ,0x32 ,0xd ,0xb ,0x26 ,0x1b ,0x11 ,0x1a ,0x3b ,0x14 ,0x4 ,0x25 ,0x2 ,0x3b ,0x33 ,0x24 ,0x22 ,0x5 ,0x13 ,0x14 ,0x1a ,0x32 ,0x35 ,0xc ,0x25 ,0x7 ,0x3d ,0x1a ,0x1b ,0x34 ,0x24 ,0xd ,0x21 ,0x22 ,0xc ,0x14 ,0x15 ,0x5 ,0xb ,0xa ,0x14 ,0x22 ,0x2d ,0xc ,0x32 ,0x35 ,0x32 ,0x7 ,0x2a ,0x1d ,0x1a ,0x31 ,0x3a ,0x34 ,0x22 ,0xc ,0x24 ,0x14 ,0x14 ,0xb ,0xa ,0xd ,0x22 ,0xc ,0x2e ,0xc ,0x32 ,0xd ,0xe ,0x3c ,0x27 ,0xb ,0xa ,0x1a ,0xa ,0xb ,0x25 ,0x22 ,0x22 ,0x1b ,0x2d ,0x2a ,0x33 ,0x24 ,0x4 ,0x14 ,0x2 ,0x13 ,0x33 ,0x12 ,0x32 ,0x22 ,0xc ,0x14 ,0x13 ,0x24 ,0x33 ,0xb ,0x1d ,0x12 ,0xc ,0x1b ,0x34 ,0x24 ,0x7 ,0x1d ,0xd ,0xc ,0x3a ,0x1a ,0x23 ,0x1e ,0x29 ,0x32 ,0x35 ,0x2c ,0x33 ,0x25 ,0x32 ,0xf ,0x1a ,0x31 ,0x26 ,0x29 ,0x22 ,0x2c ,0x1b ,0xc ,0x25 ,0x13 ,0x11 ,0xb ,0x22 ,0x2d ,0x14 ,0xc ,0xd ,0xb ,0x22 ,0xd ,0xb ,0xa ,0x21 ,0x19 ,0x1a ,0x16 ,0x1a ,0x24 ,0x14 ,0x13 ,0x1c ,0x14 ,0x3 ,0x13 ,0x1b ,0x19 ,0x13 ,0x32 ,0x1d ,0x32 ,0x22 ,0xc ,0x14 ,0x13 ,0x24 ,0xd ,0x16 ,0x6 ,0x25 ,0x3b ,0xc ,0x5 ,0x34 ,0xd ,0x26 ,0x23 ,0x7 ,0x2a ,0x32 ,0x1a ,0x2c ,0x6 ,0x11 ,0xc ,0x13 ,0x25 ,0x33 ,0x1b ,0x14 ,0x1d ,0x33 ,0x34 ,0x2c ,0x7 ,0x1a ,0x1a ,0x1b ,0x31 ,0x3a ,0xc ,0x1a ,0x24 ,0x14 ,0x16 ,0x4 ,0x1c ,0x14 ,0x1b ,0x19 ,0xb ,0xa ,0x32 ,0xb ,0xa ,0x21 ,0x5 ,0xd ,0x1a ,0x5 ,0x2f ,0xc ,0x22 ,0x1a ,0x24 ,0x14 ,0x2a ,0x1b ,0x19 ,0x25 ,0x2e ,0x14 ,0x16 ,0xb ,0xa ,0x26 ,0x5 ,0xd ,0x27 ,0x32 ,0xe ,0x21 ,0x22 ,0x32 ,0x34 ,0x1b ,0x13 ,0x1d ,0x1b ,0x13 ,0x2e ,0xc ,0x25 ,0x15 ,0x14 ,0x16 ,0xb ,0x32 ,0x14 ,0x32 ,0x2c ,0x26 ,0xc ,0x14 ,0xd ,0x11 ,0x4 ,0x13 ,0x13 ,0x33 ,0x34 ,0x23 ,0x1a ,0x1a ,0x24 ,0xc ,0x24 ,0x12 ,0x16 ,0xb ,0xd ,0x14 ,0x2b ,0x25 ,0x35 ,0x1b ,0x19 ,0x32 ,0x2b ,0x22 ,0x34 ,0x24 ,0x1e ,0x15 ,0xf ,0x22 ,0x14 ,0x32 ,0x24 ,0x13 ,0x11 ,0x26 ,0x20 ,0xb ,0x14 ,0xc ,0x25 ,0x2c ,0x32 ,0x1b ,0x3b ,0x10 ,0x34 ,0x33 ,0x1c ,0xb ,0xa ,0x13 ,0x24 ,0x32 ,0x34 ,0xc ,0x21 ,0xc ,0xd ,0xb ,0x21 ,0x3 ,0x24 ,0x22 ,0x26 ,0x14 ,0x1b ,0x13 ,0x1a ,0x1e ,0x15 ,0x1e ,0x17 ,0x37 ,0x26 ,0xb ,0x14 ,0x17 ,0x2c ,0xc ,0xd ,0xb ,0x24 ,0x14 ,0x4 ,0x16 ,0x3b ,0xe ,0x3c ,0x3a ,0x12 ,0xc ,0x25 ,0xd ,0x22 ,0x1a ,0x24 ,0x3b ,0x36 ,0x26 ,0x1a ,0x11 ,0x13 ,0x1d ,0xd ,0x13 ,0x14 ,0xb ,0x27 ,0x21 ,0x13 ,0x14 ,0x16 ,0x32 ,0x34 ,0xb ,0x1e ,0xc ,0x25 ,0x11 ,0x26 ,0xd ,0x24 ,0x13 ,0x1a ,0xb ,0x14 ,0xe ,0x1c ,0x16 ,0x12 ,0x2e ,0xd ,0xe ,0x2c ,0x34 ,0x25 ,0x24 ,0x2a ,0x11 ,0x13 ,0x3c ,0x3a ,0x31 ,0xc ,0x12 ,0xd ,0x1a ,0xc ,0x1a ,0x11 ,0x13 ,0xc ,0xd ,0xb ,0x13 ,0x20 ,0xb ,0x2 ,0x14 ,0xc ,0x13 ,0x27 ,0x12 ,0x2c ,0x1a ,0x21 ,0x1b ,0xb ,0x13 ,0x1e ,0xd ,0x1d ,0x34 ,0xd ,0x16 ,0x1a ,0x21 ,0x1b ,0x1a ,0x14 ,0xc ,0x13 ,0x1d ,0x24 ,0x32 ,0x1a ,0x1e ,0x1c ,0x14 ,0x22 ,0xc ,0x11 ,0x26 ,0x1e ,0xd ,0x15 ,0x14 ,0x16 ,0xc ,0x13 ,0xa ,0x2c ,0x34 ,0x32 ,0x11 ,0x2e ,0xd ,0xa ,0x13 ,0xd ,0x1d ,0x1b ,0x21 ,0x1a ,0x14 ,0x24 ,0xd ,0x14 ,0x16 ,0x1c ,0x3b ,0x2c ,0x26 ,0x1b ,0xd ,0x15 ,0xc ,0xb ,0x1e ,0x15 ,0x1e ,0x16 ,0xd ,0x3c ,0x1a ,0xc ,0x4 ,0x14 ,0x13 ,0x12 ,0x16 ,0xe ,0x17 ,0xb ,0x3 ,0x33 ,0x2c ,0x13 ,0x6 ,0x22 ,0x1a ,0x12 ,0x17 ,0x1a ,0xb ,0xf ,0x13 ,0xb ,0x2a ,0x21 ,0x25 ,0x2c ,0x34 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0xf ,0x17 ,0x2b ,0x24 ,0x2b ,0x2a ,0x15 ,0xf ,0x5 ,0x26 ,0x1e ,0x1b ,0x27 ,0x1d ,0x5 ,0xc ,0x1e ,0x16 ,0x1e ,0x1b ,0x1d ,0x2b ,0x17 ,0x24 ,0x1d ,0x2a ,0x7 ,0x6 ,0x25 ,0x24 ,0x24 ,0xf ,0x2c ,0x17 ,0x1d ,0x1b ,0xe ,0x26 ,0x1e ,0x1d ,0x15 ,0x1a ,0x15 ,0x2a ,0x14 ,0x16 ,0x12 ,0x1e ,0x16 ,0x17 ,0x16 ,0x26 ,0x24 ,0x1c ,0x2b ,0x1d ,0xf ,0x1f ,0x2a ,0x24 ,0x25 ,0x13 ,0xf ,0x2c ,0x17 ,0x1d ,0x1b ,0x3b ,0x26 ,0x17 ,0x15 ,0x13 ,0x17 ,0x2a ,0x14 ,0x16 ,0xe ,0x1e ,0x16 ,0x17 ,0x16 ,0x1e ,0x24 ,0x1c ,0x2b ,0x1d ,0x13 ,0x1f ,0xe ,0x24 ,0x25 ,0x1a ,0xf ,0x2c ,0x17 ,0x1d ,0x1b ,0xd ,0x26 ,0x1d ,0x15 ,0x13 ,0x15 ,0x14 ,0x3b ,0x1a ,0x1e ,0x16 ,0xe ,0x16 ,0x25 ,0x24 ,0xb ,0xf ,0x1d ,0x2a ,0xf ,0x29 ,0x24 ,0x25 ,0x16 ,0xf ,0x2b ,0x17 ,0x24 ,0x35 ,0x2d ,0x26 ,0xc ,0x15 ,0x1d ,0x36 ,0x24 ,0xd ,0x16 ,0x14 ,0x1e ,0x16 ,0xe ,0x16 ,0x25 ,0x35 ,0x2b ,0x1d ,0x2a ,0x2b ,0x23 ,0x24 ,0x16 ,0x1b ,0x1d ,0x2c ,0x17 ,0x15 ,0x1e ,0x15 ,0x17 ,0x3c ,0x22 ,0x6 ,0x1a ,0x2c ,0x27 ,0x29 ,0x1c ,0x2b ,0xe ,0x15 ,0x16 ,0x5 ,0x14 ,0x17 ,0x15 ,0x17 ,0x24 ,0x2b ,0xe ,0x1d ,0x1e ,0x25 ,0x1b ,0x1d ,0x2c ,0x15 ,0x17 ,0x3b ,0x23 ,0x4 ,0x3d ,0x26 ,0x1c ,0xf ,0x2b ,0x32 ,0x2a ,0x13 ,0x22 ,0x1d ,0x2c ,0xd ,0x17 ,0x24 ,0xf ,0x23 ,0x1d ,0x26 ,0x24 ,0x1b ,0x1d ,0x2c ,0x24 ,0x5 ,0x15 ,0x2a ,0x22 ,0xf ,0x1f ,0x1e ,0x1c ,0x2b ,0x32 ,0x2a ,0x15 ,0x22 ,0x1d ,0x2c ,0x1c ,0x17 ,0x24 ,0x1d ,0x23 ,0x1d ,0x1e ,0x3a ,0xf ,0x15 ,0x1d ,0x17 ,0x2c ,0x26 ,0x13 ,0x33 ,0x1e ,0xe ,0x14 ,0x24 ,0x2c ,0x16 ,0xb ,0x1e ,0x1e ,0x1d ,0x24 ,0x17 ,0x25 ,0x27 ,0x2a ,0x16 ,0x17 ,0x16 ,0xd ,0x17 ,0x1b ,0x2b ,0x32 ,0x2a ,0x12 ,0x22 ,0x1c ,0x2c ,0x1d ,0x17 ,0x23 ,0x24 ,0xb ,0x26 ,0x1d ,0x3b ,0x1d ,0x1d ,0x24 ,0x5 ,0x22 ,0xf ,0x2a ,0x23 ,0x1a ,0xf ,0x15 ,0x1d ,0x2c ,0x1b ,0x4 ,0x1c ,0x13 ,0x1e ,0x14 ,0xd ,0x16 ,0x31 ,0x16 ,0x24 ,0x2b ,0x1e ,0x1d ,0x2a ,0x1f ,0x21 ,0x16 ,0x13 ,0x15 ,0x17 ,0x1c ,0x26 ,0x1d ,0x1b ,0x2b ,0xe ,0x14 ,0x17 ,0x15 ,0x1e ,0x13 ,0x16 ,0x17 ,0x24 ,0x1d ,0x23 ,0x26 ,0xc ,0x1e ,0x1d ,0x24 ,0xa ,0x16 ,0x5 ,0x23 ,0x26 ,0xe ,0x1c ,0x4 ,0x2b ,0x32 ,0x15 ,0x17 ,0x13 ,0x27 ,0x16 ,0xe ,0x1e ,0x1d ,0x1c ,0x2c ,0xd ,0x24 ,0x17 ,0xf ,0x1d ,0x1e ,0x1d ,0x2d ,0x22 ,0x33 ,0x16 ,0x24 ,0x1d ,0x1b ,0x17 ,0x12 ,0xc ,0xe ,0x1c ,0x14 ,0x1a ,0x13 ,0x2a ,0xd ,0x15 ,0xe ,0x16 ,0xb ,0xd ,0x17 ,0x14 ,0x26 ,0x17 ,0x1d ,0x14 ,0x1e ,0x2b ,0x32 ,0x13 ,0x1a ,0x15 ,0x12 ,0x1e ,0x16 ,0x2d ,0x1d ,0x1c ,0x24 ,0xd ,0x24 ,0x29 ,0x1d ,0x1a ,0x26 ,0x1d ,0x4 ,0x6 ,0x24 ,0x2e ,0x6 ,0x1b ,0x31 ,0x2c ,0x1d ,0x24 ,0x1c ,0x1a ,0x12 ,0x14 ,0x2a ,0x39 ,0x4 ,0xf ,0x22 ,0x17 ,0x23 ,0x1d ,0x24 ,0x19 ,0x14 ,0x1e ,0x1c ,0x28 ,0x5 ,0x24 ,0x1d ,0x1a ,0x1b ,0x1d ,0xe ,0x1c ,0x14 ,0x1a ,0x34 ,0x1c ,0x8 ,0x2a ,0x13 ,0xe ,0x21 ,0x14 ,0x15 ,0x17 ,0x22 ,0x33 ,0x15 ,0x4 ,0x34 ,0x2b ,0x13 ,0x1a ,0x17 ,0x15 ,0xc ,0xa ,0x1d ,0x14 ,0x1e ,0xe ,0x35 ,0x5 ,0x17 ,0x24 ,0x6 ,0x26 ,0x1d ,0x24 ,0x1d ,0x1b ,0x17 ,0x19 ,0xc ,0xe ,0x1c ,0x14 ,0x12 ,0x1e ,0x13 ,0x13 ,0x15 ,0x14 ,0x12 ,0x16 ,0x17 ,0xd ,0x21 ,0xd ,0x22 ,0x25 ,0x1a ,0x31 ,0x2c ,0x1d ,0x1c ,0x2b ,0x15 ,0x1a ,0x36 ,0x3b ,0x3e ,0x14 ,0x4 ,0x15 ,0x14 ,0x13 ,0x16 ,0x34 ,0x5 ,0x39 ,0x15 ,0x24 ,0xc ,0x16 ,0xe ,0x17 ,0xb ,0x2b ,0x5 ,0x5 ,0x14 ,0x15 ,0xc ,0x19 ,0x16 ,0x14 ,0x1e ,0x3c ,0x1e ,0x15 ,0x14 ,0x2d ,0x17 ,0xc ,0x2b ,0x13 ,0x1a ,0x24 ,0x1d ,0x2d ,0x2e ,0x22 ,0x9 ,0x2c ,0x23 ,0xa ,0x24 ,0x29 ,0x1c ,0x1d ,0x1e ,0x17 ,0x15 ,0xe ,0x14 ,0xb ,0x14 ,0x1c ,0x6 ,0x18 ,0x27 ,0x14 ,0x25 ,0x33 ,0x24 ,0x1d ,0x1b ,0x16 ,0x14 ,0x5 ,0x2a ,0x25 ,0xd ,0xd ,0x22 ,0x4 ,0x15 ,0x2b ,0x4 ,0x14 ,0x12 ,0xe ,0x17 ,0x14 ,0x24 ,0x16 ,0xc ,0x26 ,0x16 ,0x1e ,0x1b ,0x15 ,0x23 ,0x17 ,0x2c ,0x2e ,0x34 ,0x2b ,0x17 ,0x15 ,0x24 ,0xb ,0xd ,0x11 ,0x2a ,0xd ,0x13 ,0x1e ,0x5 ,0x1c ,0xa ,0x13 ,0xf ,0x15 ,0xc ,0xd ,0x1e ,0x2a ,0x1e ,0x12 ,0x33 ,0x24 ,0x1d ,0xc ,0x25 ,0x16 ,0x14 ,0x26 ,0x2a ,0x16 ,0x14 ,0x14 ,0x22 ,0x5 ,0x15 ,0xe ,0x5 ,0x4 ,0x16 ,0x2b ,0x1a ,0x33 ,0x1c ,0x1b ,0x1b ,0x1e ,0x1e ,0x12 ,0x17 ,0x15 ,0x24 ,0xe ,0x5 ,0xd ,0x2c ,0x1c ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0x6 ,0xd ,0x5 ,0x4 ,0x15 ,0x3 ,0x2 ,0x3c ,0x16 ,0x14 ,0x22 ,0x15 ,0xe ,0x2a ,0x4 ,0x5 ,0x3 ,0x2b ,0x32 ,0x27 ,0x2a ,0x3b ,0x34 ,0x22 ,0x1d ,0x2b ,0x2a ,0x5 ,0x15 ,0xd ,0x6 ,0x5 ,0x2 ,0x1b ,0x16 ,0x22 ,0x14 ,0x3 ,0x2 ,0x13 ,0x3d ,0x3d ,0x1e ,0x3c ,0x2a ,0x2b ,0x5 ,0x1e ,0x22 ,0x2e ,0x3b ,0x16 ,0x33 ,0xe ,0x2c ,0x2b ,0x15 ,0xd ,0x6 ,0x5 ,0x2 ,0x1b ,0x16 ,0x1d ,0x22 ,0x2a ,0x3 ,0x2 ,0x34 ,0xd ,0x13 ,0x2a ,0x16 ,0x22 ,0x33 ,0x1c ,0xe ,0x1e ,0x27 ,0x2b ,0x14 ,0x5 ,0x16 ,0x15 ,0xd ,0x6 ,0x5 ,0x2 ,0x15 ,0x16 ,0x33 ,0x22 ,0x3 ,0x13 ,0x27 ,0x3c ,0x1e ,0x3c ,0x5 ,0xa ,0x22 ,0x22 ,0x22 ,0x16 ,0x34 ,0x21 ,0x23 ,0xe ,0x3b ,0x6 ,0x5 ,0x3a ,0x2a ,0x2a ,0x1d ,0x2b ,0x1d ,0x1f ,0x16 ,0x15 ,0xd ,0x6 ,0x1f ,0x14 ,0x3 ,0x1 ,0x15 ,0x3c ,0x16 ,0x33 ,0xe ,0x33 ,0x22 ,0x3b ,0x5 ,0x7 ,0x2a ,0x16 ,0x3a ,0x4 ,0x2a ,0x22 ,0x1d ,0xa ,0x33 ,0x39 ,0x22 ,0x37 ,0x21 ,0x22 ,0x7 ,0x16 ,0x14 ,0x3d ,0x3 ,0xe ,0x15 ,0xd ,0x6 ,0x2b ,0x2 ,0x1b ,0x1d ,0x1b ,0x2a ,0x2a ,0x3 ,0x13 ,0x33 ,0xd ,0x2a ,0x2b ,0x15 ,0x22 ,0x2d ,0x16 ,0x22 ,0x1a ,0x1c ,0xe ,0x1e ,0x1f ,0x3b ,0x5 ,0x7 ,0x3a ,0x4 ,0x15 ,0x2a ,0x3a ,0x15 ,0x33 ,0x39 ,0x22 ,0x3e ,0x21 ,0x22 ,0x16 ,0x1f ,0x3 ,0x2 ,0x2c ,0x14 ,0x15 ,0x2 ,0x7 ,0x2a ,0x15 ,0x1d ,0x13 ,0xc ,0x15 ,0xd ,0x2a ,0x2b ,0x15 ,0x22 ,0x2d ,0x16 ,0x22 ,0x33 ,0xb ,0xe ,0x3b ,0x5 ,0x2b ,0x3b ,0x3a ,0x2a ,0x1d ,0xa ,0x22 ,0x1b ,0x3d ,0x39 ,0x1a ,0x2b ,0xb ,0x15 ,0x2 ,0x7 ,0x2a ,0x15 ,0x1d ,0x34 ,0xc ,0x1f ,0x16 ,0xd ,0x2a ,0x16 ,0x22 ,0x33 ,0x1c ,0xe ,0x1e ,0x27 ,0x2b ,0x15 ,0x3d ,0x2a ,0x15 ,0x2b ,0x3a ,0x14 ,0x2b ,0x27 ,0x2d ,0x37 ,0x15 ,0xc ,0x6 ,0xd ,0x1d ,0x2 ,0x7 ,0x22 ,0x33 ,0x16 ,0x14 ,0x21 ,0x29 ,0x24 ,0x2a ,0x15 ,0x2b ,0x3a ,0x14 ,0x2b ,0x2d ,0x3a ,0x33 ,0x22 ,0x1a ,0xb ,0x14 ,0x5 ,0x27 ,0x6 ,0x2a ,0x15 ,0x2 ,0x2b ,0x3d ,0x15 ,0xc ,0x1b ,0x2b ,0x2 ,0xf ,0x3d ,0x22 ,0x16 ,0x33 ,0x1e ,0x29 ,0x21 ,0xa ,0x3a ,0x3c ,0x5 ,0x4 ,0x1d ,0x33 ,0x15 ,0x34 ,0x2b ,0x37 ,0x2a ,0x2c ,0x36 ,0x6 ,0x1d ,0x2a ,0x3a ,0x3d ,0x26 ,0x29 ,0x35 ,0x33 ,0xa ,0x6 ,0x39 ,0x22 ,0x2b ,0x15 ,0x1c ,0x2a ,0x15 ,0x2b ,0x29 ,0x3a ,0x3c ,0x1c ,0x22 ,0x33 ,0x1a ,0x35 ,0xb ,0x14 ,0x3d ,0x21 ,0xa ,0x29 ,0x27 ,0x24 ,0x2a ,0x39 ,0x3d ,0x22 ,0x35 ,0x21 ,0x1d ,0x22 ,0x2b ,0x1c ,0x3b ,0x39 ,0x3d ,0x2d ,0x24 ,0x1d ,0x33 ,0xa ,0x6 ,0x1e ,0x3b ,0x22 ,0x33 ,0x30 ,0x2a ,0x14 ,0x6 ,0xd ,0x21 ,0x23 ,0x1c ,0xa ,0xd ,0x2a ,0x1e ,0x5 ,0x14 ,0x7 ,0x14 ,0x4 ,0x22 ,0x1e ,0xd ,0xf ,0x34 ,0x15 ,0x3 ,0x31 ,0xa ,0x26 ,0xd ,0x2b ,0x2a ,0x39 ,0x5 ,0x14 ,0xd ,0x7 ,0x15 ,0x2 ,0x1b ,0x2b ,0x3b ,0x2d ,0x2b ,0xb ,0x14 ,0x28 ,0x2a ,0x7 ,0x2a ,0x22 ,0x33 ,0x1a ,0x35 ,0x3c ,0x5 ,0x34 ,0x13 ,0x1f ,0xb ,0x2b ,0x3a ,0x2b ,0x24 ,0x23 ,0xc ,0xa ,0x22 ,0x14 ,0xd ,0x3b ,0x22 ,0x21 ,0x31 ,0x11 ,0xb ,0x27 ,0x24 ,0x2a ,0x2e ,0x18 ,0x33 ,0x1a ,0x5 ,0x14 ,0xc ,0x13 ,0x3 ,0xd ,0x34 ,0xf ,0x15 ,0xa ,0x1b ,0x3c ,0x1a ,0x1b ,0x22 ,0x22 ,0x2a ,0x34 ,0xb ,0x14 ,0xd ,0x1b ,0x1d ,0x26 ,0x2c ,0x2b ,0x2a ,0x24 ,0x22 ,0x23 ,0x24 ,0x39 ,0x6 ,0x14 ,0xd ,0x1d ,0x3d ,0x1b ,0x5 ,0x1d ,0x26 ,0x1d ,0x26 ,0x25 ,0xe ,0x4 ,0x3 ,0x2a ,0x36 ,0x23 ,0x22 ,0x21 ,0x1c ,0x24 ,0x2a ,0x19 ,0x2b ,0x2a ,0x22 ,0xb ,0x39 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0x4 ,0x23 ,0x1a ,0x22 ,0x12 ,0x24 ,0x29 ,0x35 ,0x4 ,0x35 ,0x32 ,0x3b ,0xc ,0x1b ,0x16 ,0x3 ,0x2a ,0x31 ,0x3 ,0x2b ,0x29 ,0x33 ,0x2a ,0x23 ,0x4 ,0x15 ,0x1a ,0x22 ,0xa ,0x23 ,0x1b ,0x29 ,0x4 ,0x4 ,0x2e ,0x1b ,0x2a ,0x31 ,0x15 ,0x1e ,0x3c ,0x21 ,0x3a ,0x4 ,0x4 ,0x1b ,0x24 ,0x1a ,0x21 ,0x36 ,0x23 ,0x1a ,0x22 ,0x14 ,0x2b ,0x24 ,0x1b ,0x1b ,0x2a ,0x1d ,0x1b ,0x1b ,0x21 ,0x2b ,0x1b ,0x4 ,0x4 ,0x1b ,0x35 ,0x29 ,0x1b ,0x24 ,0x1a ,0x21 ,0x19 ,0xc ,0x23 ,0x1a ,0x22 ,0x10 ,0x14 ,0xa ,0x12 ,0x36 ,0x29 ,0x15 ,0x5 ,0x1b ,0x32 ,0x2a ,0x4 ,0x4 ,0x1b ,0x35 ,0x3a ,0x1b ,0x35 ,0x9 ,0xc ,0x23 ,0x1a ,0x10 ,0x14 ,0x36 ,0x24 ,0x1b ,0x11 ,0x2a ,0x1d ,0x1c ,0x1b ,0x21 ,0x2b ,0x32 ,0x4 ,0x4 ,0x1b ,0x35 ,0x29 ,0x1b ,0x14 ,0x1b ,0x35 ,0x34 ,0xc ,0x23 ,0x9 ,0x15 ,0x1a ,0x23 ,0x36 ,0x2c ,0x14 ,0x15 ,0x29 ,0x14 ,0x32 ,0x23 ,0x1b ,0x31 ,0x5 ,0x3 ,0x23 ,0x1a ,0x11 ,0x1b ,0x1b ,0x22 ,0x1e ,0x35 ,0x2c ,0x23 ,0x15 ,0xd ,0x29 ,0x5 ,0x1b ,0x3a ,0x15 ,0x5 ,0x3 ,0x23 ,0x1a ,0x22 ,0x24 ,0xc ,0x29 ,0x1b ,0x35 ,0x1b ,0x15 ,0x2e ,0x5 ,0x1b ,0xd ,0x5 ,0x3 ,0x14 ,0x23 ,0x1a ,0x1d ,0x31 ,0x36 ,0x39 ,0x35 ,0x2c ,0x3c ,0xb ,0x2a ,0x5 ,0x1b ,0x21 ,0x4 ,0x5 ,0x15 ,0x23 ,0x36 ,0x9 ,0xb ,0x32 ,0x2a ,0x3a ,0x23 ,0x36 ,0x1c ,0xb ,0x1a ,0x27 ,0x35 ,0x1b ,0x3a ,0x14 ,0x2a ,0x32 ,0x3c ,0x4 ,0x4 ,0x1b ,0x35 ,0x4 ,0x2b ,0x14 ,0x1b ,0x36 ,0x22 ,0xb ,0x1d ,0x24 ,0x23 ,0x23 ,0x1b ,0x18 ,0x19 ,0x2a ,0x1c ,0x5 ,0x15 ,0x1b ,0x22 ,0x1a ,0x36 ,0xc ,0x14 ,0x18 ,0x35 ,0x31 ,0x14 ,0x39 ,0x23 ,0x32 ,0x5 ,0x15 ,0x1b ,0x22 ,0x15 ,0x1a ,0xc ,0x13 ,0x1d ,0x23 ,0x1c ,0x2a ,0x2c ,0x1a ,0x10 ,0x26 ,0x1b ,0x1c ,0xb ,0x4 ,0x5 ,0x36 ,0x11 ,0x1b ,0x13 ,0x22 ,0x13 ,0x24 ,0xa ,0xb ,0x2c ,0x8 ,0x2b ,0x12 ,0x3a ,0x1b ,0x14 ,0x32 ,0x5 ,0x14 ,0x23 ,0x35 ,0xb ,0x1b ,0x1c ,0x2a ,0xc ,0x35 ,0x29 ,0x12 ,0x3c ,0x32 ,0x13 ,0x2c ,0x1b ,0x29 ,0xc ,0x1d ,0x5 ,0x15 ,0x31 ,0x23 ,0x14 ,0x12 ,0x39 ,0x3c ,0x35 ,0x1b ,0x3d ,0x1c ,0x32 ,0x23 ,0x1b ,0x14 ,0x5 ,0x15 ,0x32 ,0x26 ,0x1b ,0x36 ,0x34 ,0x3a ,0x23 ,0x1c ,0x2a ,0x2c ,0x1a ,0x26 ,0x35 ,0x1b ,0x14 ,0x5 ,0x14 ,0x35 ,0x24 ,0x10 ,0x32 ,0x1b ,0xc ,0x3d ,0x35 ,0x3b ,0xa ,0x29 ,0x33 ,0xb ,0x1b ,0x36 ,0xa ,0x14 ,0x1b ,0x35 ,0xa ,0x22 ,0x3b ,0x3a ,0x2b ,0xc ,0x14 ,0x1c ,0x32 ,0x13 ,0xa ,0x31 ,0xb ,0x1b ,0x35 ,0x34 ,0x21 ,0x1b ,0xe ,0x1a ,0x6 ,0x36 ,0x10 ,0x35 ,0xa ,0x24 ,0x1a ,0x12 ,0xb ,0x23 ,0x33 ,0x4 ,0x14 ,0x23 ,0x1c ,0x13 ,0xc ,0x26 ,0x1a ,0x35 ,0x31 ,0x3b ,0x34 ,0x3d ,0x8 ,0x6 ,0x35 ,0x32 ,0x33 ,0x2c ,0x26 ,0x36 ,0x23 ,0x1b ,0x15 ,0x21 ,0x1c ,0x1c ,0xc ,0x23 ,0x14 ,0x31 ,0x36 ,0x26 ,0x23 ,0x1a ,0x2d ,0x39 ,0x11 ,0x34 ,0xb ,0x1b ,0x3d ,0x22 ,0x1b ,0x26 ,0x4 ,0x14 ,0x23 ,0x15 ,0x1c ,0x1d ,0x26 ,0x36 ,0x1b ,0x22 ,0xd ,0x1d ,0x4 ,0x14 ,0x23 ,0x15 ,0x29 ,0xe ,0x1a ,0x26 ,0x32 ,0x35 ,0x2c ,0x5 ,0x2c ,0x6 ,0x35 ,0x2c ,0x24 ,0x2c ,0x32 ,0x9 ,0x3c ,0x3c ,0xa ,0x15 ,0x1d ,0x1c ,0x14 ,0x2a ,0x4 ,0x3e ,0x31 ,0x26 ,0x35 ,0x1a ,0x2b ,0x39 ,0xb ,0x2a ,0x13 ,0x1b ,0x19 ,0x3e ,0x23 ,0xb ,0x22 ,0x19 ,0x23 ,0x22 ,0x1b ,0x11 ,0x19 ,0x11 ,0x39 ,0x5 ,0x14 ,0x1b ,0x21 ,0xd ,0x2b ,0xc ,0x1c ,0x31 ,0x14 ,0xb ,0x1b ,0x3d ,0x1b ,0x36 ,0x22 ,0x1b ,0x23 ,0x34 ,0x39 ,0x3 ,0x6 ,0x35 ,0x2c ,0x24 ,0x9 ,0xb ,0x12 ,0x4 ,0x13 ,0x3e ,0x25 ,0x35 ,0x2c ,0xa ,0x2d ,0x3c ,0x23 ,0xc ,0x11 ,0x2c ,0x31 ,0x15 ,0x23 ,0x1a ,0x19 ,0x1c ,0x2b ,0x14 ,0xc ,0x14 ,0x1b ,0x39 ,0x2 ,0x2a ,0x22 ,0x31 ,0x19 ,0x25 ,0x23 ,0x1b ,0xd ,0x1a ,0xb ,0x2c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0x23 ,0x24 ,0x23 ,0x3c ,0x1b ,0x14 ,0x3b ,0x3b ,0x3b ,0x3d ,0x2b ,0x2a ,0x35 ,0x3b ,0x3b ,0x17 ,0x3d ,0x1d ,0x3d ,0x2a ,0x2b ,0x2a ,0x2b ,0x2b ,0x35 ,0x32 ,0x33 ,0x31 ,0x23 ,0x24 ,0x23 ,0x23 ,0x3c ,0x3b ,0x14 ,0x1b ,0x1b ,0xd ,0x22 ,0x2b ,0xa ,0x3b ,0x2a ,0x2b ,0x34 ,0x35 ,0x32 ,0x13 ,0x3d ,0x17 ,0x3b ,0x34 ,0x3d ,0x2d ,0x1e ,0xc ,0x23 ,0x24 ,0x23 ,0x3c ,0x16 ,0x34 ,0x1b ,0x1b ,0x32 ,0x22 ,0x2b ,0x1a ,0x3b ,0x2a ,0x2b ,0x34 ,0x35 ,0x22 ,0x1b ,0x1c ,0x17 ,0x3b ,0x36 ,0x3d ,0x2a ,0x2d ,0x1f ,0x23 ,0x23 ,0x3b ,0x1b ,0x12 ,0x2b ,0x2a ,0x1b ,0x16 ,0x3c ,0x17 ,0x18 ,0x1e ,0x2b ,0x2a ,0x12 ,0x21 ,0x1b ,0x2a ,0x1a ,0x1c ,0x11 ,0xc ,0x23 ,0x3b ,0x2a ,0x2b ,0x3d ,0x3c ,0x25 ,0xb ,0x12 ,0x17 ,0x36 ,0x3b ,0x3c ,0x1e ,0xc ,0x23 ,0x3c ,0x2d ,0x2a ,0x34 ,0x24 ,0x33 ,0x1b ,0x17 ,0x23 ,0x1a ,0x32 ,0x2e ,0x21 ,0x1e ,0x22 ,0x24 ,0x16 ,0x21 ,0x2b ,0x1a ,0x12 ,0x14 ,0x2b ,0x2c ,0x1c ,0x2d ,0x2a ,0x2b ,0x1c ,0x1b ,0x17 ,0xc ,0x1a ,0xa ,0x23 ,0x21 ,0x1e ,0x25 ,0x25 ,0x1d ,0x24 ,0xc ,0x2c ,0x3d ,0x1c ,0x1c ,0x12 ,0x2d ,0x2c ,0x31 ,0x2a ,0x2b ,0x2d ,0x23 ,0x16 ,0x3c ,0x33 ,0x34 ,0x3e ,0x17 ,0x18 ,0x21 ,0x2a ,0x15 ,0x2b ,0x2c ,0x25 ,0x2d ,0x23 ,0x3c ,0x34 ,0x2b ,0x25 ,0x1b ,0x25 ,0x1d ,0x14 ,0x4 ,0xf ,0x1c ,0x12 ,0xa ,0x1f ,0x1a ,0x21 ,0x2b ,0x2a ,0x22 ,0x17 ,0xc ,0x1a ,0xa ,0x3c ,0x21 ,0x1a ,0x1d ,0x1c ,0x25 ,0x23 ,0x16 ,0x12 ,0x22 ,0x13 ,0x3c ,0x1d ,0x31 ,0x23 ,0x3c ,0x2b ,0x2c ,0x3d ,0x17 ,0x21 ,0x33 ,0x1a ,0x2a ,0x2b ,0x29 ,0x12 ,0x16 ,0x24 ,0x2c ,0x26 ,0x4 ,0x2a ,0x2b ,0x36 ,0x3c ,0x32 ,0x13 ,0x16 ,0x12 ,0x2b ,0x15 ,0x1b ,0x1d ,0x2d ,0x36 ,0x2d ,0x4 ,0x23 ,0x2a ,0x29 ,0x2b ,0x1c ,0x32 ,0x24 ,0x25 ,0x24 ,0x3c ,0x14 ,0x2b ,0x16 ,0x31 ,0x1e ,0x3b ,0x1d ,0x2d ,0xd ,0xb ,0x17 ,0x3d ,0x2c ,0x33 ,0x21 ,0x36 ,0x2a ,0x17 ,0x1f ,0xe ,0x25 ,0x23 ,0x3c ,0x32 ,0x33 ,0x36 ,0x31 ,0x1f ,0x2d ,0x3c ,0x2b ,0x33 ,0x36 ,0x1f ,0x35 ,0x3b ,0x2d ,0x23 ,0x16 ,0x1b ,0x25 ,0x12 ,0x13 ,0x17 ,0x2b ,0x1a ,0x1f ,0x13 ,0x24 ,0x14 ,0x2a ,0xe ,0x2b ,0x13 ,0x1a ,0x12 ,0x19 ,0x13 ,0x1c ,0x3b ,0x23 ,0x25 ,0x2b ,0x34 ,0x2c ,0x33 ,0x3c ,0x2e ,0x2c ,0x18 ,0x1b ,0x2a ,0x34 ,0x15 ,0x34 ,0x2b ,0x2a ,0x26 ,0x2b ,0x2a ,0x29 ,0x3a ,0x36 ,0x34 ,0x31 ,0x2a ,0x25 ,0x33 ,0x3c ,0x2a ,0x2e ,0x3d ,0x34 ,0x35 ,0x3d ,0x3 ,0x3e ,0x36 ,0x17 ,0x2c ,0x2a ,0x26 ,0x17 ,0x3c ,0x33 ,0x33 ,0x36 ,0x34 ,0x2d ,0x1d ,0x3c ,0x38 ,0x2a ,0x2d ,0x2d ,0x32 ,0x22 ,0x2a ,0x29 ,0x13 ,0x1b ,0x23 ,0x25 ,0x12 ,0x1a ,0x13 ,0x11 ,0x1b ,0x26 ,0x13 ,0x36 ,0x17 ,0x25 ,0x3 ,0x22 ,0x35 ,0x1c ,0x11 ,0x34 ,0x33 ,0x5 ,0x3d ,0x13 ,0x13 ,0x1d ,0x16 ,0x23 ,0xc ,0x1a ,0x33 ,0x34 ,0x16 ,0x15 ,0x1d ,0x25 ,0xa ,0x26 ,0x1b ,0x1a ,0x12 ,0x21 ,0x3c ,0x23 ,0x14 ,0x2b ,0x3d ,0x22 ,0x14 ,0x2a ,0x33 ,0x2d ,0x2a ,0x26 ,0x1f ,0x3c ,0x2b ,0x2a ,0x22 ,0x2a ,0x3b ,0x25 ,0x25 ,0x1e ,0xb ,0x2d ,0x2d ,0x31 ,0x35 ,0x16 ,0x33 ,0x33 ,0x23 ,0x2c ,0x2b ,0x3c ,0x32 ,0x36 ,0x34 ,0x3b ,0x2b ,0x2a ,0x1c ,0x24 ,0x24 ,0x3c ,0x17 ,0x24 ,0x17 ,0x33 ,0x4 ,0x1c ,0xc ,0x29 ,0x33 ,0x3d ,0x24 ,0x13 ,0x1a ,0x2a ,0x21 ,0x3b ,0x1d ,0x11 ,0x23 ,0x14 ,0x22 ,0x1b ,0x22 ,0x2c ,0x32 ,0x19 ,0x35 ,0xd ,0x32 ,0x17 ,0x3d ,0x32 ,0x25 ,0x22 ,0x34 ,0x5 ,0x2a ,0x31 ,0x33 ,0x36 ,0x3a ,0x22 ,0xd ,0x21 ,0x39 ,0x1d ,0x33 ,0x16 ,0x15 ,0x3c ,0x1b ,0x2c ,0x2a ,0x26 ,0x1a ,0x3e ,0x1c ,0x25 ,0x1d ,0x1f ,0x1a ,0x1d ,0x35 ,0x3a ,0x1c ,0x32 ,0x24 ,0x2c ,0x2a ,0x2b ,0x29 ,0x3c ,0x32 ,0xd ,0x37 ,0x3d ,0x3b ,0x2b ,0x16 ,0x15 ,0xc ,0x1b ,0x14 ,0x1c ,0x22 ,0x2d ,0x1a ,0x35 ,0x1d ,0xb ,0x18 ,0x2b ,0x26 ,0x11 ,0x25 ,0x1f ,0x3 ,0x1d ,0x24 ,0x2e ,0x1a ,0x2d ,0x12 ,0x1b ,0xd ,0x2b ,0x29 ,0x3e ,0x19 ,0x2a ,0x2b ,0x29 ,0x3c ,0x26 ,0x1a ,0x13 ,0xb ,0x2a ,0x23 ,0x14 ,0x12 ,0x19 ,0xe ,0x33 ,0x33 ,0x3d ,0x32 ,0x2d ,0x32 ,0x35 ,0x13 ,0x36 ,0x32 ,0x3b ,0x3 ,0x2b ,0x2a ,0x1c ,0x17 ,0x24 ,0xc ,0x3c ,0x14 ,0x22 ,0x26 ,0x31 ,0x31 ,0x2a ,0x2c ,0x24 ,0x1c ,0x16 ,0x25 ,0x3 ,0x22 ,0x18 ,0x2b ,0x2d ,0x1c ,0x35 ,0x15 ,0x3c ,0x22 ,0x1c ,0x2b ,0x4 ,0x29 ,0x14 ,0x23 ,0x25 ,0x12 ,0x1a ,0x1b ,0x36 ,0x17 ,0x2c ,0x1c ,0x4 ,0xc ,0x34 ,0x2d ,0x2a ,0xa ,0x3d ,0x16 ,0x16 ,0x15 ,0x3a ,0x1c ,0x12 ,0x2a ,0x24 ,0x33 ,0x2b ,0x26 ,0x19 ,0x3b ,0x2a ,0x29 ,0x32 ,0x35 ,0x2d ,0x31 ,0x0 ,0x0 ,0x4 ,0x33 ,0x4 ,0x1d ,0x32 ,0x12 ,0x12 ,0x2e ,0xb ,0x1e ,0x31 ,0xc ,0x32 ,0x22 ,0x1d ,0x1b ,0x24 ,0x31 ,0xa ,0xc ,0x3e ,0x3d ,0x14 ,0x22 ,0x31 ,0x1b ,0x4 ,0x33 ,0x4 ,0x1d ,0x1d ,0x32 ,0x12 ,0xb ,0x19 ,0xc ,0x1a ,0x31 ,0x23 ,0x34 ,0x19 ,0x1b ,0x3b ,0x14 ,0x37 ,0x33 ,0x14 ,0x22 ,0x1b ,0x31 ,0x4 ,0x33 ,0x4 ,0x1d ,0x1d ,0x32 ,0x12 ,0xb ,0x3a ,0xc ,0x1a ,0xf ,0x9 ,0x24 ,0x19 ,0x1b ,0x27 ,0x3e ,0xc ,0x37 ,0x22 ,0x14 ,0x23 ,0x5 ,0x3 ,0xf ,0x23 ,0x1a ,0x2a ,0xd ,0x35 ,0x12 ,0x33 ,0x2b ,0xc ,0x5 ,0x1d ,0x32 ,0x34 ,0xc ,0x5 ,0x3 ,0x9 ,0xf ,0x23 ,0xd ,0x19 ,0xb ,0x12 ,0x33 ,0x2b ,0xc ,0x5 ,0x1d ,0x32 ,0x34 ,0xc ,0x5 ,0x3 ,0x31 ,0x9 ,0xc ,0x3b ,0x3e ,0x39 ,0x3 ,0x12 ,0x33 ,0x5 ,0x1d ,0x32 ,0x2a ,0xc ,0x5 ,0x1d ,0x27 ,0x1a ,0xc ,0x19 ,0x1e ,0x3f ,0x2 ,0x1d ,0x32 ,0x9 ,0x5 ,0x1d ,0x32 ,0x34 ,0xc ,0x32 ,0x3a ,0x39 ,0x3e ,0x2a ,0x29 ,0x1b ,0x30 ,0x3c ,0x1d ,0xd ,0x1a ,0xd ,0x1d ,0x27 ,0x9 ,0xc ,0x19 ,0x18 ,0x17 ,0x9 ,0x23 ,0x1d ,0x33 ,0x1c ,0x5 ,0x3 ,0xf ,0x9 ,0x27 ,0x19 ,0xd ,0x35 ,0x33 ,0x2b ,0x23 ,0x1d ,0x11 ,0x26 ,0x1d ,0x4 ,0xc ,0x32 ,0x1d ,0x1e ,0x5 ,0x2 ,0x1d ,0x27 ,0xf ,0x1e ,0x1d ,0x14 ,0x2 ,0x25 ,0x13 ,0x5 ,0x1a ,0x1b ,0x35 ,0xc ,0x32 ,0x3a ,0x39 ,0x18 ,0x22 ,0xb ,0xc ,0x3c ,0x19 ,0x1d ,0x36 ,0xd ,0x1b ,0xb ,0x1d ,0x2e ,0xa ,0x23 ,0x19 ,0x19 ,0xb ,0x1a ,0x1d ,0x32 ,0x4 ,0x5 ,0x1d ,0x23 ,0x2b ,0x14 ,0xb ,0xc ,0x13 ,0x13 ,0x26 ,0x2b ,0x1c ,0x25 ,0x1c ,0x24 ,0x1b ,0x4 ,0xc ,0x1b ,0x35 ,0x1a ,0x4 ,0x6 ,0x9 ,0x1d ,0x25 ,0x13 ,0x19 ,0xb ,0x2e ,0x19 ,0x1a ,0x18 ,0x23 ,0x26 ,0x2e ,0x34 ,0x2f ,0xf ,0x3b ,0xb ,0x1a ,0x25 ,0x13 ,0xc ,0x23 ,0x16 ,0x1c ,0x19 ,0x1b ,0x23 ,0x22 ,0x31 ,0x3 ,0x13 ,0xa ,0x2e ,0x3b ,0xb ,0x19 ,0x12 ,0x33 ,0x2b ,0xb ,0x19 ,0x29 ,0x1d ,0x2e ,0x19 ,0x1a ,0x1c ,0x34 ,0x1e ,0x3b ,0x2b ,0x31 ,0x34 ,0x21 ,0x34 ,0x1a ,0x13 ,0x31 ,0x2 ,0x1b ,0x23 ,0x33 ,0x6 ,0x1d ,0x27 ,0x1c ,0x22 ,0x23 ,0x19 ,0x3a ,0x27 ,0x23 ,0x2b ,0x1c ,0xd ,0x2c ,0x33 ,0x4 ,0x1d ,0x23 ,0x27 ,0xf ,0x3f ,0x22 ,0x1a ,0x34 ,0x1b ,0x22 ,0xd ,0x6 ,0x2 ,0x1d ,0x23 ,0x1d ,0x1e ,0x13 ,0x23 ,0x1c ,0x4 ,0x9 ,0xf ,0x2b ,0x3c ,0x21 ,0x2e ,0x13 ,0xa ,0xd ,0x31 ,0x1e ,0x19 ,0x2b ,0xe ,0xb ,0x12 ,0x3b ,0x19 ,0x2d ,0x34 ,0x2d ,0x2f ,0x3c ,0x13 ,0x1d ,0x2b ,0x2c ,0x6 ,0x1c ,0x1c ,0x39 ,0x22 ,0x19 ,0x14 ,0x34 ,0x1b ,0x1c ,0x2b ,0x33 ,0x22 ,0x1c ,0x1d ,0x23 ,0x1a ,0x19 ,0x2d ,0x1b ,0x1c ,0xa ,0x1a ,0x2b ,0x33 ,0x13 ,0x25 ,0x1c ,0x26 ,0x12 ,0x19 ,0x1b ,0x22 ,0xd ,0x2e ,0x1e ,0xe ,0x2c ,0x1d ,0x2d ,0x12 ,0x27 ,0x26 ,0x13 ,0xa ,0xd ,0x1d ,0x1c ,0x19 ,0x2b ,0xe ,0x2b ,0x1d ,0x2e ,0xa ,0x13 ,0xd ,0x1e ,0x3e ,0xd ,0x13 ,0x1b ,0x8 ,0x25 ,0x12 ,0x13 ,0xb ,0x23 ,0x2d ,0xd ,0xd ,0x2d ,0x32 ,0x34 ,0x13 ,0x27 ,0x6 ,0xa ,0xb ,0x3b ,0x19 ,0x13 ,0xd ,0x2b ,0x1d ,0x1e ,0x27 ,0x23 ,0x18 ,0xd ,0x14 ,0x1d ,0xf ,0x8 ,0x1d ,0x1b ,0x2e ,0x1c ,0x1b ,0x25 ,0x2d ,0xc ,0x2b ,0x3a ,0x26 ,0x1b ,0x24 ,0xe ,0x13 ,0x18 ,0x21 ,0x7 ,0xa ,0xb ,0xe ,0x1e ,0x12 ,0x19 ,0x13 ,0xb ,0x11 ,0xc ,0x3a ,0x33 ,0x1b ,0x22 ,0xb ,0x21 ,0x1c ,0x26 ,0xd ,0x3b ,0x3c ,0xd ,0x1e ,0x1b ,0x2a ,0x3 ,0x27 ,0x1c ,0x1b ,0x21 ,0x2a ,0x2a ,0x22 ,0xc ,0x23 ,0x2b ,0x34 ,0x12 ,0xb ,0x22 ,0x35 ,0x12 ,0x25 ,0x2f ,0xe ,0x2b ,0xd ,0x2b ,0xc ,0xb ,0x39 ,0x24 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x22 ,0xb6 ,0x41 ,0xe4 ,0xc4 ,0xd3 ,0xd5 ,0x3a ,0x87 ,0x8f ,0x47 ,0x7 ,0x66 ,0x88 ,0xc1 ,0x35 ,0xb ,0x4 ,0x1 ,0x1 ,0x20 ,0x80 ,0x1 ,0x3c ,0xa7 ,0x7d ,0x80 ,0x76 ,0x2 ,0xb1 ,0xe ,0x39 ,0xb4 ,0xe4 ,0xc2 ,0xb9 ,0xd0 ,0x5b ,0xd ,0x59 ,0x54 ,0x40 ,0x9b ,0x44 ,0x7 ,0xc5 ,0x5 ,0x7 ,0x1 ,0x88 ,0x26 ,0x16 ,0x51 ,0x20 ,0x6d ,0x1a ,0x46 ,0xe2 ,0xd1 ,0xf9 ,0xb9 ,0xaf ,0xb0 ,0x32 ,0x9b ,0x49 ,0x94 ,0x1c ,0x34 ,0x65 ,0xd ,0x1 ,0x3 ,0x25 ,0x20 ,0x86 ,0xc8 ,0x24 ,0x16 ,0x3b ,0x1d ,0x1c ,0x9a ,0x24 ,0xc9 ,0x44 ,0xce ,0xf5 ,0x7c ,0xea ,0x17 ,0xb9 ,0x92 ,0x8b ,0x3f ,0x91 ,0xc ,0xe6 ,0x6f ,0xd ,0x3 ,0x4 ,0x5e ,0x20 ,0x98 ,0x1e ,0x7 ,0xce ,0xee ,0xa9 ,0x73 ,0xd9 ,0x10 ,0x24 ,0x74 ,0x4c ,0xcf ,0x9b ,0x7d ,0xb3 ,0x1a ,0xd4 ,0x53 ,0x90 ,0xf0 ,0x15 ,0x5 ,0xb ,0x8 ,0xb7 ,0xe ,0x20 ,0x72 ,0x4e ,0x51 ,0x1e ,0x2c ,0xc1 ,0x46 ,0xf9 ,0xb6 ,0x56 ,0x59 ,0x79 ,0x8b ,0xa7 ,0x2 ,0xda ,0x5d ,0x15 ,0x1 ,0x1 ,0x15 ,0x1b ,0x83 ,0xb2 ,0x9d ,0x4c ,0x1e ,0x9d ,0x18 ,0x2c ,0xb0 ,0x46 ,0xcf ,0x1d ,0x6e ,0x79 ,0xa7 ,0xa8 ,0x1 ,0xd8 ,0x8 ,0x22 ,0xa ,0xd ,0x16 ,0x3 ,0x58 ,0x9 ,0x4e ,0x2c ,0x6d ,0x90 ,0x36 ,0xc3 ,0xb1 ,0x50 ,0xcb ,0x54 ,0x6f ,0x79 ,0x51 ,0xa8 ,0x77 ,0x7e ,0x15 ,0x8 ,0x77 ,0x1d ,0x3b ,0x83 ,0xc3 ,0x64 ,0x4f ,0x1e ,0x1c ,0x36 ,0xaf ,0x67 ,0x49 ,0xa4 ,0x25 ,0x79 ,0x51 ,0x2c ,0x61 ,0xb8 ,0x5d ,0xa ,0x72 ,0x2 ,0x48 ,0x2f ,0x41 ,0xb2 ,0x60 ,0x56 ,0x37 ,0xa7 ,0x22 ,0x41 ,0x96 ,0xb1 ,0x58 ,0x75 ,0xd6 ,0x80 ,0x3 ,0xd4 ,0x5c ,0x7e ,0x15 ,0xd ,0xf ,0x20 ,0x3b ,0x83 ,0xbe ,0x1c ,0x1d ,0x46 ,0x48 ,0x8d ,0x80 ,0xc0 ,0x10 ,0x36 ,0x2b ,0x16 ,0x1 ,0x93 ,0x24 ,0x5 ,0xd ,0x3 ,0x1e ,0x59 ,0x4 ,0x50 ,0xb5 ,0x81 ,0x61 ,0x44 ,0x89 ,0xd0 ,0x67 ,0xdf ,0x1f ,0x3f ,0x69 ,0x64 ,0x2e ,0x11 ,0x3 ,0x9 ,0x15 ,0x1 ,0xb ,0x2c ,0x50 ,0x48 ,0x9c ,0x8d ,0xa7 ,0x3b ,0x46 ,0x24 ,0x77 ,0x23 ,0x4d ,0x7 ,0x93 ,0xb2 ,0x88 ,0x3c ,0x3f ,0xcc ,0x7d ,0x66 ,0xc8 ,0x3f ,0x36 ,0x78 ,0x7 ,0xe3 ,0x79 ,0x22 ,0x1f ,0x30 ,0x69 ,0x64 ,0x24 ,0x1b ,0x6 ,0x9 ,0x2a ,0xb ,0x23 ,0x5 ,0x6a ,0xc8 ,0x3f ,0x51 ,0x28 ,0xb4 ,0x2 ,0xee ,0xa9 ,0x14 ,0x34 ,0x14 ,0xd ,0x2d ,0x53 ,0xd9 ,0x47 ,0x6a ,0xb7 ,0x3f ,0x24 ,0x80 ,0xc8 ,0xf9 ,0x27 ,0x14 ,0xaf ,0x11 ,0x50 ,0x20 ,0x71 ,0x23 ,0x43 ,0x2 ,0xbe ,0x80 ,0xf2 ,0x88 ,0x3a ,0x7a ,0xd4 ,0x25 ,0xa9 ,0x1d ,0xc ,0x11 ,0x23 ,0x5d ,0x42 ,0x19 ,0x21 ,0x80 ,0xf2 ,0x87 ,0x96 ,0xd ,0x35 ,0x8 ,0xc ,0x6a ,0x32 ,0x1d ,0x51 ,0xeb ,0x1e ,0x80 ,0xc3 ,0x23 ,0x5 ,0x9 ,0xca ,0xd ,0x8a ,0x3e ,0x8 ,0xa ,0x25 ,0x43 ,0x1e ,0xd ,0x77 ,0x4c ,0x5 ,0x4e ,0x3a ,0x1 ,0x9d ,0x9 ,0xec ,0x1 ,0x87 ,0x6 ,0x5 ,0x85 ,0xb ,0x5c ,0x1e ,0xc9 ,0xc ,0x6b ,0x25 ,0x5 ,0x54 ,0x15 ,0x34 ,0xb4 ,0x14 ,0x1 ,0x1e ,0x24 ,0x2b ,0x1 ,0x4 ,0x49 ,0x3 ,0x4b ,0xa ,0x21 ,0x1a ,0x25 ,0x2b ,0x14 ,0x15 ,0xa6 ,0x77 ,0xaf ,0x9 ,0x8b ,0x8 ,0x87 ,0x39 ,0x92 ,0x17 ,0xd7 ,0x59 ,0x4 ,0x9 ,0x2 ,0x46 ,0xb7 ,0x5a ,0xb ,0xf ,0x2 ,0x3 ,0x28 ,0x14 ,0xc8 ,0x2 ,0x4 ,0x1a ,0x23 ,0x9 ,0x34 ,0x1b ,0x1 ,0x19 ,0x16 ,0x5 ,0x1 ,0xf ,0xa ,0x41 ,0x6 ,0x23 ,0xc9 ,0xcb ,0x1 ,0x1 ,0x32 ,0x5 ,0x2 ,0x8 ,0x3 ,0x6 ,0x0 ,0x3a ,0x18 ,0x25 ,0xa1 ,0x28 ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x10 ,0xed ,0x1 ,0x17 ,0x3 ,0x1 ,0xd8 ,0xa ,0x6 ,0x3 ,0x8a ,0xc ,0x2 ,0x6 ,0x7 ,0xaf ,0xd0 ,0x1 ,0x12 ,0x1 ,0xe6 ,0xa ,0x3 ,0x2 ,0x81 ,0x1 ,0x6 ,0x11 ,0x1 ,0xdf ,0xd8 ,0x26 ,0xf5 ,0xed ,0x8c ,0x17 ,0xd7 ,0xc ,0xd ,0x23 ,0x1f ,0x2 ,0x1 ,0xe7 ,0x3 ,0x46 ,0xa ,0x3 ,0x3b ,0x1 ,0x12 ,0xf5 ,0x2e ,0xe7 ,0x1 ,0xf ,0x2 ,0xde ,0x1 ,0x8 ,0x19 ,0xc7 ,0x14 ,0x22 ,0x13 ,0x11 ,0x3 ,0x1 ,0xd ,0x85 ,0xe2 ,0x2 ,0x89 ,0x46 ,0x2 ,0x12 ,0xf5 ,0x2d ,0xe3 ,0x1 ,0xf ,0x2 ,0xde ,0x1 ,0x2 ,0xb1 ,0x3 ,0x7b ,0x23 ,0x3 ,0xe ,0x1c ,0x8 ,0x19 ,0x4 ,0x8c ,0xe8 ,0x1 ,0x6 ,0x4c ,0x2 ,0x12 ,0xf1 ,0x2c ,0xd0 ,0x1 ,0xf ,0x2 ,0xde ,0x1 ,0x2 ,0x9d ,0x2 ,0x5 ,0x25 ,0x17 ,0x48 ,0x3 ,0xd ,0x14 ,0xe2 ,0x2 ,0x65 ,0x3 ,0x1 ,0xfa ,0x18 ,0xbe ,0xd6 ,0x2 ,0xb ,0xb9 ,0x38 ,0xfa ,0x3 ,0x2d ,0x1 ,0x48 ,0x3 ,0x15 ,0xc ,0x8b ,0xed ,0xd1 ,0x2 ,0x15 ,0xed ,0x1 ,0x5 ,0x2 ,0xa3 ,0x9 ,0x85 ,0x3 ,0x2 ,0x18 ,0x6 ,0x4a ,0x10 ,0x2 ,0x7 ,0x16 ,0x4 ,0x2 ,0xe6 ,0x1 ,0x62 ,0x2 ,0x1 ,0xb1 ,0x4 ,0xf ,0x24 ,0xf7 ,0x24 ,0x24 ,0x6 ,0x34 ,0x31 ,0x2 ,0x1 ,0x4 ,0x1 ,0x3 ,0x3 ,0x1 ,0x19 ,0xf1 ,0x16 ,0x8d ,0xd ,0x3c ,0x2d ,0x3 ,0x9 ,0x13 ,0xca ,0xf ,0xbd ,0x98 ,0xec ,0xca ,0x9 ,0x1 ,0xa8 ,0x2 ,0xc1 ,0x7 ,0xf ,0x36 ,0x3e ,0x3 ,0x3 ,0x2e ,0x16 ,0x1 ,0xab ,0xec ,0xfa ,0x25 ,0xee ,0x13 ,0xf8 ,0x9 ,0x4 ,0x19 ,0x1 ,0xa ,0xab ,0xa6 ,0x32 ,0x5 ,0x3d ,0x1 ,0x1 ,0x1 ,0x1d ,0xc3 ,0x2d ,0xf4 ,0x5 ,0x2 ,0xd ,0x2e ,0x9 ,0x16 ,0x1 ,0x2 ,0xea ,0x88 ,0x9c ,0x2 ,0x27 ,0x91 ,0x5b ,0x2d ,0xf4 ,0x58 ,0x9 ,0xd ,0xa7 ,0xc ,0x30 ,0x46 ,0xd ,0x1 ,0x1 ,0x9c ,0x2 ,0x91 ,0x3f ,0x33 ,0xfb ,0x2 ,0xc ,0xbd ,0x4 ,0x14 ,0x4e ,0x1 ,0x2 ,0x21 ,0x9 ,0x7 ,0x24 ,0x3 ,0x39 ,0xfa ,0xa7 ,0xa ,0x2 ,0x9c ,0x2 ,0x19 ,0x6 ,0x17 ,0x1 ,0x46 ,0x33 ,0x1 ,0x1 ,0x1c ,0x3 ,0x4 ,0x6a ,0xbf ,0xd ,0x6 ,0x15 ,0x5d ,0x45 ,0x8 ,0x4 ,0x2c ,0x21 ,0x1 ,0xf4 ,0x55 ,0xfa ,0x2 ,0xc9 ,0x2 ,0xbd ,0x1 ,0xaf ,0x4 ,0xa ,0x38 ,0x80 ,0xa4 ,0x2 ,0x4 ,0x55 ,0xf4 ,0xd ,0x1 ,0xd1 ,0x15 ,0x18 ,0x86 ,0x92 ,0xdc ,0x33 ,0x1 ,0x2 ,0xd ,0x5 ,0x38 ,0x1 ,0xe1 ,0x7 ,0x12 ,0xa ,0xd3 ,0x1 ,0xc4 ,0x3 ,0xa4 ,0x55 ,0xf8 ,0xa5 ,0x21 ,0x6 ,0x1c ,0x1 ,0x8 ,0x1 ,0x5 ,0x2 ,0x14 ,0x24 ,0xd8 ,0x39 ,0xd ,0xbe ,0xd ,0x51 ,0x2e ,0xcb ,0x3 ,0xa9 ,0x2a ,0x5 ,0x3c ,0xbf ,0xa ,0x4 ,0x6 ,0x34 ,0x2c ,0xa3 ,0x4 ,0x1b ,0x27 ,0xc9 ,0x15 ,0x9a ,0x3f ,0x2 ,0xf ,0x32 ,0x45 ,0xa2 ,0x2 ,0x11 ,0x1c ,0x72 ,0xa5 ,0x2 ,0x7 ,0x2 ,0x4 ,0x5 ,0x15 ,0x8f ,0x1f ,0x14 ,0x1 ,0x2 ,0xbf ,0x3 ,0x3 ,0xc ,0x4c ,0x5 ,0x71 ,0x5 ,0x2 ,0xbf ,0x3 ,0x9a ,0x1a ,0x1b ,0x2e ,0xa ,0x3b ,0xca ,0x2 ,0x69 ,0x2 ,0x72 ,0xb7 ,0xa ,0xaf ,0x2 ,0xc ,0xba ,0x8 ,0x11 ,0x19 ,0x4c ,0x27 ,0x2 ,0x3 ,0xc6 ,0xd9 ,0xe ,0xb2 ,0x4c ,0x27 ,0x11 ,0xb8 ,0x12 ,0x8 ,0x11 ,0x9a ,0x3 ,0x20 ,0xd8 ,0x2 ,0x25 ,0x2 ,0xd8 ,0xc ,0x18 ,0x2b ,0x29 ,0x50 ,0x72 ,0x12 ,0x4 ,0xb1 ,0x26 ,0x1c ,0x7 ,0x1f ,0x62 ,0x46 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x6 ,0x27 ,0x43 ,0xf ,0x20 ,0x6f ,0x7d ,0x1 ,0x20 ,0x56 ,0xad ,0x11 ,0x2 ,0x1c ,0x53 ,0x18 ,0x38 ,0x10 ,0x2 ,0x41 ,0x37 ,0x1d ,0x5e ,0x6 ,0xb ,0x9c ,0x65 ,0x6a ,0x8 ,0x1 ,0xf ,0x1c ,0x1 ,0x6e ,0x21 ,0x70 ,0x3 ,0x4 ,0x5 ,0x2 ,0x1a ,0x21 ,0x24 ,0x1 ,0x5 ,0x4a ,0x70 ,0x33 ,0x6d ,0x4 ,0x10 ,0x28 ,0x6 ,0xe ,0xab ,0x8 ,0x1 ,0xa ,0x25 ,0x2 ,0x73 ,0x2a ,0x1 ,0x28 ,0x3e ,0x5b ,0x2a ,0xb ,0x2 ,0x6 ,0x1 ,0x6f ,0x1 ,0x1 ,0x20 ,0x3e ,0x31 ,0xb ,0x4c ,0x4 ,0x2e ,0x68 ,0x5a ,0x10 ,0x4d ,0x4 ,0x44 ,0x29 ,0x2 ,0x1 ,0x41 ,0x3 ,0x44 ,0x5f ,0x59 ,0x12 ,0x2a ,0x83 ,0xf ,0x18 ,0x1 ,0x1 ,0x1 ,0x1d ,0x4d ,0x2e ,0x4b ,0x23 ,0x1b ,0x7e ,0x7c ,0x5 ,0x49 ,0x1a ,0x59 ,0x2f ,0x1 ,0x1 ,0x2b ,0x39 ,0x41 ,0x4 ,0x78 ,0x4 ,0x23 ,0xcb ,0x17 ,0x1 ,0x40 ,0x46 ,0x2c ,0x3 ,0x1c ,0xf ,0x16 ,0x4f ,0x60 ,0x47 ,0x67 ,0x50 ,0x1 ,0x28 ,0x3 ,0x39 ,0x11 ,0x38 ,0x1 ,0x17 ,0xd ,0xd6 ,0x60 ,0x20 ,0x5 ,0xf ,0x1b ,0x8 ,0x79 ,0x2 ,0x1 ,0x1 ,0x5 ,0x3c ,0x38 ,0x13 ,0xe ,0x61 ,0x4 ,0x3e ,0x7 ,0x97 ,0x35 ,0x4a ,0x42 ,0x2e ,0x38 ,0x1 ,0xd ,0xd6 ,0x3d ,0x60 ,0x5 ,0x20 ,0x3 ,0x2 ,0x8 ,0xc ,0x9e ,0x2e ,0x1 ,0x44 ,0x1 ,0x21 ,0x42 ,0x1d ,0x1 ,0x6f ,0x50 ,0x1 ,0xb ,0x4 ,0x39 ,0x1c ,0x3e ,0x1 ,0x2 ,0xd6 ,0x6c ,0x1b ,0x82 ,0xea ,0x1c ,0x2 ,0x6 ,0x53 ,0x27 ,0x4 ,0x1 ,0x5 ,0x22 ,0x30 ,0x69 ,0xe ,0x4d ,0x4 ,0x54 ,0x9 ,0x97 ,0x18 ,0x1d ,0xf ,0x21 ,0x35 ,0x9 ,0x1 ,0x7 ,0x82 ,0x2 ,0x84 ,0x23 ,0x27 ,0x69 ,0x49 ,0x9a ,0x47 ,0x1 ,0x2 ,0x4a ,0x7 ,0x48 ,0x6a ,0xc7 ,0xd ,0x8c ,0x67 ,0x28 ,0x4e ,0x28 ,0x5 ,0x2 ,0x1c ,0xf ,0x8 ,0x26 ,0xc4 ,0x1c ,0x80 ,0x1 ,0x47 ,0x7a ,0x1 ,0x1 ,0x7d ,0x6 ,0x1 ,0x1 ,0x47 ,0x36 ,0x43 ,0xf ,0x66 ,0x5 ,0x13 ,0x43 ,0x1f ,0x9 ,0x3e ,0x8 ,0x66 ,0xf ,0x8 ,0x26 ,0xad ,0x80 ,0x69 ,0x47 ,0x81 ,0x20 ,0x5 ,0x7d ,0x55 ,0x39 ,0x1b ,0xf ,0x45 ,0x46 ,0x88 ,0xe ,0x2c ,0x5 ,0x61 ,0xa ,0x2c ,0x4d ,0x2e ,0x2 ,0x8 ,0x13 ,0x5b ,0x4 ,0x1 ,0x53 ,0x48 ,0x7c ,0x44 ,0x1a ,0x4a ,0x43 ,0x4 ,0x7d ,0x9 ,0x4a ,0x74 ,0xf ,0x87 ,0x12 ,0x5c ,0x5c ,0x5 ,0x8 ,0x6 ,0xf ,0x7 ,0xae ,0x1 ,0x7b ,0x56 ,0x1 ,0xe ,0x4b ,0x17 ,0x3a ,0x49 ,0x13 ,0x1d ,0x2e ,0x47 ,0x47 ,0x43 ,0xa4 ,0x42 ,0x57 ,0xca ,0x49 ,0xc1 ,0x3d ,0x97 ,0xa5 ,0x65 ,0x1 ,0x1a ,0x50 ,0x11 ,0x67 ,0x1 ,0x9 ,0xe ,0x36 ,0x2a ,0x4a ,0x24 ,0x10 ,0x1a ,0x7 ,0x43 ,0x83 ,0xb3 ,0xc5 ,0x70 ,0x14 ,0x22 ,0x44 ,0x32 ,0x75 ,0x10 ,0x3e ,0x4f ,0x4 ,0x2 ,0x53 ,0x1 ,0x7c ,0x44 ,0x4 ,0x49 ,0x8e ,0xf ,0xb ,0x4 ,0x5 ,0x4 ,0xe ,0x2 ,0x12 ,0x5 ,0x7f ,0x4f ,0x7f ,0x5 ,0xf ,0x4c ,0x27 ,0x2 ,0x2 ,0x3 ,0x63 ,0x12 ,0x21 ,0x5e ,0x44 ,0x44 ,0xbf ,0x5e ,0x7 ,0x43 ,0xbc ,0xc5 ,0xf ,0x38 ,0xc ,0x1 ,0x1 ,0x6 ,0x6e ,0xb ,0x33 ,0x45 ,0x65 ,0x59 ,0x41 ,0x2b ,0x66 ,0x4f ,0x76 ,0x5b ,0x58 ,0x71 ,0x7c ,0x5 ,0x2 ,0x55 ,0x18 ,0x1 ,0x5 ,0x2 ,0x28 ,0x13 ,0x11 ,0x4d ,0x91 ,0x12 ,0x44 ,0xbf ,0x42 ,0x3 ,0xe5 ,0x70 ,0x60 ,0x26 ,0x5a ,0xe ,0xb ,0x6d ,0x2a ,0x33 ,0x53 ,0x3e ,0x1a ,0x19 ,0x1 ,0x1 ,0x1d ,0x1 ,0x51 ,0xb7 ,0x9e ,0x26 ,0x4 ,0x21 ,0x61 ,0x3e ,0x7f ,0x5 ,0xf ,0x50 ,0x2 ,0x1 ,0x3 ,0x2 ,0x17 ,0x49 ,0x69 ,0x53 ,0x10 ,0x3b ,0xb ,0x8 ,0x74 ,0x3a ,0xb2 ,0x12 ,0x2c ,0x3 ,0x1 ,0x3 ,0x1 ,0x1 ,0x7c ,0x1 ,0x18 ,0x4a ,0x1c ,0x98 ,0xab ,0x30 ,0x13 ,0x84 ,0x4a ,0x92 ,0x1 ,0xc8 ,0x1 ,0x1 ,0x2 ,0x56 ,0x47 ,0x75 ,0x2 ,0x2e ,0xc9 ,0x70 ,0x52 ,0x44 ,0xc0 ,0x25 ,0x6 ,0x5 ,0x34 ,0x2 ,0x10 ,0xe ,0x75 ,0x82 ,0x3c ,0x26 ,0x45 ,0x7 ,0x63 ,0x5d ,0x2 ,0x7f ,0x87 ,0x37 ,0x85 ,0x1 ,0x7 ,0x37 ,0x1a ,0x3e ,0x4c ,0xc ,0x43 ,0xb7 ,0x70 ,0x6 ,0x2 ,0x1 ,0x7 ,0x82 ,0x6 ,0x5c ,0x1 ,0x1 ,0x2 ,0x2 ,0x6 ,0x7c ,0x3 ,0x30 ,0x4 ,0x4 ,0x56 ,0x3 ,0x3a ,0x3 ,0xa ,0x35 ,0x17 ,0x4c ,0x24 ,0x3c ,0x3 ,0x5e ,0x92 ,0x18 ,0x65 ,0xb9 ,0xdc ,0x51 ,0xe ,0x7 ,0x9 ,0x47 ,0x50 ,0x5 ,0x11 ,0xb7 ,0x96 ,0x92 ,0x4 ,0x5d ,0xc6 ,0x37 ,0x5 ,0x11 ,0xb0 ,0xa ,0x28 ,0xb6 ,0x7 ,0x4a ,0x16 ,0x1d ,0x15 ,0x1 ,0x1 ,0xe ,0x6c ,0x4 ,0x7f ,0x80 ,0xc4 ,0x64 ,0x12 ,0x1b ,0x1 ,0x14 ,0x36 ,0x5a ,0x5 ,0x4c ,0x32 ,0x19 ,0x2 ,0x1c ,0xa ,0x6 ,0x2 ,0xb ,0x1 ,0x29 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0xc6 ,0x71 ,0x13 ,0x1d ,0x55 ,0xd ,0x45 ,0x76 ,0x51 ,0x23 ,0x67 ,0x5 ,0xab ,0x3e ,0xa2 ,0x9f ,0x1 ,0x1f ,0x53 ,0x4 ,0x31 ,0x2 ,0x30 ,0x1 ,0x87 ,0x7b ,0x3d ,0x26 ,0x5b ,0x28 ,0x1b ,0xdd ,0x56 ,0xc ,0x53 ,0x21 ,0x2d ,0x2 ,0x26 ,0x65 ,0x73 ,0xa ,0xbb ,0x8a ,0x8d ,0xa ,0x64 ,0x1 ,0x43 ,0xe ,0x51 ,0x76 ,0x10 ,0x5d ,0x1 ,0x75 ,0x79 ,0x4f ,0x4f ,0x79 ,0xe ,0x41 ,0x1 ,0x1 ,0x4d ,0x18 ,0x40 ,0xc ,0x19 ,0x22 ,0x63 ,0x41 ,0x18 ,0x25 ,0xb ,0xc ,0xf ,0x6c ,0xc ,0x90 ,0x71 ,0x2e ,0x38 ,0x16 ,0x2f ,0x55 ,0x6 ,0xe6 ,0x69 ,0xd ,0x67 ,0x85 ,0x2a ,0xe0 ,0x1 ,0x32 ,0x4 ,0x5d ,0x77 ,0x3a ,0x6b ,0x61 ,0x6 ,0x9f ,0x12 ,0x9a ,0xa2 ,0xd8 ,0x44 ,0x1 ,0x47 ,0x6a ,0x1 ,0x42 ,0x23 ,0x75 ,0x1 ,0xa ,0x7c ,0x8e ,0x43 ,0x17 ,0x1d ,0x33 ,0x9e ,0x15 ,0xc ,0x3d ,0x61 ,0xe ,0x8a ,0x1a ,0x1 ,0x2c ,0x8c ,0x9d ,0x2a ,0x62 ,0x45 ,0x1 ,0x6d ,0x91 ,0x1 ,0x30 ,0x16 ,0x4f ,0x1 ,0x6 ,0x55 ,0x8a ,0x43 ,0x17 ,0x1 ,0x20 ,0xb ,0x8 ,0x5 ,0x51 ,0x39 ,0x41 ,0x39 ,0xb ,0x74 ,0x4 ,0x5 ,0x56 ,0x54 ,0x2b ,0x4f ,0x6d ,0x36 ,0x1 ,0xea ,0x24 ,0xd ,0xcd ,0x57 ,0xa ,0x69 ,0x13 ,0x4d ,0x14 ,0x48 ,0x46 ,0x55 ,0xa9 ,0xd ,0xa ,0x6b ,0x6 ,0x7e ,0x9b ,0x42 ,0x6b ,0x19 ,0x9d ,0x3 ,0x9 ,0x49 ,0x55 ,0x1 ,0xe0 ,0x21 ,0xda ,0x7c ,0x9 ,0x7b ,0x6 ,0x74 ,0x5 ,0x9 ,0xa ,0x29 ,0x2 ,0x51 ,0x19 ,0x74 ,0x92 ,0x58 ,0x23 ,0x2f ,0x3e ,0x3 ,0x51 ,0x3 ,0xe ,0x17 ,0x4b ,0x68 ,0x3b ,0x2d ,0x1 ,0xb ,0x11 ,0x4c ,0x45 ,0x5 ,0xa5 ,0x19 ,0xb ,0x8 ,0x5 ,0x1f ,0x40 ,0x1d ,0x21 ,0x53 ,0x4f ,0x46 ,0x37 ,0x8a ,0x23 ,0x4 ,0x6b ,0x5c ,0x2a ,0xbe ,0xb ,0xa2 ,0x2b ,0x4d ,0x72 ,0x5 ,0x3a ,0x5 ,0x28 ,0x75 ,0x23 ,0x21 ,0x6 ,0x1a ,0x3a ,0x35 ,0x16 ,0x6 ,0x42 ,0xe ,0x27 ,0x89 ,0xa0 ,0x2 ,0xd3 ,0x2b ,0x2 ,0x45 ,0x4d ,0x45 ,0x2c ,0x1f ,0xc5 ,0x30 ,0x2 ,0x6 ,0x13 ,0x54 ,0x26 ,0x42 ,0x1 ,0x3f ,0xb ,0x9f ,0x63 ,0x14 ,0x69 ,0x59 ,0x57 ,0x10 ,0x9f ,0x6 ,0xd ,0x51 ,0x12 ,0x18 ,0x5b ,0x1c ,0x7c ,0x63 ,0x6b ,0x67 ,0xd ,0x4 ,0x35 ,0x1f ,0x67 ,0x26 ,0xd6 ,0x2c ,0xd ,0x1e ,0x4c ,0x57 ,0x99 ,0xa3 ,0xd ,0x18 ,0x3c ,0x10 ,0x9f ,0x72 ,0x5c ,0xb0 ,0x24 ,0x40 ,0x9a ,0x36 ,0x1f ,0x28 ,0xc ,0x2 ,0x6e ,0x12 ,0x5c ,0xb2 ,0x1a ,0xd4 ,0x92 ,0x21 ,0x2 ,0x9d ,0x2c ,0x8 ,0x7c ,0x23 ,0xca ,0x3a ,0xe8 ,0x5e ,0x2a ,0x9 ,0x1 ,0x3b ,0x29 ,0xc ,0x21 ,0x42 ,0x82 ,0x3 ,0x26 ,0xbf ,0x1 ,0x5f ,0x5e ,0x42 ,0x1 ,0x52 ,0x3f ,0x7b ,0x1f ,0x11 ,0x1 ,0x86 ,0x40 ,0x49 ,0xe7 ,0x8 ,0xb ,0x1 ,0x45 ,0x14 ,0x76 ,0x69 ,0xb4 ,0x79 ,0x3 ,0x3a ,0xc ,0xaa ,0x5a ,0x5b ,0x1 ,0x83 ,0xa ,0x7 ,0x23 ,0x17 ,0xa ,0xae ,0x1f ,0x1 ,0x42 ,0x78 ,0xb0 ,0xdb ,0x3 ,0x3b ,0x20 ,0x10 ,0xa2 ,0x1 ,0xd7 ,0x1 ,0x2 ,0x36 ,0x25 ,0x4b ,0x2e ,0x59 ,0x5 ,0x36 ,0x20 ,0x4 ,0x60 ,0x91 ,0x5 ,0x1 ,0x8 ,0x6b ,0xb8 ,0x14 ,0x47 ,0x78 ,0x1f ,0x4 ,0x21 ,0x1b ,0x4 ,0x4e ,0x3 ,0x18 ,0xaa ,0xa ,0x7 ,0x32 ,0x22 ,0x8a ,0xe ,0x23 ,0x3a ,0x4a ,0x2c ,0x78 ,0x6b ,0x4b ,0x1e ,0x67 ,0x15 ,0xa1 ,0x1 ,0x1a ,0x27 ,0x17 ,0xa7 ,0x58 ,0xaa ,0x83 ,0xc6 ,0x4d ,0x1 ,0x81 ,0x4 ,0xbb ,0x6f ,0x7a ,0x1 ,0x9 ,0x7e ,0x76 ,0xa7 ,0xa ,0xc ,0x23 ,0x56 ,0xbf ,0x1 ,0x6 ,0x47 ,0x3e ,0x3b ,0x93 ,0x1e ,0x33 ,0x87 ,0x5 ,0x2 ,0x3a ,0x38 ,0x51 ,0x3d ,0x2 ,0x40 ,0xe ,0x55 ,0x26 ,0x48 ,0x7e ,0xc2 ,0xac ,0x65 ,0x1 ,0xe ,0x58 ,0x6 ,0x82 ,0x6f ,0x63 ,0x1 ,0xc2 ,0x20 ,0x33 ,0x28 ,0x1e ,0x1c ,0x47 ,0x1 ,0x1 ,0x1e ,0x23 ,0x19 ,0xbe ,0x1 ,0x5f ,0x17 ,0x4f ,0x98 ,0x61 ,0xa8 ,0x8a ,0x66 ,0xb ,0x44 ,0x51 ,0xb0 ,0xe8 ,0x80 ,0x1f ,0x9 ,0x57 ,0x39 ,0xd ,0x33 ,0x14 ,0xe ,0xe ,0xbe ,0x1 ,0x8 ,0x84 ,0x3a ,0x25 ,0x96 ,0xc6 ,0x1 ,0x5f ,0x1e ,0xd ,0x65 ,0x7e ,0xb ,0xb0 ,0xba ,0xd4 ,0xa3 ,0xbe ,0x2d ,0xce ,0x26 ,0x76 ,0xf ,0x20 ,0x39 ,0x7a ,0x5 ,0xe6 ,0xd ,0x93 ,0x65 ,0x1 ,0x2 ,0x1e ,0x2 ,0x31 ,0x32 ,0x45 ,0x39 ,0x1 ,0x28 ,0x51 ,0x26 ,0x22 ,0x1f ,0x2 ,0xbe ,0x6d ,0x66 ,0xab ,0xbe ,0x9 ,0xc6 ,0x8 ,0x14 ,0xcc ,0x92 ,0x1 ,0x47 ,0x47 ,0xc ,0x53 ,0x31 ,0x41 ,0x87 ,0x6 ,0x96 ,0x66 ,0x2 ,0x76 ,0x9e ,0x72 ,0x33 ,0x62 ,0x7a ,0xb0 ,0xbb ,0x1a ,0x3b ,0x77 ,0x31 ,0x8b ,0x4 ,0x8 ,0x3 ,0x20 ,0x4f ,0x69 ,0x1 ,0x9 ,0x69 ,0x3 ,0x7 ,0x5 ,0xde ,0x91 ,0x1e ,0x9 ,0xf ,0x20 ,0x1 ,0x1 ,0xe ,0x8b ,0x11 ,0x2e ,0x92 ,0x4 ,0x47 ,0x90 ,0x9e ,0x1b ,0x31 ,0xb ,0x9 ,0x4b ,0x2 ,0xd9 ,0x5 ,0x4c ,0x3b ,0xb ,0x18 ,0x36 ,0xb5 ,0x57 ,0x16 ,0x7 ,0x55 ,0xe8 ,0x38 ,0x82 ,0xba ,0x75 ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x5 ,0x2b ,0xf ,0x1 ,0x2 ,0xa4 ,0x53 ,0x92 ,0x7 ,0x2 ,0x2 ,0x2b ,0x76 ,0x1 ,0x3c ,0x29 ,0x1 ,0x4 ,0x5 ,0x6 ,0x1 ,0x2 ,0xb ,0xc0 ,0x68 ,0x1 ,0x57 ,0x73 ,0x40 ,0x75 ,0x24 ,0xf ,0xa1 ,0xf ,0x10 ,0x1c ,0x3 ,0x6 ,0x29 ,0x14 ,0xc7 ,0x1 ,0x5e ,0x8d ,0x8 ,0x6c ,0x52 ,0x23 ,0x12 ,0x10 ,0x19 ,0x15 ,0x2f ,0xb8 ,0xc6 ,0x46 ,0x1 ,0x62 ,0x2b ,0x96 ,0x2c ,0xf ,0x96 ,0x1 ,0x10 ,0x12 ,0x6 ,0x6 ,0xc ,0x11 ,0x2 ,0xf ,0x6c ,0x15 ,0x4 ,0x20 ,0x5e ,0xc ,0xe ,0x9 ,0x34 ,0x1b ,0x13 ,0x1 ,0xb2 ,0xb1 ,0x52 ,0xbe ,0xcb ,0x49 ,0x30 ,0x7 ,0x1 ,0xf ,0x9f ,0x15 ,0xc5 ,0x3 ,0x37 ,0x2 ,0xc ,0x6a ,0x11 ,0x1 ,0x3a ,0x82 ,0x33 ,0x33 ,0xc ,0x59 ,0xe7 ,0x6 ,0x40 ,0x1 ,0x2b ,0x1c ,0x9 ,0x2 ,0x33 ,0x3 ,0x82 ,0x1 ,0x12 ,0x42 ,0xb ,0x20 ,0x5f ,0x3 ,0x3 ,0x7f ,0x5e ,0x13 ,0x19 ,0x23 ,0xd ,0x2 ,0xb4 ,0x78 ,0x4 ,0x6e ,0x79 ,0x19 ,0x10 ,0x1 ,0x1c ,0xb0 ,0x3 ,0x2 ,0x20 ,0x75 ,0x9 ,0xa7 ,0x33 ,0x30 ,0x10 ,0x73 ,0x70 ,0x1 ,0x2 ,0x24 ,0x1 ,0x62 ,0x1 ,0x25 ,0x27 ,0x15 ,0x1 ,0x4c ,0x3 ,0xcb ,0x66 ,0x1e ,0xd ,0x95 ,0x2 ,0x28 ,0x7e ,0x97 ,0xaf ,0x49 ,0x24 ,0x1 ,0x5e ,0x3 ,0x6e ,0x1 ,0x6b ,0xf ,0x27 ,0x3 ,0x14 ,0x2 ,0x19 ,0x1 ,0x4 ,0xa ,0x3d ,0x38 ,0x5b ,0x10 ,0x61 ,0x2d ,0x9 ,0x15 ,0xa9 ,0x24 ,0x5f ,0x22 ,0x37 ,0x17 ,0x1 ,0x31 ,0x76 ,0x68 ,0x79 ,0x23 ,0x84 ,0x1c ,0x1b ,0x8 ,0x1a ,0x32 ,0x7e ,0xd ,0xd0 ,0x14 ,0xac ,0x28 ,0x41 ,0x44 ,0x20 ,0x8c ,0x2b ,0x77 ,0xc ,0x1 ,0xc7 ,0x8 ,0x92 ,0x6a ,0xa ,0xe ,0xa ,0x10 ,0xf ,0x10 ,0x74 ,0x4c ,0x39 ,0x24 ,0x23 ,0x7 ,0x53 ,0x1 ,0x25 ,0x65 ,0x79 ,0x3a ,0x19 ,0x86 ,0xa8 ,0x4c ,0xa ,0x1f ,0x1 ,0x10 ,0x13 ,0x1a ,0xad ,0x31 ,0x27 ,0x4c ,0xb2 ,0x31 ,0x63 ,0x6d ,0x47 ,0x5 ,0x44 ,0x12 ,0x43 ,0x82 ,0x67 ,0x85 ,0x6c ,0xd2 ,0xc ,0x4 ,0x1 ,0x2c ,0x7b ,0x6b ,0x3 ,0xd ,0x42 ,0x63 ,0x96 ,0x1 ,0x8b ,0x32 ,0x10 ,0x29 ,0x1 ,0x2 ,0x96 ,0x6 ,0xa6 ,0x1 ,0x7c ,0x2 ,0x14 ,0x66 ,0x36 ,0xc7 ,0x10 ,0xd7 ,0xa7 ,0x69 ,0x26 ,0xa3 ,0x81 ,0x1a ,0x57 ,0x3a ,0xf ,0x2c ,0x42 ,0x31 ,0x66 ,0x3a ,0xc ,0x9 ,0x41 ,0x46 ,0xa ,0x1f ,0x6 ,0x66 ,0xe ,0x1d ,0x26 ,0x81 ,0xbd ,0x10 ,0xc7 ,0x3e ,0x9 ,0x7c ,0x4e ,0x2d ,0x8d ,0xb3 ,0x29 ,0x46 ,0xa ,0x6 ,0x1 ,0x4f ,0x2 ,0x51 ,0x4 ,0x18 ,0x76 ,0xa ,0x32 ,0x81 ,0x5b ,0x7 ,0x65 ,0x27 ,0x3 ,0x95 ,0x25 ,0x1 ,0x4e ,0x5 ,0x30 ,0x51 ,0x5f ,0x4f ,0x29 ,0x5 ,0x6e ,0x38 ,0x9 ,0x6 ,0x3a ,0x36 ,0x6 ,0x1 ,0x6 ,0xa2 ,0x8 ,0x10 ,0x3d ,0x95 ,0xd1 ,0x41 ,0x4 ,0x30 ,0x3e ,0x5f ,0x87 ,0x66 ,0xa ,0x7d ,0x6d ,0x1 ,0x42 ,0x3f ,0x43 ,0xca ,0x3b ,0x13 ,0x13 ,0xd4 ,0x3e ,0xb ,0x3d ,0x58 ,0x3 ,0xa ,0xc ,0x40 ,0x51 ,0x8 ,0x2e ,0x67 ,0x97 ,0x7c ,0x40 ,0x1 ,0x46 ,0x6 ,0x83 ,0x34 ,0x6 ,0x39 ,0x7c ,0x2 ,0x2b ,0x7f ,0x43 ,0x7a ,0xa ,0x1b ,0x1 ,0x4 ,0xa5 ,0x97 ,0x39 ,0xb3 ,0x41 ,0x52 ,0x61 ,0x2d ,0x1f ,0x78 ,0x2 ,0xc ,0x7 ,0xc ,0x1 ,0x1 ,0x95 ,0x6b ,0x25 ,0x23 ,0x71 ,0x71 ,0x8 ,0x12 ,0x3 ,0x11 ,0x2 ,0x6 ,0x18 ,0x7e ,0x26 ,0x15 ,0x8 ,0xc4 ,0x1d ,0x4 ,0x44 ,0x6e ,0x9a ,0x2 ,0xe ,0x4 ,0x62 ,0xf ,0x4 ,0x39 ,0x2d ,0x36 ,0x8a ,0x33 ,0x6 ,0x1 ,0x73 ,0x6f ,0xcf ,0x98 ,0x9e ,0x2 ,0x4 ,0x62 ,0x70 ,0x1c ,0xa0 ,0x4c ,0x62 ,0x1 ,0x4e ,0x1 ,0x18 ,0x9 ,0x4f ,0x3 ,0x9e ,0x9d ,0x9e ,0xa0 ,0x78 ,0x13 ,0x35 ,0x2 ,0x6 ,0x1 ,0x7d ,0x18 ,0x10 ,0xba ,0x2f ,0xb6 ,0x2 ,0xe ,0x67 ,0x3f ,0x1a ,0x1c ,0x7 ,0x39 ,0x22 ,0xa4 ,0x7a ,0x60 ,0xd ,0x16 ,0x3c ,0x10 ,0x13 ,0x4b ,0x2 ,0x3c ,0xb ,0x20 ,0xd ,0x26 ,0x4 ,0x7 ,0x9e ,0x85 ,0x61 ,0x35 ,0x3e ,0x5a ,0x3f ,0x16 ,0x49 ,0x70 ,0x63 ,0x5b ,0x6 ,0x9 ,0x82 ,0x98 ,0x13 ,0x7 ,0x31 ,0x1c ,0x19 ,0x39 ,0x1 ,0x6d ,0x39 ,0x28 ,0x93 ,0x9d ,0x97 ,0x17 ,0x1 ,0x76 ,0xe ,0x2a ,0x16 ,0x5 ,0x4b ,0x95 ,0x1b ,0x1f ,0x6e ,0x8f ,0xce ,0xd ,0x28 ,0x2 ,0x29 ,0x4 ,0x2f ,0x62 ,0xbf ,0x1b ,0x4 ,0x34 ,0x36 ,0x78 ,0x28 ,0x1 ,0xb ,0xc7 ,0x98 ,0x1 ,0x36 ,0x64 ,0x56 ,0x13 ,0x3 ,0x39 ,0x3 ,0x8 ,0x20 ,0xb3 ,0x3e ,0x3 ,0x10 ,0x9a ,0x2e ,0x4 ,0x1 ,0x22 ,0x38 ,0x4f ,0x37 ,0x2 ,0x1f ,0x2e ,0x3f ,0x47 ,0xc4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0x4b ,0x12 ,0x46 ,0x2f ,0x2e ,0x28 ,0x1 ,0x1 ,0x1 ,0xf ,0xec ,0x1 ,0x79 ,0x2 ,0x3 ,0x8 ,0x17 ,0x13 ,0xf2 ,0x4d ,0x41 ,0x28 ,0x36 ,0x31 ,0x93 ,0x47 ,0x15 ,0x6d ,0xb2 ,0x1e ,0x4 ,0xd ,0x38 ,0x3 ,0x87 ,0x4 ,0x3 ,0x15 ,0x8b ,0x3b ,0xdc ,0x58 ,0x11 ,0x5c ,0x2d ,0x92 ,0x11 ,0x1b ,0x71 ,0x4b ,0x1 ,0x52 ,0x15 ,0x30 ,0x5c ,0x13 ,0x10 ,0x5e ,0x46 ,0xce ,0x37 ,0x3 ,0x14 ,0x34 ,0x5 ,0xb3 ,0x3c ,0x3 ,0x4b ,0x45 ,0x55 ,0x33 ,0x3a ,0x69 ,0x3f ,0x3 ,0x13 ,0x21 ,0x71 ,0x4d ,0x40 ,0x52 ,0x15 ,0x30 ,0x53 ,0x7 ,0x16 ,0x3c ,0x61 ,0xdb ,0x14 ,0x1 ,0x26 ,0x1e ,0x1 ,0xbb ,0x12 ,0x5 ,0x80 ,0x4b ,0x41 ,0x7e ,0x69 ,0xe ,0xc2 ,0x1b ,0x20 ,0xc ,0x4f ,0x8 ,0x3c ,0xa9 ,0x9 ,0x54 ,0x70 ,0x3 ,0x51 ,0x65 ,0xde ,0x46 ,0x1 ,0x27 ,0x1f ,0x18 ,0xab ,0xf ,0x5 ,0x1c ,0x35 ,0xe ,0x62 ,0x13 ,0x11 ,0x2d ,0x13 ,0x20 ,0x20 ,0xd ,0x4f ,0x10 ,0xa ,0x94 ,0x78 ,0x6d ,0x8d ,0x6f ,0x6e ,0x46 ,0x55 ,0xb ,0x9 ,0x36 ,0x16 ,0x11 ,0x46 ,0x1c ,0x1a ,0x18 ,0x2 ,0x58 ,0x40 ,0x1 ,0x3 ,0x46 ,0x3e ,0x3 ,0x6b ,0x60 ,0x5 ,0x4e ,0xa ,0x6a ,0xa ,0x36 ,0x6e ,0x37 ,0x79 ,0x5b ,0x4 ,0x42 ,0xb ,0x9 ,0x46 ,0x1c ,0x2 ,0x60 ,0x1 ,0x78 ,0xb ,0x3e ,0x2 ,0x57 ,0x4 ,0x72 ,0x3a ,0x70 ,0x16 ,0x18 ,0x15 ,0xa ,0x13 ,0x5a ,0x26 ,0x79 ,0x7 ,0x3f ,0x40 ,0x13 ,0x2 ,0x37 ,0x60 ,0x38 ,0x20 ,0x21 ,0x3 ,0x1 ,0x28 ,0x56 ,0x37 ,0x1 ,0x67 ,0x93 ,0x71 ,0x16 ,0x35 ,0x50 ,0xa ,0x4f ,0x4 ,0x2b ,0x79 ,0x57 ,0x1 ,0x1 ,0x56 ,0x16 ,0x1c ,0x1 ,0xc ,0x5f ,0x1 ,0x28 ,0x1 ,0x4e ,0x8 ,0x61 ,0x2e ,0x18 ,0x6 ,0x28 ,0x2c ,0x88 ,0x1c ,0xd ,0x15 ,0x82 ,0x20 ,0x9e ,0x4f ,0x4a ,0x8 ,0x2c ,0x80 ,0x1 ,0x8b ,0x6d ,0x1a ,0x4d ,0x35 ,0x2d ,0x9 ,0xf ,0x4 ,0x99 ,0x2 ,0x81 ,0x1 ,0x1 ,0x1f ,0x39 ,0x60 ,0x67 ,0x25 ,0x2f ,0xe ,0x11 ,0x1 ,0x56 ,0x3b ,0x1 ,0xbf ,0x4 ,0x74 ,0xd7 ,0x72 ,0x78 ,0x12 ,0x2e ,0x2 ,0x1 ,0x7 ,0x6e ,0x40 ,0x78 ,0x4c ,0x2f ,0x2 ,0x43 ,0xd0 ,0x64 ,0x2 ,0xcb ,0x1 ,0xdb ,0x2c ,0x59 ,0x9 ,0x3d ,0x1 ,0x58 ,0x29 ,0x3a ,0x3e ,0x9 ,0x13 ,0x1 ,0xf ,0x2 ,0x4f ,0x3c ,0xc ,0x63 ,0x1 ,0x1 ,0x5b ,0x3f ,0x3 ,0x2 ,0x2a ,0x4b ,0x71 ,0x1 ,0x60 ,0xd ,0xbe ,0x6 ,0x5c ,0x1 ,0x6 ,0x58 ,0x40 ,0x31 ,0x5 ,0x2c ,0x34 ,0xc ,0x25 ,0x40 ,0x81 ,0xf ,0x4a ,0x2c ,0x1 ,0x70 ,0x38 ,0xbf ,0x1c ,0xe7 ,0x59 ,0x1 ,0x4b ,0x2c ,0xc5 ,0x44 ,0x72 ,0x22 ,0xa3 ,0x1 ,0x82 ,0xb7 ,0x2b ,0xa ,0x34 ,0x5 ,0x1c ,0xd ,0xf7 ,0x90 ,0x80 ,0x1 ,0xb2 ,0x9e ,0x11 ,0x59 ,0x2d ,0x4f ,0x61 ,0x58 ,0x63 ,0x31 ,0x1 ,0x41 ,0x2c ,0x1 ,0xba ,0x4 ,0x81 ,0x1 ,0x57 ,0x4 ,0x38 ,0x1 ,0x2c ,0x1 ,0x53 ,0x29 ,0x5 ,0x3b ,0x3c ,0x5d ,0x9 ,0x65 ,0x19 ,0x3 ,0xf ,0x71 ,0x4b ,0x6f ,0x1f ,0x20 ,0x5 ,0x65 ,0x36 ,0x3c ,0x4 ,0x10 ,0x70 ,0x38 ,0xe3 ,0xed ,0x9a ,0x1 ,0x5d ,0x2c ,0x4d ,0xd1 ,0x98 ,0x1 ,0x65 ,0x18 ,0x3 ,0x33 ,0xa8 ,0xc ,0x11 ,0x45 ,0x24 ,0x20 ,0x12 ,0xa4 ,0x8c ,0xbc ,0xb3 ,0x1c ,0x56 ,0x2a ,0x34 ,0x6f ,0xbc ,0x69 ,0x1 ,0x15 ,0xd ,0xa ,0x13 ,0x43 ,0x3 ,0x81 ,0x70 ,0x38 ,0xbb ,0x1c ,0x6c ,0x59 ,0x3 ,0x6b ,0x2c ,0x8f ,0x4d ,0x32 ,0xaf ,0x81 ,0x96 ,0x49 ,0x9 ,0x5 ,0x3b ,0x49 ,0x24 ,0xa4 ,0x6 ,0x37 ,0x1 ,0x57 ,0x29 ,0x3b ,0x7 ,0x86 ,0x2f ,0x90 ,0x8 ,0x5 ,0x9 ,0x5 ,0x41 ,0x67 ,0x66 ,0x46 ,0xbc ,0xa ,0x1f ,0x2 ,0x21 ,0x82 ,0x15 ,0x18 ,0xa ,0x76 ,0xb ,0x13 ,0x8 ,0xb1 ,0x2c ,0x2e ,0x3e ,0x33 ,0x98 ,0x1 ,0x7c ,0x4e ,0x73 ,0xab ,0xc2 ,0x27 ,0xaa ,0xab ,0xb4 ,0xc1 ,0x5c ,0x29 ,0x3 ,0x48 ,0x9b ,0x29 ,0x9f ,0xa1 ,0xf ,0x1f ,0x9 ,0x92 ,0x81 ,0x82 ,0x9 ,0x7b ,0x1 ,0x84 ,0xbc ,0x80 ,0x40 ,0x1 ,0x2 ,0x7 ,0x4a ,0x8 ,0xcc ,0x3a ,0x5e ,0xb3 ,0x1 ,0x37 ,0x5 ,0x42 ,0x18 ,0x2 ,0x32 ,0x43 ,0xc ,0xd ,0x8b ,0x11 ,0x93 ,0xd7 ,0x18 ,0xa ,0x2a ,0x9 ,0x1 ,0x2c ,0xd ,0x33 ,0x1 ,0xad ,0x73 ,0x6 ,0x27 ,0x28 ,0xd0 ,0xc5 ,0x2c ,0x9 ,0x31 ,0x9 ,0x93 ,0x29 ,0x1 ,0x42 ,0x1 ,0x87 ,0x70 ,0x4a ,0x35 ,0xa9 ,0xbd ,0x1 ,0xe ,0x4 ,0x1 ,0x3f ,0x5d ,0x27 ,0x51 ,0xc2 ,0x5c ,0x12 ,0x4 ,0x9c ,0x19 ,0x41 ,0x3 ,0x42 ,0x1 ,0x20 ,0x48 ,0x4d ,0x1 ,0xd ,0x8 ,0x96 ,0x32 ,0x6 ,0xb9 ,0xc8 ,0xd7 ,0xb8 ,0x6 ,0xee ,0xb2 ,0x82 ,0xb6 ,0x1 ,0x54 ,0x3 ,0x15 ,0x5 ,0xba ,0x28 ,0xd1 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0x4b ,0x1 ,0x4f ,0x5c ,0x36 ,0x12 ,0x29 ,0x11 ,0x1b ,0x5f ,0x12 ,0x73 ,0x36 ,0x19 ,0x4e ,0x4c ,0x4c ,0x2e ,0x8 ,0xe ,0x3 ,0xf ,0x17 ,0xf ,0x3a ,0x3f ,0x90 ,0xf ,0x1f ,0x1 ,0x3c ,0x50 ,0x4f ,0x5a ,0x1b ,0xe4 ,0x54 ,0x7 ,0x11 ,0x1 ,0xf ,0xe ,0xc ,0xf ,0x83 ,0x7b ,0xf ,0x2a ,0x77 ,0xb3 ,0xf ,0x57 ,0x3 ,0x3 ,0x82 ,0xb7 ,0x22 ,0x2 ,0x32 ,0x50 ,0x4f ,0xaf ,0x1c ,0x19 ,0x3e ,0x65 ,0x2a ,0x39 ,0x21 ,0x1 ,0x1 ,0x12 ,0x40 ,0x17 ,0xf ,0x56 ,0x1 ,0x18 ,0x5 ,0x75 ,0x66 ,0x21 ,0x2 ,0x23 ,0x2 ,0x32 ,0x50 ,0x4d ,0x5d ,0x30 ,0xee ,0x40 ,0x2 ,0x3 ,0xa ,0x11 ,0xe ,0xf ,0xf ,0xa ,0x9e ,0x19 ,0x8 ,0x5c ,0xa ,0x45 ,0x85 ,0x3 ,0xf ,0x11 ,0x25 ,0x8 ,0x3f ,0x9c ,0x2 ,0x80 ,0x2f ,0x3 ,0x4 ,0x3c ,0x5 ,0x45 ,0x4d ,0x55 ,0x2 ,0x2 ,0x93 ,0xf ,0x64 ,0x3 ,0x3 ,0x51 ,0x70 ,0xf ,0xf ,0x1b ,0x70 ,0xf ,0xb ,0x4 ,0x82 ,0x2d ,0x2 ,0x2 ,0x28 ,0x1 ,0x8 ,0x3 ,0x58 ,0xaf ,0x3d ,0x2e ,0x10 ,0x1 ,0x6f ,0x1 ,0x34 ,0x5 ,0x20 ,0xfc ,0x51 ,0x8b ,0x19 ,0xb0 ,0x38 ,0x61 ,0x2f ,0x1 ,0x2d ,0x2 ,0x2d ,0x75 ,0x4 ,0x9 ,0x10 ,0x54 ,0x2d ,0x4 ,0x74 ,0x3 ,0x5 ,0x28 ,0xf ,0xf ,0x1b ,0x12 ,0x1 ,0x41 ,0x52 ,0x3 ,0x43 ,0x1d ,0x1 ,0x8 ,0x1 ,0x58 ,0x8d ,0x28 ,0x1a ,0x5f ,0x61 ,0x63 ,0x26 ,0x43 ,0x1b ,0x6 ,0x86 ,0x67 ,0x5a ,0x43 ,0x15 ,0x85 ,0x5 ,0x2d ,0x70 ,0x4 ,0x9 ,0x5 ,0x6f ,0x3e ,0x18 ,0x23 ,0x2 ,0xf ,0xf ,0xf9 ,0x3d ,0x14 ,0x86 ,0x1f ,0x1 ,0x94 ,0x71 ,0xf ,0x3 ,0x2 ,0x57 ,0x8 ,0x43 ,0x10 ,0x6 ,0x65 ,0x67 ,0x37 ,0x42 ,0x13 ,0x70 ,0x17 ,0x5 ,0x10 ,0x3e ,0x4a ,0x19 ,0x67 ,0x2 ,0x8 ,0x1 ,0x71 ,0x4 ,0xa ,0x2e ,0x2 ,0xac ,0x1 ,0xb8 ,0x5a ,0x2b ,0xc ,0x4 ,0x5c ,0x6 ,0x32 ,0x4 ,0x19 ,0x5 ,0x6 ,0x3b ,0x3d ,0x4a ,0x23 ,0x4f ,0x1 ,0xc ,0x29 ,0x2 ,0xac ,0x1 ,0xbe ,0x5a ,0xc ,0xe ,0x3d ,0x3e ,0xf ,0x23 ,0x1f ,0x4c ,0x1 ,0x38 ,0x29 ,0x4 ,0x49 ,0x71 ,0xb ,0x65 ,0x16 ,0xde ,0xcf ,0x3 ,0xa7 ,0x10 ,0x70 ,0x3e ,0x17 ,0x8 ,0x1 ,0x38 ,0xd ,0xf ,0xf ,0x9 ,0x2a ,0x4 ,0x64 ,0x23 ,0x31 ,0x3b ,0x19 ,0x40 ,0x60 ,0x1 ,0xf ,0x10 ,0x14 ,0xe ,0xa ,0x43 ,0x5 ,0x2 ,0x3e ,0x2d ,0x7 ,0x7 ,0x1c ,0x71 ,0x14 ,0x8f ,0x36 ,0x1 ,0x8f ,0x64 ,0x1 ,0x39 ,0x2a ,0x6d ,0x3c ,0x18 ,0x2 ,0x8 ,0x22 ,0x1 ,0x4b ,0x1 ,0x9 ,0x2 ,0x13 ,0x10 ,0x6 ,0xd ,0x24 ,0x1 ,0x56 ,0x19 ,0x9b ,0x71 ,0x1c ,0x3e ,0x8 ,0x7 ,0x31 ,0x13 ,0xc ,0x3d ,0x2d ,0xc ,0x2 ,0x3e ,0x30 ,0x3e ,0x1 ,0x22 ,0x22 ,0xf ,0xc ,0x56 ,0x7b ,0x2a ,0x1 ,0x62 ,0x9c ,0xc ,0x1d ,0x1e ,0x6 ,0x6c ,0x24 ,0x6c ,0xc ,0x14 ,0x3 ,0x5 ,0x7f ,0xc ,0x33 ,0x13 ,0x4f ,0x19 ,0xfa ,0x10 ,0x8 ,0xd ,0x47 ,0x18 ,0x1b ,0x7f ,0x1 ,0xdf ,0x6a ,0x4a ,0x5 ,0x26 ,0x22 ,0x71 ,0xf ,0x3d ,0xc ,0x10 ,0x22 ,0x62 ,0x4 ,0x1 ,0xd ,0x37 ,0x4 ,0x42 ,0x1a ,0x13 ,0x71 ,0x38 ,0xb1 ,0xbf ,0x88 ,0x5 ,0x13 ,0x17 ,0xd6 ,0xc3 ,0x4e ,0x9e ,0x4b ,0x4 ,0x1 ,0x2 ,0x7 ,0xc ,0x94 ,0x8 ,0x1 ,0x58 ,0x38 ,0x9 ,0x34 ,0x16 ,0x2b ,0x5a ,0x18 ,0x2a ,0x9 ,0x5f ,0x6 ,0x39 ,0x4d ,0x88 ,0x34 ,0xb1 ,0xe5 ,0x6 ,0x24 ,0x7 ,0x68 ,0x16 ,0x79 ,0x39 ,0x6 ,0x5d ,0x8e ,0x9c ,0xb4 ,0xa7 ,0x26 ,0xd7 ,0x8 ,0xb ,0x68 ,0x26 ,0x19 ,0xa ,0x79 ,0x2 ,0x37 ,0x69 ,0x29 ,0xf ,0x47 ,0x2 ,0x7 ,0x3 ,0x52 ,0x82 ,0x87 ,0x40 ,0x56 ,0x2a ,0x88 ,0xa6 ,0x4 ,0x77 ,0x40 ,0x9e ,0x2 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0x2 ,0x2a ,0x22 ,0x3 ,0xc ,0xab ,0x3 ,0x10 ,0x1 ,0x2 ,0x2 ,0xc1 ,0x9a ,0x2 ,0x22 ,0xf ,0xc ,0x1b ,0x3 ,0x1d ,0x16 ,0x1 ,0x40 ,0x1a ,0x2 ,0xdb ,0x13 ,0x17 ,0x1 ,0x7a ,0x16 ,0x28 ,0x1 ,0x2 ,0x1 ,0x26 ,0x19 ,0x35 ,0x22 ,0xda ,0x89 ,0x2 ,0x2 ,0x1 ,0x2 ,0x9 ,0xec ,0xa ,0x5 ,0x5 ,0x37 ,0x3e ,0xe ,0xd1 ,0x91 ,0xc4 ,0xf ,0x4d ,0x29 ,0xc ,0x76 ,0x10 ,0x2 ,0x8 ,0x70 ,0x1 ,0x2 ,0x4 ,0x2 ,0x5 ,0xe ,0xed ,0x3d ,0x5 ,0x3 ,0x6c ,0x3c ,0x3f ,0x10 ,0x3 ,0xb7 ,0x2 ,0x3e ,0x1 ,0x31 ,0x7f ,0x2 ,0x4a ,0x3 ,0x4a ,0x1 ,0x2 ,0x4 ,0x6 ,0x4d ,0x13 ,0x1b ,0x27 ,0x6d ,0x43 ,0x3f ,0x3 ,0xda ,0x2 ,0xa5 ,0x4d ,0x8d ,0x3c ,0x31 ,0x7a ,0x2b ,0x2 ,0x10 ,0x3c ,0x1 ,0x2 ,0x4 ,0x6 ,0x5 ,0x1e ,0xee ,0x62 ,0x13 ,0xcc ,0x5d ,0x43 ,0x1 ,0xe7 ,0x37 ,0x74 ,0x1 ,0xe4 ,0x4f ,0x8a ,0x71 ,0x38 ,0x4 ,0x8 ,0x46 ,0x1 ,0x1 ,0x1 ,0x54 ,0x3f ,0x1f ,0x65 ,0x71 ,0x45 ,0x13 ,0x2 ,0xae ,0x5 ,0x38 ,0x15 ,0x8 ,0x2 ,0x1a ,0x54 ,0x61 ,0x1 ,0x2 ,0x49 ,0x55 ,0x10 ,0xac ,0x4d ,0x3a ,0x5f ,0x3 ,0x3 ,0xa8 ,0x17 ,0x2 ,0x1a ,0x9d ,0x1 ,0x1 ,0x8f ,0xb ,0x4 ,0x38 ,0x1c ,0x5 ,0x48 ,0x2 ,0xae ,0x3a ,0x7e ,0x50 ,0x2 ,0x1a ,0x17 ,0xe ,0x1 ,0xa1 ,0x5 ,0x1 ,0x1 ,0x24 ,0x39 ,0x55 ,0x5a ,0x71 ,0x2 ,0xab ,0x5d ,0x4d ,0x3 ,0x10 ,0x10 ,0x4d ,0x72 ,0x1 ,0x3b ,0x3 ,0x8 ,0x2 ,0x8 ,0xa ,0xe ,0x69 ,0x68 ,0x64 ,0x2 ,0x74 ,0x26 ,0x80 ,0xf2 ,0x5b ,0xb ,0x4 ,0x59 ,0x3 ,0x18 ,0x70 ,0x2 ,0xac ,0x3d ,0x42 ,0x2 ,0x2 ,0x2 ,0x9c ,0x1 ,0x4d ,0x27 ,0x4c ,0x53 ,0xe ,0x6 ,0x2 ,0x8e ,0x40 ,0x70 ,0x13 ,0x10 ,0x2 ,0xbe ,0x7c ,0x7a ,0x93 ,0x43 ,0xdb ,0x55 ,0x31 ,0xb ,0xa ,0x63 ,0xa ,0xe ,0x2 ,0x2 ,0x13 ,0x2d ,0xbd ,0x53 ,0x48 ,0xdd ,0x5 ,0x33 ,0xc5 ,0x1 ,0x1 ,0xb2 ,0x2 ,0x1e ,0xc2 ,0x13 ,0x2 ,0x93 ,0x13 ,0x1 ,0x1 ,0xb ,0x5e ,0x1d ,0x3 ,0x15 ,0x10 ,0x1 ,0x12 ,0xa ,0x6f ,0xd5 ,0xa ,0x3 ,0x7d ,0x36 ,0x2 ,0xba ,0x2 ,0x4 ,0xd0 ,0x23 ,0x22 ,0x1 ,0xd ,0xa9 ,0x15 ,0x64 ,0x6 ,0x20 ,0x1e ,0xc2 ,0x2 ,0x81 ,0xf ,0xf ,0x44 ,0xa ,0x1c ,0x2 ,0x7a ,0x78 ,0x37 ,0xd7 ,0x55 ,0x6e ,0x34 ,0x1e ,0xc2 ,0x2 ,0xa6 ,0xa ,0x3c ,0x2 ,0x3 ,0x21 ,0x2 ,0x17 ,0x4e ,0x7 ,0x5 ,0x3e ,0x39 ,0x2e ,0x9 ,0x7 ,0x11 ,0x4e ,0x5f ,0x31 ,0x3 ,0x30 ,0x4 ,0x1 ,0x3 ,0x3b ,0xdd ,0x60 ,0x13 ,0xa8 ,0x3 ,0x4 ,0x2 ,0xb ,0xa ,0xda ,0x4c ,0x48 ,0xe ,0x2f ,0x1 ,0x7 ,0x2 ,0x1c ,0x12 ,0x33 ,0x16 ,0x5b ,0x5d ,0x29 ,0x2 ,0xe ,0xb9 ,0x6b ,0x78 ,0x6f ,0x7 ,0x7 ,0x6c ,0x4e ,0x4 ,0x1 ,0x3b ,0x1d ,0x2 ,0x1 ,0xc ,0x7 ,0x1 ,0xd5 ,0x2 ,0x2a ,0x22 ,0x64 ,0x4b ,0xb ,0x61 ,0x59 ,0x2f ,0x45 ,0x4e ,0x4 ,0x5 ,0x1 ,0x53 ,0x49 ,0xde ,0x31 ,0x9d ,0x9 ,0x1 ,0x9 ,0xe ,0x38 ,0x1e ,0x2 ,0xf ,0xb9 ,0x6b ,0x52 ,0x76 ,0xbf ,0x5 ,0x1 ,0x87 ,0x7c ,0x19 ,0xc8 ,0xf ,0xc0 ,0x8c ,0xae ,0x30 ,0x7 ,0x41 ,0x1 ,0xa ,0x1 ,0xda ,0x2 ,0x9e ,0x1 ,0x1 ,0xb8 ,0x34 ,0x7a ,0x1 ,0x1 ,0x68 ,0xd ,0x5 ,0x91 ,0xd9 ,0xa1 ,0x36 ,0x4a ,0xf ,0x1 ,0x1 ,0x2 ,0x22 ,0x5a ,0x68 ,0x50 ,0x36 ,0x8a ,0x9e ,0x46 ,0x8 ,0x7 ,0xd ,0x3 ,0x9 ,0x1 ,0x7a ,0x11 ,0xa3 ,0x10 ,0x4e ,0xab ,0x38 ,0xe ,0xd0 ,0x46 ,0x4d ,0x19 ,0xa ,0x8 ,0x3d ,0x4 ,0x6d ,0x2 ,0x46 ,0xf ,0x25 ,0x4c ,0x8 ,0x95 ,0x79 ,0x4 ,0x3 ,0xf ,0x5 ,0x1 ,0xb5 ,0x3c ,0x1 ,0x48 ,0x3 ,0x5 ,0xa2 ,0x1 ,0x6d ,0x1 ,0x98 ,0x4 ,0x4 ,0x32 ,0x7a ,0x39 ,0x10 ,0x5f ,0x27 ,0x52 ,0x4b ,0x55 ,0x5f ,0x73 ,0x3b ,0xa8 ,0x2 ,0x9b ,0xaa ,0x4e ,0xf ,0x8a ,0xb ,0x23 ,0x9 ,0x1d ,0xc ,0x73 ,0x1d ,0x3 ,0x3 ,0xe7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x87 ,0x43 ,0xb9 ,0x19 ,0x6e ,0x4a ,0x67 ,0x35 ,0x11 ,0x2 ,0xa ,0x4d ,0x3a ,0x3 ,0x25 ,0x10 ,0x22 ,0x26 ,0x5c ,0x15 ,0x5b ,0x41 ,0x39 ,0x76 ,0x51 ,0x5 ,0x1e ,0xb9 ,0x3b ,0x6d ,0xc9 ,0x3e ,0x19 ,0x30 ,0x21 ,0x47 ,0x68 ,0x22 ,0x4c ,0xa ,0x63 ,0xb ,0x15 ,0x25 ,0x5e ,0xfb ,0x8 ,0xf ,0x21 ,0x1c ,0x22 ,0x2 ,0xb6 ,0x33 ,0x2 ,0x10 ,0x12 ,0x64 ,0xbc ,0x3c ,0x2a ,0x9 ,0x8e ,0x55 ,0x27 ,0x70 ,0x5 ,0x3f ,0x6 ,0x10 ,0x16 ,0x58 ,0xf8 ,0x12 ,0xa4 ,0x27 ,0x8f ,0x14 ,0x2 ,0x57 ,0x28 ,0x5f ,0x1f ,0x33 ,0x64 ,0x2a ,0x21 ,0x74 ,0x3a ,0x67 ,0x2e ,0x3d ,0xc ,0x16 ,0x7 ,0x24 ,0x77 ,0x3a ,0x64 ,0x14 ,0x6 ,0x22 ,0x10 ,0x47 ,0x70 ,0x1d ,0x4c ,0x52 ,0xb ,0x11 ,0x51 ,0x69 ,0x27 ,0x9d ,0x4 ,0x54 ,0x4f ,0x2c ,0x3 ,0x10 ,0x1b ,0x3 ,0x1c ,0x27 ,0x42 ,0x8 ,0x88 ,0xdc ,0x23 ,0x41 ,0x50 ,0x4f ,0x31 ,0x2 ,0x1 ,0x68 ,0x15 ,0xa ,0x3a ,0x2 ,0x5 ,0x28 ,0x25 ,0x53 ,0xb0 ,0x3b ,0x6 ,0x7d ,0x6 ,0x45 ,0x4c ,0x9e ,0x3e ,0x45 ,0x4d ,0x38 ,0x8 ,0x73 ,0x68 ,0x11 ,0xba ,0x7b ,0xf ,0x2d ,0x4b ,0x1 ,0xa ,0x5a ,0x3e ,0x53 ,0x10 ,0x17 ,0x18 ,0x51 ,0x60 ,0xc0 ,0x40 ,0xb ,0xc ,0x1d ,0xa2 ,0x1b ,0xc ,0xc ,0x1e ,0x25 ,0x9f ,0x67 ,0x3d ,0x79 ,0x2b ,0x19 ,0x25 ,0x77 ,0x4a ,0x8e ,0x28 ,0x69 ,0xe ,0xbc ,0x1 ,0x1 ,0x3b ,0x7 ,0xe ,0x1a ,0x7 ,0x30 ,0x3e ,0x67 ,0x46 ,0x6 ,0x4e ,0x3a ,0xd ,0x24 ,0x48 ,0x24 ,0x8 ,0x9d ,0x8d ,0x31 ,0x7 ,0x5 ,0x25 ,0x53 ,0x2 ,0x9 ,0x24 ,0x15 ,0x33 ,0x46 ,0x69 ,0x11 ,0x3 ,0x15 ,0x29 ,0x4c ,0x58 ,0x60 ,0x8f ,0x26 ,0x5 ,0x13 ,0x3 ,0x1e ,0x1 ,0x45 ,0x75 ,0x6 ,0xb ,0xd ,0xb ,0x1 ,0x5 ,0x2f ,0x9c ,0x60 ,0x7 ,0x38 ,0x5d ,0x84 ,0x8 ,0xb5 ,0x46 ,0x52 ,0x3e ,0x34 ,0x29 ,0x3 ,0x69 ,0x36 ,0x2 ,0x90 ,0x3b ,0x1 ,0x24 ,0x5b ,0xa ,0x35 ,0x2b ,0x20 ,0x4d ,0x1 ,0x9 ,0x19 ,0x10 ,0x47 ,0x31 ,0x43 ,0x4f ,0x4b ,0x4f ,0xaa ,0x25 ,0x2 ,0x2 ,0xb0 ,0x8 ,0x24 ,0x1e ,0x9 ,0x6b ,0x2c ,0x51 ,0x4a ,0x4f ,0x4c ,0x1d ,0x8d ,0xf0 ,0xa ,0x28 ,0x3a ,0x24 ,0x81 ,0x12 ,0x28 ,0x7 ,0x26 ,0x3f ,0x36 ,0xa6 ,0x3 ,0xf ,0x4 ,0x9 ,0x38 ,0x6 ,0x7f ,0x21 ,0x6f ,0x5a ,0xac ,0x75 ,0x65 ,0x2d ,0xd2 ,0xf ,0x1c ,0x1 ,0x4d ,0x2b ,0x6c ,0x22 ,0x44 ,0x9c ,0x9d ,0x81 ,0x94 ,0x2c ,0x38 ,0x2e ,0x1 ,0x2e ,0x65 ,0x38 ,0x4 ,0x22 ,0xc2 ,0xd ,0x16 ,0x15 ,0x1 ,0x6 ,0xad ,0x3 ,0x77 ,0x5 ,0x21 ,0x86 ,0x3 ,0xa5 ,0x96 ,0x44 ,0x1 ,0x3 ,0xd ,0xae ,0x3e ,0x33 ,0xc ,0xd ,0x3 ,0x1 ,0x4b ,0x26 ,0x88 ,0x82 ,0x6a ,0x5d ,0x51 ,0x73 ,0x9a ,0xd ,0xc7 ,0x29 ,0x19 ,0x2e ,0x5b ,0x6a ,0x47 ,0x9f ,0x4b ,0x6 ,0x3b ,0x1 ,0x3c ,0x11 ,0x6a ,0x42 ,0xc8 ,0xd2 ,0x2 ,0x5 ,0x8 ,0x9d ,0xd ,0xb4 ,0xd0 ,0x1a ,0x80 ,0x48 ,0x1 ,0x7 ,0xa7 ,0x9 ,0x4c ,0x16 ,0x1d ,0x8c ,0x79 ,0x1 ,0x20 ,0x15 ,0xaf ,0xcc ,0xd ,0x4 ,0x8 ,0x8f ,0x1 ,0x15 ,0xf ,0x54 ,0x44 ,0x5 ,0x3 ,0x29 ,0x41 ,0x41 ,0x2c ,0x2 ,0x3 ,0x93 ,0x40 ,0x31 ,0x26 ,0x88 ,0x14 ,0x1c ,0x21 ,0xbb ,0x24 ,0xd ,0xba ,0x43 ,0xa4 ,0x3a ,0x31 ,0x50 ,0x1 ,0x93 ,0x9a ,0xc3 ,0xe7 ,0x79 ,0x6c ,0x21 ,0x72 ,0x22 ,0xd3 ,0x1 ,0x65 ,0x94 ,0x9 ,0x24 ,0x5 ,0x77 ,0x9a ,0x9f ,0x43 ,0x53 ,0x1 ,0x7 ,0xe ,0xd ,0xd3 ,0xbe ,0x28 ,0x8 ,0x3d ,0x91 ,0x35 ,0x13 ,0x94 ,0x35 ,0x6 ,0x9 ,0x11 ,0x34 ,0x3c ,0x14 ,0xd ,0xa ,0x1 ,0x12 ,0x65 ,0xa ,0x55 ,0x9d ,0x70 ,0x5f ,0xd ,0xc9 ,0x7 ,0x9a ,0x80 ,0x57 ,0x43 ,0x6c ,0x16 ,0x4 ,0x6 ,0xaa ,0x7a ,0x5 ,0x6 ,0x1b ,0x89 ,0x11 ,0x7 ,0x21 ,0xc ,0x13 ,0xba ,0x19 ,0x38 ,0x8c ,0x9 ,0x7 ,0xa3 ,0x6 ,0x79 ,0x70 ,0xbf ,0x7 ,0x9a ,0x1c ,0x8e ,0xd2 ,0xaa ,0xbd ,0x8e ,0xe ,0xc ,0x9c ,0x25 ,0xc ,0xb ,0x8e ,0x55 ,0x43 ,0x1d ,0x8 ,0x86 ,0x36 ,0x11 ,0x12 ,0x88 ,0x29 ,0x78 ,0xaa ,0x1e ,0xc ,0x1e ,0x20 ,0x56 ,0x58 ,0x7a ,0x3 ,0xb1 ,0x10 ,0x2c ,0x33 ,0x19 ,0x93 ,0xf2 ,0xa ,0x41 ,0x2e ,0xae ,0x24 ,0x4 ,0x22 ,0x49 ,0x17 ,0xbd ,0x98 ,0x31 ,0x23 ,0x1 ,0x3 ,0x93 ,0xa0 ,0xd9 ,0x23 ,0x72 ,0xc4 ,0x1 ,0xb2 ,0xb0 ,0x8e ,0x6 ,0x5f ,0x5c ,0xa5 ,0x80 ,0x6b ,0xb ,0x41 ,0xf ,0x7 ,0xc ,0x24 ,0x37 ,0x15 ,0x1d ,0x89 ,0x78 ,0xc7 ,0x99 ,0x78 ,0x5 ,0x71 ,0xf5 ,0xd ,0xc3 ,0x29 ,0x5 ,0x6a ,0x3e ,0xf ,0xd6 ,0x21 ,0x2 ,0x94 ,0x37 ,0x3a ,0x1 ,0x2 ,0x23 ,0xcb ,0x5 ,0x9c ,0x4b ,0x5d ,0xc ,0x10 ,0x13 ,0xd3 ,0xbb ,0x44 ,0x41 ,0x1 ,0x69 ,0x78 ,0x41 ,0x7b ,0x88 ,0x45 ,0x0 ,0x0 ,0x2 ,0xa ,0xf ,0x75 ,0x9 ,0x65 ,0x18 ,0x6 ,0x64 ,0x49 ,0x6 ,0x2b ,0xd ,0xb ,0x2f ,0x52 ,0xd1 ,0x8 ,0x8 ,0x1b ,0x41 ,0x75 ,0x6b ,0x15 ,0x1 ,0x6c ,0x2 ,0x9 ,0xe ,0x8d ,0x21 ,0x21 ,0x26 ,0x25 ,0x38 ,0x20 ,0x19 ,0x5 ,0x17 ,0x29 ,0x52 ,0x54 ,0x2 ,0x61 ,0x21 ,0x1 ,0x1b ,0x31 ,0x70 ,0x1 ,0x2 ,0xd ,0xf ,0x9c ,0x21 ,0x25 ,0x26 ,0x25 ,0x1 ,0x1c ,0x10 ,0x2 ,0x2 ,0xb8 ,0x52 ,0x54 ,0x24 ,0x7 ,0xa ,0x70 ,0xf ,0x4f ,0xc ,0x2 ,0x2 ,0x4 ,0xb ,0x9 ,0x44 ,0x7a ,0x3 ,0x34 ,0x2d ,0x38 ,0x5c ,0xf ,0x9f ,0x41 ,0x1a ,0x6d ,0x2 ,0x2 ,0x5 ,0x1 ,0x9 ,0x7a ,0x52 ,0x34 ,0x34 ,0x33 ,0x38 ,0x50 ,0xf ,0x9e ,0x50 ,0x1a ,0x6d ,0x2 ,0x2 ,0x14 ,0x1 ,0x8 ,0x1 ,0x35 ,0x87 ,0xf ,0x24 ,0x42 ,0xf ,0x5f ,0x39 ,0x17 ,0x7e ,0x2 ,0x20 ,0x1 ,0xe ,0xd ,0x52 ,0x9d ,0x1 ,0x1 ,0x7 ,0x1 ,0x1 ,0xf ,0x5f ,0x39 ,0x22 ,0x59 ,0x25 ,0x7e ,0x6b ,0x52 ,0x7 ,0x68 ,0x20 ,0x6 ,0x7 ,0xec ,0x3a ,0x37 ,0x1d ,0x17 ,0x2 ,0x7 ,0x8 ,0x52 ,0xb ,0x4 ,0x1d ,0xc ,0x7 ,0x23 ,0x9c ,0x2 ,0x1 ,0x9 ,0x4 ,0xf ,0x50 ,0x1f ,0x5 ,0x9 ,0x23 ,0x14 ,0xc5 ,0xc ,0x1 ,0x4c ,0xf ,0x5a ,0xb ,0xec ,0x5 ,0x2 ,0x1 ,0x18 ,0x1 ,0x1 ,0x78 ,0x6 ,0x95 ,0x3 ,0xbf ,0x61 ,0xf ,0x1d ,0x61 ,0x1b ,0x5a ,0x2f ,0x59 ,0x59 ,0x1e ,0x91 ,0x8 ,0x5 ,0x3 ,0xc8 ,0xea ,0x18 ,0x3a ,0x1b ,0x2 ,0x20 ,0x2 ,0x1d ,0x9 ,0x9 ,0x17 ,0x22 ,0x97 ,0x6 ,0x2 ,0x2 ,0x2 ,0x6f ,0x29 ,0x97 ,0xc ,0x13 ,0x50 ,0xa6 ,0xc5 ,0x1 ,0x3e ,0x70 ,0x30 ,0x37 ,0x89 ,0x51 ,0xf ,0x5a ,0x61 ,0x3 ,0x30 ,0xe ,0x2 ,0x9 ,0xaf ,0x6 ,0xb4 ,0x68 ,0x18 ,0x2 ,0x3f ,0x72 ,0x7b ,0x13 ,0x82 ,0x4d ,0x23 ,0x9 ,0x6 ,0x2 ,0x29 ,0x27 ,0x8 ,0xc5 ,0x3 ,0x5b ,0xd ,0xa0 ,0x5c ,0x54 ,0x1a ,0x9 ,0x14 ,0x1 ,0x22 ,0xe ,0x3 ,0x1 ,0x2a ,0x4 ,0x2c ,0x46 ,0x15 ,0x53 ,0xc1 ,0x1 ,0xbe ,0x2 ,0x37 ,0x96 ,0xcb ,0x34 ,0x4f ,0x1 ,0x87 ,0xb ,0x86 ,0x4 ,0x14 ,0x66 ,0xd8 ,0x33 ,0x3 ,0xdb ,0x5b ,0x4c ,0x3 ,0x57 ,0x4 ,0x5c ,0x2e ,0xbb ,0x8f ,0x53 ,0x4d ,0x12 ,0x6e ,0xb7 ,0xdf ,0x14 ,0x91 ,0xf ,0xbe ,0xae ,0xf ,0x9 ,0xa ,0x3d ,0x28 ,0xda ,0xb9 ,0x42 ,0x20 ,0x4 ,0x3 ,0xa3 ,0xaf ,0x6 ,0xb0 ,0xb4 ,0xb8 ,0x8a ,0xf ,0x1f ,0x18 ,0xa5 ,0x1b ,0x9 ,0x5 ,0x24 ,0x8 ,0x11 ,0x39 ,0x9 ,0x6 ,0x21 ,0x2 ,0x39 ,0x22 ,0xd ,0x17 ,0xb ,0x9 ,0x82 ,0x8 ,0x10 ,0x3 ,0xbe ,0x87 ,0xd0 ,0x2 ,0xca ,0xb ,0x44 ,0x74 ,0x4 ,0x11 ,0xda ,0xc8 ,0x3f ,0xd4 ,0x88 ,0x7 ,0x93 ,0x77 ,0xe ,0x2c ,0x5c ,0x12 ,0x61 ,0xb8 ,0x11 ,0x63 ,0xb7 ,0x8c ,0xb4 ,0x15 ,0x43 ,0xe ,0xbb ,0x1c ,0x7e ,0x1a ,0x39 ,0x2 ,0x2a ,0x2 ,0xa0 ,0x4e ,0x8 ,0x1a ,0x2b ,0xc ,0xa ,0x3 ,0x2d ,0x5a ,0x5e ,0x3 ,0x1d ,0x2 ,0xcf ,0xce ,0x4 ,0x12 ,0x1f ,0x5 ,0x6a ,0xd ,0x57 ,0xe8 ,0xdb ,0x1 ,0x12 ,0x16 ,0xd8 ,0x3 ,0x60 ,0xf ,0x34 ,0x1f ,0x10 ,0x3 ,0x28 ,0x36 ,0x38 ,0x4 ,0x8 ,0x30 ,0x1 ,0x44 ,0x26 ,0x4 ,0xcf ,0xdb ,0xc0 ,0x1 ,0xae ,0xb ,0x7 ,0x1c ,0x6 ,0x27 ,0x1 ,0xe5 ,0xcc ,0x4c ,0x91 ,0xc7 ,0x77 ,0x47 ,0x5b ,0x1b ,0x21 ,0xc ,0x51 ,0xb8 ,0xb ,0x6a ,0xa ,0x4f ,0x1 ,0x8 ,0x30 ,0x2 ,0xae ,0x64 ,0x44 ,0x26 ,0x67 ,0x28 ,0x50 ,0x48 ,0x90 ,0x2c ,0x37 ,0x5 ,0x38 ,0x58 ,0x9 ,0x57 ,0x85 ,0x1b ,0x10 ,0x2b ,0x25 ,0x90 ,0x2 ,0x33 ,0x9f ,0x91 ,0x6 ,0x2f ,0x8 ,0x6 ,0x1d ,0x13 ,0x1b ,0x50 ,0x4 ,0x4 ,0x8 ,0x3 ,0xe ,0x20 ,0x9 ,0x10 ,0x1b ,0x3 ,0x87 ,0x42 ,0x3f ,0x1b ,0xb4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x15 ,0x14 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x19 ,0x1a ,0x98 ,0x9a ,0x1e ,0x9c ,0x9e ,0x10 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x16 ,0x14 ,0x90 ,0x91 ,0x15 ,0x94 ,0x96 ,0x97 ,0x98 ,0xe ,0x8 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x87 ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x13 ,0x12 ,0x8e ,0x90 ,0x14 ,0x93 ,0x16 ,0x17 ,0x95 ,0x97 ,0x1b ,0x99 ,0x9b ,0xf ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x88 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x14 ,0x13 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x18 ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0xd ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xc ,0x89 ,0x8b ,0x14 ,0x12 ,0x11 ,0x8d ,0x8f ,0x13 ,0x92 ,0x94 ,0x16 ,0x96 ,0xc ,0x2 ,0x5 ,0x80 ,0x81 ,0x83 ,0x84 ,0x8 ,0x86 ,0xa ,0x88 ,0x8a ,0xd ,0x11 ,0x10 ,0x8c ,0x8e ,0x12 ,0x91 ,0x14 ,0x93 ,0x94 ,0x17 ,0x96 ,0x98 ,0xb ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x9 ,0x87 ,0x89 ,0x13 ,0x10 ,0xf ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x16 ,0x94 ,0x96 ,0xb ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x84 ,0x8 ,0x86 ,0xa ,0x89 ,0xc ,0x10 ,0xf ,0x8b ,0x8d ,0x11 ,0x90 ,0x13 ,0x92 ,0x93 ,0x95 ,0x96 ,0xb ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0x88 ,0x89 ,0xc ,0x10 ,0xe ,0x8b ,0x8d ,0x8f ,0x90 ,0x13 ,0x92 ,0x93 ,0x16 ,0x95 ,0x97 ,0xa ,0x2 ,0x80 ,0x81 ,0x82 ,0x6 ,0x7 ,0x85 ,0x9 ,0x88 ,0xb ,0xf ,0xe ,0x8a ,0x8c ,0x10 ,0x8f ,0x91 ,0x92 ,0x93 ,0x6 ,0x80 ,0x81 ,0x5 ,0x82 ,0x84 ,0x7 ,0xb ,0x9 ,0x86 ,0x88 ,0x8a ,0x10 ,0xf ,0x8c ,0x8e ,0x90 ,0x91 ,0x9 ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8a ,0x8c ,0x8d ,0x13 ,0x12 ,0x8f ,0x91 ,0x93 ,0x94 ,0x6 ,0x2 ,0x80 ,0x82 ,0x5 ,0x84 ,0x7 ,0xb ,0x9 ,0x86 ,0x88 ,0x8a ,0x8b ,0xe ,0x8d ,0x8e ,0x12 ,0x90 ,0x92 ,0x9 ,0x2 ,0x80 ,0x81 ,0x82 ,0x7 ,0x84 ,0x86 ,0x87 ,0xa ,0xb ,0x89 ,0x8a ,0x8c ,0x8d ,0x12 ,0x11 ,0x90 ,0x14 ,0x92 ,0x94 ,0x8 ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0x85 ,0x86 ,0x9 ,0xd ,0xc ,0x88 ,0x8a ,0x8c ,0x8d ,0x8f ,0x90 ,0x7 ,0x2 ,0x80 ,0x81 ,0x82 ,0x6 ,0x85 ,0xf ,0xc ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x8f ,0x90 ,0x91 ,0x6 ,0x2 ,0x80 ,0x81 ,0x82 ,0x84 ,0xd ,0x8 ,0x9 ,0x86 ,0x88 ,0x8a ,0x8b ,0x8d ,0x8e ,0x8f ,0x2 ,0x80 ,0x3 ,0x4 ,0x5 ,0x82 ,0x84 ,0x9 ,0x86 ,0x88 ,0x8a ,0xd ,0x8b ,0x8d ,0x2 ,0x80 ,0x8 ,0x4 ,0x5 ,0x82 ,0x84 ,0x86 ,0x88 ,0xa ,0x8a ,0x1 ,0x80 ,0x3 ,0x82 ,0x9 ,0x8 ,0x84 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0x8d ,0x2 ,0x80 ,0x3 ,0x4 ,0x6 ,0x82 ,0x84 ,0x8 ,0x87 ,0x89 ,0x1 ,0x80 ,0x81 ,0x8 ,0x7 ,0x6 ,0x84 ,0x86 ,0x88 ,0x1 ,0x80 ,0x3 ,0x82 ,0x5 ,0x83 ,0x85 ,0x87 ,0x88 ,0x89 ,0x1 ,0x80 ,0x3 ,0x7 ,0x5 ,0x83 ,0x85 ,0x87 ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x87 ,0x80 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x89 ,0x1 ,0x80 ,0x3 ,0x4 ,0x83 ,0x85 ,0x1 ,0x80 ,0x8 ,0x7 ,0x6 ,0x82 ,0x84 ,0x86 ,0x88 ,0x1 ,0x80 ,0x81 ,0x83 ,0x84 ,0x1 ,0x2 ,0x5 ,0x4 ,0x83 ,0x85 ,0x86 ,0x2 ,0x80 ,0x82 ,0x80 ,0x1 ,0x81 ,0x3 ,0x82 ,0x84 ,0x85 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0xc ,0x5 ,0x80 ,0x4 ,0x82 ,0x9 ,0x8 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0xd ,0xe ,0xf ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x18 ,0x16 ,0x94 ,0x96 ,0x19 ,0x99 ,0xd ,0x6 ,0x3 ,0x5 ,0x81 ,0x83 ,0xa ,0x8 ,0x85 ,0x87 ,0xc ,0x89 ,0x8b ,0xe ,0xf ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x17 ,0x97 ,0xe ,0x7 ,0x3 ,0x4 ,0x81 ,0x6 ,0x84 ,0xb ,0x9 ,0x86 ,0x88 ,0xd ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x8e ,0x90 ,0x14 ,0x93 ,0x16 ,0x17 ,0x96 ,0x98 ,0xe ,0x7 ,0x3 ,0x4 ,0x81 ,0x6 ,0x84 ,0xb ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x17 ,0x18 ,0x97 ,0x99 ,0xe ,0x7 ,0x3 ,0x4 ,0x81 ,0x6 ,0x84 ,0xb ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x8f ,0x13 ,0x92 ,0x15 ,0x94 ,0x96 ,0xc ,0x5 ,0x80 ,0x4 ,0x82 ,0x6 ,0x8 ,0x84 ,0x86 ,0xb ,0x88 ,0x8a ,0xd ,0xe ,0xf ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x94 ,0xb ,0x5 ,0x80 ,0x4 ,0x82 ,0x8 ,0x84 ,0x85 ,0x9 ,0x87 ,0x89 ,0xc ,0xd ,0xf ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x96 ,0x8 ,0x2 ,0x3 ,0x4 ,0x82 ,0x7 ,0x84 ,0x86 ,0x9 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8d ,0x10 ,0x90 ,0x8 ,0x2 ,0x5 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0x9 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x90 ,0x91 ,0x8 ,0x2 ,0x3 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0x9 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x90 ,0x5 ,0x80 ,0x4 ,0x81 ,0x83 ,0xc ,0x9 ,0x8 ,0x86 ,0xa ,0x88 ,0x8a ,0xd ,0xf ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x4 ,0x80 ,0x3 ,0x82 ,0x5 ,0x6 ,0x7 ,0x84 ,0x86 ,0xb ,0x88 ,0x8a ,0xd ,0xe ,0x8d ,0x8f ,0x90 ,0x4 ,0x80 ,0x3 ,0x82 ,0x5 ,0x9 ,0x7 ,0x84 ,0x86 ,0xb ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x8f ,0x2 ,0x80 ,0x9 ,0x7 ,0x5 ,0x82 ,0x84 ,0x8 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0x8d ,0x8e ,0x2 ,0x80 ,0x3 ,0x7 ,0x6 ,0x82 ,0x84 ,0x8 ,0x87 ,0xa ,0x89 ,0x8a ,0xd ,0x8d ,0x5 ,0x2 ,0x3 ,0x4 ,0x83 ,0x6 ,0xa ,0x9 ,0x85 ,0x87 ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8e ,0x90 ,0x2 ,0x80 ,0xa ,0x4 ,0x6 ,0x82 ,0x84 ,0x9 ,0x86 ,0x88 ,0xb ,0xc ,0x8b ,0x8d ,0x8e ,0x2 ,0x80 ,0xa ,0x7 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xb ,0xc ,0x8b ,0x8d ,0x1 ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x2 ,0x80 ,0x3 ,0x6 ,0x5 ,0x83 ,0x8 ,0x85 ,0x87 ,0x89 ,0xb ,0x8b ,0x2 ,0x80 ,0x8 ,0x6 ,0x82 ,0x83 ,0x7 ,0x86 ,0x9 ,0xb ,0x89 ,0x8b ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x9 ,0x87 ,0x89 ,0x8a ,0x3 ,0x80 ,0x81 ,0x4 ,0x8 ,0x7 ,0x83 ,0x85 ,0x87 ,0x88 ,0x8a ,0x8b ,0x8c ,0x1 ,0x2 ,0x81 ,0x5 ,0x82 ,0x84 ,0x86 ,0x5 ,0x80 ,0x4 ,0x81 ,0x83 ,0x6 ,0x7 ,0x9 ,0x86 ,0x88 ,0x8a ,0x8b ,0x8c ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x88 ,0x8a ,0x8b ,0x8d ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x8a ,0x1 ,0x2 ,0x5 ,0x4 ,0x82 ,0x84 ,0x85 ,0x87 ,0xa ,0x88 ,0x8a ,0x1 ,0x81 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0x80 ,0x1 ,0x81 ,0x3 ,0x4 ,0x84 ,0x80 ,0x81 ,0x3 ,0x83 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x1 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x12 ,0x14 ,0x90 ,0x92 ,0x16 ,0x95 ,0x18 ,0x1a ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x12 ,0x14 ,0x90 ,0x92 ,0x16 ,0x95 ,0x1a ,0x19 ,0x98 ,0x1b ,0x9a ,0x9c ,0xe ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0xc ,0xa ,0x87 ,0x89 ,0xd ,0x8c ,0xf ,0x10 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x1a ,0x18 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0xe ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0x8c ,0xf ,0x10 ,0x12 ,0x8e ,0x90 ,0x14 ,0x93 ,0x19 ,0x17 ,0x95 ,0x97 ,0x1a ,0x99 ,0x9b ,0xf ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0xc ,0xb ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x11 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x18 ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0xe ,0x7 ,0x3 ,0x80 ,0x81 ,0x83 ,0x84 ,0x8 ,0xa ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x10 ,0x12 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x1a ,0x19 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0xd ,0x6 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0xe ,0xf ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x17 ,0x95 ,0x97 ,0x1a ,0x99 ,0x9b ,0xe ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xc ,0xb ,0x89 ,0x8b ,0x8c ,0xf ,0x10 ,0x12 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x1a ,0x19 ,0x96 ,0x98 ,0x1c ,0x9a ,0x9c ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x88 ,0x89 ,0xd ,0x8b ,0x8d ,0x16 ,0x14 ,0x13 ,0x8f ,0x91 ,0x93 ,0x94 ,0x17 ,0x18 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xc ,0x88 ,0x8a ,0xe ,0x8d ,0x10 ,0x11 ,0x13 ,0x8f ,0x91 ,0x93 ,0x16 ,0x17 ,0x95 ,0x97 ,0x1b ,0x99 ,0x9b ,0x1 ,0x8 ,0x5 ,0x80 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0x8b ,0x15 ,0xf ,0x10 ,0x8d ,0x8f ,0x14 ,0x91 ,0x93 ,0x16 ,0x96 ,0x97 ,0x1 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x15 ,0x12 ,0x11 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x18 ,0x95 ,0x97 ,0x1a ,0x99 ,0x9b ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0x8c ,0x8d ,0x10 ,0x11 ,0x12 ,0x90 ,0x14 ,0x93 ,0x16 ,0x18 ,0x95 ,0x97 ,0x1a ,0x9a ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8d ,0x15 ,0x12 ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x96 ,0x1 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x15 ,0xf ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x96 ,0x19 ,0x99 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x90 ,0x12 ,0x13 ,0x93 ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x89 ,0xc ,0xd ,0xe ,0x8c ,0x8e ,0x8f ,0x14 ,0x91 ,0x92 ,0x94 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x88 ,0x8a ,0x13 ,0xe ,0x8c ,0x8d ,0x11 ,0x8f ,0x91 ,0x17 ,0x15 ,0x93 ,0x95 ,0x97 ,0x1 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0xa ,0x9 ,0x85 ,0x87 ,0x89 ,0x10 ,0xd ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x92 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0xb ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x8f ,0x11 ,0x91 ,0x92 ,0x1 ,0x80 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xf ,0xe ,0xd ,0x89 ,0x8b ,0x8d ,0x8f ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0x8b ,0x8c ,0xf ,0x10 ,0x8f ,0x12 ,0x91 ,0x93 ,0x1 ,0x8 ,0x3 ,0x4 ,0x81 ,0x6 ,0x83 ,0x85 ,0x87 ,0xa ,0x89 ,0x8a ,0x8c ,0x8d ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0x88 ,0x8a ,0xc ,0x8c ,0x8d ,0xd ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x88 ,0xc ,0x8b ,0x8d ,0xf ,0x8e ,0x90 ,0x9 ,0x6 ,0x80 ,0x4 ,0x81 ,0x83 ,0x85 ,0x8 ,0x87 ,0xa ,0xb ,0x8a ,0xd ,0x8c ,0x8e ,0x1 ,0x2 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x82 ,0x83 ,0x6 ,0x85 ,0x87 ,0x1 ,0x80 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0xa ,0x87 ,0x88 ,0x8a ,0xa ,0x2 ,0x3 ,0x81 ,0x8 ,0x6 ,0x83 ,0x85 ,0x9 ,0x88 ,0xb ,0xc ,0x8c ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0xd ,0x8d ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x10 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x14 ,0x90 ,0x92 ,0x17 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1e ,0x9c ,0x9e ,0x10 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x15 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x15 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1e ,0x9c ,0x9e ,0x10 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x18 ,0x15 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0xf ,0x2 ,0x5 ,0x80 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0xe ,0x8b ,0x8d ,0x17 ,0x14 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x1b ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x18 ,0x15 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x9c ,0x9d ,0x1 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x10 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x12 ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x18 ,0x15 ,0x13 ,0x90 ,0x92 ,0x17 ,0x94 ,0x96 ,0x1c ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0xb ,0x87 ,0x89 ,0xd ,0x8c ,0x16 ,0x10 ,0x11 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x17 ,0x96 ,0x97 ,0x1a ,0x9a ,0xe ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0x8c ,0xf ,0x13 ,0x11 ,0x8f ,0x91 ,0x93 ,0x94 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0x8c ,0x8d ,0x10 ,0x11 ,0x90 ,0x91 ,0x14 ,0x15 ,0x94 ,0x17 ,0x96 ,0x98 ,0xd ,0x2 ,0x4 ,0x80 ,0x5 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0xe ,0x12 ,0x11 ,0x8d ,0x8f ,0x13 ,0x92 ,0x18 ,0x16 ,0x94 ,0x96 ,0x98 ,0x99 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0x13 ,0xd ,0xf ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x16 ,0x94 ,0x96 ,0xc ,0x6 ,0x3 ,0x80 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0xb ,0x88 ,0x8a ,0x14 ,0xe ,0xf ,0x8c ,0x8e ,0x13 ,0x90 ,0x92 ,0x15 ,0x94 ,0x95 ,0x19 ,0x97 ,0x99 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0x8c ,0x13 ,0x10 ,0x11 ,0x8f ,0x91 ,0x93 ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0x1 ,0x9 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x88 ,0x89 ,0xe ,0x8b ,0x8d ,0x10 ,0x11 ,0x13 ,0x91 ,0x93 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x90 ,0x92 ,0x93 ,0x94 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0xc ,0xb ,0x87 ,0x89 ,0x8b ,0xe ,0x8d ,0x8e ,0x11 ,0x12 ,0x91 ,0x93 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0x9 ,0x6 ,0x5 ,0x80 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0xa ,0xe ,0xc ,0x89 ,0x8b ,0xf ,0x8e ,0x11 ,0x12 ,0x91 ,0x93 ,0x1 ,0x6 ,0x3 ,0x80 ,0x5 ,0x83 ,0x7 ,0x8 ,0x85 ,0x87 ,0x89 ,0x8a ,0x12 ,0xe ,0xf ,0x8c ,0x8e ,0x90 ,0x13 ,0x93 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x11 ,0x91 ,0x80 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x87 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x89 ,0x8 ,0x2 ,0x80 ,0x81 ,0x82 ,0x84 ,0x85 ,0x86 ,0xe ,0xa ,0xb ,0x88 ,0x8a ,0x8c ,0xf ,0x8f ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x87 ,0x88 ,0xc ,0x8b ,0xe ,0xf ,0x10 ,0x90 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x9 ,0x86 ,0x87 ,0x89 ,0x8a ,0x7 ,0x5 ,0x3 ,0x4 ,0x82 ,0x84 ,0x85 ,0x8 ,0x88 ,0x80 ,0x2 ,0x3 ,0x5 ,0x83 ,0x85 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0x80 ,0x2 ,0x82 ,0x83 ,0x84 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x80 ,0x80 ,0x80 ,0x80 ,0x10 ,0x9 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x15 ,0x14 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x19 ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x10 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x14 ,0x90 ,0x92 ,0x16 ,0x95 ,0x18 ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x10 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x14 ,0x90 ,0x92 ,0x17 ,0x94 ,0x96 ,0x19 ,0x98 ,0x99 ,0x1d ,0x9b ,0x9d ,0xe ,0x8 ,0x5 ,0x4 ,0x81 ,0x7 ,0x83 ,0x85 ,0xc ,0xa ,0x87 ,0x89 ,0x8b ,0x8c ,0x16 ,0x10 ,0x11 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x19 ,0x18 ,0x97 ,0x1a ,0x99 ,0x9b ,0xc ,0x6 ,0x80 ,0x5 ,0x81 ,0x83 ,0xa ,0x8 ,0x85 ,0x87 ,0x89 ,0x8a ,0xd ,0xe ,0x10 ,0x8c ,0x8e ,0x90 ,0x13 ,0x92 ,0x93 ,0x17 ,0x95 ,0x97 ,0xc ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0xb ,0x88 ,0x8a ,0x14 ,0xe ,0xf ,0x8c ,0x8e ,0x13 ,0x90 ,0x92 ,0x94 ,0x16 ,0x96 ,0xa ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x8 ,0x86 ,0x88 ,0x12 ,0xc ,0xe ,0x8a ,0x8c ,0x11 ,0x8e ,0x90 ,0x92 ,0x14 ,0x94 ,0xc ,0x5 ,0x3 ,0x81 ,0x82 ,0x6 ,0x8 ,0x84 ,0x86 ,0xb ,0x88 ,0x8a ,0xd ,0xe ,0x8c ,0x8d ,0x12 ,0x8f ,0x91 ,0x14 ,0x15 ,0x93 ,0x95 ,0x18 ,0x98 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0x13 ,0xe ,0x8c ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x15 ,0x94 ,0x96 ,0xb ,0x7 ,0x3 ,0x4 ,0x81 ,0x6 ,0x84 ,0x86 ,0x9 ,0x87 ,0x89 ,0x13 ,0x10 ,0xe ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x15 ,0x95 ,0xb ,0x5 ,0x3 ,0x81 ,0x82 ,0x8 ,0x7 ,0x85 ,0x9 ,0x87 ,0x89 ,0x13 ,0xd ,0xf ,0x8b ,0x8d ,0x11 ,0x8f ,0x91 ,0x14 ,0x93 ,0x94 ,0x17 ,0x97 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0x87 ,0x88 ,0x8a ,0x8b ,0xe ,0x10 ,0x8e ,0x11 ,0x90 ,0x92 ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0x8b ,0x11 ,0x8d ,0x10 ,0x8f ,0x12 ,0x91 ,0x92 ,0x94 ,0x1 ,0x8 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0x87 ,0x88 ,0xc ,0x8b ,0x11 ,0xf ,0x8e ,0x8f ,0x12 ,0x91 ,0x92 ,0x94 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0x87 ,0xa ,0x88 ,0x8a ,0x10 ,0xe ,0x8d ,0x8e ,0x13 ,0x90 ,0x91 ,0x14 ,0x94 ,0x1 ,0x5 ,0x3 ,0x81 ,0x82 ,0x84 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0xd ,0x8a ,0x8c ,0xf ,0x10 ,0x90 ,0x1 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0x89 ,0xc ,0x8c ,0x8d ,0xc ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0x88 ,0x89 ,0x8a ,0xd ,0x8d ,0xb ,0x8 ,0x3 ,0x4 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0xa ,0x89 ,0x8b ,0x10 ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0xc ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x9 ,0x8 ,0x86 ,0xb ,0x88 ,0x8a ,0x8c ,0xf ,0x8d ,0x8f ,0x1 ,0x6 ,0x5 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0xa ,0x88 ,0x8a ,0x13 ,0x11 ,0x10 ,0x8c ,0x8e ,0x12 ,0x91 ,0x15 ,0x93 ,0x95 ,0x1 ,0x4 ,0x3 ,0x81 ,0x8 ,0x6 ,0x83 ,0x85 ,0x9 ,0x88 ,0x11 ,0xc ,0xe ,0x8a ,0x8c ,0x10 ,0x8f ,0x12 ,0x14 ,0x91 ,0x93 ,0x95 ,0x1 ,0x2 ,0x80 ,0x81 ,0x82 ,0x7 ,0x84 ,0x8 ,0x87 ,0xa ,0xd ,0xc ,0x8a ,0xf ,0x8c ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0xe ,0x8b ,0x8d ,0x10 ,0x90 ,0x1 ,0x2 ,0x3 ,0x81 ,0x82 ,0x84 ,0x85 ,0xd ,0x9 ,0xa ,0x87 ,0x89 ,0x8b ,0x8d ,0x8e ,0x1 ,0x2 ,0x80 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x9 ,0x88 ,0xb ,0x8a ,0x8c ,0xe ,0x8e ,0x9 ,0x80 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x8a ,0x8c ,0x1 ,0x2 ,0x80 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x87 ,0xc ,0x89 ,0x8a ,0x8c ,0x1 ,0x80 ,0x3 ,0x7 ,0x6 ,0x82 ,0x84 ,0x9 ,0x86 ,0x88 ,0xb ,0x8b ,0x1 ,0x80 ,0x3 ,0x4 ,0x5 ,0x83 ,0x85 ,0x8 ,0x88 ,0x80 ,0x2 ,0x3 ,0x82 ,0x83 ,0x9 ,0x7 ,0x85 ,0x87 ,0x89 ,0x8a ,0xc ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0xb ,0xa ,0x86 ,0x88 ,0x8a ,0xd ,0x8d ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8e ,0x1 ,0x2 ,0x3 ,0x80 ,0x81 ,0x83 ,0x7 ,0x8 ,0x87 ,0x89 ,0x80 ,0x2 ,0x82 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x18 ,0x15 ,0x14 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x19 ,0x1a ,0x98 ,0x9a ,0x1e ,0x9c ,0x9e ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x18 ,0x15 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x19 ,0x1b ,0x98 ,0x9a ,0x1e ,0x9c ,0x9e ,0x1 ,0x8 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0xc ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x17 ,0x14 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x18 ,0x1a ,0x97 ,0x99 ,0x1d ,0x9b ,0x9d ,0x1 ,0x8 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0xb ,0x87 ,0x88 ,0xc ,0x8a ,0x8c ,0x16 ,0x13 ,0x12 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x17 ,0x18 ,0x96 ,0x98 ,0x1c ,0x9a ,0x9c ,0x1 ,0x8 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0xc ,0xb ,0x87 ,0x89 ,0xe ,0x8b ,0x8d ,0x16 ,0x14 ,0x13 ,0x8f ,0x91 ,0x93 ,0x94 ,0x17 ,0x18 ,0x96 ,0x98 ,0x1b ,0x9b ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x15 ,0x13 ,0x90 ,0x92 ,0x17 ,0x94 ,0x96 ,0x19 ,0x1b ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x6 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xb ,0x8a ,0xd ,0x11 ,0xf ,0x8c ,0x8e ,0x13 ,0x90 ,0x92 ,0x15 ,0x17 ,0x94 ,0x96 ,0x19 ,0x98 ,0x9a ,0x1 ,0x7 ,0x5 ,0x4 ,0x81 ,0x83 ,0x84 ,0x8 ,0x86 ,0x87 ,0xb ,0x8a ,0xd ,0x11 ,0xf ,0x8c ,0x8e ,0x13 ,0x90 ,0x92 ,0x15 ,0x17 ,0x94 ,0x96 ,0x19 ,0x98 ,0x9a ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x15 ,0x14 ,0x90 ,0x92 ,0x16 ,0x95 ,0x1b ,0x19 ,0x97 ,0x99 ,0x9b ,0x10 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x17 ,0x14 ,0x13 ,0x91 ,0x15 ,0x93 ,0x95 ,0x97 ,0x98 ,0x1 ,0x9 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x13 ,0x90 ,0x92 ,0x17 ,0x94 ,0x96 ,0x98 ,0x1a ,0x99 ,0x9b ,0x10 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x15 ,0x12 ,0x14 ,0x91 ,0x93 ,0x16 ,0x17 ,0x96 ,0x19 ,0x99 ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x89 ,0x8b ,0x13 ,0xf ,0x8d ,0x8e ,0x12 ,0x91 ,0x16 ,0x93 ,0x94 ,0x96 ,0xd ,0x6 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xc ,0x89 ,0x8b ,0xe ,0x12 ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x96 ,0x98 ,0x1 ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x89 ,0x8b ,0x13 ,0xf ,0x10 ,0x8e ,0x12 ,0x91 ,0x16 ,0x15 ,0x94 ,0x17 ,0x97 ,0x10 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x14 ,0x12 ,0x13 ,0x92 ,0x15 ,0x17 ,0x95 ,0x97 ,0xc ,0x5 ,0x3 ,0x80 ,0x82 ,0x6 ,0x8 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0xd ,0x11 ,0x10 ,0x8c ,0x8e ,0x90 ,0x91 ,0x15 ,0x93 ,0x17 ,0x95 ,0x97 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8e ,0x11 ,0x91 ,0xc ,0x6 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x9 ,0x85 ,0x87 ,0xb ,0x8a ,0xd ,0xe ,0xf ,0x8c ,0x8e ,0x90 ,0x91 ,0x14 ,0x16 ,0x93 ,0x95 ,0x97 ,0x1 ,0x6 ,0x3 ,0x5 ,0x81 ,0x83 ,0xa ,0x8 ,0x85 ,0x87 ,0x89 ,0x11 ,0xf ,0x8b ,0x8c ,0x10 ,0x8f ,0x12 ,0x13 ,0x91 ,0x93 ,0x95 ,0x96 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0x88 ,0xf ,0xc ,0x8a ,0x8b ,0x8d ,0x12 ,0x8f ,0x90 ,0x13 ,0x93 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x8 ,0x9 ,0x87 ,0x89 ,0x8a ,0x8c ,0x8d ,0x8e ,0x8f ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x88 ,0x8a ,0x8c ,0x1 ,0x7 ,0x4 ,0x80 ,0x5 ,0x82 ,0x84 ,0x8 ,0xa ,0x86 ,0x88 ,0x8a ,0x8b ,0x10 ,0xf ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0xb ,0x87 ,0x88 ,0xd ,0x8a ,0x8c ,0x8e ,0x8f ,0x1 ,0x8 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0x88 ,0x89 ,0xc ,0x8c ,0x8d ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x87 ,0x89 ,0x1 ,0x8 ,0x5 ,0x80 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0xb ,0x87 ,0x89 ,0x8b ,0x8c ,0x8e ,0x8f ,0x11 ,0x90 ,0x92 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x88 ,0x8a ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0xe ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x17 ,0x19 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0xf ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8d ,0x16 ,0x11 ,0x8f ,0x90 ,0x14 ,0x92 ,0x94 ,0x17 ,0x18 ,0x96 ,0x98 ,0x9a ,0x9b ,0xf ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0xe ,0x8b ,0x8d ,0x17 ,0x11 ,0x13 ,0x8f ,0x91 ,0x16 ,0x93 ,0x95 ,0x97 ,0x1a ,0x98 ,0x9a ,0xe ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0xd ,0x8c ,0x13 ,0x8e ,0x12 ,0x8f ,0x91 ,0x16 ,0x15 ,0x94 ,0x17 ,0x96 ,0x98 ,0xb ,0x2 ,0x80 ,0x4 ,0x82 ,0x6 ,0x7 ,0x85 ,0x9 ,0x87 ,0x89 ,0x13 ,0x10 ,0xe ,0x8b ,0x8d ,0x11 ,0x8f ,0x91 ,0x14 ,0x15 ,0x93 ,0x95 ,0x97 ,0x98 ,0xb ,0x2 ,0x80 ,0x81 ,0x82 ,0x8 ,0x7 ,0x85 ,0x9 ,0x87 ,0x89 ,0x13 ,0xd ,0xf ,0x8b ,0x8d ,0x11 ,0x8f ,0x91 ,0x14 ,0x16 ,0x94 ,0x96 ,0xe ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0x8b ,0x8c ,0xf ,0x8e ,0x12 ,0x8f ,0x91 ,0x14 ,0x16 ,0x93 ,0x95 ,0x19 ,0x97 ,0x99 ,0x9 ,0x2 ,0x80 ,0x6 ,0x5 ,0x83 ,0x7 ,0x85 ,0x87 ,0x10 ,0xb ,0xd ,0x89 ,0x8b ,0x8d ,0x8e ,0x11 ,0x12 ,0x91 ,0x93 ,0x94 ,0xa ,0x2 ,0x3 ,0x80 ,0x81 ,0x6 ,0x84 ,0x8 ,0x87 ,0x88 ,0xb ,0x8a ,0xe ,0x8b ,0x8d ,0x10 ,0x12 ,0x8f ,0x91 ,0x93 ,0xa ,0x2 ,0x80 ,0x81 ,0x7 ,0x83 ,0x84 ,0x9 ,0x86 ,0x88 ,0xb ,0xc ,0xe ,0x8c ,0x8e ,0xb ,0x2 ,0x3 ,0x80 ,0x81 ,0x6 ,0x84 ,0x9 ,0x86 ,0x88 ,0x89 ,0x13 ,0xd ,0xf ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0x15 ,0x95 ,0x1 ,0x5 ,0x80 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0x87 ,0x10 ,0xe ,0xc ,0x89 ,0x8b ,0xf ,0x8e ,0x14 ,0x13 ,0x90 ,0x92 ,0x15 ,0x94 ,0x96 ,0x1 ,0x5 ,0x80 ,0x4 ,0x82 ,0x84 ,0x85 ,0x8 ,0xc ,0xb ,0x87 ,0x89 ,0xe ,0x8b ,0x8d ,0x8f ,0x1 ,0x3 ,0x80 ,0x82 ,0x83 ,0xc ,0x9 ,0x85 ,0x86 ,0xa ,0x88 ,0x8a ,0x10 ,0xe ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x1 ,0x7 ,0x3 ,0x80 ,0x6 ,0x82 ,0x84 ,0xb ,0xa ,0x86 ,0x88 ,0x8a ,0x8b ,0x8d ,0x8e ,0xb ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0xd ,0x8d ,0x1 ,0x6 ,0x3 ,0x80 ,0x5 ,0x83 ,0x85 ,0xe ,0xc ,0xb ,0x87 ,0x89 ,0xd ,0x8c ,0xf ,0x10 ,0x8f ,0x91 ,0x92 ,0x8 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x88 ,0x89 ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x88 ,0x89 ,0x1 ,0x8 ,0x5 ,0x4 ,0x81 ,0x7 ,0x83 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0x8b ,0x8d ,0x8e ,0x1 ,0x7 ,0x3 ,0x4 ,0x81 ,0x83 ,0x84 ,0x8 ,0x9 ,0x88 ,0xb ,0xc ,0xd ,0x8a ,0x8c ,0x8e ,0x90 ,0x9 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x89 ,0x1 ,0x7 ,0x6 ,0x5 ,0x81 ,0x83 ,0x85 ,0x87 ,0xb ,0x8 ,0x5 ,0x80 ,0x81 ,0x7 ,0x83 ,0x85 ,0x9 ,0xa ,0x89 ,0x8b ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x87 ,0x88 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0x88 ,0x89 ,0x8b ,0x8c ,0x1 ,0x5 ,0x3 ,0x81 ,0x82 ,0x6 ,0x85 ,0x86 ,0x9 ,0xa ,0xc ,0x88 ,0x8a ,0x8c ,0x8d ,0x8f ,0x80 ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x88 ,0x1 ,0x2 ,0x80 ,0x82 ,0x84 ,0x85 ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x88 ,0x1 ,0x4 ,0x80 ,0x81 ,0x5 ,0x83 ,0x84 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x82 ,0x84 ,0x6 ,0x86 ,0x1 ,0x81 ,0x3 ,0x83 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x9 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x11 ,0xe ,0xd ,0x89 ,0x8b ,0x10 ,0x8d ,0x8f ,0x12 ,0x13 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x9 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0xc ,0x8b ,0xe ,0xf ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x7 ,0x2 ,0x5 ,0x81 ,0x82 ,0x6 ,0x85 ,0xf ,0xc ,0xb ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0xb ,0x5 ,0x3 ,0x4 ,0x82 ,0x8 ,0x84 ,0x85 ,0xa ,0x87 ,0x89 ,0x13 ,0x10 ,0xf ,0x8b ,0x8d ,0x11 ,0x8f ,0x91 ,0x14 ,0x16 ,0x93 ,0x95 ,0x18 ,0x98 ,0x9 ,0x5 ,0x3 ,0x4 ,0x82 ,0x6 ,0x8 ,0x85 ,0x87 ,0x11 ,0xe ,0xc ,0x89 ,0x8b ,0x10 ,0x8d ,0x8f ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0xb ,0x5 ,0x3 ,0x4 ,0x82 ,0x8 ,0x84 ,0x85 ,0xa ,0x87 ,0x89 ,0x13 ,0xd ,0xe ,0x8b ,0x8d ,0x12 ,0x8f ,0x91 ,0x17 ,0x15 ,0x93 ,0x95 ,0x19 ,0x97 ,0x99 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0x88 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x11 ,0x91 ,0x92 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xc ,0x89 ,0x8b ,0xe ,0xf ,0x8f ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0x88 ,0x89 ,0x8b ,0x8c ,0xf ,0x10 ,0x11 ,0x91 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x12 ,0x13 ,0x91 ,0x93 ,0x16 ,0x96 ,0x5 ,0x2 ,0x3 ,0x4 ,0x83 ,0xd ,0x7 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x11 ,0x10 ,0x8d ,0x8f ,0x12 ,0x92 ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0xe ,0x8e ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x91 ,0x92 ,0x93 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xc ,0x88 ,0x89 ,0xe ,0x8b ,0x8d ,0x10 ,0x90 ,0x91 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x12 ,0x92 ,0x93 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0xd ,0x8c ,0xf ,0x8f ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0xe ,0x8b ,0x8d ,0x10 ,0x90 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xc ,0x88 ,0x8a ,0xe ,0x8d ,0x10 ,0x11 ,0x91 ,0xf ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0xc ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x14 ,0x11 ,0x13 ,0x90 ,0x92 ,0x94 ,0x16 ,0x96 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x8a ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0x8c ,0x8d ,0x1 ,0x8 ,0x5 ,0x81 ,0x82 ,0x7 ,0x84 ,0x86 ,0x9 ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0xa ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xe ,0xc ,0xd ,0x8c ,0x8e ,0x8f ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0x88 ,0x89 ,0xc ,0x8c ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0x8d ,0x8e ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xa ,0xb ,0x89 ,0x8b ,0x8c ,0xf ,0x8f ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x87 ,0x1 ,0x2 ,0x5 ,0x4 ,0x81 ,0x83 ,0x7 ,0x8 ,0x86 ,0x88 ,0xb ,0x8b ,0x1 ,0x2 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0x88 ,0x8a ,0x8b ,0x1 ,0x8 ,0x5 ,0x4 ,0x81 ,0x6 ,0x83 ,0x85 ,0x87 ,0x88 ,0x89 ,0x8b ,0x80 ,0x1 ,0x6 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x8 ,0x87 ,0x89 ,0x8a ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x1 ,0x2 ,0x3 ,0x80 ,0x81 ,0x83 ,0x84 ,0x8 ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x17 ,0x18 ,0x96 ,0x98 ,0x1c ,0x9a ,0x9c ,0x1 ,0x2 ,0x3 ,0x80 ,0x81 ,0x83 ,0x84 ,0x8 ,0x86 ,0x87 ,0xb ,0x89 ,0x8b ,0x15 ,0xf ,0x10 ,0x8d ,0x8f ,0x14 ,0x91 ,0x93 ,0x16 ,0x17 ,0x95 ,0x97 ,0x1b ,0x99 ,0x9b ,0x1 ,0x2 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0xa ,0x88 ,0x8a ,0x14 ,0xe ,0xf ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x15 ,0x16 ,0x94 ,0x96 ,0x1a ,0x98 ,0x9a ,0x1 ,0x80 ,0x3 ,0x81 ,0x82 ,0x6 ,0x84 ,0x86 ,0x9 ,0xa ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x13 ,0x90 ,0x92 ,0x15 ,0x94 ,0x96 ,0xf ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0x8c ,0x8d ,0x8f ,0x11 ,0x12 ,0x91 ,0x15 ,0x93 ,0x95 ,0x1 ,0x2 ,0x80 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0x11 ,0xe ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x14 ,0x91 ,0x92 ,0x15 ,0x94 ,0x96 ,0x1 ,0x2 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0xa ,0xe ,0xd ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x12 ,0x14 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0xf ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0xb ,0x87 ,0x89 ,0xe ,0x8b ,0x8d ,0x8f ,0x90 ,0x13 ,0x91 ,0x93 ,0xf ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x8f ,0x12 ,0x90 ,0x92 ,0x15 ,0x17 ,0x95 ,0x97 ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0x88 ,0x89 ,0x8a ,0x12 ,0xe ,0x8c ,0x8d ,0x8f ,0x90 ,0x13 ,0x14 ,0x92 ,0x94 ,0x18 ,0x96 ,0x98 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x87 ,0x88 ,0xd ,0x8a ,0x8c ,0x13 ,0x10 ,0x11 ,0x8f ,0x91 ,0x14 ,0x15 ,0x93 ,0x95 ,0x97 ,0x98 ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0xb ,0x8a ,0x14 ,0xe ,0xf ,0x8c ,0x8e ,0x13 ,0x90 ,0x92 ,0x15 ,0x94 ,0x96 ,0x1 ,0x9 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0x89 ,0x8a ,0xd ,0xe ,0x8d ,0x8e ,0x12 ,0x90 ,0x92 ,0xf ,0x9 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8d ,0x10 ,0x12 ,0x8f ,0x91 ,0x92 ,0x15 ,0x94 ,0x95 ,0x18 ,0x97 ,0x99 ,0x10 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xd ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x91 ,0x93 ,0x94 ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0x89 ,0xc ,0x8c ,0xe ,0x8e ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0x10 ,0xe ,0x8d ,0x8e ,0x11 ,0x90 ,0x91 ,0x93 ,0x80 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x89 ,0x1 ,0x8 ,0x3 ,0x4 ,0x81 ,0x6 ,0x83 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0x8b ,0x13 ,0x10 ,0x8d ,0x12 ,0x8f ,0x91 ,0x93 ,0xd ,0x2 ,0x80 ,0x5 ,0x81 ,0x83 ,0x7 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x14 ,0xf ,0x10 ,0x8e ,0x13 ,0x90 ,0x92 ,0x94 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xa ,0x88 ,0x8a ,0xe ,0x8c ,0xf ,0x8e ,0x90 ,0x1 ,0x6 ,0x80 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x86 ,0x88 ,0xb ,0x8a ,0xd ,0x8b ,0x8d ,0x10 ,0x11 ,0x91 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xa ,0x89 ,0xf ,0xd ,0x8c ,0x8d ,0x8f ,0x80 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x88 ,0x89 ,0x8a ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0xa ,0x87 ,0x89 ,0x8b ,0x8c ,0xf ,0x10 ,0x90 ,0x91 ,0xe ,0x9 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0x8c ,0xf ,0x12 ,0x11 ,0x90 ,0x92 ,0x80 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0x8a ,0x8b ,0xa ,0x5 ,0x80 ,0x81 ,0x82 ,0x6 ,0x7 ,0x85 ,0x87 ,0x88 ,0xb ,0x8b ,0xd ,0x8d ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0x89 ,0xc ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x8 ,0x9 ,0x86 ,0x88 ,0x8a ,0xd ,0xe ,0x8c ,0x10 ,0x8e ,0x90 ,0x92 ,0x14 ,0x94 ,0x1 ,0x8 ,0x3 ,0x80 ,0x81 ,0x7 ,0x83 ,0x85 ,0x9 ,0x87 ,0x88 ,0x8a ,0xd ,0x8c ,0x8d ,0x10 ,0x90 ,0x1 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0x8a ,0x1 ,0x6 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x86 ,0x87 ,0xb ,0x89 ,0xc ,0xd ,0x8b ,0x8d ,0x8f ,0x1 ,0x81 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x1 ,0x2 ,0x6 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0x88 ,0x8a ,0x80 ,0x2 ,0x3 ,0x4 ,0x83 ,0x85 ,0x80 ,0x81 ,0x82 ,0x1 ,0x2 ,0x80 ,0x4 ,0x81 ,0x83 ,0x85 ,0x8 ,0x88 ,0x80 ,0x80 ,0xb ,0x5 ,0x3 ,0x81 ,0x82 ,0x6 ,0x84 ,0x85 ,0x9 ,0x87 ,0x89 ,0x13 ,0xd ,0xf ,0x8b ,0x8d ,0x11 ,0x8f ,0x91 ,0x14 ,0x15 ,0x93 ,0x95 ,0x19 ,0x97 ,0x99 ,0x9 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x87 ,0x11 ,0xe ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x12 ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x9 ,0x6 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x87 ,0x11 ,0xe ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x12 ,0x13 ,0x91 ,0x93 ,0x95 ,0x96 ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0x10 ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0x10 ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x7 ,0x85 ,0x9 ,0x88 ,0x89 ,0xc ,0x8c ,0xf ,0x8d ,0x8f ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0xb ,0x8a ,0xd ,0x8d ,0x10 ,0x8e ,0x90 ,0xd ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0xa ,0x87 ,0xc ,0x89 ,0x8b ,0x15 ,0xf ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x18 ,0x95 ,0x96 ,0x98 ,0x1 ,0x2 ,0x3 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0xc ,0xb ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x10 ,0x90 ,0x13 ,0x91 ,0x93 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x88 ,0x89 ,0xc ,0x8c ,0xf ,0x8d ,0x8f ,0xe ,0x2 ,0x3 ,0x80 ,0x81 ,0x6 ,0x84 ,0xb ,0x9 ,0x86 ,0x88 ,0xd ,0x8a ,0x8c ,0x16 ,0x10 ,0x11 ,0x8e ,0x90 ,0x15 ,0x92 ,0x94 ,0x96 ,0x18 ,0x98 ,0x1 ,0x9 ,0x6 ,0x4 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xa ,0xb ,0x88 ,0x8a ,0xf ,0x8c ,0x8e ,0x11 ,0x91 ,0x14 ,0x92 ,0x94 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x87 ,0xc ,0x2 ,0x3 ,0x4 ,0x81 ,0x6 ,0x84 ,0xa ,0x9 ,0x87 ,0xb ,0x8a ,0x13 ,0x11 ,0xf ,0x8c ,0x8e ,0x12 ,0x91 ,0x14 ,0x93 ,0x94 ,0x96 ,0x1 ,0x2 ,0x6 ,0x4 ,0x80 ,0x82 ,0x84 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0x1 ,0x8 ,0x3 ,0x80 ,0x81 ,0x7 ,0x83 ,0x85 ,0x9 ,0xa ,0x88 ,0xc ,0x8a ,0x8c ,0xf ,0x10 ,0x11 ,0x90 ,0x92 ,0x93 ,0x1 ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0x8d ,0x8e ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x4 ,0x83 ,0x85 ,0x1 ,0x9 ,0x3 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0x89 ,0x8a ,0xd ,0x8c ,0x11 ,0x8e ,0x8f ,0x12 ,0x92 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x8 ,0x7 ,0x85 ,0x87 ,0x88 ,0xb ,0xc ,0xe ,0x8b ,0x8d ,0x8f ,0x90 ,0x1 ,0x8 ,0x3 ,0x4 ,0x81 ,0x7 ,0x83 ,0x85 ,0xa ,0x87 ,0xb ,0x8a ,0x8c ,0x11 ,0xf ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x9 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0xb ,0xd ,0x8a ,0x8c ,0xf ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0x8a ,0x1 ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x8a ,0x8c ,0x1 ,0x2 ,0x6 ,0x5 ,0x82 ,0x84 ,0x86 ,0x87 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x87 ,0x80 ,0x2 ,0x3 ,0x4 ,0x84 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0xa ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x8d ,0x8e ,0x1 ,0x7 ,0x6 ,0x5 ,0x81 ,0x83 ,0x85 ,0x87 ,0x9 ,0x88 ,0x8a ,0x1 ,0x2 ,0x3 ,0x5 ,0x80 ,0x82 ,0x8 ,0x84 ,0x86 ,0x88 ,0xb ,0x8a ,0xd ,0x8b ,0x8d ,0x8f ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x85 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0x8c ,0x8d ,0x6 ,0x80 ,0x5 ,0x4 ,0x82 ,0x84 ,0x86 ,0x8 ,0x9 ,0x88 ,0x8a ,0x8b ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x80 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x18 ,0x12 ,0x13 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x1c ,0x1b ,0x99 ,0x9b ,0x1d ,0x9d ,0x9f ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x11 ,0x12 ,0x13 ,0x92 ,0x93 ,0x95 ,0x17 ,0x18 ,0x99 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0xa ,0x89 ,0xd ,0x8b ,0x8d ,0x15 ,0x10 ,0x11 ,0x8f ,0x91 ,0x92 ,0x94 ,0x19 ,0x18 ,0x96 ,0x98 ,0x1a ,0x9a ,0x9c ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xc ,0xb ,0x8a ,0xe ,0x8c ,0x8e ,0x17 ,0x11 ,0x12 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1b ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x6 ,0x80 ,0x5 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0xb ,0x8a ,0x8c ,0xe ,0xf ,0x10 ,0x8e ,0x90 ,0x91 ,0x93 ,0x15 ,0x95 ,0x97 ,0x1 ,0x7 ,0x3 ,0x4 ,0x82 ,0x6 ,0x85 ,0x9 ,0x87 ,0xb ,0x89 ,0x8b ,0x13 ,0xe ,0xf ,0x8d ,0x8f ,0x90 ,0x92 ,0x16 ,0x15 ,0x95 ,0x18 ,0x97 ,0x99 ,0x1 ,0x6 ,0x80 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0xa ,0x88 ,0x8a ,0xc ,0xd ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x15 ,0x95 ,0x97 ,0x1 ,0x7 ,0x5 ,0x80 ,0x82 ,0x6 ,0x85 ,0x9 ,0x87 ,0x88 ,0x8a ,0x12 ,0xd ,0xe ,0x8c ,0x8e ,0x8f ,0x91 ,0x15 ,0x14 ,0x94 ,0x16 ,0x97 ,0x1 ,0x6 ,0x80 ,0x5 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0xa ,0x8a ,0x12 ,0xd ,0xf ,0x8c ,0x8e ,0x11 ,0x91 ,0x15 ,0x14 ,0x94 ,0x17 ,0x96 ,0x98 ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x8 ,0x84 ,0x86 ,0x87 ,0x89 ,0x11 ,0xc ,0xd ,0x8b ,0x8d ,0x8e ,0x90 ,0x12 ,0x13 ,0x94 ,0x1 ,0x2 ,0x3 ,0x4 ,0x83 ,0x85 ,0xc ,0x8 ,0xa ,0x87 ,0x89 ,0x8b ,0xd ,0xe ,0x8d ,0x8f ,0x11 ,0x92 ,0x1 ,0x5 ,0x3 ,0x81 ,0x83 ,0x6 ,0x8 ,0x86 ,0x88 ,0xf ,0xd ,0xc ,0x8b ,0xe ,0x8e ,0x10 ,0x11 ,0x90 ,0x92 ,0x14 ,0x95 ,0x1 ,0x3 ,0x81 ,0x4 ,0x83 ,0x85 ,0xd ,0x8 ,0xa ,0x87 ,0x89 ,0xc ,0x8c ,0x10 ,0xf ,0x8f ,0x11 ,0x91 ,0x93 ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x6 ,0x85 ,0x8 ,0x88 ,0xf ,0xd ,0xc ,0x8b ,0xe ,0x8e ,0x10 ,0x8f ,0x91 ,0x13 ,0x93 ,0x95 ,0x1 ,0x5 ,0x3 ,0x81 ,0x83 ,0x6 ,0x7 ,0x87 ,0xf ,0xa ,0xb ,0x89 ,0x8b ,0xe ,0x8e ,0x10 ,0x91 ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x84 ,0x86 ,0x8 ,0x9 ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x10 ,0x11 ,0x92 ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x85 ,0x7 ,0xb ,0xa ,0x87 ,0x89 ,0xc ,0x8c ,0xe ,0xf ,0x90 ,0x1 ,0x81 ,0xa ,0x7 ,0x6 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0xb ,0xc ,0x8c ,0x8e ,0x1 ,0x81 ,0x3 ,0x7 ,0x6 ,0x83 ,0x85 ,0x87 ,0x9 ,0x89 ,0x8b ,0x4 ,0x2 ,0x81 ,0x83 ,0x5 ,0x6 ,0x7 ,0x86 ,0x88 ,0xa ,0xc ,0x8a ,0x8c ,0x8e ,0x1 ,0x81 ,0x9 ,0x7 ,0x5 ,0x83 ,0x85 ,0x86 ,0x88 ,0x8a ,0x3 ,0x2 ,0x82 ,0x4 ,0x5 ,0x83 ,0x85 ,0x87 ,0x89 ,0x2 ,0x81 ,0x7 ,0x4 ,0x6 ,0x84 ,0x86 ,0x8 ,0x9 ,0x8a ,0x2 ,0x81 ,0x82 ,0x4 ,0x6 ,0x84 ,0x86 ,0x88 ,0x80 ,0x7 ,0x6 ,0x4 ,0x82 ,0x84 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x8a ,0x5 ,0x2 ,0x81 ,0x82 ,0x84 ,0x86 ,0x2 ,0x81 ,0x3 ,0x4 ,0x5 ,0x83 ,0x85 ,0x87 ,0x89 ,0x3 ,0x2 ,0x82 ,0x4 ,0x85 ,0x80 ,0x81 ,0x3 ,0x82 ,0x84 ,0x6 ,0x87 ,0x1 ,0x81 ,0x83 ,0x81 ,0x80 ,0x2 ,0x4 ,0x83 ,0x5 ,0x86 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x1 ,0x2 ,0x3 ,0x81 ,0x83 ,0x6 ,0x7 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x14 ,0x11 ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x15 ,0x17 ,0x95 ,0x97 ,0x98 ,0x9a ,0x1 ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0x7 ,0x9 ,0x86 ,0x88 ,0xb ,0x8a ,0x8c ,0x15 ,0x12 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x95 ,0x96 ,0x98 ,0x1 ,0x2 ,0x5 ,0x80 ,0x82 ,0x83 ,0x85 ,0x8 ,0xa ,0x87 ,0x89 ,0xc ,0x8b ,0x8d ,0x15 ,0x13 ,0x12 ,0x8f ,0x91 ,0x92 ,0x94 ,0x18 ,0x95 ,0x97 ,0x99 ,0x1 ,0x2 ,0x5 ,0x80 ,0x82 ,0x83 ,0x85 ,0x8 ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x16 ,0x13 ,0x12 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x19 ,0x96 ,0x98 ,0x9a ,0x1 ,0x2 ,0x5 ,0x80 ,0x82 ,0x83 ,0x85 ,0x8 ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x14 ,0x12 ,0x8e ,0x90 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x1 ,0x2 ,0x3 ,0x81 ,0x83 ,0x9 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0x13 ,0x10 ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x95 ,0x1 ,0x2 ,0x3 ,0x81 ,0x83 ,0x6 ,0x7 ,0x86 ,0xa ,0x88 ,0x8a ,0x13 ,0x10 ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x94 ,0x16 ,0x97 ,0x1 ,0x80 ,0x5 ,0x81 ,0x83 ,0x6 ,0x85 ,0x87 ,0xf ,0xd ,0xc ,0x89 ,0x8b ,0x8c ,0x8e ,0x8f ,0x91 ,0x1 ,0x80 ,0x3 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x10 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x11 ,0x92 ,0x1 ,0x80 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x10 ,0xd ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x91 ,0x1 ,0x2 ,0x3 ,0x82 ,0x84 ,0x6 ,0x7 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x10 ,0xe ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x1 ,0x2 ,0x81 ,0x83 ,0xc ,0x9 ,0x8 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0xf ,0x8c ,0x8e ,0x10 ,0x91 ,0x1 ,0x2 ,0x81 ,0x83 ,0xc ,0x6 ,0x8 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0xe ,0x8d ,0xf ,0x90 ,0x1 ,0x81 ,0x3 ,0x4 ,0x6 ,0x83 ,0x85 ,0x86 ,0x88 ,0xd ,0xc ,0x8a ,0x8c ,0xe ,0x8f ,0x1 ,0x81 ,0x9 ,0x4 ,0x5 ,0x83 ,0x85 ,0x86 ,0x88 ,0xc ,0xb ,0x8b ,0x8c ,0x8e ,0x1 ,0x80 ,0x81 ,0x82 ,0x84 ,0xd ,0x7 ,0x8 ,0x86 ,0x88 ,0xb ,0x8a ,0x8c ,0x10 ,0xf ,0x8f ,0x91 ,0x1 ,0x81 ,0x3 ,0x7 ,0x5 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0xd ,0x8a ,0x8c ,0xe ,0x8f ,0x1 ,0x81 ,0x3 ,0x4 ,0x6 ,0x83 ,0x85 ,0x9 ,0x87 ,0x89 ,0x8a ,0xd ,0x8c ,0x8e ,0x80 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0x1 ,0x81 ,0x9 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0x8a ,0x8c ,0x1 ,0x81 ,0x3 ,0x4 ,0x5 ,0x84 ,0x85 ,0x87 ,0x88 ,0xa ,0x8a ,0x8c ,0x80 ,0x7 ,0x6 ,0x4 ,0x82 ,0x84 ,0x86 ,0x8 ,0x88 ,0xa ,0x8b ,0x1 ,0x2 ,0x82 ,0xa ,0x5 ,0x6 ,0x84 ,0x86 ,0x9 ,0x89 ,0xb ,0xc ,0x8d ,0x80 ,0x6 ,0x3 ,0x4 ,0x83 ,0x85 ,0x87 ,0x1 ,0x2 ,0x3 ,0x82 ,0x84 ,0xa ,0x85 ,0x8 ,0x87 ,0x89 ,0xb ,0xc ,0x8d ,0xd ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0x87 ,0x89 ,0xc ,0x8c ,0x8e ,0x80 ,0x8 ,0x3 ,0x5 ,0x82 ,0x84 ,0x85 ,0x87 ,0x88 ,0x89 ,0x8b ,0x80 ,0x7 ,0x3 ,0x81 ,0x83 ,0x6 ,0x86 ,0x8 ,0x9 ,0x89 ,0x8b ,0x80 ,0x2 ,0x6 ,0x5 ,0x83 ,0x85 ,0x86 ,0x88 ,0x80 ,0x6 ,0x81 ,0x5 ,0x83 ,0x85 ,0x86 ,0x88 ,0x81 ,0x80 ,0x2 ,0x82 ,0x83 ,0x85 ,0x1 ,0x2 ,0x82 ,0x84 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x10 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x17 ,0x15 ,0x13 ,0x91 ,0x93 ,0x94 ,0x96 ,0x1b ,0x19 ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x10 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x17 ,0x15 ,0x13 ,0x91 ,0x93 ,0x94 ,0x96 ,0x18 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xb ,0x88 ,0x8a ,0x8b ,0x8d ,0x16 ,0x13 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x17 ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0x8d ,0x15 ,0x13 ,0x11 ,0x8f ,0x91 ,0x92 ,0x94 ,0x16 ,0x18 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0x1 ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x17 ,0x14 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1b ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x2 ,0x5 ,0x4 ,0x82 ,0x6 ,0x85 ,0xb ,0x9 ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x16 ,0x13 ,0x11 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x17 ,0x18 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0x15 ,0x12 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x19 ,0x18 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0x88 ,0x8a ,0xd ,0x8d ,0x16 ,0x13 ,0x11 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x17 ,0x18 ,0x97 ,0x99 ,0x1b ,0x9b ,0x9d ,0xf ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xc ,0xb ,0x8a ,0xe ,0x8c ,0x8e ,0x10 ,0x11 ,0x12 ,0x90 ,0x92 ,0x15 ,0x95 ,0x1a ,0x19 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0xf ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0x8c ,0x8e ,0x15 ,0x14 ,0x12 ,0x90 ,0x92 ,0x94 ,0x19 ,0x18 ,0x96 ,0x98 ,0x1a ,0x9a ,0x9c ,0xd ,0x2 ,0x3 ,0x4 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0x8c ,0xe ,0x12 ,0x11 ,0x8e ,0x90 ,0x13 ,0x92 ,0x94 ,0x95 ,0x17 ,0x98 ,0xd ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0xa ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0xf ,0x10 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x19 ,0x17 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0xf ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xe ,0x8e ,0x15 ,0x13 ,0x8f ,0x91 ,0x92 ,0x94 ,0x19 ,0x17 ,0x96 ,0x98 ,0x99 ,0x9b ,0xf ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0x8c ,0x8e ,0x10 ,0x11 ,0x90 ,0x14 ,0x92 ,0x94 ,0x95 ,0x97 ,0xd ,0x2 ,0x5 ,0x80 ,0x82 ,0x84 ,0xa ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0x12 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x18 ,0x17 ,0x97 ,0x98 ,0x9a ,0x10 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x91 ,0x92 ,0x94 ,0xb ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x88 ,0x8a ,0x11 ,0xf ,0x8b ,0x8d ,0x10 ,0x90 ,0x12 ,0x13 ,0x93 ,0x95 ,0xc ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0xb ,0x89 ,0x8b ,0xd ,0x10 ,0xf ,0x8e ,0x12 ,0x90 ,0x92 ,0x14 ,0x16 ,0x94 ,0x96 ,0x98 ,0xb ,0x2 ,0x5 ,0x80 ,0x82 ,0x84 ,0x7 ,0x8 ,0x86 ,0x88 ,0x8a ,0xc ,0x8b ,0xf ,0x8d ,0x8f ,0x90 ,0x91 ,0x93 ,0xf ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0xc ,0xa ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x10 ,0x90 ,0x12 ,0x93 ,0x9 ,0x2 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0xb ,0xc ,0x8a ,0x8c ,0x8e ,0x90 ,0xe ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xd ,0x8d ,0x11 ,0x8e ,0x90 ,0x13 ,0x92 ,0x94 ,0x9 ,0x2 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x88 ,0xc ,0xb ,0x8b ,0xd ,0x8e ,0xa ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x87 ,0x89 ,0xb ,0x8b ,0xd ,0x8e ,0x1 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xb ,0x89 ,0x8a ,0x8c ,0xe ,0x10 ,0x8f ,0x91 ,0x1 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x89 ,0xc ,0x8b ,0xe ,0x8d ,0x8f ,0x80 ,0x81 ,0x3 ,0x4 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0x80 ,0x81 ,0x5 ,0x4 ,0x84 ,0x7 ,0x86 ,0x88 ,0x7 ,0x2 ,0x6 ,0x4 ,0x82 ,0x84 ,0x86 ,0x8 ,0x9 ,0x89 ,0x8b ,0x1 ,0x4 ,0x80 ,0x82 ,0x5 ,0x7 ,0x84 ,0x86 ,0x87 ,0x89 ,0x8a ,0x8b ,0x8d ,0x9 ,0x80 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0x8a ,0xc ,0x8c ,0x8e ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x1 ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x15 ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1d ,0x9d ,0x9f ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0x10 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1d ,0x9d ,0x9f ,0x1 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0x1 ,0x8 ,0x3 ,0x4 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x10 ,0x11 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x18 ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x10 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1d ,0x9e ,0x10 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x15 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x17 ,0x96 ,0x98 ,0x10 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x14 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x19 ,0x1b ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0xe ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0xc ,0xa ,0x88 ,0x8a ,0x8b ,0x8d ,0xf ,0x13 ,0x12 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x19 ,0x18 ,0x98 ,0x99 ,0x9b ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0x8d ,0x8e ,0x10 ,0x12 ,0x90 ,0x92 ,0x14 ,0x95 ,0xf ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xe ,0x8e ,0x13 ,0x8f ,0x12 ,0x92 ,0x16 ,0x93 ,0x95 ,0x18 ,0x97 ,0x99 ,0x1 ,0x6 ,0x3 ,0x81 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0x14 ,0xf ,0x10 ,0x8e ,0x90 ,0x91 ,0x93 ,0x15 ,0x17 ,0x95 ,0x97 ,0x19 ,0x9a ,0xb ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0x88 ,0x8a ,0xc ,0x10 ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x15 ,0x95 ,0x97 ,0x1 ,0x2 ,0x5 ,0x4 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0xa ,0x89 ,0x8b ,0xd ,0x11 ,0x10 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x17 ,0x16 ,0x96 ,0x18 ,0x98 ,0x9a ,0xe ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0x8d ,0xf ,0x8e ,0x12 ,0x90 ,0x92 ,0x94 ,0x80 ,0x8 ,0x3 ,0x5 ,0x82 ,0x84 ,0x85 ,0x87 ,0x9 ,0xa ,0x89 ,0x8b ,0x8c ,0x8e ,0xf ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xc ,0xb ,0x8a ,0xd ,0x8c ,0x8e ,0x8f ,0x90 ,0x12 ,0x92 ,0x94 ,0xe ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0x8d ,0x12 ,0x8e ,0x8f ,0x91 ,0x13 ,0x14 ,0x95 ,0xd ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0x8c ,0x10 ,0xf ,0x8f ,0x90 ,0x13 ,0x92 ,0x94 ,0x80 ,0x8 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0xc ,0xb ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0xb ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0x88 ,0x8a ,0x8c ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x85 ,0x8 ,0x88 ,0x10 ,0xb ,0xd ,0x8a ,0x8c ,0x8d ,0x8f ,0x90 ,0x13 ,0x92 ,0x94 ,0xc ,0x2 ,0x4 ,0x81 ,0x82 ,0x84 ,0xa ,0x9 ,0x86 ,0x88 ,0xb ,0x8b ,0xd ,0x11 ,0x10 ,0x8d ,0x8f ,0x91 ,0x92 ,0x94 ,0xf ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x8f ,0x90 ,0x92 ,0x1 ,0x81 ,0x6 ,0x5 ,0x83 ,0x85 ,0x7 ,0x88 ,0x80 ,0x9 ,0x3 ,0x4 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0x8a ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x6 ,0x7 ,0x87 ,0x9 ,0xd ,0xc ,0x89 ,0x8b ,0x8d ,0x8e ,0x90 ,0xd ,0x8 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0xa ,0x89 ,0x8a ,0x8c ,0x8d ,0x8e ,0x8f ,0x91 ,0x80 ,0x6 ,0x81 ,0x5 ,0x83 ,0x85 ,0x7 ,0x8 ,0x88 ,0xa ,0x8b ,0x1 ,0x2 ,0x80 ,0x81 ,0x83 ,0x6 ,0x86 ,0x87 ,0x89 ,0x1 ,0x81 ,0x82 ,0x4 ,0x84 ,0x86 ,0x80 ,0x6 ,0x81 ,0x5 ,0x83 ,0x85 ,0x87 ,0xb ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0x88 ,0x8a ,0x8c ,0x1 ,0x81 ,0x3 ,0x4 ,0x85 ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x85 ,0x87 ,0xb ,0x88 ,0x8a ,0x8c ,0x81 ,0x81 ,0x81 ,0x81 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x12 ,0x13 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x1c ,0x1b ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x17 ,0x15 ,0x13 ,0x91 ,0x93 ,0x94 ,0x96 ,0x1b ,0x1a ,0x98 ,0x9a ,0x1d ,0x9c ,0x9e ,0x1 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x15 ,0x13 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x1b ,0x1a ,0x9a ,0x1c ,0x9c ,0x9e ,0x1 ,0x2 ,0x3 ,0x80 ,0x82 ,0x6 ,0x84 ,0x86 ,0x9 ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0xf ,0x13 ,0x12 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x17 ,0x96 ,0x98 ,0x1b ,0x9a ,0x9c ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x9 ,0x86 ,0x88 ,0xb ,0x8b ,0x12 ,0x11 ,0xf ,0x8d ,0x8f ,0x91 ,0x15 ,0x14 ,0x94 ,0x16 ,0x96 ,0x98 ,0x1 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0xa ,0x89 ,0x8b ,0xd ,0x11 ,0x10 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x15 ,0x95 ,0x97 ,0x1 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x7 ,0x9 ,0x87 ,0x89 ,0xb ,0xf ,0xd ,0x8b ,0x8d ,0x10 ,0x8f ,0x91 ,0x13 ,0x93 ,0x95 ,0x1 ,0x2 ,0x80 ,0x4 ,0x83 ,0x9 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0x13 ,0x10 ,0xf ,0x8e ,0x11 ,0x90 ,0x92 ,0x17 ,0x16 ,0x94 ,0x96 ,0x97 ,0x99 ,0xc ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0xd ,0x10 ,0xf ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x16 ,0x95 ,0x97 ,0x1 ,0x2 ,0x5 ,0x80 ,0x82 ,0x83 ,0x85 ,0x8 ,0xa ,0x88 ,0x8a ,0xc ,0xd ,0xf ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x94 ,0x96 ,0x1 ,0x2 ,0x80 ,0x4 ,0x83 ,0x6 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0xc ,0x10 ,0xe ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x16 ,0x15 ,0x95 ,0x96 ,0x98 ,0xd ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0xb ,0xa ,0x89 ,0xc ,0x8c ,0x8d ,0xf ,0x8f ,0x12 ,0x91 ,0x93 ,0xd ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xb ,0x89 ,0xc ,0x8c ,0xe ,0xf ,0x8e ,0x90 ,0x14 ,0x13 ,0x93 ,0x95 ,0xd ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0xb ,0xa ,0x89 ,0x8a ,0x8c ,0xe ,0x8d ,0x10 ,0x90 ,0x14 ,0x13 ,0x93 ,0x95 ,0xc ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xb ,0x89 ,0x8b ,0xd ,0x8c ,0xf ,0x8f ,0x11 ,0x12 ,0x92 ,0x93 ,0x95 ,0x9 ,0x2 ,0x80 ,0x4 ,0x83 ,0x6 ,0x8 ,0x86 ,0x88 ,0xe ,0xb ,0xc ,0x8b ,0x8d ,0x8e ,0x8f ,0x91 ,0xb ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x88 ,0x8a ,0x8b ,0xd ,0x8e ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x8b ,0x8c ,0x8e ,0x1 ,0x2 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x87 ,0x88 ,0x8a ,0xc ,0xd ,0xf ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x1 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x7 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0xd ,0xe ,0x8e ,0x90 ,0xc ,0x2 ,0x3 ,0x80 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0xb ,0x89 ,0x8b ,0xd ,0xe ,0xf ,0x8d ,0x8f ,0x90 ,0x92 ,0x14 ,0x94 ,0x96 ,0xa ,0x2 ,0x80 ,0x82 ,0x5 ,0x7 ,0x84 ,0x86 ,0x87 ,0x89 ,0xb ,0xf ,0xd ,0x8b ,0x8d ,0x8e ,0x90 ,0x15 ,0x13 ,0x92 ,0x94 ,0x96 ,0x9 ,0x5 ,0x3 ,0x4 ,0x83 ,0x6 ,0x85 ,0x86 ,0x88 ,0x10 ,0xb ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x91 ,0xf ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x8f ,0x91 ,0x7 ,0x80 ,0x5 ,0x4 ,0x83 ,0x6 ,0x86 ,0x8 ,0xc ,0xb ,0x88 ,0x8a ,0x8c ,0xe ,0x8f ,0xa ,0x6 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x87 ,0x89 ,0xc ,0x8b ,0xd ,0x8d ,0x8f ,0x1 ,0x2 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x89 ,0xb ,0x8b ,0x8d ,0x9 ,0x6 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x8 ,0x88 ,0xa ,0xb ,0x8b ,0x8d ,0x2 ,0x81 ,0xa ,0x4 ,0x5 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0x8a ,0x8c ,0x2 ,0x81 ,0x82 ,0x7 ,0x6 ,0x84 ,0x86 ,0x87 ,0x89 ,0x1 ,0x5 ,0x81 ,0x4 ,0x84 ,0x6 ,0x8 ,0x86 ,0x88 ,0xa ,0x8b ,0x1 ,0x7 ,0x3 ,0x5 ,0x81 ,0x83 ,0x85 ,0x8 ,0x9 ,0x87 ,0x89 ,0x8b ,0x8c ,0x8e ,0x80 ,0x9 ,0x3 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0xb ,0x8a ,0x8c ,0x8d ,0x8f ,0x9 ,0x6 ,0x5 ,0x4 ,0x82 ,0x84 ,0x85 ,0x86 ,0x88 ,0x8a ,0x1 ,0x81 ,0x83 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x10 ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x13 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x1c ,0x1b ,0x99 ,0x9b ,0x1d ,0x9d ,0x9f ,0x10 ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x14 ,0x91 ,0x93 ,0x17 ,0x95 ,0x97 ,0x1c ,0x1a ,0x99 ,0x9b ,0x1d ,0x9d ,0x9f ,0xf ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x10 ,0x11 ,0x13 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x1b ,0x19 ,0x98 ,0x9a ,0x1c ,0x9c ,0x9e ,0xe ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xa ,0x89 ,0xd ,0x8b ,0x8d ,0xf ,0x10 ,0x11 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x1a ,0x19 ,0x97 ,0x99 ,0x1b ,0x9b ,0x9d ,0xf ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x10 ,0x11 ,0x12 ,0x90 ,0x92 ,0x15 ,0x95 ,0x1a ,0x19 ,0x97 ,0x99 ,0x9a ,0x9c ,0x10 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x18 ,0x12 ,0x14 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x1c ,0x1a ,0x99 ,0x9b ,0x1e ,0x9d ,0x9f ,0xc ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0x89 ,0x8b ,0x14 ,0xe ,0x10 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x18 ,0x16 ,0x95 ,0x97 ,0x1a ,0x99 ,0x9b ,0xc ,0x2 ,0x3 ,0x80 ,0x82 ,0x6 ,0x85 ,0xa ,0x9 ,0x88 ,0x89 ,0x8b ,0x14 ,0xe ,0x10 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x18 ,0x16 ,0x95 ,0x97 ,0x1a ,0x99 ,0x9b ,0x10 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x17 ,0x12 ,0x13 ,0x91 ,0x93 ,0x94 ,0x96 ,0x18 ,0x1a ,0x98 ,0x9a ,0x9c ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x12 ,0x90 ,0x92 ,0x16 ,0x94 ,0x96 ,0x18 ,0x99 ,0x10 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x18 ,0x15 ,0x14 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x19 ,0x1b ,0x9a ,0x9c ,0x1 ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x11 ,0x90 ,0x13 ,0x92 ,0x94 ,0x18 ,0x95 ,0x97 ,0x98 ,0x9a ,0xd ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0xe ,0x11 ,0x10 ,0x8f ,0x90 ,0x92 ,0x14 ,0x15 ,0x95 ,0x97 ,0x1 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0xb ,0x8a ,0x8c ,0x15 ,0xf ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x18 ,0x17 ,0x97 ,0x99 ,0xd ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0xe ,0x11 ,0x8d ,0x8f ,0x90 ,0x92 ,0x14 ,0x93 ,0x95 ,0x96 ,0x98 ,0x1 ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x11 ,0x90 ,0x91 ,0x93 ,0x94 ,0x16 ,0x96 ,0x98 ,0x1 ,0x2 ,0x4 ,0x81 ,0x83 ,0x9 ,0x7 ,0x85 ,0x87 ,0xb ,0x89 ,0x8b ,0x13 ,0xe ,0xf ,0x8d ,0x8f ,0x12 ,0x92 ,0x14 ,0x94 ,0x16 ,0x96 ,0x98 ,0xd ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0x10 ,0xf ,0x8f ,0x90 ,0x92 ,0x1 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0xa ,0x8 ,0x86 ,0x88 ,0x89 ,0x8b ,0x13 ,0x11 ,0x10 ,0x8d ,0x8f ,0x12 ,0x92 ,0x17 ,0x15 ,0x94 ,0x96 ,0x98 ,0xb ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0x7 ,0x9 ,0x86 ,0x88 ,0x8a ,0xc ,0xd ,0xe ,0x8d ,0x8e ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x16 ,0x97 ,0xa ,0x8 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x87 ,0x89 ,0xb ,0xe ,0xd ,0x8c ,0x8e ,0x10 ,0x11 ,0x91 ,0x92 ,0x94 ,0xc ,0x7 ,0x6 ,0x4 ,0x81 ,0x83 ,0x85 ,0xa ,0x86 ,0x88 ,0xb ,0x8b ,0xd ,0xe ,0xf ,0x90 ,0xc ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0x87 ,0x89 ,0x8b ,0x8d ,0xd ,0x2 ,0x3 ,0x81 ,0x6 ,0x83 ,0x85 ,0xb ,0x9 ,0x87 ,0x89 ,0xc ,0x8c ,0xe ,0x8d ,0x8f ,0x91 ,0xe ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xa ,0x89 ,0xc ,0x8b ,0x8d ,0xf ,0x90 ,0xb ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x87 ,0xa ,0x8a ,0x8b ,0xd ,0x8e ,0x9 ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0x88 ,0x8a ,0xe ,0x2 ,0x3 ,0x4 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0xa ,0x88 ,0x8a ,0xd ,0x8d ,0xf ,0x10 ,0x12 ,0x91 ,0x93 ,0x80 ,0x6 ,0x81 ,0x5 ,0x83 ,0x85 ,0x87 ,0xa ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0x89 ,0x8b ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x1 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0x8d ,0x16 ,0x13 ,0x12 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x1a ,0x18 ,0x97 ,0x99 ,0x1c ,0x9b ,0x9d ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0x8c ,0x8e ,0x10 ,0x13 ,0x12 ,0x91 ,0x15 ,0x93 ,0x95 ,0x1a ,0x19 ,0x97 ,0x99 ,0x1b ,0x9c ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x10 ,0x14 ,0x12 ,0x90 ,0x92 ,0x15 ,0x94 ,0x96 ,0x18 ,0x19 ,0x99 ,0x9b ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0x8b ,0x8d ,0xf ,0x10 ,0x11 ,0x90 ,0x92 ,0x14 ,0x93 ,0x95 ,0x18 ,0x97 ,0x99 ,0x1 ,0x5 ,0x3 ,0x81 ,0x83 ,0x8 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0xc ,0xd ,0xf ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x17 ,0x16 ,0x94 ,0x96 ,0x18 ,0x99 ,0x1 ,0x5 ,0x3 ,0x4 ,0x83 ,0x6 ,0x84 ,0x86 ,0xa ,0x88 ,0x8a ,0xc ,0x10 ,0xe ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x93 ,0x15 ,0x95 ,0x97 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xd ,0x8d ,0x13 ,0x10 ,0x11 ,0x90 ,0x92 ,0x17 ,0x15 ,0x94 ,0x96 ,0x18 ,0x98 ,0x9a ,0x1 ,0x3 ,0x81 ,0x4 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xa ,0xe ,0xc ,0x8a ,0x8c ,0xf ,0x8f ,0x13 ,0x90 ,0x92 ,0x14 ,0x95 ,0x1 ,0x7 ,0x5 ,0x4 ,0x82 ,0x83 ,0x85 ,0x86 ,0x9 ,0x89 ,0xf ,0xc ,0xd ,0x8c ,0x8e ,0x13 ,0x11 ,0x90 ,0x92 ,0x94 ,0x1 ,0x4 ,0x3 ,0x82 ,0x5 ,0x6 ,0x85 ,0x8 ,0x87 ,0x89 ,0x8a ,0x8b ,0xd ,0x8d ,0x8f ,0x1 ,0x7 ,0x5 ,0x4 ,0x82 ,0x83 ,0x85 ,0x8 ,0x87 ,0xa ,0x8a ,0xc ,0x10 ,0xe ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x94 ,0x96 ,0x9 ,0x2 ,0x3 ,0x81 ,0x83 ,0x7 ,0x85 ,0x8 ,0x88 ,0xa ,0xb ,0xd ,0x8a ,0x8c ,0x8d ,0x8f ,0x11 ,0x12 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x7 ,0x2 ,0x3 ,0x81 ,0x83 ,0x6 ,0x86 ,0xf ,0x9 ,0xa ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x90 ,0x5 ,0x2 ,0x81 ,0x4 ,0x84 ,0x6 ,0x7 ,0x8 ,0x87 ,0xb ,0x89 ,0x8b ,0xd ,0xf ,0x8d ,0x8f ,0x11 ,0x91 ,0x93 ,0xd ,0x2 ,0x4 ,0x81 ,0x5 ,0x83 ,0x85 ,0x8 ,0x9 ,0x87 ,0x89 ,0xc ,0x8c ,0xe ,0x8f ,0x1 ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0x88 ,0x8a ,0xc ,0x8c ,0x8e ,0x7 ,0x2 ,0x4 ,0x81 ,0x82 ,0x84 ,0x86 ,0x8 ,0x9 ,0xa ,0x88 ,0x8a ,0x8b ,0x8d ,0x11 ,0x8e ,0x90 ,0x12 ,0x93 ,0x1 ,0x80 ,0x6 ,0x4 ,0x82 ,0x84 ,0x85 ,0x87 ,0x9 ,0x8a ,0x8 ,0x80 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0x9 ,0x8a ,0xd ,0x2 ,0x3 ,0x80 ,0x82 ,0x6 ,0x84 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0x8c ,0xe ,0x8f ,0xa ,0x2 ,0x5 ,0x80 ,0x82 ,0x6 ,0x85 ,0x86 ,0x87 ,0x89 ,0x10 ,0xf ,0xe ,0x8b ,0x8d ,0x8f ,0x91 ,0x1 ,0x80 ,0x6 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0x8a ,0x80 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x88 ,0x1 ,0x2 ,0x3 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0x87 ,0x88 ,0x8a ,0x8c ,0x80 ,0x6 ,0x81 ,0x5 ,0x83 ,0x85 ,0x7 ,0x8 ,0x89 ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0xb ,0xa ,0x8a ,0xc ,0x8d ,0x8 ,0x2 ,0x80 ,0x4 ,0x83 ,0x84 ,0x7 ,0x87 ,0xf ,0xd ,0xb ,0x89 ,0x8b ,0xe ,0x8e ,0x90 ,0x1 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0x89 ,0x4 ,0x3 ,0x81 ,0x83 ,0x5 ,0x86 ,0x80 ,0x8 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0x89 ,0x8 ,0x2 ,0x3 ,0x82 ,0x7 ,0x6 ,0x85 ,0x87 ,0x89 ,0x4 ,0x80 ,0x81 ,0x83 ,0x5 ,0x85 ,0x87 ,0x80 ,0x2 ,0x82 ,0x84 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x1 ,0x80 ,0x3 ,0x4 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xa ,0xb ,0xc ,0x8a ,0x8c ,0xf ,0x8e ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x16 ,0x96 ,0x98 ,0x1 ,0x80 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0x89 ,0x8a ,0x8c ,0x11 ,0x10 ,0x8e ,0x90 ,0x13 ,0x92 ,0x94 ,0x1 ,0x80 ,0x3 ,0x4 ,0x83 ,0x84 ,0x86 ,0x8 ,0x9 ,0xa ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x13 ,0x11 ,0x90 ,0x92 ,0x14 ,0x94 ,0x96 ,0x1 ,0x2 ,0x80 ,0x81 ,0x83 ,0x6 ,0x7 ,0x86 ,0x9 ,0x88 ,0x8a ,0xc ,0xd ,0xe ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x17 ,0x15 ,0x94 ,0x96 ,0x97 ,0x99 ,0x1 ,0x2 ,0x80 ,0x81 ,0x83 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0xb ,0xd ,0x8a ,0x8c ,0xf ,0x8e ,0x90 ,0x15 ,0x13 ,0x92 ,0x94 ,0x16 ,0x96 ,0x98 ,0x1 ,0x2 ,0x80 ,0x81 ,0x83 ,0x6 ,0x7 ,0x86 ,0x9 ,0x88 ,0x8a ,0xc ,0x10 ,0xf ,0x8c ,0x8e ,0x11 ,0x90 ,0x92 ,0x14 ,0x16 ,0x94 ,0x96 ,0x18 ,0x98 ,0x9a ,0xf ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x8a ,0xe ,0x8c ,0x8e ,0x8f ,0x90 ,0x12 ,0x93 ,0xd ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0x8d ,0x8e ,0x90 ,0xe ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x8a ,0xd ,0x8d ,0x8e ,0x8f ,0x90 ,0x92 ,0x10 ,0x9 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x95 ,0x97 ,0x1 ,0x80 ,0x81 ,0x82 ,0x84 ,0x6 ,0xa ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0xf ,0x8e ,0x90 ,0x91 ,0x93 ,0x80 ,0x9 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xd ,0xc ,0x8a ,0x8c ,0x8d ,0x8f ,0x10 ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x90 ,0x12 ,0x13 ,0x94 ,0xf ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x8a ,0xd ,0x8c ,0x8e ,0x8f ,0x11 ,0x92 ,0x10 ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x90 ,0x91 ,0x13 ,0x94 ,0xe ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0x8b ,0x8d ,0x8e ,0x90 ,0xf ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x8f ,0x91 ,0xf ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xd ,0xb ,0x89 ,0x8b ,0x8c ,0x8e ,0x8f ,0x90 ,0x92 ,0x1 ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x9 ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x10 ,0x8f ,0x12 ,0x91 ,0x93 ,0x15 ,0x95 ,0x97 ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x85 ,0x87 ,0x88 ,0x89 ,0x8b ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0xc ,0xb ,0x89 ,0x8b ,0xd ,0x8e ,0x80 ,0x2 ,0x3 ,0x4 ,0x83 ,0x6 ,0x85 ,0x87 ,0xc ,0xa ,0x89 ,0x8b ,0xd ,0x8d ,0x8f ,0x1 ,0x7 ,0x6 ,0x5 ,0x81 ,0x83 ,0x85 ,0x9 ,0x87 ,0x89 ,0xb ,0x8a ,0x8b ,0x8d ,0xf ,0x90 ,0x80 ,0x8 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0xb ,0x88 ,0x8a ,0x8c ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x85 ,0x87 ,0x9 ,0xa ,0x8a ,0x8b ,0x8d ,0x80 ,0x2 ,0x6 ,0x4 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xd ,0xc ,0x8a ,0x8c ,0xe ,0x8f ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0x89 ,0xe ,0x9 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xc ,0x88 ,0x8a ,0xd ,0x8d ,0x8e ,0x90 ,0x80 ,0x81 ,0x6 ,0x5 ,0x83 ,0x85 ,0x7 ,0x88 ,0xa ,0x6 ,0x3 ,0x80 ,0x82 ,0x84 ,0x85 ,0x9 ,0x87 ,0x89 ,0x8a ,0x8c ,0x80 ,0x81 ,0x3 ,0x5 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0x8 ,0x80 ,0x6 ,0x4 ,0x82 ,0x84 ,0x7 ,0x87 ,0xa ,0x89 ,0xb ,0x8c ,0xb ,0x2 ,0x3 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0x9 ,0xa ,0x8a ,0x8c ,0x81 ,0x80 ,0x2 ,0x81 ,0x5 ,0x83 ,0x85 ,0x9 ,0x86 ,0x88 ,0xa ,0x8b ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0xe ,0x7 ,0x5 ,0x4 ,0x82 ,0x6 ,0x85 ,0xb ,0xa ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x16 ,0x13 ,0x12 ,0x8f ,0x91 ,0x15 ,0x93 ,0x95 ,0x1a ,0x19 ,0x97 ,0x99 ,0x1b ,0x9b ,0x9d ,0xd ,0x7 ,0x5 ,0x4 ,0x82 ,0x6 ,0x85 ,0xa ,0x9 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0x12 ,0x11 ,0x8e ,0x90 ,0x13 ,0x92 ,0x94 ,0x19 ,0x18 ,0x96 ,0x98 ,0x1a ,0x9a ,0x9c ,0xc ,0x6 ,0x3 ,0x5 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0xb ,0x89 ,0x8b ,0xd ,0x11 ,0x10 ,0x8d ,0x8f ,0x13 ,0x91 ,0x93 ,0x18 ,0x17 ,0x95 ,0x97 ,0x19 ,0x99 ,0x9b ,0x8 ,0x2 ,0x5 ,0x4 ,0x83 ,0x7 ,0x85 ,0x87 ,0x10 ,0xd ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x14 ,0x12 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8e ,0x10 ,0x13 ,0x90 ,0x92 ,0x14 ,0x94 ,0x96 ,0x9 ,0x6 ,0x3 ,0x4 ,0x82 ,0x84 ,0x85 ,0x8 ,0x88 ,0xa ,0xb ,0xd ,0x8a ,0x8c ,0x10 ,0x8e ,0x90 ,0x12 ,0x13 ,0x93 ,0x16 ,0x95 ,0x97 ,0x9 ,0x6 ,0x3 ,0x5 ,0x82 ,0x84 ,0x85 ,0x8 ,0x88 ,0x11 ,0xb ,0xc ,0x8a ,0x8c ,0x10 ,0x8e ,0x90 ,0x15 ,0x13 ,0x92 ,0x94 ,0x17 ,0x96 ,0x98 ,0x1 ,0x8 ,0x3 ,0x4 ,0x81 ,0x83 ,0x84 ,0x86 ,0xc ,0xa ,0x88 ,0x8a ,0xd ,0x8c ,0x8e ,0x10 ,0x11 ,0x12 ,0x92 ,0x94 ,0x1 ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x14 ,0x11 ,0x13 ,0x91 ,0x93 ,0x94 ,0x16 ,0x96 ,0x98 ,0xc ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xb ,0x8b ,0xd ,0x10 ,0xf ,0x8e ,0x11 ,0x91 ,0x16 ,0x15 ,0x93 ,0x95 ,0x17 ,0x97 ,0x99 ,0xe ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0xb ,0xa ,0x89 ,0xc ,0x8b ,0x8d ,0xf ,0x12 ,0x8e ,0x90 ,0x92 ,0x17 ,0x16 ,0x94 ,0x96 ,0x18 ,0x99 ,0xc ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0xd ,0x11 ,0x10 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x16 ,0x95 ,0x97 ,0xc ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x8b ,0x10 ,0x8c ,0xf ,0x8f ,0x11 ,0x91 ,0x93 ,0x1 ,0x2 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0x8c ,0x8e ,0x14 ,0x11 ,0x90 ,0x13 ,0x93 ,0x17 ,0x16 ,0x96 ,0x19 ,0x98 ,0x9a ,0x1 ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xc ,0x89 ,0x8b ,0xf ,0x8d ,0x8f ,0x13 ,0x12 ,0x92 ,0x14 ,0x95 ,0xb ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0x8a ,0x8b ,0xd ,0x8d ,0x8f ,0xc ,0x8 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0xd ,0x8c ,0xf ,0x8f ,0x13 ,0x12 ,0x92 ,0x94 ,0x1 ,0x9 ,0x6 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0x8a ,0xd ,0x2 ,0x5 ,0x80 ,0x82 ,0x7 ,0x84 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0x8c ,0xe ,0xf ,0x8e ,0x11 ,0x90 ,0x92 ,0x94 ,0x1 ,0x6 ,0x3 ,0x4 ,0x82 ,0x84 ,0xa ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0x11 ,0x8d ,0x8f ,0x12 ,0x91 ,0x93 ,0x95 ,0xc ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xb ,0x89 ,0x8b ,0xd ,0x8d ,0x10 ,0x8f ,0x91 ,0xa ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0x9 ,0x8 ,0x87 ,0x89 ,0xf ,0xc ,0xe ,0x8c ,0x8e ,0x8f ,0x90 ,0x92 ,0xb ,0x8 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0x88 ,0x8a ,0xc ,0x8b ,0xe ,0x8e ,0x90 ,0x1 ,0x8 ,0x6 ,0x4 ,0x82 ,0x84 ,0x85 ,0x87 ,0x9 ,0xa ,0x8b ,0xe ,0x8 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0xc ,0xb ,0x88 ,0x8a ,0xd ,0x8d ,0x8e ,0x8f ,0x11 ,0x92 ,0x1 ,0x2 ,0x6 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0x8d ,0x8e ,0x10 ,0x8f ,0x91 ,0x93 ,0x1 ,0x9 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x89 ,0xb ,0x8c ,0x1 ,0x2 ,0x3 ,0x4 ,0x83 ,0x8 ,0x84 ,0x86 ,0x9 ,0x89 ,0x8a ,0xc ,0x8c ,0x8e ,0x9 ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x88 ,0x8a ,0x1 ,0x7 ,0x6 ,0x4 ,0x81 ,0x83 ,0x85 ,0xb ,0xa ,0x87 ,0x89 ,0x8b ,0x12 ,0xf ,0x8d ,0x11 ,0x8f ,0x91 ,0x13 ,0x93 ,0x95 ,0xc ,0x2 ,0x5 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0xb ,0xa ,0x89 ,0x8b ,0xf ,0xe ,0x8e ,0x8f ,0x91 ,0x9 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0x89 ,0x8b ,0x9 ,0x2 ,0x80 ,0x4 ,0x82 ,0x84 ,0x7 ,0x8 ,0x88 ,0xa ,0x8a ,0xf ,0xe ,0x8c ,0x8e ,0x90 ,0x80 ,0x2 ,0x6 ,0x5 ,0x83 ,0x85 ,0x87 ,0xa ,0x9 ,0x3 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x89 ,0x8b ,0x1 ,0x81 ,0x5 ,0x82 ,0x84 ,0x86 ,0x1 ,0x2 ,0x83 ,0x7 ,0x6 ,0x3 ,0x5 ,0x82 ,0x84 ,0x86 ,0x87 ,0x89 ,0x81 ,0x81 ,0x1 ,0x2 ,0x80 ,0x4 ,0x83 ,0x8 ,0x7 ,0x86 ,0xa ,0x88 ,0x8a ,0xc ,0x10 ,0xe ,0x8c ,0x8e ,0x12 ,0x90 ,0x92 ,0x17 ,0x16 ,0x94 ,0x96 ,0x18 ,0x98 ,0x9a ,0x1 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x7 ,0x8 ,0x88 ,0xa ,0xb ,0xd ,0x8a ,0x8c ,0x10 ,0x8e ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x17 ,0x96 ,0x98 ,0x1 ,0x2 ,0x80 ,0x5 ,0x82 ,0x84 ,0x7 ,0x8 ,0x88 ,0xa ,0xb ,0xd ,0x8a ,0x8c ,0x10 ,0x8e ,0x90 ,0x15 ,0x14 ,0x92 ,0x94 ,0x16 ,0x97 ,0xc ,0x8 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x8c ,0xe ,0xf ,0x8f ,0x91 ,0xc ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x8c ,0xe ,0xf ,0x8f ,0x91 ,0xb ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x84 ,0x86 ,0x87 ,0xa ,0x8a ,0x8b ,0xd ,0xe ,0x8e ,0x90 ,0xc ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0x89 ,0x8b ,0x8c ,0xe ,0xf ,0x8f ,0x91 ,0x1 ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0x88 ,0xb ,0x8a ,0x8c ,0xe ,0x12 ,0x11 ,0x8e ,0x90 ,0x14 ,0x92 ,0x94 ,0x16 ,0x17 ,0x97 ,0x99 ,0xf ,0x8 ,0x6 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x88 ,0x8a ,0xe ,0x8c ,0x8e ,0x8f ,0x11 ,0x12 ,0x92 ,0x94 ,0xb ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x87 ,0xa ,0x8a ,0x8b ,0xd ,0xe ,0x8e ,0x90 ,0x1 ,0x7 ,0x5 ,0x4 ,0x82 ,0x83 ,0x85 ,0x8 ,0xa ,0x87 ,0x89 ,0xc ,0x8b ,0x8d ,0xf ,0x13 ,0x12 ,0x8f ,0x91 ,0x14 ,0x93 ,0x95 ,0x17 ,0x97 ,0x99 ,0x10 ,0x2 ,0x3 ,0x5 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xd ,0xc ,0x89 ,0x8b ,0xe ,0x8d ,0x8f ,0x90 ,0x12 ,0x13 ,0x93 ,0x95 ,0x80 ,0x81 ,0x6 ,0x5 ,0x83 ,0x85 ,0x7 ,0x88 ,0x1 ,0x7 ,0x5 ,0x80 ,0x82 ,0x83 ,0x85 ,0x8 ,0x86 ,0x88 ,0x89 ,0x8b ,0xd ,0xe ,0x10 ,0x8d ,0x8f ,0x90 ,0x92 ,0x16 ,0x15 ,0x95 ,0x97 ,0xc ,0x8 ,0x3 ,0x5 ,0x81 ,0x83 ,0x7 ,0x86 ,0x9 ,0xa ,0x89 ,0x8b ,0x8c ,0x8e ,0xe ,0x2 ,0x5 ,0x4 ,0x82 ,0x6 ,0x84 ,0x86 ,0xb ,0x87 ,0x89 ,0xd ,0x8b ,0x8d ,0x12 ,0x8e ,0x8f ,0x91 ,0x13 ,0x94 ,0x80 ,0x2 ,0x6 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0xa ,0xc ,0x8a ,0x8c ,0xe ,0x8f ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0x88 ,0xb ,0x8a ,0x8c ,0x80 ,0x81 ,0x6 ,0x5 ,0x83 ,0x85 ,0x8 ,0x87 ,0x89 ,0x80 ,0x81 ,0x82 ,0x5 ,0x84 ,0x86 ,0xc ,0x2 ,0x6 ,0x4 ,0x81 ,0x83 ,0x8 ,0x85 ,0x87 ,0xa ,0xb ,0x8b ,0xe ,0x8d ,0xf ,0x10 ,0x90 ,0x91 ,0x93 ,0xa ,0x5 ,0x80 ,0x81 ,0x83 ,0x6 ,0x84 ,0x86 ,0x9 ,0x89 ,0x8a ,0xf ,0xd ,0x8c ,0x8e ,0x10 ,0x91 ,0xc ,0x2 ,0x5 ,0x80 ,0x82 ,0x6 ,0x84 ,0x86 ,0x9 ,0x88 ,0x89 ,0x8b ,0xd ,0xe ,0x10 ,0x8e ,0x90 ,0x13 ,0x92 ,0x94 ,0x1 ,0x6 ,0x5 ,0x80 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0xa ,0xe ,0xc ,0x8b ,0x8d ,0x10 ,0x8f ,0x91 ,0x80 ,0x9 ,0x6 ,0x5 ,0x82 ,0x84 ,0x8 ,0x86 ,0x88 ,0x89 ,0x8b ,0x80 ,0x2 ,0x3 ,0x5 ,0x82 ,0x84 ,0x7 ,0x86 ,0x88 ,0x89 ,0xb ,0x8b ,0x8d ,0x80 ,0x81 ,0x3 ,0x4 ,0x83 ,0x85 ,0x7 ,0x88 ,0x80 ,0x81 ,0x6 ,0x5 ,0x83 ,0x85 ,0x7 ,0x88 ,0x1 ,0x81 ,0x82 ,0x83 ,0x85 ,0xd ,0x6 ,0x80 ,0x5 ,0x82 ,0x84 ,0x7 ,0x9 ,0x86 ,0x88 ,0xc ,0x8a ,0x8c ,0xe ,0x8f ,0x80 ,0x2 ,0x3 ,0x4 ,0x82 ,0x84 ,0x86 ,0x8 ,0xa ,0x89 ,0x8b ,0xa ,0x9 ,0x6 ,0x4 ,0x81 ,0x83 ,0x7 ,0x85 ,0x87 ,0x89 ,0xf ,0xc ,0xe ,0x8c ,0x8e ,0x90 ,0x80 ,0x8 ,0x6 ,0x5 ,0x82 ,0x84 ,0x7 ,0x87 ,0x9 ,0xa ,0x89 ,0x8b ,0xd ,0x8e ,0x1 ,0x2 ,0x3 ,0x81 ,0x83 ,0x85 ,0x7 ,0xa ,0x87 ,0x89 ,0xb ,0x8c ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x81 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0x2f ,0x28 ,0x5b ,0x2b ,0x77 ,0x33 ,0xd3 ,0x26 ,0x46 ,0x2b ,0xd9 ,0xed ,0x5f ,0x2f ,0x75 ,0x5a ,0xff ,0x8f ,0x23 ,0x25 ,0x78 ,0x3e ,0xc2 ,0x22 ,0x40 ,0x39 ,0xd9 ,0x34 ,0xf1 ,0x2a ,0xaa ,0x23 ,0x27 ,0x28 ,0x63 ,0x49 ,0x27 ,0x24 ,0x6c ,0x25 ,0x74 ,0x2b ,0x62 ,0x23 ,0x7c ,0x26 ,0x59 ,0x23 ,0x72 ,0x3f ,0x70 ,0x23 ,0x69 ,0x27 ,0x26 ,0x75 ,0x2e ,0x23 ,0x39 ,0x26 ,0x5a ,0x2a ,0x74 ,0x37 ,0x24 ,0x26 ,0x50 ,0x63 ,0x2d ,0x75 ,0x35 ,0x47 ,0x62 ,0x24 ,0x68 ,0x5a ,0x24 ,0x51 ,0x47 ,0x25 ,0x24 ,0x66 ,0x26 ,0x70 ,0x26 ,0x60 ,0x24 ,0x46 ,0x26 ,0x54 ,0x2a ,0x49 ,0x3d ,0x92 ,0x25 ,0x2b ,0x6f ,0x26 ,0x73 ,0x28 ,0x4d ,0x36 ,0x5a ,0x23 ,0x5a ,0x25 ,0x5b ,0x28 ,0x5c ,0x25 ,0x4f ,0x2d ,0x5b ,0x26 ,0x67 ,0x34 ,0x64 ,0x24 ,0x26 ,0x37 ,0x6f ,0x23 ,0x26 ,0x37 ,0x25 ,0x66 ,0x2a ,0x54 ,0x29 ,0x60 ,0x55 ,0x2f ,0x27 ,0x56 ,0x4e ,0x27 ,0x68 ,0x27 ,0x27 ,0x23 ,0x5b ,0x24 ,0x2d ,0x6c ,0x27 ,0x28 ,0x4c ,0x24 ,0x58 ,0x68 ,0x44 ,0x25 ,0x48 ,0x2d ,0x52 ,0x1d ,0x51 ,0x4c ,0x25 ,0x48 ,0x26 ,0x5e ,0x31 ,0x29 ,0x4d ,0x25 ,0x59 ,0x25 ,0x28 ,0x4c ,0x5e ,0x26 ,0x25 ,0x57 ,0x5d ,0x3c ,0x25 ,0x3b ,0x39 ,0x50 ,0x28 ,0x51 ,0x23 ,0x39 ,0x2a ,0x4d ,0x28 ,0x55 ,0x2c ,0x24 ,0x56 ,0x25 ,0x29 ,0x4a ,0x25 ,0x27 ,0x58 ,0x25 ,0x4d ,0x2e ,0x36 ,0x56 ,0x4f ,0x41 ,0x1d ,0x4f ,0x51 ,0x27 ,0x45 ,0x25 ,0x50 ,0x2a ,0x2e ,0x26 ,0x56 ,0x25 ,0x25 ,0x4f ,0x2c ,0x50 ,0x25 ,0x36 ,0x63 ,0x55 ,0x25 ,0x43 ,0x30 ,0x4e ,0x32 ,0x4b ,0x24 ,0x28 ,0x44 ,0x26 ,0x48 ,0x2d ,0x43 ,0x25 ,0x2b ,0x53 ,0x25 ,0x27 ,0x58 ,0x2b ,0x27 ,0x46 ,0x29 ,0x27 ,0x2b ,0x57 ,0x43 ,0x4e ,0x1d ,0x4c ,0x50 ,0x27 ,0x42 ,0x29 ,0x26 ,0x35 ,0x50 ,0x25 ,0x28 ,0x29 ,0x3c ,0x3a ,0x57 ,0x46 ,0x2e ,0x4e ,0x2a ,0x25 ,0x47 ,0x43 ,0x4e ,0x21 ,0x3f ,0x22 ,0x27 ,0x4e ,0x25 ,0x26 ,0x65 ,0x35 ,0x28 ,0x2f ,0x52 ,0x23 ,0x41 ,0x21 ,0x27 ,0x62 ,0x24 ,0x36 ,0x4d ,0x37 ,0x4d ,0x45 ,0x24 ,0x24 ,0x30 ,0x49 ,0x24 ,0x3a ,0x29 ,0x2e ,0x2d ,0x4c ,0x3b ,0x4b ,0x2b ,0x43 ,0x40 ,0x28 ,0x45 ,0x29 ,0x25 ,0x48 ,0x4d ,0x32 ,0x24 ,0x49 ,0x25 ,0x29 ,0x62 ,0x29 ,0x26 ,0x41 ,0x26 ,0x5b ,0x28 ,0x20 ,0x27 ,0x51 ,0x23 ,0x2e ,0x48 ,0x4b ,0x23 ,0x44 ,0x32 ,0x47 ,0x48 ,0x23 ,0x25 ,0x28 ,0x31 ,0x5d ,0x2c ,0x57 ,0x28 ,0x53 ,0x33 ,0x48 ,0x2b ,0x46 ,0x22 ,0x4c ,0x25 ,0x27 ,0x2a ,0x4f ,0x25 ,0x2a ,0x50 ,0x2b ,0x41 ,0x2d ,0x62 ,0x2e ,0x4b ,0x26 ,0x42 ,0x27 ,0x3a ,0x25 ,0x4a ,0x25 ,0x22 ,0x48 ,0x27 ,0x26 ,0x25 ,0x59 ,0x30 ,0x4f ,0x28 ,0x3e ,0x2a ,0x2f ,0x4a ,0x25 ,0x4e ,0x31 ,0x25 ,0x25 ,0x4b ,0x2c ,0x29 ,0x3f ,0x27 ,0x37 ,0x25 ,0x46 ,0x3f ,0x4c ,0x24 ,0x49 ,0x25 ,0x2d ,0x4b ,0x58 ,0x22 ,0x28 ,0x38 ,0x43 ,0x2b ,0x1f ,0x38 ,0x34 ,0x18 ,0x26 ,0x48 ,0x18 ,0x3b ,0x26 ,0x2c ,0x21 ,0x47 ,0x26 ,0x3e ,0x24 ,0x26 ,0x41 ,0x49 ,0x2d ,0x2c ,0x4a ,0x44 ,0x2b ,0x25 ,0x33 ,0x29 ,0x37 ,0x33 ,0x46 ,0x2d ,0x31 ,0x47 ,0x32 ,0x1b ,0x27 ,0x2a ,0x43 ,0x31 ,0x30 ,0x43 ,0x3a ,0x26 ,0x24 ,0x40 ,0x26 ,0x3b ,0x29 ,0x47 ,0x31 ,0x42 ,0x2d ,0x1e ,0x29 ,0x49 ,0x29 ,0x27 ,0x3a ,0x22 ,0x42 ,0x38 ,0x28 ,0x3b ,0x24 ,0x3f ,0x2e ,0x3d ,0x4b ,0x2f ,0x43 ,0x2d ,0x42 ,0x24 ,0x3b ,0x2a ,0x27 ,0x3c ,0x47 ,0x2f ,0x2f ,0x42 ,0x50 ,0x3d ,0x44 ,0x27 ,0x27 ,0x29 ,0x2e ,0x28 ,0x3c ,0x1f ,0x45 ,0x2a ,0x3c ,0x28 ,0x3d ,0x2a ,0x50 ,0x24 ,0x40 ,0x3b ,0x26 ,0x2b ,0x3d ,0x2f ,0x20 ,0x2d ,0x3f ,0x2b ,0x42 ,0x2e ,0x48 ,0x28 ,0x29 ,0x46 ,0x38 ,0x3a ,0x2d ,0x25 ,0x43 ,0x38 ,0x38 ,0x41 ,0x2b ,0x37 ,0x42 ,0x26 ,0x3d ,0x24 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x22 ,0x22 ,0xc8 ,0x2f ,0x22 ,0x35 ,0x67 ,0x2c ,0xf0 ,0x35 ,0x28 ,0x86 ,0xfb ,0x43 ,0x31 ,0xaa ,0x99 ,0x2c ,0xed ,0x49 ,0x33 ,0x23 ,0xbf ,0x29 ,0x2a ,0x69 ,0xfd ,0x23 ,0x23 ,0x48 ,0x39 ,0x7e ,0x23 ,0x46 ,0x28 ,0x73 ,0x2c ,0x67 ,0x7a ,0x37 ,0x35 ,0x72 ,0x69 ,0x25 ,0x64 ,0x27 ,0x75 ,0x28 ,0x24 ,0x2a ,0x81 ,0x26 ,0x23 ,0x26 ,0x55 ,0x28 ,0x74 ,0x2d ,0x3d ,0x23 ,0x6b ,0x2b ,0x27 ,0x47 ,0x5f ,0x3a ,0x3d ,0x61 ,0x61 ,0x28 ,0x26 ,0x6b ,0x24 ,0x25 ,0x28 ,0x67 ,0x61 ,0x27 ,0x23 ,0x26 ,0x48 ,0x27 ,0x65 ,0x2d ,0x40 ,0x24 ,0x66 ,0x2f ,0x4c ,0x2c ,0x5f ,0x24 ,0x5a ,0x4a ,0x5f ,0x26 ,0x55 ,0x25 ,0x38 ,0x6d ,0x25 ,0x59 ,0x2a ,0x5c ,0x25 ,0x24 ,0x26 ,0x3e ,0x27 ,0x5e ,0x2f ,0x3f ,0x24 ,0x5e ,0x30 ,0x51 ,0x28 ,0x35 ,0x5c ,0x26 ,0x56 ,0x4c ,0x28 ,0x58 ,0x25 ,0x4d ,0x25 ,0x52 ,0x25 ,0x24 ,0x25 ,0x2f ,0x6a ,0x31 ,0x25 ,0x2e ,0x64 ,0x29 ,0x75 ,0x3a ,0x64 ,0x28 ,0x53 ,0x49 ,0x55 ,0x25 ,0x3e ,0x58 ,0x26 ,0x27 ,0x54 ,0x24 ,0x25 ,0x6e ,0x28 ,0x25 ,0x5b ,0x30 ,0x46 ,0x25 ,0x5a ,0x23 ,0x50 ,0x3d ,0x4d ,0x22 ,0x56 ,0x26 ,0x53 ,0x22 ,0x24 ,0x3f ,0x57 ,0x29 ,0x61 ,0x24 ,0x25 ,0x46 ,0x2e ,0x29 ,0x4e ,0x25 ,0x57 ,0x30 ,0x4f ,0x4f ,0x2c ,0x23 ,0x2c ,0x52 ,0x27 ,0x54 ,0x25 ,0x24 ,0x4d ,0x27 ,0x37 ,0x41 ,0x26 ,0x52 ,0x2a ,0x4d ,0x26 ,0x27 ,0x4a ,0x24 ,0x42 ,0x34 ,0x50 ,0x27 ,0x32 ,0x5a ,0x24 ,0x25 ,0x2c ,0x58 ,0x3d ,0x26 ,0x53 ,0x2e ,0x4e ,0x43 ,0x4c ,0x28 ,0x35 ,0x4e ,0x24 ,0x4c ,0x26 ,0x5b ,0x26 ,0x25 ,0x45 ,0x56 ,0x2a ,0x28 ,0x59 ,0x26 ,0x2a ,0x4c ,0x56 ,0x25 ,0x4c ,0x3f ,0x48 ,0x22 ,0x4e ,0x2a ,0x1e ,0x41 ,0x26 ,0x29 ,0x58 ,0x2b ,0x4a ,0x24 ,0x49 ,0x29 ,0x21 ,0x48 ,0x30 ,0x4e ,0x26 ,0x24 ,0x50 ,0x26 ,0x55 ,0x35 ,0x26 ,0x25 ,0x52 ,0x2d ,0x4d ,0x37 ,0x4a ,0x29 ,0x3f ,0x24 ,0x4b ,0x25 ,0x3f ,0x26 ,0x27 ,0x53 ,0x37 ,0x27 ,0x4b ,0x38 ,0x25 ,0x47 ,0x29 ,0x27 ,0x31 ,0x4e ,0x49 ,0x62 ,0x2b ,0x4e ,0x48 ,0x24 ,0x4d ,0x27 ,0x45 ,0x24 ,0x32 ,0x32 ,0x50 ,0x26 ,0x4c ,0x3a ,0x4c ,0x49 ,0x32 ,0x25 ,0x27 ,0x4b ,0x26 ,0x2a ,0x2c ,0x65 ,0x2a ,0x26 ,0x4a ,0x48 ,0x2c ,0x4a ,0x2e ,0x42 ,0x22 ,0x4a ,0x4c ,0x24 ,0x29 ,0x5b ,0x26 ,0x41 ,0x27 ,0x38 ,0x4b ,0x2a ,0x4d ,0x26 ,0x4a ,0x30 ,0x2e ,0x42 ,0x4f ,0x47 ,0x17 ,0x34 ,0x25 ,0x3a ,0x3e ,0x26 ,0x48 ,0x2b ,0x36 ,0x4b ,0x1f ,0x4d ,0x2a ,0x29 ,0x4a ,0x23 ,0x50 ,0x27 ,0x4f ,0x25 ,0x4a ,0x28 ,0x4b ,0x2b ,0x49 ,0x2c ,0x49 ,0x39 ,0x50 ,0x7a ,0x27 ,0x44 ,0x26 ,0x48 ,0x20 ,0x44 ,0x2a ,0x7d ,0x43 ,0x35 ,0x2d ,0x62 ,0x48 ,0x28 ,0x3a ,0x25 ,0x37 ,0x6b ,0x33 ,0x4c ,0x26 ,0x53 ,0x2b ,0x40 ,0x48 ,0x27 ,0x28 ,0x3d ,0x2a ,0x47 ,0x31 ,0x43 ,0x2d ,0x28 ,0x61 ,0x4c ,0x6b ,0xd9 ,0x28 ,0x42 ,0x2b ,0x3b ,0x21 ,0x26 ,0x48 ,0x4b ,0x2b ,0x45 ,0x32 ,0x4a ,0x45 ,0x24 ,0x28 ,0x42 ,0x23 ,0x39 ,0x7e ,0x3d ,0x37 ,0x45 ,0x26 ,0x39 ,0x26 ,0x71 ,0x27 ,0x42 ,0x43 ,0x27 ,0x43 ,0x2b ,0x32 ,0x42 ,0x7a ,0x44 ,0x26 ,0x3a ,0x44 ,0x30 ,0x47 ,0x41 ,0x2e ,0x2a ,0x3e ,0x5c ,0x9f ,0x66 ,0x30 ,0x3e ,0x26 ,0x2a ,0x3d ,0x2a ,0x50 ,0x37 ,0x4d ,0x4e ,0x32 ,0x2c ,0x75 ,0x48 ,0x28 ,0x2f ,0x40 ,0x28 ,0x4b ,0x46 ,0x2c ,0x43 ,0x33 ,0x5b ,0x29 ,0x2f ,0x55 ,0x28 ,0x44 ,0x3e ,0x2d ,0x50 ,0x3e ,0x3d ,0x24 ,0x38 ,0x28 ,0x46 ,0x40 ,0x29 ,0x3d ,0x28 ,0x31 ,0x54 ,0x3c ,0x39 ,0x2c ,0x29 ,0x41 ,0x3e ,0x2b ,0x48 ,0x33 ,0x40 ,0x3a ,0x61 ,0x35 ,0x27 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x24 ,0x30 ,0x68 ,0x28 ,0xe8 ,0x26 ,0x7b ,0x29 ,0x26 ,0x60 ,0xb0 ,0x2a ,0x7e ,0xf5 ,0x34 ,0xbe ,0x56 ,0xf9 ,0xb8 ,0x35 ,0x24 ,0x27 ,0xc8 ,0x9b ,0x25 ,0x51 ,0xbf ,0xe8 ,0x40 ,0x31 ,0x7a ,0x25 ,0x2f ,0x2d ,0xb8 ,0x5c ,0x25 ,0x7c ,0x40 ,0x28 ,0x63 ,0x40 ,0x8c ,0x77 ,0x26 ,0x3d ,0x7f ,0x73 ,0x4d ,0x73 ,0x3a ,0x24 ,0x36 ,0xa4 ,0x24 ,0x2b ,0x5e ,0x68 ,0x2b ,0x85 ,0x35 ,0x3d ,0x25 ,0x5b ,0x29 ,0x27 ,0xcc ,0x48 ,0x42 ,0x66 ,0x2a ,0x61 ,0x24 ,0x29 ,0x78 ,0x26 ,0x4b ,0x5e ,0x26 ,0x76 ,0x34 ,0x26 ,0x76 ,0x6b ,0x31 ,0x64 ,0x35 ,0x55 ,0x27 ,0x70 ,0x33 ,0x2a ,0x24 ,0x57 ,0x2b ,0x28 ,0x5f ,0x33 ,0x8d ,0x5b ,0x33 ,0x54 ,0x2c ,0x54 ,0x24 ,0x25 ,0x32 ,0x56 ,0x28 ,0x29 ,0x56 ,0x72 ,0x60 ,0x29 ,0x30 ,0x5c ,0x27 ,0x5b ,0x61 ,0x2c ,0x25 ,0x2b ,0x4d ,0x2a ,0x29 ,0x3b ,0x71 ,0x25 ,0x3c ,0x25 ,0x55 ,0x37 ,0x5c ,0x2c ,0x52 ,0x26 ,0x4d ,0x55 ,0x25 ,0x25 ,0x42 ,0x5b ,0x31 ,0x37 ,0x5a ,0x56 ,0x22 ,0x26 ,0x50 ,0x2a ,0x5c ,0x24 ,0x28 ,0x3a ,0x28 ,0x2e ,0x5c ,0x26 ,0x4b ,0x71 ,0x31 ,0x4f ,0x2f ,0x79 ,0x54 ,0x27 ,0x37 ,0x2e ,0x51 ,0x5e ,0x26 ,0x23 ,0x5f ,0x57 ,0x3f ,0x4e ,0x2d ,0x41 ,0x25 ,0x24 ,0x56 ,0x25 ,0x2a ,0x4f ,0x5b ,0x30 ,0x26 ,0x3c ,0x6b ,0x3c ,0x5f ,0x2f ,0x59 ,0x2e ,0x37 ,0x25 ,0x56 ,0x25 ,0x27 ,0x4c ,0x45 ,0x24 ,0x39 ,0x53 ,0x53 ,0x23 ,0x27 ,0x47 ,0x5d ,0x3d ,0x26 ,0x39 ,0x64 ,0x2b ,0x26 ,0x5c ,0x28 ,0x69 ,0x28 ,0x60 ,0x31 ,0x28 ,0x33 ,0x52 ,0x27 ,0x58 ,0x2f ,0x4b ,0x57 ,0x2d ,0x23 ,0x53 ,0x52 ,0x40 ,0x4e ,0x32 ,0x48 ,0x28 ,0x33 ,0x4f ,0x26 ,0x4b ,0x5d ,0x37 ,0x2c ,0x4f ,0x4a ,0x76 ,0x25 ,0x48 ,0x26 ,0x1b ,0x52 ,0x55 ,0x2c ,0x27 ,0x42 ,0x33 ,0x55 ,0x6c ,0x2c ,0x5b ,0x4f ,0x30 ,0x49 ,0x24 ,0x79 ,0x2a ,0x5c ,0x3d ,0x25 ,0x3c ,0x3b ,0x27 ,0x27 ,0x4a ,0x34 ,0x4c ,0x49 ,0x34 ,0x82 ,0x26 ,0x25 ,0x54 ,0x25 ,0x3a ,0x53 ,0x33 ,0x4e ,0x43 ,0x25 ,0x3d ,0x27 ,0x6c ,0x34 ,0x29 ,0x4d ,0x3b ,0x52 ,0x25 ,0x34 ,0x27 ,0x24 ,0x31 ,0x2e ,0x47 ,0x33 ,0x47 ,0x4f ,0x35 ,0x24 ,0x4d ,0x38 ,0x26 ,0x2e ,0x63 ,0x23 ,0x40 ,0x32 ,0x52 ,0x29 ,0x2a ,0x51 ,0x41 ,0x27 ,0x57 ,0x28 ,0x2d ,0x52 ,0x29 ,0x45 ,0x2b ,0x4a ,0x45 ,0x2c ,0x53 ,0x38 ,0x2a ,0x47 ,0x39 ,0x5f ,0x5f ,0x2c ,0x4f ,0x25 ,0x4b ,0x2e ,0x3b ,0x19 ,0x27 ,0x3c ,0x5e ,0x3c ,0x25 ,0x2e ,0x4c ,0x2e ,0x2b ,0x60 ,0x4b ,0x2f ,0x38 ,0x48 ,0x2d ,0x48 ,0x24 ,0x51 ,0x25 ,0x50 ,0x48 ,0x2c ,0x29 ,0x48 ,0x29 ,0x27 ,0x3a ,0x28 ,0x47 ,0x2e ,0x31 ,0x4f ,0x2a ,0x51 ,0x41 ,0x27 ,0x31 ,0x4f ,0x5e ,0x2b ,0x41 ,0x4d ,0x51 ,0x2c ,0x27 ,0x54 ,0x2f ,0x27 ,0x42 ,0x2c ,0x66 ,0x54 ,0x33 ,0x2f ,0x44 ,0x6f ,0x3c ,0x28 ,0x44 ,0x4f ,0x2d ,0x2b ,0x41 ,0x57 ,0x36 ,0x42 ,0x2e ,0x52 ,0x3e ,0x45 ,0x32 ,0x2b ,0x4d ,0x62 ,0x2a ,0x50 ,0x2e ,0x26 ,0x30 ,0x43 ,0x26 ,0x51 ,0x31 ,0x44 ,0x33 ,0x4f ,0x28 ,0x50 ,0x23 ,0x23 ,0x45 ,0x52 ,0x47 ,0x43 ,0x2c ,0x26 ,0x46 ,0x48 ,0x2a ,0x4b ,0x28 ,0x4c ,0x2e ,0x67 ,0x2f ,0x3b ,0x50 ,0x2f ,0x1b ,0x51 ,0x25 ,0x47 ,0x26 ,0x38 ,0x29 ,0x4f ,0x34 ,0x4c ,0x2c ,0x49 ,0x2e ,0x25 ,0x46 ,0x28 ,0x2e ,0x49 ,0x5b ,0x2a ,0x36 ,0x50 ,0x4e ,0x28 ,0x4a ,0x2d ,0x4d ,0x28 ,0x26 ,0x4e ,0x26 ,0x57 ,0x27 ,0x2b ,0x44 ,0x48 ,0x29 ,0x48 ,0x27 ,0x5f ,0x25 ,0x2c ,0x4f ,0x4c ,0x2b ,0x4b ,0x33 ,0x52 ,0x4a ,0x37 ,0x2a ,0x45 ,0x3b ,0x25 ,0x2c ,0x48 ,0x36 ,0x2f ,0x49 ,0x29 ,0x28 ,0x33 ,0x4a ,0x2e ,0x58 ,0x2f ,0x41 ,0x25 ,0x4c ,0x35 ,0x4d ,0x3f ,0x48 ,0x32 ,0x36 ,0x23 ,0x28 ,0x49 ,0x47 ,0x28 ,0x27 ,0x33 ,0x4b ,0x2d ,0x3a ,0x2c ,0x4b ,0x30 ,0x44 ,0x35 ,0x2b ,0x44 ,0x27 ,0x3e ,0x4d ,0x37 ,0x45 ,0x2b ,0x4c ,0x30 ,0x2a ,0x4b ,0x47 ,0x2e ,0x53 ,0x25 ,0x47 ,0x32 ,0x44 ,0x45 ,0x2e ,0x31 ,0x48 ,0x34 ,0x26 ,0x41 ,0x31 ,0x48 ,0x37 ,0x4e ,0x2b ,0x41 ,0x42 ,0x2e ,0x42 ,0x25 ,0x26 ,0x3b ,0x38 ,0x2b ,0x54 ,0x44 ,0x2e ,0x25 ,0x4d ,0x35 ,0x38 ,0x47 ,0x2c ,0x4d ,0x26 ,0x46 ,0x2c ,0x55 ,0x2d ,0x4a ,0x44 ,0x2a ,0x31 ,0x55 ,0x2c ,0x2b ,0x36 ,0x55 ,0x38 ,0x43 ,0x2a ,0x91 ,0x48 ,0x41 ,0x54 ,0x29 ,0x19 ,0x4f ,0x2a ,0x35 ,0x4b ,0x4f ,0x38 ,0x24 ,0x2a ,0x40 ,0x4c ,0x32 ,0x2b ,0x2c ,0x44 ,0x2a ,0x2f ,0x41 ,0x2f ,0x47 ,0x3a ,0x53 ,0x37 ,0x2c ,0x45 ,0x39 ,0x2c ,0x2a ,0x46 ,0x3c ,0x30 ,0x35 ,0x44 ,0x43 ,0x2b ,0x39 ,0x44 ,0x2d ,0x3e ,0x7e ,0x23 ,0x3e ,0x2d ,0x2e ,0x44 ,0x36 ,0x44 ,0x39 ,0x50 ,0x46 ,0x45 ,0x30 ,0x4b ,0x24 ,0x42 ,0x36 ,0x2d ,0x37 ,0x41 ,0x30 ,0x40 ,0x33 ,0x50 ,0x27 ,0x1f ,0x36 ,0x4f ,0x31 ,0x2b ,0x3e ,0x27 ,0x22 ,0x3b ,0x1f ,0x49 ,0x72 ,0x3e ,0x48 ,0x29 ,0x28 ,0x4c ,0x4f ,0x95 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x23 ,0x5a ,0x27 ,0x3f ,0x3a ,0x26 ,0xb8 ,0x31 ,0x25 ,0x40 ,0x30 ,0xbb ,0x32 ,0x8f ,0xce ,0x4d ,0x30 ,0x24 ,0x38 ,0xab ,0x5b ,0x27 ,0x79 ,0xe5 ,0xf6 ,0x8f ,0xd2 ,0x3e ,0x24 ,0x5f ,0x3d ,0xd0 ,0x26 ,0x80 ,0x29 ,0x77 ,0x26 ,0x68 ,0x2b ,0x55 ,0x24 ,0x6a ,0x2a ,0x68 ,0x7c ,0x43 ,0x24 ,0x50 ,0x37 ,0x25 ,0x97 ,0x31 ,0x2a ,0x56 ,0x36 ,0x83 ,0x76 ,0x3a ,0x66 ,0x30 ,0x25 ,0x58 ,0x33 ,0x76 ,0x25 ,0x51 ,0x3d ,0x26 ,0x42 ,0x25 ,0x61 ,0x28 ,0x30 ,0x23 ,0x34 ,0x6c ,0x62 ,0x24 ,0x29 ,0x4c ,0x6b ,0x32 ,0x80 ,0x31 ,0x36 ,0x25 ,0x2c ,0x5c ,0x26 ,0x4b ,0x2d ,0x8e ,0x5c ,0x32 ,0x28 ,0x49 ,0x25 ,0x34 ,0x3c ,0x2a ,0x27 ,0x47 ,0x60 ,0x35 ,0x27 ,0x47 ,0x70 ,0x2e ,0x63 ,0x31 ,0x2c ,0x49 ,0x5e ,0x3a ,0x37 ,0x53 ,0x26 ,0x80 ,0x5f ,0x2c ,0x26 ,0x79 ,0x28 ,0x74 ,0x24 ,0x4b ,0x61 ,0x30 ,0x25 ,0x7a ,0x2a ,0x4c ,0x2a ,0x33 ,0x6c ,0x44 ,0x25 ,0x24 ,0x5b ,0x50 ,0x2a ,0x56 ,0x3c ,0x57 ,0x36 ,0x36 ,0x58 ,0x26 ,0x63 ,0x57 ,0x2f ,0x27 ,0x5f ,0x27 ,0x66 ,0x25 ,0x4e ,0x33 ,0x59 ,0x25 ,0x3f ,0x33 ,0x26 ,0x28 ,0x46 ,0x29 ,0x5b ,0x35 ,0x26 ,0x33 ,0x68 ,0x2d ,0x53 ,0x4f ,0x2a ,0x27 ,0x41 ,0x5f ,0x34 ,0x2b ,0x42 ,0x52 ,0x35 ,0x3f ,0x58 ,0x59 ,0x2f ,0x27 ,0x34 ,0x62 ,0x27 ,0x4a ,0x4b ,0x29 ,0x45 ,0x28 ,0x56 ,0x34 ,0x41 ,0x53 ,0x2b ,0x4a ,0x26 ,0x3d ,0x46 ,0x2d ,0x32 ,0x27 ,0x29 ,0x4c ,0x5d ,0x28 ,0x54 ,0x34 ,0x2d ,0x55 ,0x2e ,0x5a ,0x26 ,0x62 ,0x77 ,0x2a ,0x50 ,0x41 ,0x63 ,0x2d ,0x2a ,0x49 ,0x2a ,0x53 ,0x27 ,0x4b ,0x78 ,0x30 ,0x29 ,0x46 ,0x56 ,0x31 ,0x26 ,0x28 ,0x41 ,0x25 ,0x79 ,0x44 ,0x29 ,0x51 ,0x33 ,0x26 ,0x35 ,0x35 ,0x27 ,0x2a ,0x4f ,0x5b ,0x3a ,0x28 ,0x50 ,0x46 ,0x2d ,0x67 ,0x2a ,0x52 ,0x35 ,0x29 ,0x39 ,0x54 ,0x36 ,0x53 ,0x36 ,0x3e ,0x26 ,0x34 ,0x50 ,0x51 ,0x27 ,0x29 ,0x41 ,0x23 ,0x50 ,0x26 ,0x35 ,0x41 ,0x2e ,0x30 ,0x68 ,0x31 ,0x25 ,0x45 ,0x60 ,0x4b ,0x4f ,0x4b ,0x26 ,0x3f ,0x4e ,0x3f ,0x25 ,0x2c ,0x3e ,0x8a ,0x3a ,0x27 ,0x57 ,0x2a ,0x2b ,0x66 ,0x39 ,0x28 ,0x33 ,0x2c ,0x40 ,0x3e ,0x29 ,0x4e ,0x2e ,0x4e ,0x3d ,0x28 ,0x45 ,0x51 ,0x27 ,0x27 ,0x40 ,0x2d ,0x77 ,0x29 ,0x25 ,0x2e ,0x55 ,0x3a ,0x2b ,0x45 ,0x2e ,0x3f ,0x4e ,0x2d ,0x4e ,0x2c ,0x3d ,0x56 ,0x2a ,0x2b ,0x60 ,0x33 ,0x26 ,0x2f ,0x55 ,0x24 ,0x28 ,0x46 ,0x28 ,0x54 ,0x34 ,0x48 ,0x2a ,0x2f ,0x25 ,0x28 ,0x33 ,0x4b ,0x29 ,0x58 ,0x44 ,0x27 ,0x4f ,0x39 ,0x27 ,0x47 ,0x49 ,0x39 ,0x28 ,0x3e ,0x24 ,0x2b ,0x40 ,0x29 ,0x45 ,0x39 ,0x6b ,0x30 ,0x42 ,0x75 ,0x29 ,0x37 ,0x28 ,0x37 ,0x36 ,0x37 ,0x5f ,0x27 ,0x34 ,0x55 ,0x30 ,0x4b ,0x30 ,0x48 ,0x2e ,0x5d ,0x28 ,0x46 ,0x2d ,0x26 ,0x2b ,0x47 ,0x5f ,0x2b ,0x28 ,0x7e ,0x32 ,0x2a ,0x45 ,0x44 ,0x25 ,0x3a ,0x47 ,0x32 ,0x25 ,0x3a ,0x3a ,0x2e ,0x2f ,0x4e ,0x34 ,0x4b ,0x47 ,0x54 ,0x28 ,0x5a ,0x31 ,0x3e ,0x2a ,0x53 ,0x2b ,0x34 ,0x4b ,0x2a ,0x3b ,0x49 ,0x31 ,0x29 ,0x4a ,0x33 ,0x48 ,0x2c ,0x45 ,0x2c ,0x50 ,0x25 ,0x3b ,0x29 ,0x3d ,0x65 ,0x24 ,0x56 ,0x2a ,0x39 ,0x2d ,0x41 ,0x30 ,0x49 ,0x3b ,0x28 ,0x32 ,0x44 ,0x2d ,0x49 ,0x90 ,0x5a ,0x2c ,0x29 ,0x3e ,0x3a ,0x4e ,0x27 ,0x3d ,0x41 ,0x23 ,0x28 ,0x4a ,0x2e ,0x3f ,0x2d ,0x28 ,0x4b ,0x27 ,0x51 ,0x3d ,0x25 ,0x2d ,0x51 ,0x34 ,0x53 ,0x43 ,0x36 ,0x29 ,0x3c ,0x4c ,0x30 ,0x3f ,0x2a ,0x50 ,0x24 ,0x51 ,0x8b ,0x27 ,0x2e ,0x32 ,0x57 ,0x45 ,0x2b ,0x2a ,0x47 ,0x32 ,0x3d ,0x43 ,0x37 ,0x29 ,0x4e ,0x34 ,0x4c ,0x38 ,0x43 ,0x2d ,0x46 ,0x26 ,0x2b ,0x54 ,0x28 ,0x2d ,0x4f ,0x25 ,0x1a ,0x3d ,0x2c ,0x2f ,0x3b ,0x38 ,0x25 ,0x30 ,0x45 ,0x33 ,0x3a ,0x2a ,0x35 ,0x4a ,0x4d ,0x33 ,0x35 ,0x44 ,0x35 ,0x41 ,0x34 ,0x29 ,0x2c ,0x46 ,0x2b ,0x28 ,0x2d ,0x41 ,0x50 ,0x34 ,0x25 ,0x2c ,0x2b ,0x3e ,0x30 ,0x4b ,0x46 ,0x28 ,0x4b ,0x24 ,0x34 ,0x42 ,0x2c ,0x3a ,0x1f ,0x2d ,0x4e ,0x2c ,0x43 ,0x57 ,0x2b ,0x4a ,0x2a ,0x50 ,0x2c ,0x46 ,0x2b ,0x33 ,0x41 ,0x3c ,0x4f ,0x2b ,0x23 ,0x4c ,0x3d ,0x32 ,0x38 ,0x4c ,0x4c ,0x3e ,0x71 ,0x51 ,0x29 ,0x2c ,0x3e ,0x2d ,0x45 ,0x3a ,0x48 ,0x44 ,0x25 ,0x2d ,0x3f ,0x6b ,0x4f ,0x32 ,0x2d ,0x4e ,0x3b ,0x28 ,0x45 ,0x27 ,0x2c ,0x25 ,0x36 ,0x40 ,0x2f ,0x43 ,0x54 ,0x3e ,0x2b ,0x2d ,0x3e ,0x34 ,0x36 ,0x45 ,0x2b ,0x37 ,0x4b ,0x35 ,0x36 ,0x4f ,0x27 ,0x28 ,0x39 ,0x29 ,0x44 ,0x30 ,0x46 ,0x2a ,0x3c ,0x49 ,0x52 ,0x38 ,0x2d ,0x4b ,0x2b ,0x3c ,0x27 ,0x2e ,0x44 ,0x2f ,0x45 ,0x30 ,0x42 ,0x29 ,0x2e ,0x40 ,0x34 ,0x2b ,0x4e ,0x3e ,0x2c ,0x2a ,0x26 ,0x4c ,0x37 ,0x47 ,0x31 ,0x41 ,0x38 ,0x32 ,0x46 ,0x28 ,0x40 ,0x2c ,0x65 ,0x36 ,0x21 ,0x4b ,0x2e ,0x3a ,0x4a ,0x2e ,0x44 ,0x29 ,0x28 ,0x34 ,0x4a ,0x26 ,0x41 ,0x32 ,0x34 ,0x3c ,0x34 ,0x49 ,0x27 ,0x2d ,0x38 ,0x2f ,0x4d ,0x39 ,0x2f ,0x40 ,0x35 ,0x44 ,0x2c ,0x44 ,0x32 ,0x34 ,0x41 ,0x2f ,0x2e ,0x47 ,0x3b ,0x2f ,0x3d ,0x27 ,0x48 ,0x36 ,0x4e ,0x38 ,0x44 ,0x44 ,0x2e ,0x39 ,0x31 ,0x43 ,0x55 ,0x37 ,0x28 ,0x2f ,0x48 ,0x37 ,0x48 ,0x2c ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x29 ,0x22 ,0x28 ,0x53 ,0x4d ,0x27 ,0xa3 ,0x38 ,0x31 ,0xc9 ,0x3c ,0xa9 ,0x5b ,0xfb ,0x30 ,0xa4 ,0xfa ,0x3d ,0xba ,0x22 ,0x84 ,0x2a ,0xf1 ,0x3c ,0x37 ,0x23 ,0x72 ,0x2a ,0x8f ,0x30 ,0xdf ,0x54 ,0x28 ,0x23 ,0x24 ,0x31 ,0x4b ,0x24 ,0xa4 ,0x3e ,0x44 ,0x2a ,0x76 ,0x3a ,0x7f ,0x33 ,0x29 ,0x69 ,0x3e ,0x77 ,0x25 ,0x4c ,0x24 ,0x24 ,0x7e ,0x2b ,0x24 ,0x5d ,0x2d ,0x24 ,0x3f ,0x7c ,0x41 ,0x29 ,0x24 ,0x24 ,0x38 ,0x3e ,0x25 ,0x7d ,0x3d ,0x28 ,0x50 ,0x30 ,0x5a ,0x29 ,0x69 ,0x2d ,0x58 ,0x32 ,0x64 ,0x26 ,0x4a ,0x24 ,0x44 ,0x2c ,0x6d ,0x25 ,0x50 ,0x2b ,0x69 ,0x31 ,0x25 ,0x41 ,0x24 ,0x27 ,0x45 ,0x26 ,0x4b ,0x2b ,0x85 ,0x5a ,0x2d ,0x67 ,0x3a ,0x25 ,0x5f ,0x30 ,0x5b ,0x27 ,0x58 ,0x23 ,0x29 ,0x51 ,0x5c ,0x2a ,0x25 ,0x27 ,0x4b ,0x41 ,0x26 ,0x5c ,0x33 ,0x25 ,0x3a ,0x26 ,0x5a ,0x32 ,0x29 ,0x3a ,0x6f ,0x2f ,0x24 ,0x5f ,0x27 ,0x56 ,0x2f ,0x27 ,0x42 ,0x4f ,0x25 ,0x25 ,0x2c ,0x4b ,0x4f ,0x2b ,0x2c ,0x5c ,0x25 ,0x25 ,0x3b ,0x31 ,0x52 ,0x23 ,0x41 ,0x25 ,0x57 ,0x3e ,0x28 ,0x40 ,0x2e ,0x53 ,0x36 ,0x68 ,0x45 ,0x28 ,0x3a ,0x5a ,0x24 ,0x27 ,0x4c ,0x2c ,0x24 ,0x27 ,0x36 ,0x2e ,0x62 ,0x26 ,0x50 ,0x35 ,0x41 ,0x26 ,0x51 ,0x3d ,0x49 ,0x31 ,0x41 ,0x28 ,0x58 ,0x3d ,0x25 ,0x27 ,0x44 ,0x2d ,0x25 ,0x26 ,0x66 ,0x27 ,0x36 ,0x27 ,0x24 ,0x4b ,0x5e ,0x28 ,0x2c ,0x65 ,0x25 ,0x3b ,0x27 ,0x3a ,0x29 ,0x35 ,0x53 ,0x4f ,0x2d ,0x4f ,0x35 ,0x25 ,0x25 ,0x5a ,0x45 ,0x2a ,0x35 ,0x48 ,0x26 ,0x4a ,0x29 ,0x27 ,0x49 ,0x3a ,0x48 ,0x5a ,0x25 ,0x2c ,0x76 ,0x3b ,0x24 ,0x29 ,0x60 ,0x28 ,0x3f ,0x26 ,0x53 ,0x2b ,0x25 ,0x2b ,0x48 ,0x27 ,0x35 ,0x58 ,0x26 ,0x3d ,0x50 ,0x3a ,0x26 ,0x47 ,0x36 ,0x37 ,0x50 ,0x3b ,0x26 ,0x4d ,0x27 ,0x25 ,0x2a ,0x49 ,0x2e ,0x25 ,0x26 ,0x47 ,0x27 ,0x25 ,0x2d ,0x4f ,0x27 ,0x3e ,0x4c ,0x65 ,0x45 ,0x2d ,0x48 ,0x34 ,0x4b ,0x25 ,0x55 ,0x2b ,0x24 ,0x47 ,0x23 ,0x28 ,0x2b ,0x4b ,0x3a ,0x28 ,0x3a ,0x4f ,0x29 ,0x31 ,0x62 ,0x2e ,0x43 ,0x35 ,0x50 ,0x5a ,0x29 ,0x27 ,0x28 ,0x47 ,0x2c ,0x4a ,0x53 ,0x31 ,0x43 ,0x39 ,0x4f ,0x2c ,0x26 ,0x34 ,0x4a ,0x27 ,0x45 ,0x25 ,0x28 ,0x52 ,0x32 ,0x25 ,0x57 ,0x2a ,0x43 ,0x29 ,0x40 ,0x27 ,0x4d ,0x33 ,0x46 ,0x31 ,0x48 ,0x26 ,0x26 ,0x45 ,0x2d ,0x24 ,0x46 ,0x24 ,0x27 ,0x46 ,0x2a ,0x24 ,0x28 ,0x4a ,0x28 ,0x29 ,0x49 ,0x28 ,0x28 ,0x57 ,0x3d ,0x32 ,0x49 ,0x39 ,0x36 ,0x26 ,0x3b ,0x26 ,0x4b ,0x3a ,0x29 ,0x48 ,0x24 ,0x26 ,0x4e ,0x2c ,0x28 ,0x51 ,0x26 ,0x5c ,0x34 ,0x4c ,0x27 ,0x2b ,0x2a ,0x47 ,0x28 ,0x41 ,0x2f ,0x48 ,0x2d ,0x2f ,0x46 ,0x3d ,0x24 ,0x4e ,0x2b ,0x29 ,0x2e ,0x4d ,0x44 ,0x36 ,0x41 ,0x2a ,0x4a ,0x2f ,0x41 ,0x2d ,0x2b ,0x46 ,0x27 ,0x2a ,0x30 ,0x26 ,0x4b ,0x3f ,0x36 ,0x4c ,0x3f ,0x34 ,0x25 ,0x2c ,0x45 ,0x26 ,0x29 ,0x24 ,0x4e ,0x34 ,0x26 ,0x3b ,0x26 ,0x2f ,0x42 ,0x2b ,0x42 ,0x2f ,0x44 ,0x3f ,0x24 ,0x42 ,0x27 ,0x2c ,0x3a ,0x50 ,0x27 ,0x4f ,0x47 ,0x54 ,0x44 ,0x2a ,0x2a ,0x3f ,0x32 ,0x48 ,0x29 ,0x24 ,0x3a ,0x22 ,0x43 ,0x2c ,0x47 ,0x37 ,0x28 ,0x36 ,0x24 ,0x3c ,0x2b ,0x28 ,0x28 ,0x3f ,0x4d ,0x2b ,0x30 ,0x40 ,0x2d ,0x37 ,0x44 ,0x48 ,0x28 ,0x41 ,0x2d ,0x30 ,0x53 ,0x23 ,0x42 ,0x53 ,0x42 ,0x27 ,0x45 ,0x32 ,0x26 ,0x49 ,0x2d ,0x40 ,0x2a ,0x3a ,0x2a ,0x26 ,0x33 ,0x4d ,0x41 ,0x33 ,0x35 ,0x53 ,0x2d ,0x20 ,0x4e ,0x28 ,0x35 ,0x39 ,0x80 ,0x50 ,0x2d ,0x25 ,0x25 ,0x3f ,0x33 ,0x40 ,0x25 ,0x24 ,0x4a ,0x2a ,0x2b ,0x29 ,0x53 ,0x39 ,0x24 ,0x4d ,0x36 ,0x46 ,0x2d ,0x3a ,0x2d ,0x34 ,0x47 ,0x24 ,0x34 ,0x44 ,0x24 ,0x48 ,0x42 ,0x2f ,0x41 ,0x2e ,0x4e ,0x37 ,0x28 ,0x32 ,0x51 ,0x2a ,0x31 ,0x3b ,0x28 ,0x42 ,0x40 ,0x28 ,0x43 ,0x36 ,0x64 ,0x47 ,0x47 ,0x2f ,0x31 ,0x2f ,0x50 ,0x28 ,0x3b ,0x2d ,0x38 ,0x44 ,0x27 ,0x3e ,0x28 ,0x49 ,0x2d ,0x45 ,0x36 ,0x57 ,0x49 ,0x56 ,0x27 ,0x2f ,0x2c ,0x3d ,0x3d ,0x2f ,0x42 ,0x35 ,0x2c ,0x49 ,0x27 ,0x47 ,0x35 ,0x2a ,0x46 ,0x29 ,0x3f ,0x2f ,0x45 ,0x2c ,0x2f ,0x2e ,0x41 ,0x34 ,0x4e ,0x54 ,0x35 ,0x44 ,0x2c ,0x37 ,0x2c ,0x42 ,0x31 ,0x34 ,0x4b ,0x43 ,0x2f ,0x46 ,0x2c ,0x29 ,0x51 ,0x34 ,0x37 ,0x29 ,0x2b ,0x3d ,0x2d ,0x4a ,0x3a ,0x2a ,0x31 ,0x4b ,0x2a ,0x42 ,0x26 ,0x3c ,0x32 ,0x40 ,0x32 ,0x3f ,0x2a ,0x47 ,0x3a ,0x28 ,0x3d ,0x29 ,0x42 ,0x2b ,0x41 ,0x2b ,0x38 ,0x2b ,0x30 ,0x47 ,0x31 ,0x44 ,0x28 ,0x35 ,0x56 ,0x31 ,0x35 ,0x2a ,0x43 ,0x30 ,0x46 ,0x2c ,0x24 ,0x39 ,0x25 ,0x3b ,0x2c ,0x4c ,0x31 ,0x32 ,0x49 ,0x28 ,0x39 ,0x42 ,0x29 ,0x42 ,0x2c ,0x2e ,0x50 ,0x3b ,0x38 ,0x41 ,0x34 ,0x3b ,0x38 ,0x27 ,0x39 ,0x29 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x2c ,0x24 ,0x41 ,0x2b ,0x29 ,0x4d ,0x35 ,0xa8 ,0x26 ,0x7b ,0xec ,0x28 ,0xfc ,0x66 ,0x7e ,0x24 ,0x27 ,0x8e ,0xe2 ,0x39 ,0xed ,0x2d ,0xaa ,0x2b ,0xff ,0x3c ,0xd4 ,0x59 ,0xf0 ,0x3f ,0xbf ,0x2f ,0x24 ,0x30 ,0x2b ,0x75 ,0x51 ,0x26 ,0x7e ,0x2f ,0x3b ,0x28 ,0xca ,0x39 ,0x90 ,0x26 ,0x28 ,0x60 ,0x4d ,0x24 ,0x6d ,0x28 ,0x2a ,0x8a ,0x72 ,0x31 ,0x72 ,0x21 ,0x92 ,0x5c ,0x27 ,0x71 ,0x48 ,0x82 ,0x25 ,0x33 ,0x2d ,0x68 ,0x2a ,0x91 ,0x5e ,0x26 ,0x60 ,0x45 ,0x29 ,0x69 ,0x26 ,0x27 ,0x53 ,0x44 ,0x24 ,0x62 ,0x29 ,0x2a ,0x71 ,0x63 ,0x2f ,0x65 ,0x26 ,0x64 ,0x2a ,0x28 ,0x6e ,0x39 ,0x6b ,0x25 ,0x32 ,0x25 ,0x5b ,0x26 ,0x6b ,0x29 ,0x24 ,0x41 ,0x2c ,0x3b ,0x60 ,0x29 ,0x67 ,0x3b ,0x25 ,0x62 ,0x33 ,0x2d ,0x68 ,0x7c ,0x5a ,0x73 ,0x5d ,0x40 ,0x5d ,0x27 ,0x5b ,0x6a ,0x3e ,0x25 ,0x2f ,0x60 ,0x30 ,0x26 ,0x6a ,0x39 ,0x28 ,0x3f ,0x25 ,0x64 ,0x60 ,0x25 ,0x4e ,0x2a ,0x39 ,0x25 ,0x58 ,0x2e ,0x2e ,0x62 ,0x38 ,0x5a ,0x48 ,0x57 ,0x3b ,0x25 ,0x62 ,0x37 ,0x2c ,0x25 ,0x55 ,0x29 ,0x29 ,0x57 ,0x33 ,0x50 ,0x25 ,0x3e ,0x2d ,0x56 ,0x4a ,0x24 ,0x5b ,0x2f ,0x5e ,0x2e ,0x4c ,0x2b ,0x2a ,0x5c ,0x55 ,0x27 ,0x30 ,0x25 ,0x33 ,0x4d ,0x57 ,0x29 ,0x61 ,0x27 ,0x26 ,0x27 ,0x4d ,0x28 ,0x48 ,0x28 ,0x64 ,0x52 ,0x25 ,0x25 ,0x69 ,0x53 ,0x40 ,0x52 ,0x40 ,0x29 ,0x3c ,0x25 ,0x2d ,0x5c ,0x27 ,0x4a ,0x64 ,0x3a ,0x56 ,0x2e ,0x5b ,0x25 ,0x25 ,0x2d ,0x75 ,0x49 ,0x47 ,0x24 ,0x28 ,0x5c ,0x24 ,0x24 ,0x54 ,0x2b ,0x4f ,0x3c ,0x40 ,0x2a ,0x36 ,0x24 ,0x55 ,0x2b ,0x37 ,0x27 ,0x4d ,0x33 ,0x51 ,0x2a ,0x51 ,0x27 ,0x3f ,0x26 ,0x58 ,0x29 ,0x6d ,0x2a ,0x5d ,0x2a ,0x3e ,0x26 ,0x47 ,0x2b ,0x32 ,0x58 ,0x54 ,0x23 ,0x29 ,0x43 ,0x35 ,0x50 ,0x22 ,0x52 ,0x45 ,0x39 ,0x25 ,0x56 ,0x25 ,0x54 ,0x26 ,0x41 ,0x4f ,0x4d ,0x2f ,0x37 ,0x25 ,0x4f ,0x27 ,0x4a ,0x28 ,0x39 ,0x89 ,0x4f ,0x2c ,0x3d ,0x24 ,0x25 ,0x2d ,0x6a ,0x28 ,0x52 ,0x50 ,0x2c ,0x26 ,0x29 ,0x54 ,0x25 ,0x30 ,0x58 ,0x2d ,0x26 ,0x69 ,0x51 ,0x29 ,0x4d ,0x27 ,0x2f ,0x47 ,0x3e ,0x26 ,0x51 ,0x28 ,0x4e ,0x26 ,0x36 ,0x48 ,0x27 ,0x4a ,0x56 ,0x35 ,0x47 ,0x3c ,0x24 ,0x55 ,0x26 ,0x2f ,0x4f ,0x49 ,0x28 ,0x38 ,0x4c ,0x4d ,0x28 ,0x3a ,0x29 ,0x5e ,0x3b ,0x50 ,0x38 ,0x40 ,0x25 ,0x26 ,0x3a ,0x27 ,0x3b ,0x6c ,0x24 ,0x27 ,0x52 ,0x26 ,0x50 ,0x2c ,0x2b ,0x42 ,0x4c ,0x26 ,0x3b ,0x4d ,0x4c ,0x28 ,0x26 ,0x42 ,0x26 ,0x2d ,0x4f ,0x27 ,0x46 ,0x28 ,0x2b ,0x4f ,0x26 ,0x42 ,0x45 ,0x26 ,0x2a ,0x53 ,0x26 ,0x2c ,0x55 ,0x58 ,0x2e ,0x40 ,0x25 ,0x3e ,0x6a ,0x4e ,0x3d ,0x4d ,0x35 ,0x45 ,0x59 ,0x43 ,0x26 ,0x41 ,0x31 ,0x5e ,0x32 ,0x4e ,0x28 ,0x49 ,0x4e ,0x26 ,0x42 ,0x34 ,0x38 ,0x4c ,0x45 ,0x2b ,0x41 ,0x50 ,0x27 ,0x4f ,0x29 ,0x2b ,0x46 ,0x26 ,0x2f ,0x5e ,0x27 ,0x52 ,0x25 ,0x5c ,0x4b ,0x2d ,0x24 ,0x52 ,0x35 ,0x5b ,0x26 ,0x45 ,0x2c ,0x39 ,0x4b ,0x50 ,0x2d ,0x4d ,0x41 ,0x33 ,0x45 ,0x2a ,0x43 ,0x4b ,0x31 ,0x28 ,0x29 ,0x31 ,0x6b ,0x26 ,0x29 ,0x5e ,0x4d ,0x2d ,0x28 ,0x40 ,0x59 ,0x31 ,0x42 ,0x25 ,0x35 ,0x47 ,0x44 ,0x33 ,0x55 ,0x1c ,0x49 ,0x37 ,0x3f ,0x2a ,0x46 ,0x28 ,0x48 ,0x40 ,0x2b ,0x41 ,0x29 ,0x41 ,0x66 ,0x3a ,0x2c ,0x4c ,0x33 ,0x42 ,0x30 ,0x4e ,0x2c ,0x2f ,0x3e ,0x4e ,0x30 ,0x53 ,0x3c ,0x28 ,0x44 ,0x2b ,0x48 ,0x2f ,0x28 ,0x2d ,0x55 ,0x53 ,0x30 ,0x46 ,0x25 ,0x38 ,0x4f ,0x22 ,0x38 ,0x46 ,0x3a ,0x46 ,0x28 ,0x42 ,0x29 ,0x4b ,0x2f ,0x51 ,0x38 ,0x59 ,0x32 ,0x58 ,0x2b ,0x27 ,0x42 ,0x28 ,0x3b ,0x5b ,0x31 ,0x40 ,0x81 ,0x4b ,0x49 ,0x2c ,0x27 ,0x28 ,0x3d ,0x25 ,0x3d ,0x50 ,0x1c ,0x46 ,0x4c ,0x32 ,0x2c ,0x4d ,0x2d ,0x2b ,0x32 ,0x46 ,0x37 ,0x29 ,0x4c ,0x33 ,0x32 ,0x50 ,0x30 ,0x43 ,0x27 ,0x3c ,0x44 ,0x29 ,0x2a ,0x3a ,0x5d ,0x1f ,0x45 ,0x50 ,0x3a ,0x2b ,0x45 ,0x39 ,0x38 ,0x4b ,0x2b ,0x4a ,0x3a ,0x2a ,0x38 ,0x51 ,0x3e ,0x25 ,0x2b ,0x51 ,0x2a ,0x3a ,0x28 ,0x3e ,0x54 ,0x28 ,0x45 ,0x33 ,0x2a ,0x49 ,0x2d ,0x22 ,0x3b ,0x46 ,0x2a ,0x27 ,0x34 ,0x41 ,0x2a ,0x42 ,0x35 ,0x2d ,0x41 ,0x52 ,0x40 ,0x40 ,0x39 ,0x26 ,0x30 ,0x47 ,0x35 ,0x5b ,0x28 ,0x40 ,0x2d ,0x42 ,0x2c ,0x32 ,0x4e ,0x36 ,0x44 ,0x2a ,0x3a ,0x60 ,0x32 ,0x46 ,0x21 ,0x51 ,0x30 ,0x54 ,0x41 ,0x2a ,0x31 ,0x41 ,0x32 ,0x49 ,0x2f ,0x33 ,0x2e ,0x3b ,0x43 ,0x2c ,0x3f ,0x2d ,0x5f ,0x43 ,0x30 ,0x2d ,0x3f ,0x2d ,0x42 ,0x37 ,0x41 ,0x35 ,0x2c ,0x4a ,0x3d ,0x29 ,0x34 ,0x40 ,0x31 ,0x4d ,0x34 ,0x33 ,0x45 ,0x42 ,0x2e ,0x3d ,0x3b ,0x29 ,0x4c ,0x30 ,0x41 ,0x29 ,0x9c ,0x2d ,0x2f ,0x43 ,0x29 ,0x3a ,0x2f ,0x46 ,0x44 ,0x27 ,0x48 ,0x2d ,0x35 ,0x43 ,0x42 ,0x25 ,0x39 ,0x38 ,0x4d ,0x35 ,0x45 ,0x2b ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x24 ,0x3e ,0xc1 ,0x2f ,0x26 ,0xcf ,0xef ,0x2d ,0x38 ,0xf7 ,0x7b ,0x26 ,0x6e ,0x25 ,0x24 ,0x94 ,0x26 ,0xe5 ,0x24 ,0x86 ,0x41 ,0xf1 ,0x48 ,0xf1 ,0x31 ,0x80 ,0x24 ,0x55 ,0x2f ,0x98 ,0x24 ,0x41 ,0x25 ,0x69 ,0x25 ,0x64 ,0x26 ,0x74 ,0x54 ,0x23 ,0x86 ,0x2a ,0x22 ,0x2e ,0x77 ,0x23 ,0x28 ,0x5b ,0x2d ,0x94 ,0x25 ,0x63 ,0x23 ,0x72 ,0x4d ,0x21 ,0x23 ,0x29 ,0x61 ,0x24 ,0x3f ,0x2e ,0x66 ,0x5b ,0x27 ,0x31 ,0x69 ,0x5d ,0x25 ,0x59 ,0x64 ,0x9f ,0x65 ,0x23 ,0x2b ,0x62 ,0x56 ,0x29 ,0x49 ,0x23 ,0x35 ,0x6d ,0x23 ,0x24 ,0x53 ,0x6c ,0x27 ,0x25 ,0x40 ,0x4f ,0x26 ,0x26 ,0x5b ,0x2f ,0x5f ,0x23 ,0x32 ,0x77 ,0x28 ,0x2a ,0x60 ,0x24 ,0x24 ,0x3e ,0x27 ,0x5b ,0x24 ,0x30 ,0x5a ,0x23 ,0x3a ,0x7f ,0x2b ,0x24 ,0x26 ,0x32 ,0x60 ,0x27 ,0x31 ,0x7e ,0x8b ,0x29 ,0x6d ,0x27 ,0x27 ,0x45 ,0x25 ,0x50 ,0x23 ,0x68 ,0x58 ,0xb4 ,0x25 ,0x53 ,0x51 ,0x23 ,0x23 ,0x28 ,0x4f ,0x24 ,0x27 ,0x8e ,0x34 ,0x26 ,0x28 ,0x55 ,0x48 ,0x27 ,0x65 ,0x3e ,0x51 ,0x3b ,0x27 ,0x51 ,0x25 ,0x50 ,0x58 ,0x27 ,0x24 ,0x25 ,0x4e ,0x56 ,0x27 ,0x25 ,0x3c ,0x2a ,0x6b ,0x28 ,0x46 ,0x29 ,0x62 ,0x50 ,0x53 ,0x26 ,0x2f ,0x52 ,0x73 ,0x25 ,0x24 ,0x3d ,0x29 ,0x53 ,0x26 ,0x51 ,0x46 ,0x28 ,0x64 ,0x25 ,0x2b ,0x61 ,0x25 ,0x46 ,0x27 ,0x5f ,0x2c ,0x3d ,0x26 ,0x57 ,0x32 ,0x4c ,0x33 ,0x28 ,0x50 ,0x25 ,0x50 ,0x29 ,0x49 ,0x25 ,0x51 ,0x28 ,0x5d ,0x2a ,0x25 ,0x3e ,0x29 ,0x2c ,0x6c ,0x3e ,0x25 ,0x52 ,0x6e ,0xae ,0x25 ,0x24 ,0x39 ,0x24 ,0x4e ,0x2e ,0x4e ,0x4a ,0x2e ,0x47 ,0x26 ,0x26 ,0x74 ,0x29 ,0x24 ,0x50 ,0x2a ,0x29 ,0x47 ,0x2c ,0x58 ,0x25 ,0x27 ,0x3b ,0x4a ,0x49 ,0x24 ,0x25 ,0x3b ,0x29 ,0x33 ,0x7b ,0x48 ,0x25 ,0x65 ,0x38 ,0x5c ,0x7c ,0x30 ,0x4b ,0x45 ,0x2c ,0x5d ,0x27 ,0x27 ,0x52 ,0x24 ,0x29 ,0x4d ,0x21 ,0x25 ,0x26 ,0x4b ,0x28 ,0x24 ,0x50 ,0x24 ,0x4d ,0x26 ,0x47 ,0x27 ,0x58 ,0x33 ,0x60 ,0x2b ,0x5a ,0x4b ,0x33 ,0x3f ,0x29 ,0x41 ,0x20 ,0x26 ,0x52 ,0x25 ,0x26 ,0x48 ,0x26 ,0x28 ,0x24 ,0x49 ,0x30 ,0x4a ,0x43 ,0x2c ,0x25 ,0x48 ,0x2b ,0x4a ,0x29 ,0x43 ,0x26 ,0x49 ,0x2a ,0x49 ,0x28 ,0x26 ,0x2e ,0x55 ,0x31 ,0xa2 ,0x5d ,0x28 ,0x30 ,0x4a ,0x69 ,0x2f ,0x26 ,0x46 ,0x4d ,0x24 ,0x26 ,0x3b ,0x25 ,0x3a ,0x42 ,0x65 ,0x47 ,0x2a ,0x28 ,0x3e ,0x25 ,0x3d ,0x2d ,0x26 ,0x4e ,0x2c ,0x43 ,0x32 ,0x31 ,0x48 ,0x24 ,0x45 ,0x2a ,0x27 ,0x28 ,0x26 ,0x49 ,0x24 ,0x27 ,0x47 ,0x2c ,0x25 ,0x37 ,0x28 ,0x45 ,0x29 ,0x47 ,0x33 ,0x31 ,0x48 ,0x49 ,0x21 ,0x27 ,0x47 ,0x2b ,0x23 ,0x47 ,0x25 ,0x2b ,0x2a ,0x52 ,0x26 ,0x30 ,0x42 ,0x2d ,0x4d ,0x2a ,0x2e ,0x53 ,0x25 ,0x47 ,0x2d ,0x25 ,0x32 ,0x42 ,0x42 ,0x2e ,0x27 ,0x41 ,0x2b ,0x26 ,0x4d ,0x27 ,0x2f ,0x2e ,0x43 ,0x26 ,0x4a ,0x43 ,0x27 ,0x35 ,0x21 ,0x43 ,0x2a ,0x4c ,0x26 ,0x26 ,0x4d ,0x25 ,0x26 ,0x2d ,0x41 ,0x31 ,0x5b ,0x31 ,0x2b ,0x29 ,0x2d ,0x4b ,0x49 ,0x31 ,0x28 ,0x46 ,0x42 ,0x28 ,0x26 ,0x51 ,0x26 ,0x46 ,0x29 ,0x2b ,0x54 ,0x44 ,0x2c ,0x26 ,0x47 ,0x25 ,0x34 ,0x28 ,0x3e ,0x29 ,0x44 ,0x2a ,0x27 ,0x37 ,0x26 ,0x50 ,0x2b ,0x2f ,0x41 ,0x24 ,0x51 ,0x26 ,0x3d ,0x26 ,0x4e ,0x41 ,0x26 ,0x26 ,0x36 ,0x28 ,0x2a ,0x43 ,0x32 ,0x46 ,0x30 ,0x30 ,0x44 ,0x27 ,0x4b ,0x28 ,0x3d ,0x2c ,0x3d ,0x24 ,0x33 ,0x2f ,0x4c ,0x27 ,0x3e ,0x21 ,0x32 ,0x35 ,0x4b ,0x28 ,0x51 ,0x26 ,0x55 ,0x2a ,0x35 ,0x49 ,0x28 ,0x46 ,0x77 ,0x25 ,0x49 ,0x44 ,0x22 ,0x40 ,0x2a ,0x4c ,0x2a ,0x44 ,0x36 ,0x24 ,0x36 ,0x4d ,0x25 ,0x42 ,0x25 ,0x36 ,0x34 ,0x25 ,0x34 ,0x49 ,0x30 ,0x41 ,0x34 ,0x27 ,0x41 ,0x2e ,0x43 ,0x2f ,0x26 ,0x29 ,0x3b ,0x47 ,0x34 ,0x29 ,0x47 ,0x34 ,0x22 ,0x44 ,0x31 ,0x38 ,0x4b ,0x40 ,0x2a ,0x39 ,0x40 ,0x38 ,0x24 ,0x44 ,0x40 ,0x37 ,0x26 ,0x3c ,0x2c ,0x41 ,0x46 ,0x30 ,0x39 ,0x28 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x38 ,0x22 ,0x72 ,0x26 ,0x28 ,0x61 ,0x61 ,0x2e ,0xd6 ,0x52 ,0x23 ,0x73 ,0x29 ,0x91 ,0x25 ,0x65 ,0xca ,0x2b ,0xf9 ,0x3b ,0x26 ,0x64 ,0xbf ,0x28 ,0xb2 ,0x47 ,0x23 ,0x39 ,0x26 ,0x26 ,0x57 ,0x69 ,0x2e ,0x92 ,0x36 ,0x24 ,0x27 ,0x7e ,0x30 ,0x51 ,0x73 ,0x24 ,0x62 ,0x5f ,0x2b ,0x8a ,0x26 ,0x24 ,0x27 ,0x7a ,0x2c ,0x28 ,0x70 ,0x2d ,0x25 ,0x33 ,0x32 ,0x6c ,0x41 ,0x29 ,0x75 ,0x2a ,0x63 ,0x4d ,0x4b ,0x24 ,0x60 ,0x29 ,0x69 ,0x28 ,0x24 ,0x26 ,0x96 ,0x25 ,0x26 ,0x60 ,0x27 ,0x4c ,0x26 ,0x2a ,0x5f ,0x25 ,0x3c ,0x31 ,0x64 ,0x26 ,0x64 ,0x60 ,0x27 ,0x5b ,0x22 ,0x53 ,0x36 ,0x25 ,0x6a ,0x2f ,0x24 ,0x26 ,0x37 ,0x97 ,0x28 ,0x25 ,0x4a ,0x2a ,0x57 ,0x26 ,0x37 ,0x8c ,0x28 ,0x55 ,0x29 ,0x29 ,0x3c ,0x57 ,0x48 ,0x4d ,0x28 ,0x51 ,0x28 ,0x62 ,0x39 ,0x24 ,0x26 ,0x62 ,0x27 ,0x26 ,0x73 ,0x2b ,0x29 ,0x4d ,0x28 ,0x52 ,0x31 ,0x26 ,0x63 ,0x37 ,0x26 ,0x47 ,0x2d ,0x61 ,0x3a ,0x53 ,0x5e ,0x26 ,0x40 ,0x2c ,0x50 ,0x34 ,0x26 ,0x3a ,0x4c ,0x2a ,0x51 ,0x40 ,0x2d ,0x4e ,0x24 ,0x4b ,0x29 ,0x28 ,0x5f ,0x54 ,0x29 ,0x24 ,0x26 ,0x30 ,0x2b ,0x5b ,0x4a ,0x28 ,0x31 ,0x4b ,0x4e ,0x34 ,0x45 ,0x26 ,0x26 ,0x28 ,0x49 ,0x5c ,0x26 ,0x25 ,0x27 ,0x31 ,0x4f ,0x43 ,0x30 ,0x38 ,0x4b ,0x4e ,0x39 ,0x25 ,0x52 ,0x24 ,0x27 ,0x3c ,0x2c ,0x50 ,0x30 ,0x25 ,0x28 ,0x27 ,0x4d ,0x26 ,0x31 ,0x4a ,0x35 ,0x26 ,0x4b ,0x2c ,0x28 ,0x4f ,0x50 ,0x3d ,0x45 ,0x26 ,0x25 ,0x43 ,0x4f ,0x2e ,0x25 ,0x4d ,0x25 ,0x54 ,0x24 ,0x2f ,0x4a ,0x8e ,0x26 ,0x29 ,0x2c ,0x39 ,0x65 ,0x4d ,0x3c ,0x43 ,0x2f ,0x2a ,0x55 ,0x48 ,0x30 ,0x2a ,0x6e ,0x50 ,0x29 ,0x2d ,0x4c ,0x38 ,0x26 ,0x4d ,0x2e ,0x48 ,0x32 ,0x24 ,0x36 ,0x3b ,0x5c ,0x39 ,0x4d ,0x25 ,0x52 ,0x2b ,0x50 ,0x2d ,0x30 ,0x43 ,0x3e ,0x29 ,0x25 ,0x3a ,0x35 ,0x55 ,0x4d ,0x3b ,0x33 ,0x52 ,0x27 ,0x5b ,0x32 ,0x4b ,0x25 ,0x29 ,0x25 ,0x71 ,0x27 ,0x30 ,0x42 ,0x48 ,0x33 ,0x4a ,0x59 ,0x56 ,0x31 ,0x27 ,0x2c ,0x57 ,0x2b ,0x45 ,0x4e ,0x22 ,0x25 ,0x2b ,0x89 ,0x3d ,0x44 ,0x2b ,0x49 ,0x32 ,0x4b ,0x35 ,0x4b ,0x24 ,0x33 ,0x4b ,0x2b ,0x50 ,0x2a ,0x45 ,0x24 ,0x39 ,0x26 ,0x29 ,0x29 ,0x75 ,0x3f ,0x36 ,0x49 ,0x36 ,0x48 ,0x28 ,0x44 ,0x1e ,0x4c ,0x22 ,0x52 ,0x2f ,0x2b ,0x4d ,0x38 ,0x25 ,0x2d ,0x5b ,0x3a ,0x2a ,0x49 ,0x2f ,0x28 ,0x24 ,0x3b ,0x4b ,0x3b ,0x34 ,0x4d ,0x26 ,0x3e ,0x42 ,0x29 ,0x26 ,0x2f ,0x53 ,0x27 ,0x3a ,0x48 ,0x2a ,0x44 ,0x2f ,0x45 ,0x0 ,0x41 ,0x4c ,0x3c ,0x22 ,0x27 ,0x49 ,0x34 ,0x27 ,0x25 ,0x30 ,0x53 ,0x41 ,0x2e ,0x37 ,0x4b ,0x26 ,0x4a ,0x36 ,0x37 ,0x22 ,0x48 ,0x2c ,0x39 ,0x25 ,0x4d ,0x33 ,0x28 ,0x28 ,0x59 ,0x47 ,0x24 ,0x29 ,0x32 ,0x2e ,0x60 ,0x27 ,0x3a ,0x47 ,0x40 ,0x2d ,0x50 ,0x2a ,0x48 ,0x28 ,0x2c ,0x4a ,0x31 ,0x26 ,0x37 ,0x44 ,0x45 ,0x2c ,0x29 ,0x3f ,0x28 ,0x2a ,0x4a ,0x42 ,0x28 ,0x25 ,0x37 ,0x4f ,0x28 ,0x5a ,0x26 ,0x36 ,0x44 ,0x2c ,0x3a ,0x29 ,0x48 ,0x3a ,0x2b ,0x3e ,0x3b ,0x29 ,0x50 ,0x2b ,0x3f ,0x2d ,0x4c ,0x3e ,0x2e ,0x46 ,0x28 ,0x4d ,0x4d ,0x2e ,0x2a ,0x24 ,0x48 ,0x2e ,0x22 ,0x32 ,0x54 ,0x26 ,0x41 ,0x34 ,0x31 ,0x4d ,0x2a ,0x3d ,0x27 ,0x37 ,0x3f ,0x4e ,0x31 ,0x45 ,0x26 ,0x38 ,0x2b ,0x3a ,0x47 ,0x28 ,0x28 ,0x3c ,0x45 ,0x25 ,0x3c ,0x74 ,0x38 ,0x48 ,0x2a ,0x28 ,0x34 ,0x49 ,0x30 ,0x2f ,0x41 ,0x37 ,0x4d ,0x32 ,0x5a ,0x45 ,0x31 ,0x33 ,0x4d ,0x3a ,0x27 ,0x3b ,0x2c ,0x46 ,0x3d ,0x28 ,0x34 ,0x4a ,0x3c ,0x2a ,0x40 ,0x19 ,0x43 ,0x2c ,0x20 ,0x30 ,0x32 ,0x4a ,0x4a ,0x41 ,0x26 ,0x29 ,0x4a ,0x2d ,0x4f ,0x2a ,0x47 ,0x25 ,0x40 ,0x38 ,0x41 ,0x40 ,0x29 ,0x43 ,0x40 ,0x29 ,0x2b ,0x3d ,0x2a ,0x24 ,0x4a ,0x2b ,0x3c ,0x26 ,0x45 ,0x39 ,0x2d ,0x2a ,0x46 ,0x27 ,0x27 ,0x3e ,0x2e ,0x36 ,0x46 ,0x2e ,0x3d ,0x43 ,0x5c ,0x2d ,0x29 ,0x37 ,0x34 ,0x43 ,0x56 ,0x36 ,0x41 ,0x46 ,0x3b ,0x2b ,0x23 ,0x43 ,0x2d ,0x41 ,0x26 ,0x49 ,0x3b ,0x31 ,0x41 ,0x42 ,0x2d ,0x3d ,0x26 ,0x27 ,0x41 ,0x39 ,0x23 ,0x30 ,0x28 ,0x34 ,0x46 ,0x47 ,0x34 ,0x3f ,0x2b ,0x3a ,0x42 ,0x25 ,0x4b ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x22 ,0x24 ,0x2d ,0x24 ,0x58 ,0x29 ,0x23 ,0x29 ,0x2b ,0x5d ,0x24 ,0x5f ,0x37 ,0x9f ,0x26 ,0x32 ,0x30 ,0x78 ,0x2a ,0x70 ,0x43 ,0xa7 ,0x24 ,0x3c ,0x37 ,0xd1 ,0xe1 ,0x8f ,0x2a ,0xbf ,0x23 ,0x25 ,0x2d ,0x26 ,0x42 ,0x2c ,0x24 ,0x26 ,0x4d ,0x3e ,0x8d ,0x25 ,0x48 ,0x25 ,0x7d ,0x30 ,0x73 ,0x47 ,0x70 ,0x24 ,0x48 ,0x24 ,0x36 ,0x2c ,0x6e ,0x25 ,0x42 ,0x41 ,0xa5 ,0x25 ,0x25 ,0x2c ,0x40 ,0x27 ,0x25 ,0x28 ,0x4f ,0x2b ,0x6a ,0x65 ,0x2c ,0x25 ,0x67 ,0x2f ,0x64 ,0x35 ,0x61 ,0x2e ,0x4d ,0x24 ,0x2f ,0x2b ,0x58 ,0x69 ,0x30 ,0x2b ,0x5d ,0x25 ,0x26 ,0x28 ,0x43 ,0x27 ,0x3e ,0x30 ,0x59 ,0x27 ,0x56 ,0x2d ,0x80 ,0x25 ,0x4e ,0x33 ,0x54 ,0x3e ,0x5c ,0x28 ,0x57 ,0x29 ,0x3c ,0x30 ,0x4b ,0x25 ,0x39 ,0x2a ,0x54 ,0x32 ,0x52 ,0x2a ,0x41 ,0x25 ,0x2f ,0x2b ,0x6a ,0x26 ,0x37 ,0x64 ,0x25 ,0x25 ,0x25 ,0x36 ,0x29 ,0x40 ,0x2c ,0x4c ,0x25 ,0x29 ,0x41 ,0x2e ,0x24 ,0x2b ,0x25 ,0x2a ,0x66 ,0x37 ,0x53 ,0x4d ,0x34 ,0x31 ,0x25 ,0x2e ,0x51 ,0x22 ,0x43 ,0x29 ,0x27 ,0x4a ,0x2f ,0x5f ,0x26 ,0x32 ,0x26 ,0x29 ,0x41 ,0x2a ,0x26 ,0x5c ,0x25 ,0x3b ,0x50 ,0x41 ,0x29 ,0x23 ,0x30 ,0x28 ,0x4b ,0x33 ,0x27 ,0x2d ,0x5e ,0x28 ,0x47 ,0x51 ,0x3a ,0x46 ,0x32 ,0x26 ,0x52 ,0x5b ,0x27 ,0x47 ,0x50 ,0x41 ,0x29 ,0x4a ,0x35 ,0x26 ,0x55 ,0x33 ,0x26 ,0x29 ,0x28 ,0x38 ,0x50 ,0x2e ,0x3b ,0x4e ,0x2c ,0x47 ,0x25 ,0x29 ,0x48 ,0x3e ,0x29 ,0x54 ,0x31 ,0x28 ,0x4c ,0x4e ,0x39 ,0x25 ,0x30 ,0x25 ,0x28 ,0x3b ,0x28 ,0x25 ,0x51 ,0x26 ,0x51 ,0x45 ,0x31 ,0x26 ,0x34 ,0x28 ,0x4a ,0x2a ,0x43 ,0x26 ,0x2b ,0x33 ,0x4f ,0x25 ,0x3a ,0x25 ,0x26 ,0x2e ,0x4c ,0x25 ,0x4a ,0x2d ,0x4b ,0x22 ,0x49 ,0x4c ,0x2c ,0x26 ,0x36 ,0x27 ,0x4a ,0x25 ,0x27 ,0x47 ,0x28 ,0x2d ,0x44 ,0x31 ,0x43 ,0x2f ,0x4c ,0x25 ,0x27 ,0x32 ,0x2b ,0x40 ,0x25 ,0x37 ,0x28 ,0x5d ,0x2d ,0x29 ,0x4f ,0x3b ,0x4b ,0x2d ,0x3f ,0x28 ,0x3a ,0x36 ,0x51 ,0x25 ,0x29 ,0x2e ,0x46 ,0x3c ,0x29 ,0x28 ,0x3d ,0x2a ,0x44 ,0x3a ,0x4b ,0x28 ,0x4a ,0x38 ,0x54 ,0x47 ,0x38 ,0x2b ,0x56 ,0x29 ,0x3c ,0x49 ,0x30 ,0x28 ,0x2d ,0x2f ,0x60 ,0x4d ,0x27 ,0x26 ,0x36 ,0x2a ,0x46 ,0x35 ,0x4b ,0x31 ,0x43 ,0x3a ,0x4a ,0x28 ,0x47 ,0x2a ,0x47 ,0x38 ,0x4b ,0x30 ,0x41 ,0x2a ,0x85 ,0x36 ,0x24 ,0x36 ,0x2b ,0x25 ,0x59 ,0x2c ,0x4e ,0x2e ,0x46 ,0x28 ,0x52 ,0x34 ,0x27 ,0x4e ,0x2a ,0x3f ,0x26 ,0x32 ,0x49 ,0x36 ,0x2d ,0x3c ,0x42 ,0x2d ,0x2b ,0x4b ,0x4d ,0x3e ,0x25 ,0x26 ,0x88 ,0x23 ,0x2f ,0x57 ,0x40 ,0x2e ,0x29 ,0x46 ,0x37 ,0x46 ,0x36 ,0x5a ,0x27 ,0x2f ,0x6b ,0x3f ,0x27 ,0x2b ,0x32 ,0x4e ,0x3f ,0x33 ,0x26 ,0x49 ,0x28 ,0x51 ,0x2c ,0x26 ,0x4a ,0x34 ,0x2b ,0x44 ,0x25 ,0x29 ,0x2b ,0x40 ,0x2e ,0x5a ,0x29 ,0x3f ,0x55 ,0x26 ,0x2d ,0x43 ,0x2e ,0x59 ,0x39 ,0x28 ,0x49 ,0x3e ,0x2b ,0x3c ,0x28 ,0x2a ,0x3a ,0x2c ,0x45 ,0x40 ,0x31 ,0x2f ,0x40 ,0x2c ,0x45 ,0x26 ,0x3a ,0x33 ,0x43 ,0x52 ,0x42 ,0x2d ,0x43 ,0x5f ,0x25 ,0x2a ,0x36 ,0x44 ,0x49 ,0x32 ,0x37 ,0x27 ,0x3e ,0x29 ,0x28 ,0x39 ,0x44 ,0x35 ,0x2a ,0x41 ,0x2d ,0x28 ,0x3b ,0x2b ,0x55 ,0x26 ,0x42 ,0x29 ,0x44 ,0x41 ,0x36 ,0x27 ,0x28 ,0x3b ,0x2e ,0x36 ,0x4f ,0x27 ,0x47 ,0x31 ,0x26 ,0x28 ,0x3d ,0x37 ,0x51 ,0x28 ,0x39 ,0x42 ,0x31 ,0x4e ,0x27 ,0x2d ,0x5d ,0x27 ,0x4a ,0x27 ,0x25 ,0x4b ,0x33 ,0x4d ,0x47 ,0x47 ,0x20 ,0x35 ,0x46 ,0x3a ,0x39 ,0x2b ,0x28 ,0x30 ,0x45 ,0x22 ,0x39 ,0x27 ,0x42 ,0x34 ,0x37 ,0x22 ,0x4d ,0x30 ,0x46 ,0x28 ,0x44 ,0x3a ,0x2a ,0x39 ,0x3c ,0x24 ,0x3a ,0x28 ,0x30 ,0x54 ,0x39 ,0x37 ,0x2d ,0x2b ,0x42 ,0x2a ,0x51 ,0x2e ,0x28 ,0x49 ,0x45 ,0x33 ,0x2a ,0x44 ,0x31 ,0x2e ,0x2f ,0x2b ,0x47 ,0x3a ,0x22 ,0x31 ,0x31 ,0x3d ,0x25 ,0x46 ,0x29 ,0x45 ,0x2c ,0x41 ,0x31 ,0x40 ,0x51 ,0x40 ,0x2b ,0x31 ,0x27 ,0x40 ,0x27 ,0x37 ,0x2c ,0x28 ,0x5b ,0x29 ,0x45 ,0x41 ,0x37 ,0x2b ,0x4c ,0x53 ,0x2e ,0x34 ,0x45 ,0x2b ,0x34 ,0x40 ,0x31 ,0x2f ,0x3f ,0x33 ,0x50 ,0x30 ,0x46 ,0x2a ,0x2e ,0x5f ,0x2c ,0x3a ,0x31 ,0x3a ,0x52 ,0x39 ,0x2f ,0x3e ,0x2e ,0x29 ,0x49 ,0x36 ,0x23 ,0x3e ,0x30 ,0x2b ,0x4c ,0x25 ,0x37 ,0x2f ,0x58 ,0x22 ,0x44 ,0x47 ,0x2e ,0x37 ,0x24 ,0x3d ,0x28 ,0x46 ,0x26 ,0x2a ,0x50 ,0x2e ,0x3c ,0x2d ,0x42 ,0x34 ,0x3c ,0x2d ,0x4d ,0x3a ,0x28 ,0x2a ,0x43 ,0x35 ,0x51 ,0x2c ,0x32 ,0x46 ,0x48 ,0x27 ,0x39 ,0x34 ,0x3f ,0x2d ,0x29 ,0x3d ,0x29 ,0x36 ,0x49 ,0x2b ,0x36 ,0x1a ,0x2f ,0x3a ,0x2a ,0x4c ,0x25 ,0x42 ,0x35 ,0x22 ,0x29 ,0x47 ,0x35 ,0x3e ,0x38 ,0x42 ,0x3c ,0x4e ,0x28 ,0x49 ,0x2b ,0x2b ,0x3d ,0x34 ,0x37 ,0x41 ,0x2e ,0x3f ,0x41 ,0x38 ,0x2e ,0x38 ,0x50 ,0x25 ,0x2f ,0x46 ,0x2b ,0x40 ,0x41 ,0x35 ,0x35 ,0x37 ,0x43 ,0x2e ,0x3e ,0x27 ,0x3b ,0x2e ,0x3a ,0x2d ,0x3a ,0x2e ,0x36 ,0x4c ,0x2e ,0x40 ,0x3a ,0x4c ,0x29 ,0x34 ,0x45 ,0x38 ,0x38 ,0x38 ,0x38 ,0x22 ,0x24 ,0x52 ,0x28 ,0x23 ,0x43 ,0x26 ,0x24 ,0x5f ,0xa7 ,0x28 ,0x63 ,0xd2 ,0x26 ,0x86 ,0x42 ,0x25 ,0x96 ,0x38 ,0x27 ,0x40 ,0x30 ,0x99 ,0x76 ,0x2d ,0x23 ,0x3d ,0x23 ,0x23 ,0x28 ,0x49 ,0x29 ,0x26 ,0x23 ,0x47 ,0x7c ,0x3e ,0x71 ,0x47 ,0x26 ,0x23 ,0x39 ,0x86 ,0x42 ,0x2b ,0x23 ,0x25 ,0x87 ,0x25 ,0x34 ,0x62 ,0x28 ,0x23 ,0x23 ,0x28 ,0x46 ,0x2a ,0x26 ,0x23 ,0x57 ,0x27 ,0x60 ,0x3b ,0x26 ,0x3c ,0x23 ,0x38 ,0x6a ,0x2a ,0x26 ,0x68 ,0x26 ,0x3a ,0x2b ,0x32 ,0x73 ,0x2b ,0x56 ,0x28 ,0x52 ,0x27 ,0x55 ,0x2a ,0x24 ,0x30 ,0x25 ,0x2e ,0x52 ,0x23 ,0x26 ,0x40 ,0x26 ,0x25 ,0x4e ,0x33 ,0x51 ,0x2b ,0x45 ,0x24 ,0x29 ,0x50 ,0x25 ,0x31 ,0x25 ,0x2e ,0x4a ,0x23 ,0x26 ,0x3f ,0x26 ,0x26 ,0x46 ,0x2b ,0x4c ,0x47 ,0x29 ,0x63 ,0x24 ,0x37 ,0x24 ,0x25 ,0x3f ,0x2d ,0x24 ,0x25 ,0x32 ,0x27 ,0x27 ,0x47 ,0x30 ,0x4a ,0x2b ,0x5c ,0x23 ,0x42 ,0x43 ,0x26 ,0x24 ,0x28 ,0x42 ,0x2a ,0x24 ,0x26 ,0x36 ,0x28 ,0x24 ,0x42 ,0x30 ,0x26 ,0x2b ,0x75 ,0x25 ,0x5f ,0x26 ,0x27 ,0x4b ,0x37 ,0x56 ,0x22 ,0x37 ,0x2f ,0x48 ,0x25 ,0x43 ,0x23 ,0x36 ,0x4c ,0x24 ,0x24 ,0x38 ,0x28 ,0x3c ,0x7e ,0x46 ,0x26 ,0x27 ,0x3f ,0x23 ,0x3a ,0x26 ,0x3a ,0x25 ,0x2f ,0x50 ,0x3b ,0x29 ,0x32 ,0x50 ,0x25 ,0x25 ,0x2c ,0x52 ,0x31 ,0x51 ,0x44 ,0x33 ,0x27 ,0x3f ,0x25 ,0x3d ,0x2b ,0x26 ,0x2d ,0x55 ,0x2b ,0x25 ,0x27 ,0x32 ,0x26 ,0x27 ,0x42 ,0x28 ,0x36 ,0x84 ,0x2e ,0x29 ,0x67 ,0x29 ,0x44 ,0x87 ,0x2d ,0x2c ,0x4e ,0x4c ,0x26 ,0x32 ,0x47 ,0x27 ,0x41 ,0x30 ,0x44 ,0x24 ,0x33 ,0x26 ,0x29 ,0x3e ,0x2b ,0x2c ,0x47 ,0x41 ,0x2e ,0x34 ,0x25 ,0x49 ,0x2a ,0x33 ,0x48 ,0x29 ,0x3d ,0x2c ,0x21 ,0x3f ,0x28 ,0x26 ,0x26 ,0x3a ,0x2a ,0x28 ,0x46 ,0x28 ,0x29 ,0x29 ,0x3b ,0x49 ,0x3c ,0x26 ,0x26 ,0x41 ,0x6d ,0x31 ,0x23 ,0x23 ,0x36 ,0x26 ,0x24 ,0x3e ,0x25 ,0x25 ,0x39 ,0x53 ,0x29 ,0x44 ,0x29 ,0x3f ,0x21 ,0x27 ,0x44 ,0x26 ,0x67 ,0x31 ,0x25 ,0x5a ,0x43 ,0x35 ,0x45 ,0x2e ,0x22 ,0x25 ,0x4c ,0x27 ,0x40 ,0x2a ,0x26 ,0x40 ,0x53 ,0x37 ,0x29 ,0x27 ,0x2f ,0x43 ,0x27 ,0x3c ,0x46 ,0x2b ,0x2a ,0x41 ,0x38 ,0x35 ,0x24 ,0x28 ,0x40 ,0x2e ,0x2d ,0x46 ,0x31 ,0x24 ,0x4c ,0x33 ,0x29 ,0x2d ,0x3e ,0x44 ,0x37 ,0x24 ,0x3d ,0x43 ,0x22 ,0x32 ,0x3e ,0x28 ,0x66 ,0x23 ,0x4d ,0x2d ,0x29 ,0x3c ,0x2b ,0x26 ,0x5b ,0x24 ,0x22 ,0x35 ,0x2d ,0x3b ,0x46 ,0x22 ,0x41 ,0x29 ,0x2b ,0x28 ,0x3a ,0x2e ,0x4b ,0x44 ,0x37 ,0x33 ,0x41 ,0x2b ,0x2a ,0x2a ,0x40 ,0x39 ,0x2b ,0x3d ,0x42 ,0x2b ,0x40 ,0x26 ,0x37 ,0x26 ,0x45 ,0x32 ,0x23 ,0x25 ,0x53 ,0x3a ,0x47 ,0x29 ,0x2a ,0x3d ,0x24 ,0x29 ,0x2a ,0x49 ,0x2c ,0x29 ,0x39 ,0x45 ,0x45 ,0x29 ,0x33 ,0x26 ,0x2c ,0x4a ,0x2e ,0x45 ,0x31 ,0x3f ,0x2f ,0x5c ,0x15 ,0x35 ,0x43 ,0x33 ,0x23 ,0x29 ,0x3b ,0x3e ,0x34 ,0x2f ,0x6c ,0x30 ,0x53 ,0x26 ,0x28 ,0x44 ,0x33 ,0x2d ,0x3d ,0x2a ,0x3d ,0x1c ,0x30 ,0x27 ,0x2e ,0x3d ,0x42 ,0x26 ,0x26 ,0x2b ,0x24 ,0x42 ,0x27 ,0x38 ,0x45 ,0x2c ,0x3f ,0x39 ,0x28 ,0x43 ,0x34 ,0x2c ,0x27 ,0x3c ,0x40 ,0x2e ,0x2c ,0x3b ,0x36 ,0x4e ,0x2f ,0x42 ,0x2c ,0x29 ,0x2d ,0x3d ,0x29 ,0x39 ,0x23 ,0x30 ,0x2d ,0x44 ,0x23 ,0x38 ,0x23 ,0x28 ,0x42 ,0x27 ,0x2d ,0x42 ,0x35 ,0x20 ,0x34 ,0x25 ,0x31 ,0x3d ,0x2e ,0x41 ,0x3a ,0x33 ,0x2b ,0x3c ,0x29 ,0x78 ,0x4a ,0x2b ,0x29 ,0x2a ,0x43 ,0x3a ,0x2f ,0x1f ,0x37 ,0x28 ,0x38 ,0x41 ,0x36 ,0x27 ,0x2a ,0x44 ,0x4e ,0x32 ,0x2a ,0x3e ,0x2b ,0x2d ,0x46 ,0x25 ,0x2f ,0x47 ,0x31 ,0x40 ,0x22 ,0x34 ,0x26 ,0x3d ,0x2c ,0x1e ,0x37 ,0x2b ,0x41 ,0x26 ,0x4a ,0x3e ,0x2f ,0x2b ,0x3b ,0x2a ,0x38 ,0x27 ,0x2c ,0x40 ,0x4a ,0x31 ,0x27 ,0x41 ,0x29 ,0x37 ,0x26 ,0x33 ,0x3f ,0x3d ,0x3c ,0x28 ,0x3d ,0x31 ,0x22 ,0x42 ,0x1f ,0x57 ,0x38 ,0x29 ,0x29 ,0x3d ,0x34 ,0x38 ,0x25 ,0x2d ,0x43 ,0x3d ,0x20 ,0x31 ,0x2f ,0x4a ,0x38 ,0x38 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x39 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1e ,0x2c ,0xf ,0xb ,0xb ,0x4 ,0x0 ,0x0 ,0x44 ,0x75 ,0x9b ,0xa4 ,0xae ,0x67 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x9 ,0x9b ,0x2c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x31 ,0x8a ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0xa2 ,0x21 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x68 ,0x6a ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0xd8 ,0x1b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x40 ,0x9c ,0x8d ,0xa ,0x0 ,0x0 ,0x0 ,0x15 ,0xba ,0x4e ,0xbb ,0x28 ,0x0 ,0x0 ,0x0 ,0x2 ,0xd ,0x36 ,0xc9 ,0x10 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0xb9 ,0x48 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x6d ,0x9f ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0xd8 ,0x37 ,0x11 ,0xd ,0x1e ,0x32 ,0x0 ,0x8 ,0xb2 ,0xc7 ,0xd7 ,0xb3 ,0xa6 ,0x7c ,0x0 ,0x0 ,0x5 ,0x8 ,0xe ,0x8 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x20 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x36 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x84 ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x9b ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3c ,0x65 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x85 ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0xb1 ,0x10 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x28 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0x32 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x9e ,0xcf ,0x1e ,0x0 ,0x0 ,0x0 ,0x2 ,0x89 ,0xf5 ,0xc3 ,0xc7 ,0x17 ,0x0 ,0x0 ,0x16 ,0xde ,0x5e ,0xa ,0x7c ,0xa1 ,0x2 ,0x0 ,0x2e ,0xac ,0x2 ,0x5 ,0x81 ,0xb7 ,0x4 ,0x0 ,0x41 ,0xb7 ,0x3e ,0x91 ,0xec ,0x3c ,0x0 ,0x0 ,0x17 ,0xc9 ,0xf3 ,0xe1 ,0x61 ,0x3 ,0x0 ,0x0 ,0x0 ,0x10 ,0x3e ,0x1b ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2b ,0x39 ,0x0 ,0x21 ,0x29 ,0x0 ,0x0 ,0x6 ,0x87 ,0x16 ,0x0 ,0x3f ,0x4d ,0x0 ,0x0 ,0x35 ,0x6e ,0x0 ,0x3 ,0x9d ,0x23 ,0x0 ,0x0 ,0x3f ,0x63 ,0x23 ,0x3f ,0xbd ,0x7 ,0x0 ,0x0 ,0x8 ,0x50 ,0x61 ,0x68 ,0xb0 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2f ,0xa5 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x29 ,0x31 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4a ,0x89 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0xb6 ,0x4f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1c ,0xd3 ,0x11 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x59 ,0x9e ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0xa9 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0xc0 ,0x10 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x63 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x3 ,0x0 ,0x0 ,0x2 ,0x0 ,0x0 ,0x6 ,0x88 ,0x26 ,0x0 ,0x4 ,0x71 ,0xc ,0x0 ,0x4a ,0x74 ,0x1 ,0x1 ,0x4f ,0x64 ,0x1 ,0x0 ,0x77 ,0xa6 ,0x65 ,0x7e ,0xbb ,0xb ,0x0 ,0x0 ,0x7 ,0x31 ,0x36 ,0x7b ,0x52 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xad ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x37 ,0x9d ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1f ,0x76 ,0x17 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x70 ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x80 ,0xe4 ,0xa6 ,0xc ,0x0 ,0x0 ,0x0 ,0x6 ,0xa1 ,0x2c ,0xe1 ,0x3d ,0x0 ,0x0 ,0x0 ,0x2 ,0x94 ,0xb8 ,0x8e ,0x81 ,0x1 ,0x0 ,0x0 ,0x0 ,0xc ,0x25 ,0x9 ,0xa3 ,0x1a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x33 ,0x80 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x7b ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x17 ,0x1b ,0x17 ,0x0 ,0x0 ,0x4 ,0x37 ,0xbd ,0xe1 ,0xce ,0x9d ,0x0 ,0x1c ,0x79 ,0x23 ,0x47 ,0x20 ,0xc ,0x7 ,0x5 ,0xa3 ,0x29 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0xd8 ,0xb2 ,0x75 ,0x61 ,0x32 ,0x0 ,0x0 ,0x0 ,0x21 ,0x61 ,0xe2 ,0xdc ,0xd1 ,0x9 ,0x0 ,0x0 ,0x0 ,0x2 ,0x84 ,0xdf ,0x86 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x23 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0x2e ,0x28 ,0x8 ,0x0 ,0x0 ,0x5 ,0x5c ,0xb4 ,0x93 ,0xc0 ,0xac ,0x8 ,0x0 ,0x51 ,0xc9 ,0x4f ,0x4d ,0xb7 ,0xca ,0xb ,0x0 ,0x15 ,0x75 ,0x8c ,0xe9 ,0xbe ,0x20 ,0x0 ,0x0 ,0x0 ,0x2 ,0x72 ,0xd3 ,0x16 ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0xdb ,0x3b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8f ,0x8c ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x16 ,0x31 ,0x1c ,0x2 ,0x0 ,0x0 ,0x1 ,0x7c ,0xb6 ,0x90 ,0xba ,0x5c ,0x0 ,0x0 ,0x7 ,0xa8 ,0x16 ,0x1 ,0x1b ,0xbb ,0x9 ,0x0 ,0x2b ,0x82 ,0x1 ,0x0 ,0x5 ,0xae ,0xc ,0x0 ,0x4f ,0x3f ,0x0 ,0x0 ,0x8 ,0xb2 ,0xc ,0x0 ,0x68 ,0x3f ,0x0 ,0x5 ,0x54 ,0x8a ,0x2 ,0x0 ,0x37 ,0xa9 ,0x93 ,0xb0 ,0xae ,0x11 ,0x0 ,0x0 ,0x2 ,0x36 ,0x4d ,0x36 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0x8d ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x78 ,0x37 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0xaa ,0xb ,0x17 ,0x58 ,0x4d ,0x3 ,0x0 ,0x25 ,0x83 ,0x43 ,0xb4 ,0x5b ,0x9a ,0x18 ,0x0 ,0x3c ,0x7c ,0xaf ,0x20 ,0x2 ,0x79 ,0xc ,0x0 ,0x41 ,0x82 ,0x57 ,0x61 ,0x64 ,0x6a ,0x1 ,0x0 ,0x9 ,0x87 ,0xa3 ,0xad ,0x50 ,0x4 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1d ,0x49 ,0x1e ,0xb ,0x0 ,0x0 ,0x0 ,0x2a ,0xb5 ,0x6d ,0x9b ,0x50 ,0x0 ,0x0 ,0x7 ,0xb4 ,0x2a ,0x1b ,0xb9 ,0x10 ,0x0 ,0x0 ,0x8 ,0xb8 ,0x9b ,0xb5 ,0x86 ,0x1 ,0x0 ,0x0 ,0x0 ,0xe ,0x27 ,0xa3 ,0x34 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x17 ,0xb5 ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x36 ,0x82 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xc ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x12 ,0x9e ,0xd4 ,0xb8 ,0x9 ,0x0 ,0x0 ,0x3 ,0x93 ,0xaf ,0x27 ,0xb0 ,0x49 ,0x0 ,0x0 ,0x14 ,0xd5 ,0x28 ,0x0 ,0x35 ,0x9b ,0x1 ,0x0 ,0x31 ,0xb0 ,0x2 ,0x0 ,0x2b ,0xb7 ,0x4 ,0x0 ,0x30 ,0xb3 ,0x4 ,0x0 ,0x3f ,0x78 ,0x1 ,0x0 ,0x4 ,0x85 ,0x40 ,0x1a ,0x9f ,0x1d ,0x0 ,0x0 ,0x0 ,0x9 ,0x5d ,0x7f ,0x3b ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x2f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x46 ,0xbe ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x40 ,0xc5 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4c ,0xcf ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4c ,0xb3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0xc5 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x90 ,0xab ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2f ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x1d ,0x46 ,0x32 ,0x4 ,0x0 ,0x0 ,0xa ,0xb7 ,0x7d ,0x4b ,0x11 ,0x1 ,0x0 ,0x0 ,0x1 ,0x83 ,0x30 ,0xe ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0xa5 ,0x74 ,0x8c ,0x60 ,0xb ,0x0 ,0x0 ,0x1 ,0x8 ,0x0 ,0x3 ,0x2c ,0x83 ,0x10 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x1 ,0x4c ,0x41 ,0x0 ,0x17 ,0x81 ,0x35 ,0x44 ,0x6e ,0x78 ,0xb ,0x0 ,0x3 ,0x2c ,0x41 ,0x32 ,0x17 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1c ,0x79 ,0x84 ,0x10 ,0x1 ,0x0 ,0x0 ,0xf ,0xa6 ,0x2c ,0x23 ,0x77 ,0x34 ,0x0 ,0x0 ,0x3a ,0x71 ,0x0 ,0x8 ,0xbc ,0x23 ,0x0 ,0x0 ,0x39 ,0x89 ,0x31 ,0x7d ,0xb9 ,0x5 ,0x0 ,0x0 ,0x2 ,0x3e ,0x4f ,0x76 ,0x6e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa3 ,0x3d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0xbe ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x48 ,0x44 ,0x2a ,0x18 ,0x5 ,0x0 ,0x0 ,0xe ,0x74 ,0x7f ,0x9a ,0xc1 ,0xb9 ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xa ,0x7d ,0x68 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0xc3 ,0x34 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x83 ,0x97 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x50 ,0xc4 ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0xd3 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x29 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xae ,0xc7 ,0x9b ,0x16 ,0x0 ,0x0 ,0x0 ,0xc ,0xab ,0x13 ,0x68 ,0xbe ,0x10 ,0x0 ,0x0 ,0x5 ,0x71 ,0x93 ,0xc8 ,0xef ,0x80 ,0x14 ,0x0 ,0x0 ,0x3 ,0x2d ,0x4e ,0x58 ,0x88 ,0xc5 ,0x1f ,0x0 ,0x3 ,0x9a ,0x53 ,0x2 ,0x5 ,0x85 ,0x88 ,0x0 ,0x0 ,0x1d ,0xa9 ,0xa6 ,0xb0 ,0xd0 ,0x4b ,0x0 ,0x0 ,0x0 ,0x6 ,0x1c ,0x27 ,0xf ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x1 ,0x1 ,0x72 ,0x6 ,0x0 ,0x0 ,0x0 ,0x5f ,0x19 ,0x6 ,0x89 ,0x3 ,0x0 ,0x0 ,0x4 ,0x8d ,0x12 ,0x22 ,0x7e ,0x0 ,0x0 ,0x0 ,0xf ,0xbe ,0x83 ,0xa4 ,0xac ,0x5 ,0x0 ,0x0 ,0x1 ,0xd ,0x2 ,0x65 ,0x3e ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x77 ,0x1f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x53 ,0x10 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x58 ,0x58 ,0x13 ,0x0 ,0x0 ,0x0 ,0x1a ,0xae ,0xd7 ,0xf7 ,0x86 ,0x0 ,0x0 ,0x7 ,0xbc ,0xc7 ,0xd0 ,0xe2 ,0x1e ,0x0 ,0x0 ,0x4 ,0x5d ,0x48 ,0x9a ,0x63 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3c ,0xb5 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0xbd ,0x36 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x62 ,0xa4 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x52 ,0x89 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0xb7 ,0x24 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x50 ,0x6e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x98 ,0x5c ,0x49 ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9a ,0x9b ,0x5c ,0xb9 ,0x1c ,0x0 ,0x0 ,0x0 ,0x60 ,0x5a ,0xf ,0xad ,0x27 ,0x0 ,0x0 ,0x0 ,0x9 ,0x91 ,0xae ,0x5d ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x60 ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x95 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2a ,0x80 ,0x0 ,0x26 ,0x6b ,0x28 ,0x0 ,0x0 ,0x36 ,0x6a ,0x6 ,0xa0 ,0x49 ,0x91 ,0x2 ,0x0 ,0x1a ,0x9a ,0x35 ,0x79 ,0x17 ,0x88 ,0x2 ,0x0 ,0x2 ,0x6b ,0xc6 ,0x9e ,0x99 ,0x25 ,0x0 ,0x0 ,0x0 ,0x1 ,0x33 ,0xc4 ,0x3a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xc ,0xe ,0x6 ,0x0 ,0x0 ,0x2 ,0x4a ,0x8f ,0x8a ,0x6c ,0x5a ,0x0 ,0x0 ,0x10 ,0xab ,0x15 ,0x2 ,0x4 ,0x4 ,0x0 ,0x0 ,0x36 ,0x70 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x50 ,0xa4 ,0x98 ,0x3c ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0xa ,0x3c ,0xa4 ,0x5 ,0x0 ,0x0 ,0x4 ,0x4a ,0x88 ,0x9c ,0x21 ,0x0 ,0x0 ,0x0 ,0x19 ,0x89 ,0x3c ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x20 ,0x44 ,0xb ,0x9 ,0x0 ,0x0 ,0x0 ,0x1 ,0x5e ,0xd ,0x25 ,0x3a ,0x0 ,0x0 ,0x0 ,0x19 ,0x65 ,0x1 ,0x44 ,0x3a ,0x0 ,0x0 ,0x0 ,0x30 ,0x6d ,0x38 ,0x5a ,0x69 ,0xe ,0x0 ,0x0 ,0x0 ,0x8 ,0x10 ,0x4b ,0x4b ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1d ,0x49 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x51 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x2c ,0x21 ,0x5 ,0x0 ,0x0 ,0x1 ,0x35 ,0x36 ,0xde ,0xf1 ,0x92 ,0x3 ,0x0 ,0x42 ,0xe8 ,0xa2 ,0x51 ,0xa0 ,0xe1 ,0x22 ,0x8 ,0xce ,0xf9 ,0x65 ,0x1 ,0x9 ,0xc8 ,0x64 ,0xe ,0xee ,0xb5 ,0xe ,0x24 ,0x92 ,0xec ,0x3f ,0xa ,0xd7 ,0xe6 ,0xc8 ,0xf0 ,0xf5 ,0x8e ,0x4 ,0x1 ,0x5c ,0xef ,0xf8 ,0xdd ,0x63 ,0x5 ,0x0 ,0x0 ,0x2 ,0x2d ,0x38 ,0x13 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0xe ,0x6 ,0x0 ,0x0 ,0x4 ,0x4a ,0x63 ,0x85 ,0x8d ,0x84 ,0x1 ,0x0 ,0x19 ,0x69 ,0x1a ,0x2 ,0xe ,0xb6 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0xa3 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x84 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3c ,0x61 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x71 ,0x21 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x8b ,0x7 ,0x36 ,0x23 ,0x0 ,0x0 ,0x0 ,0x4b ,0x88 ,0x2 ,0x7d ,0x2d ,0x0 ,0x0 ,0x19 ,0xbb ,0x1d ,0x4 ,0xa3 ,0x11 ,0x0 ,0x0 ,0x40 ,0xd9 ,0xb9 ,0x9b ,0xc5 ,0x9 ,0x0 ,0x0 ,0x2 ,0xb ,0x21 ,0x55 ,0x96 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5c ,0x6c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x34 ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xe ,0xd ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x45 ,0xe8 ,0xe5 ,0xac ,0xa ,0x0 ,0x0 ,0x0 ,0x19 ,0xb5 ,0x64 ,0xea ,0x43 ,0x0 ,0x0 ,0x1 ,0x7a ,0x4c ,0x2 ,0x98 ,0x80 ,0x0 ,0x0 ,0xf ,0xb5 ,0x9 ,0x0 ,0x6f ,0x85 ,0x0 ,0x0 ,0x13 ,0xc9 ,0x12 ,0x6 ,0x76 ,0x4f ,0x0 ,0x0 ,0xb ,0xd2 ,0xcd ,0xc5 ,0xab ,0xb ,0x0 ,0x0 ,0x0 ,0x2d ,0x93 ,0x5c ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x31 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0xb4 ,0xf ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7e ,0x40 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8b ,0x57 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3b ,0x98 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0xa5 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x31 ,0xbd ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0x32 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x16 ,0x90 ,0xac ,0x89 ,0xa ,0x0 ,0x0 ,0x0 ,0x1d ,0x5b ,0x5f ,0xdf ,0x21 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0xd0 ,0xbb ,0x20 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2d ,0x83 ,0xca ,0x11 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x47 ,0xbb ,0xc ,0x0 ,0x0 ,0x0 ,0x2b ,0x85 ,0xaf ,0x1f ,0x0 ,0x0 ,0x0 ,0x7 ,0xb8 ,0x71 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7c ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5b ,0x50 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2f ,0x95 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0xac ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xaf ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0xac ,0xf ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x52 ,0x19 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0xe ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x33 ,0xca ,0xbc ,0x7b ,0x2 ,0x0 ,0x0 ,0x0 ,0x13 ,0x1c ,0x34 ,0xa9 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x47 ,0xdb ,0x80 ,0x7 ,0x0 ,0x0 ,0x0 ,0x1 ,0x72 ,0x7a ,0x9f ,0x9f ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x9f ,0x49 ,0x0 ,0x0 ,0x0 ,0x4 ,0x21 ,0x65 ,0xd0 ,0x4e ,0x0 ,0x0 ,0x0 ,0x42 ,0xb1 ,0x8c ,0x2d ,0x2 ,0x0 ,0x0 ,0x0 ,0x4 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2e ,0x64 ,0x0 ,0x0 ,0xd ,0x5d ,0x0 ,0x0 ,0x5c ,0x72 ,0x0 ,0x0 ,0x3c ,0x73 ,0x0 ,0x10 ,0xbe ,0x22 ,0x0 ,0x1 ,0x86 ,0x34 ,0x1 ,0x6d ,0x91 ,0x11 ,0x10 ,0xc ,0xaa ,0x16 ,0x9 ,0xcd ,0xc7 ,0xbb ,0x9e ,0x91 ,0xa7 ,0x5 ,0x0 ,0x14 ,0xf ,0x8 ,0x2 ,0x14 ,0x2e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x21 ,0x68 ,0x48 ,0x50 ,0x87 ,0x82 ,0x3 ,0x0 ,0x2 ,0x3b ,0x61 ,0x5d ,0xcb ,0x94 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2d ,0xd6 ,0x2e ,0x0 ,0x0 ,0x0 ,0x0 ,0x1e ,0xcd ,0x77 ,0x2 ,0x0 ,0x0 ,0x0 ,0xa ,0xb6 ,0xb0 ,0xe ,0x0 ,0x0 ,0x0 ,0x4 ,0x83 ,0xcc ,0x13 ,0x0 ,0x0 ,0x0 ,0x0 ,0x17 ,0xe0 ,0x58 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x1b ,0x43 ,0x48 ,0x10 ,0x0 ,0x0 ,0x4 ,0x66 ,0xb2 ,0x65 ,0x62 ,0xae ,0x5 ,0x0 ,0x52 ,0x69 ,0xb ,0x0 ,0xc ,0xa1 ,0x5 ,0x0 ,0xb ,0x3 ,0x0 ,0x1 ,0x56 ,0x69 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x47 ,0x9a ,0x9 ,0x0 ,0x0 ,0x14 ,0x57 ,0x8e ,0xc0 ,0x24 ,0x13 ,0x7 ,0xf ,0xcc ,0xe4 ,0x7a ,0x76 ,0xbe ,0x5a ,0x6 ,0x3 ,0x2d ,0x18 ,0x1 ,0x1 ,0x9 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0x29 ,0x42 ,0x46 ,0x2a ,0x1 ,0x0 ,0x1a ,0xc5 ,0xa4 ,0x4b ,0x47 ,0xb0 ,0x19 ,0x0 ,0x50 ,0x41 ,0x4 ,0x0 ,0xc ,0xae ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x53 ,0x61 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0xc5 ,0x9c ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0x52 ,0xb0 ,0x1e ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2a ,0x79 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x88 ,0x34 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x86 ,0x6f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5a ,0xa1 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x42 ,0xb3 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3d ,0xb2 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0xaf ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0x6d ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xf ,0x34 ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3c ,0xa5 ,0xc8 ,0xa ,0x0 ,0x0 ,0x0 ,0xa ,0x40 ,0x12 ,0x8c ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2f ,0x48 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x78 ,0xe ,0x1 ,0x15 ,0x16 ,0x0 ,0x0 ,0x48 ,0x50 ,0x21 ,0x73 ,0x7f ,0x13 ,0x0 ,0x8 ,0xae ,0x9d ,0x81 ,0x25 ,0x3 ,0x0 ,0x0 ,0x7 ,0x43 ,0x1e ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x26 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0xdc ,0x2a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x45 ,0xe8 ,0x1d ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x9b ,0xc6 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0xbc ,0x92 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xad ,0x72 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa4 ,0x94 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x27 ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2c ,0x38 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x12 ,0x4d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x5d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1d ,0x52 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x35 ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x46 ,0x22 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1e ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x27 ,0x46 ,0x10 ,0x0 ,0x0 ,0x0 ,0x31 ,0xac ,0x93 ,0x7d ,0x6d ,0x0 ,0x0 ,0x0 ,0xd ,0x13 ,0x1 ,0x27 ,0x72 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x7c ,0x3e ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0xc4 ,0xae ,0x2b ,0x0 ,0x0 ,0x0 ,0x0 ,0x48 ,0x40 ,0x6 ,0x2 ,0x0 ,0x0 ,0x0 ,0x8 ,0x7c ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x78 ,0x6 ,0x4 ,0x7a ,0xc ,0x0 ,0x0 ,0x13 ,0xb1 ,0x5 ,0x27 ,0xd2 ,0xf ,0x0 ,0x0 ,0x2b ,0xac ,0x13 ,0xc0 ,0xb1 ,0x3 ,0x0 ,0x0 ,0x11 ,0xa9 ,0xad ,0xf3 ,0x65 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0x33 ,0xce ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0xb2 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0xa1 ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1c ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x63 ,0x43 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x6a ,0x1e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x31 ,0x6f ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0xad ,0x57 ,0x59 ,0x6e ,0x36 ,0x3 ,0x71 ,0xb8 ,0x7a ,0x2e ,0xf ,0x10 ,0x2d ,0x6 ,0x62 ,0x18 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x18 ,0x42 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x83 ,0xbf ,0x35 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x60 ,0x56 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa4 ,0x79 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x36 ,0xa5 ,0x88 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0x8c ,0x8e ,0x1 ,0x0 ,0x0 ,0x0 ,0x20 ,0xd3 ,0x81 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x37 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x6 ,0x3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x2 ,0x8a ,0x88 ,0x85 ,0x42 ,0x0 ,0x0 ,0x0 ,0x4 ,0x8e ,0xa ,0x6 ,0xb ,0x0 ,0x0 ,0x0 ,0x19 ,0xcc ,0x85 ,0x2f ,0x0 ,0x0 ,0x0 ,0x0 ,0x5b ,0x48 ,0x16 ,0x97 ,0x5 ,0x0 ,0x0 ,0x6 ,0x4e ,0x1 ,0x10 ,0xa3 ,0x5 ,0x0 ,0x0 ,0xc ,0x75 ,0x29 ,0x87 ,0x48 ,0x0 ,0x0 ,0x0 ,0x1 ,0x4e ,0x75 ,0x24 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3c ,0xd3 ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0xd7 ,0x61 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x79 ,0xc4 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x30 ,0xec ,0x2f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0xce ,0x95 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7b ,0xd1 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xf ,0x36 ,0x1 ,0x0 ,0x0 ,0x0 ,0x52 ,0x68 ,0x65 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x1 ,0x46 ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0x6a ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x4 ,0x1b ,0x65 ,0x0 ,0x0 ,0x0 ,0x4 ,0x66 ,0x7b ,0x82 ,0x25 ,0x0 ,0x0 ,0x0 ,0x17 ,0x61 ,0x3b ,0xa6 ,0x4c ,0x6 ,0x0 ,0x0 ,0x5 ,0x63 ,0x4b ,0xb ,0x37 ,0x58 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x33 ,0x51 ,0x4 ,0x65 ,0x38 ,0x0 ,0x0 ,0x10 ,0xd2 ,0x87 ,0x1c ,0xee ,0x71 ,0x0 ,0x0 ,0x5d ,0xfa ,0xa3 ,0xc2 ,0xf5 ,0x3c ,0x0 ,0x0 ,0x5e ,0xe1 ,0xeb ,0xf7 ,0xdd ,0xc ,0x0 ,0x0 ,0x8 ,0xc ,0xf ,0x9d ,0xcb ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x12 ,0xdd ,0xc5 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x18 ,0xe8 ,0x6c ,0x1 ,0x0 ,0x0 ,0x2 ,0x3 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x3c ,0x43 ,0x0 ,0x2 ,0x69 ,0x5 ,0x0 ,0x0 ,0x4b ,0x6b ,0x0 ,0x3 ,0xae ,0x1b ,0x0 ,0x0 ,0x4b ,0x6d ,0x0 ,0x7 ,0xbd ,0x77 ,0x5 ,0x0 ,0x35 ,0xb9 ,0x63 ,0x9a ,0xe6 ,0x2a ,0x0 ,0x0 ,0x3 ,0x46 ,0x5b ,0x3f ,0xc4 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0xba ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x5b ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0x7a ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xa2 ,0x4a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0x70 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x21 ,0x9e ,0x13 ,0xf ,0x0 ,0x0 ,0x0 ,0x0 ,0x6a ,0x5c ,0x5f ,0xc8 ,0xf ,0x0 ,0x0 ,0x0 ,0x91 ,0x44 ,0x21 ,0xc2 ,0x9 ,0x0 ,0x0 ,0x0 ,0x33 ,0xab ,0xb5 ,0x4c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x17 ,0x6c ,0x9d ,0x9f ,0x86 ,0x20 ,0x0 ,0x0 ,0x23 ,0x90 ,0x88 ,0x60 ,0xd7 ,0x8a ,0x0 ,0x0 ,0x0 ,0xc ,0x66 ,0xb7 ,0xf7 ,0x9e ,0x1e ,0x0 ,0x0 ,0x20 ,0xb2 ,0x75 ,0x4e ,0x8c ,0xda ,0x22 ,0x0 ,0x2 ,0x3d ,0xe ,0x7 ,0x18 ,0xc8 ,0x38 ,0x0 ,0x2 ,0x83 ,0xbd ,0xc3 ,0xcc ,0x88 ,0x7 ,0x0 ,0x0 ,0x2 ,0xe ,0x23 ,0x16 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x0 ,0x0 ,0x0 ,0xc ,0x12 ,0x42 ,0x78 ,0x60 ,0x0 ,0x0 ,0x21 ,0xc7 ,0xaa ,0x53 ,0x14 ,0x2 ,0x0 ,0x6 ,0xaa ,0x54 ,0xf ,0x1 ,0x0 ,0x0 ,0x0 ,0x27 ,0xd2 ,0x8d ,0x94 ,0x67 ,0x2 ,0x0 ,0x0 ,0x6 ,0x1f ,0x5 ,0x14 ,0xba ,0xc ,0x0 ,0x0 ,0xe ,0x22 ,0x4e ,0xa6 ,0x63 ,0x1 ,0x0 ,0x0 ,0x31 ,0x59 ,0x45 ,0x17 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x29 ,0x19 ,0x0 ,0x0 ,0x0 ,0x5 ,0x60 ,0x68 ,0x3c ,0x7 ,0x0 ,0x0 ,0x0 ,0x19 ,0x5e ,0x8 ,0x3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x26 ,0x7d ,0x74 ,0x75 ,0x6d ,0x10 ,0x0 ,0x0 ,0x6 ,0x36 ,0xd ,0x3 ,0x1a ,0x78 ,0x1 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x7 ,0x82 ,0x2 ,0x0 ,0x0 ,0x4f ,0x1c ,0x25 ,0x6c ,0x43 ,0x0 ,0x0 ,0x0 ,0x12 ,0x3c ,0x3c ,0x18 ,0x0 ,0x0 ,0x0 ,0x1 ,0x53 ,0x30 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0xc3 ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xa6 ,0x64 ,0x0 ,0xc ,0x1a ,0x16 ,0x4 ,0x1 ,0xae ,0x42 ,0x16 ,0xbf ,0x8d ,0x8d ,0xa5 ,0x1 ,0xab ,0x4f ,0x36 ,0xc2 ,0xc ,0xa ,0xbf ,0x0 ,0x46 ,0xce ,0x2a ,0x76 ,0x96 ,0x44 ,0xa2 ,0x0 ,0x3 ,0x58 ,0xa6 ,0xa2 ,0xa1 ,0x60 ,0xc ,0x0 ,0x0 ,0x0 ,0x3 ,0x8 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xb ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x8c ,0xba ,0x7a ,0x3 ,0x0 ,0x0 ,0x0 ,0x2e ,0xe7 ,0x2d ,0x9b ,0x26 ,0x0 ,0x0 ,0x0 ,0x50 ,0xb7 ,0x4 ,0x66 ,0x4a ,0x0 ,0x0 ,0x0 ,0x9b ,0x7c ,0x0 ,0x63 ,0x4a ,0x0 ,0x0 ,0x1 ,0xa8 ,0x2a ,0x1 ,0x85 ,0x24 ,0x0 ,0x0 ,0x0 ,0x82 ,0x6a ,0x6e ,0x8a ,0x5 ,0x0 ,0x0 ,0x0 ,0x13 ,0x9b ,0x74 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0xbd ,0x10 ,0x0 ,0xc ,0x7a ,0x5 ,0x0 ,0x22 ,0xcc ,0xa ,0x0 ,0x43 ,0xb4 ,0x4 ,0x0 ,0x47 ,0xba ,0xc ,0x7 ,0x7f ,0x54 ,0x0 ,0x0 ,0x64 ,0xe2 ,0xc6 ,0xb6 ,0xe7 ,0x30 ,0x0 ,0x0 ,0xc ,0x32 ,0x1b ,0x3a ,0xc9 ,0xc ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x65 ,0xc0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0x61 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x89 ,0x35 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa7 ,0x1d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0xad ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x35 ,0x57 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x82 ,0x2a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x8a ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x5a ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0x2e ,0x2b ,0x1 ,0x0 ,0x0 ,0x4 ,0x5c ,0xb2 ,0x90 ,0xb9 ,0x1c ,0x0 ,0x0 ,0x5d ,0x94 ,0x14 ,0x18 ,0xb5 ,0x5d ,0x0 ,0x0 ,0x59 ,0xbe ,0xa7 ,0xba ,0xe9 ,0x27 ,0x0 ,0x0 ,0x2 ,0x19 ,0x12 ,0x41 ,0x96 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x8e ,0x40 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0xc2 ,0x10 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xa ,0x2b ,0x44 ,0x0 ,0x0 ,0xb ,0x46 ,0x7c ,0x92 ,0x43 ,0xb ,0x0 ,0x1 ,0x3b ,0x5a ,0x23 ,0x6 ,0x0 ,0x0 ,0x0 ,0x2 ,0x87 ,0x37 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0x7f ,0xc ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x7b ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x39 ,0x56 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x36 ,0x2e ,0x14 ,0xc ,0x4 ,0x0 ,0x0 ,0x0 ,0x98 ,0xc5 ,0xcd ,0xd9 ,0xb5 ,0x38 ,0x2 ,0x0 ,0x2 ,0x7 ,0xa ,0x15 ,0x76 ,0xea ,0x29 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0xd2 ,0x61 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xd3 ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x46 ,0xd8 ,0xf ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xbb ,0x8b ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x76 ,0xab ,0x93 ,0x62 ,0x8 ,0x0 ,0x0 ,0x70 ,0x9f ,0x2b ,0x26 ,0xad ,0x3c ,0x0 ,0x0 ,0x3c ,0xa0 ,0x1e ,0x84 ,0xba ,0x18 ,0x0 ,0x9 ,0x39 ,0xc5 ,0xda ,0x50 ,0xa ,0x0 ,0x22 ,0xc6 ,0xb2 ,0x81 ,0xdf ,0x15 ,0x0 ,0x0 ,0x4 ,0x52 ,0x90 ,0x99 ,0x4b ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2f ,0x6c ,0x6c ,0x2f ,0x0 ,0x0 ,0x0 ,0x1 ,0x76 ,0xf ,0xe ,0x18 ,0x0 ,0x0 ,0x0 ,0x1 ,0x7e ,0x15 ,0x21 ,0x16 ,0x0 ,0x0 ,0x0 ,0x0 ,0x42 ,0x51 ,0x7b ,0x1e ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x5b ,0x8d ,0x1c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x74 ,0x18 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x67 ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x72 ,0x21 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x72 ,0xbf ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x1b ,0xb7 ,0xd ,0x0 ,0x0 ,0x0 ,0x27 ,0x37 ,0x52 ,0xb7 ,0xb ,0x0 ,0x0 ,0x0 ,0x34 ,0x96 ,0xd1 ,0x21 ,0x0 ,0x0 ,0x0 ,0x2c ,0x11 ,0x1e ,0xbc ,0x17 ,0x0 ,0x0 ,0x1 ,0x92 ,0xa6 ,0x9f ,0x54 ,0x3 ,0x0 ,0x0 ,0x0 ,0x8 ,0xd ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0x43 ,0x3f ,0x31 ,0x29 ,0x28 ,0x1b ,0x1 ,0xe ,0x6c ,0x75 ,0x84 ,0xa4 ,0xc3 ,0xd8 ,0x12 ,0x0 ,0x0 ,0x14 ,0x1a ,0x19 ,0xb1 ,0x58 ,0x1 ,0x0 ,0x1 ,0x74 ,0xd2 ,0xe3 ,0xe9 ,0x9b ,0x11 ,0x0 ,0x0 ,0x7 ,0x98 ,0x8a ,0x25 ,0x1c ,0x3 ,0x0 ,0x0 ,0x50 ,0x95 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x24 ,0xc5 ,0x1b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0x39 ,0x28 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x82 ,0x3f ,0x31 ,0x0 ,0x0 ,0x0 ,0x0 ,0x18 ,0xb2 ,0x52 ,0x3b ,0x0 ,0x0 ,0x0 ,0x0 ,0x3c ,0x97 ,0x86 ,0x30 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x2 ,0x58 ,0x2f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x72 ,0x1d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x45 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x8c ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x59 ,0x3c ,0x0 ,0x9 ,0x9 ,0x0 ,0x0 ,0x9 ,0x79 ,0x3 ,0x24 ,0xa9 ,0xa0 ,0x3 ,0x0 ,0x2c ,0x3d ,0x5 ,0x99 ,0x2a ,0x84 ,0x1 ,0x0 ,0x3b ,0x33 ,0x17 ,0x88 ,0x4a ,0x53 ,0x0 ,0x0 ,0x25 ,0x77 ,0x30 ,0xa9 ,0x99 ,0xc ,0x0 ,0x0 ,0x2 ,0x51 ,0x90 ,0x8e ,0x31 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x1 ,0x0 ,0x0 ,0x3 ,0x0 ,0x0 ,0x30 ,0xa3 ,0xf ,0x0 ,0x24 ,0x60 ,0x2 ,0x4 ,0x89 ,0x41 ,0x0 ,0x14 ,0xa6 ,0xd ,0x0 ,0x17 ,0xb2 ,0x8 ,0x0 ,0x17 ,0xd3 ,0x77 ,0x52 ,0x95 ,0x8c ,0x1 ,0x0 ,0x0 ,0x27 ,0x71 ,0x51 ,0x83 ,0x56 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x87 ,0x4b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xb ,0xa ,0x1 ,0x0 ,0x0 ,0x0 ,0x19 ,0xb7 ,0xd3 ,0xda ,0x69 ,0x1 ,0x0 ,0x0 ,0x8 ,0x2d ,0x3c ,0xac ,0xc9 ,0x6 ,0x0 ,0x0 ,0x0 ,0x37 ,0xe4 ,0xf6 ,0x5c ,0x0 ,0x0 ,0x0 ,0x0 ,0x78 ,0xd1 ,0xeb ,0x93 ,0x3 ,0x0 ,0x0 ,0x0 ,0x6 ,0x15 ,0x62 ,0xe8 ,0xd ,0x0 ,0x0 ,0x0 ,0x4f ,0xcf ,0xe4 ,0xa9 ,0x3 ,0x0 ,0x0 ,0x0 ,0x1c ,0xb3 ,0x8c ,0x11 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0x93 ,0x70 ,0x69 ,0x33 ,0x1 ,0x0 ,0x23 ,0xb5 ,0x8b ,0x60 ,0x35 ,0x8b ,0x3e ,0x5 ,0xa9 ,0x36 ,0x1 ,0x0 ,0x0 ,0x23 ,0xb2 ,0xe ,0xb4 ,0x5 ,0x0 ,0x0 ,0x0 ,0x3a ,0x9b ,0x9 ,0xb6 ,0x4c ,0x26 ,0x35 ,0x77 ,0xaa ,0x24 ,0x0 ,0x1b ,0x7d ,0x92 ,0x88 ,0x54 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0xe ,0xf ,0x11 ,0xb ,0x1 ,0x0 ,0x0 ,0x9c ,0xa3 ,0xab ,0xb9 ,0xc5 ,0x99 ,0x38 ,0x0 ,0x1 ,0x1 ,0x3 ,0x7 ,0x13 ,0x83 ,0xa1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xa8 ,0x42 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x8f ,0x77 ,0x3 ,0x0 ,0x0 ,0x0 ,0x1 ,0x5c ,0x9f ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x24 ,0xc2 ,0x1a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x3f ,0x42 ,0xc ,0x1 ,0x0 ,0x0 ,0x0 ,0x50 ,0xeb ,0xc6 ,0xd3 ,0x66 ,0x1 ,0x0 ,0x2c ,0xde ,0x68 ,0x8 ,0x5a ,0xde ,0x19 ,0x0 ,0x7f ,0xbc ,0xa ,0x0 ,0xa ,0xd1 ,0x33 ,0x0 ,0x97 ,0x7b ,0x0 ,0x0 ,0xc ,0xd6 ,0x3f ,0x0 ,0x76 ,0x96 ,0x8 ,0x10 ,0x78 ,0xe3 ,0x1f ,0x0 ,0x2a ,0xe0 ,0xc6 ,0xcf ,0xd1 ,0x4c ,0x0 ,0x0 ,0x1 ,0x29 ,0x30 ,0x1f ,0x9 ,0x1 ,0x0 ,0x0 ,0x9 ,0x42 ,0x4a ,0x45 ,0x15 ,0x0 ,0x0 ,0x0 ,0x40 ,0xcc ,0x5f ,0x47 ,0x95 ,0x19 ,0x0 ,0x0 ,0x2 ,0x8 ,0x0 ,0x0 ,0x2f ,0x79 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2a ,0x7b ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x1 ,0x75 ,0x36 ,0x0 ,0x0 ,0x4b ,0x9c ,0x7c ,0x58 ,0x9d ,0x5 ,0x0 ,0x2 ,0x9a ,0x65 ,0xa8 ,0xcb ,0x8a ,0x5 ,0x0 ,0x0 ,0xf ,0x47 ,0x3e ,0xb ,0x39 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x51 ,0xa6 ,0x9a ,0xb ,0x0 ,0x0 ,0x0 ,0x22 ,0xe3 ,0x7e ,0xe1 ,0x34 ,0x0 ,0x0 ,0x0 ,0xe ,0xb5 ,0xd6 ,0xea ,0x1e ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0xef ,0x72 ,0x2 ,0x0 ,0x0 ,0x0 ,0x35 ,0xdd ,0x63 ,0x5 ,0x0 ,0x0 ,0x0 ,0x13 ,0xd3 ,0xa3 ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0xd9 ,0x1b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x58 ,0x7d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x89 ,0x8b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x82 ,0x94 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5e ,0xb5 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5d ,0xa0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x88 ,0x66 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5d ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x0 ,0x1 ,0x4 ,0x31 ,0x5 ,0x0 ,0x1f ,0x94 ,0x70 ,0x9f ,0xb5 ,0xbc ,0xa ,0x0 ,0x2 ,0xf ,0x17 ,0x23 ,0xac ,0x38 ,0x0 ,0x0 ,0x0 ,0x0 ,0x28 ,0x7a ,0xdf ,0x80 ,0x38 ,0x0 ,0x0 ,0x0 ,0xf ,0x54 ,0xbf ,0x32 ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0x96 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4b ,0x73 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1d ,0x3e ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x19 ,0x7f ,0x93 ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x15 ,0x7f ,0x19 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0xb1 ,0x82 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x40 ,0x56 ,0x78 ,0x3 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x5 ,0x8d ,0xa ,0x0 ,0x0 ,0xb ,0x57 ,0x1a ,0x81 ,0x7b ,0x1 ,0x0 ,0x0 ,0x4 ,0x3f ,0x3f ,0x3c ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0xf ,0x2d ,0x1e ,0x2 ,0x0 ,0x0 ,0x2 ,0x63 ,0x89 ,0x51 ,0x7d ,0x74 ,0x1 ,0x0 ,0xb ,0x91 ,0x8 ,0x0 ,0x13 ,0xa1 ,0x3 ,0x0 ,0x0 ,0x3 ,0x0 ,0x4 ,0x6c ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x81 ,0x5c ,0xf ,0xb ,0x10 ,0x0 ,0x0 ,0x37 ,0x72 ,0x5e ,0x6e ,0x72 ,0x79 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x1 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x5e ,0x66 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x5a ,0x8b ,0x9b ,0x6 ,0x0 ,0x0 ,0x0 ,0x41 ,0xbc ,0xb0 ,0xb2 ,0x5 ,0x0 ,0x0 ,0x0 ,0x1c ,0x7f ,0xbe ,0x1d ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x88 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xf ,0xb4 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x19 ,0xd4 ,0x3c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xb ,0x11 ,0x3c ,0x4c ,0x2a ,0x0 ,0x2 ,0x80 ,0xe0 ,0xea ,0xf5 ,0xfc ,0xb4 ,0x3 ,0x1 ,0x5a ,0x81 ,0x6f ,0x6b ,0xf5 ,0x94 ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0xd2 ,0xe0 ,0x21 ,0x0 ,0x0 ,0x0 ,0x16 ,0xc1 ,0xe5 ,0x2e ,0x0 ,0x0 ,0x0 ,0xe ,0xb5 ,0xef ,0x40 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0xec ,0xa0 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x21 ,0x13 ,0x24 ,0x9 ,0x0 ,0x0 ,0x0 ,0x2 ,0xae ,0xc5 ,0xe3 ,0x4e ,0x0 ,0x0 ,0x0 ,0x6 ,0xbd ,0x1e ,0x58 ,0x6a ,0x0 ,0x0 ,0x0 ,0x4 ,0x8a ,0x10 ,0x46 ,0x84 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x0 ,0x46 ,0x84 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x46 ,0x8d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x47 ,0xad ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x6a ,0x2d ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0xab ,0xc5 ,0x2b ,0x0 ,0x0 ,0x0 ,0x0 ,0x59 ,0xaa ,0xe ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xa4 ,0x2c ,0x9 ,0x31 ,0x5 ,0x0 ,0x0 ,0x2 ,0x92 ,0xf ,0x9b ,0xdf ,0x3b ,0x0 ,0x0 ,0x0 ,0x8a ,0x5b ,0xcd ,0x8e ,0x30 ,0x0 ,0x0 ,0x0 ,0x19 ,0xb2 ,0xd6 ,0x81 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xa ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x3a ,0x6d ,0x75 ,0x3 ,0x0 ,0x0 ,0x6 ,0xa8 ,0xb7 ,0x76 ,0xd1 ,0x1a ,0x0 ,0x0 ,0x0 ,0xe ,0x5 ,0x5 ,0xba ,0x24 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0xd0 ,0x11 ,0x0 ,0x0 ,0x3 ,0x39 ,0x4c ,0xa6 ,0x9c ,0x1 ,0x0 ,0x0 ,0x54 ,0xf5 ,0xfa ,0xdb ,0xc9 ,0x3c ,0x1 ,0x0 ,0x73 ,0xe5 ,0x76 ,0x10 ,0x2e ,0x85 ,0x18 ,0x0 ,0x4 ,0xc ,0x1 ,0x0 ,0x0 ,0x3 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x28 ,0x13 ,0xd ,0x8 ,0x0 ,0x0 ,0x0 ,0xa ,0xba ,0x92 ,0x98 ,0xb0 ,0x6 ,0x0 ,0x0 ,0x40 ,0x5f ,0x1 ,0x27 ,0xb2 ,0x3 ,0x0 ,0x0 ,0xd ,0x7 ,0x0 ,0x3f ,0x87 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0x65 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7e ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x9e ,0x38 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3 ,0x8 ,0x0 ,0x0 ,0x0 ,0x8 ,0x2d ,0x6b ,0x46 ,0xc4 ,0x1d ,0x0 ,0x12 ,0xac ,0x73 ,0x3e ,0xa6 ,0x48 ,0x3 ,0x0 ,0x5b ,0x9c ,0x30 ,0xad ,0x25 ,0x0 ,0x0 ,0x0 ,0x10 ,0x74 ,0xe4 ,0x9e ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0xaf ,0x15 ,0x88 ,0x1e ,0x0 ,0x0 ,0x0 ,0x11 ,0xa8 ,0x14 ,0x8d ,0x1c ,0x0 ,0x0 ,0x0 ,0x0 ,0x2a ,0x79 ,0x47 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x4 ,0x0 ,0x0 ,0x1f ,0x4e ,0x1 ,0x1 ,0x8e ,0x80 ,0x1 ,0x0 ,0x5f ,0xd2 ,0xa ,0x10 ,0xd3 ,0x66 ,0x0 ,0x0 ,0x89 ,0xeb ,0x9b ,0xce ,0xec ,0x26 ,0x0 ,0x1 ,0x8d ,0xf8 ,0xe7 ,0xdc ,0xd3 ,0xd ,0x0 ,0x0 ,0xa ,0x3a ,0x16 ,0x6c ,0xe8 ,0x2b ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0xb5 ,0x84 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x7b ,0x2b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x33 ,0x3d ,0x22 ,0x1b ,0x1 ,0x0 ,0x0 ,0x19 ,0xc8 ,0xe3 ,0xe9 ,0xe0 ,0x1c ,0x0 ,0x0 ,0x0 ,0xc ,0x17 ,0x9e ,0xcf ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0xe0 ,0x5c ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xb3 ,0xb7 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x11 ,0xe0 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2b ,0xd2 ,0x11 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xe ,0xe ,0x3 ,0x0 ,0x0 ,0x0 ,0x4 ,0x90 ,0xb3 ,0xbe ,0x61 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xf ,0xa0 ,0x49 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0xa0 ,0xca ,0xa2 ,0x21 ,0x3 ,0x6 ,0x0 ,0xc ,0x2e ,0x9 ,0x37 ,0xb7 ,0x7a ,0x14 ,0x0 ,0x0 ,0x0 ,0x3 ,0x5c ,0xe0 ,0x2d ,0x0 ,0x0 ,0x0 ,0x1 ,0x6a ,0xac ,0xae ,0x6 ,0x0 ,0x0 ,0x0 ,0x4 ,0x93 ,0x99 ,0x17 ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0xbe ,0x3c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6b ,0x62 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0xb2 ,0x1e ,0x0 ,0x5 ,0x4 ,0x0 ,0x0 ,0x9 ,0xcb ,0x1d ,0xf ,0xa3 ,0x96 ,0x8 ,0x0 ,0x4 ,0xb1 ,0x27 ,0x83 ,0x66 ,0xa2 ,0x2c ,0x0 ,0x0 ,0x51 ,0xc3 ,0xc8 ,0x69 ,0xa5 ,0x9 ,0x0 ,0x0 ,0x3 ,0x4d ,0xa0 ,0x7d ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x2e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x32 ,0x99 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0xa8 ,0x68 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4b ,0xd0 ,0xe ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x91 ,0xc0 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0xc6 ,0x7a ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2e ,0xe5 ,0x29 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x29 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0xd ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0x91 ,0xb4 ,0xb2 ,0xa ,0x0 ,0x0 ,0x0 ,0x31 ,0x3b ,0x48 ,0xb2 ,0x8 ,0x0 ,0x0 ,0x0 ,0x7 ,0x95 ,0xdf ,0x89 ,0x3 ,0x0 ,0x0 ,0x0 ,0x1 ,0x12 ,0x14 ,0xa5 ,0x2e ,0x0 ,0x0 ,0x25 ,0x1b ,0x0 ,0x4 ,0x9f ,0x2d ,0x0 ,0x0 ,0x4e ,0x5a ,0x2a ,0x7e ,0x8b ,0x5 ,0x0 ,0x0 ,0x17 ,0x92 ,0x8c ,0x35 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x85 ,0x5b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4d ,0x66 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x18 ,0x95 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5c ,0x4b ,0x3d ,0x54 ,0x5 ,0x0 ,0x0 ,0x0 ,0x91 ,0x95 ,0x83 ,0x8d ,0x29 ,0x0 ,0x0 ,0x0 ,0x4c ,0xd6 ,0x52 ,0x97 ,0x13 ,0x0 ,0x0 ,0x0 ,0x4 ,0x5a ,0xab ,0x5e ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x54 ,0x5d ,0x3f ,0x7 ,0x0 ,0x0 ,0x0 ,0x4a ,0x21 ,0x36 ,0x64 ,0x2 ,0x0 ,0x0 ,0x22 ,0x47 ,0x27 ,0x84 ,0x11 ,0x0 ,0x0 ,0x0 ,0x42 ,0x89 ,0xbb ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x5c ,0x52 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2e ,0x61 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x66 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x8 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0xa6 ,0xd2 ,0xc7 ,0x38 ,0x0 ,0x0 ,0x0 ,0x0 ,0x36 ,0xd8 ,0xfe ,0xa0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2e ,0xf1 ,0xfc ,0x8c ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x4c ,0xa0 ,0xcb ,0x7 ,0x0 ,0x0 ,0x0 ,0xb ,0xc ,0xaa ,0xc5 ,0x6 ,0x0 ,0x0 ,0x19 ,0xcf ,0xd3 ,0xf3 ,0x68 ,0x0 ,0x0 ,0x0 ,0x8 ,0x7d ,0xb6 ,0x42 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x3d ,0x17 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xdb ,0x4b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0xde ,0x91 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xc3 ,0xdf ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xaf ,0xe6 ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xad ,0xeb ,0x17 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x47 ,0xec ,0x5f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x31 ,0x23 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xb ,0x0 ,0x0 ,0x0 ,0x1 ,0x35 ,0x23 ,0x9d ,0xa2 ,0x3 ,0x0 ,0x2 ,0x63 ,0x8f ,0x8a ,0xc9 ,0x19 ,0x0 ,0x0 ,0x59 ,0xce ,0x32 ,0xe7 ,0x94 ,0x6e ,0x2 ,0x4 ,0xbb ,0xef ,0xc2 ,0xfa ,0xf2 ,0x78 ,0x1 ,0x1 ,0x41 ,0xa5 ,0xef ,0xee ,0x5d ,0x5 ,0x0 ,0x0 ,0x0 ,0x3 ,0x90 ,0xf7 ,0x67 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0x78 ,0x24 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x22 ,0x90 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0xbf ,0x32 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x54 ,0x9e ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0xc6 ,0xc ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x80 ,0x20 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x59 ,0x35 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2e ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1c ,0x64 ,0x53 ,0x62 ,0x23 ,0x0 ,0x0 ,0x0 ,0x22 ,0x81 ,0xb9 ,0xf6 ,0x45 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0x6a ,0xdf ,0x23 ,0x14 ,0x13 ,0x0 ,0x0 ,0x47 ,0xe1 ,0xf1 ,0xc9 ,0xaa ,0x77 ,0x0 ,0x0 ,0x6 ,0xc6 ,0x77 ,0xa ,0x3 ,0x0 ,0x0 ,0x0 ,0x5 ,0xc6 ,0x69 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0xaa ,0x40 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x53 ,0x93 ,0x17 ,0x0 ,0x0 ,0x0 ,0x2 ,0x77 ,0x5a ,0x27 ,0x49 ,0x0 ,0x0 ,0x0 ,0x4a ,0x7a ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xab ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0xab ,0x9 ,0xe ,0x11 ,0x2 ,0x0 ,0x0 ,0xb ,0xbe ,0x88 ,0x9c ,0xc7 ,0x38 ,0x0 ,0x0 ,0x0 ,0x4c ,0xcc ,0x97 ,0xa1 ,0x17 ,0x0 ,0x0 ,0x0 ,0x1 ,0xa ,0xe ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3b ,0x9e ,0x9b ,0x17 ,0x0 ,0x0 ,0x0 ,0x2d ,0xd9 ,0x7d ,0x97 ,0x9b ,0x3 ,0x0 ,0x0 ,0x63 ,0x67 ,0x3 ,0x5e ,0xee ,0x2e ,0x0 ,0x0 ,0x4a ,0xb2 ,0x8f ,0xe4 ,0xea ,0x20 ,0x0 ,0x0 ,0x4 ,0x3d ,0x5f ,0x34 ,0xa2 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2f ,0x94 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x33 ,0xb9 ,0x4 ,0x0 ,0x0 ,0x0 ,0x8 ,0x85 ,0x17 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3b ,0x34 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x75 ,0xe ,0x4 ,0x29 ,0x1a ,0x0 ,0x0 ,0x3 ,0x7c ,0x8 ,0x69 ,0x4e ,0x61 ,0xe ,0x0 ,0x4 ,0x80 ,0x23 ,0x54 ,0x1 ,0x39 ,0x1f ,0x0 ,0x0 ,0x60 ,0x4d ,0x77 ,0x53 ,0x68 ,0x8 ,0x0 ,0x0 ,0x5 ,0x52 ,0x76 ,0x53 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x9 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x61 ,0xc6 ,0xa5 ,0x1d ,0x0 ,0x0 ,0x2 ,0x74 ,0x99 ,0x2c ,0x3a ,0x8c ,0x5 ,0x0 ,0x19 ,0xc5 ,0x16 ,0x0 ,0x1 ,0x64 ,0x14 ,0x0 ,0x43 ,0x94 ,0x0 ,0x0 ,0x1 ,0x6f ,0x13 ,0x0 ,0x46 ,0x7e ,0x1 ,0x0 ,0x26 ,0x9f ,0x5 ,0x0 ,0x9 ,0xab ,0x55 ,0x47 ,0xa8 ,0x2c ,0x0 ,0x0 ,0x0 ,0x16 ,0x5e ,0x76 ,0x23 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x32 ,0x3f ,0x4d ,0x76 ,0x95 ,0x4f ,0x1 ,0x5f ,0xb7 ,0xa1 ,0x43 ,0x30 ,0x35 ,0x21 ,0x4 ,0x8e ,0x9c ,0x97 ,0x3a ,0x4 ,0x0 ,0x0 ,0x0 ,0x1 ,0x3 ,0x1e ,0x8c ,0x80 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x12 ,0xc2 ,0x17 ,0x0 ,0x0 ,0x7 ,0x7 ,0x21 ,0xa4 ,0x80 ,0x3 ,0x0 ,0x0 ,0x29 ,0xb5 ,0xc8 ,0x51 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1e ,0xa ,0x0 ,0x0 ,0xa ,0x15 ,0x0 ,0x0 ,0x94 ,0x39 ,0x0 ,0x0 ,0x35 ,0x80 ,0x0 ,0x3 ,0xab ,0x22 ,0x0 ,0x3 ,0x5d ,0x80 ,0x2 ,0x8 ,0xc2 ,0x13 ,0x0 ,0x6f ,0xe3 ,0xaf ,0x9b ,0x9c ,0xd5 ,0xd ,0x0 ,0x13 ,0x13 ,0x11 ,0x1e ,0x44 ,0xd4 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0xc2 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x28 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x4d ,0xa0 ,0x7d ,0x7 ,0x0 ,0x0 ,0x0 ,0x4b ,0x9d ,0x1d ,0x54 ,0x3d ,0x0 ,0x0 ,0x1 ,0x9f ,0x3a ,0x4 ,0xc ,0xe ,0x1 ,0x0 ,0x0 ,0x4e ,0xa9 ,0x8d ,0xa7 ,0xa9 ,0x41 ,0x0 ,0x0 ,0x1 ,0x9 ,0x9 ,0x5 ,0x52 ,0x77 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x88 ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x79 ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x2e ,0x39 ,0x1b ,0x0 ,0x0 ,0x0 ,0x8 ,0x9c ,0x6d ,0x47 ,0x84 ,0x23 ,0x0 ,0x0 ,0x3a ,0x65 ,0x2 ,0xe ,0x96 ,0xd ,0x0 ,0x0 ,0x30 ,0xad ,0x80 ,0xad ,0x81 ,0x1 ,0x0 ,0x0 ,0x1 ,0x1a ,0x25 ,0x44 ,0x5d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3b ,0x5f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5c ,0x37 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x1f ,0x33 ,0x18 ,0x3 ,0x0 ,0x0 ,0x28 ,0xad ,0x91 ,0x65 ,0x68 ,0x70 ,0x1 ,0x0 ,0x2a ,0x42 ,0x5 ,0x0 ,0x15 ,0x9f ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2d ,0xb1 ,0x5 ,0x0 ,0x6 ,0x41 ,0x68 ,0x49 ,0x95 ,0x80 ,0x1 ,0x1 ,0x6e ,0x9b ,0x2d ,0x66 ,0xdf ,0x44 ,0x0 ,0xe ,0xcf ,0x55 ,0x69 ,0x6d ,0x1c ,0x25 ,0x0 ,0x0 ,0x1d ,0x33 ,0xc ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x23 ,0xa6 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0xb6 ,0x62 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5c ,0xae ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0xf ,0xc5 ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4c ,0x8c ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4e ,0xa1 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x20 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xa ,0x6d ,0x93 ,0x8 ,0x0 ,0x0 ,0x0 ,0x8 ,0x9b ,0x7f ,0x55 ,0x36 ,0x0 ,0x0 ,0x0 ,0x36 ,0xe9 ,0xaa ,0xd1 ,0x99 ,0x0 ,0x0 ,0x0 ,0x7 ,0x44 ,0x39 ,0x67 ,0x6e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x80 ,0x60 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x93 ,0x5e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6d ,0x4d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x67 ,0x21 ,0x2f ,0x13 ,0x0 ,0x0 ,0x0 ,0x37 ,0x7e ,0x5 ,0x8e ,0xb ,0x0 ,0x0 ,0x5 ,0xa0 ,0x14 ,0x17 ,0x83 ,0x4 ,0x0 ,0x0 ,0xd ,0xb1 ,0x2e ,0x71 ,0x81 ,0x5e ,0x0 ,0x0 ,0x0 ,0x2f ,0x75 ,0xcc ,0x37 ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0xe ,0x91 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x2c ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x1c ,0x36 ,0x6 ,0x0 ,0x0 ,0x0 ,0x1 ,0x60 ,0x92 ,0xa1 ,0x56 ,0x0 ,0x0 ,0x0 ,0xc ,0xab ,0x47 ,0xbb ,0x21 ,0x0 ,0x0 ,0x0 ,0x8 ,0xc8 ,0xe0 ,0x6e ,0x4 ,0x0 ,0x0 ,0x0 ,0x38 ,0xb6 ,0xc0 ,0x1b ,0x0 ,0x0 ,0x0 ,0x21 ,0xb3 ,0x1a ,0x66 ,0x59 ,0x0 ,0x0 ,0x0 ,0x5c ,0x99 ,0x82 ,0xa2 ,0x15 ,0x0 ,0x0 ,0x0 ,0xb ,0x47 ,0x2c ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0x80 ,0x85 ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0x60 ,0xc3 ,0x50 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0xd6 ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4e ,0xcc ,0xd ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0xac ,0x5b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x13 ,0xde ,0x1b ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x18 ,0xb2 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0xc ,0x7 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x41 ,0x84 ,0xb2 ,0x1a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x26 ,0xc2 ,0x16 ,0x0 ,0x0 ,0x0 ,0x0 ,0x19 ,0xbb ,0x33 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x6d ,0x8e ,0xe ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x81 ,0x6c ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0x39 ,0xcb ,0x2b ,0x0 ,0x0 ,0x0 ,0x0 ,0x41 ,0x9f ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x35 ,0x46 ,0x10 ,0x0 ,0x0 ,0x0 ,0x1 ,0x81 ,0x87 ,0x7c ,0x9d ,0x3 ,0x0 ,0x0 ,0xa ,0xa9 ,0xb ,0x73 ,0xc3 ,0x7 ,0x0 ,0x0 ,0x7 ,0xa5 ,0x6b ,0xe1 ,0x44 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0x44 ,0x96 ,0x3d ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x71 ,0x59 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5c ,0x67 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6e ,0x73 ,0x3e ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3a ,0x98 ,0xc4 ,0x12 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x68 ,0x26 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x66 ,0xc6 ,0xa1 ,0x19 ,0x0 ,0x0 ,0x0 ,0x29 ,0x9b ,0xb0 ,0x1a ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4b ,0x46 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3d ,0x20 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x25 ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2b ,0x9b ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0x98 ,0x18 ,0x1c ,0x0 ,0x0 ,0x0 ,0x1 ,0x77 ,0x2f ,0x39 ,0x84 ,0x0 ,0x0 ,0x0 ,0x3 ,0x9b ,0x68 ,0xae ,0x36 ,0x0 ,0x0 ,0x0 ,0x0 ,0x10 ,0x5e ,0xb3 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x51 ,0x78 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1a ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xd ,0x6d ,0x0 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x31 ,0x62 ,0x3 ,0x69 ,0xa ,0x0 ,0x0 ,0x0 ,0x4f ,0x3a ,0x5f ,0x9b ,0x3 ,0x0 ,0x0 ,0x0 ,0x1e ,0xae ,0xc5 ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x9 ,0x75 ,0x1f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x9a ,0xe ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x44 ,0x9 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6 ,0x0 ,0x0 ,0x24 ,0x0 ,0x0 ,0x0 ,0x5 ,0x93 ,0xa ,0x8 ,0x9d ,0x7 ,0x0 ,0x0 ,0x31 ,0xa9 ,0x4 ,0xa ,0xcc ,0x48 ,0x15 ,0x15 ,0x99 ,0x4a ,0x0 ,0x0 ,0x65 ,0xee ,0xe8 ,0xc9 ,0xe0 ,0x1d ,0x0 ,0x0 ,0x3 ,0x31 ,0x59 ,0x3c ,0xbf ,0xa ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0xc ,0xaf ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x58 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x16 ,0x6e ,0x55 ,0x1 ,0x0 ,0x0 ,0x0 ,0x15 ,0x87 ,0x1a ,0x77 ,0x7 ,0x0 ,0x0 ,0x2 ,0x7c ,0x19 ,0xf ,0x95 ,0x4 ,0x0 ,0x0 ,0x9 ,0x9f ,0x33 ,0x97 ,0x40 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1c ,0x35 ,0xb3 ,0xc ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x14 ,0x91 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x33 ,0x8b ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x21 ,0x8c ,0xb3 ,0x98 ,0x13 ,0x0 ,0x0 ,0x1e ,0xd3 ,0x82 ,0x1b ,0x6d ,0x43 ,0x0 ,0x0 ,0x47 ,0x7f ,0x4 ,0x4 ,0x9f ,0x2c ,0x0 ,0x0 ,0x1 ,0x3 ,0x1e ,0x71 ,0xb7 ,0x6 ,0x0 ,0x0 ,0x0 ,0x28 ,0xe1 ,0xf3 ,0xac ,0x5 ,0x0 ,0x0 ,0x0 ,0x48 ,0xe3 ,0x54 ,0x9b ,0x21 ,0x0 ,0x0 ,0x0 ,0x7 ,0x1a ,0x1 ,0x31 ,0x15 ,0x0 ,0x0 ,0x0 ,0x1 ,0x4 ,0xc ,0x8 ,0x1 ,0x0 ,0x0 ,0x36 ,0x9d ,0xb5 ,0xd7 ,0xc4 ,0x26 ,0x0 ,0x0 ,0x96 ,0x93 ,0x37 ,0x1e ,0x3c ,0x26 ,0x0 ,0x0 ,0x4d ,0xd0 ,0xa7 ,0x6e ,0x13 ,0x0 ,0x0 ,0x0 ,0xb ,0x80 ,0x95 ,0xc8 ,0xc1 ,0xe ,0x0 ,0x0 ,0x0 ,0x2 ,0x4 ,0x27 ,0xe7 ,0x4d ,0x0 ,0x0 ,0x5 ,0x7d ,0xaa ,0xe1 ,0xe1 ,0x26 ,0x0 ,0x0 ,0x0 ,0x35 ,0xa8 ,0x6b ,0x28 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x33 ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x5f ,0x68 ,0x4 ,0x2 ,0x1 ,0x0 ,0x0 ,0x1d ,0x95 ,0x6 ,0x2 ,0x61 ,0x14 ,0x0 ,0x1 ,0x7e ,0x30 ,0x1 ,0x48 ,0xa4 ,0x7 ,0x0 ,0x3 ,0xa4 ,0x43 ,0x74 ,0xb4 ,0x18 ,0x0 ,0x0 ,0x0 ,0x30 ,0x9e ,0xb5 ,0x16 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0xaf ,0x1e ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x2b ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x28 ,0x6d ,0x2a ,0x5 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x52 ,0x96 ,0x8c ,0xc ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x70 ,0x47 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4c ,0x56 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x6b ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x82 ,0x27 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x99 ,0x14 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x7 ,0x8d ,0x2c ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x63 ,0x65 ,0x2 ,0x0 ,0x0 ,0x0 ,0x0 ,0x29 ,0x99 ,0x9 ,0xd ,0x1 ,0x0 ,0x0 ,0x0 ,0x8d ,0x2e ,0x87 ,0xbe ,0x37 ,0x0 ,0x0 ,0x5 ,0xa2 ,0x1b ,0xad ,0x50 ,0x42 ,0x0 ,0x0 ,0x5 ,0xa2 ,0x2b ,0xb5 ,0xac ,0x15 ,0x0 ,0x0 ,0x0 ,0x3a ,0x99 ,0x85 ,0x46 ,0xf ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x20 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4 ,0x0 ,0x95 ,0x4e ,0xf ,0x9 ,0x16 ,0x54 ,0xa5 ,0x7 ,0x19 ,0xa6 ,0xd4 ,0xca ,0xbe ,0xee ,0x79 ,0x3 ,0x0 ,0x4 ,0x11 ,0x21 ,0x9d ,0x9e ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1b ,0xc5 ,0x15 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x4d ,0xba ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x58 ,0x72 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x8 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x5a ,0xb3 ,0xb ,0x0 ,0x0 ,0x0 ,0x0 ,0x3a ,0x55 ,0x81 ,0x35 ,0x0 ,0x0 ,0x0 ,0x5 ,0x8c ,0xc ,0x83 ,0x3b ,0x0 ,0x0 ,0x0 ,0x9 ,0x9a ,0x5f ,0xc3 ,0x3f ,0x0 ,0x0 ,0x0 ,0x0 ,0x41 ,0x48 ,0x48 ,0x6a ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x15 ,0x91 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x2 ,0x5e ,0x2b ,0x0 ,0x0 ,0x0 ,0x2 ,0x18 ,0x6 ,0x0 ,0x0 ,0x0 ,0x0 ,0xb ,0x8b ,0xb3 ,0x9c ,0xb ,0x0 ,0x0 ,0x4 ,0x8d ,0x69 ,0x7 ,0x50 ,0x9e ,0x13 ,0x0 ,0x22 ,0xab ,0xa ,0x0 ,0x3 ,0x8b ,0x9c ,0x2 ,0x2f ,0x67 ,0x0 ,0x0 ,0x0 ,0x1d ,0xd8 ,0x18 ,0x16 ,0x86 ,0x5 ,0x3 ,0x4 ,0x12 ,0xc3 ,0x24 ,0x2 ,0x3e ,0x96 ,0x9c ,0xa6 ,0xab ,0x81 ,0x8 ,0x0 ,0x0 ,0x9 ,0xc ,0xd ,0x7 ,0x1 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x0 ,0x5 ,0xe ,0x4 ,0x0 ,0x0 ,0x2 ,0x15 ,0x50 ,0xaf ,0xc1 ,0x33 ,0x0 ,0x17 ,0xa4 ,0xd2 ,0x98 ,0x43 ,0xc ,0x1 ,0x0 ,0x16 ,0xe1 ,0x35 ,0x3 ,0x0 ,0x0 ,0x0 ,0x0 ,0x3 ,0x71 ,0xc2 ,0x70 ,0x4 ,0x0 ,0x0 ,0x0 ,0x0 ,0x1 ,0x12 ,0xad ,0x44 ,0x0 ,0x0 ,0x0 ,0x5 ,0x59 ,0x44 ,0xbb ,0x4b ,0x0 ,0x0 ,0x0 ,0x2 ,0x4d ,0x96 ,0x6e ,0x8 ,0x0 ,0x0 ,0x7 ,0x2 ,0x1 ,0x0 ,0x4 ,0x1 ,0x4 ,0x9 ,0x5 ,0x9 ,0x0 ,0x6 ,0x9 ,0x0 ,0x1 ,0x5 ,0x9 ,0x7 ,0x3 ,0x4 ,0x9 ,0x6 ,0x6 ,0x5 ,0x4 ,0x0 ,0x7 ,0x4 ,0x0 ,0x1 ,0x3 ,0x1 ,0x3 ,0x4 ,0x7 ,0x2 ,0x7 ,0x1 ,0x2 ,0x1 ,0x1 ,0x7 ,0x4 ,0x2 ,0x3 ,0x5 ,0x1 ,0x2 ,0x4 ,0x4 ,0x6 ,0x3 ,0x5 ,0x5 ,0x6 ,0x0 ,0x4 ,0x1 ,0x9 ,0x5 ,0x7 ,0x8 ,0x9 ,0x3 ,0x7 ,0x4 ,0x6 ,0x4 ,0x3 ,0x0 ,0x7 ,0x0 ,0x2 ,0x9 ,0x1 ,0x7 ,0x3 ,0x2 ,0x9 ,0x7 ,0x7 ,0x6 ,0x2 ,0x7 ,0x8 ,0x4 ,0x7 ,0x3 ,0x6 ,0x1 ,0x3 ,0x6 ,0x9 ,0x3 ,0x1 ,0x4 ,0x1 ,0x7 ,0x6 ,0x9 ,0x6 ,0x0 ,0x5 ,0x4 ,0x9 ,0x9 ,0x2 ,0x1 ,0x9 ,0x4 ,0x8 ,0x7 ,0x3 ,0x9 ,0x7 ,0x4 ,0x4 ,0x4 ,0x9 ,0x2 ,0x5 ,0x4 ,0x7 ,0x6 ,0x7 ,0x9 ,0x0 ,0x5};
 
+/* generated by generate-headers.py, the modules are in benchmarks.S */
+extern const uint8_t aha_mont64[1763] __attribute__((aligned (4)));
+extern const uint8_t crc32[1555] __attribute__((aligned (4)));
+extern const uint8_t depthconv[1052] __attribute__((aligned (4)));
+extern const uint8_t edn[4082] __attribute__((aligned (4)));
+extern const uint8_t huffbench[4801] __attribute__((aligned (4)));
+extern const uint8_t matmult_int[2103] __attribute__((aligned (4)));
+extern const uint8_t md5sum[3552] __attribute__((aligned (4)));
+extern const uint8_t nettle_aes[13474] __attribute__((aligned (4)));
+extern const uint8_t nettle_sha256[6623] __attribute__((aligned (4)));
+extern const uint8_t nsichneu[28920] __attribute__((aligned (4)));
+extern const uint8_t picojpeg[15600] __attribute__((aligned (4)));
+extern const uint8_t qrduino[16435] __attribute__((aligned (4)));
+extern const uint8_t sglib_combined[6547] __attribute__((aligned (4)));
+extern const uint8_t slre[4538] __attribute__((aligned (4)));
+extern const uint8_t statemate[8330] __attribute__((aligned (4)));
+extern const uint8_t tarfind[1354] __attribute__((aligned (4)));
+extern const uint8_t ud[1326] __attribute__((aligned (4)));
+extern const uint8_t wikisort[10544] __attribute__((aligned (4)));
+extern const uint8_t xgboost[40456] __attribute__((aligned (4)));
+#ifdef BENCH_SHELL
+#include "benchmarks-defs.h"
+const bench_entry bench_table[] = {
+    {"aha_mont64", aha_mont64, sizeof aha_mont64, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"crc32", crc32, sizeof crc32, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"depthconv", depthconv, sizeof depthconv, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"edn", edn, sizeof edn, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"huffbench", huffbench, sizeof huffbench, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"matmult_int", matmult_int, sizeof matmult_int, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"md5sum", md5sum, sizeof md5sum, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"nettle_aes", nettle_aes, sizeof nettle_aes, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"nettle_sha256", nettle_sha256, sizeof nettle_sha256, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"nsichneu", nsichneu, sizeof nsichneu, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"picojpeg", picojpeg, sizeof picojpeg, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"qrduino", qrduino, sizeof qrduino, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"sglib_combined", sglib_combined, sizeof sglib_combined, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"slre", slre, sizeof slre, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"statemate", statemate, sizeof statemate, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"tarfind", tarfind, sizeof tarfind, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"ud", ud, sizeof ud, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"wikisort", wikisort, sizeof wikisort, 8192, 0, {}, BENCH_HOOK_NONE},
+    {"xgboost", xgboost, sizeof xgboost, 8192, 0, {}, BENCH_HOOK_NONE},
+};
+const uint32_t bench_table_len = sizeof bench_table / sizeof bench_table[0];
+#endif
 
-#pragma GCC diagnostic pop
 #endif
-    
\ No newline at end of file